@@ -0,0 +1,40 @@
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "parameter.h"
+#include "utils/tsqueue.h"
+
+namespace warpgate::utils::bulk {
+    typedef tsqueue<std::pair<std::string, Semantic>> image_queue_t;
+
+    // Converts one model to `output_filename`, queueing its textures on the given queue
+    typedef std::function<void(const std::string &name, const std::filesystem::path &output_filename, image_queue_t &image_queue)> convert_fn;
+
+    /**
+     * The inputs of a bulk conversion: the files on disk matching `input` if it is a glob
+     * pattern, otherwise the asset names listed one per line in the file `input`.
+     * Throws std::runtime_error if the list cannot be read.
+     */
+    std::vector<std::string> inputs(std::string input);
+
+    /**
+     * Converts every input into `output_directory` on `job_count` threads, naming each output
+     * after its input with the extension of `format`. Each model fills its own queue, and only
+     * textures not already seen are passed on to `image_queue`, so textures shared between
+     * models are only processed once. Inputs whose output name is already taken by an earlier
+     * input are skipped. Returns the number of inputs that failed to convert or were skipped.
+     */
+    size_t convert(
+        const std::vector<std::string> &inputs,
+        const std::filesystem::path &output_directory,
+        std::string format,
+        uint32_t job_count,
+        image_queue_t &image_queue,
+        convert_fn convert
+    );
+}
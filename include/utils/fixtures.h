@@ -0,0 +1,68 @@
+#pragma once
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace warpgate::utils::fixtures {
+    /**
+     * Synthetic assets laid out exactly the way the loaders parse them, so benchmarks can
+     * run without a game install. Every generator is deterministic: the same arguments
+     * always produce the same bytes on every platform.
+     */
+
+    // Vehicle input layout: rigid, with the joint index packed into the binormal
+    constexpr uint32_t rigid_material_definition = 2340912194;
+    // Character input layout: skinned, with blend weights and indices in stream 0
+    constexpr uint32_t skinned_material_definition = 2201291178;
+
+    /**
+     * A DMOD file with one material and one mesh. The mesh is a square grid of
+     * `vertex_count` vertices (rounded down to a square) triangulated as a list, with
+     * `bone_count` bones taken from the PS2 bone table. Texture filenames in the DMAT are
+     * `fixture_C.dds`, `fixture_N.dds` and `fixture_S.dds`.
+     */
+    std::vector<uint8_t> dme(uint32_t vertex_count, bool skinned = false, uint32_t bone_count = 8, uint32_t seed = 0);
+
+    /**
+     * A decompressed CNK0 (chunk header followed by the payload) made of four render
+     * batches, each a grid of `quads_per_side`² quads, and 16 tiles with one eco each.
+     */
+    std::vector<uint8_t> cnk0(uint32_t quads_per_side = 64, uint32_t seed = 0);
+
+    /**
+     * A decompressed CNK1 with one texture per CNK0 render batch. Each texture holds a
+     * `texture_size`² CNX and SNY map as produced by dds(), and empty extra maps.
+     */
+    std::vector<uint8_t> cnk1(uint32_t texture_size = 64, uint32_t seed = 0);
+
+    // Compresses a decompressed chunk (as returned by cnk0) into the LZHAM forgelight chunk format
+    std::vector<uint8_t> compress_chunk(std::span<const uint8_t> decompressed);
+
+    /**
+     * A zone with `object_count` runtime objects of `instances_per_object` instances each,
+     * scattered over a square of `chunks_per_side`² chunks centred on the origin. Objects
+     * reference `fixture_object_{i}.adr` and flora `fixture_flora_{i}.adr`, for i from 0.
+     * `version` is 5 (the current layout) or 3 (the newest zone_converter exports).
+     */
+    std::vector<uint8_t> zone(uint32_t object_count, uint32_t instances_per_object, uint32_t chunks_per_side = 4, uint32_t seed = 0, uint32_t version = 5);
+
+    // Number of flora definitions written by zone()
+    constexpr uint32_t zone_flora_count = 2;
+
+    // An ActorRuntime document whose Base is `model`, with an AnimationNetwork if `network` is not empty
+    std::vector<uint8_t> adr(std::string_view model, std::string_view network = {});
+
+    /**
+     * An NSA animation with static, dynamic and root segments. Half of the bones are
+     * animated, each with a dynamic translation and rotation track of `sample_count` samples.
+     */
+    std::vector<uint8_t> nsa(uint32_t bone_count, uint32_t sample_count, uint32_t seed = 0);
+
+    // An MRN made of `animation_count` NSA data packets as produced by nsa()
+    std::vector<uint8_t> mrn(uint32_t animation_count, uint32_t bone_count, uint32_t sample_count, uint32_t seed = 0);
+
+    // Uncompressed RGBA8 DDS images, a 2D texture and a cube map
+    std::vector<uint8_t> dds(uint32_t width, uint32_t height, uint32_t seed = 0);
+    std::vector<uint8_t> dds_cube(uint32_t size, uint32_t seed = 0);
+}
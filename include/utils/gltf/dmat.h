@@ -2,6 +2,7 @@
 #include <filesystem>
 #include <optional>
 #include <span>
+#include <unordered_map>
 #include <vector>
 
 #include <dmat.h>
@@ -12,6 +13,10 @@
 #include "version.h"
 
 namespace warpgate::utils::gltf::dmat {
+    // Identifies the glTF material add_material_to_gltf would build, without building it:
+    // the material definition plus every texture parameter and the texture bound to it.
+    uint64_t material_key(const DMAT &dmat, uint32_t material_index, bool export_textures);
+
     int add_material_to_gltf(
         tinygltf::Model &gltf, 
         const DMAT &dmat, 
@@ -19,12 +24,20 @@ namespace warpgate::utils::gltf::dmat {
         int sampler_index,
         bool export_textures,
         std::unordered_map<uint32_t, uint32_t> &texture_indices,
-        std::unordered_map<uint32_t, std::vector<uint32_t>> &material_indices,
+        std::unordered_map<uint64_t, uint32_t> &material_indices,
         tsqueue<std::pair<std::string, Semantic>> &image_queue,
         std::filesystem::path output_directory,
         std::string dme_name
     );
 
+    // Converts one texture and writes it to `output_directory`/textures
+    void process_image(
+        synthium::Manager& manager, 
+        std::string texture_name, 
+        Semantic semantic, 
+        const std::filesystem::path &output_directory
+    );
+
     void process_images(
         synthium::Manager& manager, 
         utils::tsqueue<std::pair<std::string, Semantic>>& queue, 
@@ -19,14 +19,15 @@ namespace warpgate::utils::gltf::dme {
         tsqueue<std::pair<std::string, Semantic>> &image_queue,
         std::filesystem::path output_directory,
         std::unordered_map<uint32_t, uint32_t> &texture_indices,
-        std::unordered_map<uint32_t, std::vector<uint32_t>> &material_indices,
+        std::unordered_map<uint64_t, uint32_t> &material_indices,
         int sampler_index,
         bool export_textures,
         bool include_skeleton,
-        bool rigify
+        bool rigify,
+        bool quantized = false
     );
     
-    int add_mesh_to_gltf(tinygltf::Model &gltf, const DME &dme, uint32_t index, uint32_t material_index, bool include_skeleton = true);
+    int add_mesh_to_gltf(tinygltf::Model &gltf, const DME &dme, uint32_t index, uint32_t material_index, bool include_skeleton = true, bool quantized = false);
     int add_skeleton_to_gltf(tinygltf::Model &gltf, const DME &dme, std::vector<int> mesh_nodes, bool rigify);
     int add_actorsockets_to_gltf(tinygltf::Model &gltf, ActorSockets &actorSockets, std::string basename, int parent);
     
@@ -37,14 +38,17 @@ namespace warpgate::utils::gltf::dme {
         bool export_textures, 
         bool include_skeleton,
         bool rigify,
-        int* parentIndexOut = nullptr
+        int* parentIndexOut = nullptr,
+        bool quantized = false
     );
+    // With `quantized`, keeps compact vertex formats allowed by KHR_mesh_quantization instead of expanding them to floats
     std::vector<uint8_t> expand_vertex_stream(
         nlohmann::json &layout, 
         std::span<uint8_t> data, 
         uint32_t stream, 
         bool is_rigid, 
         const DME &dme,
-        std::shared_ptr<const Mesh> mesh
+        const Mesh *mesh,
+        bool quantized = false
     );
 }
\ No newline at end of file
@@ -0,0 +1,78 @@
+#pragma once
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <glm/vec3.hpp>
+#include <cnk0.h>
+#include <zone.h>
+#include "tiny_gltf.h"
+#include "utils/aabb.h"
+
+namespace warpgate::utils::gltf::flora {
+    // Transforms of every instance of one flora model, laid out as the TRANSLATION, ROTATION
+    // and SCALE accessors of EXT_mesh_gpu_instancing
+    struct Instances {
+        std::vector<float> translations, rotations, scales;
+
+        size_t size() const {
+            return translations.size() / 3;
+        }
+
+        void append(const Instances &other);
+    };
+
+    // A zone eco layer that chunk tiles refer to by eco id and flora index
+    struct Layer {
+        // Index of the layer's flora in the zone
+        uint32_t flora;
+        float density, min_scale, max_scale, min_elevation, max_elevation;
+    };
+
+    /**
+     * The eco layers of a zone, resolved once so chunks can be scattered on many threads.
+     * Layers naming a flora the zone does not define are dropped.
+     */
+    class Ecosystems {
+    public:
+        Ecosystems(const warpgate::zone::Zone &zone);
+
+        // The layer used by a tile's flora, or nullptr if the zone does not define it
+        const Layer *layer(uint32_t eco_id, uint32_t flora_index) const;
+
+        uint32_t flora_count() const {
+            return (uint32_t)flora_names.size();
+        }
+        const std::string &flora_name(uint32_t flora) const {
+            return flora_names.at(flora);
+        }
+        const std::string &flora_model(uint32_t flora) const {
+            return flora_models.at(flora);
+        }
+
+    private:
+        std::unordered_map<uint32_t, std::vector<std::optional<Layer>>> ecos;
+        std::vector<std::string> flora_names, flora_models;
+    };
+
+    /**
+     * Scatters the flora of every tile of a chunk, keyed by the zone flora index. Instances are
+     * placed on the terrain at `origin` (the translation of the chunk's node) in zone space, at
+     * `density_scale` times each layer's density per square unit, and outside of a layer's
+     * elevation range or of `aabb` are dropped. The same chunk always gives the same instances.
+     */
+    std::unordered_map<uint32_t, Instances> scatter(
+        const warpgate::chunk::CNK0 &chunk,
+        const Ecosystems &ecosystems,
+        glm::dvec3 origin,
+        float density_scale,
+        std::optional<utils::AABB> aabb = {}
+    );
+
+    /**
+     * Draws the meshes of `model_node` (a node holding a mesh or whose children do) at every
+     * instance using EXT_mesh_gpu_instancing, sharing one set of instance accessors between them.
+     */
+    void add_instances_to_gltf(tinygltf::Model &gltf, int model_node, const Instances &instances);
+}
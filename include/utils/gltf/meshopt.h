@@ -0,0 +1,29 @@
+#pragma once
+#include <cstdint>
+#include <filesystem>
+
+#include "tiny_gltf.h"
+
+namespace warpgate::utils::gltf::meshopt {
+    // False when warpgate was built without meshoptimizer (WARPGATE_USE_MESHOPTIMIZER)
+    bool available();
+
+    /**
+     * Reorders the triangles of every indexed triangle primitive for the post-transform vertex
+     * cache and then for overdraw, and reorders its vertices for fetch locality. Interleaved
+     * vertex streams are assumed to start at a multiple of their stride, as the DME and chunk
+     * builders lay them out. Primitives are processed on up to `thread_count` threads.
+     */
+    void optimize(tinygltf::Model &gltf, uint32_t thread_count);
+
+    /**
+     * Repacks every buffer view into a single buffer, encoding the vertex streams and indices of
+     * each primitive with EXT_meshopt_compression. The uncompressed data is dropped, so the
+     * extension is marked as required.
+     */
+    void compress(tinygltf::Model &gltf);
+
+    // Writes a model produced by compress as GLB. tinygltf cannot express the data-less
+    // fallback buffer the extension needs, so its JSON chunk is patched before writing.
+    bool write_glb(tinygltf::Model &gltf, const std::filesystem::path &path);
+}
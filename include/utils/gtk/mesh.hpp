@@ -16,8 +16,8 @@ namespace warpgate::gtk {
     class Mesh {
     public:
         Mesh(
-            std::shared_ptr<const warpgate::Mesh> mesh,
-            std::shared_ptr<const warpgate::Material> material,
+            const warpgate::Mesh *mesh,
+            const warpgate::Material *material,
             nlohmann::json layout,
             std::unordered_map<uint32_t, std::shared_ptr<Texture>> &textures,
             std::shared_ptr<synthium::Manager> manager
@@ -0,0 +1,39 @@
+#pragma once
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <glm/vec3.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+namespace warpgate::utils::keyframes {
+    /**
+     * Returns the indices of the samples to keep so that linearly interpolating between
+     * them stays within `tolerance` of every dropped sample. The first and last samples
+     * are always kept.
+     */
+    std::vector<uint32_t> reduce(std::span<const glm::vec3> samples, float tolerance);
+    // As above, interpolating with slerp and measuring the error as an angle in radians
+    std::vector<uint32_t> reduce(std::span<const glm::quat> samples, float tolerance);
+
+    /**
+     * As reduce, but measuring the error of the CUBICSPLINE curve cubic_spline builds for the
+     * kept keys, so the tolerance holds for the spline that is written out.
+     */
+    std::vector<uint32_t> reduce_cubic_spline(std::span<const glm::vec3> samples, float tolerance, float sample_rate);
+    std::vector<uint32_t> reduce_cubic_spline(std::span<const glm::quat> samples, float tolerance, float sample_rate);
+
+    bool is_constant(std::span<const glm::vec3> samples, float tolerance);
+    bool is_constant(std::span<const glm::quat> samples, float tolerance);
+
+    // Flips rotations as needed so consecutive keys are interpolated along the shortest path
+    void align_hemispheres(std::span<glm::quat> rotations);
+
+    /**
+     * Builds CUBICSPLINE sampler output for the kept keys: an in-tangent, value and
+     * out-tangent per key. Tangents are per second, estimated from the dense samples
+     * around each key.
+     */
+    std::vector<glm::vec3> cubic_spline(std::span<const glm::vec3> samples, std::span<const uint32_t> keys, float sample_rate);
+    std::vector<glm::quat> cubic_spline(std::span<const glm::quat> samples, std::span<const uint32_t> keys, float sample_rate);
+}
@@ -0,0 +1,28 @@
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <span>
+
+namespace warpgate::utils {
+    // Read only memory mapping of a whole file, unmapped on destruction
+    struct MappedFile {
+        MappedFile(std::filesystem::path path);
+        ~MappedFile();
+
+        MappedFile(const MappedFile &) = delete;
+        MappedFile &operator=(const MappedFile &) = delete;
+
+        std::span<const uint8_t> data() const {
+            return {m_data, m_size};
+        }
+
+    private:
+        const uint8_t *m_data = nullptr;
+        size_t m_size = 0;
+#ifdef _WIN32
+        void *m_file = nullptr, *m_mapping = nullptr;
+#else
+        int m_fd = -1;
+#endif
+    };
+}
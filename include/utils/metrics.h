@@ -0,0 +1,47 @@
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <string>
+
+namespace warpgate::utils::metrics {
+    /**
+     * Process wide throughput counters. Every thread updates its own shard, so counting
+     * never takes a lock or contends on a cache line; readers sum the shards.
+     */
+    enum class Counter : uint32_t {
+        PackBytesRead,
+        ChunkBytesDecompressed,
+        VerticesExpanded,
+        AlbedoTexturesProcessed,
+        NormalTexturesProcessed,
+        SpecularTexturesProcessed,
+        DetailcubeTexturesProcessed,
+        ChunkTexturesProcessed,
+        PngBytesWritten,
+        MaterialCacheHits,
+        MaterialCacheMisses,
+        ModelCacheHits,
+        ModelCacheMisses,
+        FloraInstancesScattered,
+        // Gauges: the largest number of images or jobs waiting in a queue
+        ImageQueueHighWater,
+        JobQueueHighWater,
+        COUNT
+    };
+
+    // The snake case name used for the counter in JSON output
+    const char *name(Counter counter);
+
+    void add(Counter counter, uint64_t value = 1);
+
+    // For gauges: keeps the largest value recorded
+    void record_max(Counter counter, uint64_t value);
+
+    // The current total of a counter (or maximum of a gauge) over all threads
+    uint64_t value(Counter counter);
+
+    // All counters as a single JSON object keyed by name
+    std::string to_json();
+
+    bool write_json(const std::filesystem::path &path);
+}
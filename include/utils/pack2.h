@@ -0,0 +1,44 @@
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace warpgate::utils {
+    // CRC-64 (ECMA-182, reflected) of the uppercased name, the key pack2 maps store for each asset
+    uint64_t pack2_name_hash(std::string_view name);
+
+    /**
+     * Writes a pack2 archive that synthium::Manager can load. Assets are stored uncompressed and
+     * appended as they are added, so only the asset map is held in memory. Adding is threadsafe.
+     */
+    class Pack2Writer {
+    public:
+        Pack2Writer(std::filesystem::path path);
+        ~Pack2Writer();
+
+        // Appends an asset. Returns false if it could not be written.
+        bool add(std::string_view name, std::span<const uint8_t> data);
+
+        // Writes the asset map and the header. Returns false if the archive is incomplete.
+        bool close();
+
+        size_t asset_count() const;
+
+    private:
+        struct Entry {
+            uint64_t name_hash, offset, data_length;
+            uint32_t zipped, data_hash;
+        };
+
+        std::filesystem::path m_path;
+        std::ofstream m_output;
+        std::vector<Entry> m_entries;
+        uint64_t m_offset;
+        bool m_failed, m_closed;
+        mutable std::mutex m_mutex;
+    };
+}
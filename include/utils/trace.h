@@ -0,0 +1,60 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <ostream>
+
+namespace warpgate::utils::trace {
+    /**
+     * Scoped phase timing for the converters. Every thread records completed scopes into
+     * its own buffer, which is only shared with the thread that writes the results out.
+     * While tracing is disabled a Scope costs a single relaxed atomic load.
+     */
+
+    namespace detail {
+        extern std::atomic_bool enabled;
+
+        // Nanoseconds since the trace clock was started
+        int64_t now();
+        void record(const char *name, int64_t start, int64_t end);
+    }
+
+    // Starts recording. Scopes opened before this call are not recorded.
+    void enable();
+
+    inline bool enabled() {
+        return detail::enabled.load(std::memory_order_relaxed);
+    }
+
+    class Scope {
+    public:
+        // `name` is stored as a pointer and must outlive the trace, e.g. a string literal
+        Scope(const char *name): name_(name), start_(enabled() ? detail::now() : -1) {}
+
+        ~Scope() {
+            end();
+        }
+
+        // Records the scope now instead of at destruction, for phases that end mid-block
+        void end() {
+            if(start_ >= 0) {
+                detail::record(name_, start_, detail::now());
+                start_ = -1;
+            }
+        }
+
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+
+    private:
+        const char *name_;
+        int64_t start_;
+    };
+
+    // Writes every recorded scope as a Chrome trace event file, which Perfetto also loads
+    bool write_chrome_trace(const std::filesystem::path &path);
+
+    // Prints the count, total, mean and maximum duration of each phase, longest total first
+    void print_stats(std::ostream &output);
+}
@@ -0,0 +1,19 @@
+#pragma once
+#include <iostream>
+#include <ostream>
+
+#include "argparse/argparse.hpp"
+
+namespace warpgate::utils::trace {
+    /**
+     * The --trace and --stats options every tool shares. add_arguments() registers them,
+     * start() enables recording once arguments are parsed, and report() writes what was asked for.
+     */
+    void add_arguments(argparse::ArgumentParser &parser);
+
+    // Enables recording if either option was given
+    void start(argparse::ArgumentParser &parser);
+
+    // Writes the Chrome trace and prints the phase stats to `output`, as requested
+    void report(argparse::ArgumentParser &parser, std::ostream &output = std::cout);
+}
@@ -26,10 +26,14 @@ namespace warpgate::utils {
         bool is_closed(void);
         void close(void);
 
+        // The largest number of elements the queue has held at once.
+        size_t high_water_mark(void);
+
     private:
         std::queue<T> q;
         mutable std::mutex m;
         std::condition_variable c;
         bool closed;
+        size_t high_water;
     };
 }
\ No newline at end of file
@@ -1,1457 +0,0 @@
-#include <unordered_map>
-
-std::unordered_map<const char*, uint32_t> BONE_HASHMAP = {
-    {"ACTION", 4099058003u},
-    {"ACTION1", 2859017764u},
-    {"ACTION10", 4043274857u},
-    {"ACTION11", 3812941556u},
-    {"ACTION12", 3440751254u},
-    {"ACTION13", 3200259563u},
-    {"ACTION14", 671803519u},
-    {"ACTION15", 440159458u},
-    {"ACTION16", 196063177u},
-    {"ACTION17", 4110254693u},
-    {"ACTION2", 2770017160u},
-    {"ACTION3", 3474386815u},
-    {"ACTION4", 3080831125u},
-    {"ACTION5", 23516190u},
-    {"ACTION6", 3696658942u},
-    {"ACTION7", 638623093u},
-    {"ACTION8", 350780193u},
-    {"ACTION9", 1049972350u},
-    {"ACTIONLOWER", 2402683191u},
-    {"ACTIONLOWERRAIL", 959125743u},
-    {"ACTIONRAIL", 2434127015u},
-    {"ACTIONSPIN", 3001437478u},
-    {"ACTIONUPPER", 1951460982u},
-    {"ACTIONUPPERFRONT", 333254182u},
-    {"ACTIONUPPERMID", 3900869694u},
-    {"ACTIVE", 1370311378u},
-    {"AMMO0", 1928556915u},
-    {"AMMO1", 2904122814u},
-    {"AMMO2", 2059895067u},
-    {"AMMO3", 1200954035u},
-    {"AMMO4", 2641020513u},
-    {"AMMO5", 4092785520u},
-    {"AMMO6", 3366755556u},
-    {"ANTENNA", 3974794655u},
-    {"ANTENNABASE", 782497864u},
-    {"ANTENNABASE1", 1305566302u},
-    {"ANTENNABASE2", 1064320924u},
-    {"ANTENNABASE3", 1212698968u},
-    {"ANTENNATOP", 665543504u},
-    {"ARM1", 469708367u},
-    {"ARM2", 156469500u},
-    {"ARM3", 452865105u},
-    {"ARMPITCH", 3305278863u},
-    {"ARMYAW", 620852943u},
-    {"AXLEBACK", 3487385081u},
-    {"AXLEFRONT", 1023887647u},
-    {"BACKCORE", 984764821u},
-    {"BACKEND", 1769025762u},
-    {"BACKLEAF", 3474656460u},
-    {"BACKPITCH", 3459832652u},
-    {"BACKRAIL", 1406579442u},
-    {"BACKSIDES", 3740866747u},
-    {"BACKYAW", 3161250124u},
-    {"BARREL", 4085355481u},
-    {"BARREL01", 2350413876u},
-    {"BARREL02", 2060146074u},
-    {"BARREL1", 3955064620u},
-    {"BARREL2", 4023945082u},
-    {"BARREL2_L", 957582291u},
-    {"BARREL2_R", 3175847069u},
-    {"BARREL3", 25668312u},
-    {"BARREL4", 1216461011u},
-    {"BARRELBOTTOMLEFT", 4287572056u},
-    {"BARRELBOTTOMRIGHT", 3576657972u},
-    {"BARRELRECOIL1", 1891856710u},
-    {"BARRELRECOIL2", 1676007307u},
-    {"BARRELRECOIL3", 1294838299u},
-    {"BARRELRECOIL4", 1011550294u},
-    {"BARRELROTATION", 3950623792u},
-    {"BARRELTOPLEFT", 538760882u},
-    {"BARRELTOPRIGHT", 938704599u},
-    {"BARREL_L", 388916045u},
-    {"BARREL_R", 22427549u},
-    {"BARREL_SOCKET", 1580348024u},
-    {"BASE", 3447049761u},
-    {"BASEOFFSET", 1697942313u},
-    {"BATTERYCHAMBER", 391037130u},
-    {"BATTERYCHAMBERPIN", 1456985596u},
-    {"BATTERYSOCKET", 3905215779u},
-    {"BHULL", 3690950000u},
-    {"BLADEBASE", 1027681439u},
-    {"BLADEMID", 1368062130u},
-    {"BLADETIP", 3852402044u},
-    {"BOTTOMFRONTLEGBASE", 1513773997u},
-    {"BOTTOMFRONTLEGHINGE", 3055013529u},
-    {"BOTTOMRAIL_SOCKET", 2348369865u},
-    {"BOTTOMREARENGINEFLAPA", 2403210655u},
-    {"BOTTOMREARENGINEFLAPB", 2625089554u},
-    {"BOTTOMREARENGINEFLAPC", 4075248884u},
-    {"BOTTOMREARENGINEFLAPD", 69861241u},
-    {"BOTTOMREARENGINEFLAPE", 3357902705u},
-    {"BOTTOMREARENGINEFLAPF", 3593675660u},
-    {"BOTTOMREARENGINEFLAPG", 729468442u},
-    {"BOTTOMREARENGINEFLAPH", 967928455u},
-    {"BOTTOM_DISC", 1924703517u},
-    {"BOX.025", 1832843225u},
-    {"BRAKE", 2896946475u},
-    {"BUCKLE", 3945343256u},
-    {"BULLET", 3685814955u},
-    {"BULLET1", 537716927u},
-    {"BULLET10", 223470684u},
-    {"BULLET11", 3079616728u},
-    {"BULLET12", 3970212610u},
-    {"BULLET13", 4278077365u},
-    {"BULLET14", 1646726677u},
-    {"BULLET15", 1886890678u},
-    {"BULLET16", 3298513648u},
-    {"BULLET17", 3595761247u},
-    {"BULLET18", 928233583u},
-    {"BULLET19", 1168299277u},
-    {"BULLET2", 2977401802u},
-    {"BULLET20", 2618851531u},
-    {"BULLET21", 2915443750u},
-    {"BULLET3", 3197937172u},
-    {"BULLET4", 3436921489u},
-    {"BULLET5", 3928456489u},
-    {"BULLET6", 2020612540u},
-    {"BULLET7", 2307111907u},
-    {"BULLET8", 2479214695u},
-    {"BULLET9", 2770105108u},
-    {"BUMPER", 706207068u},
-    {"BUTTON", 2128246719u},
-    {"B_ANKLE", 1579452288u},
-    {"B_FOOT", 3351494366u},
-    {"B_FOOT_INSIDETOES", 1916267784u},
-    {"B_FOOT_INSIDETOES_END", 3234753418u},
-    {"B_FOOT_OUTSIDETOES", 3188746918u},
-    {"B_FOOT_OUTSIDETOES_END", 2799343175u},
-    {"B_FOOT_SPIKES", 3570374500u},
-    {"B_FOOT_SPIKES_END", 312972756u},
-    {"B_LEG", 2881046729u},
-    {"B_LEG_PISTON", 718505439u},
-    {"CAMERA", 3092136803u},
-    {"CAMERA1_SOCKET", 752986672u},
-    {"CAMERARECOIL", 1775047925u},
-    {"CANNON_HOOD", 3169208690u},
-    {"CANNON_HOOD_END", 3107862979u},
-    {"CARTRIDGE", 3978902171u},
-    {"CHAIN01", 1423048752u},
-    {"CHAIN02", 3028336524u},
-    {"CHAIN03", 3258407673u},
-    {"CHAIN04", 257357155u},
-    {"CHAIN05", 2646446598u},
-    {"CHAIN06", 4117152087u},
-    {"CHAIN07", 187755755u},
-    {"CHAIN08", 3798211410u},
-    {"CHAIN09", 3903399900u},
-    {"CHAIN10", 3054322045u},
-    {"CHAIN11", 3429527095u},
-    {"CHAIN12", 1645615504u},
-    {"CHAIN13", 1742480668u},
-    {"CHAIN14", 3034038038u},
-    {"CHAIN15", 45996765u},
-    {"CHAIN16", 3115305158u},
-    {"CHAIN17", 2670171062u},
-    {"CHAMBERASSIST", 4084711100u},
-    {"CHARACTERWORLDSPACETM", 2774357102u},
-    {"CHARGE3QUARTER", 878528594u},
-    {"CHARGEEMPTY", 3034731402u},
-    {"CHARGEFULL", 1858661785u},
-    {"CHARGEHALF", 3653275918u},
-    {"CLIP", 2991756863u},
-    {"CLIPBOLT", 3090389870u},
-    {"CLIPBOLT2", 1043307679u},
-    {"CLIPBOLT3", 3245646627u},
-    {"CLIPBOLT4", 3551938470u},
-    {"CLIPBOLT5", 3852823428u},
-    {"CLIPRELEASE", 1109437397u},
-    {"CLIP_RELEASE", 2636646231u},
-    {"CLIP_SOCKET", 1139812841u},
-    {"CLUTCH", 1442972739u},
-    {"COG", 567791785u},
-    {"COGPARENT", 84634380u},
-    {"COMMON_DPO_PLACEABLES_MODULE_DESTROYED_COL", 2781236066u},
-    {"COMMON_DPO_PLACEABLES_MODULE_DESTROYED_LOD0", 1804676446u},
-    {"COMMON_DPO_PLACEABLES_MODULE_LOD0", 283172278u},
-    {"COMMON_DPO_PLACEABLES_REINFORCEMENTMOD", 1504464692u},
-    {"COMMON_DPO_PLACEABLES_REINFORCEMENTMOD_COL", 2815084884u},
-    {"COMMON_DPO_PLACEABLE_IONCANNON", 3342510743u},
-    {"COMMON_PROPS_AMPWATERTANKS_WATERPUMP", 2672750597u},
-    {"COMMON_PROPS_GAMEPLAYOBJECTS_AMMODEPOT", 3200203840u},
-    {"COMMON_PROPS_IFFDOOR_ANIMATED", 3905809930u},
-    {"COMMON_PROPS_SNAPONS_CONTROL_COMM_ROOF", 1755079925u},
-    {"COMMON_STRUCTURES_FACILITYAMPSTATION_SPIRE", 1521744347u},
-    {"COMMON_STRUCTURES_TEMPESTTOWER", 3343699791u},
-    {"COVER", 2291122455u},
-    {"C_FRONTGEAR1", 2178391894u},
-    {"C_FRONTGEAR2", 2990211100u},
-    {"C_FRONTGEARDOOR1", 2380238797u},
-    {"C_FRONTGEARDOOR2", 1465590465u},
-    {"DEPLOYFRONT1", 3167037877u},
-    {"DEPLOYFRONT2", 2852062249u},
-    {"DEPLOYFRONT3", 3761303692u},
-    {"DEPLOYFRONTCOVER", 1554697778u},
-    {"DISPLAY", 1133810461u},
-    {"DOOR", 3305972769u},
-    {"DRUM", 2080389955u},
-    {"DRUMHANDLE", 3296973358u},
-    {"DYNAMICDRING", 2443285297u},
-    {"EAST", 1242568825u},
-    {"EASTARM", 578449394u},
-    {"EASTJOINT", 1839578142u},
-    {"EASTPANEL", 2871434844u},
-    {"EJECT", 3004123225u},
-    {"EJECT01", 4014393635u},
-    {"EJECT02", 2688920358u},
-    {"EJECT1", 2366379834u},
-    {"EJECT2", 2662939284u},
-    {"EJECTIONPORT", 4266326091u},
-    {"EJECTION_PORT_COVER", 2058541621u},
-    {"ELBOWHINDGE01", 407354688u},
-    {"ELBOWHINDGE02", 2891900272u},
-    {"ELBOWHINDGE03", 2586132733u},
-    {"ELBOWHINDGE04", 3487870079u},
-    {"ELEVATOR", 1550770966u},
-    {"EMISSIVE", 1001341975u},
-    {"END_L_BACK_CANNISTER01", 2522939977u},
-    {"END_L_BACK_CANNISTER02", 54123589u},
-    {"END_L_TOP_BOX01", 70005902u},
-    {"END_L_TOP_BOX02", 4074672627u},
-    {"END_L_TOP_BOX03", 536013851u},
-    {"END_L_TOP_BOX04", 238045334u},
-    {"END_L_TOP_CANNISTER01", 147198502u},
-    {"END_L_TOP_CANNISTER02", 3536201255u},
-    {"END_L_TOP_CANNISTER03", 3982187345u},
-    {"END_R_BACK_CANNISTER01", 1415769934u},
-    {"END_R_BACK_CANNISTER02", 1041482416u},
-    {"END_R_TOP_BOX01", 3941239263u},
-    {"END_R_TOP_BOX02", 4230163536u},
-    {"END_R_TOP_BOX03", 2092477833u},
-    {"END_R_TOP_BOX04", 3466416465u},
-    {"END_R_TOP_CANNISTER01", 3834003294u},
-    {"END_R_TOP_CANNISTER02", 3535838163u},
-    {"END_R_TOP_CANNISTER03", 3068421111u},
-    {"FAN1", 300486179u},
-    {"FAN2", 461250893u},
-    {"FIREMODE", 2870084370u},
-    {"FOREWARDGRIP", 2421277503u},
-    {"FORWARDFLAP", 4258810157u},
-    {"FORWARDGRIP_SOCKET", 3570825082u},
-    {"FPMALE", 671758044u},
-    {"FRONTACTION", 2377346750u},
-    {"FRONTAXLE", 4154229687u},
-    {"FRONTCENTERSPININNER", 1850534173u},
-    {"FRONTCENTERSPINOUTER", 4181793464u},
-    {"FRONTCHASSIS", 2027020606u},
-    {"FRONTGEAR1", 529246599u},
-    {"FRONTGEAR2", 1298007339u},
-    {"FRONTGEARA", 1604790749u},
-    {"FRONTGEARB", 1826440265u},
-    {"FRONTGEARC", 2065424582u},
-    {"FRONTGEARDOOR", 3200180919u},
-    {"FRONTGEARSUPPORT", 1674585019u},
-    {"FRONTLEAF", 1387893526u},
-    {"FRONTPITCH", 2696709208u},
-    {"FRONTRAIL", 520663189u},
-    {"FRONTSLIDE", 2059202853u},
-    {"FRONTSUPPORT1", 1294189023u},
-    {"FRONTSUPPORT2", 1659759987u},
-    {"FRONTSUPPORT3", 4036987088u},
-    {"FRONTSUPPORT4", 135706558u},
-    {"FRONTSUPPORT5", 370955209u},
-    {"FRONTYAW", 2566866105u},
-    {"FX", 4102920736u},
-    {"F_ANKLE", 2094551816u},
-    {"F_FOOT", 3651587072u},
-    {"F_FOOT_INSIDETOES", 3297912606u},
-    {"F_FOOT_INSIDETOES_END", 796974426u},
-    {"F_FOOT_OUTSIDETOES", 2145353959u},
-    {"F_FOOT_OUTSIDETOES_END", 3468960995u},
-    {"F_FOOT_SPIKES", 1186180439u},
-    {"F_FOOT_SPIKES_END", 3426233346u},
-    {"F_LEG", 4011219873u},
-    {"F_LEG_PISTON", 764938613u},
-    {"GEARBACK", 843792386u},
-    {"GEARFRONT", 749578352u},
-    {"GRIP", 3421923095u},
-    {"GROUP1", 3261119595u},
-    {"GROUP2", 2939065863u},
-    {"HANDLE", 4243056212u},
-    {"HANDLEBARS", 1845483130u},
-    {"HANDLEBARS_L", 1600924819u},
-    {"HANDLEBARS_R", 385588147u},
-    {"HARDPOINT1", 2126722038u},
-    {"HARDPOINT2", 2424428403u},
-    {"HARDPOINT2_SOCKET", 868153471u},
-    {"HARDPOINT3", 2604657903u},
-    {"HARDPOINT4", 620167259u},
-    {"HARDPOINT5", 768381414u},
-    {"HEAD", 898299046u},
-    {"HEADING", 2050050574u},
-    {"HEAD_END", 233509630u},
-    {"HEAVY_SOLDIER_ANIMATED", 2100923523u},
-    {"HINGE", 3271536277u},
-    {"HINGE1", 2612768833u},
-    {"HINGE1A", 228672864u},
-    {"HINGE1B", 3204491284u},
-    {"HINGE1C", 3454518758u},
-    {"HINGE2", 2382959836u},
-    {"HINGE2A", 2960552844u},
-    {"HINGE2B", 3402016812u},
-    {"HINGE2C", 2734381146u},
-    {"HINGE3", 819550842u},
-    {"HINGE3A", 2703085271u},
-    {"HINGE3B", 1920496009u},
-    {"HINGE3C", 1146262846u},
-    {"HOODVENTS", 2561181064u},
-    {"HOSE1A", 3361048860u},
-    {"HOSE1B", 3742348944u},
-    {"HOSE1C", 3431993741u},
-    {"HOSE2A", 786159239u},
-    {"HOSE2B", 1008562442u},
-    {"HOSE2C", 326115248u},
-    {"HOSE3A", 457158179u},
-    {"HOSE3B", 183635336u},
-    {"HOSE3C", 2948224794u},
-    {"HYDROLICFRONTBOTTOM", 3693594453u},
-    {"HYDROLICFRONTTOP", 564569974u},
-    {"HYDROLICREARBOTTOM", 2607943079u},
-    {"HYDROLICREARTOP", 2816061702u},
-    {"INDAR_PROPS_VENTS_FANLARGEDOUBLE", 3155017161u},
-    {"INDAR_PROPS_VENTS_FANLARGESINGLE", 2007480715u},
-    {"INTERNALBULLETS", 499401726u},
-    {"IRONSIGHTBACK_SOCKET", 3992122647u},
-    {"IRONSIGHTFRONT_SOCKET", 2838394204u},
-    {"JOINT1", 1372798831u},
-    {"JOINT10", 3613873764u},
-    {"JOINT11", 3854168841u},
-    {"JOINT12", 2081169327u},
-    {"JOINT13", 2285221890u},
-    {"JOINT14", 243188882u},
-    {"JOINT15", 483746111u},
-    {"JOINT16", 3004272057u},
-    {"JOINT17", 3345004119u},
-    {"JOINT18", 2789536792u},
-    {"JOINT19", 2552977381u},
-    {"JOINT2", 2749883295u},
-    {"JOINT20", 3380132775u},
-    {"JOINT21", 2938406655u},
-    {"JOINT22", 483058250u},
-    {"JOINT23", 312462836u},
-    {"JOINT24", 2407057340u},
-    {"JOINT25", 2111186039u},
-    {"JOINT3", 1962739146u},
-    {"JOINT4", 2254186632u},
-    {"JOINT5", 3645328989u},
-    {"JOINT6", 3960042465u},
-    {"JOINT7", 3135934884u},
-    {"JOINT8", 3434624319u},
-    {"JOINT9", 3270812084u},
-    {"LARGEBARREL", 2210481234u},
-    {"LARGEBLADE", 1856204695u},
-    {"LEFTCHAMBERHATCH", 3423179401u},
-    {"LEFT_BELT001", 3192222837u},
-    {"LEFT_BELT0010", 1852067476u},
-    {"LEFT_BELT0011", 1103754588u},
-    {"LEFT_BELT0012", 1339986313u},
-    {"LEFT_BELT002", 1347590289u},
-    {"LEFT_BELT003", 2151118934u},
-    {"LEFT_BELT004", 319233523u},
-    {"LEFT_BELT005", 628441807u},
-    {"LEFT_BELT006", 925820482u},
-    {"LEFT_BELT007", 3341780549u},
-    {"LEFT_BELT008", 3656494025u},
-    {"LEFT_BELT009", 3966357689u},
-    {"LEFT_BUTTON01", 1739425286u},
-    {"LEFT_BUTTON02", 3190207227u},
-    {"LEFT_BUTTON03", 3559972623u},
-    {"LEFT_BUTTON04", 2338442610u},
-    {"LEFT_BUTTON05", 1973133798u},
-    {"LEFT_FLAP", 2724988498u},
-    {"LHULL", 421078535u},
-    {"LOADACTION", 338607862u},
-    {"LOADACTION2", 2666078040u},
-    {"LOADACTION3", 2828022438u},
-    {"LOWERDOOR1", 325645639u},
-    {"LOWERDOOR2", 609720100u},
-    {"LOWERDOOR3", 773499562u},
-    {"LOWERDOOR4", 1055149117u},
-    {"LOWERVENTS", 3831875288u},
-    {"LPOWERNODE", 3270595576u},
-    {"L_ANKLE", 2525539168u},
-    {"L_ARM", 2503452994u},
-    {"L_ARMCOMPONENTS", 811860561u},
-    {"L_BACKDRING", 4272014876u},
-    {"L_BACKPLATE", 209846800u},
-    {"L_BACKSHOCKA", 4019161365u},
-    {"L_BACKSHOCKA_TOP", 1175513397u},
-    {"L_BACKSHOCKB", 1885538994u},
-    {"L_BACKSHOCKB_TOP", 3920753945u},
-    {"L_BACK_CANNISTER01", 977508624u},
-    {"L_BACK_CANNISTER02", 1259551407u},
-    {"L_BALL", 1142326112u},
-    {"L_BARREL", 1680733055u},
-    {"L_BARRELFRONT_EXTEND", 3065573393u},
-    {"L_BARRELRECOILLOWER", 2835073054u},
-    {"L_BARRELRECOILUPPER", 2044676802u},
-    {"L_BARRELROTATION", 2359474964u},
-    {"L_BARRELROTATIONLOWER", 1097825139u},
-    {"L_BARRELROTATIONUPPER", 2802826641u},
-    {"L_BARRELSIDELAYER1", 3617764011u},
-    {"L_BARRELSIDELAYER1_END", 353047735u},
-    {"L_BARRELSIDELAYER2", 2841302556u},
-    {"L_BARRELSIDE_EXTEND", 1344053016u},
-    {"L_BOTTOMBARREL", 713393451u},
-    {"L_BOTTOMCANISTER", 1336973505u},
-    {"L_BOTTOMHOUSING", 2959853441u},
-    {"L_BOTTOMTUBE", 1635267284u},
-    {"L_BOTTOMVENTS", 1004900499u},
-    {"L_BOTTONREARLEGBASE", 1272116621u},
-    {"L_BOTTONREARLEGHINGE", 1947478600u},
-    {"L_CLAVICLE", 4217541411u},
-    {"L_CYLINDERDN", 215562287u},
-    {"L_CYLINDEREXTEND_END", 4096234345u},
-    {"L_CYLINDEREXTEND_END1", 4176684248u},
-    {"L_CYLINDERUP", 4119076029u},
-    {"L_DEPLOY_MECANISM", 1673327505u},
-    {"L_DEPLOY_MECANISM_END", 279687920u},
-    {"L_ELBOW", 2266553668u},
-    {"L_ENGINESHIELD", 4089981509u},
-    {"L_ENGINEVENTFLAPA", 3387633284u},
-    {"L_ENGINEVENTFLAPB", 3024421688u},
-    {"L_ENGINEVENTFLAPC", 4262467277u},
-    {"L_ENGINEVENTFLAPD", 399592015u},
-    {"L_ENGINEVENTFLAPE", 2460336122u},
-    {"L_ENGINEVENTFLAPF", 2086900598u},
-    {"L_ENGINEVENTFLAPG", 3846497591u},
-    {"L_FAN", 2982628385u},
-    {"L_FLAP", 1368413764u},
-    {"L_FLAPPER", 1063630551u},
-    {"L_FOOT", 3563932260u},
-    {"L_FOOT_INSIDETOES", 640072513u},
-    {"L_FOOT_INSIDETOES_END", 1371949785u},
-    {"L_FOOT_OUTSIDETOES", 3864762204u},
-    {"L_FOOT_OUTSIDETOES_END", 3189639359u},
-    {"L_FOOT_SPIKES", 1991123356u},
-    {"L_FOOT_SPIKES_END", 1862987346u},
-    {"L_FOREARM", 4157307685u},
-    {"L_FORWARDDISK", 642363752u},
-    {"L_FORWARDDISK2", 3340640726u},
-    {"L_FRONTAXLE", 3281080856u},
-    {"L_FRONTDOOR", 792221549u},
-    {"L_FRONTDRING", 4238365957u},
-    {"L_FRONTFLAP", 1710092884u},
-    {"L_FRONTGEAR1", 2758622649u},
-    {"L_FRONTGEAR2", 4059977918u},
-    {"L_FRONTGEAR3", 4268257682u},
-    {"L_FRONTGEAR4", 3684838406u},
-    {"L_FRONTGEAR5", 752438899u},
-    {"L_FRONTGEARDOOR1", 2429672886u},
-    {"L_FRONTGEARDOOR2", 3195582723u},
-    {"L_FRONTPANEL1", 1987186480u},
-    {"L_FRONTPANEL2", 2753555083u},
-    {"L_FRONTPLATE", 2353688199u},
-    {"L_FRONTSHOCKA", 852534977u},
-    {"L_FRONTSHOCKA_TOP", 4244503350u},
-    {"L_FRONTSHOCKB", 954938090u},
-    {"L_FRONTSHOCKB_TOP", 132180299u},
-    {"L_FRONTSHOCKLOWER", 560980432u},
-    {"L_FRONTSHOCKUPPER", 2539716309u},
-    {"L_FRONTSUPPORT", 20902711u},
-    {"L_FRONTSUPPORT1", 221775280u},
-    {"L_FRONTSUPPORT2", 2357232699u},
-    {"L_FRONTSUPPORT3", 3205163343u},
-    {"L_FRONTSUPPORT4", 1678652251u},
-    {"L_FRONTSUSPENSION", 1330671677u},
-    {"L_FRONTVENT", 3131490264u},
-    {"L_FRONTWHEEL", 1843793152u},
-    {"L_FRONTWHEEL_DUMMY", 399140690u},
-    {"L_GEARA", 428356429u},
-    {"L_GEARB", 1337696179u},
-    {"L_GEARC", 1027406518u},
-    {"L_GEARDOOR", 1217736659u},
-    {"L_GEARSUPPORTA", 699248667u},
-    {"L_GEARSUPPORTB", 1051777569u},
-    {"L_HANDLE", 3621332160u},
-    {"L_HATCH_BOTTOM", 2431360521u},
-    {"L_HATCH_BOTTOM_END", 4274798758u},
-    {"L_HATCH_TOP", 1409119795u},
-    {"L_HATCH_TOP_END", 1835960745u},
-    {"L_HIP", 1900803227u},
-    {"L_HIPATTACH", 2413396637u},
-    {"L_HOSE", 2692352206u},
-    {"L_INDEXA", 198244558u},
-    {"L_INDEXB", 4212840290u},
-    {"L_INDEXC", 3930207657u},
-    {"L_INDEX_END", 2209626904u},
-    {"L_INNERFLAP", 1540633403u},
-    {"L_INNERTHRUSTER", 287270140u},
-    {"L_KNEE", 524728837u},
-    {"L_KNOB_ROTATE", 890102883u},
-    {"L_KNOB_TRANSLATE", 3200992048u},
-    {"L_LARGEDISK", 2345016067u},
-    {"L_LARGEINNERDISK", 3387066931u},
-    {"L_LATCHCLIPS", 286101867u},
-    {"L_LEG", 1041216236u},
-    {"L_LEG_PISTON", 1749508038u},
-    {"L_LOADER", 1287964149u},
-    {"L_LOWERSUSPENSION", 559175070u},
-    {"L_MAINPULLY", 1317099658u},
-    {"L_MIDAXLE", 3264788844u},
-    {"L_MIDDLEA", 724094749u},
-    {"L_MIDDLEB", 943876432u},
-    {"L_MIDDLEC", 3337782962u},
-    {"L_MIDDLE_END", 810894083u},
-    {"L_MIDPANEL1", 3590724549u},
-    {"L_MIDPANEL2", 3950397093u},
-    {"L_MIDSUPPORT", 239022231u},
-    {"L_MIDWHEEL", 1388173060u},
-    {"L_OUTERFLAP", 2022858524u},
-    {"L_OUTERTHRUSTERPANELA", 3971649130u},
-    {"L_OUTERTHRUSTERPANELB", 268260591u},
-    {"L_OUTERTHRUSTERPANELC", 3259152763u},
-    {"L_OVERHEADDOOR1", 3062918367u},
-    {"L_OVERHEADDOOR2", 3290761224u},
-    {"L_PEDAL", 1594602635u},
-    {"L_PINKYA", 3483479177u},
-    {"L_PINKYB", 127966342u},
-    {"L_PINKYC", 887355148u},
-    {"L_PINKY_END", 3920976780u},
-    {"L_PISTON", 3660131708u},
-    {"L_PITCH", 2362924145u},
-    {"L_PITCHRECOIL", 1825881561u},
-    {"L_POWERCORE", 2370804950u},
-    {"L_REARAXLE", 3669183925u},
-    {"L_REARDISK", 1732281932u},
-    {"L_REARDOOR", 3365866860u},
-    {"L_REARENGINESHIELD", 1952565859u},
-    {"L_REARFLAP", 4230965472u},
-    {"L_REARGEAR1", 584112430u},
-    {"L_REARGEAR2", 3709128119u},
-    {"L_REARGEAR3", 123937363u},
-    {"L_REARGEAR4", 1871409830u},
-    {"L_REARGEARA", 100048734u},
-    {"L_REARGEARB", 3160050727u},
-    {"L_REARGEARC", 3935332498u},
-    {"L_REARGEARDOOR", 1157169726u},
-    {"L_REARGEARDOOR1", 3032317542u},
-    {"L_REARGEARDOOR2", 2208537651u},
-    {"L_REARGEARSUPPORT", 1759461929u},
-    {"L_REARPANEL1", 2908721569u},
-    {"L_REARPANEL2", 178867251u},
-    {"L_REARSHOCKLOWER", 165726974u},
-    {"L_REARSHOCKUPPER", 697830620u},
-    {"L_REARSUPPORT", 123143823u},
-    {"L_REARSUSPENSION", 3458403359u},
-    {"L_REARTHRUSTER", 393246525u},
-    {"L_REARTHRUSTER1", 714964964u},
-    {"L_REARTHRUSTER2", 4157905491u},
-    {"L_REARTHRUSTERFLAP", 3359901234u},
-    {"L_REARVENT", 38813266u},
-    {"L_REARVENTS", 561920284u},
-    {"L_REARWHEEL", 3108519283u},
-    {"L_REARWHEELPIVOT", 2995209657u},
-    {"L_RELOADPIN", 4060997878u},
-    {"L_RINGA", 3662356388u},
-    {"L_RINGB", 3893213993u},
-    {"L_RINGC", 2769958247u},
-    {"L_RING_END", 1143123657u},
-    {"L_RUDDER", 3619289854u},
-    {"L_SHELL1", 1653896492u},
-    {"L_SHELL2", 1950455942u},
-    {"L_SHELL3", 2248424459u},
-    {"L_SHELL4", 2622220442u},
-    {"L_SHELL5", 2922679407u},
-    {"L_SHELLROTATION", 3205137251u},
-    {"L_SHIELD", 1369013194u},
-    {"L_SHIELDARM", 3216344818u},
-    {"L_SHOCKLOWER", 3516299831u},
-    {"L_SHOCKUPPER", 204057857u},
-    {"L_SHOULDER", 3746558302u},
-    {"L_SHOULDERATTACH", 813763102u},
-    {"L_SHOULDERPAD", 3771578632u},
-    {"L_SHOULDERROLL", 3291028981u},
-    {"L_SIDELOCK_BACK", 339389002u},
-    {"L_SIDELOCK_BACK_END", 2637440474u},
-    {"L_SIDELOCK_FRONT", 1357419157u},
-    {"L_SIDELOCK_FRONT_END", 104272027u},
-    {"L_SIDEVENT1", 1766919226u},
-    {"L_SIDEVENT2", 3160257106u},
-    {"L_SIDEVENT3", 3467663095u},
-    {"L_SIDEVENT4", 117720990u},
-    {"L_SMALLPULLY", 3474194013u},
-    {"L_SMOKESTACK", 1189247508u},
-    {"L_SPIKEINSIDE", 831760856u},
-    {"L_SPIKEOUTSIDE", 2688535938u},
-    {"L_STEERINGLINK", 3509101776u},
-    {"L_STEERINGLINKINNER", 86245637u},
-    {"L_STEERINGLINKOUTER", 52112891u},
-    {"L_STEERINGPIVOT", 1468333525u},
-    {"L_SUPPORT1", 1415649289u},
-    {"L_SUPPORT2", 3587087074u},
-    {"L_SUPPORT3", 3878501791u},
-    {"L_SUPPORT4", 4058796829u},
-    {"L_THROTTLE", 407954794u},
-    {"L_THRUSTER", 4140843785u},
-    {"L_THRUSTER1", 1400616475u},
-    {"L_THRUSTER2", 1642943230u},
-    {"L_THRUSTER3", 2099087710u},
-    {"L_THRUSTERFLAP", 932016844u},
-    {"L_THRUSTERFLAP1", 3835667144u},
-    {"L_THRUSTERFLAP2", 1706108145u},
-    {"L_THRUSTERPANEL", 3284101644u},
-    {"L_THUMBA", 978245741u},
-    {"L_THUMBB", 1282964672u},
-    {"L_THUMBC", 1453035782u},
-    {"L_THUMB_END", 1965938483u},
-    {"L_TOE", 2357602519u},
-    {"L_TOPBARREL", 3055515370u},
-    {"L_TOPCANISTER", 382516222u},
-    {"L_TOPHOUSING", 430450076u},
-    {"L_TOPREARLEGHINGE", 1237210745u},
-    {"L_TOPTUBE", 2979637790u},
-    {"L_TOP_BOX01", 1291319755u},
-    {"L_TOP_BOX02", 1026710080u},
-    {"L_TOP_BOX03", 1226732060u},
-    {"L_TOP_BOX04", 928534160u},
-    {"L_TOP_CANNISTER01", 3817013504u},
-    {"L_TOP_CANNISTER02", 289102960u},
-    {"L_TOP_CANNISTER03", 553778173u},
-    {"L_UPPERSUSPENSION", 980420752u},
-    {"L_VENT", 2223369394u},
-    {"L_VENT_END", 3502752062u},
-    {"L_WEAPON", 569531117u},
-    {"L_WHEEL1", 3870750844u},
-    {"L_WHEEL10_ROTATE", 2436389468u},
-    {"L_WHEEL10_TRANSLATE", 1754637418u},
-    {"L_WHEEL11_ROTATE", 3548344289u},
-    {"L_WHEEL11_TRANSLATE", 3857993538u},
-    {"L_WHEEL12_ROTATE", 2598712176u},
-    {"L_WHEEL12_TRANSLATE", 3061793532u},
-    {"L_WHEEL13_TRANSLATE", 3202302196u},
-    {"L_WHEEL1_DEPLOYHUB", 926811968u},
-    {"L_WHEEL1_DEPLOYSPIKE1", 2128216747u},
-    {"L_WHEEL1_DEPLOYSPIKE2", 2964579934u},
-    {"L_WHEEL1_DEPLOYSPIKE3", 2739719056u},
-    {"L_WHEEL1_DEPLOYSPIKE4", 1427025685u},
-    {"L_WHEEL1_DEPLOYSPIKE5", 3580243906u},
-    {"L_WHEEL1_DEPLOYSPIKE6", 4154815552u},
-    {"L_WHEEL1_DEPLOYSPIKE7", 3923007646u},
-    {"L_WHEEL1_DEPLOYSPIKE8", 2618965291u},
-    {"L_WHEEL1_ROTATE", 3671957889u},
-    {"L_WHEEL1_TRANSLATE", 2961989026u},
-    {"L_WHEEL2", 1851000760u},
-    {"L_WHEEL2_ROTATE", 4196382733u},
-    {"L_WHEEL2_TRANSLATE", 3069215008u},
-    {"L_WHEEL3", 2081596213u},
-    {"L_WHEEL3_ROTATE", 3072987811u},
-    {"L_WHEEL3_TRANSLATE", 2982262173u},
-    {"L_WHEEL4", 2447363791u},
-    {"L_WHEEL4_ROTATE", 726996523u},
-    {"L_WHEEL4_TRANSLATE", 3731668371u},
-    {"L_WHEEL5", 2704371058u},
-    {"L_WHEEL5_ROTATE", 3584631159u},
-    {"L_WHEEL5_TRANSLATE", 3745841892u},
-    {"L_WHEEL6", 1733261739u},
-    {"L_WHEEL6_DEPLOYHUB", 166010900u},
-    {"L_WHEEL6_DEPLOYSPIKE1", 3632260857u},
-    {"L_WHEEL6_DEPLOYSPIKE2", 3385706901u},
-    {"L_WHEEL6_DEPLOYSPIKE3", 304077368u},
-    {"L_WHEEL6_DEPLOYSPIKE4", 3295264461u},
-    {"L_WHEEL6_DEPLOYSPIKE5", 4001698563u},
-    {"L_WHEEL6_DEPLOYSPIKE6", 550959014u},
-    {"L_WHEEL6_DEPLOYSPIKE7", 4074478492u},
-    {"L_WHEEL6_DEPLOYSPIKE8", 613580553u},
-    {"L_WHEEL6_ROTATE", 3550536900u},
-    {"L_WHEEL6_TRANSLATE", 688177653u},
-    {"L_WHEEL7", 882447423u},
-    {"L_WHEEL7_ROTATE", 3593922608u},
-    {"L_WHEEL7_TRANSLATE", 589402908u},
-    {"L_WHEEL8", 4206633094u},
-    {"L_WHEEL8_ROTATE", 1661678569u},
-    {"L_WHEEL8_TRANSLATE", 4178184213u},
-    {"L_WHEEL9_ROTATE", 2102299048u},
-    {"L_WHEEL9_TRANSLATE", 3235401351u},
-    {"L_WING", 1021430484u},
-    {"L_WINGFAN", 4104846447u},
-    {"L_WINGPULLY", 3693122706u},
-    {"L_WINGVENTS", 2634919170u},
-    {"L_WRIST", 3216727789u},
-    {"L_WRIST_IKATTACH_3P_SOCKET", 3727137284u},
-    {"L_WRIST_IKATTACH_SOCKET", 84108987u},
-    {"L_YAW", 2563300581u},
-    {"L_YAW2", 1941569559u},
-    {"MAGZINE_001", 25384975u},
-    {"MAINBOLT", 2696433044u},
-    {"MAINHINDGE01", 77051289u},
-    {"MAINHINDGE02", 3523137644u},
-    {"MAINHINDGE03", 552300096u},
-    {"MAINHINDGE04", 4012739269u},
-    {"MALE", 2043243041u},
-    {"MIDAXLE", 2565524048u},
-    {"MIDLEAF", 2307684303u},
-    {"MINE", 936740635u},
-    {"MUZZLE1", 4077360421u},
-    {"MUZZLE1_1STPERSON_SOCKET", 206290509u},
-    {"MUZZLE1_SOCKET", 366842583u},
-    {"MUZZLE2", 3835394113u},
-    {"NC_MAX", 987731955u},
-    {"NECK", 4179454272u},
-    {"NORTH", 237586392u},
-    {"NORTHARM", 4092822280u},
-    {"NORTHJOINT", 2129664872u},
-    {"NORTHPANEL", 594456118u},
-    {"NSOMAX_GRENADE", 220123298u},
-    {"OFFSETATTACHMENT", 238830721u},
-    {"PANELHINDGE01", 2523414519u},
-    {"PANELHINDGE02", 1680169842u},
-    {"PANELHINDGE03", 2830230666u},
-    {"PANELHINDGE04", 1990983807u},
-    {"PART1", 2925873445u},
-    {"PART10", 1355981805u},
-    {"PART11", 369569363u},
-    {"PART12", 3771253719u},
-    {"PART13", 981661514u},
-    {"PART14", 150803519u},
-    {"PART15", 2869778529u},
-    {"PART2", 3308287675u},
-    {"PART3", 2466288220u},
-    {"PART4", 2848112608u},
-    {"PART5", 388471444u},
-    {"PART6", 1222540801u},
-    {"PART7", 867521455u},
-    {"PART8", 1704015722u},
-    {"PART9", 1312622786u},
-    {"PCUBE11", 879040899u},
-    {"PCUBE12", 1086468669u},
-    {"PCUBE13", 185091786u},
-    {"PCUBE14", 619215498u},
-    {"PCUBE15", 232508533u},
-    {"PCUBE16", 429843451u},
-    {"PCUBE17", 3796563280u},
-    {"PCYLINDER37", 595475660u},
-    {"PCYLINDER38", 1898469407u},
-    {"PCYLINDER39", 2145023363u},
-    {"PCYLINDER40", 461548457u},
-    {"PEDALS", 1495630334u},
-    {"PELVIS", 2072860801u},
-    {"PHYSICSTRAPMOUNT", 3768604471u},
-    {"PIN", 2121297440u},
-    {"PISTON01", 3344679897u},
-    {"PISTON02", 2235514797u},
-    {"PISTON03", 2850031842u},
-    {"PISTON04", 3628033440u},
-    {"PITCH", 3620343033u},
-    {"PITCHPROP_L", 3069185626u},
-    {"PITCHPROP_R", 1765274351u},
-    {"PITCHRECOIL", 497549541u},
-    {"PITCHRECOIL_L", 3116333173u},
-    {"PITCHRECOIL_R", 3282275393u},
-    {"PLATE", 1448615591u},
-    {"PLAYERBUMPER", 1046831467u},
-    {"PLUNGERA", 1587829056u},
-    {"PLUNGERB", 1894448589u},
-    {"POLYSURFACE30", 33859262u},
-    {"POLYSURFACE31", 3485647419u},
-    {"POLYSURFACE32", 3850366389u},
-    {"POLYSURFACE33", 3888312911u},
-    {"POWERCELL01", 2047664273u},
-    {"POWERCELL02", 1813333154u},
-    {"POWERCORE", 3948699063u},
-    {"POWERCORE01", 1875707837u},
-    {"POWERCORE02", 2163878423u},
-    {"POWERCORE03", 2454703298u},
-    {"POWERCORESOCKET01", 1719620090u},
-    {"POWERCORESOCKET02", 2688238961u},
-    {"POWERCORESOCKET03", 1391831783u},
-    {"POWERCORE_BASE01", 1026417588u},
-    {"POWERCORE_BASE02", 3537047296u},
-    {"POWERNODESOCKET", 2002250715u},
-    {"PUMP", 1337961391u},
-    {"RAIL", 4094656420u},
-    {"REARACTION", 695991093u},
-    {"REARAXLE", 764979090u},
-    {"REARBAR", 257870450u},
-    {"REARCENTERSPININNER", 461493020u},
-    {"REARCENTERSPINOUTER", 790266838u},
-    {"REARCYLINDER", 1401298368u},
-    {"REARFANPIVOT", 3180974149u},
-    {"REARFANTHRUST", 2658480396u},
-    {"REARFANYAW", 4052515463u},
-    {"REARFLAPS", 102955111u},
-    {"REARGEAR1", 3855637643u},
-    {"REARGEAR2", 2879678516u},
-    {"REARGEAR3", 3126035858u},
-    {"REARGEAR4", 276017613u},
-    {"REARGEAR5", 783937113u},
-    {"REARHATCHA", 1191082628u},
-    {"REARHATCHB", 762201956u},
-    {"REARSHOCKLOWER", 2682647519u},
-    {"REARSHOCKUPPER", 693737955u},
-    {"REARSLIDE", 1497906636u},
-    {"REARSUPPORT1", 1024671026u},
-    {"REARSUPPORT2", 534250172u},
-    {"REARSUPPORT3", 1382016971u},
-    {"REARSUPPORT4", 2989762410u},
-    {"REARSUPPORT5", 2759003112u},
-    {"REARSUSPENSION", 2803439941u},
-    {"REARTHRUSTER", 1585371058u},
-    {"RECOIL", 2227538362u},
-    {"REDDOT_SOCKET", 1772401952u},
-    {"RELOADACTION", 470752987u},
-    {"RELOADACTION2", 1188711348u},
-    {"RHULL", 3933329929u},
-    {"RIGHTCHAMBERHATCH", 871669885u},
-    {"RIGHT_BELT001", 3357634932u},
-    {"RIGHT_BELT0010", 329644197u},
-    {"RIGHT_BELT0011", 955335483u},
-    {"RIGHT_BELT0012", 723101580u},
-    {"RIGHT_BELT002", 2799841014u},
-    {"RIGHT_BELT003", 2494892700u},
-    {"RIGHT_BELT004", 2182276440u},
-    {"RIGHT_BELT005", 1884438999u},
-    {"RIGHT_BELT006", 1837579329u},
-    {"RIGHT_BELT007", 1502352459u},
-    {"RIGHT_BELT008", 1205694702u},
-    {"RIGHT_BELT009", 957797217u},
-    {"RIGHT_BUTTON01", 1303911096u},
-    {"RIGHT_BUTTON02", 2044818186u},
-    {"RIGHT_BUTTON03", 1871666790u},
-    {"RIGHT_BUTTON04", 2759084079u},
-    {"RIGHT_BUTTON05", 2325943437u},
-    {"RIGHT_FLAP", 418620215u},
-    {"RING1", 2374286536u},
-    {"RING2", 2557924012u},
-    {"ROD", 792191633u},
-    {"ROOTBONE", 3804343905u},
-    {"ROTARYBARREL", 860567359u},
-    {"ROTATE1", 3439053269u},
-    {"ROTATE2", 1857195332u},
-    {"ROTATECHAMBER", 465715614u},
-    {"ROUND1", 1332087532u},
-    {"ROUND2", 1629531745u},
-    {"ROUND3", 1805501275u},
-    {"ROUND4", 2097374758u},
-    {"ROUND5", 376084722u},
-    {"ROUND6", 665402223u},
-    {"RPOWERNODE", 4140554400u},
-    {"R_ANKLE", 4268096845u},
-    {"R_ARM", 3008301052u},
-    {"R_ARMCOMPONENTS", 3106683811u},
-    {"R_BACKDRING", 997715595u},
-    {"R_BACKPLATE", 148150983u},
-    {"R_BACKSHOCKA", 3208123503u},
-    {"R_BACKSHOCKA_TOP", 1675554705u},
-    {"R_BACKSHOCKB", 4073028489u},
-    {"R_BACKSHOCKB_TOP", 2818173706u},
-    {"R_BACK_CANNISTER01", 2491993409u},
-    {"R_BACK_CANNISTER02", 1580359821u},
-    {"R_BALL", 2049782909u},
-    {"R_BARREL", 1503220503u},
-    {"R_BARRELFRONT_EXTEND", 1606571537u},
-    {"R_BARRELRECOILLOWER", 630489018u},
-    {"R_BARRELRECOILUPPER", 2911986502u},
-    {"R_BARRELROTATION", 2011106085u},
-    {"R_BARRELROTATIONLOWER", 1292570642u},
-    {"R_BARRELROTATIONUPPER", 4125754605u},
-    {"R_BARRELSIDELAYER1", 658413182u},
-    {"R_BARRELSIDELAYER1_END", 2514353650u},
-    {"R_BARRELSIDELAYER2", 2490953973u},
-    {"R_BARRELSIDE_EXTEND", 524831829u},
-    {"R_BOTTOMBARREL", 2022986004u},
-    {"R_BOTTOMCANISTER", 1396032091u},
-    {"R_BOTTOMHOUSING", 3218433468u},
-    {"R_BOTTOMTUBE", 3604588876u},
-    {"R_BOTTOMVENTS", 3800032069u},
-    {"R_BOTTONREARLEGBASE", 3623525379u},
-    {"R_BOTTONREARLEGHINGE", 3812362030u},
-    {"R_CLAVICLE", 113224493u},
-    {"R_CYLINDERDN", 1843892274u},
-    {"R_CYLINDEREXTEND_END", 2762743218u},
-    {"R_CYLINDEREXTEND_END1", 1895700580u},
-    {"R_CYLINDERUP", 4285130512u},
-    {"R_DEPLOY_MECANISM", 1681854081u},
-    {"R_DEPLOY_MECANISM_END", 3204711383u},
-    {"R_ELBOW", 2970756967u},
-    {"R_ENGINESHIELD", 3974058683u},
-    {"R_ENGINEVENTFLAPA", 1953769567u},
-    {"R_ENGINEVENTFLAPB", 2260913404u},
-    {"R_ENGINEVENTFLAPC", 2005839528u},
-    {"R_ENGINEVENTFLAPD", 2233616847u},
-    {"R_ENGINEVENTFLAPE", 2599646577u},
-    {"R_ENGINEVENTFLAPF", 2833781082u},
-    {"R_ENGINEVENTFLAPG", 3197516982u},
-    {"R_FAN", 3248592082u},
-    {"R_FLAP", 802037369u},
-    {"R_FLAPPER", 2163166549u},
-    {"R_FOOT", 708670027u},
-    {"R_FOOT_INSIDETOES", 2906427843u},
-    {"R_FOOT_INSIDETOES_END", 4072946546u},
-    {"R_FOOT_OUTSIDETOES", 1498761862u},
-    {"R_FOOT_OUTSIDETOES_END", 1779413271u},
-    {"R_FOOT_SPIKES", 2884154752u},
-    {"R_FOOT_SPIKES_END", 2716785905u},
-    {"R_FOREARM", 3356280828u},
-    {"R_FORWARDDISK", 3916096451u},
-    {"R_FORWARDDISK2", 3586508350u},
-    {"R_FRONTAXLE", 2134928656u},
-    {"R_FRONTDOOR", 1440689943u},
-    {"R_FRONTDRING", 2629297631u},
-    {"R_FRONTFLAP", 1282140579u},
-    {"R_FRONTGEAR1", 835718401u},
-    {"R_FRONTGEAR2", 1076734396u},
-    {"R_FRONTGEAR3", 2372092970u},
-    {"R_FRONTGEAR4", 2611601591u},
-    {"R_FRONTGEAR5", 145275571u},
-    {"R_FRONTGEARDOOR1", 2286030167u},
-    {"R_FRONTGEARDOOR2", 2863223333u},
-    {"R_FRONTPANEL1", 2157529237u},
-    {"R_FRONTPANEL2", 1725043975u},
-    {"R_FRONTPLATE", 4058873060u},
-    {"R_FRONTSHOCKA", 2647247259u},
-    {"R_FRONTSHOCKA_TOP", 1486358852u},
-    {"R_FRONTSHOCKB", 2852643351u},
-    {"R_FRONTSHOCKB_TOP", 3278587725u},
-    {"R_FRONTSHOCKLOWER", 2429286607u},
-    {"R_FRONTSHOCKUPPER", 3782241303u},
-    {"R_FRONTSUPPORT", 3639903371u},
-    {"R_FRONTSUPPORT1", 4001712163u},
-    {"R_FRONTSUPPORT2", 2701077784u},
-    {"R_FRONTSUPPORT3", 3266867338u},
-    {"R_FRONTSUPPORT4", 3017134789u},
-    {"R_FRONTSUSPENSION", 275021293u},
-    {"R_FRONTVENT", 2910764364u},
-    {"R_FRONTWHEEL", 2611971637u},
-    {"R_FRONTWHEEL_DUMMY", 743339293u},
-    {"R_GEARA", 3722266261u},
-    {"R_GEARB", 4029639481u},
-    {"R_GEARC", 3200747626u},
-    {"R_GEARDOOR", 2299776059u},
-    {"R_GEARSUPPORTA", 3414914564u},
-    {"R_GEARSUPPORTB", 2798791814u},
-    {"R_HANDLE", 4093298414u},
-    {"R_HATCH_BOTTOM", 767425248u},
-    {"R_HATCH_BOTTOM_END", 2197101825u},
-    {"R_HATCH_TOP", 904278569u},
-    {"R_HATCH_TOP_END", 4021302725u},
-    {"R_HIP", 2907905148u},
-    {"R_HIPATTACH", 3420689105u},
-    {"R_HOSE", 1501527398u},
-    {"R_INDEXA", 3770474639u},
-    {"R_INDEXB", 4277804297u},
-    {"R_INDEXC", 2054689799u},
-    {"R_INDEX_END", 2492699346u},
-    {"R_INNERFLAP", 4003831577u},
-    {"R_INNERTHRUSTER", 3639316156u},
-    {"R_KNEE", 3783973932u},
-    {"R_KNOB_ROTATE", 3831889766u},
-    {"R_KNOB_TRANSLATE", 2335091557u},
-    {"R_LARGEDISK", 2520538412u},
-    {"R_LARGEINNERDISK", 4200598998u},
-    {"R_LATCHCLIPS", 647525950u},
-    {"R_LEG", 944552693u},
-    {"R_LEG_PISTON", 3904186436u},
-    {"R_LOADER", 1618744748u},
-    {"R_LOWERSUSPENSION", 4222341536u},
-    {"R_MAINPULLY", 4006501473u},
-    {"R_MIDAXLE", 1984855388u},
-    {"R_MIDDLEA", 812161446u},
-    {"R_MIDDLEB", 1034073114u},
-    {"R_MIDDLEC", 148130434u},
-    {"R_MIDDLE_END", 3546037191u},
-    {"R_MIDPANEL1", 3593695816u},
-    {"R_MIDPANEL2", 2785907197u},
-    {"R_MIDSUPPORT", 1520646530u},
-    {"R_MIDWHEEL", 4073776971u},
-    {"R_OUTERFLAP", 3312143588u},
-    {"R_OUTERTHRUSTERPANELA", 2479252796u},
-    {"R_OUTERTHRUSTERPANELB", 2145467758u},
-    {"R_OUTERTHRUSTERPANELC", 1847237089u},
-    {"R_OVERHEADDOOR1", 3217677901u},
-    {"R_OVERHEADDOOR2", 3784319449u},
-    {"R_PEDAL", 1073302274u},
-    {"R_PINKYA", 1719789456u},
-    {"R_PINKYB", 869597751u},
-    {"R_PINKYC", 3693662948u},
-    {"R_PINKY_END", 1729498404u},
-    {"R_PISTON", 2581087731u},
-    {"R_PITCH", 319614870u},
-    {"R_PITCHRECOIL", 1360155857u},
-    {"R_POWERCORE", 1668442840u},
-    {"R_REARAXLE", 2094109583u},
-    {"R_REARDISK", 768395665u},
-    {"R_REARDOOR", 197266429u},
-    {"R_REARENGINESHIELD", 2281324824u},
-    {"R_REARFLAP", 2447288296u},
-    {"R_REARGEAR1", 17223862u},
-    {"R_REARGEAR2", 4071371777u},
-    {"R_REARGEAR3", 3494178611u},
-    {"R_REARGEAR4", 3103768745u},
-    {"R_REARGEARA", 222980417u},
-    {"R_REARGEARB", 4289252862u},
-    {"R_REARGEARC", 3953567226u},
-    {"R_REARGEARDOOR", 1481063746u},
-    {"R_REARGEARDOOR1", 4025803247u},
-    {"R_REARGEARDOOR2", 3786294626u},
-    {"R_REARGEARSUPPORT", 2268888731u},
-    {"R_REARPANEL1", 622475301u},
-    {"R_REARPANEL2", 4093695475u},
-    {"R_REARSHOCKLOWER", 3237172461u},
-    {"R_REARSHOCKUPPER", 4025675475u},
-    {"R_REARSUPPORT", 1462887748u},
-    {"R_REARSUSPENSION", 3708936486u},
-    {"R_REARTHRUSTER", 3673823181u},
-    {"R_REARTHRUSTER1", 1766662782u},
-    {"R_REARTHRUSTER2", 1477378046u},
-    {"R_REARTHRUSTERFLAP", 3559570972u},
-    {"R_REARVENT", 1025623836u},
-    {"R_REARVENTS", 1561737944u},
-    {"R_REARWHEEL", 2167947592u},
-    {"R_REARWHEELPIVOT", 3649043221u},
-    {"R_RELOADPIN", 660457104u},
-    {"R_RINGA", 931042330u},
-    {"R_RINGB", 1237039252u},
-    {"R_RINGC", 2624511473u},
-    {"R_RING_END", 2819542915u},
-    {"R_RUDDER", 378834321u},
-    {"R_SHELL1", 2177680988u},
-    {"R_SHELL2", 2469390626u},
-    {"R_SHELL3", 4129238787u},
-    {"R_SHELL4", 3621843591u},
-    {"R_SHELL5", 2797473858u},
-    {"R_SHELLROTATION", 3074686431u},
-    {"R_SHIELD", 682273574u},
-    {"R_SHIELDARM", 2739289683u},
-    {"R_SHOCKLOWER", 1166594346u},
-    {"R_SHOCKUPPER", 3884601638u},
-    {"R_SHOULDER", 1665358410u},
-    {"R_SHOULDERATTACH", 954251114u},
-    {"R_SHOULDERPAD", 457744838u},
-    {"R_SHOULDERROLL", 3360970358u},
-    {"R_SIDELOCK_BACK", 2257473628u},
-    {"R_SIDELOCK_BACK_END", 3149788146u},
-    {"R_SIDELOCK_FRONT", 3273527615u},
-    {"R_SIDELOCK_FRONT_END", 2030996345u},
-    {"R_SIDEVENT1", 3212206043u},
-    {"R_SIDEVENT2", 2715821231u},
-    {"R_SIDEVENT3", 1255274124u},
-    {"R_SIDEVENT4", 1024908054u},
-    {"R_SMALLPULLY", 1767831881u},
-    {"R_SMOKESTACK", 1091651574u},
-    {"R_SPIKEINSIDE", 563530995u},
-    {"R_SPIKEOUTSIDE", 850569389u},
-    {"R_STEERINGLINK", 2201033226u},
-    {"R_STEERINGLINKINNER", 2681793709u},
-    {"R_STEERINGLINKOUTER", 1635783371u},
-    {"R_STEERINGPIVOT", 2590276672u},
-    {"R_SUPPORT1", 1202702096u},
-    {"R_SUPPORT2", 1439523659u},
-    {"R_SUPPORT3", 3846570558u},
-    {"R_SUPPORT4", 4228329408u},
-    {"R_THROTTLE", 2231500842u},
-    {"R_THRUSTER", 3301476370u},
-    {"R_THRUSTER1", 2558765017u},
-    {"R_THRUSTER2", 1270025781u},
-    {"R_THRUSTER3", 3125439334u},
-    {"R_THRUSTERFLAP", 1776095517u},
-    {"R_THRUSTERFLAP1", 609567619u},
-    {"R_THRUSTERFLAP2", 905963224u},
-    {"R_THRUSTERPANEL", 306890114u},
-    {"R_THUMBA", 1102577659u},
-    {"R_THUMBB", 787765876u},
-    {"R_THUMBC", 3860416703u},
-    {"R_THUMB_END", 2176474540u},
-    {"R_TOE", 1939367865u},
-    {"R_TOPBARREL", 3288663904u},
-    {"R_TOPCANISTER", 2173355228u},
-    {"R_TOPHOUSING", 674498645u},
-    {"R_TOPREARLEGHINGE", 1047768032u},
-    {"R_TOPTUBE", 2899694509u},
-    {"R_TOP_BOX01", 3942524321u},
-    {"R_TOP_BOX02", 1696635368u},
-    {"R_TOP_BOX03", 1456667981u},
-    {"R_TOP_BOX04", 1083035843u},
-    {"R_TOP_CANNISTER01", 1999235894u},
-    {"R_TOP_CANNISTER02", 3153949916u},
-    {"R_TOP_CANNISTER03", 2309787707u},
-    {"R_UPPERSUSPENSION", 3839060481u},
-    {"R_VENT", 1205209995u},
-    {"R_VENT_END", 1611614878u},
-    {"R_WEAPON", 2499881490u},
-    {"R_WHEEL1", 3412486250u},
-    {"R_WHEEL10_ROTATE", 3282254545u},
-    {"R_WHEEL10_TRANSLATE", 1230749804u},
-    {"R_WHEEL11_ROTATE", 673389254u},
-    {"R_WHEEL11_TRANSLATE", 2192524473u},
-    {"R_WHEEL12_ROTATE", 3031470467u},
-    {"R_WHEEL12_TRANSLATE", 3155071899u},
-    {"R_WHEEL13_TRANSLATE", 1770326393u},
-    {"R_WHEEL1_DEPLOYHUB", 4151378384u},
-    {"R_WHEEL1_DEPLOYSPIKE1", 1061283032u},
-    {"R_WHEEL1_DEPLOYSPIKE2", 762331445u},
-    {"R_WHEEL1_DEPLOYSPIKE3", 1803205969u},
-    {"R_WHEEL1_DEPLOYSPIKE4", 1515199228u},
-    {"R_WHEEL1_DEPLOYSPIKE5", 2148525691u},
-    {"R_WHEEL1_DEPLOYSPIKE6", 1850032870u},
-    {"R_WHEEL1_DEPLOYSPIKE7", 1421348804u},
-    {"R_WHEEL1_DEPLOYSPIKE8", 3261557537u},
-    {"R_WHEEL1_ROTATE", 382218229u},
-    {"R_WHEEL1_TRANSLATE", 295177829u},
-    {"R_WHEEL2", 445974206u},
-    {"R_WHEEL2_ROTATE", 1066474903u},
-    {"R_WHEEL2_TRANSLATE", 4005736250u},
-    {"R_WHEEL3", 138174985u},
-    {"R_WHEEL3_ROTATE", 1712144270u},
-    {"R_WHEEL3_TRANSLATE", 2959938177u},
-    {"R_WHEEL4", 4278341525u},
-    {"R_WHEEL4_ROTATE", 225776827u},
-    {"R_WHEEL4_TRANSLATE", 2223289680u},
-    {"R_WHEEL5", 3974277974u},
-    {"R_WHEEL5_ROTATE", 3907744388u},
-    {"R_WHEEL5_TRANSLATE", 2992552996u},
-    {"R_WHEEL6", 1803430031u},
-    {"R_WHEEL6_DEPLOYHUB", 3968009904u},
-    {"R_WHEEL6_DEPLOYSPIKE1", 2328021520u},
-    {"R_WHEEL6_DEPLOYSPIKE2", 2637983491u},
-    {"R_WHEEL6_DEPLOYSPIKE3", 1583804761u},
-    {"R_WHEEL6_DEPLOYSPIKE4", 819009070u},
-    {"R_WHEEL6_DEPLOYSPIKE5", 3519043598u},
-    {"R_WHEEL6_DEPLOYSPIKE6", 3825466517u},
-    {"R_WHEEL6_DEPLOYSPIKE7", 1833668386u},
-    {"R_WHEEL6_DEPLOYSPIKE8", 2005443484u},
-    {"R_WHEEL6_ROTATE", 237617448u},
-    {"R_WHEEL6_TRANSLATE", 1122782432u},
-    {"R_WHEEL7", 1631065091u},
-    {"R_WHEEL7_ROTATE", 1109449997u},
-    {"R_WHEEL7_TRANSLATE", 3702738401u},
-    {"R_WHEEL8", 1341747590u},
-    {"R_WHEEL8_ROTATE", 152551772u},
-    {"R_WHEEL8_TRANSLATE", 3986162229u},
-    {"R_WHEEL9_ROTATE", 916948579u},
-    {"R_WHEEL9_TRANSLATE", 4020787006u},
-    {"R_WING", 2001947653u},
-    {"R_WINGFAN", 2557431765u},
-    {"R_WINGPULLY", 3290958398u},
-    {"R_WINGVENTS", 1100663657u},
-    {"R_WRIST", 1310993196u},
-    {"R_YAW", 3068704555u},
-    {"R_YAW2", 3571316050u},
-    {"SCOPE_SOCKET", 3650476089u},
-    {"SHELL1", 1777916161u},
-    {"SHELL10", 2634601848u},
-    {"SHELL11", 1263186429u},
-    {"SHELL12", 1082498163u},
-    {"SHELL13", 1854896262u},
-    {"SHELL14", 3825361770u},
-    {"SHELL2", 2086501834u},
-    {"SHELL3", 259892264u},
-    {"SHELL4", 4257022119u},
-    {"SHELL5", 1020427985u},
-    {"SHELL6", 720558866u},
-    {"SHELL7", 3636213414u},
-    {"SHELL9", 3794192763u},
-    {"SHELLEJECT_R_SOCKET", 2254105017u},
-    {"SIDEGRIP", 1681053934u},
-    {"SIDERAIL_SOCKET", 755919266u},
-    {"SLICE.005", 781444628u},
-    {"SLOWSPIN_BASE_IDLE_FULL", 1076688081u},
-    {"SMALLBARREL1", 826122527u},
-    {"SMALLBARREL2", 595527074u},
-    {"SMALLBLADE", 3916480659u},
-    {"SMALLSPINNINGENGINE", 1570658564u},
-    {"SNIPER_SCOPE", 1400340987u},
-    {"SPIN", 2401783636u},
-    {"SPINDLE", 1025849218u},
-    {"SPINELOWER", 4060706981u},
-    {"SPINEMIDDLE", 2242507051u},
-    {"SPINEUPPER", 3061072950u},
-    {"SPINNER", 2954194361u},
-    {"SPINUP", 4261665176u},
-    {"SPIRE", 298354645u},
-    {"SPIREPANELS", 338710066u},
-    {"STABILIZER", 2919287888u},
-    {"STEERING", 1458068209u},
-    {"STOCK", 2568524136u},
-    {"STRAIGHT_PULL", 46896897u},
-    {"TAIL", 3449862424u},
-    {"TAILVENTS", 2250973670u},
-    {"THULL", 3570760957u},
-    {"TOPFRONTLEGHINGEA", 2359506969u},
-    {"TOPFRONTLEGHINGEB", 2060981379u},
-    {"TOPPANEL01", 3587933164u},
-    {"TOPPANEL02", 1134583660u},
-    {"TOPPANEL03", 2645365644u},
-    {"TOPPANEL04", 197259188u},
-    {"TOPREARENGINEFLAPA", 635268839u},
-    {"TOPREARENGINEFLAPB", 4086401616u},
-    {"TOPREARENGINEFLAPC", 921899274u},
-    {"TOPREARENGINEFLAPD", 348179630u},
-    {"TOPREARENGINEFLAPE", 948966460u},
-    {"TOPREARENGINEFLAPF", 1800894922u},
-    {"TOPREARENGINEFLAPG", 619080913u},
-    {"TOPREARENGINEFLAPH", 1202008678u},
-    {"TOP_DISC", 2046112361u},
-    {"TRAJECTORY", 1828274654u},
-    {"TRIGGER", 831168718u},
-    {"TR_MAX", 721358111u},
-    {"TURBINE", 3312333887u},
-    {"UPPERDOOR1", 1462638923u},
-    {"UPPERDOOR2", 2225632319u},
-    {"UPPERDOOR3", 1926418580u},
-    {"UPPERDOOR4", 2722377586u},
-    {"VEHICLE_COMMON_ANT_ATTACHMENT_MININGLASER001", 651546252u},
-    {"VEHICLE_COMMON_ANT_BASE_CHASSIS", 89398582u},
-    {"VEHICLE_COMMON_ANT_WEAPON_MININGTURRET", 2182042677u},
-    {"VEHICLE_COMMON_ATTACHMENT_HOODORNAMENT_FIGURE_CHROMESNAKEEYES_ANIMATED", 115398135u},
-    {"VEHICLE_COMMON_ATTACHMENT_RADAR_PROXIMITY001", 3450335605u},
-    {"VEHICLE_COMMON_AUTOTURRETGROUND_BASE_TURRET", 2755292179u},
-    {"VEHICLE_COMMON_AUTOTURRETGROUND_WEAPONS_MACHINEGUN", 3535937897u},
-    {"VEHICLE_COMMON_AUTOTURRET_GROUNDANTIAIRROCKETLAUNCHER", 1557672612u},
-    {"VEHICLE_COMMON_AUTOTURRET_GROUNDANTITANKROCKETLAUNCHER", 4192786543u},
-    {"VEHICLE_COMMON_BUGGY_BASE_CHASSIS", 1891975577u},
-    {"VEHICLE_COMMON_COLOSSUS_BASE_CHASSIS", 3741766728u},
-    {"VEHICLE_COMMON_COLOSSUS_WEAPON_MAINCANNON001", 2029538400u},
-    {"VEHICLE_COMMON_CRAWLER_BASE_CHASSIS", 110176716u},
-    {"VEHICLE_COMMON_DROPPOD", 1113053344u},
-    {"VEHICLE_COMMON_ENGINEERDEPLOYABLE_BASE_TRIPOD", 3991326819u},
-    {"VEHICLE_COMMON_ENGINEERDEPLOYABLE_WEAPON_MACHINEGUN", 2945904176u},
-    {"VEHICLE_COMMON_ENGINEERDEPLOYABLE_WEAPON_ROCKETPOD", 726139324u},
-    {"VEHICLE_COMMON_FACILITYTURRET_BASE", 338743835u},
-    {"VEHICLE_COMMON_FACILITYTURRET_TANKCANNON", 1806637269u},
-    {"VEHICLE_COMMON_FACILITYTURRET_WEAPON_30MMCANNON", 1029709092u},
-    {"VEHICLE_COMMON_FACILITYTURRET_WEAPON_CHAINGUN", 2109306918u},
-    {"VEHICLE_COMMON_FACILITYTURRET_WEAPON_FLAKCANNON", 2143811686u},
-    {"VEHICLE_COMMON_FACILITYTURRET_WEAPON_MISSILELAUNCHER", 4082459912u},
-    {"VEHICLE_COMMON_GALAXY", 87575790u},
-    {"VEHICLE_COMMON_HEAVYFIGHTER_BASE_CHASSIS", 808899809u},
-    {"VEHICLE_COMMON_JETBIKE_BASE_CHASSIS", 75518749u},
-    {"VEHICLE_COMMON_LIBERATOR", 1689559053u},
-    {"VEHICLE_COMMON_LIBERATOR_WEAPON_105MMCANNON", 1937782095u},
-    {"VEHICLE_COMMON_LIBERATOR_WEAPON_60MMBALLTURRET_ROCKETPODS", 1473445921u},
-    {"VEHICLE_COMMON_LIBERATOR_WEAPON_60MMCANNO_DOUBLEBARREL", 2424947579u},
-    {"VEHICLE_COMMON_LIBERATOR_WEAPON_75MMCANNON", 2187252056u},
-    {"VEHICLE_COMMON_LIBERATOR_WEAPON_NOSEGUN15MM", 1942104436u},
-    {"VEHICLE_COMMON_LIBERATOR_WEAPON_NOSEGUN20MM", 2283716452u},
-    {"VEHICLE_COMMON_LIBERATOR_WEAPON_NOSEGUN30MM", 2163822301u},
-    {"VEHICLE_COMMON_LIBERATOR_WEAPON_REAR30MMQUADGATLING", 3126493516u},
-    {"VEHICLE_COMMON_LIGHTNING", 2270971168u},
-    {"VEHICLE_COMMON_LIGHTNING_75MMCANNON", 3011835733u},
-    {"VEHICLE_COMMON_LIGHTNING_WEAPON_100MMCANNON", 3968508958u},
-    {"VEHICLE_COMMON_LIGHTNING_WEAPON_ANACONDATURRET", 4047477869u},
-    {"VEHICLE_COMMON_LIGHTNING_WEAPON_SKYGUARDCANNON", 3240810951u},
-    {"VEHICLE_COMMON_QUAD", 4211252507u},
-    {"VEHICLE_COMMON_QUAD_ATTACHMENT_ANTENNA", 3809288696u},
-    {"VEHICLE_COMMON_QUAD_BASE_COCKPIT", 3726394811u},
-    {"VEHICLE_COMMON_QUAD_WEAPON_20MMGUN", 1303942709u},
-    {"VEHICLE_COMMON_QUAD_WEAPON_30MMGUN", 3344407534u},
-    {"VEHICLE_COMMON_QUAD_WEAPON_40MMGUN", 1275472689u},
-    {"VEHICLE_COMMON_QUAD_WEAPON_50CALGUN", 3681461710u},
-    {"VEHICLE_COMMON_QUAD_WEAPON_PULSEDPARTICLEACCELERATOR", 1135174062u},
-    {"VEHICLE_COMMON_QUAD_WEAPON_ROCKETLAUNCHERNC", 1124983827u},
-    {"VEHICLE_COMMON_QUAD_WEAPON_ROCKETLAUNCHERTR", 1765322296u},
-    {"VEHICLE_COMMON_QUAD_WEAPON_ROCKETLAUNCHERVS", 2647307111u},
-    {"VEHICLE_COMMON_QUAD_WEAPON_SHOTGUN", 572442510u},
-    {"VEHICLE_COMMON_RECONDRONE_BASE_CHASSIS", 3592091344u},
-    {"VEHICLE_COMMON_SUNDERER_ATTACHMENT_SMOKESTACK001", 722503334u},
-    {"VEHICLE_COMMON_SUNDERER_BASE_CHASSIS", 869507288u},
-    {"VEHICLE_COMMON_VALKYRIE_BASE_CHASSIS", 2020680874u},
-    {"VEHICLE_COMMON_WEAPON_20MMBALLTURRET", 220791727u},
-    {"VEHICLE_COMMON_WEAPON_20MMHEAVYBALLTURRET", 714496997u},
-    {"VEHICLE_COMMON_WEAPON_20MMVEHICLETURRET", 1654582506u},
-    {"VEHICLE_COMMON_WEAPON_20MMVEHICLETURRETCOAXIAL", 964969609u},
-    {"VEHICLE_COMMON_WEAPON_30MMFLAKTURRET", 1903739073u},
-    {"VEHICLE_COMMON_WEAPON_30MMGATLINGBALLTURRET", 3223513967u},
-    {"VEHICLE_COMMON_WEAPON_30MMVEHICLETURRET", 475599474u},
-    {"VEHICLE_COMMON_WEAPON_40MMGRENADELAUNCHER", 459445938u},
-    {"VEHICLE_COMMON_WEAPON_40MMGRENADELAUNCHER_TWOBARREL", 2257917057u},
-    {"VEHICLE_COMMON_WEAPON_50CALMACHINEGUN", 78710034u},
-    {"VEHICLE_COMMON_WEAPON_50CALMACHINEGUNCOAXIAL", 2179552981u},
-    {"VEHICLE_COMMON_WEAPON_50MMGATLINGBALLTURRET", 3616397177u},
-    {"VEHICLE_COMMON_WEAPON_60MMBALLTURRET", 2475268786u},
-    {"VEHICLE_COMMON_WEAPON_60MMMISSILELAUNCHERBALLTURRET", 3991537050u},
-    {"VEHICLE_COMMON_WEAPON_60MMVEHICLETURRET", 2268774313u},
-    {"VEHICLE_COMMON_WEAPON_85MMRECOILLESSRIFLETURRET", 2345600056u},
-    {"VEHICLE_COMMON_WEAPON_FLAKBALLTURRET", 605820305u},
-    {"VEHICLE_COMMON_WEAPON_NULLTURRET", 4137492255u},
-    {"VEHICLE_NC_REAVER", 1116911325u},
-    {"VEHICLE_NC_REAVER_GLASS_LOD0", 1500128684u},
-    {"VEHICLE_NC_REAVER_WEAPON_14MMCANNON", 52417596u},
-    {"VEHICLE_NC_REAVER_WEAPON_20MMGATLINGCANNON001", 3245907420u},
-    {"VEHICLE_NC_REAVER_WEAPON_20MMGATLINGCANNON002", 3169031338u},
-    {"VEHICLE_NC_VANGUARD", 1044163086u},
-    {"VEHICLE_NC_VANGUARD_WEAPON_150MMARTILLERYCANNON", 3893742285u},
-    {"VEHICLE_NC_VANGUARD_WEAPON_150MMCANNON", 3094816405u},
-    {"VEHICLE_NC_VANGUARD_WEAPON_150MMCANNON_REFERRAL001", 1025710107u},
-    {"VEHICLE_NC_VANGUARD_WEAPON_200MMARTILLERYCANNON_LOD0", 1602021409u},
-    {"VEHICLE_NC_VANGUARD_WEAPON_ANTIVEHICLETURRET01", 929720993u},
-    {"VEHICLE_NC_VANGUARD_WEAPON_PSA_MAINCANNON001", 560152447u},
-    {"VEHICLE_NC_VANGUARD_WEAPON_PSA_MAINCANNON001_LOD0", 235598279u},
-    {"VEHICLE_NC_VANGUARD_WEAPON_RAILCANNON", 4055724013u},
-    {"VEHICLE_NC_VANGUARD_WEAPON_RAILGUNVEHICLETURRET", 3241010037u},
-    {"VEHICLE_TR_MOSQUITO", 3337620633u},
-    {"VEHICLE_TR_MOSQUITO_WEAPON_12MMCANNON001", 3880820423u},
-    {"VEHICLE_TR_MOSQUITO_WEAPON_20MMGATLINGCANNON001", 2635432493u},
-    {"VEHICLE_TR_MOSQUITO_WEAPON_20MMGATLINGCANNON002", 1064781554u},
-    {"VEHICLE_TR_PROWLER_BASE_CHASSIS", 1622762646u},
-    {"VEHICLE_TR_PROWLER_WEAPON_120MMARTILLERYCANNON", 1806804023u},
-    {"VEHICLE_TR_PROWLER_WEAPON_120MMCANNON", 2008156296u},
-    {"VEHICLE_TR_PROWLER_WEAPON_120MMCANNON_REFERRAL001", 2815222948u},
-    {"VEHICLE_TR_PROWLER_WEAPON_120MMQUADCANNON", 1867509980u},
-    {"VEHICLE_TR_PROWLER_WEAPON_ESAV002", 4224834756u},
-    {"VEHICLE_TR_PROWLER_WEAPON_ESAV003", 4266385848u},
-    {"VEHICLE_VS_MAGRIDER", 1570826753u},
-    {"VEHICLE_VS_MAGRIDER_WEAPON_ESAV002", 4186885183u},
-    {"VEHICLE_VS_MAGRIDER_WEAPON_HEAVYRAILBEAM001", 2708597823u},
-    {"VEHICLE_VS_MAGRIDER_WEAPON_PLASMACANNON001", 3296772448u},
-    {"VEHICLE_VS_MAGRIDER_WEAPON_PLASMACANNON002", 3661491418u},
-    {"VEHICLE_VS_MAGRIDER_WEAPON_PLASMACANNON003", 1745324143u},
-    {"VEHICLE_VS_MAGRIDER_WEAPON_PLASMACANNON004", 2043161584u},
-    {"VEHICLE_VS_MAGRIDER_WEAPON_PULSEDPARTICLEACCELERATOR001", 3478917814u},
-    {"VEHICLE_VS_SCYTHE_WEAPON_20MMGATLINGCANNON001", 504828295u},
-    {"VEHICLE_VS_SCYTHE_WEAPON_20MMGATLINGCANNON002", 1818209819u},
-    {"VEHICLE_VS_VORTEX", 1574580347u},
-    {"VS_MAX", 1122641024u},
-    {"WEAPONATTACHMENT_COMMON_CLIP_THUMPER001", 175089113u},
-    {"WEAPONATTACHMENT_NC_GRENADELAUNCHER_001", 2900915387u},
-    {"WEAPONATTACHMENT_NS_APROUND_001", 2585526967u},
-    {"WEAPONATTACHMENT_TR_CLIP_ROCKETLAUNCHERAMMO002", 498327413u},
-    {"WEAPONATTACHMENT_TR_GRENADELAUNCHER_001", 3645478496u},
-    {"WEAPONMOUNT", 622280259u},
-    {"WEAPONS_COMMON_FAVENWEAPONS_LMG001_LOD0", 1098942010u},
-    {"WEAPONS_COMMON_FAVENWEAPONS_SCOUTRIFLE001_LOD0", 4040009277u},
-    {"WEAPONS_COMMON_FAVENWEAPONS_SMG001_LOD0", 1253436212u},
-    {"WEAPONS_COMMON_FAVENWEAPONS_SMG001_OLD", 4282203036u},
-    {"WEAPONS_COMMON_MAXHEAVYMACHINEGUNLEFT001", 2503882700u},
-    {"WEAPONS_COMMON_MAXHEAVYMACHINEGUNRIGHT001", 3001572027u},
-    {"WEAPONS_COMMON_THUMPER001", 1690090417u},
-    {"WEAPONS_NC_DOKUWEAPONS_LMG001", 2750269423u},
-    {"WEAPONS_NC_DOKUWEAPONS_SMG001", 533703831u},
-    {"WEAPONS_NC_DOKUWEAPONS_SNIPERRIFLE001_LOD0", 2009555957u},
-    {"WEAPONS_NC_MAXAF23GRINDER", 4135457461u},
-    {"WEAPONS_NC_MAXAF34MATTOCKLEFT", 1004136612u},
-    {"WEAPONS_NC_MAXAF34MATTOCKRIGHT", 3332107390u},
-    {"WEAPONS_TR_DOKUWEAPONS_ASSUALTRIFLE001", 3481383269u},
-    {"WEAPONS_TR_DOKUWEAPONS_CARBINE001", 2996211783u},
-    {"WEAPONS_TR_DOKUWEAPONS_CHAINGUN001", 1060044686u},
-    {"WEAPONS_TR_DOKUWEAPONS_LGM001", 151225539u},
-    {"WEAPONS_TR_DOKUWEAPONS_PISTOL001", 1646183586u},
-    {"WEAPONS_TR_DOKUWEAPONS_SMG001", 1014941510u},
-    {"WEAPONS_VS_DOKUWEAPONS_LMG001", 728552198u},
-    {"WEAPONS_VS_DOKUWEAPONS_SMG001", 805042209u},
-    {"WEAPONS_VS_MAXCOSMOSVM3_LEFT", 407208271u},
-    {"WEAPONS_VS_MAXCOSMOSVM3_LEFT_LOD0", 2300638456u},
-    {"WEAPONS_VS_MAXCOSMOSVM3_RIGHT", 1571532502u},
-    {"WEAPONS_VS_MAXCOSMOSVM3_RIGHT_LOD0", 3029105912u},
-    {"WEAPONS_VS_MAXHEAVYMACHINEGUNLEFT001", 2234692128u},
-    {"WEAPONS_VS_MAXHEAVYMACHINEGUNRIGHT001", 1210586064u},
-    {"WEAPONS_VS_MAXNEBULAVM20_LEFT", 1456372033u},
-    {"WEAPONS_VS_MAXNEBULAVM20_LEFT_LOD0", 1252909755u},
-    {"WEAPONS_VS_MAXNEBULAVM20_RIGHT", 3849338326u},
-    {"WEAPONS_VS_MAXNEBULAVM20_RIGHT_LOD0", 2358689877u},
-    {"WEAPON_COMMON_ACETOOL", 1506210194u},
-    {"WEAPON_COMMON_AUTOPISTOL001", 1225820717u},
-    {"WEAPON_COMMON_AUTOPISTOL001_LOD0", 1834137684u},
-    {"WEAPON_COMMON_CROSSBOW", 1769359068u},
-    {"WEAPON_COMMON_DETONATOR001ARX", 1581489698u},
-    {"WEAPON_COMMON_DETONATOR001ARX_LOD0", 2555683639u},
-    {"WEAPON_COMMON_FAVENWEAPONS_SCOUTRIFLE001", 1354362967u},
-    {"WEAPON_COMMON_HEAVYCROSSBOW001", 2390247076u},
-    {"WEAPON_COMMON_KNIFE", 1129441107u},
-    {"WEAPON_COMMON_MAXFLAKCANNON001", 1671105602u},
-    {"WEAPON_COMMON_MAXFLAMETHROWER001", 1232641049u},
-    {"WEAPON_COMMON_MAXGRENADELAUNCHER", 2764198123u},
-    {"WEAPON_COMMON_MEDICALAPPLICATOR", 114903740u},
-    {"WEAPON_COMMON_NULLPARENT", 1071421814u},
-    {"WEAPON_COMMON_REMOTEELECTRONICSKIT", 926578870u},
-    {"WEAPON_COMMON_REPAIRTOOL", 2209954070u},
-    {"WEAPON_COMMON_REVOLVER001", 228167708u},
-    {"WEAPON_COMMON_REVOLVER005", 2228420237u},
-    {"WEAPON_COMMON_REVOLVER005_LOD0", 2645006889u},
-    {"WEAPON_COMMON_ROCKETLAUNCHER", 805864538u},
-    {"WEAPON_COMMON_ROCKETLAUNCHER002", 530090605u},
-    {"WEAPON_COMMON_ROCKETLAUNCHER002_LOD0", 4071192180u},
-    {"WEAPON_COMMON_ROCKETRIFLE", 1543946977u},
-    {"WEAPON_COMMON_ROCKETRIFLE_LOD0", 2393600453u},
-    {"WEAPON_COMMON_SKELETON", 2577041220u},
-    {"WEAPON_COMMON_SMG001", 1671001587u},
-    {"WEAPON_COMMON_SNIPER02", 252056241u},
-    {"WEAPON_COMMON_SNIPERRIFLE001", 3351016511u},
-    {"WEAPON_NC_AF41HACKSAW", 507584174u},
-    {"WEAPON_NC_KNIFE05", 612126286u},
-    {"WEAPON_NC_KNIFE05_LOD0", 3587576385u},
-    {"WEAPON_NC_LMG_SKELETON", 985115408u},
-    {"WEAPON_NC_MAXANTIVEHICLE001", 2144424870u},
-    {"WEAPON_NC_MAXROCKETLAUNCHERLEFT001", 1130413373u},
-    {"WEAPON_NC_MAXROCKETLAUNCHERRIGHT001", 2000111793u},
-    {"WEAPON_NC_MINEBOUNCER001", 2255915291u},
-    {"WEAPON_NC_PISTOLMAG003", 2732068263u},
-    {"WEAPON_NC_PISTOLMAG_LOD0", 2708013221u},
-    {"WEAPON_NC_ROCKETLAUNCHER", 3920111186u},
-    {"WEAPON_NC_ROCKETLAUNCHER002", 29567412u},
-    {"WEAPON_NC_SHOTGUNJACKHAMMER001", 1664125525u},
-    {"WEAPON_NC_SMG002_SKELETON", 4138511950u},
-    {"WEAPON_NC_SNIPERRIFLEBOLTACTION001", 1040411483u},
-    {"WEAPON_PISTOLSHOTGUN_SKELETON", 2366367635u},
-    {"WEAPON_TR_CHAINGUN001", 3827891891u},
-    {"WEAPON_TR_CLAYMORE001", 2393888159u},
-    {"WEAPON_TR_KNIFE04", 879194671u},
-    {"WEAPON_TR_KNIFE04_LOD0", 2794181090u},
-    {"WEAPON_TR_LMG_SKELETON", 3747836068u},
-    {"WEAPON_TR_M2MUTILATORLEFT001", 2727715993u},
-    {"WEAPON_TR_M2MUTILATORLEFT001_LOD0", 2693271594u},
-    {"WEAPON_TR_M2MUTILATORRIGHT001", 3748233696u},
-    {"WEAPON_TR_M2MUTILATORRIGHT001_LOD0", 1688152586u},
-    {"WEAPON_TR_M6ONSLAUGHTLEFT001", 2108655618u},
-    {"WEAPON_TR_M6ONSLAUGHTLEFT001_LOD0", 3990737116u},
-    {"WEAPON_TR_M6ONSLAUGHTRIGHT001", 605029380u},
-    {"WEAPON_TR_M6ONSLAUGHTRIGHT001_LOD0", 356495221u},
-    {"WEAPON_TR_MAXANTIINFANTRY001", 477864652u},
-    {"WEAPON_TR_MAXANTIVEHICLELEFT001", 1824765190u},
-    {"WEAPON_TR_MAXANTIVEHICLERIGHT001", 3246078305u},
-    {"WEAPON_TR_MAXROCKETLAUNCHER001", 4127184068u},
-    {"WEAPON_TR_MRC3MERCYLEFT001", 2346227292u},
-    {"WEAPON_TR_MRC3MERCYLEFT001_LOD0", 200963513u},
-    {"WEAPON_TR_MRC3MERCYRIGHT001", 2540394430u},
-    {"WEAPON_TR_MRC3MERCYRIGHT001_LOD0", 3915609608u},
-    {"WEAPON_TR_PISTOL004_LOD0", 1445532978u},
-    {"WEAPON_TR_ROCKETLAUNCHER001", 1470928497u},
-    {"WEAPON_TR_ROCKETLAUNCHER002", 3379526133u},
-    {"WEAPON_TR_SNIPERBOLTACTION001", 2477523247u},
-    {"WEAPON_VS_BLUESHIFTVM5LEFT001", 2628469533u},
-    {"WEAPON_VS_BLUESHIFTVM5LEFT001_LOD0", 978078741u},
-    {"WEAPON_VS_BLUESHIFTVM5RIGHT001_LOD0", 47710441u},
-    {"WEAPON_VS_KNIFE02", 911498501u},
-    {"WEAPON_VS_KNIFE02_LOD0", 1345487733u},
-    {"WEAPON_VS_KNIFE04", 2788965591u},
-    {"WEAPON_VS_LASHER001_SKELETON", 587088097u},
-    {"WEAPON_VS_MAXFLAKCANNONLEFT001", 1047803429u},
-    {"WEAPON_VS_MAXFLAKCANNONRIGHT001", 3072185269u},
-    {"WEAPON_VS_MAXROCKETLAUNCHER001", 522622077u},
-    {"WEAPON_VS_PISTOLBEAMER", 1205071495u},
-    {"WEAPON_VS_PISTOLBEAMER003", 553063763u},
-    {"WEAPON_VS_PISTOLBEAMERHEAVY002", 213536010u},
-    {"WEAPON_VS_PROXIMITYMINE", 2924715602u},
-    {"WEAPON_VS_ROCKETLAUNCHER", 14793289u},
-    {"WEAPON_VS_ROCKETLAUNCHER002", 663227585u},
-    {"WEAPON_VS_SHOTGUNPUMP001_SKELETON", 1463923475u},
-    {"WEAPON_VS_SKELETON", 1726767172u},
-    {"WEAPON_VS_SMG001_SKELETON", 364301239u},
-    {"WEAPON_VS_SMG002_SKELETON", 503403635u},
-    {"WEAPON_VS_SNIPERRIFLE004_SKELETON", 3517958110u},
-    {"WEST", 2118432348u},
-    {"WESTARM", 1075982656u},
-    {"WESTJOINT", 2529748557u},
-    {"WESTPANEL", 479761161u},
-    {"WORLDROOT", 2726916658u},
-    {"WORLD_ROOT", 2102567500u},
-    {"YAW", 2405304143u},
-    {"YAWPROP2_L", 2619700730u},
-    {"YAWPROP2_R", 1971300527u},
-    {"YAWPROP_L", 3546266377u},
-    {"YAWPROP_R", 411682144u},
-    {"YAWRECOIL", 843617178u},
-};
\ No newline at end of file
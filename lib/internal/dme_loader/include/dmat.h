@@ -1,9 +1,10 @@
 #pragma once
 #include <cstring>
 #include <stdexcept>
-#include <memory>
+#include <optional>
 #include <span>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "material.h"
@@ -13,6 +14,11 @@ namespace warpgate {
         mutable std::span<uint8_t> buf_;
 
         DMAT(std::span<uint8_t> subspan);
+        // Materials hold views into this DMAT's arenas, so it may be moved but not copied
+        DMAT(const DMAT &) = delete;
+        DMAT &operator=(const DMAT &) = delete;
+        DMAT(DMAT &&) = default;
+        DMAT &operator=(DMAT &&) = default;
 
         template <typename T>
         struct ref {
@@ -36,16 +42,23 @@ namespace warpgate {
         ref<uint32_t> version() const;
         ref<uint32_t> filenames_length() const;
         std::span<uint8_t> texturename_data() const;
-        const std::vector<std::string> textures() const;
+        // Views into the DMAT buffer
+        std::span<const std::string_view> textures() const;
+        // Looks up a texture name by the hash of its uppercased name
+        std::optional<std::string_view> texture(uint32_t namehash) const;
 
         ref<uint32_t> material_count() const;
-        std::shared_ptr<const Material> material(uint32_t index) const;
+        const Material *material(uint32_t index) const;
 
     private:
-        std::vector<std::shared_ptr<Material>> materials;
-        std::vector<std::string> texture_names;
+        std::vector<Material> materials;
+        std::vector<Parameter> parameters;
+        std::vector<MaterialTexture> material_textures;
+        std::vector<std::string_view> texture_names;
+        std::vector<std::pair<uint32_t, uint32_t>> texture_hashes;
         size_t materials_size;
         uint32_t material_offset() const;
+        std::optional<uint32_t> find_texture(uint32_t namehash) const;
         void parse_filenames();
         void parse_materials();
     };
@@ -51,7 +51,7 @@ namespace warpgate {
         ref<AABB> aabb() const;
 
         ref<uint32_t> mesh_count() const;
-        std::shared_ptr<const Mesh> mesh(uint32_t index) const;
+        const Mesh *mesh(uint32_t index) const;
 
         ref<uint32_t> drawcall_count() const;
         std::span<DrawCall> drawcalls() const;
@@ -67,7 +67,7 @@ namespace warpgate {
 
     private:
         std::shared_ptr<DMAT> dmat_ = nullptr;
-        std::vector<std::shared_ptr<Mesh>> meshes;
+        std::vector<Mesh> meshes;
         std::vector<Bone> bones;
         std::string name;
         size_t meshes_size;
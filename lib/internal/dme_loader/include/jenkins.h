@@ -1,20 +1,102 @@
 #pragma once
 #include <cstdint>
-#include <memory>
+#include <span>
 #include <string>
+#include <string_view>
 
 namespace jenkins {
-    uint32_t lookup2(const char* key, uint32_t init = 0);
-
     /**
-     * @brief Performs the jenkins hash mix operation on the integers contained by a, b, and c. Modifies all three.
+     * @brief Performs the jenkins hash mix operation on the integers a, b, and c. Modifies all three.
      * 
      * @param a 
      * @param b 
      * @param c 
      */
-    void mix(std::shared_ptr<uint32_t> a, std::shared_ptr<uint32_t> b, std::shared_ptr<uint32_t> c);
-    // Note: Forgelight uses a signed 32 bit int when hashing, but returns it as unsigned
-    uint32_t oaat(const char* key);
-    uint32_t oaat(std::string key);
-};
\ No newline at end of file
+    constexpr void mix(uint32_t &a, uint32_t &b, uint32_t &c) {
+        a -= b; a -= c; a ^= c >> 13;
+        b -= c; b -= a; b ^= a << 8;
+        c -= a; c -= b; c ^= b >> 13;
+        a -= b; a -= c; a ^= c >> 12;
+        b -= c; b -= a; b ^= a << 16;
+        c -= a; c -= b; c ^= b >> 5;
+        a -= b; a -= c; a ^= c >> 3;
+        b -= c; b -= a; b ^= a << 10;
+        c -= a; c -= b; c ^= b >> 15;
+    }
+
+    constexpr uint32_t lookup2(std::string_view key, uint32_t init = 0) {
+        // Characters are widened as (signed) char, matching the original implementation
+        auto at = [&key](size_t index, int shift) -> uint32_t {
+            return ((uint32_t)key[index]) << shift;
+        };
+        size_t length = key.size();
+        size_t position = length;
+        uint32_t a = 0x9e3779b9, b = a, c = init;
+        size_t p = 0;
+        while(position >= 12) {
+            a += at(p+0, 0) + at(p+1, 8) + at(p+2, 16) + at(p+3, 24);
+            b += at(p+4, 0) + at(p+5, 8) + at(p+6, 16) + at(p+7, 24);
+            c += at(p+8, 0) + at(p+9, 8) + at(p+10, 16) + at(p+11, 24);
+            mix(a, b, c);
+            p += 12;
+            position -= 12;
+        }
+        c += (uint32_t)length;
+        if(position >= 11) c += at(p+10, 24);
+        if(position >= 10) c += at(p+9, 16);
+        if(position >= 9) c += at(p+8, 8);
+        if(position >= 8) b += at(p+7, 24);
+        if(position >= 7) b += at(p+6, 16);
+        if(position >= 6) b += at(p+5, 8);
+        if(position >= 5) b += at(p+4, 0);
+        if(position >= 4) a += at(p+3, 24);
+        if(position >= 3) a += at(p+2, 16);
+        if(position >= 2) a += at(p+1, 8);
+        if(position >= 1) a += at(p+0, 0);
+
+        mix(a, b, c);
+        return c;
+    }
+
+    constexpr char ascii_upper(char value) {
+        return value >= 'a' && value <= 'z' ? (char)(value - ('a' - 'A')) : value;
+    }
+
+    // Note: Forgelight uses a signed 32 bit int when hashing, but returns it as unsigned.
+    // The arithmetic is done unsigned to stay well defined, with the right shift
+    // performed on the signed value so it sign-extends as before.
+    template <bool Uppercase = false>
+    constexpr uint32_t oaat_impl(std::string_view key) {
+        uint32_t hash = 0;
+        for(char value : key) {
+            if constexpr (Uppercase) {
+                value = ascii_upper(value);
+            }
+            hash += (uint32_t)(int32_t)(signed char)value;
+            hash += hash << 10;
+            hash ^= (uint32_t)((int32_t)hash >> 6);
+        }
+        hash += hash << 3;
+        hash ^= (uint32_t)((int32_t)hash >> 11);
+        hash += hash << 15;
+        return hash;
+    }
+
+    constexpr uint32_t oaat(std::string_view key) {
+        return oaat_impl<false>(key);
+    }
+
+    // Hashes the ASCII uppercase form of key without materializing it, as used for texture names
+    constexpr uint32_t oaat_upper(std::string_view key) {
+        return oaat_impl<true>(key);
+    }
+
+    /**
+     * @brief Hashes each key's uppercase form into the matching element of hashes.
+     * 
+     * @param keys 
+     * @param hashes Must hold at least keys.size() elements
+     */
+    void oaat_upper(std::span<const std::string> keys, std::span<uint32_t> hashes);
+    void oaat_upper(std::span<const std::string_view> keys, std::span<uint32_t> hashes);
+};
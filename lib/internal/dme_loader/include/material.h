@@ -3,17 +3,24 @@
 #include <optional>
 #include <stdexcept>
 #include <span>
-#include <unordered_map>
-#include <vector>
+#include <string>
+#include <string_view>
 
 #include "parameter.h"
 
 namespace warpgate {
+    // Binds a texture semantic to an index into the owning DMAT's texture names
+    struct MaterialTexture {
+        int32_t semantic;
+        uint32_t texture_index;
+    };
+
+    // Non-owning view of a material. Parameters and texture bindings live in
+    // arenas owned by the DMAT that parsed the material.
     struct Material {
         mutable std::span<uint8_t> buf_;
 
         Material(std::span<uint8_t> subspan);
-        Material(std::span<uint8_t> subspan, std::vector<std::string> textures);
 
         template <typename T>
         struct ref {
@@ -40,11 +47,12 @@ namespace warpgate {
         Parameter parameter(uint32_t index) const;
         std::optional<std::string> texture(int32_t semantic) const;
         std::optional<std::string> texture(Semantic semantic) const;
+        std::span<const Parameter> parameters() const;
+        std::span<const MaterialTexture> texture_bindings() const;
     private:
-        std::vector<Parameter> parameters;
-        std::unordered_map<int32_t, std::string> semantic_textures;
-
-        void parse_parameters();
-        void parse_semantics(std::vector<std::string> textures);
+        friend struct DMAT;
+        std::span<const Parameter> parameters_;
+        std::span<const MaterialTexture> textures_;
+        std::span<const std::string_view> texture_names_;
     };
 }
\ No newline at end of file
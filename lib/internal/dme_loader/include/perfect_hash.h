@@ -0,0 +1,37 @@
+#pragma once
+#include <array>
+#include <cstdint>
+
+// Lookup side of the hash-and-displace tables generated by script/hashgen.py.
+// Keys are already Jenkins hashes; each key's bucket selects a seed that
+// places it in its own slot, so a lookup is two mixes and one compare.
+namespace warpgate::perfect_hash {
+    // murmur3 finalizer. Must match mix() in script/hashgen.py
+    constexpr uint32_t mix(uint32_t key, uint32_t seed) {
+        key ^= seed;
+        key ^= key >> 16;
+        key *= 0x85ebca6bu;
+        key ^= key >> 13;
+        key *= 0xc2b2ae35u;
+        key ^= key >> 16;
+        return key;
+    }
+
+    template <typename Value>
+    struct Entry {
+        uint32_t key;
+        Value value;
+    };
+
+    template <typename Value, size_t Buckets, size_t Slots>
+    struct Table {
+        std::array<uint32_t, Buckets> seeds;
+        std::array<Entry<Value>, Slots> entries;
+
+        constexpr const Entry<Value> *find(uint32_t key) const {
+            uint32_t seed = seeds[mix(key, 0) % Buckets];
+            const Entry<Value> &entry = entries[mix(key, seed) % Slots];
+            return entry.key == key ? &entry : nullptr;
+        }
+    };
+}
@@ -1,11 +1,18 @@
 #pragma once
 #include <cstdint>
 #include <optional>
-#include <string>
-#include <unordered_map>
+#include <span>
+#include <string_view>
 
+#include "perfect_hash.h"
+
+// Lookups are backed by constexpr tables generated by script/hashgen.py
 namespace warpgate::utils {
-    extern std::unordered_map<uint32_t, std::string> bone_hashmap;
-    extern std::unordered_map<uint32_t, uint32_t> bone_hierarchy;
-    extern std::unordered_map<std::string, std::string> rigify_names;
-}
\ No newline at end of file
+    std::optional<std::string_view> bone_name(uint32_t namehash);
+    // Reverse lookup, only succeeds for names in the bone table
+    std::optional<uint32_t> bone_namehash(std::string_view name);
+    // Parent namehash of the bone, or 0 for roots
+    std::optional<uint32_t> bone_parent(uint32_t namehash);
+    std::optional<std::string_view> rigify_name(uint32_t namehash);
+    std::span<const perfect_hash::Entry<std::string_view>> bone_names();
+}
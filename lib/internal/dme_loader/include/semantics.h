@@ -1,7 +1,8 @@
 #pragma once
 // Autogenerated from Planetside 2 .dx11efb shader files. Definitely not 100% accurate, but it should cover most things
+// Generated by script/hashgen.py from script/hash_tables.json. Do not edit by hand.
 
-#include <string>
+#include <string_view>
 
 namespace warpgate {
     enum class Semantic : unsigned {
@@ -1954,7 +1955,6 @@ namespace warpgate {
         detailBlendTexture4 = 0xF8A50428,
         detailBlendTexture5 = 0x29CFE67D,
         detailBump = 0xF882E64B,
-        
         detailMaskTexture = 0x685395EF,
         detailMaskUsageOrder = 0x57FC1464,
         detailScale = 0x13525EF9,
@@ -3034,5 +3034,6 @@ namespace warpgate {
         UNKNOWN = 0x00000000
     };
 
-    std::string semantic_name(Semantic semantic);
-}
\ No newline at end of file
+    // Returns "Unknown" for semantics not in the table
+    std::string_view semantic_name(Semantic semantic);
+}
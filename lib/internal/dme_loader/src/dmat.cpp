@@ -1,6 +1,10 @@
 #include "dmat.h"
+#include "jenkins.h"
+
+#include <algorithm>
 #include <spdlog/spdlog.h>
 
+namespace logger = spdlog;
 using namespace warpgate;
 
 DMAT::DMAT(std::span<uint8_t> subspan): buf_(subspan) {
@@ -24,7 +28,7 @@ std::span<uint8_t> DMAT::texturename_data() const {
     return buf_.subspan(12, filenames_length());
 }
 
-const std::vector<std::string> DMAT::textures() const {
+std::span<const std::string_view> DMAT::textures() const {
     return texture_names;
 }
 
@@ -36,28 +40,96 @@ DMAT::ref<uint32_t> DMAT::material_count() const {
     return get<uint32_t>(material_offset());
 }
 
-std::shared_ptr<const Material> DMAT::material(uint32_t index) const {
-    return materials.at(index);
+const Material *DMAT::material(uint32_t index) const {
+    return &materials.at(index);
 }
 
 void DMAT::parse_filenames() {
-    std::span<uint8_t> filenames = texturename_data();
-    for(
-        std::string filename = std::string((char*)filenames.data()); 
-        !filenames.empty(); 
-        filenames = filenames.subspan(filename.size() + 1), filename = std::string((char*)filenames.data())
-    ) {
-        texture_names.push_back(filename);
+    std::span<uint8_t> filenames_data = texturename_data();
+    std::string_view filenames((char*)filenames_data.data(), filenames_data.size());
+    texture_names.reserve(std::count(filenames.begin(), filenames.end(), '\0'));
+    while(!filenames.empty()) {
+        size_t length = std::min(filenames.find('\0'), filenames.size());
+        texture_names.push_back(filenames.substr(0, length));
+        filenames.remove_prefix(std::min(length + 1, filenames.size()));
+    }
+
+    // Texture parameters reference textures by the hash of their uppercased name.
+    // Sorted by hash, with the last texture of a given hash winning lookups.
+    std::vector<uint32_t> hashes(texture_names.size());
+    jenkins::oaat_upper(texture_names, hashes);
+    texture_hashes.reserve(texture_names.size());
+    for(uint32_t i = 0; i < texture_names.size(); i++) {
+        texture_hashes.push_back({hashes[i], i});
+    }
+    std::stable_sort(texture_hashes.begin(), texture_hashes.end(), [](const auto &lhs, const auto &rhs) {
+        return lhs.first < rhs.first;
+    });
+}
+
+std::optional<uint32_t> DMAT::find_texture(uint32_t namehash) const {
+    auto value = std::upper_bound(texture_hashes.begin(), texture_hashes.end(), namehash, [](uint32_t hash, const auto &entry) {
+        return hash < entry.first;
+    });
+    if(value == texture_hashes.begin() || (--value)->first != namehash) {
+        return {};
+    }
+    return value->second;
+}
+
+std::optional<std::string_view> DMAT::texture(uint32_t namehash) const {
+    std::optional<uint32_t> index = find_texture(namehash);
+    if(!index) {
+        return {};
     }
+    return texture_names[*index];
 }
 
 void DMAT::parse_materials() {
     materials_size = 0;
     uint32_t material_count = this->material_count();
-    spdlog::debug("Parsing {} material{}", material_count, material_count != 1 ? "s" : "");
-    for(size_t i = 0; i < material_count; i++) {
-        std::shared_ptr<Material> material = std::make_shared<Material>(buf_.subspan(material_offset() + 4 + materials_size), texture_names);
-        materials.push_back(material);
-        materials_size += material->size();
+    logger::debug("Parsing {} material{}", material_count, material_count != 1 ? "s" : "");
+
+    struct Ranges {
+        size_t first_parameter, parameter_count, first_texture, texture_count;
+    };
+    std::vector<Ranges> ranges;
+    ranges.reserve(material_count);
+    materials.reserve(material_count);
+
+    for(uint32_t i = 0; i < material_count; i++) {
+        Material &material = materials.emplace_back(buf_.subspan(material_offset() + 4 + materials_size));
+        materials_size += material.size();
+
+        Ranges range = {parameters.size(), material.param_count(), material_textures.size(), 0};
+        uint32_t offset = 0;
+        for(uint32_t j = 0; j < range.parameter_count; j++) {
+            const Parameter &parameter = parameters.emplace_back(material.buf_.subspan(16 + offset));
+            offset += (uint32_t)parameter.size();
+
+            if(parameter.type() != Parameter::D3DXParamType::TEXTURE) {
+                continue;
+            }
+            std::optional<uint32_t> texture_index = find_texture(parameter.get<uint32_t>(16));
+            if(!texture_index) {
+                continue;
+            }
+            material_textures.push_back({(int32_t)(Semantic)parameter.semantic_hash(), *texture_index});
+            std::string_view name = semantic_name(parameter.semantic_hash());
+            if(name == "Unknown") {
+                logger::info("Semantic {:#010x} = '{}'", (uint32_t)(Semantic)parameter.semantic_hash(), texture_names[*texture_index]);
+            }
+        }
+        range.texture_count = material_textures.size() - range.first_texture;
+        ranges.push_back(range);
+    }
+
+    // The arenas are complete, so views into them will no longer be invalidated
+    std::span<const Parameter> parameter_arena = parameters;
+    std::span<const MaterialTexture> texture_arena = material_textures;
+    for(uint32_t i = 0; i < material_count; i++) {
+        materials[i].parameters_ = parameter_arena.subspan(ranges[i].first_parameter, ranges[i].parameter_count);
+        materials[i].textures_ = texture_arena.subspan(ranges[i].first_texture, ranges[i].texture_count);
+        materials[i].texture_names_ = texture_names;
     }
-}
\ No newline at end of file
+}
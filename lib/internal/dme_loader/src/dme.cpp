@@ -28,10 +28,10 @@ void DME::parse_dmat() {
 void DME::parse_meshes() {
     uint32_t mesh_count = this->mesh_count();
     meshes_size = 0;
+    meshes.reserve(mesh_count);
     for(uint32_t i = 0; i < mesh_count; i++) {
-        auto mesh = std::make_shared<Mesh>(buf_.subspan(meshes_offset() + 4 + meshes_size));
-        meshes_size += mesh->size();
-        meshes.push_back(mesh);
+        const Mesh &mesh = meshes.emplace_back(buf_.subspan(meshes_offset() + 4 + meshes_size));
+        meshes_size += mesh.size();
     }
     spdlog::debug("Loaded {} mesh{}", meshes.size(), meshes.size() != 1 ? "es" : "");
 }
@@ -82,8 +82,8 @@ DME::ref<uint32_t> DME::mesh_count() const {
     return get<uint32_t>(meshes_offset());
 }
 
-std::shared_ptr<const Mesh> DME::mesh(uint32_t index) const {
-    return meshes.at(index);
+const Mesh *DME::mesh(uint32_t index) const {
+    return &meshes.at(index);
 }
 
 uint32_t DME::drawcall_offset() const {
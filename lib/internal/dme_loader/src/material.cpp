@@ -1,52 +1,9 @@
 #include "material.h"
-#include "jenkins.h"
-#include "utils.h"
 
-#include <spdlog/spdlog.h>
-
-namespace logger = spdlog;
 using namespace warpgate;
 
 Material::Material(std::span<uint8_t> subspan): buf_(subspan) {
     buf_ = buf_.first(length() + 8);
-    parse_parameters();
-}
-
-Material::Material(std::span<uint8_t> subspan, std::vector<std::string> textures): buf_(subspan) {
-    buf_ = buf_.first(length() + 8);
-    parse_parameters();
-    parse_semantics(textures);
-}
-
-void Material::parse_parameters() {
-    uint32_t count = param_count();
-    uint32_t offset = 0;
-    for(uint32_t i = 0; i < count; i++) {
-        Parameter p(buf_.subspan(16 + offset));
-        offset += (uint32_t)p.size();
-        parameters.push_back(p);
-    }
-}
-
-void Material::parse_semantics(std::vector<std::string> textures) {
-    logger::debug("Parsing semantics");
-    std::unordered_map<uint32_t, std::string> hash_to_names;
-    for(std::string texture : textures) {
-        std::string upper = utils::uppercase(texture);
-        uint32_t namehash = jenkins::oaat(upper);
-        hash_to_names[namehash] = texture;
-    }
-
-    for(Parameter p : parameters) {
-        std::unordered_map<uint32_t, std::string>::iterator value;
-        if(p.type() == Parameter::D3DXParamType::TEXTURE && (value = hash_to_names.find(p.get<uint32_t>(16))) != hash_to_names.end()) {
-            semantic_textures[(uint32_t)(Semantic)p.semantic_hash()] = value->second;
-            std::string name = semantic_name(p.semantic_hash());
-            if(name.find("Unknown") != std::string::npos) {
-                logger::info("Semantic '{}' = '{}'", name, value->second);
-            }
-        }
-    }
 }
 
 Material::ref<uint32_t> Material::namehash() const {
@@ -66,17 +23,30 @@ Material::ref<uint32_t> Material::param_count() const {
 }
 
 Parameter Material::parameter(uint32_t index) const {
-    return parameters.at(index);
+    if(index >= parameters_.size()) {
+        throw std::out_of_range("Material: Parameter index out of range");
+    }
+    return parameters_[index];
+}
+
+std::span<const Parameter> Material::parameters() const {
+    return parameters_;
+}
+
+std::span<const MaterialTexture> Material::texture_bindings() const {
+    return textures_;
 }
 
 std::optional<std::string> Material::texture(int32_t semantic) const {
-    auto value = semantic_textures.find(semantic);
-    if(value != semantic_textures.end()) {
-        return value->second;
+    // Later bindings of the same semantic take precedence
+    for(auto it = textures_.rbegin(); it != textures_.rend(); it++) {
+        if(it->semantic == semantic) {
+            return std::string(texture_names_[it->texture_index]);
+        }
     }
     return {};
 }
 
 std::optional<std::string> Material::texture(Semantic semantic) const {
     return texture((int32_t)semantic);
-}
\ No newline at end of file
+}
@@ -1,2770 +1,2898 @@
+// Generated by script/hashgen.py from script/hash_tables.json. Do not edit by hand.
 #include "ps2_bone_map.h"
+#include "jenkins.h"
 
 using namespace warpgate;
 
-std::unordered_map<uint32_t, std::string> utils::bone_hashmap = {
-    {4099058003u, "ACTION"},
-    {2859017764u, "ACTION1"},
-    {4043274857u, "ACTION10"},
-    {3812941556u, "ACTION11"},
-    {3440751254u, "ACTION12"},
-    {3200259563u, "ACTION13"},
-    {671803519u, "ACTION14"},
-    {440159458u, "ACTION15"},
-    {196063177u, "ACTION16"},
-    {4110254693u, "ACTION17"},
-    {2770017160u, "ACTION2"},
-    {3474386815u, "ACTION3"},
-    {3080831125u, "ACTION4"},
-    {23516190u, "ACTION5"},
-    {3696658942u, "ACTION6"},
-    {638623093u, "ACTION7"},
-    {350780193u, "ACTION8"},
-    {1049972350u, "ACTION9"},
-    {2402683191u, "ACTIONLOWER"},
-    {959125743u, "ACTIONLOWERRAIL"},
-    {2434127015u, "ACTIONRAIL"},
-    {3001437478u, "ACTIONSPIN"},
-    {1951460982u, "ACTIONUPPER"},
-    {333254182u, "ACTIONUPPERFRONT"},
-    {3900869694u, "ACTIONUPPERMID"},
-    {1370311378u, "ACTIVE"},
-    {1928556915u, "AMMO0"},
-    {2904122814u, "AMMO1"},
-    {2059895067u, "AMMO2"},
-    {1200954035u, "AMMO3"},
-    {2641020513u, "AMMO4"},
-    {4092785520u, "AMMO5"},
-    {3366755556u, "AMMO6"},
-    {3974794655u, "ANTENNA"},
-    {782497864u, "ANTENNABASE"},
-    {1305566302u, "ANTENNABASE1"},
-    {1064320924u, "ANTENNABASE2"},
-    {1212698968u, "ANTENNABASE3"},
-    {665543504u, "ANTENNATOP"},
-    {469708367u, "ARM1"},
-    {156469500u, "ARM2"},
-    {452865105u, "ARM3"},
-    {630800775u, "ARM4"},
-    {931849578u, "ARM5"},
-    {3305278863u, "ARMPITCH"},
-    {620852943u, "ARMYAW"},
-    {3487385081u, "AXLEBACK"},
-    {1023887647u, "AXLEFRONT"},
-    {3456699527u, "BACKBOTTOMSHOCKMOUNT"},
-    {984764821u, "BACKCORE"},
-    {1769025762u, "BACKEND"},
-    {3474656460u, "BACKLEAF"},
-    {3459832652u, "BACKPITCH"},
-    {1406579442u, "BACKRAIL"},
-    {3740866747u, "BACKSIDES"},
-    {1387663844u, "BACKSTABILIZER"},
-    {1757292079u, "BACKTOPSHOCKMOUNT"},
-    {3161250124u, "BACKYAW"},
-    {4085355481u, "BARREL"},
-    {2350413876u, "BARREL01"},
-    {2060146074u, "BARREL02"},
-    {3955064620u, "BARREL1"},
-    {4023945082u, "BARREL2"},
-    {957582291u, "BARREL2_L"},
-    {3175847069u, "BARREL2_R"},
-    {25668312u, "BARREL3"},
-    {1216461011u, "BARREL4"},
-    {4287572056u, "BARRELBOTTOMLEFT"},
-    {3576657972u, "BARRELBOTTOMRIGHT"},
-    {1891856710u, "BARRELRECOIL1"},
-    {1676007307u, "BARRELRECOIL2"},
-    {1294838299u, "BARRELRECOIL3"},
-    {1011550294u, "BARRELRECOIL4"},
-    {3950623792u, "BARRELROTATION"},
-    {538760882u, "BARRELTOPLEFT"},
-    {938704599u, "BARRELTOPRIGHT"},
-    {388916045u, "BARREL_L"},
-    {22427549u, "BARREL_R"},
-    {1580348024u, "BARREL_SOCKET"},
-    {3447049761u, "BASE"},
-    {1697942313u, "BASEOFFSET"},
-    {391037130u, "BATTERYCHAMBER"},
-    {1456985596u, "BATTERYCHAMBERPIN"},
-    {3905215779u, "BATTERYSOCKET"},
-    {3690950000u, "BHULL"},
-    {1027681439u, "BLADEBASE"},
-    {1368062130u, "BLADEMID"},
-    {3852402044u, "BLADETIP"},
-    {1513773997u, "BOTTOMFRONTLEGBASE"},
-    {3055013529u, "BOTTOMFRONTLEGHINGE"},
-    {2348369865u, "BOTTOMRAIL_SOCKET"},
-    {2403210655u, "BOTTOMREARENGINEFLAPA"},
-    {2625089554u, "BOTTOMREARENGINEFLAPB"},
-    {4075248884u, "BOTTOMREARENGINEFLAPC"},
-    {69861241u, "BOTTOMREARENGINEFLAPD"},
-    {3357902705u, "BOTTOMREARENGINEFLAPE"},
-    {3593675660u, "BOTTOMREARENGINEFLAPF"},
-    {729468442u, "BOTTOMREARENGINEFLAPG"},
-    {967928455u, "BOTTOMREARENGINEFLAPH"},
-    {1924703517u, "BOTTOM_DISC"},
-    {1832843225u, "BOX.025"},
-    {2896946475u, "BRAKE"},
-    {3945343256u, "BUCKLE"},
-    {3685814955u, "BULLET"},
-    {537716927u, "BULLET1"},
-    {223470684u, "BULLET10"},
-    {3079616728u, "BULLET11"},
-    {3970212610u, "BULLET12"},
-    {4278077365u, "BULLET13"},
-    {1646726677u, "BULLET14"},
-    {1886890678u, "BULLET15"},
-    {3298513648u, "BULLET16"},
-    {3595761247u, "BULLET17"},
-    {928233583u, "BULLET18"},
-    {1168299277u, "BULLET19"},
-    {2977401802u, "BULLET2"},
-    {2618851531u, "BULLET20"},
-    {2915443750u, "BULLET21"},
-    {3197937172u, "BULLET3"},
-    {3436921489u, "BULLET4"},
-    {3928456489u, "BULLET5"},
-    {2020612540u, "BULLET6"},
-    {2307111907u, "BULLET7"},
-    {2479214695u, "BULLET8"},
-    {2770105108u, "BULLET9"},
-    {706207068u, "BUMPER"},
-    {2128246719u, "BUTTON"},
-    {1579452288u, "B_ANKLE"},
-    {3351494366u, "B_FOOT"},
-    {1916267784u, "B_FOOT_INSIDETOES"},
-    {3234753418u, "B_FOOT_INSIDETOES_END"},
-    {3188746918u, "B_FOOT_OUTSIDETOES"},
-    {2799343175u, "B_FOOT_OUTSIDETOES_END"},
-    {3570374500u, "B_FOOT_SPIKES"},
-    {312972756u, "B_FOOT_SPIKES_END"},
-    {2881046729u, "B_LEG"},
-    {718505439u, "B_LEG_PISTON"},
-    {3092136803u, "CAMERA"},
-    {752986672u, "CAMERA1_SOCKET"},
-    {1775047925u, "CAMERARECOIL"},
-    {3169208690u, "CANNON_HOOD"},
-    {3107862979u, "CANNON_HOOD_END"},
-    {3978902171u, "CARTRIDGE"},
-    {1423048752u, "CHAIN01"},
-    {3028336524u, "CHAIN02"},
-    {3258407673u, "CHAIN03"},
-    {257357155u, "CHAIN04"},
-    {2646446598u, "CHAIN05"},
-    {4117152087u, "CHAIN06"},
-    {187755755u, "CHAIN07"},
-    {3798211410u, "CHAIN08"},
-    {3903399900u, "CHAIN09"},
-    {3054322045u, "CHAIN10"},
-    {3429527095u, "CHAIN11"},
-    {1645615504u, "CHAIN12"},
-    {1742480668u, "CHAIN13"},
-    {3034038038u, "CHAIN14"},
-    {45996765u, "CHAIN15"},
-    {3115305158u, "CHAIN16"},
-    {2670171062u, "CHAIN17"},
-    {4084711100u, "CHAMBERASSIST"},
-    {2774357102u, "CHARACTERWORLDSPACETM"},
-    {878528594u, "CHARGE3QUARTER"},
-    {3034731402u, "CHARGEEMPTY"},
-    {1858661785u, "CHARGEFULL"},
-    {3653275918u, "CHARGEHALF"},
-    {1214637520u, "CHARGINGHANDLE"},
-    {2991756863u, "CLIP"},
-    {3090389870u, "CLIPBOLT"},
-    {1043307679u, "CLIPBOLT2"},
-    {3245646627u, "CLIPBOLT3"},
-    {3551938470u, "CLIPBOLT4"},
-    {3852823428u, "CLIPBOLT5"},
-    {1109437397u, "CLIPRELEASE"},
-    {2636646231u, "CLIP_RELEASE"},
-    {1139812841u, "CLIP_SOCKET"},
-    {1442972739u, "CLUTCH"},
-    {567791785u, "COG"},
-    {84634380u, "COGPARENT"},
-    {2811192773u, "COMMON_DPO_PLACEABLES_DOMESHIELDEMITTER001"},
-    {2781236066u, "COMMON_DPO_PLACEABLES_MODULE_DESTROYED_COL"},
-    {1804676446u, "COMMON_DPO_PLACEABLES_MODULE_DESTROYED_LOD0"},
-    {283172278u, "COMMON_DPO_PLACEABLES_MODULE_LOD0"},
-    {1504464692u, "COMMON_DPO_PLACEABLES_REINFORCEMENTMOD"},
-    {2815084884u, "COMMON_DPO_PLACEABLES_REINFORCEMENTMOD_COL"},
-    {3342510743u, "COMMON_DPO_PLACEABLE_IONCANNON"},
-    {2672750597u, "COMMON_PROPS_AMPWATERTANKS_WATERPUMP"},
-    {3200203840u, "COMMON_PROPS_GAMEPLAYOBJECTS_AMMODEPOT"},
-    {3905809930u, "COMMON_PROPS_IFFDOOR_ANIMATED"},
-    {1755079925u, "COMMON_PROPS_SNAPONS_CONTROL_COMM_ROOF"},
-    {3648912357u, "COMMON_STRUCTURES_BOXOFDESTINY_BLASTDOORS01"},
-    {1521744347u, "COMMON_STRUCTURES_FACILITYAMPSTATION_SPIRE"},
-    {3343699791u, "COMMON_STRUCTURES_TEMPESTTOWER"},
-    {4016783380u, "COMPRESSION"},
-    {2291122455u, "COVER"},
-    {2178391894u, "C_FRONTGEAR1"},
-    {2990211100u, "C_FRONTGEAR2"},
-    {2380238797u, "C_FRONTGEARDOOR1"},
-    {1465590465u, "C_FRONTGEARDOOR2"},
-    {3167037877u, "DEPLOYFRONT1"},
-    {2852062249u, "DEPLOYFRONT2"},
-    {3761303692u, "DEPLOYFRONT3"},
-    {1554697778u, "DEPLOYFRONTCOVER"},
-    {1133810461u, "DISPLAY"},
-    {3305972769u, "DOOR"},
-    {2080389955u, "DRUM"},
-    {3296973358u, "DRUMHANDLE"},
-    {2443285297u, "DYNAMICDRING"},
-    {1242568825u, "EAST"},
-    {578449394u, "EASTARM"},
-    {1839578142u, "EASTJOINT"},
-    {2871434844u, "EASTPANEL"},
-    {3004123225u, "EJECT"},
-    {4014393635u, "EJECT01"},
-    {2688920358u, "EJECT02"},
-    {2366379834u, "EJECT1"},
-    {2662939284u, "EJECT2"},
-    {4266326091u, "EJECTIONPORT"},
-    {2058541621u, "EJECTION_PORT_COVER"},
-    {407354688u, "ELBOWHINDGE01"},
-    {2891900272u, "ELBOWHINDGE02"},
-    {2586132733u, "ELBOWHINDGE03"},
-    {3487870079u, "ELBOWHINDGE04"},
-    {1550770966u, "ELEVATOR"},
-    {1001341975u, "EMISSIVE"},
-    {2522939977u, "END_L_BACK_CANNISTER01"},
-    {54123589u, "END_L_BACK_CANNISTER02"},
-    {70005902u, "END_L_TOP_BOX01"},
-    {4074672627u, "END_L_TOP_BOX02"},
-    {536013851u, "END_L_TOP_BOX03"},
-    {238045334u, "END_L_TOP_BOX04"},
-    {147198502u, "END_L_TOP_CANNISTER01"},
-    {3536201255u, "END_L_TOP_CANNISTER02"},
-    {3982187345u, "END_L_TOP_CANNISTER03"},
-    {1415769934u, "END_R_BACK_CANNISTER01"},
-    {1041482416u, "END_R_BACK_CANNISTER02"},
-    {3941239263u, "END_R_TOP_BOX01"},
-    {4230163536u, "END_R_TOP_BOX02"},
-    {2092477833u, "END_R_TOP_BOX03"},
-    {3466416465u, "END_R_TOP_BOX04"},
-    {3834003294u, "END_R_TOP_CANNISTER01"},
-    {3535838163u, "END_R_TOP_CANNISTER02"},
-    {3068421111u, "END_R_TOP_CANNISTER03"},
-    {300486179u, "FAN1"},
-    {461250893u, "FAN2"},
-    {2870084370u, "FIREMODE"},
-    {2291558667u, "FOREARM1"},
-    {450760092u, "FOREARM2"},
-    {789657090u, "FOREARM3"},
-    {530749217u, "FOREARM4"},
-    {827898509u, "FOREARM5"},
-    {2421277503u, "FOREWARDGRIP"},
-    {4258810157u, "FORWARDFLAP"},
-    {3570825082u, "FORWARDGRIP_SOCKET"},
-    {671758044u, "FPMALE"},
-    {2377346750u, "FRONTACTION"},
-    {4154229687u, "FRONTAXLE"},
-    {1907517712u, "FRONTBOTTOMSHOCKMOUNT"},
-    {1850534173u, "FRONTCENTERSPININNER"},
-    {4181793464u, "FRONTCENTERSPINOUTER"},
-    {2027020606u, "FRONTCHASSIS"},
-    {529246599u, "FRONTGEAR1"},
-    {1298007339u, "FRONTGEAR2"},
-    {1604790749u, "FRONTGEARA"},
-    {1826440265u, "FRONTGEARB"},
-    {2065424582u, "FRONTGEARC"},
-    {3200180919u, "FRONTGEARDOOR"},
-    {1674585019u, "FRONTGEARSUPPORT"},
-    {1387893526u, "FRONTLEAF"},
-    {2696709208u, "FRONTPITCH"},
-    {520663189u, "FRONTRAIL"},
-    {2059202853u, "FRONTSLIDE"},
-    {2895421296u, "FRONTSTABILIZER"},
-    {1294189023u, "FRONTSUPPORT1"},
-    {1659759987u, "FRONTSUPPORT2"},
-    {4036987088u, "FRONTSUPPORT3"},
-    {135706558u, "FRONTSUPPORT4"},
-    {370955209u, "FRONTSUPPORT5"},
-    {1949356297u, "FRONTTOPSHOCKMOUNT"},
-    {2566866105u, "FRONTYAW"},
-    {4102920736u, "FX"},
-    {2094551816u, "F_ANKLE"},
-    {3651587072u, "F_FOOT"},
-    {3297912606u, "F_FOOT_INSIDETOES"},
-    {796974426u, "F_FOOT_INSIDETOES_END"},
-    {2145353959u, "F_FOOT_OUTSIDETOES"},
-    {3468960995u, "F_FOOT_OUTSIDETOES_END"},
-    {1186180439u, "F_FOOT_SPIKES"},
-    {3426233346u, "F_FOOT_SPIKES_END"},
-    {4011219873u, "F_LEG"},
-    {764938613u, "F_LEG_PISTON"},
-    {843792386u, "GEARBACK"},
-    {749578352u, "GEARFRONT"},
-    {3421923095u, "GRIP"},
-    {3261119595u, "GROUP1"},
-    {2939065863u, "GROUP2"},
-    {3255643496u, "HAMMER"},
-    {4243056212u, "HANDLE"},
-    {1845483130u, "HANDLEBARS"},
-    {1600924819u, "HANDLEBARS_L"},
-    {385588147u, "HANDLEBARS_R"},
-    {2126722038u, "HARDPOINT1"},
-    {2424428403u, "HARDPOINT2"},
-    {868153471u, "HARDPOINT2_SOCKET"},
-    {2604657903u, "HARDPOINT3"},
-    {620167259u, "HARDPOINT4"},
-    {768381414u, "HARDPOINT5"},
-    {898299046u, "HEAD"},
-    {2050050574u, "HEADING"},
-    {233509630u, "HEAD_END"},
-    {2100923523u, "HEAVY_SOLDIER_ANIMATED"},
-    {3271536277u, "HINGE"},
-    {2612768833u, "HINGE1"},
-    {228672864u, "HINGE1A"},
-    {3204491284u, "HINGE1B"},
-    {3454518758u, "HINGE1C"},
-    {2382959836u, "HINGE2"},
-    {2960552844u, "HINGE2A"},
-    {3402016812u, "HINGE2B"},
-    {2734381146u, "HINGE2C"},
-    {819550842u, "HINGE3"},
-    {2703085271u, "HINGE3A"},
-    {1920496009u, "HINGE3B"},
-    {1146262846u, "HINGE3C"},
-    {2561181064u, "HOODVENTS"},
-    {3361048860u, "HOSE1A"},
-    {3742348944u, "HOSE1B"},
-    {3431993741u, "HOSE1C"},
-    {786159239u, "HOSE2A"},
-    {1008562442u, "HOSE2B"},
-    {326115248u, "HOSE2C"},
-    {457158179u, "HOSE3A"},
-    {183635336u, "HOSE3B"},
-    {2948224794u, "HOSE3C"},
-    {3693594453u, "HYDROLICFRONTBOTTOM"},
-    {564569974u, "HYDROLICFRONTTOP"},
-    {2607943079u, "HYDROLICREARBOTTOM"},
-    {2816061702u, "HYDROLICREARTOP"},
-    {3155017161u, "INDAR_PROPS_VENTS_FANLARGEDOUBLE"},
-    {2007480715u, "INDAR_PROPS_VENTS_FANLARGESINGLE"},
-    {499401726u, "INTERNALBULLETS"},
-    {3992122647u, "IRONSIGHTBACK_SOCKET"},
-    {2838394204u, "IRONSIGHTFRONT_SOCKET"},
-    {1372798831u, "JOINT1"},
-    {3613873764u, "JOINT10"},
-    {3854168841u, "JOINT11"},
-    {2081169327u, "JOINT12"},
-    {2285221890u, "JOINT13"},
-    {243188882u, "JOINT14"},
-    {483746111u, "JOINT15"},
-    {3004272057u, "JOINT16"},
-    {3345004119u, "JOINT17"},
-    {2789536792u, "JOINT18"},
-    {2552977381u, "JOINT19"},
-    {2749883295u, "JOINT2"},
-    {3380132775u, "JOINT20"},
-    {2938406655u, "JOINT21"},
-    {483058250u, "JOINT22"},
-    {312462836u, "JOINT23"},
-    {2407057340u, "JOINT24"},
-    {2111186039u, "JOINT25"},
-    {1962739146u, "JOINT3"},
-    {2254186632u, "JOINT4"},
-    {3645328989u, "JOINT5"},
-    {3960042465u, "JOINT6"},
-    {3135934884u, "JOINT7"},
-    {3434624319u, "JOINT8"},
-    {3270812084u, "JOINT9"},
-    {2210481234u, "LARGEBARREL"},
-    {1856204695u, "LARGEBLADE"},
-    {3423179401u, "LEFTCHAMBERHATCH"},
-    {3192222837u, "LEFT_BELT001"},
-    {1852067476u, "LEFT_BELT0010"},
-    {1103754588u, "LEFT_BELT0011"},
-    {1339986313u, "LEFT_BELT0012"},
-    {1347590289u, "LEFT_BELT002"},
-    {2151118934u, "LEFT_BELT003"},
-    {319233523u, "LEFT_BELT004"},
-    {628441807u, "LEFT_BELT005"},
-    {925820482u, "LEFT_BELT006"},
-    {3341780549u, "LEFT_BELT007"},
-    {3656494025u, "LEFT_BELT008"},
-    {3966357689u, "LEFT_BELT009"},
-    {1739425286u, "LEFT_BUTTON01"},
-    {3190207227u, "LEFT_BUTTON02"},
-    {3559972623u, "LEFT_BUTTON03"},
-    {2338442610u, "LEFT_BUTTON04"},
-    {1973133798u, "LEFT_BUTTON05"},
-    {2724988498u, "LEFT_FLAP"},
-    {421078535u, "LHULL"},
-    {338607862u, "LOADACTION"},
-    {2666078040u, "LOADACTION2"},
-    {2828022438u, "LOADACTION3"},
-    {325645639u, "LOWERDOOR1"},
-    {609720100u, "LOWERDOOR2"},
-    {773499562u, "LOWERDOOR3"},
-    {1055149117u, "LOWERDOOR4"},
-    {3831875288u, "LOWERVENTS"},
-    {3270595576u, "LPOWERNODE"},
-    {2525539168u, "L_ANKLE"},
-    {2503452994u, "L_ARM"},
-    {811860561u, "L_ARMCOMPONENTS"},
-    {4272014876u, "L_BACKDRING"},
-    {209846800u, "L_BACKPLATE"},
-    {4019161365u, "L_BACKSHOCKA"},
-    {1175513397u, "L_BACKSHOCKA_TOP"},
-    {1885538994u, "L_BACKSHOCKB"},
-    {3920753945u, "L_BACKSHOCKB_TOP"},
-    {535552533u, "L_BACKSIDESTABILIZER"},
-    {4146244031u, "L_BACKSTABILIZER"},
-    {977508624u, "L_BACK_CANNISTER01"},
-    {1259551407u, "L_BACK_CANNISTER02"},
-    {1142326112u, "L_BALL"},
-    {1680733055u, "L_BARREL"},
-    {3065573393u, "L_BARRELFRONT_EXTEND"},
-    {2835073054u, "L_BARRELRECOILLOWER"},
-    {2044676802u, "L_BARRELRECOILUPPER"},
-    {2359474964u, "L_BARRELROTATION"},
-    {1097825139u, "L_BARRELROTATIONLOWER"},
-    {2802826641u, "L_BARRELROTATIONUPPER"},
-    {3617764011u, "L_BARRELSIDELAYER1"},
-    {353047735u, "L_BARRELSIDELAYER1_END"},
-    {2841302556u, "L_BARRELSIDELAYER2"},
-    {1344053016u, "L_BARRELSIDE_EXTEND"},
-    {713393451u, "L_BOTTOMBARREL"},
-    {1336973505u, "L_BOTTOMCANISTER"},
-    {2959853441u, "L_BOTTOMHOUSING"},
-    {1732937360u, "L_BOTTOMSHOCKMOUNT"},
-    {1635267284u, "L_BOTTOMTUBE"},
-    {1004900499u, "L_BOTTOMVENTS"},
-    {1272116621u, "L_BOTTONREARLEGBASE"},
-    {1947478600u, "L_BOTTONREARLEGHINGE"},
-    {4217541411u, "L_CLAVICLE"},
-    {215562287u, "L_CYLINDERDN"},
-    {4096234345u, "L_CYLINDEREXTEND_END"},
-    {4176684248u, "L_CYLINDEREXTEND_END1"},
-    {4119076029u, "L_CYLINDERUP"},
-    {1673327505u, "L_DEPLOY_MECANISM"},
-    {279687920u, "L_DEPLOY_MECANISM_END"},
-    {2266553668u, "L_ELBOW"},
-    {4089981509u, "L_ENGINESHIELD"},
-    {3387633284u, "L_ENGINEVENTFLAPA"},
-    {3024421688u, "L_ENGINEVENTFLAPB"},
-    {4262467277u, "L_ENGINEVENTFLAPC"},
-    {399592015u, "L_ENGINEVENTFLAPD"},
-    {2460336122u, "L_ENGINEVENTFLAPE"},
-    {2086900598u, "L_ENGINEVENTFLAPF"},
-    {3846497591u, "L_ENGINEVENTFLAPG"},
-    {2982628385u, "L_FAN"},
-    {1368413764u, "L_FLAP"},
-    {1063630551u, "L_FLAPPER"},
-    {3563932260u, "L_FOOT"},
-    {640072513u, "L_FOOT_INSIDETOES"},
-    {1371949785u, "L_FOOT_INSIDETOES_END"},
-    {3864762204u, "L_FOOT_OUTSIDETOES"},
-    {3189639359u, "L_FOOT_OUTSIDETOES_END"},
-    {1991123356u, "L_FOOT_SPIKES"},
-    {1862987346u, "L_FOOT_SPIKES_END"},
-    {4157307685u, "L_FOREARM"},
-    {642363752u, "L_FORWARDDISK"},
-    {3340640726u, "L_FORWARDDISK2"},
-    {3281080856u, "L_FRONTAXLE"},
-    {792221549u, "L_FRONTDOOR"},
-    {4238365957u, "L_FRONTDRING"},
-    {1710092884u, "L_FRONTFLAP"},
-    {2758622649u, "L_FRONTGEAR1"},
-    {4059977918u, "L_FRONTGEAR2"},
-    {4268257682u, "L_FRONTGEAR3"},
-    {3684838406u, "L_FRONTGEAR4"},
-    {752438899u, "L_FRONTGEAR5"},
-    {2429672886u, "L_FRONTGEARDOOR1"},
-    {3195582723u, "L_FRONTGEARDOOR2"},
-    {1987186480u, "L_FRONTPANEL1"},
-    {2753555083u, "L_FRONTPANEL2"},
-    {2353688199u, "L_FRONTPLATE"},
-    {852534977u, "L_FRONTSHOCKA"},
-    {4244503350u, "L_FRONTSHOCKA_TOP"},
-    {954938090u, "L_FRONTSHOCKB"},
-    {132180299u, "L_FRONTSHOCKB_TOP"},
-    {560980432u, "L_FRONTSHOCKLOWER"},
-    {2539716309u, "L_FRONTSHOCKUPPER"},
-    {2670825306u, "L_FRONTSIDESTABILIZER"},
-    {1545632388u, "L_FRONTSTABILIZER"},
-    {20902711u, "L_FRONTSUPPORT"},
-    {221775280u, "L_FRONTSUPPORT1"},
-    {2357232699u, "L_FRONTSUPPORT2"},
-    {3205163343u, "L_FRONTSUPPORT3"},
-    {1678652251u, "L_FRONTSUPPORT4"},
-    {1330671677u, "L_FRONTSUSPENSION"},
-    {3131490264u, "L_FRONTVENT"},
-    {1843793152u, "L_FRONTWHEEL"},
-    {399140690u, "L_FRONTWHEEL_DUMMY"},
-    {428356429u, "L_GEARA"},
-    {1337696179u, "L_GEARB"},
-    {1027406518u, "L_GEARC"},
-    {1217736659u, "L_GEARDOOR"},
-    {699248667u, "L_GEARSUPPORTA"},
-    {1051777569u, "L_GEARSUPPORTB"},
-    {3621332160u, "L_HANDLE"},
-    {2431360521u, "L_HATCH_BOTTOM"},
-    {4274798758u, "L_HATCH_BOTTOM_END"},
-    {1409119795u, "L_HATCH_TOP"},
-    {1835960745u, "L_HATCH_TOP_END"},
-    {1900803227u, "L_HIP"},
-    {2413396637u, "L_HIPATTACH"},
-    {2692352206u, "L_HOSE"},
-    {198244558u, "L_INDEXA"},
-    {4212840290u, "L_INDEXB"},
-    {3930207657u, "L_INDEXC"},
-    {2209626904u, "L_INDEX_END"},
-    {1540633403u, "L_INNERFLAP"},
-    {287270140u, "L_INNERTHRUSTER"},
-    {524728837u, "L_KNEE"},
-    {890102883u, "L_KNOB_ROTATE"},
-    {3200992048u, "L_KNOB_TRANSLATE"},
-    {2345016067u, "L_LARGEDISK"},
-    {3387066931u, "L_LARGEINNERDISK"},
-    {286101867u, "L_LATCHCLIPS"},
-    {1041216236u, "L_LEG"},
-    {1749508038u, "L_LEG_PISTON"},
-    {1287964149u, "L_LOADER"},
-    {559175070u, "L_LOWERSUSPENSION"},
-    {1317099658u, "L_MAINPULLY"},
-    {3264788844u, "L_MIDAXLE"},
-    {724094749u, "L_MIDDLEA"},
-    {943876432u, "L_MIDDLEB"},
-    {3337782962u, "L_MIDDLEC"},
-    {810894083u, "L_MIDDLE_END"},
-    {3590724549u, "L_MIDPANEL1"},
-    {3950397093u, "L_MIDPANEL2"},
-    {239022231u, "L_MIDSUPPORT"},
-    {1388173060u, "L_MIDWHEEL"},
-    {2022858524u, "L_OUTERFLAP"},
-    {3971649130u, "L_OUTERTHRUSTERPANELA"},
-    {268260591u, "L_OUTERTHRUSTERPANELB"},
-    {3259152763u, "L_OUTERTHRUSTERPANELC"},
-    {3062918367u, "L_OVERHEADDOOR1"},
-    {3290761224u, "L_OVERHEADDOOR2"},
-    {1594602635u, "L_PEDAL"},
-    {3483479177u, "L_PINKYA"},
-    {127966342u, "L_PINKYB"},
-    {887355148u, "L_PINKYC"},
-    {3920976780u, "L_PINKY_END"},
-    {3660131708u, "L_PISTON"},
-    {2362924145u, "L_PITCH"},
-    {1825881561u, "L_PITCHRECOIL"},
-    {2370804950u, "L_POWERCORE"},
-    {3669183925u, "L_REARAXLE"},
-    {1732281932u, "L_REARDISK"},
-    {3365866860u, "L_REARDOOR"},
-    {1952565859u, "L_REARENGINESHIELD"},
-    {4230965472u, "L_REARFLAP"},
-    {584112430u, "L_REARGEAR1"},
-    {3709128119u, "L_REARGEAR2"},
-    {123937363u, "L_REARGEAR3"},
-    {1871409830u, "L_REARGEAR4"},
-    {100048734u, "L_REARGEARA"},
-    {3160050727u, "L_REARGEARB"},
-    {3935332498u, "L_REARGEARC"},
-    {1157169726u, "L_REARGEARDOOR"},
-    {3032317542u, "L_REARGEARDOOR1"},
-    {2208537651u, "L_REARGEARDOOR2"},
-    {1759461929u, "L_REARGEARSUPPORT"},
-    {2908721569u, "L_REARPANEL1"},
-    {178867251u, "L_REARPANEL2"},
-    {165726974u, "L_REARSHOCKLOWER"},
-    {697830620u, "L_REARSHOCKUPPER"},
-    {123143823u, "L_REARSUPPORT"},
-    {3458403359u, "L_REARSUSPENSION"},
-    {393246525u, "L_REARTHRUSTER"},
-    {714964964u, "L_REARTHRUSTER1"},
-    {4157905491u, "L_REARTHRUSTER2"},
-    {3359901234u, "L_REARTHRUSTERFLAP"},
-    {38813266u, "L_REARVENT"},
-    {561920284u, "L_REARVENTS"},
-    {3108519283u, "L_REARWHEEL"},
-    {2995209657u, "L_REARWHEELPIVOT"},
-    {4060997878u, "L_RELOADPIN"},
-    {3662356388u, "L_RINGA"},
-    {3893213993u, "L_RINGB"},
-    {2769958247u, "L_RINGC"},
-    {1143123657u, "L_RING_END"},
-    {3619289854u, "L_RUDDER"},
-    {1653896492u, "L_SHELL1"},
-    {1950455942u, "L_SHELL2"},
-    {2248424459u, "L_SHELL3"},
-    {2622220442u, "L_SHELL4"},
-    {2922679407u, "L_SHELL5"},
-    {3205137251u, "L_SHELLROTATION"},
-    {1369013194u, "L_SHIELD"},
-    {3216344818u, "L_SHIELDARM"},
-    {3516299831u, "L_SHOCKLOWER"},
-    {204057857u, "L_SHOCKUPPER"},
-    {3746558302u, "L_SHOULDER"},
-    {813763102u, "L_SHOULDERATTACH"},
-    {3771578632u, "L_SHOULDERPAD"},
-    {3291028981u, "L_SHOULDERROLL"},
-    {339389002u, "L_SIDELOCK_BACK"},
-    {2637440474u, "L_SIDELOCK_BACK_END"},
-    {1357419157u, "L_SIDELOCK_FRONT"},
-    {104272027u, "L_SIDELOCK_FRONT_END"},
-    {1766919226u, "L_SIDEVENT1"},
-    {3160257106u, "L_SIDEVENT2"},
-    {3467663095u, "L_SIDEVENT3"},
-    {117720990u, "L_SIDEVENT4"},
-    {3474194013u, "L_SMALLPULLY"},
-    {1189247508u, "L_SMOKESTACK"},
-    {831760856u, "L_SPIKEINSIDE"},
-    {2688535938u, "L_SPIKEOUTSIDE"},
-    {498450088u, "L_STABILIZER"},
-    {3509101776u, "L_STEERINGLINK"},
-    {86245637u, "L_STEERINGLINKINNER"},
-    {52112891u, "L_STEERINGLINKOUTER"},
-    {1468333525u, "L_STEERINGPIVOT"},
-    {1415649289u, "L_SUPPORT1"},
-    {3587087074u, "L_SUPPORT2"},
-    {3878501791u, "L_SUPPORT3"},
-    {4058796829u, "L_SUPPORT4"},
-    {407954794u, "L_THROTTLE"},
-    {4140843785u, "L_THRUSTER"},
-    {1400616475u, "L_THRUSTER1"},
-    {1642943230u, "L_THRUSTER2"},
-    {2099087710u, "L_THRUSTER3"},
-    {932016844u, "L_THRUSTERFLAP"},
-    {3835667144u, "L_THRUSTERFLAP1"},
-    {1706108145u, "L_THRUSTERFLAP2"},
-    {3284101644u, "L_THRUSTERPANEL"},
-    {978245741u, "L_THUMBA"},
-    {1282964672u, "L_THUMBB"},
-    {1453035782u, "L_THUMBC"},
-    {1965938483u, "L_THUMB_END"},
-    {2357602519u, "L_TOE"},
-    {3055515370u, "L_TOPBARREL"},
-    {382516222u, "L_TOPCANISTER"},
-    {430450076u, "L_TOPHOUSING"},
-    {1237210745u, "L_TOPREARLEGHINGE"},
-    {141757751u, "L_TOPSHOCKMOUNT"},
-    {2979637790u, "L_TOPTUBE"},
-    {1291319755u, "L_TOP_BOX01"},
-    {1026710080u, "L_TOP_BOX02"},
-    {1226732060u, "L_TOP_BOX03"},
-    {928534160u, "L_TOP_BOX04"},
-    {3817013504u, "L_TOP_CANNISTER01"},
-    {289102960u, "L_TOP_CANNISTER02"},
-    {553778173u, "L_TOP_CANNISTER03"},
-    {980420752u, "L_UPPERSUSPENSION"},
-    {2223369394u, "L_VENT"},
-    {3502752062u, "L_VENT_END"},
-    {569531117u, "L_WEAPON"},
-    {3870750844u, "L_WHEEL1"},
-    {2436389468u, "L_WHEEL10_ROTATE"},
-    {1754637418u, "L_WHEEL10_TRANSLATE"},
-    {3548344289u, "L_WHEEL11_ROTATE"},
-    {3857993538u, "L_WHEEL11_TRANSLATE"},
-    {2598712176u, "L_WHEEL12_ROTATE"},
-    {3061793532u, "L_WHEEL12_TRANSLATE"},
-    {3202302196u, "L_WHEEL13_TRANSLATE"},
-    {926811968u, "L_WHEEL1_DEPLOYHUB"},
-    {2128216747u, "L_WHEEL1_DEPLOYSPIKE1"},
-    {2964579934u, "L_WHEEL1_DEPLOYSPIKE2"},
-    {2739719056u, "L_WHEEL1_DEPLOYSPIKE3"},
-    {1427025685u, "L_WHEEL1_DEPLOYSPIKE4"},
-    {3580243906u, "L_WHEEL1_DEPLOYSPIKE5"},
-    {4154815552u, "L_WHEEL1_DEPLOYSPIKE6"},
-    {3923007646u, "L_WHEEL1_DEPLOYSPIKE7"},
-    {2618965291u, "L_WHEEL1_DEPLOYSPIKE8"},
-    {3671957889u, "L_WHEEL1_ROTATE"},
-    {2961989026u, "L_WHEEL1_TRANSLATE"},
-    {1851000760u, "L_WHEEL2"},
-    {4196382733u, "L_WHEEL2_ROTATE"},
-    {3069215008u, "L_WHEEL2_TRANSLATE"},
-    {2081596213u, "L_WHEEL3"},
-    {3072987811u, "L_WHEEL3_ROTATE"},
-    {2982262173u, "L_WHEEL3_TRANSLATE"},
-    {2447363791u, "L_WHEEL4"},
-    {726996523u, "L_WHEEL4_ROTATE"},
-    {3731668371u, "L_WHEEL4_TRANSLATE"},
-    {2704371058u, "L_WHEEL5"},
-    {3584631159u, "L_WHEEL5_ROTATE"},
-    {3745841892u, "L_WHEEL5_TRANSLATE"},
-    {1733261739u, "L_WHEEL6"},
-    {166010900u, "L_WHEEL6_DEPLOYHUB"},
-    {3632260857u, "L_WHEEL6_DEPLOYSPIKE1"},
-    {3385706901u, "L_WHEEL6_DEPLOYSPIKE2"},
-    {304077368u, "L_WHEEL6_DEPLOYSPIKE3"},
-    {3295264461u, "L_WHEEL6_DEPLOYSPIKE4"},
-    {4001698563u, "L_WHEEL6_DEPLOYSPIKE5"},
-    {550959014u, "L_WHEEL6_DEPLOYSPIKE6"},
-    {4074478492u, "L_WHEEL6_DEPLOYSPIKE7"},
-    {613580553u, "L_WHEEL6_DEPLOYSPIKE8"},
-    {3550536900u, "L_WHEEL6_ROTATE"},
-    {688177653u, "L_WHEEL6_TRANSLATE"},
-    {882447423u, "L_WHEEL7"},
-    {3593922608u, "L_WHEEL7_ROTATE"},
-    {589402908u, "L_WHEEL7_TRANSLATE"},
-    {4206633094u, "L_WHEEL8"},
-    {1661678569u, "L_WHEEL8_ROTATE"},
-    {4178184213u, "L_WHEEL8_TRANSLATE"},
-    {2102299048u, "L_WHEEL9_ROTATE"},
-    {3235401351u, "L_WHEEL9_TRANSLATE"},
-    {1021430484u, "L_WING"},
-    {4104846447u, "L_WINGFAN"},
-    {3693122706u, "L_WINGPULLY"},
-    {2634919170u, "L_WINGVENTS"},
-    {3216727789u, "L_WRIST"},
-    {3727137284u, "L_WRIST_IKATTACH_3P_SOCKET"},
-    {84108987u, "L_WRIST_IKATTACH_SOCKET"},
-    {2563300581u, "L_YAW"},
-    {1941569559u, "L_YAW2"},
-    {25384975u, "MAGZINE_001"},
-    {2696433044u, "MAINBOLT"},
-    {247529202u, "MAINDOOR"},
-    {77051289u, "MAINHINDGE01"},
-    {3523137644u, "MAINHINDGE02"},
-    {552300096u, "MAINHINDGE03"},
-    {4012739269u, "MAINHINDGE04"},
-    {2043243041u, "MALE"},
-    {2565524048u, "MIDAXLE"},
-    {2307684303u, "MIDLEAF"},
-    {936740635u, "MINE"},
-    {4077360421u, "MUZZLE1"},
-    {206290509u, "MUZZLE1_1STPERSON_SOCKET"},
-    {366842583u, "MUZZLE1_SOCKET"},
-    {3835394113u, "MUZZLE2"},
-    {987731955u, "NC_MAX"},
-    {4179454272u, "NECK"},
-    {237586392u, "NORTH"},
-    {4092822280u, "NORTHARM"},
-    {2129664872u, "NORTHJOINT"},
-    {594456118u, "NORTHPANEL"},
-    {220123298u, "NSOMAX_GRENADE"},
-    {238830721u, "OFFSETATTACHMENT"},
-    {2523414519u, "PANELHINDGE01"},
-    {1680169842u, "PANELHINDGE02"},
-    {2830230666u, "PANELHINDGE03"},
-    {1990983807u, "PANELHINDGE04"},
-    {2925873445u, "PART1"},
-    {1355981805u, "PART10"},
-    {369569363u, "PART11"},
-    {3771253719u, "PART12"},
-    {981661514u, "PART13"},
-    {150803519u, "PART14"},
-    {2869778529u, "PART15"},
-    {3308287675u, "PART2"},
-    {2466288220u, "PART3"},
-    {2848112608u, "PART4"},
-    {388471444u, "PART5"},
-    {1222540801u, "PART6"},
-    {867521455u, "PART7"},
-    {1704015722u, "PART8"},
-    {1312622786u, "PART9"},
-    {879040899u, "PCUBE11"},
-    {1086468669u, "PCUBE12"},
-    {185091786u, "PCUBE13"},
-    {619215498u, "PCUBE14"},
-    {232508533u, "PCUBE15"},
-    {429843451u, "PCUBE16"},
-    {3796563280u, "PCUBE17"},
-    {595475660u, "PCYLINDER37"},
-    {1898469407u, "PCYLINDER38"},
-    {2145023363u, "PCYLINDER39"},
-    {461548457u, "PCYLINDER40"},
-    {1495630334u, "PEDALS"},
-    {2072860801u, "PELVIS"},
-    {1642368672u, "PHYSICS1"},
-    {2416601835u, "PHYSICS2"},
-    {3768604471u, "PHYSICSTRAPMOUNT"},
-    {2121297440u, "PIN"},
-    {3344679897u, "PISTON01"},
-    {2235514797u, "PISTON02"},
-    {2850031842u, "PISTON03"},
-    {3628033440u, "PISTON04"},
-    {3620343033u, "PITCH"},
-    {3069185626u, "PITCHPROP_L"},
-    {1765274351u, "PITCHPROP_R"},
-    {497549541u, "PITCHRECOIL"},
-    {3116333173u, "PITCHRECOIL_L"},
-    {3282275393u, "PITCHRECOIL_R"},
-    {1448615591u, "PLATE"},
-    {1046831467u, "PLAYERBUMPER"},
-    {1587829056u, "PLUNGERA"},
-    {1894448589u, "PLUNGERB"},
-    {33859262u, "POLYSURFACE30"},
-    {3485647419u, "POLYSURFACE31"},
-    {3850366389u, "POLYSURFACE32"},
-    {3888312911u, "POLYSURFACE33"},
-    {2047664273u, "POWERCELL01"},
-    {1813333154u, "POWERCELL02"},
-    {3948699063u, "POWERCORE"},
-    {1875707837u, "POWERCORE01"},
-    {2163878423u, "POWERCORE02"},
-    {2454703298u, "POWERCORE03"},
-    {1719620090u, "POWERCORESOCKET01"},
-    {2688238961u, "POWERCORESOCKET02"},
-    {1391831783u, "POWERCORESOCKET03"},
-    {1026417588u, "POWERCORE_BASE01"},
-    {3537047296u, "POWERCORE_BASE02"},
-    {2002250715u, "POWERNODESOCKET"},
-    {1337961391u, "PUMP"},
-    {4094656420u, "RAIL"},
-    {695991093u, "REARACTION"},
-    {764979090u, "REARAXLE"},
-    {257870450u, "REARBAR"},
-    {461493020u, "REARCENTERSPININNER"},
-    {790266838u, "REARCENTERSPINOUTER"},
-    {1401298368u, "REARCYLINDER"},
-    {3180974149u, "REARFANPIVOT"},
-    {2658480396u, "REARFANTHRUST"},
-    {4052515463u, "REARFANYAW"},
-    {102955111u, "REARFLAPS"},
-    {3855637643u, "REARGEAR1"},
-    {2879678516u, "REARGEAR2"},
-    {3126035858u, "REARGEAR3"},
-    {276017613u, "REARGEAR4"},
-    {783937113u, "REARGEAR5"},
-    {1191082628u, "REARHATCHA"},
-    {762201956u, "REARHATCHB"},
-    {2682647519u, "REARSHOCKLOWER"},
-    {693737955u, "REARSHOCKUPPER"},
-    {1497906636u, "REARSLIDE"},
-    {1024671026u, "REARSUPPORT1"},
-    {534250172u, "REARSUPPORT2"},
-    {1382016971u, "REARSUPPORT3"},
-    {2989762410u, "REARSUPPORT4"},
-    {2759003112u, "REARSUPPORT5"},
-    {2803439941u, "REARSUSPENSION"},
-    {1585371058u, "REARTHRUSTER"},
-    {2227538362u, "RECOIL"},
-    {1772401952u, "REDDOT_SOCKET"},
-    {470752987u, "RELOADACTION"},
-    {1188711348u, "RELOADACTION2"},
-    {3933329929u, "RHULL"},
-    {871669885u, "RIGHTCHAMBERHATCH"},
-    {3357634932u, "RIGHT_BELT001"},
-    {329644197u, "RIGHT_BELT0010"},
-    {955335483u, "RIGHT_BELT0011"},
-    {723101580u, "RIGHT_BELT0012"},
-    {2799841014u, "RIGHT_BELT002"},
-    {2494892700u, "RIGHT_BELT003"},
-    {2182276440u, "RIGHT_BELT004"},
-    {1884438999u, "RIGHT_BELT005"},
-    {1837579329u, "RIGHT_BELT006"},
-    {1502352459u, "RIGHT_BELT007"},
-    {1205694702u, "RIGHT_BELT008"},
-    {957797217u, "RIGHT_BELT009"},
-    {1303911096u, "RIGHT_BUTTON01"},
-    {2044818186u, "RIGHT_BUTTON02"},
-    {1871666790u, "RIGHT_BUTTON03"},
-    {2759084079u, "RIGHT_BUTTON04"},
-    {2325943437u, "RIGHT_BUTTON05"},
-    {418620215u, "RIGHT_FLAP"},
-    {2374286536u, "RING1"},
-    {2557924012u, "RING2"},
-    {792191633u, "ROD"},
-    {3804343905u, "ROOTBONE"},
-    {860567359u, "ROTARYBARREL"},
-    {3439053269u, "ROTATE1"},
-    {1857195332u, "ROTATE2"},
-    {465715614u, "ROTATECHAMBER"},
-    {1332087532u, "ROUND1"},
-    {1629531745u, "ROUND2"},
-    {1805501275u, "ROUND3"},
-    {2097374758u, "ROUND4"},
-    {376084722u, "ROUND5"},
-    {665402223u, "ROUND6"},
-    {4140554400u, "RPOWERNODE"},
-    {4268096845u, "R_ANKLE"},
-    {3008301052u, "R_ARM"},
-    {3106683811u, "R_ARMCOMPONENTS"},
-    {997715595u, "R_BACKDRING"},
-    {148150983u, "R_BACKPLATE"},
-    {3208123503u, "R_BACKSHOCKA"},
-    {1675554705u, "R_BACKSHOCKA_TOP"},
-    {4073028489u, "R_BACKSHOCKB"},
-    {2818173706u, "R_BACKSHOCKB_TOP"},
-    {476502330u, "R_BACKSIDESTABILIZER"},
-    {870255675u, "R_BACKSTABILIZER"},
-    {2491993409u, "R_BACK_CANNISTER01"},
-    {1580359821u, "R_BACK_CANNISTER02"},
-    {2049782909u, "R_BALL"},
-    {1503220503u, "R_BARREL"},
-    {1606571537u, "R_BARRELFRONT_EXTEND"},
-    {630489018u, "R_BARRELRECOILLOWER"},
-    {2911986502u, "R_BARRELRECOILUPPER"},
-    {2011106085u, "R_BARRELROTATION"},
-    {1292570642u, "R_BARRELROTATIONLOWER"},
-    {4125754605u, "R_BARRELROTATIONUPPER"},
-    {658413182u, "R_BARRELSIDELAYER1"},
-    {2514353650u, "R_BARRELSIDELAYER1_END"},
-    {2490953973u, "R_BARRELSIDELAYER2"},
-    {524831829u, "R_BARRELSIDE_EXTEND"},
-    {2022986004u, "R_BOTTOMBARREL"},
-    {1396032091u, "R_BOTTOMCANISTER"},
-    {3218433468u, "R_BOTTOMHOUSING"},
-    {2200477764u, "R_BOTTOMSHOCKMOUNT"},
-    {3604588876u, "R_BOTTOMTUBE"},
-    {3800032069u, "R_BOTTOMVENTS"},
-    {3623525379u, "R_BOTTONREARLEGBASE"},
-    {3812362030u, "R_BOTTONREARLEGHINGE"},
-    {113224493u, "R_CLAVICLE"},
-    {1843892274u, "R_CYLINDERDN"},
-    {2762743218u, "R_CYLINDEREXTEND_END"},
-    {1895700580u, "R_CYLINDEREXTEND_END1"},
-    {4285130512u, "R_CYLINDERUP"},
-    {1681854081u, "R_DEPLOY_MECANISM"},
-    {3204711383u, "R_DEPLOY_MECANISM_END"},
-    {2970756967u, "R_ELBOW"},
-    {3974058683u, "R_ENGINESHIELD"},
-    {1953769567u, "R_ENGINEVENTFLAPA"},
-    {2260913404u, "R_ENGINEVENTFLAPB"},
-    {2005839528u, "R_ENGINEVENTFLAPC"},
-    {2233616847u, "R_ENGINEVENTFLAPD"},
-    {2599646577u, "R_ENGINEVENTFLAPE"},
-    {2833781082u, "R_ENGINEVENTFLAPF"},
-    {3197516982u, "R_ENGINEVENTFLAPG"},
-    {3248592082u, "R_FAN"},
-    {802037369u, "R_FLAP"},
-    {2163166549u, "R_FLAPPER"},
-    {708670027u, "R_FOOT"},
-    {2906427843u, "R_FOOT_INSIDETOES"},
-    {4072946546u, "R_FOOT_INSIDETOES_END"},
-    {1498761862u, "R_FOOT_OUTSIDETOES"},
-    {1779413271u, "R_FOOT_OUTSIDETOES_END"},
-    {2884154752u, "R_FOOT_SPIKES"},
-    {2716785905u, "R_FOOT_SPIKES_END"},
-    {3356280828u, "R_FOREARM"},
-    {3916096451u, "R_FORWARDDISK"},
-    {3586508350u, "R_FORWARDDISK2"},
-    {2134928656u, "R_FRONTAXLE"},
-    {1440689943u, "R_FRONTDOOR"},
-    {2629297631u, "R_FRONTDRING"},
-    {1282140579u, "R_FRONTFLAP"},
-    {835718401u, "R_FRONTGEAR1"},
-    {1076734396u, "R_FRONTGEAR2"},
-    {2372092970u, "R_FRONTGEAR3"},
-    {2611601591u, "R_FRONTGEAR4"},
-    {145275571u, "R_FRONTGEAR5"},
-    {2286030167u, "R_FRONTGEARDOOR1"},
-    {2863223333u, "R_FRONTGEARDOOR2"},
-    {2157529237u, "R_FRONTPANEL1"},
-    {1725043975u, "R_FRONTPANEL2"},
-    {4058873060u, "R_FRONTPLATE"},
-    {2647247259u, "R_FRONTSHOCKA"},
-    {1486358852u, "R_FRONTSHOCKA_TOP"},
-    {2852643351u, "R_FRONTSHOCKB"},
-    {3278587725u, "R_FRONTSHOCKB_TOP"},
-    {2429286607u, "R_FRONTSHOCKLOWER"},
-    {3782241303u, "R_FRONTSHOCKUPPER"},
-    {2798464200u, "R_FRONTSIDESTABILIZER"},
-    {1300136028u, "R_FRONTSTABILIZER"},
-    {3639903371u, "R_FRONTSUPPORT"},
-    {4001712163u, "R_FRONTSUPPORT1"},
-    {2701077784u, "R_FRONTSUPPORT2"},
-    {3266867338u, "R_FRONTSUPPORT3"},
-    {3017134789u, "R_FRONTSUPPORT4"},
-    {275021293u, "R_FRONTSUSPENSION"},
-    {2910764364u, "R_FRONTVENT"},
-    {2611971637u, "R_FRONTWHEEL"},
-    {743339293u, "R_FRONTWHEEL_DUMMY"},
-    {3722266261u, "R_GEARA"},
-    {4029639481u, "R_GEARB"},
-    {3200747626u, "R_GEARC"},
-    {2299776059u, "R_GEARDOOR"},
-    {3414914564u, "R_GEARSUPPORTA"},
-    {2798791814u, "R_GEARSUPPORTB"},
-    {4093298414u, "R_HANDLE"},
-    {767425248u, "R_HATCH_BOTTOM"},
-    {2197101825u, "R_HATCH_BOTTOM_END"},
-    {904278569u, "R_HATCH_TOP"},
-    {4021302725u, "R_HATCH_TOP_END"},
-    {2907905148u, "R_HIP"},
-    {3420689105u, "R_HIPATTACH"},
-    {1501527398u, "R_HOSE"},
-    {3770474639u, "R_INDEXA"},
-    {4277804297u, "R_INDEXB"},
-    {2054689799u, "R_INDEXC"},
-    {2492699346u, "R_INDEX_END"},
-    {4003831577u, "R_INNERFLAP"},
-    {3639316156u, "R_INNERTHRUSTER"},
-    {3783973932u, "R_KNEE"},
-    {3831889766u, "R_KNOB_ROTATE"},
-    {2335091557u, "R_KNOB_TRANSLATE"},
-    {2520538412u, "R_LARGEDISK"},
-    {4200598998u, "R_LARGEINNERDISK"},
-    {647525950u, "R_LATCHCLIPS"},
-    {944552693u, "R_LEG"},
-    {3904186436u, "R_LEG_PISTON"},
-    {1618744748u, "R_LOADER"},
-    {4222341536u, "R_LOWERSUSPENSION"},
-    {4006501473u, "R_MAINPULLY"},
-    {1984855388u, "R_MIDAXLE"},
-    {812161446u, "R_MIDDLEA"},
-    {1034073114u, "R_MIDDLEB"},
-    {148130434u, "R_MIDDLEC"},
-    {3546037191u, "R_MIDDLE_END"},
-    {3593695816u, "R_MIDPANEL1"},
-    {2785907197u, "R_MIDPANEL2"},
-    {1520646530u, "R_MIDSUPPORT"},
-    {4073776971u, "R_MIDWHEEL"},
-    {3312143588u, "R_OUTERFLAP"},
-    {2479252796u, "R_OUTERTHRUSTERPANELA"},
-    {2145467758u, "R_OUTERTHRUSTERPANELB"},
-    {1847237089u, "R_OUTERTHRUSTERPANELC"},
-    {3217677901u, "R_OVERHEADDOOR1"},
-    {3784319449u, "R_OVERHEADDOOR2"},
-    {1073302274u, "R_PEDAL"},
-    {1719789456u, "R_PINKYA"},
-    {869597751u, "R_PINKYB"},
-    {3693662948u, "R_PINKYC"},
-    {1729498404u, "R_PINKY_END"},
-    {2581087731u, "R_PISTON"},
-    {319614870u, "R_PITCH"},
-    {1360155857u, "R_PITCHRECOIL"},
-    {1668442840u, "R_POWERCORE"},
-    {2094109583u, "R_REARAXLE"},
-    {768395665u, "R_REARDISK"},
-    {197266429u, "R_REARDOOR"},
-    {2281324824u, "R_REARENGINESHIELD"},
-    {2447288296u, "R_REARFLAP"},
-    {17223862u, "R_REARGEAR1"},
-    {4071371777u, "R_REARGEAR2"},
-    {3494178611u, "R_REARGEAR3"},
-    {3103768745u, "R_REARGEAR4"},
-    {222980417u, "R_REARGEARA"},
-    {4289252862u, "R_REARGEARB"},
-    {3953567226u, "R_REARGEARC"},
-    {1481063746u, "R_REARGEARDOOR"},
-    {4025803247u, "R_REARGEARDOOR1"},
-    {3786294626u, "R_REARGEARDOOR2"},
-    {2268888731u, "R_REARGEARSUPPORT"},
-    {622475301u, "R_REARPANEL1"},
-    {4093695475u, "R_REARPANEL2"},
-    {3237172461u, "R_REARSHOCKLOWER"},
-    {4025675475u, "R_REARSHOCKUPPER"},
-    {1462887748u, "R_REARSUPPORT"},
-    {3708936486u, "R_REARSUSPENSION"},
-    {3673823181u, "R_REARTHRUSTER"},
-    {1766662782u, "R_REARTHRUSTER1"},
-    {1477378046u, "R_REARTHRUSTER2"},
-    {3559570972u, "R_REARTHRUSTERFLAP"},
-    {1025623836u, "R_REARVENT"},
-    {1561737944u, "R_REARVENTS"},
-    {2167947592u, "R_REARWHEEL"},
-    {3649043221u, "R_REARWHEELPIVOT"},
-    {660457104u, "R_RELOADPIN"},
-    {931042330u, "R_RINGA"},
-    {1237039252u, "R_RINGB"},
-    {2624511473u, "R_RINGC"},
-    {2819542915u, "R_RING_END"},
-    {378834321u, "R_RUDDER"},
-    {2177680988u, "R_SHELL1"},
-    {2469390626u, "R_SHELL2"},
-    {4129238787u, "R_SHELL3"},
-    {3621843591u, "R_SHELL4"},
-    {2797473858u, "R_SHELL5"},
-    {3074686431u, "R_SHELLROTATION"},
-    {682273574u, "R_SHIELD"},
-    {2739289683u, "R_SHIELDARM"},
-    {1166594346u, "R_SHOCKLOWER"},
-    {3884601638u, "R_SHOCKUPPER"},
-    {1665358410u, "R_SHOULDER"},
-    {954251114u, "R_SHOULDERATTACH"},
-    {457744838u, "R_SHOULDERPAD"},
-    {3360970358u, "R_SHOULDERROLL"},
-    {2257473628u, "R_SIDELOCK_BACK"},
-    {3149788146u, "R_SIDELOCK_BACK_END"},
-    {3273527615u, "R_SIDELOCK_FRONT"},
-    {2030996345u, "R_SIDELOCK_FRONT_END"},
-    {3212206043u, "R_SIDEVENT1"},
-    {2715821231u, "R_SIDEVENT2"},
-    {1255274124u, "R_SIDEVENT3"},
-    {1024908054u, "R_SIDEVENT4"},
-    {1767831881u, "R_SMALLPULLY"},
-    {1091651574u, "R_SMOKESTACK"},
-    {563530995u, "R_SPIKEINSIDE"},
-    {850569389u, "R_SPIKEOUTSIDE"},
-    {705922756u, "R_STABILIZER"},
-    {2201033226u, "R_STEERINGLINK"},
-    {2681793709u, "R_STEERINGLINKINNER"},
-    {1635783371u, "R_STEERINGLINKOUTER"},
-    {2590276672u, "R_STEERINGPIVOT"},
-    {1202702096u, "R_SUPPORT1"},
-    {1439523659u, "R_SUPPORT2"},
-    {3846570558u, "R_SUPPORT3"},
-    {4228329408u, "R_SUPPORT4"},
-    {2231500842u, "R_THROTTLE"},
-    {3301476370u, "R_THRUSTER"},
-    {2558765017u, "R_THRUSTER1"},
-    {1270025781u, "R_THRUSTER2"},
-    {3125439334u, "R_THRUSTER3"},
-    {1776095517u, "R_THRUSTERFLAP"},
-    {609567619u, "R_THRUSTERFLAP1"},
-    {905963224u, "R_THRUSTERFLAP2"},
-    {306890114u, "R_THRUSTERPANEL"},
-    {1102577659u, "R_THUMBA"},
-    {787765876u, "R_THUMBB"},
-    {3860416703u, "R_THUMBC"},
-    {2176474540u, "R_THUMB_END"},
-    {1939367865u, "R_TOE"},
-    {3288663904u, "R_TOPBARREL"},
-    {2173355228u, "R_TOPCANISTER"},
-    {674498645u, "R_TOPHOUSING"},
-    {1047768032u, "R_TOPREARLEGHINGE"},
-    {1786766851u, "R_TOPSHOCKMOUNT"},
-    {2899694509u, "R_TOPTUBE"},
-    {3942524321u, "R_TOP_BOX01"},
-    {1696635368u, "R_TOP_BOX02"},
-    {1456667981u, "R_TOP_BOX03"},
-    {1083035843u, "R_TOP_BOX04"},
-    {1999235894u, "R_TOP_CANNISTER01"},
-    {3153949916u, "R_TOP_CANNISTER02"},
-    {2309787707u, "R_TOP_CANNISTER03"},
-    {3839060481u, "R_UPPERSUSPENSION"},
-    {1205209995u, "R_VENT"},
-    {1611614878u, "R_VENT_END"},
-    {2499881490u, "R_WEAPON"},
-    {3412486250u, "R_WHEEL1"},
-    {3282254545u, "R_WHEEL10_ROTATE"},
-    {1230749804u, "R_WHEEL10_TRANSLATE"},
-    {673389254u, "R_WHEEL11_ROTATE"},
-    {2192524473u, "R_WHEEL11_TRANSLATE"},
-    {3031470467u, "R_WHEEL12_ROTATE"},
-    {3155071899u, "R_WHEEL12_TRANSLATE"},
-    {1770326393u, "R_WHEEL13_TRANSLATE"},
-    {4151378384u, "R_WHEEL1_DEPLOYHUB"},
-    {1061283032u, "R_WHEEL1_DEPLOYSPIKE1"},
-    {762331445u, "R_WHEEL1_DEPLOYSPIKE2"},
-    {1803205969u, "R_WHEEL1_DEPLOYSPIKE3"},
-    {1515199228u, "R_WHEEL1_DEPLOYSPIKE4"},
-    {2148525691u, "R_WHEEL1_DEPLOYSPIKE5"},
-    {1850032870u, "R_WHEEL1_DEPLOYSPIKE6"},
-    {1421348804u, "R_WHEEL1_DEPLOYSPIKE7"},
-    {3261557537u, "R_WHEEL1_DEPLOYSPIKE8"},
-    {382218229u, "R_WHEEL1_ROTATE"},
-    {295177829u, "R_WHEEL1_TRANSLATE"},
-    {445974206u, "R_WHEEL2"},
-    {1066474903u, "R_WHEEL2_ROTATE"},
-    {4005736250u, "R_WHEEL2_TRANSLATE"},
-    {138174985u, "R_WHEEL3"},
-    {1712144270u, "R_WHEEL3_ROTATE"},
-    {2959938177u, "R_WHEEL3_TRANSLATE"},
-    {4278341525u, "R_WHEEL4"},
-    {225776827u, "R_WHEEL4_ROTATE"},
-    {2223289680u, "R_WHEEL4_TRANSLATE"},
-    {3974277974u, "R_WHEEL5"},
-    {3907744388u, "R_WHEEL5_ROTATE"},
-    {2992552996u, "R_WHEEL5_TRANSLATE"},
-    {1803430031u, "R_WHEEL6"},
-    {3968009904u, "R_WHEEL6_DEPLOYHUB"},
-    {2328021520u, "R_WHEEL6_DEPLOYSPIKE1"},
-    {2637983491u, "R_WHEEL6_DEPLOYSPIKE2"},
-    {1583804761u, "R_WHEEL6_DEPLOYSPIKE3"},
-    {819009070u, "R_WHEEL6_DEPLOYSPIKE4"},
-    {3519043598u, "R_WHEEL6_DEPLOYSPIKE5"},
-    {3825466517u, "R_WHEEL6_DEPLOYSPIKE6"},
-    {1833668386u, "R_WHEEL6_DEPLOYSPIKE7"},
-    {2005443484u, "R_WHEEL6_DEPLOYSPIKE8"},
-    {237617448u, "R_WHEEL6_ROTATE"},
-    {1122782432u, "R_WHEEL6_TRANSLATE"},
-    {1631065091u, "R_WHEEL7"},
-    {1109449997u, "R_WHEEL7_ROTATE"},
-    {3702738401u, "R_WHEEL7_TRANSLATE"},
-    {1341747590u, "R_WHEEL8"},
-    {152551772u, "R_WHEEL8_ROTATE"},
-    {3986162229u, "R_WHEEL8_TRANSLATE"},
-    {916948579u, "R_WHEEL9_ROTATE"},
-    {4020787006u, "R_WHEEL9_TRANSLATE"},
-    {2001947653u, "R_WING"},
-    {2557431765u, "R_WINGFAN"},
-    {3290958398u, "R_WINGPULLY"},
-    {1100663657u, "R_WINGVENTS"},
-    {1310993196u, "R_WRIST"},
-    {3068704555u, "R_YAW"},
-    {3571316050u, "R_YAW2"},
-    {3650476089u, "SCOPE_SOCKET"},
-    {1777916161u, "SHELL1"},
-    {2634601848u, "SHELL10"},
-    {1263186429u, "SHELL11"},
-    {1082498163u, "SHELL12"},
-    {1854896262u, "SHELL13"},
-    {3825361770u, "SHELL14"},
-    {2086501834u, "SHELL2"},
-    {259892264u, "SHELL3"},
-    {4257022119u, "SHELL4"},
-    {1020427985u, "SHELL5"},
-    {720558866u, "SHELL6"},
-    {3636213414u, "SHELL7"},
-    {3794192763u, "SHELL9"},
-    {2254105017u, "SHELLEJECT_R_SOCKET"},
-    {1636290156u, "SIDEDOORSA"},
-    {362165850u, "SIDEDOORSB"},
-    {1681053934u, "SIDEGRIP"},
-    {755919266u, "SIDERAIL_SOCKET"},
-    {781444628u, "SLICE.005"},
-    {2083853213u, "SLIDETOP"},
-    {1076688081u, "SLOWSPIN_BASE_IDLE_FULL"},
-    {826122527u, "SMALLBARREL1"},
-    {595527074u, "SMALLBARREL2"},
-    {3916480659u, "SMALLBLADE"},
-    {1570658564u, "SMALLSPINNINGENGINE"},
-    {1400340987u, "SNIPER_SCOPE"},
-    {2401783636u, "SPIN"},
-    {1025849218u, "SPINDLE"},
-    {4060706981u, "SPINELOWER"},
-    {2242507051u, "SPINEMIDDLE"},
-    {3061072950u, "SPINEUPPER"},
-    {2954194361u, "SPINNER"},
-    {4261665176u, "SPINUP"},
-    {298354645u, "SPIRE"},
-    {338710066u, "SPIREPANELS"},
-    {2919287888u, "STABILIZER"},
-    {1458068209u, "STEERING"},
-    {2568524136u, "STOCK"},
-    {46896897u, "STRAIGHT_PULL"},
-    {3449862424u, "TAIL"},
-    {2250973670u, "TAILVENTS"},
-    {3570760957u, "THULL"},
-    {2359506969u, "TOPFRONTLEGHINGEA"},
-    {2060981379u, "TOPFRONTLEGHINGEB"},
-    {3587933164u, "TOPPANEL01"},
-    {1134583660u, "TOPPANEL02"},
-    {2645365644u, "TOPPANEL03"},
-    {197259188u, "TOPPANEL04"},
-    {635268839u, "TOPREARENGINEFLAPA"},
-    {4086401616u, "TOPREARENGINEFLAPB"},
-    {921899274u, "TOPREARENGINEFLAPC"},
-    {348179630u, "TOPREARENGINEFLAPD"},
-    {948966460u, "TOPREARENGINEFLAPE"},
-    {1800894922u, "TOPREARENGINEFLAPF"},
-    {619080913u, "TOPREARENGINEFLAPG"},
-    {1202008678u, "TOPREARENGINEFLAPH"},
-    {2046112361u, "TOP_DISC"},
-    {1828274654u, "TRAJECTORY"},
-    {831168718u, "TRIGGER"},
-    {721358111u, "TR_MAX"},
-    {3312333887u, "TURBINE"},
-    {1462638923u, "UPPERDOOR1"},
-    {2225632319u, "UPPERDOOR2"},
-    {1926418580u, "UPPERDOOR3"},
-    {2722377586u, "UPPERDOOR4"},
-    {651546252u, "VEHICLE_COMMON_ANT_ATTACHMENT_MININGLASER001"},
-    {89398582u, "VEHICLE_COMMON_ANT_BASE_CHASSIS"},
-    {2182042677u, "VEHICLE_COMMON_ANT_WEAPON_MININGTURRET"},
-    {115398135u, "VEHICLE_COMMON_ATTACHMENT_HOODORNAMENT_FIGURE_CHROMESNAKEEYES_ANIMATED"},
-    {3450335605u, "VEHICLE_COMMON_ATTACHMENT_RADAR_PROXIMITY001"},
-    {2755292179u, "VEHICLE_COMMON_AUTOTURRETGROUND_BASE_TURRET"},
-    {3535937897u, "VEHICLE_COMMON_AUTOTURRETGROUND_WEAPONS_MACHINEGUN"},
-    {3240526583u, "VEHICLE_COMMON_AUTOTURRET_BASE_TURRET_WASP"},
-    {1557672612u, "VEHICLE_COMMON_AUTOTURRET_GROUNDANTIAIRROCKETLAUNCHER"},
-    {4192786543u, "VEHICLE_COMMON_AUTOTURRET_GROUNDANTITANKROCKETLAUNCHER"},
-    {1891975577u, "VEHICLE_COMMON_BUGGY_BASE_CHASSIS"},
-    {3741766728u, "VEHICLE_COMMON_COLOSSUS_BASE_CHASSIS"},
-    {2029538400u, "VEHICLE_COMMON_COLOSSUS_WEAPON_MAINCANNON001"},
-    {110176716u, "VEHICLE_COMMON_CRAWLER_BASE_CHASSIS"},
-    {1113053344u, "VEHICLE_COMMON_DROPPOD"},
-    {3991326819u, "VEHICLE_COMMON_ENGINEERDEPLOYABLE_BASE_TRIPOD"},
-    {2945904176u, "VEHICLE_COMMON_ENGINEERDEPLOYABLE_WEAPON_MACHINEGUN"},
-    {726139324u, "VEHICLE_COMMON_ENGINEERDEPLOYABLE_WEAPON_ROCKETPOD"},
-    {338743835u, "VEHICLE_COMMON_FACILITYTURRET_BASE"},
-    {1806637269u, "VEHICLE_COMMON_FACILITYTURRET_TANKCANNON"},
-    {1029709092u, "VEHICLE_COMMON_FACILITYTURRET_WEAPON_30MMCANNON"},
-    {2109306918u, "VEHICLE_COMMON_FACILITYTURRET_WEAPON_CHAINGUN"},
-    {2143811686u, "VEHICLE_COMMON_FACILITYTURRET_WEAPON_FLAKCANNON"},
-    {4082459912u, "VEHICLE_COMMON_FACILITYTURRET_WEAPON_MISSILELAUNCHER"},
-    {87575790u, "VEHICLE_COMMON_GALAXY"},
-    {808899809u, "VEHICLE_COMMON_HEAVYFIGHTER_BASE_CHASSIS"},
-    {75518749u, "VEHICLE_COMMON_JETBIKE_BASE_CHASSIS"},
-    {1689559053u, "VEHICLE_COMMON_LIBERATOR"},
-    {1937782095u, "VEHICLE_COMMON_LIBERATOR_WEAPON_105MMCANNON"},
-    {1473445921u, "VEHICLE_COMMON_LIBERATOR_WEAPON_60MMBALLTURRET_ROCKETPODS"},
-    {2424947579u, "VEHICLE_COMMON_LIBERATOR_WEAPON_60MMCANNO_DOUBLEBARREL"},
-    {2187252056u, "VEHICLE_COMMON_LIBERATOR_WEAPON_75MMCANNON"},
-    {1942104436u, "VEHICLE_COMMON_LIBERATOR_WEAPON_NOSEGUN15MM"},
-    {2283716452u, "VEHICLE_COMMON_LIBERATOR_WEAPON_NOSEGUN20MM"},
-    {2163822301u, "VEHICLE_COMMON_LIBERATOR_WEAPON_NOSEGUN30MM"},
-    {3126493516u, "VEHICLE_COMMON_LIBERATOR_WEAPON_REAR30MMQUADGATLING"},
-    {2270971168u, "VEHICLE_COMMON_LIGHTNING"},
-    {3011835733u, "VEHICLE_COMMON_LIGHTNING_75MMCANNON"},
-    {3968508958u, "VEHICLE_COMMON_LIGHTNING_WEAPON_100MMCANNON"},
-    {4047477869u, "VEHICLE_COMMON_LIGHTNING_WEAPON_ANACONDATURRET"},
-    {3240810951u, "VEHICLE_COMMON_LIGHTNING_WEAPON_SKYGUARDCANNON"},
-    {4211252507u, "VEHICLE_COMMON_QUAD"},
-    {3809288696u, "VEHICLE_COMMON_QUAD_ATTACHMENT_ANTENNA"},
-    {3726394811u, "VEHICLE_COMMON_QUAD_BASE_COCKPIT"},
-    {1303942709u, "VEHICLE_COMMON_QUAD_WEAPON_20MMGUN"},
-    {3344407534u, "VEHICLE_COMMON_QUAD_WEAPON_30MMGUN"},
-    {1275472689u, "VEHICLE_COMMON_QUAD_WEAPON_40MMGUN"},
-    {3681461710u, "VEHICLE_COMMON_QUAD_WEAPON_50CALGUN"},
-    {1135174062u, "VEHICLE_COMMON_QUAD_WEAPON_PULSEDPARTICLEACCELERATOR"},
-    {1124983827u, "VEHICLE_COMMON_QUAD_WEAPON_ROCKETLAUNCHERNC"},
-    {1765322296u, "VEHICLE_COMMON_QUAD_WEAPON_ROCKETLAUNCHERTR"},
-    {2647307111u, "VEHICLE_COMMON_QUAD_WEAPON_ROCKETLAUNCHERVS"},
-    {572442510u, "VEHICLE_COMMON_QUAD_WEAPON_SHOTGUN"},
-    {3592091344u, "VEHICLE_COMMON_RECONDRONE_BASE_CHASSIS"},
-    {722503334u, "VEHICLE_COMMON_SUNDERER_ATTACHMENT_SMOKESTACK001"},
-    {869507288u, "VEHICLE_COMMON_SUNDERER_BASE_CHASSIS"},
-    {2020680874u, "VEHICLE_COMMON_VALKYRIE_BASE_CHASSIS"},
-    {220791727u, "VEHICLE_COMMON_WEAPON_20MMBALLTURRET"},
-    {714496997u, "VEHICLE_COMMON_WEAPON_20MMHEAVYBALLTURRET"},
-    {1654582506u, "VEHICLE_COMMON_WEAPON_20MMVEHICLETURRET"},
-    {964969609u, "VEHICLE_COMMON_WEAPON_20MMVEHICLETURRETCOAXIAL"},
-    {1903739073u, "VEHICLE_COMMON_WEAPON_30MMFLAKTURRET"},
-    {3223513967u, "VEHICLE_COMMON_WEAPON_30MMGATLINGBALLTURRET"},
-    {475599474u, "VEHICLE_COMMON_WEAPON_30MMVEHICLETURRET"},
-    {459445938u, "VEHICLE_COMMON_WEAPON_40MMGRENADELAUNCHER"},
-    {2257917057u, "VEHICLE_COMMON_WEAPON_40MMGRENADELAUNCHER_TWOBARREL"},
-    {78710034u, "VEHICLE_COMMON_WEAPON_50CALMACHINEGUN"},
-    {2179552981u, "VEHICLE_COMMON_WEAPON_50CALMACHINEGUNCOAXIAL"},
-    {3616397177u, "VEHICLE_COMMON_WEAPON_50MMGATLINGBALLTURRET"},
-    {2475268786u, "VEHICLE_COMMON_WEAPON_60MMBALLTURRET"},
-    {3991537050u, "VEHICLE_COMMON_WEAPON_60MMMISSILELAUNCHERBALLTURRET"},
-    {2268774313u, "VEHICLE_COMMON_WEAPON_60MMVEHICLETURRET"},
-    {2345600056u, "VEHICLE_COMMON_WEAPON_85MMRECOILLESSRIFLETURRET"},
-    {605820305u, "VEHICLE_COMMON_WEAPON_FLAKBALLTURRET"},
-    {4137492255u, "VEHICLE_COMMON_WEAPON_NULLTURRET"},
-    {1116911325u, "VEHICLE_NC_REAVER"},
-    {1500128684u, "VEHICLE_NC_REAVER_GLASS_LOD0"},
-    {52417596u, "VEHICLE_NC_REAVER_WEAPON_14MMCANNON"},
-    {3245907420u, "VEHICLE_NC_REAVER_WEAPON_20MMGATLINGCANNON001"},
-    {3169031338u, "VEHICLE_NC_REAVER_WEAPON_20MMGATLINGCANNON002"},
-    {1044163086u, "VEHICLE_NC_VANGUARD"},
-    {3893742285u, "VEHICLE_NC_VANGUARD_WEAPON_150MMARTILLERYCANNON"},
-    {3094816405u, "VEHICLE_NC_VANGUARD_WEAPON_150MMCANNON"},
-    {1025710107u, "VEHICLE_NC_VANGUARD_WEAPON_150MMCANNON_REFERRAL001"},
-    {1602021409u, "VEHICLE_NC_VANGUARD_WEAPON_200MMARTILLERYCANNON_LOD0"},
-    {929720993u, "VEHICLE_NC_VANGUARD_WEAPON_ANTIVEHICLETURRET01"},
-    {560152447u, "VEHICLE_NC_VANGUARD_WEAPON_PSA_MAINCANNON001"},
-    {235598279u, "VEHICLE_NC_VANGUARD_WEAPON_PSA_MAINCANNON001_LOD0"},
-    {4055724013u, "VEHICLE_NC_VANGUARD_WEAPON_RAILCANNON"},
-    {3241010037u, "VEHICLE_NC_VANGUARD_WEAPON_RAILGUNVEHICLETURRET"},
-    {3337620633u, "VEHICLE_TR_MOSQUITO"},
-    {3880820423u, "VEHICLE_TR_MOSQUITO_WEAPON_12MMCANNON001"},
-    {2635432493u, "VEHICLE_TR_MOSQUITO_WEAPON_20MMGATLINGCANNON001"},
-    {1064781554u, "VEHICLE_TR_MOSQUITO_WEAPON_20MMGATLINGCANNON002"},
-    {1622762646u, "VEHICLE_TR_PROWLER_BASE_CHASSIS"},
-    {1806804023u, "VEHICLE_TR_PROWLER_WEAPON_120MMARTILLERYCANNON"},
-    {2008156296u, "VEHICLE_TR_PROWLER_WEAPON_120MMCANNON"},
-    {2815222948u, "VEHICLE_TR_PROWLER_WEAPON_120MMCANNON_REFERRAL001"},
-    {1867509980u, "VEHICLE_TR_PROWLER_WEAPON_120MMQUADCANNON"},
-    {4224834756u, "VEHICLE_TR_PROWLER_WEAPON_ESAV002"},
-    {4266385848u, "VEHICLE_TR_PROWLER_WEAPON_ESAV003"},
-    {1570826753u, "VEHICLE_VS_MAGRIDER"},
-    {4186885183u, "VEHICLE_VS_MAGRIDER_WEAPON_ESAV002"},
-    {2708597823u, "VEHICLE_VS_MAGRIDER_WEAPON_HEAVYRAILBEAM001"},
-    {3296772448u, "VEHICLE_VS_MAGRIDER_WEAPON_PLASMACANNON001"},
-    {3661491418u, "VEHICLE_VS_MAGRIDER_WEAPON_PLASMACANNON002"},
-    {1745324143u, "VEHICLE_VS_MAGRIDER_WEAPON_PLASMACANNON003"},
-    {2043161584u, "VEHICLE_VS_MAGRIDER_WEAPON_PLASMACANNON004"},
-    {3478917814u, "VEHICLE_VS_MAGRIDER_WEAPON_PULSEDPARTICLEACCELERATOR001"},
-    {504828295u, "VEHICLE_VS_SCYTHE_WEAPON_20MMGATLINGCANNON001"},
-    {1818209819u, "VEHICLE_VS_SCYTHE_WEAPON_20MMGATLINGCANNON002"},
-    {1574580347u, "VEHICLE_VS_VORTEX"},
-    {1122641024u, "VS_MAX"},
-    {175089113u, "WEAPONATTACHMENT_COMMON_CLIP_THUMPER001"},
-    {2900915387u, "WEAPONATTACHMENT_NC_GRENADELAUNCHER_001"},
-    {2585526967u, "WEAPONATTACHMENT_NS_APROUND_001"},
-    {498327413u, "WEAPONATTACHMENT_TR_CLIP_ROCKETLAUNCHERAMMO002"},
-    {3645478496u, "WEAPONATTACHMENT_TR_GRENADELAUNCHER_001"},
-    {622280259u, "WEAPONMOUNT"},
-    {1098942010u, "WEAPONS_COMMON_FAVENWEAPONS_LMG001_LOD0"},
-    {4040009277u, "WEAPONS_COMMON_FAVENWEAPONS_SCOUTRIFLE001_LOD0"},
-    {1253436212u, "WEAPONS_COMMON_FAVENWEAPONS_SMG001_LOD0"},
-    {4282203036u, "WEAPONS_COMMON_FAVENWEAPONS_SMG001_OLD"},
-    {2503882700u, "WEAPONS_COMMON_MAXHEAVYMACHINEGUNLEFT001"},
-    {3001572027u, "WEAPONS_COMMON_MAXHEAVYMACHINEGUNRIGHT001"},
-    {1690090417u, "WEAPONS_COMMON_THUMPER001"},
-    {2750269423u, "WEAPONS_NC_DOKUWEAPONS_LMG001"},
-    {533703831u, "WEAPONS_NC_DOKUWEAPONS_SMG001"},
-    {2009555957u, "WEAPONS_NC_DOKUWEAPONS_SNIPERRIFLE001_LOD0"},
-    {4135457461u, "WEAPONS_NC_MAXAF23GRINDER"},
-    {1004136612u, "WEAPONS_NC_MAXAF34MATTOCKLEFT"},
-    {3332107390u, "WEAPONS_NC_MAXAF34MATTOCKRIGHT"},
-    {3481383269u, "WEAPONS_TR_DOKUWEAPONS_ASSUALTRIFLE001"},
-    {2996211783u, "WEAPONS_TR_DOKUWEAPONS_CARBINE001"},
-    {1060044686u, "WEAPONS_TR_DOKUWEAPONS_CHAINGUN001"},
-    {151225539u, "WEAPONS_TR_DOKUWEAPONS_LGM001"},
-    {1646183586u, "WEAPONS_TR_DOKUWEAPONS_PISTOL001"},
-    {1014941510u, "WEAPONS_TR_DOKUWEAPONS_SMG001"},
-    {728552198u, "WEAPONS_VS_DOKUWEAPONS_LMG001"},
-    {805042209u, "WEAPONS_VS_DOKUWEAPONS_SMG001"},
-    {407208271u, "WEAPONS_VS_MAXCOSMOSVM3_LEFT"},
-    {2300638456u, "WEAPONS_VS_MAXCOSMOSVM3_LEFT_LOD0"},
-    {1571532502u, "WEAPONS_VS_MAXCOSMOSVM3_RIGHT"},
-    {3029105912u, "WEAPONS_VS_MAXCOSMOSVM3_RIGHT_LOD0"},
-    {2234692128u, "WEAPONS_VS_MAXHEAVYMACHINEGUNLEFT001"},
-    {1210586064u, "WEAPONS_VS_MAXHEAVYMACHINEGUNRIGHT001"},
-    {1456372033u, "WEAPONS_VS_MAXNEBULAVM20_LEFT"},
-    {1252909755u, "WEAPONS_VS_MAXNEBULAVM20_LEFT_LOD0"},
-    {3849338326u, "WEAPONS_VS_MAXNEBULAVM20_RIGHT"},
-    {2358689877u, "WEAPONS_VS_MAXNEBULAVM20_RIGHT_LOD0"},
-    {1506210194u, "WEAPON_COMMON_ACETOOL"},
-    {1225820717u, "WEAPON_COMMON_AUTOPISTOL001"},
-    {1834137684u, "WEAPON_COMMON_AUTOPISTOL001_LOD0"},
-    {1769359068u, "WEAPON_COMMON_CROSSBOW"},
-    {1581489698u, "WEAPON_COMMON_DETONATOR001ARX"},
-    {2555683639u, "WEAPON_COMMON_DETONATOR001ARX_LOD0"},
-    {1354362967u, "WEAPON_COMMON_FAVENWEAPONS_SCOUTRIFLE001"},
-    {2390247076u, "WEAPON_COMMON_HEAVYCROSSBOW001"},
-    {1129441107u, "WEAPON_COMMON_KNIFE"},
-    {1671105602u, "WEAPON_COMMON_MAXFLAKCANNON001"},
-    {1232641049u, "WEAPON_COMMON_MAXFLAMETHROWER001"},
-    {2764198123u, "WEAPON_COMMON_MAXGRENADELAUNCHER"},
-    {114903740u, "WEAPON_COMMON_MEDICALAPPLICATOR"},
-    {1071421814u, "WEAPON_COMMON_NULLPARENT"},
-    {926578870u, "WEAPON_COMMON_REMOTEELECTRONICSKIT"},
-    {2209954070u, "WEAPON_COMMON_REPAIRTOOL"},
-    {228167708u, "WEAPON_COMMON_REVOLVER001"},
-    {2228420237u, "WEAPON_COMMON_REVOLVER005"},
-    {2645006889u, "WEAPON_COMMON_REVOLVER005_LOD0"},
-    {805864538u, "WEAPON_COMMON_ROCKETLAUNCHER"},
-    {530090605u, "WEAPON_COMMON_ROCKETLAUNCHER002"},
-    {4071192180u, "WEAPON_COMMON_ROCKETLAUNCHER002_LOD0"},
-    {1543946977u, "WEAPON_COMMON_ROCKETRIFLE"},
-    {2393600453u, "WEAPON_COMMON_ROCKETRIFLE_LOD0"},
-    {2577041220u, "WEAPON_COMMON_SKELETON"},
-    {1671001587u, "WEAPON_COMMON_SMG001"},
-    {252056241u, "WEAPON_COMMON_SNIPER02"},
-    {3351016511u, "WEAPON_COMMON_SNIPERRIFLE001"},
-    {1239505247u, "WEAPON_COMMON_SNIPERRIFLEBOLTDRIVER"},
-    {507584174u, "WEAPON_NC_AF41HACKSAW"},
-    {612126286u, "WEAPON_NC_KNIFE05"},
-    {3587576385u, "WEAPON_NC_KNIFE05_LOD0"},
-    {985115408u, "WEAPON_NC_LMG_SKELETON"},
-    {2144424870u, "WEAPON_NC_MAXANTIVEHICLE001"},
-    {1130413373u, "WEAPON_NC_MAXROCKETLAUNCHERLEFT001"},
-    {2000111793u, "WEAPON_NC_MAXROCKETLAUNCHERRIGHT001"},
-    {2255915291u, "WEAPON_NC_MINEBOUNCER001"},
-    {2732068263u, "WEAPON_NC_PISTOLMAG003"},
-    {2708013221u, "WEAPON_NC_PISTOLMAG_LOD0"},
-    {3920111186u, "WEAPON_NC_ROCKETLAUNCHER"},
-    {29567412u, "WEAPON_NC_ROCKETLAUNCHER002"},
-    {1664125525u, "WEAPON_NC_SHOTGUNJACKHAMMER001"},
-    {4138511950u, "WEAPON_NC_SMG002_SKELETON"},
-    {1040411483u, "WEAPON_NC_SNIPERRIFLEBOLTACTION001"},
-    {2366367635u, "WEAPON_PISTOLSHOTGUN_SKELETON"},
-    {3661399299u, "WEAPON_REGIONNAME_MINEBOOMER"},
-    {3260599896u, "WEAPON_REGIONNAME_MINEEMP"},
-    {3827891891u, "WEAPON_TR_CHAINGUN001"},
-    {2393888159u, "WEAPON_TR_CLAYMORE001"},
-    {879194671u, "WEAPON_TR_KNIFE04"},
-    {2794181090u, "WEAPON_TR_KNIFE04_LOD0"},
-    {3747836068u, "WEAPON_TR_LMG_SKELETON"},
-    {2727715993u, "WEAPON_TR_M2MUTILATORLEFT001"},
-    {2693271594u, "WEAPON_TR_M2MUTILATORLEFT001_LOD0"},
-    {3748233696u, "WEAPON_TR_M2MUTILATORRIGHT001"},
-    {1688152586u, "WEAPON_TR_M2MUTILATORRIGHT001_LOD0"},
-    {2108655618u, "WEAPON_TR_M6ONSLAUGHTLEFT001"},
-    {3990737116u, "WEAPON_TR_M6ONSLAUGHTLEFT001_LOD0"},
-    {605029380u, "WEAPON_TR_M6ONSLAUGHTRIGHT001"},
-    {356495221u, "WEAPON_TR_M6ONSLAUGHTRIGHT001_LOD0"},
-    {477864652u, "WEAPON_TR_MAXANTIINFANTRY001"},
-    {1824765190u, "WEAPON_TR_MAXANTIVEHICLELEFT001"},
-    {3246078305u, "WEAPON_TR_MAXANTIVEHICLERIGHT001"},
-    {4127184068u, "WEAPON_TR_MAXROCKETLAUNCHER001"},
-    {2346227292u, "WEAPON_TR_MRC3MERCYLEFT001"},
-    {200963513u, "WEAPON_TR_MRC3MERCYLEFT001_LOD0"},
-    {2540394430u, "WEAPON_TR_MRC3MERCYRIGHT001"},
-    {3915609608u, "WEAPON_TR_MRC3MERCYRIGHT001_LOD0"},
-    {1445532978u, "WEAPON_TR_PISTOL004_LOD0"},
-    {1470928497u, "WEAPON_TR_ROCKETLAUNCHER001"},
-    {3379526133u, "WEAPON_TR_ROCKETLAUNCHER002"},
-    {2477523247u, "WEAPON_TR_SNIPERBOLTACTION001"},
-    {2628469533u, "WEAPON_VS_BLUESHIFTVM5LEFT001"},
-    {978078741u, "WEAPON_VS_BLUESHIFTVM5LEFT001_LOD0"},
-    {47710441u, "WEAPON_VS_BLUESHIFTVM5RIGHT001_LOD0"},
-    {911498501u, "WEAPON_VS_KNIFE02"},
-    {1345487733u, "WEAPON_VS_KNIFE02_LOD0"},
-    {2788965591u, "WEAPON_VS_KNIFE04"},
-    {587088097u, "WEAPON_VS_LASHER001_SKELETON"},
-    {1047803429u, "WEAPON_VS_MAXFLAKCANNONLEFT001"},
-    {3072185269u, "WEAPON_VS_MAXFLAKCANNONRIGHT001"},
-    {522622077u, "WEAPON_VS_MAXROCKETLAUNCHER001"},
-    {1205071495u, "WEAPON_VS_PISTOLBEAMER"},
-    {553063763u, "WEAPON_VS_PISTOLBEAMER003"},
-    {213536010u, "WEAPON_VS_PISTOLBEAMERHEAVY002"},
-    {2924715602u, "WEAPON_VS_PROXIMITYMINE"},
-    {14793289u, "WEAPON_VS_ROCKETLAUNCHER"},
-    {663227585u, "WEAPON_VS_ROCKETLAUNCHER002"},
-    {1463923475u, "WEAPON_VS_SHOTGUNPUMP001_SKELETON"},
-    {1726767172u, "WEAPON_VS_SKELETON"},
-    {364301239u, "WEAPON_VS_SMG001_SKELETON"},
-    {503403635u, "WEAPON_VS_SMG002_SKELETON"},
-    {3517958110u, "WEAPON_VS_SNIPERRIFLE004_SKELETON"},
-    {2118432348u, "WEST"},
-    {1075982656u, "WESTARM"},
-    {2529748557u, "WESTJOINT"},
-    {479761161u, "WESTPANEL"},
-    {2726916658u, "WORLDROOT"},
-    {2102567500u, "WORLD_ROOT"},
-    {2405304143u, "YAW"},
-    {2619700730u, "YAWPROP2_L"},
-    {1971300527u, "YAWPROP2_R"},
-    {3546266377u, "YAWPROP_L"},
-    {411682144u, "YAWPROP_R"},
-    {843617178u, "YAWRECOIL"},
-    // Weird bastion cannon name hashes
-    {1923000924u, "BARREL"},
-    {3098565902u, "PITCH"},
-    {4220085123u, "WORLDROOT"},
-    {119272585u, "YAW"},
-    {1731449576u, "YAWRECOIL"},
-};
+static constexpr perfect_hash::Table<std::string_view, 375, 1500> bone_name_table = {{
+    {
+        2u, 19u, 141u, 0u, 3u, 2u, 8u, 39u,
+        31u, 69u, 19u, 1u, 10u, 0u, 27u, 1u,
+        69u, 2u, 164u, 16u, 5u, 1u, 72u, 30u,
+        6u, 2u, 12u, 54u, 34u, 1u, 16u, 20u,
+        3u, 6u, 101u, 89u, 280u, 3u, 19u, 19u,
+        7u, 12u, 69u, 31u, 33u, 139u, 13u, 726u,
+        169u, 235u, 5u, 67u, 3u, 3u, 387u, 99u,
+        27u, 2u, 2u, 35u, 97u, 1u, 8u, 20u,
+        1u, 55u, 105u, 38u, 2u, 489u, 10u, 10u,
+        1u, 20u, 2u, 8u, 1u, 24u, 11u, 1u,
+        1u, 57u, 0u, 109u, 59u, 64u, 14u, 14u,
+        5u, 36u, 11u, 7u, 17u, 62u, 1u, 4u,
+        265u, 37u, 7u, 231u, 2u, 9u, 252u, 45u,
+        2u, 128u, 22u, 16u, 24u, 722u, 3u, 81u,
+        597u, 17u, 12u, 39u, 39u, 245u, 9u, 35u,
+        10u, 342u, 2u, 16u, 5u, 21u, 29u, 10u,
+        35u, 23u, 24u, 4u, 5u, 2u, 15u, 2u,
+        36u, 96u, 287u, 4u, 320u, 32u, 2u, 145u,
+        5u, 87u, 22u, 158u, 5u, 47u, 30u, 187u,
+        61u, 0u, 139u, 6u, 102u, 29u, 5u, 160u,
+        484u, 1u, 31u, 104u, 13u, 44u, 452u, 70u,
+        91u, 3u, 0u, 97u, 14u, 484u, 56u, 105u,
+        207u, 131u, 97u, 33u, 14u, 799u, 209u, 10u,
+        115u, 14u, 4u, 98u, 0u, 386u, 264u, 13u,
+        81u, 177u, 1004u, 84u, 3u, 178u, 317u, 21u,
+        107u, 44u, 1u, 87u, 11u, 1u, 123u, 0u,
+        0u, 279u, 25u, 292u, 10u, 1u, 946u, 1009u,
+        1u, 13u, 23u, 44u, 410u, 437u, 55u, 586u,
+        0u, 4u, 29u, 83u, 287u, 51u, 79u, 16u,
+        29u, 740u, 180u, 489u, 3u, 88u, 408u, 3u,
+        19u, 1u, 57u, 895u, 1u, 12u, 206u, 5u,
+        170u, 9u, 3u, 138u, 2u, 1116u, 37u, 184u,
+        1u, 120u, 4u, 16u, 1100u, 361u, 1u, 1u,
+        1u, 2079u, 5u, 4u, 1u, 4u, 50u, 339u,
+        2404u, 231u, 35u, 40u, 0u, 301u, 42u, 3u,
+        104u, 3u, 21u, 63u, 38u, 17u, 6u, 13u,
+        1437u, 197u, 195u, 31u, 383u, 53u, 81u, 3u,
+        1549u, 76u, 8u, 0u, 137u, 163u, 2093u, 2u,
+        159u, 64u, 75u, 15u, 108u, 636u, 93u, 96u,
+        170u, 86u, 5u, 783u, 3876u, 248u, 2u, 101u,
+        90u, 68u, 9u, 491u, 337u, 229u, 21u, 127u,
+        0u, 576u, 3079u, 38u, 88u, 6u, 840u, 26u,
+        172u, 177u, 7u, 1183u, 28u, 10u, 373u, 159u,
+        5u, 995u, 91u, 3423u, 1159u, 131u, 58u, 2u,
+        2u, 318u, 2u, 36u, 3068u, 2u, 94u, 3u,
+        115u, 3u, 1358u, 0u, 27u, 2u, 33u, 741u,
+        5u, 757u, 346u, 3163u, 765u, 41u, 2134u,
+    }
+}, {
+    {
+        {1900803227u, "L_HIP"},
+        {1109437397u, "CLIPRELEASE"},
+        {3968508958u, "VEHICLE_COMMON_LIGHTNING_WEAPON_100MMCANNON"},
+        {2833781082u, "R_ENGINEVENTFLAPF"},
+        {4257022119u, "SHELL4"},
+        {3216727789u, "L_WRIST"},
+        {333254182u, "ACTIONUPPERFRONT"},
+        {3825466517u, "R_WHEEL6_DEPLOYSPIKE6"},
+        {1631065091u, "R_WHEEL7"},
+        {1515199228u, "R_WHEEL1_DEPLOYSPIKE4"},
+        {638623093u, "ACTION7"},
+        {235598279u, "VEHICLE_NC_VANGUARD_WEAPON_PSA_MAINCANNON001_LOD0"},
+        {3559972623u, "LEFT_BUTTON03"},
+        {1226732060u, "L_TOP_BOX03"},
+        {2022858524u, "L_OUTERFLAP"},
+        {3831875288u, "LOWERVENTS"},
+        {228672864u, "HINGE1A"},
+        {2555683639u, "WEAPON_COMMON_DETONATOR001ARX_LOD0"},
+        {3218433468u, "R_BOTTOMHOUSING"},
+        {233509630u, "HEAD_END"},
+        {1061283032u, "R_WHEEL1_DEPLOYSPIKE1"},
+        {4154815552u, "L_WHEEL1_DEPLOYSPIKE6"},
+        {78710034u, "VEHICLE_COMMON_WEAPON_50CALMACHINEGUN"},
+        {2097374758u, "ROUND4"},
+        {1409119795u, "L_HATCH_TOP"},
+        {2121297440u, "PIN"},
+        {2925873445u, "PART1"},
+        {4222341536u, "R_LOWERSUSPENSION"},
+        {2059202853u, "FRONTSLIDE"},
+        {533703831u, "WEAPONS_NC_DOKUWEAPONS_SMG001"},
+        {1557672612u, "VEHICLE_COMMON_AUTOTURRET_GROUNDANTIAIRROCKETLAUNCHER"},
+        {1833668386u, "R_WHEEL6_DEPLOYSPIKE7"},
+        {3155071899u, "R_WHEEL12_TRANSLATE"},
+        {2964579934u, "L_WHEEL1_DEPLOYSPIKE2"},
+        {2046112361u, "TOP_DISC"},
+        {879194671u, "WEAPON_TR_KNIFE04"},
+        {2335091557u, "R_KNOB_TRANSLATE"},
+        {3570374500u, "B_FOOT_SPIKES"},
+        {3900869694u, "ACTIONUPPERMID"},
+        {3092136803u, "CAMERA"},
+        {123937363u, "L_REARGEAR3"},
+        {2328021520u, "R_WHEEL6_DEPLOYSPIKE1"},
+        {1470928497u, "WEAPON_TR_ROCKETLAUNCHER001"},
+        {3852823428u, "CLIPBOLT5"},
+        {1504464692u, "COMMON_DPO_PLACEABLES_REINFORCEMENTMOD"},
+        {1135174062u, "VEHICLE_COMMON_QUAD_WEAPON_PULSEDPARTICLEACCELERATOR"},
+        {1920496009u, "HINGE3B"},
+        {2060981379u, "TOPFRONTLEGHINGEB"},
+        {2050050574u, "HEADING"},
+        {713393451u, "L_BOTTOMBARREL"},
+        {4036987088u, "FRONTSUPPORT3"},
+        {3115305158u, "CHAIN16"},
+        {3893742285u, "VEHICLE_NC_VANGUARD_WEAPON_150MMARTILLERYCANNON"},
+        {2047664273u, "POWERCELL01"},
+        {2896946475u, "BRAKE"},
+        {1950455942u, "L_SHELL2"},
+        {620852943u, "ARMYAW"},
+        {4278077365u, "BULLET13"},
+        {3434624319u, "JOINT8"},
+        {1654582506u, "VEHICLE_COMMON_WEAPON_20MMVEHICLETURRET"},
+        {3702738401u, "R_WHEEL7_TRANSLATE"},
+        {350780193u, "ACTION8"},
+        {4289252862u, "R_REARGEARB"},
+        {783937113u, "REARGEAR5"},
+        {2266553668u, "L_ELBOW"},
+        {534250172u, "REARSUPPORT2"},
+        {4092785520u, "AMMO5"},
+        {1026417588u, "POWERCORE_BASE01"},
+        {619080913u, "TOPREARENGINEFLAPG"},
+        {1947478600u, "L_BOTTONREARLEGHINGE"},
+        {1521744347u, "COMMON_STRUCTURES_FACILITYAMPSTATION_SPIRE"},
+        {1561737944u, "R_REARVENTS"},
+        {812161446u, "R_MIDDLEA"},
+        {2405304143u, "YAW"},
+        {3960042465u, "JOINT6"},
+        {2688920358u, "EJECT02"},
+        {2372092970u, "R_FRONTGEAR3"},
+        {1232641049u, "WEAPON_COMMON_MAXFLAMETHROWER001"},
+        {3928456489u, "BULLET5"},
+        {353047735u, "L_BARRELSIDELAYER1_END"},
+        {2407057340u, "JOINT24"},
+        {2514353650u, "R_BARRELSIDELAYER1_END"},
+        {1674585019u, "FRONTGEARSUPPORT"},
+        {1755079925u, "COMMON_PROPS_SNAPONS_CONTROL_COMM_ROOF"},
+        {4055724013u, "VEHICLE_NC_VANGUARD_WEAPON_RAILCANNON"},
+        {295177829u, "R_WHEEL1_TRANSLATE"},
+        {1845483130u, "HANDLEBARS"},
+        {2086900598u, "L_ENGINEVENTFLAPF"},
+        {967928455u, "BOTTOMREARENGINEFLAPH"},
+        {1130413373u, "WEAPON_NC_MAXROCKETLAUNCHERLEFT001"},
+        {1636290156u, "SIDEDOORSA"},
+        {2818173706u, "R_BACKSHOCKB_TOP"},
+        {3966357689u, "LEFT_BELT009"},
+        {2454703298u, "POWERCORE03"},
+        {1049972350u, "ACTION9"},
+        {796974426u, "F_FOOT_INSIDETOES_END"},
+        {2145467758u, "R_OUTERTHRUSTERPANELB"},
+        {1337961391u, "PUMP"},
+        {3332107390u, "WEAPONS_NC_MAXAF34MATTOCKRIGHT"},
+        {3245646627u, "CLIPBOLT3"},
+        {2841302556u, "L_BARRELSIDELAYER2"},
+        {1445532978u, "WEAPON_TR_PISTOL004_LOD0"},
+        {1024671026u, "REARSUPPORT1"},
+        {928233583u, "BULLET18"},
+        {2895421296u, "FRONTSTABILIZER"},
+        {102955111u, "REARFLAPS"},
+        {1463923475u, "WEAPON_VS_SHOTGUNPUMP001_SKELETON"},
+        {4020787006u, "R_WHEEL9_TRANSLATE"},
+        {529246599u, "FRONTGEAR1"},
+        {1732281932u, "L_REARDISK"},
+        {724094749u, "L_MIDDLEA"},
+        {2366367635u, "WEAPON_PISTOLSHOTGUN_SKELETON"},
+        {483746111u, "JOINT15"},
+        {4029639481u, "R_GEARB"},
+        {2009555957u, "WEAPONS_NC_DOKUWEAPONS_SNIPERRIFLE001_LOD0"},
+        {113224493u, "R_CLAVICLE"},
+        {1368413764u, "L_FLAP"},
+        {1025849218u, "SPINDLE"},
+        {376084722u, "ROUND5"},
+        {2645006889u, "WEAPON_COMMON_REVOLVER005_LOD0"},
+        {613580553u, "L_WHEEL6_DEPLOYSPIKE8"},
+        {86245637u, "L_STEERINGLINKINNER"},
+        {2830230666u, "PANELHINDGE03"},
+        {3380132775u, "JOINT20"},
+        {1027681439u, "BLADEBASE"},
+        {2672750597u, "COMMON_PROPS_AMPWATERTANKS_WATERPUMP"},
+        {3696658942u, "ACTION6"},
+        {2173355228u, "R_TOPCANISTER"},
+        {3366755556u, "AMMO6"},
+        {2111186039u, "JOINT25"},
+        {722503334u, "VEHICLE_COMMON_SUNDERER_ATTACHMENT_SMOKESTACK001"},
+        {520663189u, "FRONTRAIL"},
+        {1804676446u, "COMMON_DPO_PLACEABLES_MODULE_DESTROYED_LOD0"},
+        {605820305u, "VEHICLE_COMMON_WEAPON_FLAKBALLTURRET"},
+        {151225539u, "WEAPONS_TR_DOKUWEAPONS_LGM001"},
+        {714964964u, "L_REARTHRUSTER1"},
+        {2001947653u, "R_WING"},
+        {3804343905u, "ROOTBONE"},
+        {522622077u, "WEAPON_VS_MAXROCKETLAUNCHER001"},
+        {185091786u, "PCUBE13"},
+        {4005736250u, "R_WHEEL2_TRANSLATE"},
+        {1287964149u, "L_LOADER"},
+        {802037369u, "R_FLAP"},
+        {3004123225u, "EJECT"},
+        {3786294626u, "R_REARGEARDOOR2"},
+        {3345004119u, "JOINT17"},
+        {2585526967u, "WEAPONATTACHMENT_NS_APROUND_001"},
+        {4157307685u, "L_FOREARM"},
+        {3357634932u, "RIGHT_BELT001"},
+        {2959853441u, "L_BOTTOMHOUSING"},
+        {87575790u, "VEHICLE_COMMON_GALAXY"},
+        {1813333154u, "POWERCELL02"},
+        {3827891891u, "WEAPON_TR_CHAINGUN001"},
+        {319233523u, "LEFT_BELT004"},
+        {3240810951u, "VEHICLE_COMMON_LIGHTNING_WEAPON_SKYGUARDCANNON"},
+        {2223289680u, "R_WHEEL4_TRANSLATE"},
+        {20902711u, "L_FRONTSUPPORT"},
+        {4058873060u, "R_FRONTPLATE"},
+        {2020612540u, "BULLET6"},
+        {2182042677u, "VEHICLE_COMMON_ANT_WEAPON_MININGTURRET"},
+        {1806637269u, "VEHICLE_COMMON_FACILITYTURRET_TANKCANNON"},
+        {4230965472u, "L_REARFLAP"},
+        {2869778529u, "PART15"},
+        {1689559053u, "VEHICLE_COMMON_LIBERATOR"},
+        {764979090u, "REARAXLE"},
+        {3312143588u, "R_OUTERFLAP"},
+        {2739719056u, "L_WHEEL1_DEPLOYSPIKE3"},
+        {503403635u, "WEAPON_VS_SMG002_SKELETON"},
+        {2227538362u, "RECOIL"},
+        {3126035858u, "REARGEAR3"},
+        {2915443750u, "BULLET21"},
+        {1481063746u, "R_REARGEARDOOR"},
+        {3344407534u, "VEHICLE_COMMON_QUAD_WEAPON_30MMGUN"},
+        {3494178611u, "R_REARGEAR3"},
+        {3458403359u, "L_REARSUSPENSION"},
+        {3619289854u, "L_RUDDER"},
+        {673389254u, "R_WHEEL11_ROTATE"},
+        {595527074u, "SMALLBARREL2"},
+        {338607862u, "LOADACTION"},
+        {1020427985u, "SHELL5"},
+        {1456985596u, "BATTERYCHAMBERPIN"},
+        {17223862u, "R_REARGEAR1"},
+        {2781236066u, "COMMON_DPO_PLACEABLES_MODULE_DESTROYED_COL"},
+        {2377346750u, "FRONTACTION"},
+        {2260913404u, "R_ENGINEVENTFLAPB"},
+        {1368062130u, "BLADEMID"},
+        {2469390626u, "R_SHELL2"},
+        {1856204695u, "LARGEBLADE"},
+        {2557924012u, "RING2"},
+        {2828022438u, "LOADACTION3"},
+        {1205209995u, "R_VENT"},
+        {587088097u, "WEAPON_VS_LASHER001_SKELETON"},
+        {1239505247u, "WEAPON_COMMON_SNIPERRIFLEBOLTDRIVER"},
+        {2770105108u, "BULLET9"},
+        {1456667981u, "R_TOP_BOX03"},
+        {3809288696u, "VEHICLE_COMMON_QUAD_ATTACHMENT_ANTENNA"},
+        {2645365644u, "TOPPANEL03"},
+        {2163166549u, "R_FLAPPER"},
+        {642363752u, "L_FORWARDDISK"},
+        {4224834756u, "VEHICLE_TR_PROWLER_WEAPON_ESAV002"},
+        {2416601835u, "PHYSICS2"},
+        {2210481234u, "LARGEBARREL"},
+        {563530995u, "R_SPIKEINSIDE"},
+        {2590276672u, "R_STEERINGPIVOT"},
+        {3942524321u, "R_TOP_BOX01"},
+        {1462638923u, "UPPERDOOR1"},
+        {808899809u, "VEHICLE_COMMON_HEAVYFIGHTER_BASE_CHASSIS"},
+        {3072185269u, "WEAPON_VS_MAXFLAKCANNONRIGHT001"},
+        {1354362967u, "WEAPON_COMMON_FAVENWEAPONS_SCOUTRIFLE001"},
+        {237617448u, "R_WHEEL6_ROTATE"},
+        {1027406518u, "L_GEARC"},
+        {850569389u, "R_SPIKEOUTSIDE"},
+        {3846497591u, "L_ENGINEVENTFLAPG"},
+        {3639903371u, "R_FRONTSUPPORT"},
+        {1103754588u, "LEFT_BELT0011"},
+        {428356429u, "L_GEARA"},
+        {175089113u, "WEAPONATTACHMENT_COMMON_CLIP_THUMPER001"},
+        {3337782962u, "L_MIDDLEC"},
+        {3708936486u, "R_REARSUSPENSION"},
+        {2201033226u, "R_STEERINGLINK"},
+        {2696433044u, "MAINBOLT"},
+        {2523414519u, "PANELHINDGE01"},
+        {3800032069u, "R_BOTTOMVENTS"},
+        {4012739269u, "MAINHINDGE04"},
+        {3860416703u, "R_THUMBC"},
+        {2670825306u, "L_FRONTSIDESTABILIZER"},
+        {3584631159u, "L_WHEEL5_ROTATE"},
+        {3474656460u, "BACKLEAF"},
+        {3693662948u, "R_PINKYC"},
+        {1400340987u, "SNIPER_SCOPE"},
+        {1611614878u, "R_VENT_END"},
+        {4099058003u, "ACTION"},
+        {1339986313u, "LEFT_BELT0012"},
+        {3621843591u, "R_SHELL4"},
+        {1871666790u, "RIGHT_BUTTON03"},
+        {1275472689u, "VEHICLE_COMMON_QUAD_WEAPON_40MMGUN"},
+        {1629531745u, "ROUND2"},
+        {589402908u, "L_WHEEL7_TRANSLATE"},
+        {2134928656u, "R_FRONTAXLE"},
+        {1458068209u, "STEERING"},
+        {1803205969u, "R_WHEEL1_DEPLOYSPIKE3"},
+        {215562287u, "L_CYLINDERDN"},
+        {1664125525u, "WEAPON_NC_SHOTGUNJACKHAMMER001"},
+        {3535838163u, "END_R_TOP_CANNISTER02"},
+        {647525950u, "R_LATCHCLIPS"},
+        {2357602519u, "L_TOE"},
+        {2286030167u, "R_FRONTGEARDOOR1"},
+        {3195582723u, "L_FRONTGEARDOOR2"},
+        {2945904176u, "VEHICLE_COMMON_ENGINEERDEPLOYABLE_WEAPON_MACHINEGUN"},
+        {461250893u, "FAN2"},
+        {2811192773u, "COMMON_DPO_PLACEABLES_DOMESHIELDEMITTER001"},
+        {1839578142u, "EASTJOINT"},
+        {2558765017u, "R_THRUSTER1"},
+        {2628469533u, "WEAPON_VS_BLUESHIFTVM5LEFT001"},
+        {2708013221u, "WEAPON_NC_PISTOLMAG_LOD0"},
+        {3278587725u, "R_FRONTSHOCKB_TOP"},
+        {3839060481u, "R_UPPERSUSPENSION"},
+        {3563932260u, "L_FOOT"},
+        {46896897u, "STRAIGHT_PULL"},
+        {3031470467u, "R_WHEEL12_ROTATE"},
+        {3523137644u, "MAINHINDGE02"},
+        {609720100u, "LOWERDOOR2"},
+        {3955064620u, "BARREL1"},
+        {3312333887u, "TURBINE"},
+        {4104846447u, "L_WINGFAN"},
+        {2499881490u, "R_WEAPON"},
+        {1034073114u, "R_MIDDLEB"},
+        {3968009904u, "R_WHEEL6_DEPLOYHUB"},
+        {2421277503u, "FOREWARDGRIP"},
+        {1805501275u, "ROUND3"},
+        {3570825082u, "FORWARDGRIP_SOCKET"},
+        {2072860801u, "PELVIS"},
+        {2007480715u, "INDAR_PROPS_VENTS_FANLARGESINGLE"},
+        {805042209u, "WEAPONS_VS_DOKUWEAPONS_SMG001"},
+        {283172278u, "COMMON_DPO_PLACEABLES_MODULE_LOD0"},
+        {931849578u, "ARM5"},
+        {2353688199u, "L_FRONTPLATE"},
+        {805864538u, "WEAPON_COMMON_ROCKETLAUNCHER"},
+        {1011550294u, "BARRELRECOIL4"},
+        {1635267284u, "L_BOTTOMTUBE"},
+        {4043274857u, "ACTION10"},
+        {3474194013u, "L_SMALLPULLY"},
+        {4140843785u, "L_THRUSTER"},
+        {3197937172u, "BULLET3"},
+        {1014941510u, "WEAPONS_TR_DOKUWEAPONS_SMG001"},
+        {2688535938u, "L_SPIKEOUTSIDE"},
+        {773499562u, "LOWERDOOR3"},
+        {3645328989u, "JOINT5"},
+        {2225632319u, "UPPERDOOR2"},
+        {2058541621u, "EJECTION_PORT_COVER"},
+        {3069185626u, "PITCHPROP_L"},
+        {4181793464u, "FRONTCENTERSPINOUTER"},
+        {1622762646u, "VEHICLE_TR_PROWLER_BASE_CHASSIS"},
+        {3593922608u, "L_WHEEL7_ROTATE"},
+        {2348369865u, "BOTTOMRAIL_SOCKET"},
+        {1580348024u, "BARREL_SOCKET"},
+        {3798211410u, "CHAIN08"},
+        {3649043221u, "R_REARWHEELPIVOT"},
+        {3854168841u, "JOINT11"},
+        {3645478496u, "WEAPONATTACHMENT_TR_GRENADELAUNCHER_001"},
+        {1116911325u, "VEHICLE_NC_REAVER"},
+        {552300096u, "MAINHINDGE03"},
+        {2027020606u, "FRONTCHASSIS"},
+        {4096234345u, "L_CYLINDEREXTEND_END"},
+        {3180974149u, "REARFANPIVOT"},
+        {2739289683u, "R_SHIELDARM"},
+        {957797217u, "RIGHT_BELT009"},
+        {2270971168u, "VEHICLE_COMMON_LIGHTNING"},
+        {2011106085u, "R_BARRELROTATION"},
+        {1124983827u, "VEHICLE_COMMON_QUAD_WEAPON_ROCKETLAUNCHERNC"},
+        {1706108145u, "L_THRUSTERFLAP2"},
+        {440159458u, "ACTION15"},
+        {2059895067u, "AMMO2"},
+        {752986672u, "CAMERA1_SOCKET"},
+        {1086468669u, "PCUBE12"},
+        {911498501u, "WEAPON_VS_KNIFE02"},
+        {407954794u, "L_THROTTLE"},
+        {2223369394u, "L_VENT"},
+        {1310993196u, "R_WRIST"},
+        {1719789456u, "R_PINKYA"},
+        {1004900499u, "L_BOTTOMVENTS"},
+        {4261665176u, "SPINUP"},
+        {3029105912u, "WEAPONS_VS_MAXCOSMOSVM3_RIGHT_LOD0"},
+        {3770474639u, "R_INDEXA"},
+        {382218229u, "R_WHEEL1_ROTATE"},
+        {23516190u, "ACTION5"},
+        {3916096451u, "R_FORWARDDISK"},
+        {1501527398u, "R_HOSE"},
+        {790266838u, "REARCENTERSPINOUTER"},
+        {2128246719u, "BUTTON"},
+        {1369013194u, "L_SHIELD"},
+        {688177653u, "L_WHEEL6_TRANSLATE"},
+        {2359474964u, "L_BARRELROTATION"},
+        {4014393635u, "EJECT01"},
+        {156469500u, "ARM2"},
+        {1051777569u, "L_GEARSUPPORTB"},
+        {1370311378u, "ACTIVE"},
+        {1166594346u, "R_SHOCKLOWER"},
+        {465715614u, "ROTATECHAMBER"},
+        {981661514u, "PART13"},
+        {553063763u, "WEAPON_VS_PISTOLBEAMER003"},
+        {1742480668u, "CHAIN13"},
+        {1949356297u, "FRONTTOPSHOCKMOUNT"},
+        {3930207657u, "L_INDEXC"},
+        {726139324u, "VEHICLE_COMMON_ENGINEERDEPLOYABLE_WEAPON_ROCKETPOD"},
+        {1401298368u, "REARCYLINDER"},
+        {2102567500u, "WORLD_ROOT"},
+        {3264788844u, "L_MIDAXLE"},
+        {2494892700u, "RIGHT_BELT003"},
+        {1439523659u, "R_SUPPORT2"},
+        {4084711100u, "CHAMBERASSIST"},
+        {1928556915u, "AMMO0"},
+        {705922756u, "R_STABILIZER"},
+        {3054322045u, "CHAIN10"},
+        {3740866747u, "BACKSIDES"},
+        {2759003112u, "REARSUPPORT5"},
+        {2799841014u, "RIGHT_BELT002"},
+        {3648912357u, "COMMON_STRUCTURES_BOXOFDESTINY_BLASTDOORS01"},
+        {1312622786u, "PART9"},
+        {1973133798u, "LEFT_BUTTON05"},
+        {658413182u, "R_BARRELSIDELAYER1"},
+        {1001341975u, "EMISSIVE"},
+        {268260591u, "L_OUTERTHRUSTERPANELB"},
+        {2900915387u, "WEAPONATTACHMENT_NC_GRENADELAUNCHER_001"},
+        {2126722038u, "HARDPOINT1"},
+        {3907744388u, "R_WHEEL5_ROTATE"},
+        {1040411483u, "WEAPON_NC_SNIPERRIFLEBOLTACTION001"},
+        {1635783371u, "R_STEERINGLINKOUTER"},
+        {445974206u, "R_WHEEL2"},
+        {1253436212u, "WEAPONS_COMMON_FAVENWEAPONS_SMG001_LOD0"},
+        {2081596213u, "L_WHEEL3"},
+        {2187252056u, "VEHICLE_COMMON_LIBERATOR_WEAPON_75MMCANNON"},
+        {1282964672u, "L_THUMBB"},
+        {1710092884u, "L_FRONTFLAP"},
+        {2696709208u, "FRONTPITCH"},
+        {3903399900u, "CHAIN09"},
+        {2163878423u, "POWERCORE02"},
+        {47710441u, "WEAPON_VS_BLUESHIFTVM5RIGHT001_LOD0"},
+        {4060706981u, "SPINELOWER"},
+        {338710066u, "SPIREPANELS"},
+        {4023945082u, "BARREL2"},
+        {3245907420u, "VEHICLE_NC_REAVER_WEAPON_20MMGATLINGCANNON001"},
+        {3126493516u, "VEHICLE_COMMON_LIBERATOR_WEAPON_REAR30MMQUADGATLING"},
+        {3135934884u, "JOINT7"},
+        {4021302725u, "R_HATCH_TOP_END"},
+        {2788965591u, "WEAPON_VS_KNIFE04"},
+        {3831889766u, "R_KNOB_ROTATE"},
+        {1044163086u, "VEHICLE_NC_VANGUARD"},
+        {1146262846u, "HINGE3C"},
+        {2086501834u, "SHELL2"},
+        {1828274654u, "TRAJECTORY"},
+        {418620215u, "RIGHT_FLAP"},
+        {2257917057u, "VEHICLE_COMMON_WEAPON_40MMGRENADELAUNCHER_TWOBARREL"},
+        {4006501473u, "R_MAINPULLY"},
+        {2852062249u, "DEPLOYFRONT2"},
+        {3216344818u, "L_SHIELDARM"},
+        {3661491418u, "VEHICLE_VS_MAGRIDER_WEAPON_PLASMACANNON002"},
+        {1043307679u, "CLIPBOLT2"},
+        {2145023363u, "PCYLINDER39"},
+        {2092477833u, "END_R_TOP_BOX03"},
+        {3487385081u, "AXLEBACK"},
+        {4282203036u, "WEAPONS_COMMON_FAVENWEAPONS_SMG001_OLD"},
+        {1217736659u, "L_GEARDOOR"},
+        {3200203840u, "COMMON_PROPS_GAMEPLAYOBJECTS_AMMODEPOT"},
+        {2561181064u, "HOODVENTS"},
+        {948966460u, "TOPREARENGINEFLAPE"},
+        {535552533u, "L_BACKSIDESTABILIZER"},
+        {25668312u, "BARREL3"},
+        {1175513397u, "L_BACKSHOCKA_TOP"},
+        {3290958398u, "R_WINGPULLY"},
+        {2759084079u, "RIGHT_BUTTON04"},
+        {1423048752u, "CHAIN01"},
+        {2636646231u, "CLIP_RELEASE"},
+        {2970756967u, "R_ELBOW"},
+        {3240526583u, "VEHICLE_COMMON_AUTOTURRET_BASE_TURRET_WASP"},
+        {4244503350u, "L_FRONTSHOCKA_TOP"},
+        {550959014u, "L_WHEEL6_DEPLOYSPIKE6"},
+        {2492699346u, "R_INDEX_END"},
+        {2753555083u, "L_FRONTPANEL2"},
+        {2619700730u, "YAWPROP2_L"},
+        {1726767172u, "WEAPON_VS_SKELETON"},
+        {2345600056u, "VEHICLE_COMMON_WEAPON_85MMRECOILLESSRIFLETURRET"},
+        {2989762410u, "REARSUPPORT4"},
+        {3986162229u, "R_WHEEL8_TRANSLATE"},
+        {114903740u, "WEAPON_COMMON_MEDICALAPPLICATOR"},
+        {187755755u, "CHAIN07"},
+        {3080831125u, "ACTION4"},
+        {843617178u, "YAWRECOIL"},
+        {768395665u, "R_REARDISK"},
+        {3149788146u, "R_SIDELOCK_BACK_END"},
+        {4285130512u, "R_CYLINDERUP"},
+        {1580359821u, "R_BACK_CANNISTER02"},
+        {1047768032u, "R_TOPREARLEGHINGE"},
+        {4073028489u, "R_BACKSHOCKB"},
+        {4094656420u, "RAIL"},
+        {3485647419u, "POLYSURFACE31"},
+        {4001712163u, "R_FRONTSUPPORT1"},
+        {665402223u, "ROUND6"},
+        {1543946977u, "WEAPON_COMMON_ROCKETRIFLE"},
+        {932016844u, "L_THRUSTERFLAP"},
+        {2670171062u, "CHAIN17"},
+        {452865105u, "ARM3"},
+        {1102577659u, "R_THUMBA"},
+        {3621332160u, "L_HANDLE"},
+        {1189247508u, "L_SMOKESTACK"},
+        {3423179401u, "LEFTCHAMBERHATCH"},
+        {1965938483u, "L_THUMB_END"},
+        {4117152087u, "CHAIN06"},
+        {3261557537u, "R_WHEEL1_DEPLOYSPIKE8"},
+        {152551772u, "R_WHEEL8_ROTATE"},
+        {3061072950u, "SPINEUPPER"},
+        {411682144u, "YAWPROP_R"},
+        {1806804023u, "VEHICLE_TR_PROWLER_WEAPON_120MMARTILLERYCANNON"},
+        {612126286u, "WEAPON_NC_KNIFE05"},
+        {781444628u, "SLICE.005"},
+        {2701077784u, "R_FRONTSUPPORT2"},
+        {2234692128u, "WEAPONS_VS_MAXHEAVYMACHINEGUNLEFT001"},
+        {329644197u, "RIGHT_BELT0010"},
+        {304077368u, "L_WHEEL6_DEPLOYSPIKE3"},
+        {1082498163u, "SHELL12"},
+        {2366379834u, "EJECT1"},
+        {3131490264u, "L_FRONTVENT"},
+        {3812362030u, "R_BOTTONREARLEGHINGE"},
+        {3069215008u, "L_WHEEL2_TRANSLATE"},
+        {2346227292u, "WEAPON_TR_MRC3MERCYLEFT001"},
+        {2727715993u, "WEAPON_TR_M2MUTILATORLEFT001"},
+        {3290761224u, "L_OVERHEADDOOR2"},
+        {1025623836u, "R_REARVENT"},
+        {1382016971u, "REARSUPPORT3"},
+        {1554697778u, "DEPLOYFRONTCOVER"},
+        {1885538994u, "L_BACKSHOCKB"},
+        {1835960745u, "L_HATCH_TOP_END"},
+        {2870084370u, "FIREMODE"},
+        {959125743u, "ACTIONLOWERRAIL"},
+        {3200180919u, "FRONTGEARDOOR"},
+        {2708597823u, "VEHICLE_VS_MAGRIDER_WEAPON_HEAVYRAILBEAM001"},
+        {2658480396u, "REARFANTHRUST"},
+        {3536201255u, "END_L_TOP_CANNISTER02"},
+        {4217541411u, "L_CLAVICLE"},
+        {2625089554u, "BOTTOMREARENGINEFLAPB"},
+        {4230163536u, "END_R_TOP_BOX02"},
+        {1225820717u, "WEAPON_COMMON_AUTOPISTOL001"},
+        {3726394811u, "VEHICLE_COMMON_QUAD_BASE_COCKPIT"},
+        {1391831783u, "POWERCORESOCKET03"},
+        {2789536792u, "JOINT18"},
+        {2797473858u, "R_SHELL5"},
+        {3248592082u, "R_FAN"},
+        {1415649289u, "L_SUPPORT1"},
+        {1850032870u, "R_WHEEL1_DEPLOYSPIKE6"},
+        {421078535u, "LHULL"},
+        {3685814955u, "BULLET"},
+        {3684838406u, "L_FRONTGEAR4"},
+        {3487870079u, "ELBOWHINDGE04"},
+        {2961989026u, "L_WHEEL1_TRANSLATE"},
+        {1766919226u, "L_SIDEVENT1"},
+        {1990983807u, "PANELHINDGE04"},
+        {3592091344u, "VEHICLE_COMMON_RECONDRONE_BASE_CHASSIS"},
+        {3846570558u, "R_SUPPORT3"},
+        {3297912606u, "F_FOOT_INSIDETOES"},
+        {2466288220u, "PART3"},
+        {2598712176u, "L_WHEEL12_ROTATE"},
+        {1456372033u, "WEAPONS_VS_MAXNEBULAVM20_LEFT"},
+        {38813266u, "L_REARVENT"},
+        {1731449576u, "YAWRECOIL"},
+        {3270812084u, "JOINT9"},
+        {2429672886u, "L_FRONTGEARDOOR1"},
+        {339389002u, "L_SIDELOCK_BACK"},
+        {835718401u, "R_FRONTGEAR1"},
+        {2043243041u, "MALE"},
+        {3546266377u, "YAWPROP_L"},
+        {2982628385u, "L_FAN"},
+        {2129664872u, "NORTHJOINT"},
+        {2049782909u, "R_BALL"},
+        {537716927u, "BULLET1"},
+        {2622220442u, "L_SHELL4"},
+        {3208123503u, "R_BACKSHOCKA"},
+        {755919266u, "SIDERAIL_SOCKET"},
+        {117720990u, "L_SIDEVENT4"},
+        {2257473628u, "R_SIDELOCK_BACK"},
+        {3028336524u, "CHAIN02"},
+        {4154229687u, "FRONTAXLE"},
+        {3359901234u, "L_REARTHRUSTERFLAP"},
+        {2209626904u, "L_INDEX_END"},
+        {3204491284u, "HINGE1B"},
+        {3990737116u, "WEAPON_TR_M6ONSLAUGHTLEFT001_LOD0"},
+        {3604588876u, "R_BOTTOMTUBE"},
+        {3474386815u, "ACTION3"},
+        {4093695475u, "R_REARPANEL2"},
+        {2770017160u, "ACTION2"},
+        {3001437478u, "ACTIONSPIN"},
+        {29567412u, "WEAPON_NC_ROCKETLAUNCHER002"},
+        {4077360421u, "MUZZLE1"},
+        {3817013504u, "L_TOP_CANNISTER01"},
+        {3004272057u, "JOINT16"},
+        {764938613u, "F_LEG_PISTON"},
+        {1026710080u, "L_TOP_BOX02"},
+        {3062918367u, "L_OVERHEADDOOR1"},
+        {2108655618u, "WEAPON_TR_M6ONSLAUGHTLEFT001"},
+        {4074672627u, "END_L_TOP_BOX02"},
+        {792191633u, "ROD"},
+        {2871434844u, "EASTPANEL"},
+        {3426233346u, "F_FOOT_SPIKES_END"},
+        {504828295u, "VEHICLE_VS_SCYTHE_WEAPON_20MMGATLINGCANNON001"},
+        {628441807u, "LEFT_BELT005"},
+        {2982262173u, "L_WHEEL3_TRANSLATE"},
+        {1550770966u, "ELEVATOR"},
+        {14793289u, "WEAPON_VS_ROCKETLAUNCHER"},
+        {2479214695u, "BULLET8"},
+        {4072946546u, "R_FOOT_INSIDETOES_END"},
+        {810894083u, "L_MIDDLE_END"},
+        {1300136028u, "R_FRONTSTABILIZER"},
+        {564569974u, "HYDROLICFRONTTOP"},
+        {3992122647u, "IRONSIGHTBACK_SOCKET"},
+        {3169031338u, "VEHICLE_NC_REAVER_WEAPON_20MMGATLINGCANNON002"},
+        {391037130u, "BATTERYCHAMBER"},
+        {3620343033u, "PITCH"},
+        {929720993u, "VEHICLE_NC_VANGUARD_WEAPON_ANTIVEHICLETURRET01"},
+        {33859262u, "POLYSURFACE30"},
+        {2908721569u, "L_REARPANEL1"},
+        {1767831881u, "R_SMALLPULLY"},
+        {3260599896u, "WEAPON_REGIONNAME_MINEEMP"},
+        {882447423u, "L_WHEEL7"},
+        {1600924819u, "HANDLEBARS_L"},
+        {3613873764u, "JOINT10"},
+        {2758622649u, "L_FRONTGEAR1"},
+        {819009070u, "R_WHEEL6_DEPLOYSPIKE4"},
+        {243188882u, "JOINT14"},
+        {2850031842u, "PISTON03"},
+        {1749508038u, "L_LEG_PISTON"},
+        {4262467277u, "L_ENGINEVENTFLAPC"},
+        {3440751254u, "ACTION12"},
+        {1891975577u, "VEHICLE_COMMON_BUGGY_BASE_CHASSIS"},
+        {4019161365u, "L_BACKSHOCKA"},
+        {220791727u, "VEHICLE_COMMON_WEAPON_20MMBALLTURRET"},
+        {3202302196u, "L_WHEEL13_TRANSLATE"},
+        {3387633284u, "L_ENGINEVENTFLAPA"},
+        {3825361770u, "SHELL14"},
+        {1571532502u, "WEAPONS_VS_MAXCOSMOSVM3_RIGHT"},
+        {3188746918u, "B_FOOT_OUTSIDETOES"},
+        {4082459912u, "VEHICLE_COMMON_FACILITYTURRET_WEAPON_MISSILELAUNCHER"},
+        {3950397093u, "L_MIDPANEL2"},
+        {3055013529u, "BOTTOMFRONTLEGHINGE"},
+        {4186885183u, "VEHICLE_VS_MAGRIDER_WEAPON_ESAV002"},
+        {1205694702u, "RIGHT_BELT008"},
+        {2624511473u, "R_RINGC"},
+        {3116333173u, "PITCHRECOIL_L"},
+        {1803430031u, "R_WHEEL6"},
+        {567791785u, "COG"},
+        {3673823181u, "R_REARTHRUSTER"},
+        {1886890678u, "BULLET15"},
+        {237586392u, "NORTH"},
+        {1898469407u, "PCYLINDER38"},
+        {3586508350u, "R_FORWARDDISK2"},
+        {660457104u, "R_RELOADPIN"},
+        {3068421111u, "END_R_TOP_CANNISTER03"},
+        {695991093u, "REARACTION"},
+        {1336973505u, "L_BOTTOMCANISTER"},
+        {926578870u, "WEAPON_COMMON_REMOTEELECTRONICSKIT"},
+        {584112430u, "L_REARGEAR1"},
+        {3502752062u, "L_VENT_END"},
+        {3709128119u, "L_REARGEAR2"},
+        {1230749804u, "R_WHEEL10_TRANSLATE"},
+        {831760856u, "L_SPIKEINSIDE"},
+        {559175070u, "L_LOWERSUSPENSION"},
+        {2403210655u, "BOTTOMREARENGINEFLAPA"},
+        {1372798831u, "JOINT1"},
+        {2503452994u, "L_ARM"},
+        {1066474903u, "R_WHEEL2_ROTATE"},
+        {2722377586u, "UPPERDOOR4"},
+        {2413396637u, "L_HIPATTACH"},
+        {2443285297u, "DYNAMICDRING"},
+        {257870450u, "REARBAR"},
+        {2852643351u, "R_FRONTSHOCKB"},
+        {1837579329u, "RIGHT_BELT006"},
+        {622475301u, "R_REARPANEL1"},
+        {257357155u, "CHAIN04"},
+        {3270595576u, "LPOWERNODE"},
+        {931042330u, "R_RINGA"},
+        {507584174u, "WEAPON_NC_AF41HACKSAW"},
+        {1941569559u, "L_YAW2"},
+        {1857195332u, "ROTATE2"},
+        {4003831577u, "R_INNERFLAP"},
+        {2995209657u, "L_REARWHEELPIVOT"},
+        {2692352206u, "L_HOSE"},
+        {3217677901u, "R_OVERHEADDOOR1"},
+        {1779413271u, "R_FOOT_OUTSIDETOES_END"},
+        {1263186429u, "SHELL11"},
+        {476502330u, "R_BACKSIDESTABILIZER"},
+        {1076734396u, "R_FRONTGEAR2"},
+        {3517958110u, "WEAPON_VS_SNIPERRIFLE004_SKELETON"},
+        {1769359068u, "WEAPON_COMMON_CROSSBOW"},
+        {3351016511u, "WEAPON_COMMON_SNIPERRIFLE001"},
+        {326115248u, "HOSE2C"},
+        {1690090417u, "WEAPONS_COMMON_THUMPER001"},
+        {3351494366u, "B_FOOT"},
+        {928534160u, "L_TOP_BOX04"},
+        {2581087731u, "R_PISTON"},
+        {538760882u, "BARRELTOPLEFT"},
+        {1832843225u, "BOX.025"},
+        {985115408u, "WEAPON_NC_LMG_SKELETON"},
+        {3653275918u, "CHARGEHALF"},
+        {3681461710u, "VEHICLE_COMMON_QUAD_WEAPON_50CALGUN"},
+        {2192524473u, "R_WHEEL11_TRANSLATE"},
+        {3379526133u, "WEAPON_TR_ROCKETLAUNCHER002"},
+        {2634919170u, "L_WINGVENTS"},
+        {4228329408u, "R_SUPPORT4"},
+        {3782241303u, "R_FRONTSHOCKUPPER"},
+        {524728837u, "L_KNEE"},
+        {1733261739u, "L_WHEEL6"},
+        {3125439334u, "R_THRUSTER3"},
+        {2102299048u, "L_WHEEL9_ROTATE"},
+        {726996523u, "L_WHEEL4_ROTATE"},
+        {1448615591u, "PLATE"},
+        {718505439u, "B_LEG_PISTON"},
+        {1202008678u, "TOPREARENGINEFLAPH"},
+        {1442972739u, "CLUTCH"},
+        {3454518758u, "HINGE1C"},
+        {1073302274u, "R_PEDAL"},
+        {1673327505u, "L_DEPLOY_MECANISM"},
+        {165726974u, "L_REARSHOCKLOWER"},
+        {148150983u, "R_BACKPLATE"},
+        {2099087710u, "L_THRUSTER3"},
+        {3727137284u, "L_WRIST_IKATTACH_3P_SOCKET"},
+        {457158179u, "HOSE3A"},
+        {3945343256u, "BUCKLE"},
+        {2401783636u, "SPIN"},
+        {2200477764u, "R_BOTTOMSHOCKMOUNT"},
+        {2990211100u, "C_FRONTGEAR2"},
+        {1581489698u, "WEAPON_COMMON_DETONATOR001ARX"},
+        {879040899u, "PCUBE11"},
+        {2799343175u, "B_FOOT_OUTSIDETOES_END"},
+        {2704371058u, "L_WHEEL5"},
+        {4243056212u, "HANDLE"},
+        {3904186436u, "R_LEG_PISTON"},
+        {524831829u, "R_BARRELSIDE_EXTEND"},
+        {3459832652u, "BACKPITCH"},
+        {2094109583u, "R_REARAXLE"},
+        {2726916658u, "WORLDROOT"},
+        {2749883295u, "JOINT2"},
+        {869597751u, "R_PINKYB"},
+        {1952565859u, "L_REARENGINESHIELD"},
+        {52112891u, "L_STEERINGLINKOUTER"},
+        {3580243906u, "L_WHEEL1_DEPLOYSPIKE5"},
+        {1962739146u, "JOINT3"},
+        {461548457u, "PCYLINDER40"},
+        {115398135u, "VEHICLE_COMMON_ATTACHMENT_HOODORNAMENT_FIGURE_CHROMESNAKEEYES_ANIMATED"},
+        {2586132733u, "ELBOWHINDGE03"},
+        {1083035843u, "R_TOP_BOX04"},
+        {2803439941u, "REARSUSPENSION"},
+        {1303911096u, "RIGHT_BUTTON01"},
+        {3880820423u, "VEHICLE_TR_MOSQUITO_WEAPON_12MMCANNON001"},
+        {459445938u, "VEHICLE_COMMON_WEAPON_40MMGRENADELAUNCHER"},
+        {2345016067u, "L_LARGEDISK"},
+        {4058796829u, "L_SUPPORT4"},
+        {178867251u, "L_REARPANEL2"},
+        {2879678516u, "REARGEAR2"},
+        {1440689943u, "R_FRONTDOOR"},
+        {762201956u, "REARHATCHB"},
+        {2899694509u, "R_TOPTUBE"},
+        {4277804297u, "R_INDEXB"},
+        {2176474540u, "R_THUMB_END"},
+        {2703085271u, "HINGE3A"},
+        {1570826753u, "VEHICLE_VS_MAGRIDER"},
+        {3001572027u, "WEAPONS_COMMON_MAXHEAVYMACHINEGUNRIGHT001"},
+        {1916267784u, "B_FOOT_INSIDETOES"},
+        {1583804761u, "R_WHEEL6_DEPLOYSPIKE3"},
+        {3008301052u, "R_ARM"},
+        {2447363791u, "L_WHEEL4"},
+        {1388173060u, "L_MIDWHEEL"},
+        {957582291u, "BARREL2_L"},
+        {1098942010u, "WEAPONS_COMMON_FAVENWEAPONS_LMG001_LOD0"},
+        {3593675660u, "BOTTOMREARENGINEFLAPF"},
+        {3516299831u, "L_SHOCKLOWER"},
+        {768381414u, "HARDPOINT5"},
+        {728552198u, "WEAPONS_VS_DOKUWEAPONS_LMG001"},
+        {2764198123u, "WEAPON_COMMON_MAXGRENADELAUNCHER"},
+        {497549541u, "PITCHRECOIL"},
+        {2065424582u, "FRONTGEARC"},
+        {1769025762u, "BACKEND"},
+        {3834003294u, "END_R_TOP_CANNISTER01"},
+        {1498761862u, "R_FOOT_OUTSIDETOES"},
+        {1242568825u, "EAST"},
+        {3722266261u, "R_GEARA"},
+        {3656494025u, "LEFT_BELT008"},
+        {45996765u, "CHAIN15"},
+        {2948224794u, "HOSE3C"},
+        {239022231u, "L_MIDSUPPORT"},
+        {287270140u, "L_INNERTHRUSTER"},
+        {1473445921u, "VEHICLE_COMMON_LIBERATOR_WEAPON_60MMBALLTURRET_ROCKETPODS"},
+        {3341780549u, "LEFT_BELT007"},
+        {1071421814u, "WEAPON_COMMON_NULLPARENT"},
+        {1355981805u, "PART10"},
+        {1520646530u, "R_MIDSUPPORT"},
+        {1387663844u, "BACKSTABILIZER"},
+        {890102883u, "L_KNOB_ROTATE"},
+        {3651587072u, "F_FOOT"},
+        {3920753945u, "L_BACKSHOCKB_TOP"},
+        {3905809930u, "COMMON_PROPS_IFFDOOR_ANIMATED"},
+        {3361048860u, "HOSE1A"},
+        {1292570642u, "R_BARRELROTATIONLOWER"},
+        {572442510u, "VEHICLE_COMMON_QUAD_WEAPON_SHOTGUN"},
+        {3660131708u, "L_PISTON"},
+        {2641020513u, "AMMO4"},
+        {2424428403u, "HARDPOINT2"},
+        {1406579442u, "BACKRAIL"},
+        {1341747590u, "R_WHEEL8"},
+        {2577041220u, "WEAPON_COMMON_SKELETON"},
+        {1186180439u, "F_FOOT_SPIKES"},
+        {2552977381u, "JOINT19"},
+        {2100923523u, "HEAVY_SOLDIER_ANIMATED"},
+        {2080389955u, "DRUM"},
+        {3169208690u, "CANNON_HOOD"},
+        {1850534173u, "FRONTCENTERSPININNER"},
+        {3055515370u, "L_TOPBARREL"},
+        {4040009277u, "WEAPONS_COMMON_FAVENWEAPONS_SCOUTRIFLE001_LOD0"},
+        {2424947579u, "VEHICLE_COMMON_LIBERATOR_WEAPON_60MMCANNO_DOUBLEBARREL"},
+        {640072513u, "L_FOOT_INSIDETOES"},
+        {1875707837u, "POWERCORE01"},
+        {3402016812u, "HINGE2B"},
+        {3414914564u, "R_GEARSUPPORTA"},
+        {362165850u, "SIDEDOORSB"},
+        {3671957889u, "L_WHEEL1_ROTATE"},
+        {843792386u, "GEARBACK"},
+        {3259152763u, "L_OUTERTHRUSTERPANELC"},
+        {1851000760u, "L_WHEEL2"},
+        {2891900272u, "ELBOWHINDGE02"},
+        {141757751u, "L_TOPSHOCKMOUNT"},
+        {2646446598u, "CHAIN05"},
+        {3849338326u, "WEAPONS_VS_MAXNEBULAVM20_RIGHT"},
+        {3835394113u, "MUZZLE2"},
+        {300486179u, "FAN1"},
+        {1133810461u, "DISPLAY"},
+        {4092822280u, "NORTHARM"},
+        {1063630551u, "L_FLAPPER"},
+        {2540394430u, "WEAPON_TR_MRC3MERCYRIGHT001"},
+        {2785907197u, "R_MIDPANEL2"},
+        {3935332498u, "L_REARGEARC"},
+        {1680169842u, "PANELHINDGE02"},
+        {2350413876u, "BARREL01"},
+        {2382959836u, "HINGE2"},
+        {2362924145u, "L_PITCH"},
+        {2060146074u, "BARREL02"},
+        {665543504u, "ANTENNATOP"},
+        {1305566302u, "ANTENNABASE1"},
+        {2637983491u, "R_WHEEL6_DEPLOYSPIKE2"},
+        {530749217u, "FOREARM4"},
+        {52417596u, "VEHICLE_NC_REAVER_WEAPON_14MMCANNON"},
+        {870255675u, "R_BACKSTABILIZER"},
+        {3295264461u, "L_WHEEL6_DEPLOYSPIKE4"},
+        {2357232699u, "L_FRONTSUPPORT2"},
+        {2503882700u, "WEAPONS_COMMON_MAXHEAVYMACHINEGUNLEFT001"},
+        {1618744748u, "R_LOADER"},
+        {605029380u, "WEAPON_TR_M6ONSLAUGHTRIGHT001"},
+        {289102960u, "L_TOP_CANNISTER02"},
+        {275021293u, "R_FRONTSUSPENSION"},
+        {1465590465u, "C_FRONTGEARDOOR2"},
+        {3509101776u, "L_STEERINGLINK"},
+        {787765876u, "R_THUMBB"},
+        {4287572056u, "BARRELBOTTOMLEFT"},
+        {110176716u, "VEHICLE_COMMON_CRAWLER_BASE_CHASSIS"},
+        {1462887748u, "R_REARSUPPORT"},
+        {3421923095u, "GRIP"},
+        {762331445u, "R_WHEEL1_DEPLOYSPIKE2"},
+        {1540633403u, "L_INNERFLAP"},
+        {3857993538u, "L_WHEEL11_TRANSLATE"},
+        {4137492255u, "VEHICLE_COMMON_WEAPON_NULLTURRET"},
+        {3385706901u, "L_WHEEL6_DEPLOYSPIKE2"},
+        {4025803247u, "R_REARGEARDOOR1"},
+        {2563300581u, "L_YAW"},
+        {2618965291u, "L_WHEEL1_DEPLOYSPIKE8"},
+        {3878501791u, "L_SUPPORT3"},
+        {1675554705u, "R_BACKSHOCKA_TOP"},
+        {1729498404u, "R_PINKY_END"},
+        {356495221u, "WEAPON_TR_M6ONSLAUGHTRIGHT001_LOD0"},
+        {2029538400u, "VEHICLE_COMMON_COLOSSUS_WEAPON_MAINCANNON001"},
+        {1047803429u, "WEAPON_VS_MAXFLAKCANNONLEFT001"},
+        {2460336122u, "L_ENGINEVENTFLAPE"},
+        {560980432u, "L_FRONTSHOCKLOWER"},
+        {752438899u, "L_FRONTGEAR5"},
+        {2248424459u, "L_SHELL3"},
+        {2979637790u, "L_TOPTUBE"},
+        {1387893526u, "FRONTLEAF"},
+        {954938090u, "L_FRONTSHOCKB"},
+        {3079616728u, "BULLET11"},
+        {2002250715u, "POWERNODESOCKET"},
+        {223470684u, "BULLET10"},
+        {682273574u, "R_SHIELD"},
+        {220123298u, "NSOMAX_GRENADE"},
+        {3974277974u, "R_WHEEL5"},
+        {1697942313u, "BASEOFFSET"},
+        {2634601848u, "SHELL10"},
+        {2911986502u, "R_BARRELRECOILUPPER"},
+        {3288663904u, "R_TOPBARREL"},
+        {3632260857u, "L_WHEEL6_DEPLOYSPIKE1"},
+        {2291122455u, "COVER"},
+        {370955209u, "FRONTSUPPORT5"},
+        {3617764011u, "L_BARRELSIDELAYER1"},
+        {1453035782u, "L_THUMBC"},
+        {430450076u, "L_TOPHOUSING"},
+        {4220085123u, "WORLDROOT"},
+        {3920111186u, "WEAPON_NC_ROCKETLAUNCHER"},
+        {259892264u, "SHELL3"},
+        {3237172461u, "R_REARSHOCKLOWER"},
+        {2109306918u, "VEHICLE_COMMON_FACILITYTURRET_WEAPON_CHAINGUN"},
+        {3439053269u, "ROTATE1"},
+        {1495630334u, "PEDALS"},
+        {2393600453u, "WEAPON_COMMON_ROCKETRIFLE_LOD0"},
+        {3160050727u, "L_REARGEARB"},
+        {1754637418u, "L_WHEEL10_TRANSLATE"},
+        {3234753418u, "B_FOOT_INSIDETOES_END"},
+        {1360155857u, "R_PITCHRECOIL"},
+        {475599474u, "VEHICLE_COMMON_WEAPON_30MMVEHICLETURRET"},
+        {663227585u, "WEAPON_VS_ROCKETLAUNCHER002"},
+        {3893213993u, "L_RINGB"},
+        {964969609u, "VEHICLE_COMMON_WEAPON_20MMVEHICLETURRETCOAXIAL"},
+        {3771253719u, "PART12"},
+        {3200747626u, "R_GEARC"},
+        {2906427843u, "R_FOOT_INSIDETOES"},
+        {2044676802u, "L_BARRELRECOILUPPER"},
+        {225776827u, "R_WHEEL4_ROTATE"},
+        {3587933164u, "TOPPANEL01"},
+        {3590724549u, "L_MIDPANEL1"},
+        {2774357102u, "CHARACTERWORLDSPACETM"},
+        {3205163343u, "L_FRONTSUPPORT3"},
+        {312972756u, "B_FOOT_SPIKES_END"},
+        {921899274u, "TOPREARENGINEFLAPC"},
+        {1291319755u, "L_TOP_BOX01"},
+        {2539716309u, "L_FRONTSHOCKUPPER"},
+        {3305278863u, "ARMPITCH"},
+        {708670027u, "R_FOOT"},
+        {767425248u, "R_HATCH_BOTTOM"},
+        {3870750844u, "L_WHEEL1"},
+        {197259188u, "TOPPANEL04"},
+        {2604657903u, "HARDPOINT3"},
+        {1834137684u, "WEAPON_COMMON_AUTOPISTOL001_LOD0"},
+        {2359506969u, "TOPFRONTLEGHINGEA"},
+        {407208271u, "WEAPONS_VS_MAXCOSMOSVM3_LEFT"},
+        {2477523247u, "WEAPON_TR_SNIPERBOLTACTION001"},
+        {3343699791u, "COMMON_STRUCTURES_TEMPESTTOWER"},
+        {3916480659u, "SMALLBLADE"},
+        {1237210745u, "L_TOPREARLEGHINGE"},
+        {3864762204u, "L_FOOT_OUTSIDETOES"},
+        {1344053016u, "L_BARRELSIDE_EXTEND"},
+        {3661399299u, "WEAPON_REGIONNAME_MINEBOOMER"},
+        {868153471u, "HARDPOINT2_SOCKET"},
+        {1064781554u, "VEHICLE_TR_MOSQUITO_WEAPON_20MMGATLINGCANNON002"},
+        {594456118u, "NORTHPANEL"},
+        {197266429u, "R_REARDOOR"},
+        {3761303692u, "DEPLOYFRONT3"},
+        {1646726677u, "BULLET14"},
+        {898299046u, "HEAD"},
+        {2479252796u, "R_OUTERTHRUSTERPANELA"},
+        {4093298414u, "R_HANDLE"},
+        {457744838u, "R_SHOULDERPAD"},
+        {3974794655u, "ANTENNA"},
+        {2815084884u, "COMMON_DPO_PLACEABLES_REINFORCEMENTMOD_COL"},
+        {429843451u, "PCUBE16"},
+        {1775047925u, "CAMERARECOIL"},
+        {635268839u, "TOPREARENGINEFLAPA"},
+        {782497864u, "ANTENNABASE"},
+        {1129441107u, "WEAPON_COMMON_KNIFE"},
+        {4157905491u, "L_REARTHRUSTER2"},
+        {1712144270u, "R_WHEEL3_ROTATE"},
+        {1665358410u, "R_SHOULDER"},
+        {2938406655u, "JOINT21"},
+        {2374286536u, "RING1"},
+        {2209954070u, "WEAPON_COMMON_REPAIRTOOL"},
+        {1486358852u, "R_FRONTSHOCKA_TOP"},
+        {1330671677u, "L_FRONTSUSPENSION"},
+        {1765322296u, "VEHICLE_COMMON_QUAD_WEAPON_ROCKETLAUNCHERTR"},
+        {786159239u, "HOSE2A"},
+        {3483479177u, "L_PINKYA"},
+        {1725043975u, "R_FRONTPANEL2"},
+        {3771578632u, "L_SHOULDERPAD"},
+        {1604790749u, "FRONTGEARA"},
+        {3223513967u, "VEHICLE_COMMON_WEAPON_30MMGATLINGBALLTURRET"},
+        {4110254693u, "ACTION17"},
+        {312462836u, "JOINT23"},
+        {2682647519u, "REARSHOCKLOWER"},
+        {4258810157u, "FORWARDFLAP"},
+        {1924703517u, "BOTTOM_DISC"},
+        {145275571u, "R_FRONTGEAR5"},
+        {2568524136u, "STOCK"},
+        {399592015u, "L_ENGINEVENTFLAPD"},
+        {388916045u, "BARREL_L"},
+        {127966342u, "L_PINKYB"},
+        {3017134789u, "R_FRONTSUPPORT4"},
+        {1097825139u, "L_BARRELROTATIONLOWER"},
+        {3855637643u, "REARGEAR1"},
+        {3450335605u, "VEHICLE_COMMON_ATTACHMENT_RADAR_PROXIMITY001"},
+        {366842583u, "MUZZLE1_SOCKET"},
+        {2959938177u, "R_WHEEL3_TRANSLATE"},
+        {2179552981u, "VEHICLE_COMMON_WEAPON_50CALMACHINEGUNCOAXIAL"},
+        {1696635368u, "R_TOP_BOX02"},
+        {2859017764u, "ACTION1"},
+        {3337620633u, "VEHICLE_TR_MOSQUITO"},
+        {3296772448u, "VEHICLE_VS_MAGRIDER_WEAPON_PLASMACANNON001"},
+        {232508533u, "PCUBE15"},
+        {3748233696u, "WEAPON_TR_M2MUTILATORRIGHT001"},
+        {2647247259u, "R_FRONTSHOCKA"},
+        {3175847069u, "BARREL2_R"},
+        {2607943079u, "HYDROLICREARBOTTOM"},
+        {3160257106u, "L_SIDEVENT2"},
+        {3481383269u, "WEAPONS_TR_DOKUWEAPONS_ASSUALTRIFLE001"},
+        {385588147u, "HANDLEBARS_R"},
+        {1272116621u, "L_BOTTONREARLEGBASE"},
+        {651546252u, "VEHICLE_COMMON_ANT_ATTACHMENT_MININGLASER001"},
+        {887355148u, "L_PINKYC"},
+        {2431360521u, "L_HATCH_BOTTOM"},
+        {743339293u, "R_FRONTWHEEL_DUMMY"},
+        {2522939977u, "END_L_BACK_CANNISTER01"},
+        {4025675475u, "R_REARSHOCKUPPER"},
+        {620167259u, "HARDPOINT4"},
+        {1757292079u, "BACKTOPSHOCKMOUNT"},
+        {1396032091u, "R_BOTTOMCANISTER"},
+        {4059977918u, "L_FRONTGEAR2"},
+        {3559570972u, "R_REARTHRUSTERFLAP"},
+        {2281324824u, "R_REARENGINESHIELD"},
+        {1064320924u, "ANTENNABASE2"},
+        {860567359u, "ROTARYBARREL"},
+        {3282254545u, "R_WHEEL10_ROTATE"},
+        {3693122706u, "L_WINGPULLY"},
+        {1139812841u, "CLIP_SOCKET"},
+        {148130434u, "R_MIDDLEC"},
+        {3431993741u, "HOSE1C"},
+        {792221549u, "L_FRONTDOOR"},
+        {1894448589u, "PLUNGERB"},
+        {3636213414u, "SHELL7"},
+        {3784319449u, "R_OVERHEADDOOR2"},
+        {1210586064u, "WEAPONS_VS_MAXHEAVYMACHINEGUNRIGHT001"},
+        {1653896492u, "L_SHELL1"},
+        {3273527615u, "R_SIDELOCK_FRONT"},
+        {1202702096u, "R_SUPPORT1"},
+        {4140554400u, "RPOWERNODE"},
+        {2370804950u, "L_POWERCORE"},
+        {2599646577u, "R_ENGINEVENTFLAPE"},
+        {147198502u, "END_L_TOP_CANNISTER01"},
+        {2612768833u, "HINGE1"},
+        {3731668371u, "L_WHEEL4_TRANSLATE"},
+        {3537047296u, "POWERCORE_BASE02"},
+        {3449862424u, "TAIL"},
+        {1075982656u, "WESTARM"},
+        {450760092u, "FOREARM2"},
+        {3933329929u, "RHULL"},
+        {2907905148u, "R_HIP"},
+        {1999235894u, "R_TOP_CANNISTER01"},
+        {3420689105u, "R_HIPATTACH"},
+        {1759461929u, "L_REARGEARSUPPORT"},
+        {869507288u, "VEHICLE_COMMON_SUNDERER_BASE_CHASSIS"},
+        {3258407673u, "CHAIN03"},
+        {4274798758u, "L_HATCH_BOTTOM_END"},
+        {530090605u, "WEAPON_COMMON_ROCKETLAUNCHER002"},
+        {2637440474u, "L_SIDELOCK_BACK_END"},
+        {2043161584u, "VEHICLE_VS_MAGRIDER_WEAPON_PLASMACANNON004"},
+        {699248667u, "L_GEARSUPPORTA"},
+        {4179454272u, "NECK"},
+        {867521455u, "PART7"},
+        {4047477869u, "VEHICLE_COMMON_LIGHTNING_WEAPON_ANACONDATURRET"},
+        {3746558302u, "L_SHOULDER"},
+        {720558866u, "SHELL6"},
+        {4266326091u, "EJECTIONPORT"},
+        {2557431765u, "R_WINGFAN"},
+        {693737955u, "REARSHOCKUPPER"},
+        {3923007646u, "L_WHEEL1_DEPLOYSPIKE7"},
+        {2835073054u, "L_BARRELRECOILLOWER"},
+        {2960552844u, "HINGE2A"},
+        {1055149117u, "LOWERDOOR4"},
+        {2724988498u, "LEFT_FLAP"},
+        {1951460982u, "ACTIONUPPER"},
+        {1680733055u, "L_BARREL"},
+        {1871409830u, "L_REARGEAR4"},
+        {364301239u, "WEAPON_VS_SMG001_SKELETON"},
+        {498327413u, "WEAPONATTACHMENT_TR_CLIP_ROCKETLAUNCHERAMMO002"},
+        {1023887647u, "AXLEFRONT"},
+        {2233616847u, "R_ENGINEVENTFLAPD"},
+        {1671001587u, "WEAPON_COMMON_SMG001"},
+        {1252909755u, "WEAPONS_VS_MAXNEBULAVM20_LEFT_LOD0"},
+        {1122641024u, "VS_MAX"},
+        {3090389870u, "CLIPBOLT"},
+        {2380238797u, "C_FRONTGEARDOOR1"},
+        {706207068u, "BUMPER"},
+        {1659759987u, "FRONTSUPPORT2"},
+        {470752987u, "RELOADACTION"},
+        {827898509u, "FOREARM5"},
+        {238045334u, "END_L_TOP_BOX04"},
+        {3074686431u, "R_SHELLROTATION"},
+        {3200259563u, "ACTION13"},
+        {671758044u, "FPMALE"},
+        {3189639359u, "L_FOOT_OUTSIDETOES_END"},
+        {916948579u, "R_WHEEL9_ROTATE"},
+        {2996211783u, "WEAPONS_TR_DOKUWEAPONS_CARBINE001"},
+        {1681053934u, "SIDEGRIP"},
+        {3365866860u, "L_REARDOOR"},
+        {2390247076u, "WEAPON_COMMON_HEAVYCROSSBOW001"},
+        {3950623792u, "BARRELROTATION"},
+        {2447288296u, "R_REARFLAP"},
+        {252056241u, "WEAPON_COMMON_SNIPER02"},
+        {2529748557u, "WESTJOINT"},
+        {2566866105u, "FRONTYAW"},
+        {3356280828u, "R_FOREARM"},
+        {3467663095u, "L_SIDEVENT3"},
+        {1704015722u, "PART8"},
+        {978078741u, "WEAPON_VS_BLUESHIFTVM5LEFT001_LOD0"},
+        {3920976780u, "L_PINKY_END"},
+        {3742348944u, "HOSE1B"},
+        {2762743218u, "R_CYLINDEREXTEND_END"},
+        {2611601591u, "R_FRONTGEAR4"},
+        {560152447u, "VEHICLE_NC_VANGUARD_WEAPON_PSA_MAINCANNON001"},
+        {1991123356u, "L_FOOT_SPIKES"},
+        {714496997u, "VEHICLE_COMMON_WEAPON_20MMHEAVYBALLTURRET"},
+        {3034731402u, "CHARGEEMPTY"},
+        {3570760957u, "THULL"},
+        {1953769567u, "R_ENGINEVENTFLAPA"},
+        {3576657972u, "BARRELBOTTOMRIGHT"},
+        {2618851531u, "BULLET20"},
+        {221775280u, "L_FRONTSUPPORT1"},
+        {3436921489u, "BULLET4"},
+        {697830620u, "L_REARSHOCKUPPER"},
+        {2299776059u, "R_GEARDOOR"},
+        {150803519u, "PART14"},
+        {69861241u, "BOTTOMREARENGINEFLAPD"},
+        {2798464200u, "R_FRONTSIDESTABILIZER"},
+        {2611971637u, "R_FRONTWHEEL"},
+        {2358689877u, "WEAPONS_VS_MAXNEBULAVM20_RIGHT_LOD0"},
+        {222980417u, "R_REARGEARA"},
+        {3768604471u, "PHYSICSTRAPMOUNT"},
+        {3235401351u, "L_WHEEL9_TRANSLATE"},
+        {1862987346u, "L_FOOT_SPIKES_END"},
+        {3628033440u, "PISTON04"},
+        {4196382733u, "L_WHEEL2_ROTATE"},
+        {1766662782u, "R_REARTHRUSTER1"},
+        {630489018u, "R_BARRELRECOILLOWER"},
+        {2520538412u, "R_LARGEDISK"},
+        {1143123657u, "L_RING_END"},
+        {622280259u, "WEAPONMOUNT"},
+        {536013851u, "END_L_TOP_BOX03"},
+        {749578352u, "GEARFRONT"},
+        {2815222948u, "VEHICLE_TR_PROWLER_WEAPON_120MMCANNON_REFERRAL001"},
+        {3024421688u, "L_ENGINEVENTFLAPB"},
+        {3284101644u, "L_THRUSTERPANEL"},
+        {3429527095u, "CHAIN11"},
+        {1415769934u, "END_R_BACK_CANNISTER01"},
+        {3978902171u, "CARTRIDGE"},
+        {1205071495u, "WEAPON_VS_PISTOLBEAMER"},
+        {3650476089u, "SCOPE_SOCKET"},
+        {3296973358u, "DRUMHANDLE"},
+        {4127184068u, "WEAPON_TR_MAXROCKETLAUNCHER001"},
+        {1739425286u, "LEFT_BUTTON01"},
+        {997715595u, "R_BACKDRING"},
+        {1688152586u, "WEAPON_TR_M2MUTILATORRIGHT001_LOD0"},
+        {1191082628u, "REARHATCHA"},
+        {399140690u, "L_FRONTWHEEL_DUMMY"},
+        {4129238787u, "R_SHELL3"},
+        {3255643496u, "HAMMER"},
+        {388471444u, "PART5"},
+        {3200992048u, "L_KNOB_TRANSLATE"},
+        {1513773997u, "BOTTOMFRONTLEGBASE"},
+        {4178184213u, "L_WHEEL8_TRANSLATE"},
+        {1772401952u, "REDDOT_SOCKET"},
+        {4102920736u, "FX"},
+        {3153949916u, "R_TOP_CANNISTER02"},
+        {3905215779u, "BATTERYSOCKET"},
+        {3982187345u, "END_L_TOP_CANNISTER03"},
+        {3550536900u, "L_WHEEL6_ROTATE"},
+        {1021430484u, "L_WING"},
+        {1939367865u, "R_TOE"},
+        {3094816405u, "VEHICLE_NC_VANGUARD_WEAPON_150MMCANNON"},
+        {1298007339u, "FRONTGEAR2"},
+        {4016783380u, "COMPRESSION"},
+        {3155017161u, "INDAR_PROPS_VENTS_FANLARGEDOUBLE"},
+        {3068704555u, "R_YAW"},
+        {3308287675u, "PART2"},
+        {2647307111u, "VEHICLE_COMMON_QUAD_WEAPON_ROCKETLAUNCHERVS"},
+        {1371949785u, "L_FOOT_INSIDETOES_END"},
+        {3991537050u, "VEHICLE_COMMON_WEAPON_60MMMISSILELAUNCHERBALLTURRET"},
+        {1671105602u, "WEAPON_COMMON_MAXFLAKCANNON001"},
+        {25384975u, "MAGZINE_001"},
+        {2490953973u, "R_BARRELSIDELAYER2"},
+        {247529202u, "MAINDOOR"},
+        {3456699527u, "BACKBOTTOMSHOCKMOUNT"},
+        {2688238961u, "POWERCORESOCKET02"},
+        {2991756863u, "CLIP"},
+        {723101580u, "RIGHT_BELT0012"},
+        {978245741u, "L_THUMBA"},
+        {2005839528u, "R_ENGINEVENTFLAPC"},
+        {3107862979u, "CANNON_HOOD_END"},
+        {2197101825u, "R_HATCH_BOTTOM_END"},
+        {729468442u, "BOTTOMREARENGINEFLAPG"},
+        {2157529237u, "R_FRONTPANEL1"},
+        {1545632388u, "L_FRONTSTABILIZER"},
+        {3595761247u, "BULLET17"},
+        {2054689799u, "R_INDEXC"},
+        {1168299277u, "BULLET19"},
+        {1585371058u, "REARTHRUSTER"},
+        {936740635u, "MINE"},
+        {2178391894u, "C_FRONTGEAR1"},
+        {2475268786u, "VEHICLE_COMMON_WEAPON_60MMBALLTURRET"},
+        {811860561u, "L_ARMCOMPONENTS"},
+        {1587829056u, "PLUNGERA"},
+        {1113053344u, "VEHICLE_COMMON_DROPPOD"},
+        {3915609608u, "WEAPON_TR_MRC3MERCYRIGHT001_LOD0"},
+        {1971300527u, "YAWPROP2_R"},
+        {4086401616u, "TOPREARENGINEFLAPB"},
+        {3261119595u, "GROUP1"},
+        {213536010u, "WEAPON_VS_PISTOLBEAMERHEAVY002"},
+        {2005443484u, "R_WHEEL6_DEPLOYSPIKE8"},
+        {348179630u, "TOPREARENGINEFLAPD"},
+        {3161250124u, "BACKYAW"},
+        {1645615504u, "CHAIN12"},
+        {1903739073u, "VEHICLE_COMMON_WEAPON_30MMFLAKTURRET"},
+        {3468960995u, "F_FOOT_OUTSIDETOES_END"},
+        {4176684248u, "L_CYLINDEREXTEND_END1"},
+        {2022986004u, "R_BOTTOMBARREL"},
+        {4278341525u, "R_WHEEL4"},
+        {1826440265u, "FRONTGEARB"},
+        {3034038038u, "CHAIN14"},
+        {2819542915u, "R_RING_END"},
+        {238830721u, "OFFSETATTACHMENT"},
+        {1818209819u, "VEHICLE_VS_SCYTHE_WEAPON_20MMGATLINGCANNON002"},
+        {2992552996u, "R_WHEEL5_TRANSLATE"},
+        {2231500842u, "R_THROTTLE"},
+        {2681793709u, "R_STEERINGLINKINNER"},
+        {198244558u, "L_INDEXA"},
+        {3360970358u, "R_SHOULDERROLL"},
+        {1255274124u, "R_SIDEVENT3"},
+        {2716785905u, "R_FOOT_SPIKES_END"},
+        {4119076029u, "L_CYLINDERUP"},
+        {3241010037u, "VEHICLE_NC_VANGUARD_WEAPON_RAILGUNVEHICLETURRET"},
+        {2802826641u, "L_BARRELROTATIONUPPER"},
+        {1337696179u, "L_GEARB"},
+        {469708367u, "ARM1"},
+        {3412486250u, "R_WHEEL1"},
+        {1345487733u, "WEAPON_VS_KNIFE02_LOD0"},
+        {1891856710u, "BARRELRECOIL1"},
+        {3106683811u, "R_ARMCOMPONENTS"},
+        {1942104436u, "VEHICLE_COMMON_LIBERATOR_WEAPON_NOSEGUN15MM"},
+        {984764821u, "BACKCORE"},
+        {3884601638u, "R_SHOCKUPPER"},
+        {3941239263u, "END_R_TOP_BOX01"},
+        {2919287888u, "STABILIZER"},
+        {4085355481u, "BARREL"},
+        {1642368672u, "PHYSICS1"},
+        {2910764364u, "R_FRONTVENT"},
+        {826122527u, "SMALLBARREL1"},
+        {3783973932u, "R_KNEE"},
+        {1214637520u, "CHARGINGHANDLE"},
+        {1046831467u, "PLAYERBUMPER"},
+        {407354688u, "ELBOWHINDGE01"},
+        {578449394u, "EASTARM"},
+        {183635336u, "HOSE3B"},
+        {499401726u, "INTERNALBULLETS"},
+        {2904122814u, "AMMO1"},
+        {4001698563u, "L_WHEEL6_DEPLOYSPIKE5"},
+        {3108519283u, "L_REARWHEEL"},
+        {569531117u, "L_WEAPON"},
+        {1303942709u, "VEHICLE_COMMON_QUAD_WEAPON_20MMGUN"},
+        {2732068263u, "WEAPON_NC_PISTOLMAG003"},
+        {1212698968u, "ANTENNABASE3"},
+        {1477378046u, "R_REARTHRUSTER2"},
+        {325645639u, "LOWERDOOR1"},
+        {166010900u, "L_WHEEL6_DEPLOYHUB"},
+        {943876432u, "L_MIDDLEB"},
+        {1332087532u, "ROUND1"},
+        {196063177u, "ACTION16"},
+        {1884438999u, "RIGHT_BELT005"},
+        {1602021409u, "VEHICLE_NC_VANGUARD_WEAPON_200MMARTILLERYCANNON_LOD0"},
+        {561920284u, "L_REARVENTS"},
+        {1500128684u, "VEHICLE_NC_REAVER_GLASS_LOD0"},
+        {4074478492u, "L_WHEEL6_DEPLOYSPIKE7"},
+        {2922679407u, "L_SHELL5"},
+        {4073776971u, "R_MIDWHEEL"},
+        {1676007307u, "BARRELRECOIL2"},
+        {671803519u, "ACTION14"},
+        {4268257682u, "L_FRONTGEAR3"},
+        {479761161u, "WESTPANEL"},
+        {2635432493u, "VEHICLE_TR_MOSQUITO_WEAPON_20MMGATLINGCANNON001"},
+        {2863223333u, "R_FRONTGEARDOOR2"},
+        {276017613u, "REARGEAR4"},
+        {3741766728u, "VEHICLE_COMMON_COLOSSUS_BASE_CHASSIS"},
+        {100048734u, "L_REARGEARA"},
+        {3991326819u, "VEHICLE_COMMON_ENGINEERDEPLOYABLE_BASE_TRIPOD"},
+        {3662356388u, "L_RINGA"},
+        {3342510743u, "COMMON_DPO_PLACEABLE_IONCANNON"},
+        {2008156296u, "VEHICLE_TR_PROWLER_WEAPON_120MMCANNON"},
+        {1926418580u, "UPPERDOOR3"},
+        {1907517712u, "FRONTBOTTOMSHOCKMOUNT"},
+        {1503220503u, "R_BARREL"},
+        {3693594453u, "HYDROLICFRONTBOTTOM"},
+        {2242507051u, "SPINEMIDDLE"},
+        {2939065863u, "GROUP2"},
+        {3298513648u, "BULLET16"},
+        {1317099658u, "L_MAINPULLY"},
+        {2000111793u, "WEAPON_NC_MAXROCKETLAUNCHERRIGHT001"},
+        {3551938470u, "CLIPBOLT4"},
+        {878528594u, "CHARGE3QUARTER"},
+        {1294189023u, "FRONTSUPPORT1"},
+        {2148525691u, "R_WHEEL1_DEPLOYSPIKE5"},
+        {369569363u, "PART11"},
+        {2291558667u, "FOREARM1"},
+        {2128216747u, "L_WHEEL1_DEPLOYSPIKE1"},
+        {3548344289u, "L_WHEEL11_ROTATE"},
+        {2163822301u, "VEHICLE_COMMON_LIBERATOR_WEAPON_NOSEGUN30MM"},
+        {1294838299u, "BARRELRECOIL3"},
+        {3812941556u, "ACTION11"},
+        {4089981509u, "L_ENGINESHIELD"},
+        {1852067476u, "LEFT_BELT0010"},
+        {306890114u, "R_THRUSTERPANEL"},
+        {4125754605u, "R_BARRELROTATIONUPPER"},
+        {619215498u, "PCUBE14"},
+        {3061793532u, "L_WHEEL12_TRANSLATE"},
+        {1157169726u, "L_REARGEARDOOR"},
+        {3065573393u, "L_BARRELFRONT_EXTEND"},
+        {3971649130u, "L_OUTERTHRUSTERPANELA"},
+        {609567619u, "R_THRUSTERFLAP1"},
+        {75518749u, "VEHICLE_COMMON_JETBIKE_BASE_CHASSIS"},
+        {1745324143u, "VEHICLE_VS_MAGRIDER_WEAPON_PLASMACANNON003"},
+        {2734381146u, "HINGE2C"},
+        {2429286607u, "R_FRONTSHOCKLOWER"},
+        {3948699063u, "POWERCORE"},
+        {2118432348u, "WEST"},
+        {2307111907u, "BULLET7"},
+        {498450088u, "L_STABILIZER"},
+        {3623525379u, "R_BOTTONREARLEGBASE"},
+        {228167708u, "WEAPON_COMMON_REVOLVER001"},
+        {2083853213u, "SLIDETOP"},
+        {2255915291u, "WEAPON_NC_MINEBOUNCER001"},
+        {1895700580u, "R_CYLINDEREXTEND_END1"},
+        {104272027u, "L_SIDELOCK_FRONT_END"},
+        {1502352459u, "RIGHT_BELT007"},
+        {3447049761u, "BASE"},
+        {955335483u, "RIGHT_BELT0011"},
+        {1076688081u, "SLOWSPIN_BASE_IDLE_FULL"},
+        {1843793152u, "L_FRONTWHEEL"},
+        {2030996345u, "R_SIDELOCK_FRONT_END"},
+        {3974058683u, "R_ENGINESHIELD"},
+        {2924715602u, "WEAPON_VS_PROXIMITYMINE"},
+        {2300638456u, "WEAPONS_VS_MAXCOSMOSVM3_LEFT_LOD0"},
+        {1678652251u, "L_FRONTSUPPORT4"},
+        {871669885u, "RIGHTCHAMBERHATCH"},
+        {84108987u, "L_WRIST_IKATTACH_SOCKET"},
+        {2268888731u, "R_REARGEARSUPPORT"},
+        {4266385848u, "VEHICLE_TR_PROWLER_WEAPON_ESAV003"},
+        {2307684303u, "MIDLEAF"},
+        {1421348804u, "R_WHEEL1_DEPLOYSPIKE7"},
+        {3212206043u, "R_SIDEVENT1"},
+        {1060044686u, "WEAPONS_TR_DOKUWEAPONS_CHAINGUN001"},
+        {119272585u, "YAW"},
+        {1825881561u, "L_PITCHRECOIL"},
+        {3205137251u, "L_SHELLROTATION"},
+        {2662939284u, "EJECT2"},
+        {977508624u, "L_BACK_CANNISTER01"},
+        {1216461011u, "BARREL4"},
+        {22427549u, "BARREL_R"},
+        {3340640726u, "L_FORWARDDISK2"},
+        {1987186480u, "L_FRONTPANEL1"},
+        {461493020u, "REARCENTERSPININNER"},
+        {3587087074u, "L_SUPPORT2"},
+        {3190207227u, "LEFT_BUTTON02"},
+        {1732937360u, "L_BOTTOMSHOCKMOUNT"},
+        {382516222u, "L_TOPCANISTER"},
+        {2144424870u, "WEAPON_NC_MAXANTIVEHICLE001"},
+        {1923000924u, "BARREL"},
+        {279687920u, "L_DEPLOY_MECANISM_END"},
+        {4151378384u, "R_WHEEL1_DEPLOYHUB"},
+        {286101867u, "L_LATCHCLIPS"},
+        {54123589u, "END_L_BACK_CANNISTER02"},
+        {3197516982u, "R_ENGINEVENTFLAPG"},
+        {2208537651u, "L_REARGEARDOOR2"},
+        {819550842u, "HINGE3"},
+        {1400616475u, "L_THRUSTER1"},
+        {2436389468u, "L_WHEEL10_ROTATE"},
+        {1646183586u, "WEAPONS_TR_DOKUWEAPONS_PISTOL001"},
+        {1867509980u, "VEHICLE_TR_PROWLER_WEAPON_120MMQUADCANNON"},
+        {1122782432u, "R_WHEEL6_TRANSLATE"},
+        {2081169327u, "JOINT12"},
+        {298354645u, "SPIRE"},
+        {4268096845u, "R_ANKLE"},
+        {3478917814u, "VEHICLE_VS_MAGRIDER_WEAPON_PULSEDPARTICLEACCELERATOR001"},
+        {2750269423u, "WEAPONS_NC_DOKUWEAPONS_LMG001"},
+        {1357419157u, "L_SIDELOCK_FRONT"},
+        {2151118934u, "LEFT_BELT003"},
+        {4238365957u, "L_FRONTDRING"},
+        {831168718u, "TRIGGER"},
+        {905963224u, "R_THRUSTERFLAP2"},
+        {1347590289u, "LEFT_BELT002"},
+        {123143823u, "L_REARSUPPORT"},
+        {2338442610u, "LEFT_BUTTON04"},
+        {1259551407u, "L_BACK_CANNISTER02"},
+        {319614870u, "R_PITCH"},
+        {3072987811u, "L_WHEEL3_ROTATE"},
+        {1642943230u, "L_THRUSTER2"},
+        {135706558u, "FRONTSUPPORT4"},
+        {3535937897u, "VEHICLE_COMMON_AUTOTURRETGROUND_WEAPONS_MACHINEGUN"},
+        {3291028981u, "L_SHOULDERROLL"},
+        {1937782095u, "VEHICLE_COMMON_LIBERATOR_WEAPON_105MMCANNON"},
+        {1029709092u, "VEHICLE_COMMON_FACILITYTURRET_WEAPON_30MMCANNON"},
+        {980420752u, "L_UPPERSUSPENSION"},
+        {1237039252u, "R_RINGB"},
+        {338743835u, "VEHICLE_COMMON_FACILITYTURRET_BASE"},
+        {3281080856u, "L_FRONTAXLE"},
+        {4075248884u, "BOTTOMREARENGINEFLAPC"},
+        {3271536277u, "HINGE"},
+        {4011219873u, "F_LEG"},
+        {2666078040u, "LOADACTION2"},
+        {2525539168u, "L_ANKLE"},
+        {3953567226u, "R_REARGEARC"},
+        {1765274351u, "PITCHPROP_R"},
+        {4052515463u, "REARFANYAW"},
+        {1579452288u, "B_ANKLE"},
+        {1681854081u, "R_DEPLOY_MECANISM"},
+        {2143811686u, "VEHICLE_COMMON_FACILITYTURRET_WEAPON_FLAKCANNON"},
+        {1594602635u, "L_PEDAL"},
+        {4060997878u, "L_RELOADPIN"},
+        {1984855388u, "R_MIDAXLE"},
+        {2881046729u, "B_LEG"},
+        {3587576385u, "WEAPON_NC_KNIFE05_LOD0"},
+        {477864652u, "WEAPON_TR_MAXANTIINFANTRY001"},
+        {1091651574u, "R_SMOKESTACK"},
+        {2402683191u, "ACTIONLOWER"},
+        {3011835733u, "VEHICLE_COMMON_LIGHTNING_75MMCANNON"},
+        {3639316156u, "R_INNERTHRUSTER"},
+        {3357902705u, "BOTTOMREARENGINEFLAPE"},
+        {3098565902u, "PITCH"},
+        {1776095517u, "R_THRUSTERFLAP"},
+        {904278569u, "R_HATCH_TOP"},
+        {3466416465u, "END_R_TOP_BOX04"},
+        {2954194361u, "SPINNER"},
+        {2285221890u, "JOINT13"},
+        {2167947592u, "R_REARWHEEL"},
+        {1777916161u, "SHELL1"},
+        {2325943437u, "RIGHT_BUTTON05"},
+        {1041482416u, "END_R_BACK_CANNISTER02"},
+        {1142326112u, "L_BALL"},
+        {84634380u, "COGPARENT"},
+        {721358111u, "TR_MAX"},
+        {483058250u, "JOINT22"},
+        {813763102u, "L_SHOULDERATTACH"},
+        {2235514797u, "PISTON02"},
+        {1570658564u, "SMALLSPINNINGENGINE"},
+        {4071371777u, "R_REARGEAR2"},
+        {200963513u, "WEAPON_TR_MRC3MERCYLEFT001_LOD0"},
+        {2228420237u, "WEAPON_COMMON_REVOLVER005"},
+        {4146244031u, "L_BACKSTABILIZER"},
+        {1506210194u, "WEAPON_COMMON_ACETOOL"},
+        {1719620090u, "POWERCORESOCKET01"},
+        {2044818186u, "RIGHT_BUTTON02"},
+        {1134583660u, "TOPPANEL02"},
+        {3970212610u, "BULLET12"},
+        {2629297631u, "R_FRONTDRING"},
+        {1847237089u, "R_OUTERTHRUSTERPANELC"},
+        {3266867338u, "R_FRONTSUPPORT3"},
+        {3852402044u, "BLADETIP"},
+        {553778173u, "L_TOP_CANNISTER03"},
+        {2977401802u, "BULLET2"},
+        {3204711383u, "R_DEPLOY_MECANISM_END"},
+        {2309787707u, "R_TOP_CANNISTER03"},
+        {1222540801u, "PART6"},
+        {3192222837u, "LEFT_BELT001"},
+        {2884154752u, "R_FOOT_SPIKES"},
+        {1188711348u, "RELOADACTION2"},
+        {2393888159u, "WEAPON_TR_CLAYMORE001"},
+        {1468333525u, "L_STEERINGPIVOT"},
+        {4192786543u, "VEHICLE_COMMON_AUTOTURRET_GROUNDANTITANKROCKETLAUNCHER"},
+        {77051289u, "MAINHINDGE01"},
+        {1270025781u, "R_THRUSTER2"},
+        {630800775u, "ARM4"},
+        {3850366389u, "POLYSURFACE32"},
+        {4206633094u, "L_WHEEL8"},
+        {3103768745u, "R_REARGEAR4"},
+        {3387066931u, "L_LARGEINNERDISK"},
+        {2693271594u, "WEAPON_TR_M2MUTILATORLEFT001_LOD0"},
+        {1770326393u, "R_WHEEL13_TRANSLATE"},
+        {2715821231u, "R_SIDEVENT2"},
+        {2491993409u, "R_BACK_CANNISTER01"},
+        {2434127015u, "ACTIONRAIL"},
+        {3305972769u, "DOOR"},
+        {2769958247u, "L_RINGC"},
+        {3571316050u, "R_YAW2"},
+        {2838394204u, "IRONSIGHTFRONT_SOCKET"},
+        {925820482u, "LEFT_BELT006"},
+        {4138511950u, "WEAPON_NC_SMG002_SKELETON"},
+        {2794181090u, "WEAPON_TR_KNIFE04_LOD0"},
+        {3344679897u, "PISTON01"},
+        {944552693u, "R_LEG"},
+        {926811968u, "L_WHEEL1_DEPLOYHUB"},
+        {2565524048u, "MIDAXLE"},
+        {393246525u, "L_REARTHRUSTER"},
+        {3669183925u, "L_REARAXLE"},
+        {206290509u, "MUZZLE1_1STPERSON_SOCKET"},
+        {1854896262u, "SHELL13"},
+        {1606571537u, "R_BARRELFRONT_EXTEND"},
+        {852534977u, "L_FRONTSHOCKA"},
+        {1661678569u, "L_WHEEL8_ROTATE"},
+        {3519043598u, "R_WHEEL6_DEPLOYSPIKE5"},
+        {204057857u, "L_SHOCKUPPER"},
+        {987731955u, "NC_MAX"},
+        {1200954035u, "AMMO3"},
+        {2094551816u, "F_ANKLE"},
+        {1668442840u, "R_POWERCORE"},
+        {4135457461u, "WEAPONS_NC_MAXAF23GRINDER"},
+        {3032317542u, "L_REARGEARDOOR1"},
+        {70005902u, "END_L_TOP_BOX01"},
+        {4071192180u, "WEAPON_COMMON_ROCKETLAUNCHER002_LOD0"},
+        {1858661785u, "CHARGEFULL"},
+        {3167037877u, "DEPLOYFRONT1"},
+        {378834321u, "R_RUDDER"},
+        {3690950000u, "BHULL"},
+        {3745841892u, "L_WHEEL5_TRANSLATE"},
+        {2848112608u, "PART4"},
+        {1282140579u, "R_FRONTFLAP"},
+        {1497906636u, "REARSLIDE"},
+        {2177680988u, "R_SHELL1"},
+        {1008562442u, "HOSE2B"},
+        {3282275393u, "PITCHRECOIL_R"},
+        {132180299u, "L_FRONTSHOCKB_TOP"},
+        {2816061702u, "HYDROLICREARTOP"},
+        {3794192763u, "SHELL9"},
+        {89398582u, "VEHICLE_COMMON_ANT_BASE_CHASSIS"},
+        {2283716452u, "VEHICLE_COMMON_LIBERATOR_WEAPON_NOSEGUN20MM"},
+        {2254105017u, "SHELLEJECT_R_SOCKET"},
+        {3301476370u, "R_THRUSTER"},
+        {3747836068u, "WEAPON_TR_LMG_SKELETON"},
+        {2145353959u, "F_FOOT_OUTSIDETOES"},
+        {1574580347u, "VEHICLE_VS_VORTEX"},
+        {2254186632u, "JOINT4"},
+        {1843892274u, "R_CYLINDERDN"},
+        {4211252507u, "VEHICLE_COMMON_QUAD"},
+        {1025710107u, "VEHICLE_NC_VANGUARD_WEAPON_150MMCANNON_REFERRAL001"},
+        {789657090u, "FOREARM3"},
+        {1824765190u, "WEAPON_TR_MAXANTIVEHICLELEFT001"},
+        {209846800u, "L_BACKPLATE"},
+        {2020680874u, "VEHICLE_COMMON_VALKYRIE_BASE_CHASSIS"},
+        {2798791814u, "R_GEARSUPPORTB"},
+        {2182276440u, "RIGHT_BELT004"},
+        {138174985u, "R_WHEEL3"},
+        {4212840290u, "L_INDEXB"},
+        {1024908054u, "R_SIDEVENT4"},
+        {1041216236u, "L_LEG"},
+        {954251114u, "R_SHOULDERATTACH"},
+        {2250973670u, "TAILVENTS"},
+        {2755292179u, "VEHICLE_COMMON_AUTOTURRETGROUND_BASE_TURRET"},
+        {1786766851u, "R_TOPSHOCKMOUNT"},
+        {3246078305u, "WEAPON_TR_MAXANTIVEHICLERIGHT001"},
+        {2268774313u, "VEHICLE_COMMON_WEAPON_60MMVEHICLETURRET"},
+        {674498645u, "R_TOPHOUSING"},
+        {3835667144u, "L_THRUSTERFLAP1"},
+        {3546037191u, "R_MIDDLE_END"},
+        {3888312911u, "POLYSURFACE33"},
+        {1004136612u, "WEAPONS_NC_MAXAF34MATTOCKLEFT"},
+        {1109449997u, "R_WHEEL7_ROTATE"},
+        {1427025685u, "L_WHEEL1_DEPLOYSPIKE4"},
+        {595475660u, "PCYLINDER37"},
+        {1100663657u, "R_WINGVENTS"},
+        {3616397177u, "VEHICLE_COMMON_WEAPON_50MMGATLINGBALLTURRET"},
+        {938704599u, "BARRELTOPRIGHT"},
+        {3796563280u, "PCUBE17"},
+        {1800894922u, "TOPREARENGINEFLAPF"},
+        {3593695816u, "R_MIDPANEL1"},
+        {4272014876u, "L_BACKDRING"},
+        {4200598998u, "R_LARGEINNERDISK"},
+    }
+}};
 
-std::unordered_map<uint32_t, uint32_t> utils::bone_hierarchy = {
-    {4220085123u, 0u},
-    {119272585u, 4220085123u},
-    {1731449576u, 119272585u},
-    {3098565902u, 119272585u},
-    {1923000924u, 3098565902u},
-    {4099058003u, 2726916658u},
-    {2859017764u, 2726916658u},
-    {4043274857u, 1049972350u},
-    {3812941556u, 4043274857u},
-    {3440751254u, 2726916658u},
-    {3200259563u, 3440751254u},
-    {671803519u, 3200259563u},
-    {440159458u, 2726916658u},
-    {196063177u, 440159458u},
-    {4110254693u, 196063177u},
-    {2770017160u, 2726916658u},
-    {3474386815u, 2726916658u},
-    {3080831125u, 3474386815u},
-    {23516190u, 3080831125u},
-    {3696658942u, 2726916658u},
-    {638623093u, 3696658942u},
-    {350780193u, 638623093u},
-    {1049972350u, 2726916658u},
-    {2402683191u, 4099058003u},
-    {959125743u, 2402683191u},
-    {2434127015u, 2726916658u},
-    {3001437478u, 4099058003u},
-    {1951460982u, 4099058003u},
-    {333254182u, 3900869694u},
-    {3900869694u, 1951460982u},
-    {1370311378u, 2726916658u},
-    {1928556915u, 2726916658u},
-    {2904122814u, 1928556915u},
-    {2059895067u, 1928556915u},
-    {1200954035u, 1928556915u},
-    {2641020513u, 1928556915u},
-    {4092785520u, 1928556915u},
-    {3366755556u, 1928556915u},
-    {3974794655u, 3271536277u},
-    {782497864u, 843617178u},
-    {1305566302u, 782497864u},
-    {1064320924u, 1305566302u},
-    {1212698968u, 1064320924u},
-    {665543504u, 1212698968u},
-    {469708367u, 567791785u},
-    {156469500u, 567791785u},
-    {452865105u, 567791785u},
-    {630800775u, 567791785u},
-    {931849578u, 567791785u},
-    {3305278863u, 497549541u},
-    {620852943u, 3305278863u},
-    {3487385081u, 567791785u},
-    {1023887647u, 567791785u},
-    {3456699527u, 1387663844u},
-    {984764821u, 2726916658u},
-    {1769025762u, 2726916658u},
-    {3474656460u, 2726916658u},
-    {3459832652u, 3161250124u},
-    {1406579442u, 2726916658u},
-    {3740866747u, 2726916658u},
-    {1387663844u, 3620343033u},
-    {1757292079u, 3620343033u},
-    {3161250124u, 843617178u},
-    {4085355481u, 3620343033u},
-    {2350413876u, 2726916658u},
-    {2060146074u, 2726916658u},
-    {3955064620u, 3620343033u},
-    {4023945082u, 3620343033u},
-    {957582291u, 388916045u},
-    {3175847069u, 22427549u},
-    {25668312u, 3620343033u},
-    {1216461011u, 3620343033u},
-    {4287572056u, 2726916658u},
-    {3576657972u, 2726916658u},
-    {1891856710u, 497549541u},
-    {1676007307u, 497549541u},
-    {1294838299u, 497549541u},
-    {1011550294u, 497549541u},
-    {3950623792u, 2726916658u},
-    {538760882u, 2726916658u},
-    {938704599u, 2726916658u},
-    {388916045u, 3116333173u},
-    {22427549u, 3282275393u},
-    {1580348024u, 4085355481u},
-    {3447049761u, 2726916658u},
-    {1697942313u, 3447049761u},
-    {391037130u, 2726916658u},
-    {1456985596u, 2726916658u},
-    {3905215779u, 2401783636u},
-    {3690950000u, 2726916658u},
-    {1027681439u, 2726916658u},
-    {1368062130u, 2726916658u},
-    {3852402044u, 238830721u},
-    {1513773997u, 2060981379u},
-    {3055013529u, 1513773997u},
-    {2348369865u, 4085355481u},
-    {2403210655u, 567791785u},
-    {2625089554u, 567791785u},
-    {4075248884u, 567791785u},
-    {69861241u, 567791785u},
-    {3357902705u, 567791785u},
-    {3593675660u, 567791785u},
-    {729468442u, 567791785u},
-    {967928455u, 567791785u},
-    {1924703517u, 2726916658u},
-    {2896946475u, 2231500842u},
-    {3945343256u, 2726916658u},
-    {3685814955u, 2726916658u},
-    {537716927u, 2726916658u},
-    {223470684u, 2726916658u},
-    {3079616728u, 2726916658u},
-    {3970212610u, 2726916658u},
-    {4278077365u, 2726916658u},
-    {1646726677u, 2726916658u},
-    {1886890678u, 2726916658u},
-    {3298513648u, 2726916658u},
-    {3595761247u, 2726916658u},
-    {928233583u, 2726916658u},
-    {1168299277u, 2726916658u},
-    {2977401802u, 2726916658u},
-    {2618851531u, 2726916658u},
-    {2915443750u, 2726916658u},
-    {3197937172u, 2726916658u},
-    {3436921489u, 2726916658u},
-    {3928456489u, 2726916658u},
-    {2020612540u, 2726916658u},
-    {2307111907u, 2726916658u},
-    {2479214695u, 2726916658u},
-    {2770105108u, 2726916658u},
-    {706207068u, 567791785u},
-    {2128246719u, 2726916658u},
-    {1579452288u, 718505439u},
-    {3351494366u, 1579452288u},
-    {1916267784u, 3351494366u},
-    {3234753418u, 1916267784u},
-    {3188746918u, 3351494366u},
-    {2799343175u, 3188746918u},
-    {3570374500u, 3351494366u},
-    {312972756u, 3570374500u},
-    {2881046729u, 567791785u},
-    {718505439u, 2881046729u},
-    {3092136803u, 2726916658u},
-    {752986672u, 0u},
-    {1775047925u, 3620343033u},
-    {3169208690u, 0u},
-    {3107862979u, 3169208690u},
-    {3978902171u, 2726916658u},
-    {1423048752u, 2726916658u},
-    {3028336524u, 2726916658u},
-    {3258407673u, 2726916658u},
-    {257357155u, 2726916658u},
-    {2646446598u, 2726916658u},
-    {4117152087u, 2726916658u},
-    {187755755u, 2726916658u},
-    {3798211410u, 2726916658u},
-    {3903399900u, 2726916658u},
-    {3054322045u, 2726916658u},
-    {3429527095u, 2726916658u},
-    {1645615504u, 2726916658u},
-    {1742480668u, 2726916658u},
-    {3034038038u, 2726916658u},
-    {45996765u, 2726916658u},
-    {3115305158u, 2726916658u},
-    {2670171062u, 2726916658u},
-    {4084711100u, 2726916658u},
-    {878528594u, 2726916658u},
-    {3034731402u, 2726916658u},
-    {1858661785u, 2726916658u},
-    {3653275918u, 2726916658u},
-    {1214637520u, 2726916658u},
-    {2991756863u, 2726916658u},
-    {3090389870u, 2991756863u},
-    {1043307679u, 2991756863u},
-    {3245646627u, 2991756863u},
-    {3551938470u, 2991756863u},
-    {3852823428u, 2991756863u},
-    {1109437397u, 2726916658u},
-    {2636646231u, 2726916658u},
-    {1442972739u, 407954794u},
-    {567791785u, 2726916658u},
-    {84634380u, 2726916658u},
-    {4016783380u, 622280259u},
-    {2291122455u, 2726916658u},
-    {2178391894u, 567791785u},
-    {2990211100u, 2178391894u},
-    {2380238797u, 567791785u},
-    {1465590465u, 567791785u},
-    {3167037877u, 567791785u},
-    {2852062249u, 3167037877u},
-    {3761303692u, 2852062249u},
-    {1554697778u, 567791785u},
-    {1133810461u, 567791785u},
-    {3305972769u, 2726916658u},
-    {2080389955u, 2726916658u},
-    {3296973358u, 2726916658u},
-    {2443285297u, 2726916658u},
-    {1242568825u, 84634380u},
-    {578449394u, 1839578142u},
-    {1839578142u, 1242568825u},
-    {2871434844u, 578449394u},
-    {3004123225u, 2726916658u},
-    {4014393635u, 2726916658u},
-    {2688920358u, 2726916658u},
-    {2366379834u, 497549541u},
-    {2662939284u, 497549541u},
-    {4266326091u, 2726916658u},
-    {2058541621u, 2726916658u},
-    {407354688u, 77051289u},
-    {2891900272u, 3523137644u},
-    {2586132733u, 552300096u},
-    {3487870079u, 4012739269u},
-    {1550770966u, 2726916658u},
-    {1001341975u, 2726916658u},
-    {2522939977u, 977508624u},
-    {54123589u, 1259551407u},
-    {70005902u, 1291319755u},
-    {4074672627u, 1026710080u},
-    {536013851u, 1226732060u},
-    {238045334u, 928534160u},
-    {147198502u, 3817013504u},
-    {3536201255u, 289102960u},
-    {3982187345u, 553778173u},
-    {1415769934u, 2491993409u},
-    {1041482416u, 1580359821u},
-    {3941239263u, 3942524321u},
-    {4230163536u, 1696635368u},
-    {2092477833u, 1456667981u},
-    {3466416465u, 1083035843u},
-    {3834003294u, 1999235894u},
-    {3535838163u, 3153949916u},
-    {3068421111u, 2309787707u},
-    {300486179u, 2726916658u},
-    {461250893u, 2726916658u},
-    {2870084370u, 2726916658u},
-    {2291558667u, 469708367u},
-    {450760092u, 156469500u},
-    {789657090u, 452865105u},
-    {530749217u, 630800775u},
-    {827898509u, 931849578u},
-    {2421277503u, 2726916658u},
-    {4258810157u, 567791785u},
-    {2377346750u, 2726916658u},
-    {4154229687u, 567791785u},
-    {1907517712u, 2895421296u},
-    {1850534173u, 4099058003u},
-    {4181793464u, 4099058003u},
-    {2027020606u, 567791785u},
-    {529246599u, 567791785u},
-    {1298007339u, 529246599u},
-    {1604790749u, 567791785u},
-    {1826440265u, 1604790749u},
-    {2065424582u, 1826440265u},
-    {3200180919u, 567791785u},
-    {1674585019u, 567791785u},
-    {1387893526u, 2726916658u},
-    {2696709208u, 2566866105u},
-    {520663189u, 2726916658u},
-    {2059202853u, 2726916658u},
-    {2895421296u, 3620343033u},
-    {1294189023u, 567791785u},
-    {1659759987u, 1294189023u},
-    {4036987088u, 1659759987u},
-    {135706558u, 4036987088u},
-    {370955209u, 135706558u},
-    {1949356297u, 3620343033u},
-    {2566866105u, 843617178u},
-    {4102920736u, 567791785u},
-    {2094551816u, 764938613u},
-    {3651587072u, 2094551816u},
-    {3297912606u, 3651587072u},
-    {796974426u, 3297912606u},
-    {2145353959u, 3651587072u},
-    {3468960995u, 2145353959u},
-    {1186180439u, 3651587072u},
-    {3426233346u, 1186180439u},
-    {4011219873u, 567791785u},
-    {764938613u, 4011219873u},
-    {843792386u, 2405304143u},
-    {749578352u, 2405304143u},
-    {3421923095u, 2726916658u},
-    {3255643496u, 2726916658u},
-    {4243056212u, 3620343033u},
-    {1845483130u, 2726916658u},
-    {1600924819u, 2726916658u},
-    {385588147u, 2726916658u},
-    {2126722038u, 2726916658u},
-    {2424428403u, 2726916658u},
-    {868153471u, 0u},
-    {2604657903u, 2726916658u},
-    {620167259u, 2726916658u},
-    {768381414u, 2726916658u},
-    {898299046u, 4179454272u},
-    {233509630u, 898299046u},
-    {3271536277u, 567791785u},
-    {2612768833u, 2102567500u},
-    {228672864u, 2726916658u},
-    {3204491284u, 228672864u},
-    {3454518758u, 3204491284u},
-    {2382959836u, 2102567500u},
-    {2960552844u, 2726916658u},
-    {3402016812u, 2960552844u},
-    {2734381146u, 3402016812u},
-    {819550842u, 2102567500u},
-    {2703085271u, 2726916658u},
-    {1920496009u, 2703085271u},
-    {1146262846u, 1920496009u},
-    {2561181064u, 567791785u},
-    {3361048860u, 3454518758u},
-    {3742348944u, 2726916658u},
-    {3431993741u, 2726916658u},
-    {786159239u, 2734381146u},
-    {1008562442u, 2726916658u},
-    {326115248u, 2726916658u},
-    {457158179u, 1146262846u},
-    {183635336u, 2726916658u},
-    {2948224794u, 2726916658u},
-    {3693594453u, 2405304143u},
-    {564569974u, 497549541u},
-    {2607943079u, 2405304143u},
-    {2816061702u, 497549541u},
-    {499401726u, 2726916658u},
-    {3992122647u, 2401783636u},
-    {2838394204u, 2401783636u},
-    {1372798831u, 567791785u},
-    {3613873764u, 567791785u},
-    {3854168841u, 567791785u},
-    {2081169327u, 567791785u},
-    {2285221890u, 567791785u},
-    {243188882u, 567791785u},
-    {483746111u, 567791785u},
-    {3004272057u, 567791785u},
-    {3345004119u, 567791785u},
-    {2789536792u, 567791785u},
-    {2552977381u, 567791785u},
-    {2749883295u, 567791785u},
-    {3380132775u, 567791785u},
-    {2938406655u, 567791785u},
-    {483058250u, 567791785u},
-    {312462836u, 567791785u},
-    {2407057340u, 567791785u},
-    {2111186039u, 567791785u},
-    {1962739146u, 567791785u},
-    {2254186632u, 567791785u},
-    {3645328989u, 567791785u},
-    {3960042465u, 567791785u},
-    {3135934884u, 567791785u},
-    {3434624319u, 567791785u},
-    {3270812084u, 567791785u},
-    {2210481234u, 2726916658u},
-    {1856204695u, 2726916658u},
-    {3423179401u, 2726916658u},
-    {3192222837u, 2726916658u},
-    {1852067476u, 3966357689u},
-    {1103754588u, 1852067476u},
-    {1339986313u, 1103754588u},
-    {1347590289u, 3192222837u},
-    {2151118934u, 1347590289u},
-    {319233523u, 2151118934u},
-    {628441807u, 319233523u},
-    {925820482u, 628441807u},
-    {3341780549u, 925820482u},
-    {3656494025u, 3341780549u},
-    {3966357689u, 3656494025u},
-    {1739425286u, 2724988498u},
-    {3190207227u, 2724988498u},
-    {3559972623u, 2724988498u},
-    {2338442610u, 2724988498u},
-    {1973133798u, 2724988498u},
-    {2724988498u, 2726916658u},
-    {421078535u, 2227538362u},
-    {338607862u, 2726916658u},
-    {2666078040u, 2726916658u},
-    {2828022438u, 2726916658u},
-    {325645639u, 567791785u},
-    {609720100u, 567791785u},
-    {773499562u, 567791785u},
-    {1055149117u, 567791785u},
-    {3831875288u, 567791785u},
-    {3270595576u, 2726916658u},
-    {2525539168u, 524728837u},
-    {2503452994u, 3620343033u},
-    {811860561u, 2503452994u},
-    {4272014876u, 2726916658u},
-    {209846800u, 3487385081u},
-    {4019161365u, 1175513397u},
-    {1175513397u, 3487385081u},
-    {1885538994u, 3920753945u},
-    {3920753945u, 3487385081u},
-    {535552533u, 498450088u},
-    {4146244031u, 1387663844u},
-    {977508624u, 567791785u},
-    {1259551407u, 567791785u},
-    {1142326112u, 2525539168u},
-    {1680733055u, 497549541u},
-    {3065573393u, 0u},
-    {2835073054u, 497549541u},
-    {2044676802u, 497549541u},
-    {2359474964u, 497549541u},
-    {1097825139u, 497549541u},
-    {2802826641u, 497549541u},
-    {3617764011u, 0u},
-    {353047735u, 3617764011u},
-    {2841302556u, 0u},
-    {1344053016u, 0u},
-    {713393451u, 2359474964u},
-    {1336973505u, 1825881561u},
-    {2959853441u, 1825881561u},
-    {1732937360u, 498450088u},
-    {1635267284u, 1336973505u},
-    {1004900499u, 567791785u},
-    {1272116621u, 1237210745u},
-    {1947478600u, 1272116621u},
-    {4217541411u, 3061072950u},
-    {215562287u, 0u},
-    {4096234345u, 284855721u},
-    {4176684248u, 0u},
-    {4119076029u, 0u},
-    {1673327505u, 567791785u},
-    {279687920u, 1673327505u},
-    {2266553668u, 3746558302u},
-    {4089981509u, 567791785u},
-    {3387633284u, 567791785u},
-    {3024421688u, 567791785u},
-    {4262467277u, 567791785u},
-    {399592015u, 567791785u},
-    {2460336122u, 567791785u},
-    {2086900598u, 567791785u},
-    {3846497591u, 567791785u},
-    {2982628385u, 4140843785u},
-    {1368413764u, 567791785u},
-    {1063630551u, 567791785u},
-    {3563932260u, 2525539168u},
-    {640072513u, 3563932260u},
-    {1371949785u, 640072513u},
-    {3864762204u, 3563932260u},
-    {3189639359u, 3864762204u},
-    {1991123356u, 3563932260u},
-    {1862987346u, 1991123356u},
-    {4157307685u, 2266553668u},
-    {642363752u, 567791785u},
-    {3340640726u, 567791785u},
-    {3281080856u, 1458068209u},
-    {792221549u, 567791785u},
-    {4238365957u, 2726916658u},
-    {1710092884u, 1900803227u},
-    {2758622649u, 567791785u},
-    {4059977918u, 2758622649u},
-    {4268257682u, 4059977918u},
-    {3684838406u, 4268257682u},
-    {752438899u, 567791785u},
-    {2429672886u, 567791785u},
-    {3195582723u, 567791785u},
-    {1987186480u, 2726916658u},
-    {2753555083u, 1987186480u},
-    {2353688199u, 1023887647u},
-    {852534977u, 4244503350u},
-    {4244503350u, 1023887647u},
-    {954938090u, 132180299u},
-    {132180299u, 1023887647u},
-    {560980432u, 1468333525u},
-    {2539716309u, 567791785u},
-    {2670825306u, 498450088u},
-    {1545632388u, 2895421296u},
-    {20902711u, 3281080856u},
-    {221775280u, 567791785u},
-    {2357232699u, 221775280u},
-    {3205163343u, 2357232699u},
-    {1678652251u, 3205163343u},
-    {1330671677u, 567791785u},
-    {3131490264u, 567791785u},
-    {1843793152u, 4154229687u},
-    {399140690u, 20902711u},
-    {428356429u, 567791785u},
-    {1337696179u, 428356429u},
-    {1027406518u, 1337696179u},
-    {1217736659u, 567791785u},
-    {699248667u, 428356429u},
-    {1051777569u, 567791785u},
-    {3621332160u, 2726916658u},
-    {2431360521u, 567791785u},
-    {4274798758u, 2431360521u},
-    {1409119795u, 567791785u},
-    {1835960745u, 1409119795u},
-    {1900803227u, 2072860801u},
-    {2413396637u, 2072860801u},
-    {2692352206u, 407954794u},
-    {198244558u, 3216727789u},
-    {4212840290u, 198244558u},
-    {3930207657u, 4212840290u},
-    {2209626904u, 3930207657u},
-    {1540633403u, 4140843785u},
-    {287270140u, 4140843785u},
-    {524728837u, 1900803227u},
-    {890102883u, 3200992048u},
-    {3200992048u, 567791785u},
-    {2345016067u, 567791785u},
-    {3387066931u, 567791785u},
-    {286101867u, 2726916658u},
-    {1041216236u, 1673327505u},
-    {1749508038u, 1041216236u},
-    {1287964149u, 2726916658u},
-    {559175070u, 567791785u},
-    {1317099658u, 4099058003u},
-    {3264788844u, 567791785u},
-    {724094749u, 3216727789u},
-    {943876432u, 724094749u},
-    {3337782962u, 943876432u},
-    {810894083u, 3337782962u},
-    {3590724549u, 2726916658u},
-    {3950397093u, 3590724549u},
-    {239022231u, 3264788844u},
-    {1388173060u, 2565524048u},
-    {2022858524u, 4140843785u},
-    {3971649130u, 4140843785u},
-    {268260591u, 4140843785u},
-    {3259152763u, 4140843785u},
-    {3062918367u, 567791785u},
-    {3290761224u, 3062918367u},
-    {1594602635u, 1495630334u},
-    {3483479177u, 3216727789u},
-    {127966342u, 3483479177u},
-    {887355148u, 127966342u},
-    {3920976780u, 887355148u},
-    {3660131708u, 2563300581u},
-    {2362924145u, 1941569559u},
-    {1825881561u, 3620343033u},
-    {2370804950u, 497549541u},
-    {3669183925u, 567791785u},
-    {1732281932u, 567791785u},
-    {3365866860u, 567791785u},
-    {1952565859u, 567791785u},
-    {4230965472u, 1900803227u},
-    {584112430u, 567791785u},
-    {3709128119u, 584112430u},
-    {123937363u, 3709128119u},
-    {1871409830u, 123937363u},
-    {100048734u, 567791785u},
-    {3160050727u, 100048734u},
-    {3935332498u, 3160050727u},
-    {1157169726u, 567791785u},
-    {3032317542u, 567791785u},
-    {2208537651u, 567791785u},
-    {1759461929u, 567791785u},
-    {2908721569u, 2726916658u},
-    {178867251u, 2908721569u},
-    {165726974u, 3458403359u},
-    {697830620u, 567791785u},
-    {123143823u, 3669183925u},
-    {3458403359u, 567791785u},
-    {393246525u, 567791785u},
-    {714964964u, 567791785u},
-    {4157905491u, 714964964u},
-    {3359901234u, 393246525u},
-    {38813266u, 567791785u},
-    {561920284u, 567791785u},
-    {3108519283u, 764979090u},
-    {2995209657u, 3458403359u},
-    {4060997878u, 497549541u},
-    {3662356388u, 3216727789u},
-    {3893213993u, 3662356388u},
-    {2769958247u, 3893213993u},
-    {1143123657u, 2769958247u},
-    {3619289854u, 3449862424u},
-    {1653896492u, 497549541u},
-    {1950455942u, 497549541u},
-    {2248424459u, 497549541u},
-    {2622220442u, 497549541u},
-    {2922679407u, 497549541u},
-    {3205137251u, 497549541u},
-    {1369013194u, 3216344818u},
-    {3216344818u, 811860561u},
-    {3516299831u, 559175070u},
-    {204057857u, 567791785u},
-    {3746558302u, 4217541411u},
-    {813763102u, 3061072950u},
-    {3771578632u, 3746558302u},
-    {3291028981u, 3746558302u},
-    {339389002u, 0u},
-    {2637440474u, 339389002u},
-    {1357419157u, 0u},
-    {104272027u, 1357419157u},
-    {1766919226u, 567791785u},
-    {3160257106u, 567791785u},
-    {3467663095u, 567791785u},
-    {117720990u, 567791785u},
-    {3474194013u, 4099058003u},
-    {1189247508u, 567791785u},
-    {831760856u, 3783973932u},
-    {2688535938u, 3783973932u},
-    {498450088u, 3620343033u},
-    {3509101776u, 1468333525u},
-    {86245637u, 567791785u},
-    {52112891u, 1468333525u},
-    {1468333525u, 1330671677u},
-    {1415649289u, 567791785u},
-    {3587087074u, 1415649289u},
-    {3878501791u, 3587087074u},
-    {4058796829u, 3878501791u},
-    {407954794u, 567791785u},
-    {4140843785u, 567791785u},
-    {1400616475u, 567791785u},
-    {1642943230u, 1400616475u},
-    {2099087710u, 1642943230u},
-    {932016844u, 1400616475u},
-    {3835667144u, 4140843785u},
-    {1706108145u, 4140843785u},
-    {3284101644u, 567791785u},
-    {978245741u, 3216727789u},
-    {1282964672u, 978245741u},
-    {1453035782u, 1282964672u},
-    {1965938483u, 1453035782u},
-    {2357602519u, 1142326112u},
-    {3055515370u, 2359474964u},
-    {382516222u, 1825881561u},
-    {430450076u, 1825881561u},
-    {1237210745u, 567791785u},
-    {141757751u, 3620343033u},
-    {2979637790u, 382516222u},
-    {1291319755u, 567791785u},
-    {1026710080u, 567791785u},
-    {1226732060u, 567791785u},
-    {928534160u, 567791785u},
-    {3817013504u, 567791785u},
-    {289102960u, 567791785u},
-    {553778173u, 567791785u},
-    {980420752u, 567791785u},
-    {2223369394u, 567791785u},
-    {3502752062u, 2223369394u},
-    {569531117u, 3216727789u},
-    {3870750844u, 567791785u},
-    {2436389468u, 567791785u},
-    {1754637418u, 567791785u},
-    {3548344289u, 567791785u},
-    {3857993538u, 567791785u},
-    {2598712176u, 567791785u},
-    {3061793532u, 567791785u},
-    {3202302196u, 567791785u},
-    {926811968u, 3671957889u},
-    {2128216747u, 926811968u},
-    {2964579934u, 926811968u},
-    {2739719056u, 926811968u},
-    {1427025685u, 926811968u},
-    {3580243906u, 926811968u},
-    {4154815552u, 926811968u},
-    {3923007646u, 926811968u},
-    {2618965291u, 926811968u},
-    {3671957889u, 567791785u},
-    {2961989026u, 567791785u},
-    {1851000760u, 567791785u},
-    {4196382733u, 567791785u},
-    {3069215008u, 567791785u},
-    {2081596213u, 567791785u},
-    {3072987811u, 567791785u},
-    {2982262173u, 567791785u},
-    {2447363791u, 567791785u},
-    {726996523u, 567791785u},
-    {3731668371u, 567791785u},
-    {2704371058u, 567791785u},
-    {3584631159u, 567791785u},
-    {3745841892u, 567791785u},
-    {1733261739u, 567791785u},
-    {166010900u, 3550536900u},
-    {3632260857u, 166010900u},
-    {3385706901u, 166010900u},
-    {304077368u, 166010900u},
-    {3295264461u, 166010900u},
-    {4001698563u, 166010900u},
-    {550959014u, 166010900u},
-    {4074478492u, 166010900u},
-    {613580553u, 166010900u},
-    {3550536900u, 567791785u},
-    {688177653u, 567791785u},
-    {882447423u, 567791785u},
-    {3593922608u, 567791785u},
-    {589402908u, 567791785u},
-    {4206633094u, 567791785u},
-    {1661678569u, 567791785u},
-    {4178184213u, 567791785u},
-    {2102299048u, 567791785u},
-    {3235401351u, 567791785u},
-    {1021430484u, 567791785u},
-    {4104846447u, 1021430484u},
-    {3693122706u, 1021430484u},
-    {2634919170u, 4140843785u},
-    {3216727789u, 4157307685u},
-    {2563300581u, 567791785u},
-    {1941569559u, 2563300581u},
-    {2696433044u, 4099058003u},
-    {247529202u, 2726916658u},
-    {77051289u, 567791785u},
-    {3523137644u, 567791785u},
-    {552300096u, 567791785u},
-    {4012739269u, 567791785u},
-    {2565524048u, 567791785u},
-    {2307684303u, 2726916658u},
-    {936740635u, 567791785u},
-    {4077360421u, 2726916658u},
-    {366842583u, 4085355481u},
-    {3835394113u, 3008301052u},
-    {4179454272u, 3061072950u},
-    {237586392u, 84634380u},
-    {4092822280u, 2129664872u},
-    {2129664872u, 237586392u},
-    {594456118u, 4092822280u},
-    {238830721u, 2726916658u},
-    {2523414519u, 3344679897u},
-    {1680169842u, 2235514797u},
-    {2830230666u, 2850031842u},
-    {1990983807u, 3628033440u},
-    {2925873445u, 238830721u},
-    {1355981805u, 238830721u},
-    {369569363u, 238830721u},
-    {3771253719u, 238830721u},
-    {981661514u, 238830721u},
-    {150803519u, 238830721u},
-    {2869778529u, 238830721u},
-    {3308287675u, 238830721u},
-    {2466288220u, 238830721u},
-    {2848112608u, 238830721u},
-    {388471444u, 238830721u},
-    {1222540801u, 238830721u},
-    {867521455u, 238830721u},
-    {1704015722u, 238830721u},
-    {1312622786u, 238830721u},
-    {1495630334u, 567791785u},
-    {2072860801u, 567791785u},
-    {1642368672u, 2726916658u},
-    {2416601835u, 2726916658u},
-    {3768604471u, 2726916658u},
-    {2121297440u, 2726916658u},
-    {3344679897u, 407354688u},
-    {2235514797u, 2891900272u},
-    {2850031842u, 2586132733u},
-    {3628033440u, 3487870079u},
-    {3620343033u, 2405304143u},
-    {3069185626u, 3116333173u},
-    {1765274351u, 3282275393u},
-    {497549541u, 3620343033u},
-    {3116333173u, 3620343033u},
-    {3282275393u, 3620343033u},
-    {1448615591u, 2726916658u},
-    {1046831467u, 567791785u},
-    {1587829056u, 2726916658u},
-    {1894448589u, 1587829056u},
-    {2047664273u, 1026417588u},
-    {1813333154u, 3537047296u},
-    {3948699063u, 2726916658u},
-    {1875707837u, 1719620090u},
-    {2163878423u, 2688238961u},
-    {2454703298u, 1391831783u},
-    {1719620090u, 2726916658u},
-    {2688238961u, 2726916658u},
-    {1391831783u, 2726916658u},
-    {1026417588u, 2726916658u},
-    {3537047296u, 2726916658u},
-    {2002250715u, 2726916658u},
-    {1337961391u, 2726916658u},
-    {4094656420u, 2726916658u},
-    {695991093u, 2726916658u},
-    {764979090u, 567791785u},
-    {257870450u, 2726916658u},
-    {461493020u, 2726916658u},
-    {790266838u, 2726916658u},
-    {1401298368u, 2726916658u},
-    {3180974149u, 567791785u},
-    {2658480396u, 3180974149u},
-    {4052515463u, 567791785u},
-    {102955111u, 567791785u},
-    {3855637643u, 567791785u},
-    {2879678516u, 3855637643u},
-    {3126035858u, 2879678516u},
-    {276017613u, 3126035858u},
-    {783937113u, 567791785u},
-    {1191082628u, 567791785u},
-    {762201956u, 1191082628u},
-    {2682647519u, 2803439941u},
-    {693737955u, 567791785u},
-    {1497906636u, 2726916658u},
-    {1024671026u, 567791785u},
-    {534250172u, 1024671026u},
-    {1382016971u, 534250172u},
-    {2989762410u, 1382016971u},
-    {2759003112u, 2989762410u},
-    {2803439941u, 567791785u},
-    {1585371058u, 567791785u},
-    {2227538362u, 3620343033u},
-    {470752987u, 2726916658u},
-    {1188711348u, 2726916658u},
-    {3933329929u, 2227538362u},
-    {871669885u, 2726916658u},
-    {3357634932u, 2726916658u},
-    {329644197u, 957797217u},
-    {955335483u, 329644197u},
-    {723101580u, 955335483u},
-    {2799841014u, 3357634932u},
-    {2494892700u, 2799841014u},
-    {2182276440u, 2494892700u},
-    {1884438999u, 2182276440u},
-    {1837579329u, 1884438999u},
-    {1502352459u, 1837579329u},
-    {1205694702u, 1502352459u},
-    {957797217u, 1205694702u},
-    {1303911096u, 418620215u},
-    {2044818186u, 418620215u},
-    {1871666790u, 418620215u},
-    {2759084079u, 418620215u},
-    {2325943437u, 418620215u},
-    {418620215u, 2726916658u},
-    {2374286536u, 2726916658u},
-    {2557924012u, 2726916658u},
-    {792191633u, 2726916658u},
-    {860567359u, 2726916658u},
-    {3439053269u, 2726916658u},
-    {1857195332u, 2726916658u},
-    {465715614u, 2726916658u},
-    {1332087532u, 2726916658u},
-    {1629531745u, 2726916658u},
-    {1805501275u, 2726916658u},
-    {2097374758u, 2726916658u},
-    {376084722u, 2726916658u},
-    {665402223u, 2726916658u},
-    {4140554400u, 2726916658u},
-    {4268096845u, 3783973932u},
-    {3008301052u, 3620343033u},
-    {3106683811u, 3008301052u},
-    {997715595u, 2726916658u},
-    {148150983u, 3487385081u},
-    {3208123503u, 1675554705u},
-    {1675554705u, 3208123503u},
-    {4073028489u, 2818173706u},
-    {2818173706u, 4073028489u},
-    {476502330u, 705922756u},
-    {870255675u, 1387663844u},
-    {2491993409u, 567791785u},
-    {1580359821u, 567791785u},
-    {2049782909u, 4268096845u},
-    {1503220503u, 497549541u},
-    {1606571537u, 0u},
-    {630489018u, 497549541u},
-    {2911986502u, 497549541u},
-    {2011106085u, 497549541u},
-    {1292570642u, 497549541u},
-    {4125754605u, 497549541u},
-    {658413182u, 0u},
-    {2514353650u, 658413182u},
-    {2490953973u, 0u},
-    {524831829u, 0u},
-    {2022986004u, 2011106085u},
-    {1396032091u, 1360155857u},
-    {3218433468u, 1360155857u},
-    {2200477764u, 705922756u},
-    {3604588876u, 1396032091u},
-    {3800032069u, 567791785u},
-    {3623525379u, 1047768032u},
-    {3812362030u, 3623525379u},
-    {113224493u, 3061072950u},
-    {1843892274u, 0u},
-    {2762743218u, 2137612194u},
-    {1895700580u, 0u},
-    {4285130512u, 0u},
-    {1681854081u, 567791785u},
-    {3204711383u, 1681854081u},
-    {2970756967u, 1665358410u},
-    {3974058683u, 567791785u},
-    {1953769567u, 567791785u},
-    {2260913404u, 567791785u},
-    {2005839528u, 567791785u},
-    {2233616847u, 567791785u},
-    {2599646577u, 567791785u},
-    {2833781082u, 567791785u},
-    {3197516982u, 567791785u},
-    {3248592082u, 3301476370u},
-    {802037369u, 567791785u},
-    {2163166549u, 567791785u},
-    {708670027u, 4268096845u},
-    {2906427843u, 708670027u},
-    {4072946546u, 2906427843u},
-    {1498761862u, 708670027u},
-    {1779413271u, 1498761862u},
-    {2884154752u, 708670027u},
-    {2716785905u, 2884154752u},
-    {3356280828u, 2970756967u},
-    {3916096451u, 567791785u},
-    {3586508350u, 567791785u},
-    {2134928656u, 1458068209u},
-    {1440689943u, 567791785u},
-    {2629297631u, 2726916658u},
-    {1282140579u, 2907905148u},
-    {835718401u, 567791785u},
-    {1076734396u, 835718401u},
-    {2372092970u, 1076734396u},
-    {2611601591u, 2372092970u},
-    {145275571u, 567791785u},
-    {2286030167u, 567791785u},
-    {2863223333u, 567791785u},
-    {2157529237u, 2726916658u},
-    {1725043975u, 2157529237u},
-    {4058873060u, 1023887647u},
-    {2647247259u, 1486358852u},
-    {1486358852u, 1023887647u},
-    {2852643351u, 3278587725u},
-    {3278587725u, 1023887647u},
-    {2429286607u, 2590276672u},
-    {3782241303u, 567791785u},
-    {2798464200u, 705922756u},
-    {1300136028u, 2895421296u},
-    {3639903371u, 2134928656u},
-    {4001712163u, 567791785u},
-    {2701077784u, 4001712163u},
-    {3266867338u, 2701077784u},
-    {3017134789u, 3266867338u},
-    {275021293u, 567791785u},
-    {2910764364u, 567791785u},
-    {2611971637u, 4154229687u},
-    {743339293u, 3639903371u},
-    {3722266261u, 567791785u},
-    {4029639481u, 3722266261u},
-    {3200747626u, 4029639481u},
-    {2299776059u, 567791785u},
-    {3414914564u, 3722266261u},
-    {2798791814u, 567791785u},
-    {4093298414u, 2726916658u},
-    {767425248u, 567791785u},
-    {2197101825u, 767425248u},
-    {904278569u, 567791785u},
-    {4021302725u, 904278569u},
-    {2907905148u, 2072860801u},
-    {3420689105u, 2072860801u},
-    {1501527398u, 2231500842u},
-    {3770474639u, 1310993196u},
-    {4277804297u, 3770474639u},
-    {2054689799u, 4277804297u},
-    {2492699346u, 2054689799u},
-    {4003831577u, 3301476370u},
-    {3639316156u, 3301476370u},
-    {3783973932u, 2907905148u},
-    {3831889766u, 2335091557u},
-    {2335091557u, 567791785u},
-    {2520538412u, 567791785u},
-    {4200598998u, 567791785u},
-    {647525950u, 2726916658u},
-    {944552693u, 1681854081u},
-    {3904186436u, 944552693u},
-    {1618744748u, 2726916658u},
-    {4222341536u, 567791785u},
-    {4006501473u, 4099058003u},
-    {1984855388u, 567791785u},
-    {812161446u, 1310993196u},
-    {1034073114u, 812161446u},
-    {148130434u, 1034073114u},
-    {3546037191u, 148130434u},
-    {3593695816u, 2726916658u},
-    {2785907197u, 3593695816u},
-    {1520646530u, 1984855388u},
-    {4073776971u, 2565524048u},
-    {3312143588u, 3301476370u},
-    {2479252796u, 3301476370u},
-    {2145467758u, 3301476370u},
-    {1847237089u, 3301476370u},
-    {3217677901u, 567791785u},
-    {3784319449u, 3217677901u},
-    {1073302274u, 1495630334u},
-    {1719789456u, 1310993196u},
-    {869597751u, 1719789456u},
-    {3693662948u, 869597751u},
-    {1729498404u, 3693662948u},
-    {2581087731u, 3068704555u},
-    {319614870u, 3571316050u},
-    {1360155857u, 3620343033u},
-    {1668442840u, 497549541u},
-    {2094109583u, 567791785u},
-    {768395665u, 567791785u},
-    {197266429u, 567791785u},
-    {2281324824u, 567791785u},
-    {2447288296u, 2907905148u},
-    {17223862u, 567791785u},
-    {4071371777u, 17223862u},
-    {3494178611u, 4071371777u},
-    {3103768745u, 3494178611u},
-    {222980417u, 567791785u},
-    {4289252862u, 222980417u},
-    {3953567226u, 4289252862u},
-    {1481063746u, 567791785u},
-    {4025803247u, 567791785u},
-    {3786294626u, 567791785u},
-    {2268888731u, 567791785u},
-    {622475301u, 2726916658u},
-    {4093695475u, 622475301u},
-    {3237172461u, 3708936486u},
-    {4025675475u, 567791785u},
-    {1462887748u, 2094109583u},
-    {3708936486u, 567791785u},
-    {3673823181u, 567791785u},
-    {1766662782u, 567791785u},
-    {1477378046u, 1766662782u},
-    {3559570972u, 3673823181u},
-    {1025623836u, 567791785u},
-    {1561737944u, 567791785u},
-    {2167947592u, 764979090u},
-    {3649043221u, 3708936486u},
-    {660457104u, 497549541u},
-    {931042330u, 1310993196u},
-    {1237039252u, 931042330u},
-    {2624511473u, 1237039252u},
-    {2819542915u, 2624511473u},
-    {378834321u, 3449862424u},
-    {2177680988u, 497549541u},
-    {2469390626u, 497549541u},
-    {4129238787u, 497549541u},
-    {3621843591u, 497549541u},
-    {2797473858u, 497549541u},
-    {3074686431u, 497549541u},
-    {682273574u, 2739289683u},
-    {2739289683u, 3106683811u},
-    {1166594346u, 4222341536u},
-    {3884601638u, 567791785u},
-    {1665358410u, 113224493u},
-    {954251114u, 3061072950u},
-    {457744838u, 1665358410u},
-    {3360970358u, 1665358410u},
-    {2257473628u, 0u},
-    {3149788146u, 2257473628u},
-    {3273527615u, 0u},
-    {2030996345u, 3273527615u},
-    {3212206043u, 567791785u},
-    {2715821231u, 567791785u},
-    {1255274124u, 567791785u},
-    {1024908054u, 567791785u},
-    {1767831881u, 4099058003u},
-    {1091651574u, 567791785u},
-    {563530995u, 524728837u},
-    {850569389u, 524728837u},
-    {705922756u, 3620343033u},
-    {2201033226u, 2590276672u},
-    {2681793709u, 567791785u},
-    {1635783371u, 2590276672u},
-    {2590276672u, 275021293u},
-    {1202702096u, 567791785u},
-    {1439523659u, 1202702096u},
-    {3846570558u, 1439523659u},
-    {4228329408u, 3846570558u},
-    {2231500842u, 567791785u},
-    {3301476370u, 567791785u},
-    {2558765017u, 567791785u},
-    {1270025781u, 2558765017u},
-    {3125439334u, 1270025781u},
-    {1776095517u, 2558765017u},
-    {609567619u, 3301476370u},
-    {905963224u, 3301476370u},
-    {306890114u, 567791785u},
-    {1102577659u, 1310993196u},
-    {787765876u, 1102577659u},
-    {3860416703u, 787765876u},
-    {2176474540u, 3860416703u},
-    {1939367865u, 2049782909u},
-    {3288663904u, 2011106085u},
-    {2173355228u, 1360155857u},
-    {674498645u, 1360155857u},
-    {1047768032u, 567791785u},
-    {1786766851u, 3620343033u},
-    {2899694509u, 2173355228u},
-    {3942524321u, 567791785u},
-    {1696635368u, 567791785u},
-    {1456667981u, 567791785u},
-    {1083035843u, 567791785u},
-    {1999235894u, 567791785u},
-    {3153949916u, 567791785u},
-    {2309787707u, 567791785u},
-    {3839060481u, 567791785u},
-    {1205209995u, 567791785u},
-    {1611614878u, 1205209995u},
-    {2499881490u, 1310993196u},
-    {3412486250u, 567791785u},
-    {3282254545u, 567791785u},
-    {1230749804u, 567791785u},
-    {673389254u, 567791785u},
-    {2192524473u, 567791785u},
-    {3031470467u, 567791785u},
-    {3155071899u, 567791785u},
-    {1770326393u, 567791785u},
-    {4151378384u, 382218229u},
-    {1061283032u, 4151378384u},
-    {762331445u, 4151378384u},
-    {1803205969u, 4151378384u},
-    {1515199228u, 4151378384u},
-    {2148525691u, 4151378384u},
-    {1850032870u, 4151378384u},
-    {1421348804u, 4151378384u},
-    {3261557537u, 4151378384u},
-    {382218229u, 567791785u},
-    {295177829u, 567791785u},
-    {445974206u, 567791785u},
-    {1066474903u, 567791785u},
-    {4005736250u, 567791785u},
-    {138174985u, 567791785u},
-    {1712144270u, 567791785u},
-    {2959938177u, 567791785u},
-    {4278341525u, 567791785u},
-    {225776827u, 567791785u},
-    {2223289680u, 567791785u},
-    {3974277974u, 567791785u},
-    {3907744388u, 567791785u},
-    {2992552996u, 567791785u},
-    {1803430031u, 567791785u},
-    {3968009904u, 237617448u},
-    {2328021520u, 3968009904u},
-    {2637983491u, 3968009904u},
-    {1583804761u, 3968009904u},
-    {819009070u, 3968009904u},
-    {3519043598u, 3968009904u},
-    {3825466517u, 3968009904u},
-    {1833668386u, 3968009904u},
-    {2005443484u, 3968009904u},
-    {237617448u, 567791785u},
-    {1122782432u, 567791785u},
-    {1631065091u, 567791785u},
-    {1109449997u, 567791785u},
-    {3702738401u, 567791785u},
-    {1341747590u, 567791785u},
-    {152551772u, 567791785u},
-    {3986162229u, 567791785u},
-    {916948579u, 567791785u},
-    {4020787006u, 567791785u},
-    {2001947653u, 567791785u},
-    {2557431765u, 567791785u},
-    {3290958398u, 2001947653u},
-    {1100663657u, 3301476370u},
-    {1310993196u, 3356280828u},
-    {3068704555u, 567791785u},
-    {3571316050u, 3068704555u},
-    {1777916161u, 497549541u},
-    {2634601848u, 497549541u},
-    {1263186429u, 497549541u},
-    {1082498163u, 497549541u},
-    {1854896262u, 497549541u},
-    {3825361770u, 497549541u},
-    {2086501834u, 497549541u},
-    {259892264u, 497549541u},
-    {4257022119u, 497549541u},
-    {1020427985u, 497549541u},
-    {720558866u, 497549541u},
-    {3636213414u, 497549541u},
-    {3794192763u, 497549541u},
-    {1636290156u, 2726916658u},
-    {362165850u, 2726916658u},
-    {1681053934u, 2726916658u},
-    {755919266u, 4085355481u},
-    {2083853213u, 2726916658u},
-    {826122527u, 2210481234u},
-    {595527074u, 2210481234u},
-    {3916480659u, 2726916658u},
-    {1570658564u, 567791785u},
-    {2401783636u, 2726916658u},
-    {1025849218u, 2726916658u},
-    {4060706981u, 2072860801u},
-    {2242507051u, 4060706981u},
-    {3061072950u, 2242507051u},
-    {2954194361u, 2726916658u},
-    {4261665176u, 2726916658u},
-    {298354645u, 567791785u},
-    {338710066u, 298354645u},
-    {2919287888u, 4099058003u},
-    {1458068209u, 567791785u},
-    {2568524136u, 2726916658u},
-    {3449862424u, 567791785u},
-    {2250973670u, 3449862424u},
-    {3570760957u, 2726916658u},
-    {2359506969u, 567791785u},
-    {2060981379u, 2359506969u},
-    {3587933164u, 2523414519u},
-    {1134583660u, 1680169842u},
-    {2645365644u, 2830230666u},
-    {197259188u, 1990983807u},
-    {635268839u, 567791785u},
-    {4086401616u, 567791785u},
-    {921899274u, 567791785u},
-    {348179630u, 567791785u},
-    {948966460u, 567791785u},
-    {1800894922u, 567791785u},
-    {619080913u, 567791785u},
-    {1202008678u, 567791785u},
-    {2046112361u, 2726916658u},
-    {1828274654u, 2726916658u},
-    {831168718u, 2726916658u},
-    {3312333887u, 567791785u},
-    {1462638923u, 567791785u},
-    {2225632319u, 567791785u},
-    {1926418580u, 567791785u},
-    {2722377586u, 567791785u},
-    {622280259u, 3620343033u},
-    {2118432348u, 84634380u},
-    {1075982656u, 2529748557u},
-    {2529748557u, 2118432348u},
-    {479761161u, 1075982656u},
-    {2726916658u, 0u},
-    {2405304143u, 1697942313u},
-    {2619700730u, 3546266377u},
-    {1971300527u, 411682144u},
-    {3546266377u, 2405304143u},
-    {411682144u, 2405304143u},
-    {843617178u, 2405304143u},
-};
+static constexpr perfect_hash::Table<uint32_t, 300, 1201> bone_parent_table = {{
+    {
+        1u, 2u, 125u, 35u, 201u, 10u, 9u, 75u,
+        249u, 65u, 21u, 25u, 309u, 89u, 13u, 3u,
+        79u, 178u, 45u, 8u, 18u, 14u, 16u, 169u,
+        4u, 1u, 12u, 22u, 217u, 1u, 87u, 26u,
+        14u, 10u, 20u, 32u, 26u, 1u, 55u, 59u,
+        9u, 31u, 67u, 15u, 6u, 13u, 60u, 190u,
+        260u, 1u, 164u, 2u, 3u, 104u, 7u, 0u,
+        77u, 33u, 4u, 5u, 28u, 9u, 344u, 13u,
+        23u, 6u, 5u, 53u, 107u, 336u, 15u, 74u,
+        44u, 5u, 31u, 161u, 5u, 25u, 12u, 1u,
+        5u, 0u, 40u, 111u, 224u, 139u, 6u, 49u,
+        2u, 4u, 9u, 47u, 4u, 69u, 113u, 6u,
+        615u, 193u, 118u, 6u, 2u, 6u, 22u, 0u,
+        201u, 121u, 393u, 1u, 19u, 7u, 6u, 0u,
+        5u, 8u, 51u, 2u, 8u, 28u, 1u, 44u,
+        7u, 0u, 11u, 18u, 521u, 104u, 196u, 9u,
+        5u, 425u, 1u, 9u, 61u, 151u, 155u, 2u,
+        3u, 569u, 247u, 69u, 45u, 46u, 2u, 6u,
+        825u, 28u, 86u, 80u, 33u, 160u, 29u, 4u,
+        54u, 42u, 320u, 28u, 5u, 4u, 2u, 268u,
+        233u, 107u, 173u, 45u, 1u, 2u, 17u, 20u,
+        31u, 28u, 225u, 12u, 40u, 12u, 355u, 3u,
+        2u, 21u, 82u, 38u, 257u, 5u, 11u, 4u,
+        10u, 344u, 38u, 196u, 22u, 1205u, 54u, 898u,
+        20u, 94u, 3u, 278u, 19u, 12u, 435u, 1747u,
+        106u, 89u, 3u, 382u, 1u, 16u, 3u, 6u,
+        413u, 95u, 69u, 18u, 95u, 1965u, 4379u, 47u,
+        6u, 30u, 1397u, 201u, 820u, 2780u, 588u, 3u,
+        24u, 28u, 333u, 104u, 1715u, 36u, 3u, 2205u,
+        445u, 0u, 1546u, 96u, 1u, 1819u, 524u, 590u,
+        643u, 0u, 428u, 24u, 21u, 59u, 27u, 3u,
+        406u, 1113u, 7u, 25u, 15u, 565u, 397u, 3983u,
+        14u, 11u, 2u, 543u, 4u, 75u, 24u, 601u,
+        121u, 182u, 12u, 323u, 22u, 72u, 79u, 3420u,
+        34u, 57u, 2u, 719u, 1u, 24u, 471u, 747u,
+        37u, 1313u, 1912u, 162u, 168u, 1800u, 60u, 1u,
+        115u, 6856u, 50u, 6u, 43u, 1u, 355u, 20u,
+        308u, 1852u, 31u, 100u,
+    }
+}, {
+    {
+        {4285130512u, 0u},
+        {2197101825u, 767425248u},
+        {1939367865u, 2049782909u},
+        {2830230666u, 2850031842u},
+        {536013851u, 1226732060u},
+        {3551938470u, 2991756863u},
+        {3509101776u, 1468333525u},
+        {1769025762u, 2726916658u},
+        {1368062130u, 2726916658u},
+        {948966460u, 567791785u},
+        {479761161u, 1075982656u},
+        {561920284u, 567791785u},
+        {2200477764u, 705922756u},
+        {3835667144u, 4140843785u},
+        {2225632319u, 567791785u},
+        {868153471u, 0u},
+        {1369013194u, 3216344818u},
+        {2911986502u, 497549541u},
+        {2148525691u, 4151378384u},
+        {2749883295u, 567791785u},
+        {1339986313u, 1103754588u},
+        {1776095517u, 2558765017u},
+        {1729498404u, 3693662948u},
+        {3905215779u, 2401783636u},
+        {3559570972u, 3673823181u},
+        {1550770966u, 2726916658u},
+        {1725043975u, 2157529237u},
+        {3516299831u, 559175070u},
+        {388916045u, 3116333173u},
+        {2852062249u, 3167037877u},
+        {391037130u, 2726916658u},
+        {2372092970u, 1076734396u},
+        {4073028489u, 2818173706u},
+        {3920753945u, 3487385081u},
+        {2797473858u, 497549541u},
+        {3278587725u, 1023887647u},
+        {3857993538u, 567791785u},
+        {1857195332u, 2726916658u},
+        {2964579934u, 926811968u},
+        {1020427985u, 497549541u},
+        {3235401351u, 567791785u},
+        {1368413764u, 567791785u},
+        {3903399900u, 2726916658u},
+        {882447423u, 567791785u},
+        {2989762410u, 1382016971u},
+        {2335091557u, 567791785u},
+        {2081596213u, 567791785u},
+        {665402223u, 2726916658u},
+        {3992122647u, 2401783636u},
+        {1719620090u, 2726916658u},
+        {2925873445u, 238830721u},
+        {3953567226u, 4289252862u},
+        {682273574u, 2739289683u},
+        {3297912606u, 3651587072u},
+        {3693122706u, 1021430484u},
+        {2641020513u, 1928556915u},
+        {2307684303u, 2726916658u},
+        {3258407673u, 2726916658u},
+        {3595761247u, 2726916658u},
+        {2490953973u, 0u},
+        {3068704555u, 567791785u},
+        {2557924012u, 2726916658u},
+        {1950455942u, 497549541u},
+        {2558765017u, 567791785u},
+        {1146262846u, 1920496009u},
+        {524728837u, 1900803227u},
+        {3550536900u, 567791785u},
+        {2235514797u, 2891900272u},
+        {3571316050u, 3068704555u},
+        {871669885u, 2726916658u},
+        {826122527u, 2210481234u},
+        {2703085271u, 2726916658u},
+        {3722266261u, 567791785u},
+        {713393451u, 2359474964u},
+        {2798464200u, 705922756u},
+        {2405304143u, 1697942313u},
+        {887355148u, 127966342u},
+        {1064320924u, 1305566302u},
+        {792221549u, 567791785u},
+        {3054322045u, 2726916658u},
+        {257357155u, 2726916658u},
+        {215562287u, 0u},
+        {2167947592u, 764979090u},
+        {630489018u, 497549541u},
+        {4140843785u, 567791785u},
+        {584112430u, 567791785u},
+        {289102960u, 567791785u},
+        {2565524048u, 567791785u},
+        {1854896262u, 497549541u},
+        {852534977u, 4244503350u},
+        {1027681439u, 2726916658u},
+        {1594602635u, 1495630334u},
+        {239022231u, 3264788844u},
+        {2770105108u, 2726916658u},
+        {764938613u, 4011219873u},
+        {3004272057u, 567791785u},
+        {2436389468u, 567791785u},
+        {1272116621u, 1237210745u},
+        {860567359u, 2726916658u},
+        {1462887748u, 2094109583u},
+        {1668442840u, 497549541u},
+        {1486358852u, 1023887647u},
+        {4086401616u, 567791785u},
+        {3673823181u, 567791785u},
+        {1583804761u, 3968009904u},
+        {268260591u, 4140843785u},
+        {4020787006u, 567791785u},
+        {4178184213u, 567791785u},
+        {3074686431u, 497549541u},
+        {792191633u, 2726916658u},
+        {1495630334u, 567791785u},
+        {3971649130u, 4140843785u},
+        {4154229687u, 567791785u},
+        {233509630u, 898299046u},
+        {552300096u, 567791785u},
+        {2838394204u, 2401783636u},
+        {3266867338u, 2701077784u},
+        {1303911096u, 418620215u},
+        {1237039252u, 931042330u},
+        {2646446598u, 2726916658u},
+        {2896946475u, 2231500842u},
+        {954251114u, 3061072950u},
+        {3966357689u, 3656494025u},
+        {1749508038u, 1041216236u},
+        {589402908u, 567791785u},
+        {898299046u, 4179454272u},
+        {1300136028u, 2895421296u},
+        {762201956u, 1191082628u},
+        {1828274654u, 2726916658u},
+        {1642943230u, 1400616475u},
+        {1805501275u, 2726916658u},
+        {3356280828u, 2970756967u},
+        {1847237089u, 3301476370u},
+        {2094109583u, 567791785u},
+        {1871409830u, 123937363u},
+        {2325943437u, 418620215u},
+        {1965938483u, 1453035782u},
+        {3385706901u, 166010900u},
+        {497549541u, 3620343033u},
+        {2118432348u, 84634380u},
+        {4001698563u, 166010900u},
+        {209846800u, 3487385081u},
+        {660457104u, 497549541u},
+        {3693594453u, 2405304143u},
+        {4001712163u, 567791785u},
+        {3061072950u, 2242507051u},
+        {2286030167u, 567791785u},
+        {2816061702u, 497549541u},
+        {1618744748u, 2726916658u},
+        {3920976780u, 887355148u},
+        {2848112608u, 238830721u},
+        {2833781082u, 567791785u},
+        {3458403359u, 567791785u},
+        {1661678569u, 567791785u},
+        {3055515370u, 2359474964u},
+        {339389002u, 0u},
+        {2696433044u, 4099058003u},
+        {3125439334u, 1270025781u},
+        {1270025781u, 2558765017u},
+        {1999235894u, 567791785u},
+        {3771578632u, 3746558302u},
+        {3970212610u, 2726916658u},
+        {928534160u, 567791785u},
+        {3429527095u, 2726916658u},
+        {4157307685u, 2266553668u},
+        {4261665176u, 2726916658u},
+        {3312143588u, 3301476370u},
+        {1083035843u, 567791785u},
+        {4089981509u, 567791785u},
+        {3651587072u, 2094551816u},
+        {1636290156u, 2726916658u},
+        {2514353650u, 658413182u},
+        {609720100u, 567791785u},
+        {3854168841u, 567791785u},
+        {102955111u, 567791785u},
+        {3436921489u, 2726916658u},
+        {1025849218u, 2726916658u},
+        {117720990u, 567791785u},
+        {2819542915u, 2624511473u},
+        {2134928656u, 1458068209u},
+        {2529748557u, 2118432348u},
+        {2049782909u, 4268096845u},
+        {4230965472u, 1900803227u},
+        {1719789456u, 1310993196u},
+        {1733261739u, 567791785u},
+        {1653896492u, 497549541u},
+        {2919287888u, 4099058003u},
+        {1259551407u, 567791785u},
+        {2598712176u, 567791785u},
+        {450760092u, 156469500u},
+        {3546266377u, 2405304143u},
+        {221775280u, 567791785u},
+        {183635336u, 2726916658u},
+        {3290958398u, 2001947653u},
+        {1263186429u, 497549541u},
+        {2157529237u, 2726916658u},
+        {1757292079u, 3620343033u},
+        {1034073114u, 812161446u},
+        {2046112361u, 2726916658u},
+        {560980432u, 1468333525u},
+        {3065573393u, 0u},
+        {1388173060u, 2565524048u},
+        {440159458u, 2726916658u},
+        {3295264461u, 166010900u},
+        {4093695475u, 622475301u},
+        {3001437478u, 4099058003u},
+        {1109437397u, 2726916658u},
+        {524831829u, 0u},
+        {2520538412u, 567791785u},
+        {537716927u, 2726916658u},
+        {1739425286u, 2724988498u},
+        {2242507051u, 4060706981u},
+        {2618965291u, 926811968u},
+        {3639903371u, 2134928656u},
+        {1448615591u, 2726916658u},
+        {2151118934u, 1347590289u},
+        {4217541411u, 3061072950u},
+        {1502352459u, 1837579329u},
+        {1230749804u, 567791785u},
+        {2002250715u, 2726916658u},
+        {4093298414u, 2726916658u},
+        {1779413271u, 1498761862u},
+        {4220085123u, 0u},
+        {3621332160u, 2726916658u},
+        {2163878423u, 2688238961u},
+        {166010900u, 3550536900u},
+        {3069215008u, 567791785u},
+        {3153949916u, 567791785u},
+        {706207068u, 567791785u},
+        {790266838u, 2726916658u},
+        {2852643351u, 3278587725u},
+        {944552693u, 1681854081u},
+        {1803205969u, 4151378384u},
+        {295177829u, 567791785u},
+        {3948699063u, 2726916658u},
+        {3205137251u, 497549541u},
+        {3487870079u, 4012739269u},
+        {2881046729u, 567791785u},
+        {1604790749u, 567791785u},
+        {1839578142u, 1242568825u},
+        {640072513u, 3563932260u},
+        {3466416465u, 1083035843u},
+        {3941239263u, 3942524321u},
+        {2338442610u, 2724988498u},
+        {1370311378u, 2726916658u},
+        {665543504u, 1212698968u},
+        {2401783636u, 2726916658u},
+        {4074672627u, 1026710080u},
+        {312972756u, 3570374500u},
+        {2636646231u, 2726916658u},
+        {2022986004u, 2011106085u},
+        {3870750844u, 567791785u},
+        {1462638923u, 567791785u},
+        {3308287675u, 238830721u},
+        {3423179401u, 2726916658u},
+        {2044676802u, 497549541u},
+        {2552977381u, 567791785u},
+        {4181793464u, 4099058003u},
+        {1895700580u, 0u},
+        {3255643496u, 2726916658u},
+        {4014393635u, 2726916658u},
+        {483058250u, 567791785u},
+        {1097825139u, 497549541u},
+        {3742348944u, 2726916658u},
+        {1217736659u, 567791785u},
+        {132180299u, 1023887647u},
+        {3916480659u, 2726916658u},
+        {3259152763u, 4140843785u},
+        {362165850u, 2726916658u},
+        {980420752u, 567791785u},
+        {4140554400u, 2726916658u},
+        {3218433468u, 1360155857u},
+        {3800032069u, 567791785u},
+        {1456985596u, 2726916658u},
+        {708670027u, 4268096845u},
+        {1900803227u, 2072860801u},
+        {319614870u, 3571316050u},
+        {1046831467u, 567791785u},
+        {2799841014u, 3357634932u},
+        {1545632388u, 2895421296u},
+        {259892264u, 497549541u},
+        {407354688u, 77051289u},
+        {2619700730u, 3546266377u},
+        {222980417u, 567791785u},
+        {4230163536u, 1696635368u},
+        {4125754605u, 497549541u},
+        {595527074u, 2210481234u},
+        {3923007646u, 926811968u},
+        {3570374500u, 3351494366u},
+        {916948579u, 567791785u},
+        {3361048860u, 3454518758u},
+        {1049972350u, 2726916658u},
+        {931849578u, 567791785u},
+        {2863223333u, 567791785u},
+        {1477378046u, 1766662782u},
+        {1287964149u, 2726916658u},
+        {1188711348u, 2726916658u},
+        {2097374758u, 2726916658u},
+        {3950397093u, 3590724549u},
+        {3974277974u, 567791785u},
+        {3449862424u, 567791785u},
+        {3357634932u, 2726916658u},
+        {1681053934u, 2726916658u},
+        {45996765u, 2726916658u},
+        {1554697778u, 567791785u},
+        {2568524136u, 2726916658u},
+        {3426233346u, 1186180439u},
+        {1665358410u, 113224493u},
+        {1635783371u, 2590276672u},
+        {2291558667u, 469708367u},
+        {1439523659u, 1202702096u},
+        {3420689105u, 2072860801u},
+        {1635267284u, 1336973505u},
+        {3586508350u, 567791785u},
+        {84634380u, 2726916658u},
+        {752438899u, 567791785u},
+        {156469500u, 567791785u},
+        {4016783380u, 622280259u},
+        {3200747626u, 4029639481u},
+        {674498645u, 1360155857u},
+        {3576657972u, 2726916658u},
+        {3834003294u, 1999235894u},
+        {2328021520u, 3968009904u},
+        {2670825306u, 498450088u},
+        {4244503350u, 1023887647u},
+        {3305278863u, 497549541u},
+        {1055149117u, 567791785u},
+        {2990211100u, 2178391894u},
+        {932016844u, 1400616475u},
+        {1091651574u, 567791785u},
+        {3098565902u, 119272585u},
+        {1157169726u, 567791785u},
+        {819550842u, 2102567500u},
+        {773499562u, 567791785u},
+        {3593922608u, 567791785u},
+        {3204491284u, 228672864u},
+        {187755755u, 2726916658u},
+        {2899694509u, 2173355228u},
+        {3831889766u, 2335091557u},
+        {905963224u, 3301476370u},
+        {3380132775u, 567791785u},
+        {564569974u, 497549541u},
+        {1133810461u, 567791785u},
+        {1051777569u, 567791785u},
+        {878528594u, 2726916658u},
+        {534250172u, 1024671026u},
+        {1317099658u, 4099058003u},
+        {688177653u, 567791785u},
+        {2380238797u, 567791785u},
+        {2970756967u, 1665358410u},
+        {1109449997u, 567791785u},
+        {2995209657u, 3458403359u},
+        {243188882u, 567791785u},
+        {1706108145u, 4140843785u},
+        {2047664273u, 1026417588u},
+        {1458068209u, 567791785u},
+        {2634919170u, 4140843785u},
+        {2299776059u, 567791785u},
+        {3273527615u, 0u},
+        {2910764364u, 567791785u},
+        {1570658564u, 567791785u},
+        {984764821u, 2726916658u},
+        {1082498163u, 497549541u},
+        {3028336524u, 2726916658u},
+        {3366755556u, 1928556915u},
+        {2429672886u, 567791785u},
+        {1371949785u, 640072513u},
+        {3116333173u, 3620343033u},
+        {113224493u, 3061072950u},
+        {204057857u, 567791785u},
+        {3296973358u, 2726916658u},
+        {977508624u, 567791785u},
+        {3708936486u, 567791785u},
+        {3660131708u, 2563300581u},
+        {3783973932u, 2907905148u},
+        {3825361770u, 497549541u},
+        {1008562442u, 2726916658u},
+        {3768604471u, 2726916658u},
+        {465715614u, 2726916658u},
+        {1468333525u, 1330671677u},
+        {276017613u, 3126035858u},
+        {1947478600u, 1272116621u},
+        {2479214695u, 2726916658u},
+        {4257022119u, 497549541u},
+        {2030996345u, 3273527615u},
+        {1646726677u, 2726916658u},
+        {1382016971u, 534250172u},
+        {461493020u, 2726916658u},
+        {178867251u, 2908721569u},
+        {148150983u, 3487385081u},
+        {1856204695u, 2726916658u},
+        {4110254693u, 196063177u},
+        {638623093u, 3696658942u},
+        {954938090u, 132180299u},
+        {3103768745u, 3494178611u},
+        {752986672u, 0u},
+        {326115248u, 2726916658u},
+        {4154815552u, 926811968u},
+        {2065424582u, 1826440265u},
+        {1214637520u, 2726916658u},
+        {4029639481u, 3722266261u},
+        {382516222u, 1825881561u},
+        {2884154752u, 708670027u},
+        {4036987088u, 1659759987u},
+        {104272027u, 1357419157u},
+        {4176684248u, 0u},
+        {22427549u, 3282275393u},
+        {3548344289u, 567791785u},
+        {3197937172u, 2726916658u},
+        {338710066u, 298354645u},
+        {2260913404u, 567791785u},
+        {4094656420u, 2726916658u},
+        {1312622786u, 238830721u},
+        {1336973505u, 1825881561u},
+        {3563932260u, 2525539168u},
+        {2281324824u, 567791785u},
+        {3942524321u, 567791785u},
+        {1851000760u, 567791785u},
+        {3846570558u, 1439523659u},
+        {1871666790u, 418620215u},
+        {2982628385u, 4140843785u},
+        {69861241u, 567791785u},
+        {2704371058u, 567791785u},
+        {2670171062u, 2726916658u},
+        {3812941556u, 4043274857u},
+        {4006501473u, 4099058003u},
+        {810894083u, 3337782962u},
+        {535552533u, 498450088u},
+        {2178391894u, 567791785u},
+        {2647247259u, 1486358852u},
+        {2257473628u, 0u},
+        {4196382733u, 567791785u},
+        {943876432u, 724094749u},
+        {147198502u, 3817013504u},
+        {2586132733u, 552300096u},
+        {1205209995u, 567791785u},
+        {3237172461u, 3708936486u},
+        {225776827u, 567791785u},
+        {3770474639u, 1310993196u},
+        {2005839528u, 567791785u},
+        {3284101644u, 567791785u},
+        {2377346750u, 2726916658u},
+        {4268096845u, 3783973932u},
+        {1990983807u, 3628033440u},
+        {3454518758u, 3204491284u},
+        {4262467277u, 567791785u},
+        {1341747590u, 567791785u},
+        {1026417588u, 2726916658u},
+        {2059202853u, 2726916658u},
+        {2192524473u, 567791785u},
+        {4012739269u, 567791785u},
+        {768381414u, 2726916658u},
+        {2959938177u, 567791785u},
+        {127966342u, 3483479177u},
+        {3740866747u, 2726916658u},
+        {3786294626u, 567791785u},
+        {563530995u, 524728837u},
+        {4200598998u, 567791785u},
+        {2581087731u, 3068704555u},
+        {2201033226u, 2590276672u},
+        {1580348024u, 4085355481u},
+        {2350413876u, 2726916658u},
+        {1962739146u, 567791785u},
+        {2871434844u, 578449394u},
+        {3387066931u, 567791785u},
+        {1073302274u, 1495630334u},
+        {348179630u, 567791785u},
+        {4025803247u, 567791785u},
+        {1355981805u, 238830721u},
+        {3839060481u, 567791785u},
+        {1561737944u, 567791785u},
+        {3189639359u, 3864762204u},
+        {4071371777u, 17223862u},
+        {2758622649u, 567791785u},
+        {1122782432u, 567791785u},
+        {86245637u, 567791785u},
+        {2359474964u, 497549541u},
+        {2739719056u, 926811968u},
+        {3216727789u, 4157307685u},
+        {2637983491u, 3968009904u},
+        {1360155857u, 3620343033u},
+        {4104846447u, 1021430484u},
+        {3062918367u, 567791785u},
+        {52112891u, 1468333525u},
+        {2907905148u, 2072860801u},
+        {1732281932u, 567791785u},
+        {470752987u, 2726916658u},
+        {1292570642u, 497549541u},
+        {594456118u, 4092822280u},
+        {4084711100u, 2726916658u},
+        {2870084370u, 2726916658u},
+        {3928456489u, 2726916658u},
+        {1675554705u, 3208123503u},
+        {430450076u, 1825881561u},
+        {2726916658u, 0u},
+        {3590724549u, 2726916658u},
+        {1337696179u, 428356429u},
+        {1481063746u, 567791785u},
+        {1387663844u, 3620343033u},
+        {3447049761u, 2726916658u},
+        {4099058003u, 2726916658u},
+        {1291319755u, 567791785u},
+        {4157905491u, 714964964u},
+        {925820482u, 628441807u},
+        {1766919226u, 567791785u},
+        {2954194361u, 2726916658u},
+        {4092785520u, 1928556915u},
+        {3812362030u, 3623525379u},
+        {3761303692u, 2852062249u},
+        {2059895067u, 1928556915u},
+        {1786766851u, 3620343033u},
+        {2607943079u, 2405304143u},
+        {2145353959u, 3651587072u},
+        {1611614878u, 1205209995u},
+        {4092822280u, 2129664872u},
+        {2111186039u, 567791785u},
+        {4243056212u, 3620343033u},
+        {3537047296u, 2726916658u},
+        {578449394u, 1839578142u},
+        {3974058683u, 567791785u},
+        {1843793152u, 4154229687u},
+        {1642368672u, 2726916658u},
+        {3069185626u, 3116333173u},
+        {1513773997u, 2060981379u},
+        {4023945082u, 3620343033u},
+        {782497864u, 843617178u},
+        {2798791814u, 567791785u},
+        {119272585u, 4220085123u},
+        {2447363791u, 567791785u},
+        {3345004119u, 567791785u},
+        {2539716309u, 567791785u},
+        {1021430484u, 567791785u},
+        {2982262173u, 567791785u},
+        {1202702096u, 567791785u},
+        {620852943u, 3305278863u},
+        {3169208690u, 0u},
+        {2460336122u, 567791785u},
+        {3034731402u, 2726916658u},
+        {1991123356u, 3563932260u},
+        {3784319449u, 3217677901u},
+        {123143823u, 3669183925u},
+        {4096234345u, 284855721u},
+        {1027406518u, 1337696179u},
+        {3204711383u, 1681854081u},
+        {2011106085u, 497549541u},
+        {4019161365u, 1175513397u},
+        {1606571537u, 0u},
+        {148130434u, 1034073114u},
+        {3068421111u, 2309787707u},
+        {3900869694u, 1951460982u},
+        {1843892274u, 0u},
+        {2227538362u, 3620343033u},
+        {3192222837u, 2726916658u},
+        {3645328989u, 567791785u},
+        {54123589u, 1259551407u},
+        {1600924819u, 2726916658u},
+        {3782241303u, 567791785u},
+        {2494892700u, 2799841014u},
+        {3604588876u, 1396032091u},
+        {749578352u, 2405304143u},
+        {1255274124u, 567791785u},
+        {3055013529u, 1513773997u},
+        {1949356297u, 3620343033u},
+        {1858661785u, 2726916658u},
+        {2469390626u, 497549541u},
+        {2163166549u, 567791785u},
+        {399592015u, 567791785u},
+        {2266553668u, 3746558302u},
+        {3190207227u, 2724988498u},
+        {1850534173u, 4099058003u},
+        {4119076029u, 0u},
+        {1023887647u, 567791785u},
+        {3587933164u, 2523414519u},
+        {1222540801u, 238830721u},
+        {1767831881u, 4099058003u},
+        {671803519u, 3200259563u},
+        {2128216747u, 926811968u},
+        {2906427843u, 708670027u},
+        {3282254545u, 567791785u},
+        {4179454272u, 3061072950u},
+        {3202302196u, 567791785u},
+        {2904122814u, 1928556915u},
+        {4085355481u, 3620343033u},
+        {1075982656u, 2529748557u},
+        {2254186632u, 567791785u},
+        {3535838163u, 3153949916u},
+        {890102883u, 3200992048u},
+        {1001341975u, 2726916658u},
+        {300486179u, 2726916658u},
+        {789657090u, 452865105u},
+        {1951460982u, 4099058003u},
+        {1742480668u, 2726916658u},
+        {2454703298u, 1391831783u},
+        {3771253719u, 238830721u},
+        {1803430031u, 567791785u},
+        {3982187345u, 553778173u},
+        {1775047925u, 3620343033u},
+        {4058796829u, 3878501791u},
+        {3212206043u, 567791785u},
+        {4021302725u, 904278569u},
+        {3072987811u, 567791785u},
+        {4287572056u, 2726916658u},
+        {2307111907u, 2726916658u},
+        {904278569u, 567791785u},
+        {445974206u, 567791785u},
+        {2696709208u, 2566866105u},
+        {2701077784u, 4001712163u},
+        {1520646530u, 1984855388u},
+        {3617764011u, 0u},
+        {3825466517u, 3968009904u},
+        {145275571u, 567791785u},
+        {385588147u, 2726916658u},
+        {1835960745u, 1409119795u},
+        {1923000924u, 3098565902u},
+        {23516190u, 3080831125u},
+        {567791785u, 2726916658u},
+        {3131490264u, 567791785u},
+        {928233583u, 2726916658u},
+        {3188746918u, 3351494366u},
+        {2359506969u, 567791785u},
+        {1100663657u, 3301476370u},
+        {2688238961u, 2726916658u},
+        {2557431765u, 567791785u},
+        {3487385081u, 567791785u},
+        {4272014876u, 2726916658u},
+        {530749217u, 630800775u},
+        {2629297631u, 2726916658u},
+        {2182276440u, 2494892700u},
+        {1920496009u, 2703085271u},
+        {2421277503u, 2726916658u},
+        {70005902u, 1291319755u},
+        {3149788146u, 2257473628u},
+        {1916267784u, 3351494366u},
+        {1503220503u, 497549541u},
+        {813763102u, 3061072950u},
+        {3107862979u, 3169208690u},
+        {1540633403u, 4140843785u},
+        {2566866105u, 843617178u},
+        {967928455u, 567791785u},
+        {3702738401u, 567791785u},
+        {520663189u, 2726916658u},
+        {3798211410u, 2726916658u},
+        {3613873764u, 567791785u},
+        {3974794655u, 3271536277u},
+        {1310993196u, 3356280828u},
+        {2413396637u, 2072860801u},
+        {819009070u, 3968009904u},
+        {25668312u, 3620343033u},
+        {831760856u, 3783973932u},
+        {4074478492u, 166010900u},
+        {1168299277u, 2726916658u},
+        {3536201255u, 289102960u},
+        {3636213414u, 497549541u},
+        {2223289680u, 567791785u},
+        {2959853441u, 1825881561u},
+        {2285221890u, 567791785u},
+        {3200180919u, 567791785u},
+        {3034038038u, 2726916658u},
+        {2020612540u, 2726916658u},
+        {2402683191u, 4099058003u},
+        {3817013504u, 567791785u},
+        {2908721569u, 2726916658u},
+        {2666078040u, 2726916658u},
+        {2424428403u, 2726916658u},
+        {2753555083u, 1987186480u},
+        {2370804950u, 497549541u},
+        {1704015722u, 238830721u},
+        {1580359821u, 567791785u},
+        {3709128119u, 584112430u},
+        {2348369865u, 4085355481u},
+        {382218229u, 567791785u},
+        {3108519283u, 764979090u},
+        {1103754588u, 1852067476u},
+        {3126035858u, 2879678516u},
+        {4005736250u, 567791785u},
+        {3916096451u, 567791785u},
+        {3662356388u, 3216727789u},
+        {3080831125u, 3474386815u},
+        {2523414519u, 3344679897u},
+        {1216461011u, 3620343033u},
+        {4059977918u, 2758622649u},
+        {4025675475u, 567791785u},
+        {483746111u, 567791785u},
+        {1344053016u, 0u},
+        {3593675660u, 567791785u},
+        {3270812084u, 567791785u},
+        {3653275918u, 2726916658u},
+        {4274798758u, 2431360521u},
+        {783937113u, 567791785u},
+        {2001947653u, 567791785u},
+        {3340640726u, 567791785u},
+        {2416601835u, 2726916658u},
+        {3474194013u, 4099058003u},
+        {2662939284u, 497549541u},
+        {2922679407u, 497549541u},
+        {2938406655u, 567791785u},
+        {3161250124u, 843617178u},
+        {4206633094u, 567791785u},
+        {827898509u, 931849578u},
+        {4052515463u, 567791785u},
+        {3669183925u, 567791785u},
+        {196063177u, 440159458u},
+        {3546037191u, 148130434u},
+        {1237210745u, 567791785u},
+        {3282275393u, 3620343033u},
+        {461250893u, 2726916658u},
+        {3197516982u, 567791785u},
+        {1766662782u, 567791785u},
+        {4277804297u, 3770474639u},
+        {4060997878u, 497549541u},
+        {4266326091u, 2726916658u},
+        {2208537651u, 567791785u},
+        {1186180439u, 3651587072u},
+        {3639316156u, 3301476370u},
+        {369569363u, 238830721u},
+        {1391831783u, 2726916658u},
+        {1242568825u, 84634380u},
+        {2231500842u, 567791785u},
+        {3690950000u, 2726916658u},
+        {693737955u, 567791785u},
+        {1166594346u, 4222341536u},
+        {2126722038u, 2726916658u},
+        {2688535938u, 3783973932u},
+        {3930207657u, 4212840290u},
+        {2734381146u, 3402016812u},
+        {1833668386u, 3968009904u},
+        {2086900598u, 567791785u},
+        {3017134789u, 3266867338u},
+        {3628033440u, 3487870079u},
+        {553778173u, 567791785u},
+        {2054689799u, 4277804297u},
+        {1427025685u, 926811968u},
+        {2612768833u, 2102567500u},
+        {3745841892u, 567791785u},
+        {3288663904u, 2011106085u},
+        {3731668371u, 567791785u},
+        {630800775u, 567791785u},
+        {2492699346u, 2054689799u},
+        {3794192763u, 497549541u},
+        {3904186436u, 944552693u},
+        {3234753418u, 1916267784u},
+        {2977401802u, 2726916658u},
+        {135706558u, 4036987088u},
+        {1681854081u, 567791785u},
+        {399140690u, 20902711u},
+        {3357902705u, 567791785u},
+        {2762743218u, 2137612194u},
+        {787765876u, 1102577659u},
+        {2625089554u, 567791785u},
+        {333254182u, 3900869694u},
+        {1456667981u, 567791785u},
+        {2102299048u, 567791785u},
+        {498450088u, 3620343033u},
+        {2499881490u, 1310993196u},
+        {2081169327u, 567791785u},
+        {1004900499u, 567791785u},
+        {152551772u, 567791785u},
+        {550959014u, 166010900u},
+        {3852823428u, 2991756863u},
+        {1191082628u, 567791785u},
+        {2770017160u, 2726916658u},
+        {197266429u, 567791785u},
+        {3831875288u, 567791785u},
+        {3271536277u, 567791785u},
+        {2121297440u, 2726916658u},
+        {3835394113u, 3008301052u},
+        {3587087074u, 1415649289u},
+        {3008301052u, 3620343033u},
+        {2080389955u, 2726916658u},
+        {2145467758u, 3301476370u},
+        {695991093u, 2726916658u},
+        {3180974149u, 567791785u},
+        {338607862u, 2726916658u},
+        {978245741u, 3216727789u},
+        {3878501791u, 3587087074u},
+        {20902711u, 3281080856u},
+        {275021293u, 567791785u},
+        {2879678516u, 3855637643u},
+        {786159239u, 2734381146u},
+        {3960042465u, 567791785u},
+        {764979090u, 567791785u},
+        {2431360521u, 567791785u},
+        {1973133798u, 2724988498u},
+        {1862987346u, 1991123356u},
+        {2248424459u, 497549541u},
+        {2785907197u, 3593695816u},
+        {1813333154u, 3537047296u},
+        {279687920u, 1673327505u},
+        {257870450u, 2726916658u},
+        {981661514u, 238830721u},
+        {3245646627u, 2991756863u},
+        {723101580u, 955335483u},
+        {2083853213u, 2726916658u},
+        {3519043598u, 3968009904u},
+        {1142326112u, 2525539168u},
+        {3312333887u, 567791785u},
+        {1891856710u, 497549541u},
+        {867521455u, 238830721u},
+        {2802826641u, 497549541u},
+        {1953769567u, 567791785u},
+        {4151378384u, 382218229u},
+        {4073776971u, 2565524048u},
+        {457158179u, 1146262846u},
+        {3092136803u, 2726916658u},
+        {1421348804u, 4151378384u},
+        {499401726u, 2726916658u},
+        {198244558u, 3216727789u},
+        {529246599u, 567791785u},
+        {1926418580u, 567791785u},
+        {1189247508u, 567791785u},
+        {1282140579u, 2907905148u},
+        {1063630551u, 567791785u},
+        {3115305158u, 2726916658u},
+        {3474656460u, 2726916658u},
+        {1894448589u, 1587829056u},
+        {2991756863u, 2726916658u},
+        {1061283032u, 4151378384u},
+        {2005443484u, 3968009904u},
+        {1971300527u, 411682144u},
+        {141757751u, 3620343033u},
+        {3570760957u, 2726916658u},
+        {609567619u, 3301476370u},
+        {2992552996u, 567791785u},
+        {1041216236u, 1673327505u},
+        {2590276672u, 275021293u},
+        {138174985u, 567791785u},
+        {1453035782u, 1282964672u},
+        {1875707837u, 1719620090u},
+        {2128246719u, 2726916658u},
+        {123937363u, 3709128119u},
+        {319233523u, 2151118934u},
+        {469708367u, 567791785u},
+        {3474386815u, 2726916658u},
+        {370955209u, 135706558u},
+        {4072946546u, 2906427843u},
+        {3264788844u, 567791785u},
+        {3205163343u, 2357232699u},
+        {2268888731u, 567791785u},
+        {726996523u, 567791785u},
+        {1987186480u, 2726916658u},
+        {2611971637u, 4154229687u},
+        {1226732060u, 567791785u},
+        {1777916161u, 497549541u},
+        {298354645u, 567791785u},
+        {1440689943u, 567791785u},
+        {2447288296u, 2907905148u},
+        {2503452994u, 3620343033u},
+        {3685814955u, 2726916658u},
+        {4043274857u, 1049972350u},
+        {931042330u, 1310993196u},
+        {959125743u, 2402683191u},
+        {197259188u, 1990983807u},
+        {796974426u, 3297912606u},
+        {2803439941u, 567791785u},
+        {3593695816u, 2726916658u},
+        {831168718u, 2726916658u},
+        {1442972739u, 407954794u},
+        {1423048752u, 2726916658u},
+        {247529202u, 2726916658u},
+        {2759084079u, 418620215u},
+        {329644197u, 957797217u},
+        {237586392u, 84634380u},
+        {4146244031u, 1387663844u},
+        {2353688199u, 1023887647u},
+        {3978902171u, 2726916658u},
+        {1579452288u, 718505439u},
+        {2177680988u, 497549541u},
+        {1047768032u, 567791785u},
+        {411682144u, 2405304143u},
+        {3860416703u, 787765876u},
+        {4258810157u, 567791785u},
+        {353047735u, 3617764011u},
+        {3167037877u, 567791785u},
+        {2604657903u, 2726916658u},
+        {724094749u, 3216727789u},
+        {1024671026u, 567791785u},
+        {1282964672u, 978245741u},
+        {238830721u, 2726916658u},
+        {1024908054u, 567791785u},
+        {2060981379u, 2359506969u},
+        {2722377586u, 567791785u},
+        {3160257106u, 567791785u},
+        {2850031842u, 2586132733u},
+        {3387633284u, 567791785u},
+        {628441807u, 319233523u},
+        {1850032870u, 4151378384u},
+        {812161446u, 1310993196u},
+        {869597751u, 1719789456u},
+        {2233616847u, 567791785u},
+        {1332087532u, 2726916658u},
+        {699248667u, 428356429u},
+        {3031470467u, 567791785u},
+        {1732937360u, 498450088u},
+        {388471444u, 238830721u},
+        {1400616475u, 567791785u},
+        {1837579329u, 1884438999u},
+        {2634601848u, 497549541u},
+        {1294189023u, 567791785u},
+        {2209626904u, 3930207657u},
+        {3270595576u, 2726916658u},
+        {1587829056u, 2726916658u},
+        {376084722u, 2726916658u},
+        {3494178611u, 4071371777u},
+        {4058873060u, 1023887647u},
+        {306890114u, 567791785u},
+        {2869778529u, 238830721u},
+        {286101867u, 2726916658u},
+        {635268839u, 567791785u},
+        {2624511473u, 1237039252u},
+        {1907517712u, 2895421296u},
+        {3523137644u, 567791785u},
+        {2250973670u, 3449862424u},
+        {3467663095u, 567791785u},
+        {658413182u, 0u},
+        {3907744388u, 567791785u},
+        {4117152087u, 2726916658u},
+        {3360970358u, 1665358410u},
+        {1396032091u, 1360155857u},
+        {3580243906u, 926811968u},
+        {743339293u, 3639903371u},
+        {325645639u, 567791785u},
+        {3632260857u, 166010900u},
+        {3281080856u, 1458068209u},
+        {720558866u, 497549541u},
+        {3846497591u, 567791785u},
+        {3090389870u, 2991756863u},
+        {957582291u, 388916045u},
+        {2099087710u, 1642943230u},
+        {2759003112u, 2989762410u},
+        {3359901234u, 393246525u},
+        {3414914564u, 3722266261u},
+        {3434624319u, 567791785u},
+        {2618851531u, 2726916658u},
+        {3620343033u, 2405304143u},
+        {4278341525u, 567791785u},
+        {1984855388u, 567791785u},
+        {3261557537u, 4151378384u},
+        {718505439u, 2881046729u},
+        {1498761862u, 708670027u},
+        {1415649289u, 567791785u},
+        {1712144270u, 567791785u},
+        {559175070u, 567791785u},
+        {4212840290u, 198244558u},
+        {2429286607u, 2590276672u},
+        {2345016067u, 567791785u},
+        {2403210655u, 567791785u},
+        {1765274351u, 3282275393u},
+        {1205694702u, 1502352459u},
+        {4060706981u, 2072860801u},
+        {955335483u, 329644197u},
+        {2044818186u, 418620215u},
+        {2688920358u, 2726916658u},
+        {3502752062u, 2223369394u},
+        {2563300581u, 567791785u},
+        {2173355228u, 1360155857u},
+        {2060146074u, 2726916658u},
+        {1298007339u, 529246599u},
+        {1025623836u, 567791785u},
+        {3656494025u, 3341780549u},
+        {2362924145u, 1941569559u},
+        {3468960995u, 2145353959u},
+        {613580553u, 166010900u},
+        {165726974u, 3458403359u},
+        {2479252796u, 3301476370u},
+        {3955064620u, 3620343033u},
+        {4011219873u, 567791785u},
+        {622475301u, 2726916658u},
+        {3412486250u, 567791785u},
+        {223470684u, 2726916658u},
+        {697830620u, 567791785u},
+        {1678652251u, 3205163343u},
+        {2622220442u, 497549541u},
+        {2223369394u, 567791785u},
+        {3935332498u, 3160050727u},
+        {569531117u, 3216727789u},
+        {1515199228u, 4151378384u},
+        {3195582723u, 567791785u},
+        {3621843591u, 497549541u},
+        {1631065091u, 567791785u},
+        {926811968u, 3671957889u},
+        {3986162229u, 567791785u},
+        {997715595u, 2726916658u},
+        {762331445u, 4151378384u},
+        {870255675u, 1387663844u},
+        {3693662948u, 869597751u},
+        {3440751254u, 2726916658u},
+        {1357419157u, 0u},
+        {2434127015u, 2726916658u},
+        {2769958247u, 3893213993u},
+        {2058541621u, 2726916658u},
+        {304077368u, 166010900u},
+        {3431993741u, 2726916658u},
+        {729468442u, 567791785u},
+        {2086501834u, 497549541u},
+        {77051289u, 567791785u},
+        {1401298368u, 2726916658u},
+        {4102920736u, 567791785u},
+        {2443285297u, 2726916658u},
+        {802037369u, 567791785u},
+        {2129664872u, 237586392u},
+        {3301476370u, 567791785u},
+        {378834321u, 3449862424u},
+        {1026710080u, 567791785u},
+        {407954794u, 567791785u},
+        {150803519u, 238830721u},
+        {4238365957u, 2726916658u},
+        {755919266u, 4085355481u},
+        {2961989026u, 567791785u},
+        {3217677901u, 567791785u},
+        {3746558302u, 4217541411u},
+        {393246525u, 567791785u},
+        {3945343256u, 2726916658u},
+        {2357232699u, 221775280u},
+        {3175847069u, 22427549u},
+        {1674585019u, 567791785u},
+        {3024421688u, 567791785u},
+        {3344679897u, 407354688u},
+        {3351494366u, 1579452288u},
+        {1770326393u, 567791785u},
+        {1465590465u, 567791785u},
+        {3337782962u, 943876432u},
+        {3004123225u, 2726916658u},
+        {3950623792u, 2726916658u},
+        {3584631159u, 567791785u},
+        {673389254u, 567791785u},
+        {2789536792u, 567791785u},
+        {2692352206u, 407954794u},
+        {1202008678u, 567791785u},
+        {2841302556u, 0u},
+        {4077360421u, 2726916658u},
+        {1175513397u, 3487385081u},
+        {1076734396u, 835718401u},
+        {3291028981u, 3746558302u},
+        {2724988498u, 2726916658u},
+        {3402016812u, 2960552844u},
+        {1697942313u, 3447049761u},
+        {2094551816u, 764938613u},
+        {1673327505u, 567791785u},
+        {3298513648u, 2726916658u},
+        {1134583660u, 1680169842u},
+        {619080913u, 567791785u},
+        {3135934884u, 567791785u},
+        {2739289683u, 3106683811u},
+        {3456699527u, 1387663844u},
+        {2366379834u, 497549541u},
+        {457744838u, 1665358410u},
+        {2859017764u, 2726916658u},
+        {3216344818u, 811860561u},
+        {2022858524u, 4140843785u},
+        {3200992048u, 567791785u},
+        {2525539168u, 524728837u},
+        {1928556915u, 2726916658u},
+        {2599646577u, 567791785u},
+        {1759461929u, 567791785u},
+        {1680733055u, 497549541u},
+        {1200954035u, 1928556915u},
+        {4075248884u, 567791785u},
+        {3864762204u, 3563932260u},
+        {1330671677u, 567791785u},
+        {3884601638u, 567791785u},
+        {1645615504u, 2726916658u},
+        {3684838406u, 4268257682u},
+        {2176474540u, 3860416703u},
+        {921899274u, 567791785u},
+        {3290761224u, 3062918367u},
+        {1886890678u, 2726916658u},
+        {3160050727u, 100048734u},
+        {1585371058u, 567791785u},
+        {452865105u, 567791785u},
+        {1305566302u, 782497864u},
+        {843617178u, 2405304143u},
+        {3248592082u, 3301476370u},
+        {2027020606u, 567791785u},
+        {538760882u, 2726916658u},
+        {768395665u, 567791785u},
+        {1924703517u, 2726916658u},
+        {647525950u, 2726916658u},
+        {705922756u, 3620343033u},
+        {1885538994u, 3920753945u},
+        {3623525379u, 1047768032u},
+        {1066474903u, 567791785u},
+        {3061793532u, 567791785u},
+        {366842583u, 4085355481u},
+        {4222341536u, 567791785u},
+        {1102577659u, 1310993196u},
+        {1941569559u, 2563300581u},
+        {421078535u, 2227538362u},
+        {1387893526u, 2726916658u},
+        {2891900272u, 3523137644u},
+        {2611601591u, 2372092970u},
+        {957797217u, 1205694702u},
+        {714964964u, 567791785u},
+        {843792386u, 2405304143u},
+        {3649043221u, 3708936486u},
+        {1800894922u, 567791785u},
+        {936740635u, 567791785u},
+        {3079616728u, 2726916658u},
+        {1415769934u, 2491993409u},
+        {3421923095u, 2726916658u},
+        {3200259563u, 3440751254u},
+        {3933329929u, 2227538362u},
+        {418620215u, 2726916658u},
+        {3305972769u, 2726916658u},
+        {350780193u, 638623093u},
+        {1501527398u, 2231500842u},
+        {3155071899u, 567791785u},
+        {1143123657u, 2769958247u},
+        {4228329408u, 3846570558u},
+        {4289252862u, 222980417u},
+        {1826440265u, 1604790749u},
+        {3855637643u, 567791785u},
+        {3439053269u, 2726916658u},
+        {237617448u, 567791785u},
+        {2948224794u, 2726916658u},
+        {1731449576u, 119272585u},
+        {1696635368u, 567791785u},
+        {3852402044u, 238830721u},
+        {1680169842u, 2235514797u},
+        {1659759987u, 1294189023u},
+        {4268257682u, 4059977918u},
+        {1347590289u, 3192222837u},
+        {2374286536u, 2726916658u},
+        {4278077365u, 2726916658u},
+        {1041482416u, 1580359821u},
+        {2818173706u, 4073028489u},
+        {2522939977u, 977508624u},
+        {2682647519u, 2803439941u},
+        {2645365644u, 2830230666u},
+        {17223862u, 567791785u},
+        {2681793709u, 567791785u},
+        {835718401u, 567791785u},
+        {1011550294u, 497549541u},
+        {620167259u, 2726916658u},
+        {1043307679u, 2991756863u},
+        {1294838299u, 497549541u},
+        {1497906636u, 2726916658u},
+        {2915443750u, 2726916658u},
+        {1629531745u, 2726916658u},
+        {2357602519u, 1142326112u},
+        {811860561u, 2503452994u},
+        {1825881561u, 3620343033u},
+        {3696658942u, 2726916658u},
+        {2895421296u, 3620343033u},
+        {1845483130u, 2726916658u},
+        {3032317542u, 567791785u},
+        {2715821231u, 567791785u},
+        {2979637790u, 382516222u},
+        {3619289854u, 3449862424u},
+        {3968009904u, 237617448u},
+        {2072860801u, 567791785u},
+        {100048734u, 567791785u},
+        {622280259u, 3620343033u},
+        {1337961391u, 2726916658u},
+        {428356429u, 567791785u},
+        {312462836u, 567791785u},
+        {2491993409u, 567791785u},
+        {3893213993u, 3662356388u},
+        {850569389u, 524728837u},
+        {2799343175u, 3188746918u},
+        {2210481234u, 2726916658u},
+        {3341780549u, 925820482u},
+        {2828022438u, 2726916658u},
+        {2309787707u, 567791785u},
+        {1212698968u, 1064320924u},
+        {2637440474u, 339389002u},
+        {1952565859u, 567791785u},
+        {938704599u, 2726916658u},
+        {1852067476u, 3966357689u},
+        {3483479177u, 3216727789u},
+        {2466288220u, 238830721u},
+        {4129238787u, 497549541u},
+        {3106683811u, 3008301052u},
+        {1409119795u, 567791785u},
+        {287270140u, 4140843785u},
+        {3459832652u, 3161250124u},
+        {2835073054u, 497549541u},
+        {1372798831u, 567791785u},
+        {1406579442u, 2726916658u},
+        {3208123503u, 1675554705u},
+        {238045334u, 928534160u},
+        {1710092884u, 1900803227u},
+        {2291122455u, 2726916658u},
+        {3365866860u, 567791785u},
+        {2716785905u, 2884154752u},
+        {2960552844u, 2726916658u},
+        {2382959836u, 2102567500u},
+        {767425248u, 567791785u},
+        {1754637418u, 567791785u},
+        {3671957889u, 567791785u},
+        {1884438999u, 2182276440u},
+        {2407057340u, 567791785u},
+        {2658480396u, 3180974149u},
+        {1676007307u, 497549541u},
+        {38813266u, 567791785u},
+        {2092477833u, 1456667981u},
+        {2561181064u, 567791785u},
+        {476502330u, 705922756u},
+        {3559972623u, 2724988498u},
+        {4003831577u, 3301476370u},
+        {228672864u, 2726916658u},
+        {642363752u, 567791785u},
+    }
+}};
 
-std::unordered_map<std::string, std::string> utils::rigify_names = {
-    {"PELVIS", "DEF-spine"},
-    {"SPINELOWER", "DEF-spine.001"},
-    {"SPINEMIDDLE", "DEF-spine.002"},
-    {"SPINEUPPER", "DEF-spine.003"},
-    {"NECK", "DEF-spine.005"},
-    {"HEAD", "DEF-spine.006"},
-    {"R_HIP", "DEF-thigh.R"},
-    {"R_KNEE", "DEF-shin.R"},
-    {"R_ANKLE", "DEF-foot.R"},
-    {"R_BALL", "DEF-toe.R"},
-    {"R_CLAVICLE", "DEF-shoulder.R"},
-    {"R_SHOULDER", "DEF-upper_arm.R"},
-    {"R_SHOULDERROLL", "DEF-upper_arm.R.001"},
-    {"R_ELBOW", "DEF-forearm.R"},
-    {"R_FOREARM", "DEF-forearm.R.001"},
-    {"R_WRIST", "DEF-hand.R"},
-    {"R_THUMBA", "DEF-thumb.01.R"},
-    {"R_THUMBB", "DEF-thumb.02.R"},
-    {"R_THUMBC", "DEF-thumb.03.R"},
-    {"R_MIDDLEA", "DEF-f_middle.01.R"},
-    {"R_MIDDLEB", "DEF-f_middle.02.R"},
-    {"R_MIDDLEC", "DEF-f_middle.03.R"},
-    {"R_INDEXA", "DEF-f_index.01.R"},
-    {"R_INDEXB", "DEF-f_index.02.R"},
-    {"R_INDEXC", "DEF-f_index.03.R"},
-    {"R_RINGA", "DEF-f_ring.01.R"},
-    {"R_RINGB", "DEF-f_ring.02.R"},
-    {"R_RINGC", "DEF-f_ring.03.R"},
-    {"R_PINKYA", "DEF-f_pinky.01.R"},
-    {"R_PINKYB", "DEF-f_pinky.02.R"},
-    {"R_PINKYC", "DEF-f_pinky.03.R"},
-    {"L_HIP", "DEF-thigh.L"},
-    {"L_KNEE", "DEF-shin.L"},
-    {"L_ANKLE", "DEF-foot.L"},
-    {"L_BALL", "DEF-toe.L"},
-    {"L_CLAVICLE", "DEF-shoulder.L"},
-    {"L_SHOULDER", "DEF-upper_arm.L"},
-    {"L_SHOULDERROLL", "DEF-upper_arm.L.001"},
-    {"L_ELBOW", "DEF-forearm.L"},
-    {"L_FOREARM", "DEF-forearm.L.001"},
-    {"L_WRIST", "DEF-hand.L"},
-    {"L_THUMBA", "DEF-thumb.01.L"},
-    {"L_THUMBB", "DEF-thumb.02.L"},
-    {"L_THUMBC", "DEF-thumb.03.L"},
-    {"L_MIDDLEA", "DEF-f_middle.01.L"},
-    {"L_MIDDLEB", "DEF-f_middle.02.L"},
-    {"L_MIDDLEC", "DEF-f_middle.03.L"},
-    {"L_INDEXA", "DEF-f_index.01.L"},
-    {"L_INDEXB", "DEF-f_index.02.L"},
-    {"L_INDEXC", "DEF-f_index.03.L"},
-    {"L_RINGA", "DEF-f_ring.01.L"},
-    {"L_RINGB", "DEF-f_ring.02.L"},
-    {"L_RINGC", "DEF-f_ring.03.L"},
-    {"L_PINKYA", "DEF-f_pinky.01.L"},
-    {"L_PINKYB", "DEF-f_pinky.02.L"},
-    {"L_PINKYC", "DEF-f_pinky.03.L"},
-};
\ No newline at end of file
+static constexpr perfect_hash::Table<std::string_view, 14, 56> rigify_name_table = {{
+    {
+        15u, 17u, 35u, 1u, 5u, 96u, 1u, 2u,
+        194u, 52u, 10u, 50u, 168u, 153u,
+    }
+}, {
+    {
+        {3662356388u, "DEF-f_ring.01.L"},
+        {4277804297u, "DEF-f_index.02.R"},
+        {1310993196u, "DEF-hand.R"},
+        {127966342u, "DEF-f_pinky.02.L"},
+        {4060706981u, "DEF-spine.001"},
+        {1282964672u, "DEF-thumb.02.L"},
+        {1665358410u, "DEF-upper_arm.R"},
+        {2769958247u, "DEF-f_ring.03.L"},
+        {1719789456u, "DEF-f_pinky.01.R"},
+        {887355148u, "DEF-f_pinky.03.L"},
+        {4212840290u, "DEF-f_index.02.L"},
+        {2266553668u, "DEF-forearm.L"},
+        {3783973932u, "DEF-shin.R"},
+        {2907905148u, "DEF-thigh.R"},
+        {3291028981u, "DEF-upper_arm.L.001"},
+        {3746558302u, "DEF-upper_arm.L"},
+        {2624511473u, "DEF-f_ring.03.R"},
+        {3860416703u, "DEF-thumb.03.R"},
+        {724094749u, "DEF-f_middle.01.L"},
+        {3893213993u, "DEF-f_ring.02.L"},
+        {3930207657u, "DEF-f_index.03.L"},
+        {787765876u, "DEF-thumb.02.R"},
+        {3360970358u, "DEF-upper_arm.R.001"},
+        {4217541411u, "DEF-shoulder.L"},
+        {1102577659u, "DEF-thumb.01.R"},
+        {3061072950u, "DEF-spine.003"},
+        {869597751u, "DEF-f_pinky.02.R"},
+        {1453035782u, "DEF-thumb.03.L"},
+        {1034073114u, "DEF-f_middle.02.R"},
+        {931042330u, "DEF-f_ring.01.R"},
+        {2054689799u, "DEF-f_index.03.R"},
+        {812161446u, "DEF-f_middle.01.R"},
+        {1142326112u, "DEF-toe.L"},
+        {4179454272u, "DEF-spine.005"},
+        {2072860801u, "DEF-spine"},
+        {978245741u, "DEF-thumb.01.L"},
+        {2970756967u, "DEF-forearm.R"},
+        {113224493u, "DEF-shoulder.R"},
+        {3337782962u, "DEF-f_middle.03.L"},
+        {4157307685u, "DEF-forearm.L.001"},
+        {943876432u, "DEF-f_middle.02.L"},
+        {3216727789u, "DEF-hand.L"},
+        {3483479177u, "DEF-f_pinky.01.L"},
+        {2049782909u, "DEF-toe.R"},
+        {3356280828u, "DEF-forearm.R.001"},
+        {2525539168u, "DEF-foot.L"},
+        {1237039252u, "DEF-f_ring.02.R"},
+        {3770474639u, "DEF-f_index.01.R"},
+        {148130434u, "DEF-f_middle.03.R"},
+        {198244558u, "DEF-f_index.01.L"},
+        {3693662948u, "DEF-f_pinky.03.R"},
+        {898299046u, "DEF-spine.006"},
+        {1900803227u, "DEF-thigh.L"},
+        {4268096845u, "DEF-foot.R"},
+        {2242507051u, "DEF-spine.002"},
+        {524728837u, "DEF-shin.L"},
+    }
+}};
+
+std::optional<std::string_view> utils::bone_name(uint32_t namehash) {
+    const perfect_hash::Entry<std::string_view> *entry = bone_name_table.find(namehash);
+    return entry != nullptr ? std::optional<std::string_view>(entry->value) : std::nullopt;
+}
+
+std::optional<uint32_t> utils::bone_namehash(std::string_view name) {
+    uint32_t namehash = jenkins::oaat(name);
+    const perfect_hash::Entry<std::string_view> *entry = bone_name_table.find(namehash);
+    return entry != nullptr && entry->value == name ? std::optional<uint32_t>(namehash) : std::nullopt;
+}
+
+std::optional<uint32_t> utils::bone_parent(uint32_t namehash) {
+    const perfect_hash::Entry<uint32_t> *entry = bone_parent_table.find(namehash);
+    return entry != nullptr ? std::optional<uint32_t>(entry->value) : std::nullopt;
+}
+
+std::optional<std::string_view> utils::rigify_name(uint32_t namehash) {
+    const perfect_hash::Entry<std::string_view> *entry = rigify_name_table.find(namehash);
+    return entry != nullptr ? std::optional<std::string_view>(entry->value) : std::nullopt;
+}
+
+std::span<const perfect_hash::Entry<std::string_view>> utils::bone_names() {
+    return bone_name_table.entries;
+}
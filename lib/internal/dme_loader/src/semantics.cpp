@@ -1,3035 +1,3139 @@
+// Generated by script/hashgen.py from script/hash_tables.json. Do not edit by hand.
 #include "semantics.h"
+#include "perfect_hash.h"
 
 using namespace warpgate;
 
-std::string warpgate::semantic_name(Semantic semantic) {
-    switch(semantic) {
-        case Semantic::AMicrosoft: return "AMicrosoft";
-        case Semantic::AOEnable: return "AOEnable";
-        case Semantic::AOSharpness: return "AOSharpness";
-        case Semantic::AOSize: return "AOSize";
-        case Semantic::AOStrength: return "AOStrength";
-        case Semantic::AScroll: return "AScroll";
-        case Semantic::AScroll1: return "AScroll1";
-        case Semantic::AScroll1_U: return "AScroll1_U";
-        case Semantic::AScroll1_V: return "AScroll1_V";
-        case Semantic::AScroll2: return "AScroll2";
-        case Semantic::AScroll2_U: return "AScroll2_U";
-        case Semantic::AScroll2_V: return "AScroll2_V";
-        case Semantic::AScroll3: return "AScroll3";
-        case Semantic::AScroll3_U: return "AScroll3_U";
-        case Semantic::AScroll3_V: return "AScroll3_V";
-        case Semantic::Accumulate: return "Accumulate";
-        case Semantic::Acommon_fxh: return "Acommon_fxh";
-        case Semantic::Add: return "Add";
-        case Semantic::AdditiveGlow: return "AdditiveGlow";
-        case Semantic::AdditiveGlow_fx_globals: return "AdditiveGlow_fx_globals";
-        case Semantic::Ag_DetailBumpiness: return "Ag_DetailBumpiness";
-        case Semantic::Ag_OverlayScale: return "Ag_OverlayScale";
-        case Semantic::Ag_PatternOpacity: return "Ag_PatternOpacity";
-        case Semantic::Ag_TransitionOffset: return "Ag_TransitionOffset";
-        case Semantic::Ag_backfaceMinOpacity: return "Ag_backfaceMinOpacity";
-        case Semantic::Ag_opacity: return "Ag_opacity";
-        case Semantic::Ag_pow: return "Ag_pow";
-        case Semantic::Ag_refraction: return "Ag_refraction";
-        case Semantic::Ag_swayBoil: return "Ag_swayBoil";
-        case Semantic::Ag_swayPrevBoil: return "Ag_swayPrevBoil";
-        case Semantic::Ag_texScrollU1: return "Ag_texScrollU1";
-        case Semantic::Alpha: return "Alpha";
-        case Semantic::AlphaBlend: return "AlphaBlend";
-        case Semantic::AlphaBlendModelPosTech: return "AlphaBlendModelPosTech";
-        case Semantic::AlphaBlendTech: return "AlphaBlendTech";
-        case Semantic::AlphaBlendToggle: return "AlphaBlendToggle";
-        case Semantic::AlphaChannel: return "AlphaChannel";
-        case Semantic::AlphaContrast: return "AlphaContrast";
-        case Semantic::AlphaOnSolidModelPosTech: return "AlphaOnSolidModelPosTech";
-        case Semantic::AlphaOnSolidTech: return "AlphaOnSolidTech";
-        case Semantic::Ambience: return "Ambience";
-        case Semantic::Ambient: return "Ambient";
-        case Semantic::AntiBloom: return "AntiBloom";
-        case Semantic::ApplyToSky: return "ApplyToSky";
-        case Semantic::Audit: return "Audit";
-        case Semantic::AuditColor: return "AuditColor";
-        case Semantic::AurLookup: return "AurLookup";
-        case Semantic::Auraxium: return "Auraxium";
-        case Semantic::AuraxiumCloak: return "AuraxiumCloak";
-        case Semantic::AuraxiumCloak_RigidSkinned_0Overlay: return "AuraxiumCloak_RigidSkinned_0Overlay";
-        case Semantic::AuraxiumCloak_RigidSkinned_1Overlay: return "AuraxiumCloak_RigidSkinned_1Overlay";
-        case Semantic::AuraxiumCloak_RigidSkinned_2Overlay: return "AuraxiumCloak_RigidSkinned_2Overlay";
-        case Semantic::AuraxiumCloak_RigidSkinned_3Overlay: return "AuraxiumCloak_RigidSkinned_3Overlay";
-        case Semantic::AuraxiumCloak_RigidSkinned_4Overlay: return "AuraxiumCloak_RigidSkinned_4Overlay";
-        case Semantic::AuraxiumCloak_Rigid_0Overlay: return "AuraxiumCloak_Rigid_0Overlay";
-        case Semantic::AuraxiumCloak_Rigid_1Overlay: return "AuraxiumCloak_Rigid_1Overlay";
-        case Semantic::AuraxiumCloak_Rigid_2Overlay: return "AuraxiumCloak_Rigid_2Overlay";
-        case Semantic::AuraxiumCloak_Rigid_3Overlay: return "AuraxiumCloak_Rigid_3Overlay";
-        case Semantic::AuraxiumCloak_Rigid_4Overlay: return "AuraxiumCloak_Rigid_4Overlay";
-        case Semantic::AuraxiumCloak_Skinned_0Overlay: return "AuraxiumCloak_Skinned_0Overlay";
-        case Semantic::AuraxiumCloak_Skinned_1Overlay: return "AuraxiumCloak_Skinned_1Overlay";
-        case Semantic::AuraxiumCloak_Skinned_2Overlay: return "AuraxiumCloak_Skinned_2Overlay";
-        case Semantic::AuraxiumCloak_Skinned_3Overlay: return "AuraxiumCloak_Skinned_3Overlay";
-        case Semantic::AuraxiumCloak_Skinned_4Overlay: return "AuraxiumCloak_Skinned_4Overlay";
-        case Semantic::AuraxiumDeRes: return "AuraxiumDeRes";
-        case Semantic::AuraxiumDeRes_RigidSkinned_0Overlay: return "AuraxiumDeRes_RigidSkinned_0Overlay";
-        case Semantic::AuraxiumDeRes_RigidSkinned_1Overlay: return "AuraxiumDeRes_RigidSkinned_1Overlay";
-        case Semantic::AuraxiumDeRes_RigidSkinned_2Overlay: return "AuraxiumDeRes_RigidSkinned_2Overlay";
-        case Semantic::AuraxiumDeRes_RigidSkinned_3Overlay: return "AuraxiumDeRes_RigidSkinned_3Overlay";
-        case Semantic::AuraxiumDeRes_RigidSkinned_4Overlay: return "AuraxiumDeRes_RigidSkinned_4Overlay";
-        case Semantic::AuraxiumDeRes_Rigid_0Overlay: return "AuraxiumDeRes_Rigid_0Overlay";
-        case Semantic::AuraxiumDeRes_Rigid_1Overlay: return "AuraxiumDeRes_Rigid_1Overlay";
-        case Semantic::AuraxiumDeRes_Rigid_2Overlay: return "AuraxiumDeRes_Rigid_2Overlay";
-        case Semantic::AuraxiumDeRes_Rigid_3Overlay: return "AuraxiumDeRes_Rigid_3Overlay";
-        case Semantic::AuraxiumDeRes_Rigid_4Overlay: return "AuraxiumDeRes_Rigid_4Overlay";
-        case Semantic::AuraxiumDeRes_Skinned_0Overlay: return "AuraxiumDeRes_Skinned_0Overlay";
-        case Semantic::AuraxiumDeRes_Skinned_1Overlay: return "AuraxiumDeRes_Skinned_1Overlay";
-        case Semantic::AuraxiumDeRes_Skinned_2Overlay: return "AuraxiumDeRes_Skinned_2Overlay";
-        case Semantic::AuraxiumDeRes_Skinned_3Overlay: return "AuraxiumDeRes_Skinned_3Overlay";
-        case Semantic::AuraxiumDeRes_Skinned_4Overlay: return "AuraxiumDeRes_Skinned_4Overlay";
-        case Semantic::AuraxiumOpaque: return "AuraxiumOpaque";
-        case Semantic::AuraxiumOpaque_RigidSkinned_0Overlay: return "AuraxiumOpaque_RigidSkinned_0Overlay";
-        case Semantic::AuraxiumOpaque_RigidSkinned_1Overlay: return "AuraxiumOpaque_RigidSkinned_1Overlay";
-        case Semantic::AuraxiumOpaque_RigidSkinned_2Overlay: return "AuraxiumOpaque_RigidSkinned_2Overlay";
-        case Semantic::AuraxiumOpaque_RigidSkinned_3Overlay: return "AuraxiumOpaque_RigidSkinned_3Overlay";
-        case Semantic::AuraxiumOpaque_RigidSkinned_4Overlay: return "AuraxiumOpaque_RigidSkinned_4Overlay";
-        case Semantic::AuraxiumOpaque_Rigid_0Overlay: return "AuraxiumOpaque_Rigid_0Overlay";
-        case Semantic::AuraxiumOpaque_Rigid_1Overlay: return "AuraxiumOpaque_Rigid_1Overlay";
-        case Semantic::AuraxiumOpaque_Rigid_2Overlay: return "AuraxiumOpaque_Rigid_2Overlay";
-        case Semantic::AuraxiumOpaque_Rigid_3Overlay: return "AuraxiumOpaque_Rigid_3Overlay";
-        case Semantic::AuraxiumOpaque_Rigid_4Overlay: return "AuraxiumOpaque_Rigid_4Overlay";
-        case Semantic::AuraxiumOpaque_Skinned_0Overlay: return "AuraxiumOpaque_Skinned_0Overlay";
-        case Semantic::AuraxiumOpaque_Skinned_1Overlay: return "AuraxiumOpaque_Skinned_1Overlay";
-        case Semantic::AuraxiumOpaque_Skinned_2Overlay: return "AuraxiumOpaque_Skinned_2Overlay";
-        case Semantic::AuraxiumOpaque_Skinned_3Overlay: return "AuraxiumOpaque_Skinned_3Overlay";
-        case Semantic::AuraxiumOpaque_Skinned_4Overlay: return "AuraxiumOpaque_Skinned_4Overlay";
-        case Semantic::AuraxiumRigidCloak: return "AuraxiumRigidCloak";
-        case Semantic::AuraxiumRigidDeRes: return "AuraxiumRigidDeRes";
-        case Semantic::AuraxiumRigidOpaque: return "AuraxiumRigidOpaque";
-        case Semantic::Auraxium_fx_globals: return "Auraxium_fx_globals";
-        case Semantic::AutoTileFreq: return "AutoTileFreq";
-        case Semantic::B: return "B";
-        case Semantic::BFaceMaxOpacity: return "BFaceMaxOpacity";
-        case Semantic::BFaceMinOpacity: return "BFaceMinOpacity";
-        case Semantic::BFaceRefrac: return "BFaceRefrac";
-        case Semantic::BFaceRfraDisFactr: return "BFaceRfraDisFactr";
-        case Semantic::BG: return "BG";
-        case Semantic::BINORMAL: return "BINORMAL";
-        case Semantic::BLENDINDICES: return "BLENDINDICES";
-        case Semantic::BLENDWEIGHT: return "BLENDWEIGHT";
-        case Semantic::BRDF: return "BRDF";
-        case Semantic::BRDFLookup: return "BRDFLookup";
-        case Semantic::BRDFlookup: return "BRDFlookup";
-        case Semantic::BX0f7: return "BX0f7";
-        case Semantic::BackFaceFadeDis: return "BackFaceFadeDis";
-        case Semantic::BackGround: return "BackGround";
-        case Semantic::BackGroundOpacity: return "BackGroundOpacity";
-        case Semantic::BackfaceMaxOpacity: return "BackfaceMaxOpacity";
-        case Semantic::BackfaceMinOpacity: return "BackfaceMinOpacity";
-        case Semantic::BackfaceRefraction: return "BackfaceRefraction";
-        case Semantic::BackfaceRefractionDistanceFactor: return "BackfaceRefractionDistanceFactor";
-        case Semantic::BackfaceTingIntensityFactor: return "BackfaceTingIntensityFactor";
-        case Semantic::Backfaces: return "Backfaces";
-        case Semantic::Background: return "Background";
-        case Semantic::BackgroundAlpha: return "BackgroundAlpha";
-        case Semantic::BackgroundBoost: return "BackgroundBoost";
-        case Semantic::BackgroundColor: return "BackgroundColor";
-        case Semantic::Backside: return "Backside";
-        case Semantic::BacksideBlur: return "BacksideBlur";
-        case Semantic::BacksideDesat: return "BacksideDesat";
-        case Semantic::BacksideSpec: return "BacksideSpec";
-        case Semantic::Base: return "Base";
-        case Semantic::BaseDiffuse: return "BaseDiffuse";
-        case Semantic::BaseMaskA: return "BaseMaskA";
-        case Semantic::BaseMaskB: return "BaseMaskB";
-        case Semantic::Basic: return "Basic";
-        case Semantic::Bd: return "Bd";
-        case Semantic::BeamParticle_FullResInWater_RenderLevel2: return "BeamParticle_FullResInWater_RenderLevel2";
-        case Semantic::BeamParticle_FullRes_RenderLevel0: return "BeamParticle_FullRes_RenderLevel0";
-        case Semantic::BeamParticle_FullRes_RenderLevel1: return "BeamParticle_FullRes_RenderLevel1";
-        case Semantic::BeamParticle_FullRes_RenderLevel2: return "BeamParticle_FullRes_RenderLevel2";
-        case Semantic::BeamParticle_RenderLevel0: return "BeamParticle_RenderLevel0";
-        case Semantic::BeamParticle_RenderLevel1: return "BeamParticle_RenderLevel1";
-        case Semantic::BeamParticle_RenderLevel2: return "BeamParticle_RenderLevel2";
-        case Semantic::Bg_FFColorreduceBloom: return "Bg_FFColorreduceBloom";
-        case Semantic::Bg_contrast: return "Bg_contrast";
-        case Semantic::Bg_fogTurbDirection: return "Bg_fogTurbDirection";
-        case Semantic::Bg_glowBase: return "Bg_glowBase";
-        case Semantic::Bg_scanIntensity: return "Bg_scanIntensity";
-        case Semantic::Bg_thermalColor: return "Bg_thermalColor";
-        case Semantic::Bias: return "Bias";
-        case Semantic::BiasNormals: return "BiasNormals";
-        case Semantic::Black: return "Black";
-        case Semantic::BlackPoint: return "BlackPoint";
-        case Semantic::Blend: return "Blend";
-        case Semantic::BlendMask: return "BlendMask";
-        case Semantic::BlendMode: return "BlendMode";
-        case Semantic::BlendStrength4: return "BlendStrength4";
-        case Semantic::BlendValue: return "BlendValue";
-        case Semantic::Bloom: return "Bloom";
-        case Semantic::BloomBlurStageCount: return "BloomBlurStageCount";
-        case Semantic::BloomEnabled: return "BloomEnabled";
-        case Semantic::BloomIn: return "BloomIn";
-        case Semantic::BloomStrength: return "BloomStrength";
-        case Semantic::Blue: return "Blue";
-        case Semantic::BlueChannel: return "BlueChannel";
-        case Semantic::BlueNoise32: return "BlueNoise32";
-        case Semantic::BlueNoiseTexture: return "BlueNoiseTexture";
-        case Semantic::BlueSource: return "BlueSource";
-        case Semantic::Blur1: return "Blur1";
-        case Semantic::Blur2: return "Blur2";
-        case Semantic::BlurIntensity: return "BlurIntensity";
-        case Semantic::BlurQuarterUpscaleSource: return "BlurQuarterUpscaleSource";
-        case Semantic::BlurSource: return "BlurSource";
-        case Semantic::Blur_DX9_VS1_PS2: return "Blur_DX9_VS1_PS2";
-        case Semantic::Boost: return "Boost";
-        case Semantic::Boost1: return "Boost1";
-        case Semantic::Boost2: return "Boost2";
-        case Semantic::Boost3: return "Boost3";
-        case Semantic::Brightness: return "Brightness";
-        case Semantic::Bump: return "Bump";
-        case Semantic::BumpMap: return "BumpMap";
-        case Semantic::BumpMap1: return "BumpMap1";
-        case Semantic::BumpMap2: return "BumpMap2";
-        case Semantic::BumpMap3: return "BumpMap3";
-        case Semantic::BumpTexture: return "BumpTexture";
-        case Semantic::BumpU1: return "BumpU1";
-        case Semantic::BumpU2: return "BumpU2";
-        case Semantic::BumpU3: return "BumpU3";
-        case Semantic::BumpV1: return "BumpV1";
-        case Semantic::BumpV2: return "BumpV2";
-        case Semantic::BumpV3: return "BumpV3";
-        case Semantic::Bumpiness: return "Bumpiness";
-        case Semantic::Bumpiness1: return "Bumpiness1";
-        case Semantic::Bumpiness2: return "Bumpiness2";
-        case Semantic::Bumpiness3: return "Bumpiness3";
-        case Semantic::C: return "C";
-        case Semantic::CCP: return "CCP";
-        case Semantic::CHANGE: return "CHANGE";
-        case Semantic::COLOR: return "COLOR";
-        case Semantic::CPY6: return "CPY6";
-        case Semantic::CV: return "CV";
-        case Semantic::CW4: return "CW4";
-        case Semantic::CameraDirectionDelta: return "CameraDirectionDelta";
-        case Semantic::CameraShadow: return "CameraShadow";
-        case Semantic::CameraShadow_fx_globals: return "CameraShadow_fx_globals";
-        case Semantic::CameraShakeDir: return "CameraShakeDir";
-        case Semantic::CausticTex: return "CausticTex";
-        case Semantic::CausticTex2: return "CausticTex2";
-        case Semantic::Caustics: return "Caustics";
-        case Semantic::CausticsNM: return "CausticsNM";
-        case Semantic::Caustics_N: return "Caustics_N";
-        case Semantic::Center: return "Center";
-        case Semantic::Cg_maskViewProj: return "Cg_maskViewProj";
-        case Semantic::Cg_swayWavefrontSize: return "Cg_swayWavefrontSize";
-        case Semantic::Character: return "Character";
-        case Semantic::Character_fx_globals: return "Character_fx_globals";
-        case Semantic::ClarityOfSky: return "ClarityOfSky";
-        case Semantic::Cloak: return "Cloak";
-        case Semantic::CloakColor: return "CloakColor";
-        case Semantic::CloakColorDistortion: return "CloakColorDistortion";
-        case Semantic::CloakColorDistortion_Rigid: return "CloakColorDistortion_Rigid";
-        case Semantic::CloakColorDistortion_RigidSkinned: return "CloakColorDistortion_RigidSkinned";
-        case Semantic::CloakColorDistortion_Skinned: return "CloakColorDistortion_Skinned";
-        case Semantic::CloakColor_Rigid: return "CloakColor_Rigid";
-        case Semantic::CloakColor_RigidSkinned: return "CloakColor_RigidSkinned";
-        case Semantic::CloakColor_Skinned: return "CloakColor_Skinned";
-        case Semantic::CloakDarkLightColor: return "CloakDarkLightColor";
-        case Semantic::CloakDarkLightColor_Rigid: return "CloakDarkLightColor_Rigid";
-        case Semantic::CloakDarkLightColor_RigidSkinned: return "CloakDarkLightColor_RigidSkinned";
-        case Semantic::CloakDarkLightColor_Skinned: return "CloakDarkLightColor_Skinned";
-        case Semantic::CloakDepth: return "CloakDepth";
-        case Semantic::CloakDepth_Rigid: return "CloakDepth_Rigid";
-        case Semantic::CloakDepth_RigidSkinned: return "CloakDepth_RigidSkinned";
-        case Semantic::CloakDepth_Skinned: return "CloakDepth_Skinned";
-        case Semantic::CloakDistortion: return "CloakDistortion";
-        case Semantic::CloakDistortion_Rigid: return "CloakDistortion_Rigid";
-        case Semantic::CloakDistortion_RigidSkinned: return "CloakDistortion_RigidSkinned";
-        case Semantic::CloakDistortion_Skinned: return "CloakDistortion_Skinned";
-        case Semantic::Cloak_RigidSkinned_0Overlay: return "Cloak_RigidSkinned_0Overlay";
-        case Semantic::Cloak_RigidSkinned_1Overlay: return "Cloak_RigidSkinned_1Overlay";
-        case Semantic::Cloak_RigidSkinned_2Overlay: return "Cloak_RigidSkinned_2Overlay";
-        case Semantic::Cloak_RigidSkinned_3Overlay: return "Cloak_RigidSkinned_3Overlay";
-        case Semantic::Cloak_RigidSkinned_4Overlay: return "Cloak_RigidSkinned_4Overlay";
-        case Semantic::Cloak_Rigid_0Overlay: return "Cloak_Rigid_0Overlay";
-        case Semantic::Cloak_Rigid_1Overlay: return "Cloak_Rigid_1Overlay";
-        case Semantic::Cloak_Rigid_2Overlay: return "Cloak_Rigid_2Overlay";
-        case Semantic::Cloak_Rigid_3Overlay: return "Cloak_Rigid_3Overlay";
-        case Semantic::Cloak_Rigid_4Overlay: return "Cloak_Rigid_4Overlay";
-        case Semantic::Cloak_Skinned_0Overlay: return "Cloak_Skinned_0Overlay";
-        case Semantic::Cloak_Skinned_1Overlay: return "Cloak_Skinned_1Overlay";
-        case Semantic::Cloak_Skinned_2Overlay: return "Cloak_Skinned_2Overlay";
-        case Semantic::Cloak_Skinned_3Overlay: return "Cloak_Skinned_3Overlay";
-        case Semantic::Cloak_Skinned_4Overlay: return "Cloak_Skinned_4Overlay";
-        case Semantic::Cloud: return "Cloud";
-        case Semantic::CloudAnimationOffsetU: return "CloudAnimationOffsetU";
-        case Semantic::CloudAnimationOffsetV: return "CloudAnimationOffsetV";
-        case Semantic::CloudAnimationShift: return "CloudAnimationShift";
-        case Semantic::CloudAnimationTiling: return "CloudAnimationTiling";
-        case Semantic::CloudBlend: return "CloudBlend";
-        case Semantic::CloudBlend_fx_globals: return "CloudBlend_fx_globals";
-        case Semantic::CloudColor: return "CloudColor";
-        case Semantic::CloudDensityTexture: return "CloudDensityTexture";
-        case Semantic::CloudLayerWeightings: return "CloudLayerWeightings";
-        case Semantic::CloudMap: return "CloudMap";
-        case Semantic::CloudShadowAlphaPower: return "CloudShadowAlphaPower";
-        case Semantic::CloudShadows: return "CloudShadows";
-        case Semantic::CloudShadows_fx_globals: return "CloudShadows_fx_globals";
-        case Semantic::CloudSilverLiningBrightness: return "CloudSilverLiningBrightness";
-        case Semantic::CloudSilverLiningThickness: return "CloudSilverLiningThickness";
-        case Semantic::CloudTexture: return "CloudTexture";
-        case Semantic::CloudTextureFrom: return "CloudTextureFrom";
-        case Semantic::CloudTextureLerp: return "CloudTextureLerp";
-        case Semantic::CloudTextureTo: return "CloudTextureTo";
-        case Semantic::Cloud_fx_globals: return "Cloud_fx_globals";
-        case Semantic::CloudsEnabled: return "CloudsEnabled";
-        case Semantic::CloundBlendingTech: return "CloundBlendingTech";
-        case Semantic::Cm: return "Cm";
-        case Semantic::ColdLava: return "ColdLava";
-        case Semantic::ColdLavaTiling: return "ColdLavaTiling";
-        case Semantic::ColdMorph: return "ColdMorph";
-        case Semantic::ColdRoll: return "ColdRoll";
-        case Semantic::Color: return "Color";
-        case Semantic::Color1: return "Color1";
-        case Semantic::Color2: return "Color2";
-        case Semantic::Color3: return "Color3";
-        case Semantic::ColorBlend: return "ColorBlend";
-        case Semantic::ColorBlindFilter: return "ColorBlindFilter";
-        case Semantic::ColorBlindFilterAmount: return "ColorBlindFilterAmount";
-        case Semantic::ColorBlindFilterStrength: return "ColorBlindFilterStrength";
-        case Semantic::ColorBuffer: return "ColorBuffer";
-        case Semantic::ColorChannel: return "ColorChannel";
-        case Semantic::ColorGrading: return "ColorGrading";
-        case Semantic::ColorKeyA: return "ColorKeyA";
-        case Semantic::ColorKeyB: return "ColorKeyB";
-        case Semantic::ColorKeyLerp: return "ColorKeyLerp";
-        case Semantic::ColorMap: return "ColorMap";
-        case Semantic::ColorMapCube: return "ColorMapCube";
-        case Semantic::ColorMapScrollX: return "ColorMapScrollX";
-        case Semantic::ColorMapScrollY: return "ColorMapScrollY";
-        case Semantic::ColorMapTiling: return "ColorMapTiling";
-        case Semantic::ColorNormalXMap: return "ColorNormalXMap";
-        case Semantic::ColorNormalXMap1: return "ColorNormalXMap1";
-        case Semantic::ColorNormalXMap2: return "ColorNormalXMap2";
-        case Semantic::ColorNormalXMap3: return "ColorNormalXMap3";
-        case Semantic::ColorNormalXMap4: return "ColorNormalXMap4";
-        case Semantic::ColorNormalXMap5: return "ColorNormalXMap5";
-        case Semantic::ColorScale: return "ColorScale";
-        case Semantic::ColorScrollU: return "ColorScrollU";
-        case Semantic::ColorScrollV: return "ColorScrollV";
-        case Semantic::ColorTexture: return "ColorTexture";
-        case Semantic::ColorTexture2: return "ColorTexture2";
-        case Semantic::ColorTexture3: return "ColorTexture3";
-        case Semantic::ColorTexture4: return "ColorTexture4";
-        case Semantic::ColorWrite: return "ColorWrite";
-        case Semantic::ColorWrites: return "ColorWrites";
-        case Semantic::ColoredFogEnabled: return "ColoredFogEnabled";
-        case Semantic::CombineMasks: return "CombineMasks";
-        case Semantic::Compiler: return "Compiler";
-        case Semantic::CompositeEnv: return "CompositeEnv";
-        case Semantic::CompositeEnv_fx_globals: return "CompositeEnv_fx_globals";
-        case Semantic::CompositeParticles: return "CompositeParticles";
-        case Semantic::CompositeSky: return "CompositeSky";
-        case Semantic::CompositeSky_fx_globals: return "CompositeSky_fx_globals";
-        case Semantic::Contrast: return "Contrast";
-        case Semantic::ConvertDepth: return "ConvertDepth";
-        case Semantic::ConvertDepthMode: return "ConvertDepthMode";
-        case Semantic::CoordinateSpace: return "CoordinateSpace";
-        case Semantic::Copy: return "Copy";
-        case Semantic::CopyInvert: return "CopyInvert";
-        case Semantic::CornerFrame: return "CornerFrame";
-        case Semantic::Cube: return "Cube";
-        case Semantic::CubeFace: return "CubeFace";
-        case Semantic::CubeFaceDir: return "CubeFaceDir";
-        case Semantic::CubeFaceDown: return "CubeFaceDown";
-        case Semantic::CubeFaceRight: return "CubeFaceRight";
-        case Semantic::CullMode: return "CullMode";
-        case Semantic::CumulusCloudContrast: return "CumulusCloudContrast";
-        case Semantic::CumulusCloudHeight: return "CumulusCloudHeight";
-        case Semantic::CumulusCloudScrollU: return "CumulusCloudScrollU";
-        case Semantic::CumulusCloudScrollV: return "CumulusCloudScrollV";
-        case Semantic::CumulusCloudTiling: return "CumulusCloudTiling";
-        case Semantic::CylindricalWarp: return "CylindricalWarp";
-        case Semantic::CylindricalWarp_fx_globals: return "CylindricalWarp_fx_globals";
-        case Semantic::D: return "D";
-        case Semantic::D1: return "D1";
-        case Semantic::DC: return "DC";
-        case Semantic::DERES: return "DERES";
-        case Semantic::DISTORTION: return "DISTORTION";
-        case Semantic::DON: return "DON";
-        case Semantic::DV: return "DV";
-        case Semantic::DXBC: return "DXBC";
-        case Semantic::DXBC0: return "DXBC0";
-        case Semantic::DXBC1: return "DXBC1";
-        case Semantic::DXBC2: return "DXBC2";
-        case Semantic::DXBC2t: return "DXBC2t";
-        case Semantic::DXBC3: return "DXBC3";
-        case Semantic::DXBC33: return "DXBC33";
-        case Semantic::DXBC3d: return "DXBC3d";
-        case Semantic::DXBC3w: return "DXBC3w";
-        case Semantic::DXBC4: return "DXBC4";
-        case Semantic::DXBC5: return "DXBC5";
-        case Semantic::DXBC6: return "DXBC6";
-        case Semantic::DXBC6065C7: return "DXBC6065C7";
-        case Semantic::DXBC7: return "DXBC7";
-        case Semantic::DXBC7x: return "DXBC7x";
-        case Semantic::DXBC8: return "DXBC8";
-        case Semantic::DXBC8F: return "DXBC8F";
-        case Semantic::DXBC9: return "DXBC9";
-        case Semantic::DXBC9h: return "DXBC9h";
-        case Semantic::DXBC9y: return "DXBC9y";
-        case Semantic::DXBCA: return "DXBCA";
-        case Semantic::DXBCB: return "DXBCB";
-        case Semantic::DXBCBL: return "DXBCBL";
-        case Semantic::DXBCBv: return "DXBCBv";
-        case Semantic::DXBCC: return "DXBCC";
-        case Semantic::DXBCD: return "DXBCD";
-        case Semantic::DXBCE: return "DXBCE";
-        case Semantic::DXBCEX: return "DXBCEX";
-        case Semantic::DXBCF: return "DXBCF";
-        case Semantic::DXBCFi: return "DXBCFi";
-        case Semantic::DXBCG: return "DXBCG";
-        case Semantic::DXBCH: return "DXBCH";
-        case Semantic::DXBCI: return "DXBCI";
-        case Semantic::DXBCIE: return "DXBCIE";
-        case Semantic::DXBCIU: return "DXBCIU";
-        case Semantic::DXBCIZ: return "DXBCIZ";
-        case Semantic::DXBCJ: return "DXBCJ";
-        case Semantic::DXBCJv: return "DXBCJv";
-        case Semantic::DXBCK: return "DXBCK";
-        case Semantic::DXBCL: return "DXBCL";
-        case Semantic::DXBCM: return "DXBCM";
-        case Semantic::DXBCMt: return "DXBCMt";
-        case Semantic::DXBCN: return "DXBCN";
-        case Semantic::DXBCNg: return "DXBCNg";
-        case Semantic::DXBCO: return "DXBCO";
-        case Semantic::DXBCP: return "DXBCP";
-        case Semantic::DXBCPT: return "DXBCPT";
-        case Semantic::DXBCQ: return "DXBCQ";
-        case Semantic::DXBCQD: return "DXBCQD";
-        case Semantic::DXBCQG: return "DXBCQG";
-        case Semantic::DXBCQWm: return "DXBCQWm";
-        case Semantic::DXBCRn: return "DXBCRn";
-        case Semantic::DXBCS: return "DXBCS";
-        case Semantic::DXBCT: return "DXBCT";
-        case Semantic::DXBCU: return "DXBCU";
-        case Semantic::DXBCUu: return "DXBCUu";
-        case Semantic::DXBCV: return "DXBCV";
-        case Semantic::DXBCVbq3: return "DXBCVbq3";
-        case Semantic::DXBCW: return "DXBCW";
-        case Semantic::DXBCX_E: return "DXBCX_E";
-        case Semantic::DXBCY: return "DXBCY";
-        case Semantic::DXBCYoK: return "DXBCYoK";
-        case Semantic::DXBCZ: return "DXBCZ";
-        case Semantic::DXBCZcO: return "DXBCZcO";
-        case Semantic::DXBCZi0a: return "DXBCZi0a";
-        case Semantic::DXBCZmJ: return "DXBCZmJ";
-        case Semantic::DXBCa: return "DXBCa";
-        case Semantic::DXBCa6: return "DXBCa6";
-        case Semantic::DXBCav: return "DXBCav";
-        case Semantic::DXBCb: return "DXBCb";
-        case Semantic::DXBCbBN: return "DXBCbBN";
-        case Semantic::DXBCbw_: return "DXBCbw_";
-        case Semantic::DXBCc: return "DXBCc";
-        case Semantic::DXBCcg: return "DXBCcg";
-        case Semantic::DXBCd: return "DXBCd";
-        case Semantic::DXBCdd: return "DXBCdd";
-        case Semantic::DXBCe: return "DXBCe";
-        case Semantic::DXBCe2: return "DXBCe2";
-        case Semantic::DXBCf: return "DXBCf";
-        case Semantic::DXBCg: return "DXBCg";
-        case Semantic::DXBCgdRF: return "DXBCgdRF";
-        case Semantic::DXBCh: return "DXBCh";
-        case Semantic::DXBCh58: return "DXBCh58";
-        case Semantic::DXBChT: return "DXBChT";
-        case Semantic::DXBCha: return "DXBCha";
-        case Semantic::DXBCha0: return "DXBCha0";
-        case Semantic::DXBCho: return "DXBCho";
-        case Semantic::DXBCi: return "DXBCi";
-        case Semantic::DXBCj: return "DXBCj";
-        case Semantic::DXBCk: return "DXBCk";
-        case Semantic::DXBCkT: return "DXBCkT";
-        case Semantic::DXBCkv: return "DXBCkv";
-        case Semantic::DXBCl: return "DXBCl";
-        case Semantic::DXBCm: return "DXBCm";
-        case Semantic::DXBCmK: return "DXBCmK";
-        case Semantic::DXBCn: return "DXBCn";
-        case Semantic::DXBCnp: return "DXBCnp";
-        case Semantic::DXBCo: return "DXBCo";
-        case Semantic::DXBCo0: return "DXBCo0";
-        case Semantic::DXBCoJ: return "DXBCoJ";
-        case Semantic::DXBCp: return "DXBCp";
-        case Semantic::DXBCpl: return "DXBCpl";
-        case Semantic::DXBCq: return "DXBCq";
-        case Semantic::DXBCr: return "DXBCr";
-        case Semantic::DXBCrAn: return "DXBCrAn";
-        case Semantic::DXBCs: return "DXBCs";
-        case Semantic::DXBCsL: return "DXBCsL";
-        case Semantic::DXBCt: return "DXBCt";
-        case Semantic::DXBCtCK: return "DXBCtCK";
-        case Semantic::DXBCtu: return "DXBCtu";
-        case Semantic::DXBCu: return "DXBCu";
-        case Semantic::DXBCuO: return "DXBCuO";
-        case Semantic::DXBCv: return "DXBCv";
-        case Semantic::DXBCw: return "DXBCw";
-        case Semantic::DXBCwn: return "DXBCwn";
-        case Semantic::DXBCx: return "DXBCx";
-        case Semantic::DXBCxTfg: return "DXBCxTfg";
-        case Semantic::DXBCxm: return "DXBCxm";
-        case Semantic::DXBCy: return "DXBCy";
-        case Semantic::DXBCz: return "DXBCz";
-        case Semantic::DXBCzd: return "DXBCzd";
-        case Semantic::DXT1: return "DXT1";
-        case Semantic::DXT3: return "DXT3";
-        case Semantic::DXT5: return "DXT5";
-        case Semantic::DXT5_NM: return "DXT5_NM";
-        case Semantic::DXT5nm: return "DXT5nm";
-        case Semantic::DZH: return "DZH";
-        case Semantic::DZHn: return "DZHn";
-        case Semantic::DZJ: return "DZJ";
-        case Semantic::Damage: return "Damage";
-        case Semantic::DamageA: return "DamageA";
-        case Semantic::DamageB: return "DamageB";
-        case Semantic::DamageCube: return "DamageCube";
-        case Semantic::DamageVectors: return "DamageVectors";
-        case Semantic::DaylightCompensator: return "DaylightCompensator";
-        case Semantic::DeRes: return "DeRes";
-        case Semantic::DeResDepth: return "DeResDepth";
-        case Semantic::DeResDepth_Rigid: return "DeResDepth_Rigid";
-        case Semantic::DeResDepth_RigidSkinned: return "DeResDepth_RigidSkinned";
-        case Semantic::DeResDepth_Skinned: return "DeResDepth_Skinned";
-        case Semantic::DeResGlass: return "DeResGlass";
-        case Semantic::DeResGlow: return "DeResGlow";
-        case Semantic::DeResGlow_Rigid: return "DeResGlow_Rigid";
-        case Semantic::DeResGlow_RigidSkinned: return "DeResGlow_RigidSkinned";
-        case Semantic::DeResGlow_Skinned: return "DeResGlow_Skinned";
-        case Semantic::DeRes_RigidSkinned_0Overlay: return "DeRes_RigidSkinned_0Overlay";
-        case Semantic::DeRes_RigidSkinned_1Overlay: return "DeRes_RigidSkinned_1Overlay";
-        case Semantic::DeRes_RigidSkinned_2Overlay: return "DeRes_RigidSkinned_2Overlay";
-        case Semantic::DeRes_RigidSkinned_3Overlay: return "DeRes_RigidSkinned_3Overlay";
-        case Semantic::DeRes_RigidSkinned_4Overlay: return "DeRes_RigidSkinned_4Overlay";
-        case Semantic::DeRes_Rigid_0Overlay: return "DeRes_Rigid_0Overlay";
-        case Semantic::DeRes_Rigid_1Overlay: return "DeRes_Rigid_1Overlay";
-        case Semantic::DeRes_Rigid_2Overlay: return "DeRes_Rigid_2Overlay";
-        case Semantic::DeRes_Rigid_3Overlay: return "DeRes_Rigid_3Overlay";
-        case Semantic::DeRes_Rigid_4Overlay: return "DeRes_Rigid_4Overlay";
-        case Semantic::DeRes_Skinned_0Overlay: return "DeRes_Skinned_0Overlay";
-        case Semantic::DeRes_Skinned_1Overlay: return "DeRes_Skinned_1Overlay";
-        case Semantic::DeRes_Skinned_2Overlay: return "DeRes_Skinned_2Overlay";
-        case Semantic::DeRes_Skinned_3Overlay: return "DeRes_Skinned_3Overlay";
-        case Semantic::DeRes_Skinned_4Overlay: return "DeRes_Skinned_4Overlay";
-        case Semantic::DebugCharacterTranslucent: return "DebugCharacterTranslucent";
-        case Semantic::DebugCharacterTranslucent_fx_globals: return "DebugCharacterTranslucent_fx_globals";
-        case Semantic::DebugObjectTranslucent: return "DebugObjectTranslucent";
-        case Semantic::DebugObjectTranslucent_fx_globals: return "DebugObjectTranslucent_fx_globals";
-        case Semantic::DebugShader: return "DebugShader";
-        case Semantic::DebugTerrainLod: return "DebugTerrainLod";
-        case Semantic::DebugText: return "DebugText";
-        case Semantic::DebugVehicleTranslucent: return "DebugVehicleTranslucent";
-        case Semantic::DebugVehicleTranslucent_fx_globals: return "DebugVehicleTranslucent_fx_globals";
-        case Semantic::Decal: return "Decal";
-        case Semantic::DecalOpaque: return "DecalOpaque";
-        case Semantic::DecalTint: return "DecalTint";
-        case Semantic::DecalTintHighlight: return "DecalTintHighlight";
-        case Semantic::DecalTintMidtone: return "DecalTintMidtone";
-        case Semantic::DecalTintRotation: return "DecalTintRotation";
-        case Semantic::DecalTintScale: return "DecalTintScale";
-        case Semantic::DecalTintShadow: return "DecalTintShadow";
-        case Semantic::DecalTintTranslation: return "DecalTintTranslation";
-        case Semantic::DecalUVSet: return "DecalUVSet";
-        case Semantic::DefaultTextures: return "DefaultTextures";
-        case Semantic::Density: return "Density";
-        case Semantic::Depth: return "Depth";
-        case Semantic::DepthBias: return "DepthBias";
-        case Semantic::DepthOfFieldTransition: return "DepthOfFieldTransition";
-        case Semantic::DepthOpacityBias: return "DepthOpacityBias";
-        case Semantic::DepthPrePass: return "DepthPrePass";
-        case Semantic::DepthSource: return "DepthSource";
-        case Semantic::DepthToAlpha: return "DepthToAlpha";
-        case Semantic::DepthToAlpha_fx_globals: return "DepthToAlpha_fx_globals";
-        case Semantic::Depth_Rigid: return "Depth_Rigid";
-        case Semantic::Depth_RigidSkinned: return "Depth_RigidSkinned";
-        case Semantic::Depth_Skinned: return "Depth_Skinned";
-        case Semantic::Desat: return "Desat";
-        case Semantic::DesaturationIntensity: return "DesaturationIntensity";
-        case Semantic::Designer: return "Designer";
-        case Semantic::DesignerInstanced: return "DesignerInstanced";
-        case Semantic::DesignerInstanced_fx_globals: return "DesignerInstanced_fx_globals";
-        case Semantic::Designer_fx_globals: return "Designer_fx_globals";
-        case Semantic::Detail: return "Detail";
-        case Semantic::DetailBump: return "DetailBump";
-        case Semantic::DetailBumpiness: return "DetailBumpiness";
-        case Semantic::DetailBumpinessB: return "DetailBumpinessB";
-        case Semantic::DetailColorMap: return "DetailColorMap";
-        case Semantic::DetailFrequency: return "DetailFrequency";
-        case Semantic::DetailFrequencyB: return "DetailFrequencyB";
-        case Semantic::DetailMask: return "DetailMask";
-        case Semantic::DetailMaskMap: return "DetailMaskMap";
-        case Semantic::DetailMaskUsageOrder: return "DetailMaskUsageOrder";
-        case Semantic::DetailNormalMap: return "DetailNormalMap";
-        case Semantic::DetailScale: return "DetailScale";
-        case Semantic::DetailScale4: return "DetailScale4";
-        case Semantic::DetailScale5th: return "DetailScale5th";
-        case Semantic::DetailSelectB: return "DetailSelectB";
-        case Semantic::DetailSpecMap: return "DetailSpecMap";
-        case Semantic::Dg_highQualityLighting: return "Dg_highQualityLighting";
-        case Semantic::Dg_objectID: return "Dg_objectID";
-        case Semantic::Dg_skyLightCoeff0: return "Dg_skyLightCoeff0";
-        case Semantic::Dg_step: return "Dg_step";
-        case Semantic::Dg_worldMatrix: return "Dg_worldMatrix";
-        case Semantic::Dielectric: return "Dielectric";
-        case Semantic::Diffuse: return "Diffuse";
-        case Semantic::DiffuseB: return "DiffuseB";
-        case Semantic::DirShadowMapCoeffs: return "DirShadowMapCoeffs";
-        case Semantic::Direction: return "Direction";
-        case Semantic::DirectionBlurMode: return "DirectionBlurMode";
-        case Semantic::DirectionalLightColor: return "DirectionalLightColor";
-        case Semantic::DirectionalLightDirection: return "DirectionalLightDirection";
-        case Semantic::DirectionalLightShadowInvViewProj: return "DirectionalLightShadowInvViewProj";
-        case Semantic::DirectionalLightShadowMap: return "DirectionalLightShadowMap";
-        case Semantic::DirectionalLightShadowViewProj: return "DirectionalLightShadowViewProj";
-        case Semantic::DirectionalLightViewSpaceDirection: return "DirectionalLightViewSpaceDirection";
-        case Semantic::Distortion: return "Distortion";
-        case Semantic::DistortionLameScale: return "DistortionLameScale";
-        case Semantic::DistortionOcean: return "DistortionOcean";
-        case Semantic::DistortionRiver: return "DistortionRiver";
-        case Semantic::DistortionScaleU: return "DistortionScaleU";
-        case Semantic::DistortionScaleV: return "DistortionScaleV";
-        case Semantic::DistortionSpeedU: return "DistortionSpeedU";
-        case Semantic::DistortionSpeedV: return "DistortionSpeedV";
-        case Semantic::DistortionStream: return "DistortionStream";
-        case Semantic::DistortionSwamp: return "DistortionSwamp";
-        case Semantic::DistortionTech: return "DistortionTech";
-        case Semantic::DistortionTexture: return "DistortionTexture";
-        case Semantic::DizzyIntensity: return "DizzyIntensity";
-        case Semantic::Dm43World: return "Dm43World";
-        case Semantic::Dot: return "Dot";
-        case Semantic::Double: return "Double";
-        case Semantic::DoubleSided: return "DoubleSided";
-        case Semantic::DownsampleDepthMode: return "DownsampleDepthMode";
-        case Semantic::Dv: return "Dv";
-        case Semantic::Dvt: return "Dvt";
-        case Semantic::E: return "E";
-        case Semantic::E3Blur: return "E3Blur";
-        case Semantic::E3Brightness: return "E3Brightness";
-        case Semantic::E3Desat: return "E3Desat";
-        case Semantic::ENoise3D: return "ENoise3D";
-        case Semantic::EcUG: return "EcUG";
-        case Semantic::Ecd: return "Ecd";
-        case Semantic::Ect: return "Ect";
-        case Semantic::Edge: return "Edge";
-        case Semantic::Eg_sunGlowMin: return "Eg_sunGlowMin";
-        case Semantic::Elasticity: return "Elasticity";
-        case Semantic::Emissive: return "Emissive";
-        case Semantic::EmissiveIsTransB: return "EmissiveIsTransB";
-        case Semantic::EmissiveWith3Textures: return "EmissiveWith3Textures";
-        case Semantic::EmitsHeat: return "EmitsHeat";
-        case Semantic::Empire: return "Empire";
-        case Semantic::EmpireTintA: return "EmpireTintA";
-        case Semantic::EmpireTintB: return "EmpireTintB";
-        case Semantic::Enable: return "Enable";
-        case Semantic::EnableAlphaBlending: return "EnableAlphaBlending";
-        case Semantic::EnableAlphaCutout: return "EnableAlphaCutout";
-        case Semantic::EnableColorGrading: return "EnableColorGrading";
-        case Semantic::EnableExtraTint: return "EnableExtraTint";
-        case Semantic::EnablePlanarMapAB: return "EnablePlanarMapAB";
-        case Semantic::EnablePlanarTint: return "EnablePlanarTint";
-        case Semantic::EnableSceneDepthAlphaCutout: return "EnableSceneDepthAlphaCutout";
-        case Semantic::EnableShadowFastZ: return "EnableShadowFastZ";
-        case Semantic::EnableSway: return "EnableSway";
-        case Semantic::EnableTileUV0: return "EnableTileUV0";
-        case Semantic::End: return "End";
-        case Semantic::EnvFilter: return "EnvFilter";
-        case Semantic::EnvFilter_fx_globals: return "EnvFilter_fx_globals";
-        case Semantic::EvComp: return "EvComp";
-        case Semantic::Extra: return "Extra";
-        case Semantic::ExtraTint: return "ExtraTint";
-        case Semantic::ExtraTintColorA: return "ExtraTintColorA";
-        case Semantic::ExtraTintColorB: return "ExtraTintColorB";
-        case Semantic::ExtraTintOpacity: return "ExtraTintOpacity";
-        case Semantic::ExtraTintScale: return "ExtraTintScale";
-        case Semantic::Ey: return "Ey";
-        case Semantic::F: return "F";
-        case Semantic::F0_: return "F0_";
-        case Semantic::F2: return "F2";
-        case Semantic::FFA: return "FFA";
-        case Semantic::FP: return "FP";
-        case Semantic::FW: return "FW";
-        case Semantic::FZ: return "FZ";
-        case Semantic::Fade: return "Fade";
-        case Semantic::FadeModelMaterial: return "FadeModelMaterial";
-        case Semantic::FadeOutEnd: return "FadeOutEnd";
-        case Semantic::FadeOutStart: return "FadeOutStart";
-        case Semantic::FadeOverride: return "FadeOverride";
-        case Semantic::FallOff: return "FallOff";
-        case Semantic::FilterStep: return "FilterStep";
-        case Semantic::FinalTierShadowMap: return "FinalTierShadowMap";
-        case Semantic::FlashIntensity: return "FlashIntensity";
-        case Semantic::Flora: return "Flora";
-        case Semantic::FloraModel: return "FloraModel";
-        case Semantic::FloraModel_VS3_PS3: return "FloraModel_VS3_PS3";
-        case Semantic::Foam: return "Foam";
-        case Semantic::FoamBrightness: return "FoamBrightness";
-        case Semantic::FoamColor: return "FoamColor";
-        case Semantic::FoamDepthBias: return "FoamDepthBias";
-        case Semantic::FoamEnabled: return "FoamEnabled";
-        case Semantic::FoamEnd: return "FoamEnd";
-        case Semantic::FoamFallOff: return "FoamFallOff";
-        case Semantic::FoamNormal: return "FoamNormal";
-        case Semantic::FoamScale: return "FoamScale";
-        case Semantic::FoamScrollU: return "FoamScrollU";
-        case Semantic::FoamScrollU1: return "FoamScrollU1";
-        case Semantic::FoamScrollV: return "FoamScrollV";
-        case Semantic::FoamScrollV1: return "FoamScrollV1";
-        case Semantic::FoamStart: return "FoamStart";
-        case Semantic::FoamUVScale: return "FoamUVScale";
-        case Semantic::FoamWaterTiling: return "FoamWaterTiling";
-        case Semantic::FogAngleColorGradientTexture: return "FogAngleColorGradientTexture";
-        case Semantic::FogBlurPass: return "FogBlurPass";
-        case Semantic::FogColor: return "FogColor";
-        case Semantic::FogDensity: return "FogDensity";
-        case Semantic::FogDepthColorGradientTexture: return "FogDepthColorGradientTexture";
-        case Semantic::FogDepthHorizontalMult: return "FogDepthHorizontalMult";
-        case Semantic::FogEnable: return "FogEnable";
-        case Semantic::FogFloor: return "FogFloor";
-        case Semantic::FogGradient: return "FogGradient";
-        case Semantic::FogHorizontalGradientVector: return "FogHorizontalGradientVector";
-        case Semantic::FogMap: return "FogMap";
-        case Semantic::FogShadowsEnable: return "FogShadowsEnable";
-        case Semantic::FogSkyFar: return "FogSkyFar";
-        case Semantic::FogSkyNear: return "FogSkyNear";
-        case Semantic::Foliage: return "Foliage";
-        case Semantic::FoliageCulling: return "FoliageCulling";
-        case Semantic::FoliageGlowScroll: return "FoliageGlowScroll";
-        case Semantic::FoliageGlowScrollInstanced: return "FoliageGlowScrollInstanced";
-        case Semantic::FoliageGlowScrollInstanced_fx_globals: return "FoliageGlowScrollInstanced_fx_globals";
-        case Semantic::FoliageGlowScroll_fx_globals: return "FoliageGlowScroll_fx_globals";
-        case Semantic::FoliageInstanced: return "FoliageInstanced";
-        case Semantic::FoliageInstanced_fx_globals: return "FoliageInstanced_fx_globals";
-        case Semantic::FoliageNoiseTexture: return "FoliageNoiseTexture";
-        case Semantic::FoliageSingleSided: return "FoliageSingleSided";
-        case Semantic::FoliageSingleSided_fx_globals: return "FoliageSingleSided_fx_globals";
-        case Semantic::Foliage_fx_globals: return "Foliage_fx_globals";
-        case Semantic::FontTexture: return "FontTexture";
-        case Semantic::For: return "For";
-        case Semantic::ForceFieldAdditive: return "ForceFieldAdditive";
-        case Semantic::ForceFieldBGOpacity: return "ForceFieldBGOpacity";
-        case Semantic::ForceFieldColor: return "ForceFieldColor";
-        case Semantic::ForceFieldColor_fx_globals: return "ForceFieldColor_fx_globals";
-        case Semantic::ForceFieldColor_planar: return "ForceFieldColor_planar";
-        case Semantic::ForceFieldColor_planar_fx_globals: return "ForceFieldColor_planar_fx_globals";
-        case Semantic::ForceFieldDistortion: return "ForceFieldDistortion";
-        case Semantic::ForceFieldDistortion_fx_globals: return "ForceFieldDistortion_fx_globals";
-        case Semantic::ForceFieldDistortion_planar: return "ForceFieldDistortion_planar";
-        case Semantic::ForceFieldDistortion_planar_fx_globals: return "ForceFieldDistortion_planar_fx_globals";
-        case Semantic::ForceFieldOpacity: return "ForceFieldOpacity";
-        case Semantic::ForegroundWScale: return "ForegroundWScale";
-        case Semantic::ForegroundZBias: return "ForegroundZBias";
-        case Semantic::ForegroundZScale: return "ForegroundZScale";
-        case Semantic::Forward: return "Forward";
-        case Semantic::FrameColor: return "FrameColor";
-        case Semantic::FrameCount: return "FrameCount";
-        case Semantic::FrameFade: return "FrameFade";
-        case Semantic::FrameOn: return "FrameOn";
-        case Semantic::FrameRatio: return "FrameRatio";
-        case Semantic::FrameWidth: return "FrameWidth";
-        case Semantic::Freq: return "Freq";
-        case Semantic::Frequency: return "Frequency";
-        case Semantic::Fresnel: return "Fresnel";
-        case Semantic::FresnelFuncTexture: return "FresnelFuncTexture";
-        case Semantic::FtA: return "FtA";
-        case Semantic::FtAM: return "FtAM";
-        case Semantic::FtAO: return "FtAO";
-        case Semantic::FtAn: return "FtAn";
-        case Semantic::FtkPN: return "FtkPN";
-        case Semantic::FullScreenEffectDOF: return "FullScreenEffectDOF";
-        case Semantic::FullScreenEffectThermal: return "FullScreenEffectThermal";
-        case Semantic::FullScreenEffectVR: return "FullScreenEffectVR";
-        case Semantic::FullScreenEffects: return "FullScreenEffects";
-        case Semantic::FullscreenEffectID: return "FullscreenEffectID";
-        case Semantic::FullscreenEffectsPass1: return "FullscreenEffectsPass1";
-        case Semantic::FullscreenEffectsPass1_fx_globals: return "FullscreenEffectsPass1_fx_globals";
-        case Semantic::G: return "G";
-        case Semantic::G6: return "G6";
-        case Semantic::GA: return "GA";
-        case Semantic::GBuffer0: return "GBuffer0";
-        case Semantic::GBuffer1: return "GBuffer1";
-        case Semantic::GBuffer2: return "GBuffer2";
-        case Semantic::GBuffer3: return "GBuffer3";
-        case Semantic::GFA: return "GFA";
-        case Semantic::GLAZE: return "GLAZE";
-        case Semantic::GLOW: return "GLOW";
-        case Semantic::GP: return "GP";
-        case Semantic::GX: return "GX";
-        case Semantic::Ga: return "Ga";
-        case Semantic::GaussianIntensity: return "GaussianIntensity";
-        case Semantic::GaussianRadius: return "GaussianRadius";
-        case Semantic::Glass: return "Glass";
-        case Semantic::GlassPass1: return "GlassPass1";
-        case Semantic::GlassPass2: return "GlassPass2";
-        case Semantic::GlassTech: return "GlassTech";
-        case Semantic::Glass_Rigid: return "Glass_Rigid";
-        case Semantic::Glass_Rigid_Skinned: return "Glass_Rigid_Skinned";
-        case Semantic::Glass_Skinned: return "Glass_Skinned";
-        case Semantic::Glaze: return "Glaze";
-        case Semantic::GlazeMax: return "GlazeMax";
-        case Semantic::GlazeMin: return "GlazeMin";
-        case Semantic::GlobalLightLowEnd: return "GlobalLightLowEnd";
-        case Semantic::GlobalLightLowEnd_fx_globals: return "GlobalLightLowEnd_fx_globals";
-        case Semantic::Globals: return "Globals";
-        case Semantic::Glow: return "Glow";
-        case Semantic::GlowBase: return "GlowBase";
-        case Semantic::GlowBrightness: return "GlowBrightness";
-        case Semantic::GlowContrast: return "GlowContrast";
-        case Semantic::GlowMax: return "GlowMax";
-        case Semantic::GlowMin: return "GlowMin";
-        case Semantic::GlowOffset: return "GlowOffset";
-        case Semantic::GlowThickness: return "GlowThickness";
-        case Semantic::GlowUVScale: return "GlowUVScale";
-        case Semantic::GlowWith1TextureInWater_Tinted: return "GlowWith1TextureInWater_Tinted";
-        case Semantic::GlowWith1Texture_Tinted: return "GlowWith1Texture_Tinted";
-        case Semantic::GlowWith2TexturesInWater_Tinted: return "GlowWith2TexturesInWater_Tinted";
-        case Semantic::GlowWith2Textures_Tinted: return "GlowWith2Textures_Tinted";
-        case Semantic::GlowWith3Textures_Tinted: return "GlowWith3Textures_Tinted";
-        case Semantic::Glow_fx_globals: return "Glow_fx_globals";
-        case Semantic::GodRayEndFade: return "GodRayEndFade";
-        case Semantic::GodRayStartFade: return "GodRayStartFade";
-        case Semantic::GradientRedBlueRed: return "GradientRedBlueRed";
-        case Semantic::Green: return "Green";
-        case Semantic::GreenChannel: return "GreenChannel";
-        case Semantic::GreenSource: return "GreenSource";
-        case Semantic::Grey: return "Grey";
-        case Semantic::Grid: return "Grid";
-        case Semantic::GridPattern: return "GridPattern";
-        case Semantic::GroundFog: return "GroundFog";
-        case Semantic::GroundFogTechnique: return "GroundFogTechnique";
-        case Semantic::GroundFog_fx_globals: return "GroundFog_fx_globals";
-        case Semantic::Gux: return "Gux";
-        case Semantic::Gv: return "Gv";
-        case Semantic::H: return "H";
-        case Semantic::H6: return "H6";
-        case Semantic::HAg_holoOpacity: return "HAg_holoOpacity";
-        case Semantic::HB8: return "HB8";
-        case Semantic::HBg_infraRedRange: return "HBg_infraRedRange";
-        case Semantic::HEIGHT: return "HEIGHT";
-        case Semantic::HLSL: return "HLSL";
-        case Semantic::HalfResStreakParticle: return "HalfResStreakParticle";
-        case Semantic::Height: return "Height";
-        case Semantic::HeightMap: return "HeightMap";
-        case Semantic::HideFlatness: return "HideFlatness";
-        case Semantic::HighQualityLighting: return "HighQualityLighting";
-        case Semantic::Highlight: return "Highlight";
-        case Semantic::Holo: return "Holo";
-        case Semantic::HoloColor: return "HoloColor";
-        case Semantic::HoloContrast: return "HoloContrast";
-        case Semantic::HoloEdge: return "HoloEdge";
-        case Semantic::HoloHottness: return "HoloHottness";
-        case Semantic::HoloNoise: return "HoloNoise";
-        case Semantic::HoloNoiseSpeed: return "HoloNoiseSpeed";
-        case Semantic::HoloNoiseTiling: return "HoloNoiseTiling";
-        case Semantic::HoloOpacity: return "HoloOpacity";
-        case Semantic::HoloScanIntensity: return "HoloScanIntensity";
-        case Semantic::HoloScanSpacing: return "HoloScanSpacing";
-        case Semantic::HoloScanSpeed: return "HoloScanSpeed";
-        case Semantic::HoloTexture: return "HoloTexture";
-        case Semantic::HoloTilingRateU: return "HoloTilingRateU";
-        case Semantic::HoloTilingRateV: return "HoloTilingRateV";
-        case Semantic::Hologram: return "Hologram";
-        case Semantic::HologramUVSet: return "HologramUVSet";
-        case Semantic::Hologram_Rigid: return "Hologram_Rigid";
-        case Semantic::Hologram_RigidSkinned: return "Hologram_RigidSkinned";
-        case Semantic::Hologram_Skinned: return "Hologram_Skinned";
-        case Semantic::HorizonFadeHeight: return "HorizonFadeHeight";
-        case Semantic::HorizonGlowColor: return "HorizonGlowColor";
-        case Semantic::HorizonWidthHeightLat: return "HorizonWidthHeightLat";
-        case Semantic::Horizontal: return "Horizontal";
-        case Semantic::HotLava: return "HotLava";
-        case Semantic::HotLavaTiling: return "HotLavaTiling";
-        case Semantic::HotMorph: return "HotMorph";
-        case Semantic::HotRoll: return "HotRoll";
-        case Semantic::Hotness: return "Hotness";
-        case Semantic::Hottness: return "Hottness";
-        case Semantic::Hw3: return "Hw3";
-        case Semantic::I: return "I";
-        case Semantic::IM: return "IM";
-        case Semantic::IMS: return "IMS";
-        case Semantic::IRIS: return "IRIS";
-        case Semantic::ISGN: return "ISGN";
-        case Semantic::ISGND: return "ISGND";
-        case Semantic::ISGNH: return "ISGNH";
-        case Semantic::ISGNL: return "ISGNL";
-        case Semantic::ISGNP: return "ISGNP";
-        case Semantic::ISGNd: return "ISGNd";
-        case Semantic::ISGNh: return "ISGNh";
-        case Semantic::ISGNl: return "ISGNl";
-        case Semantic::ISGNt: return "ISGNt";
-        case Semantic::Il: return "Il";
-        case Semantic::InForeground: return "InForeground";
-        case Semantic::InfraRedColor: return "InfraRedColor";
-        case Semantic::InfraRedOutlineAlpha: return "InfraRedOutlineAlpha";
-        case Semantic::InfraRedOutlineColor: return "InfraRedOutlineColor";
-        case Semantic::InfraRedOutlineWidth: return "InfraRedOutlineWidth";
-        case Semantic::InfraRedScanLines: return "InfraRedScanLines";
-        case Semantic::InfraRedViewRange: return "InfraRedViewRange";
-        case Semantic::InnerOuter: return "InnerOuter";
-        case Semantic::InputTextures: return "InputTextures";
-        case Semantic::InstanceCached: return "InstanceCached";
-        case Semantic::Instanced: return "Instanced";
-        case Semantic::Intensity: return "Intensity";
-        case Semantic::InteriorProbeWeight: return "InteriorProbeWeight";
-        case Semantic::InvGamma: return "InvGamma";
-        case Semantic::Invisible: return "Invisible";
-        case Semantic::IrisClampHigh: return "IrisClampHigh";
-        case Semantic::IrisClampLow: return "IrisClampLow";
-        case Semantic::IrisVisionOffset: return "IrisVisionOffset";
-        case Semantic::IronSight: return "IronSight";
-        case Semantic::IsShadowGenPass: return "IsShadowGenPass";
-        case Semantic::Iyk3: return "Iyk3";
-        case Semantic::J: return "J";
-        case Semantic::J2T: return "J2T";
-        case Semantic::JCm: return "JCm";
-        case Semantic::K: return "K";
-        case Semantic::K4: return "K4";
-        case Semantic::KRi1pC: return "KRi1pC";
-        case Semantic::KS: return "KS";
-        case Semantic::KeyLuminance: return "KeyLuminance";
-        case Semantic::KtkPN: return "KtkPN";
-        case Semantic::L: return "L";
-        case Semantic::L8: return "L8";
-        case Semantic::LFL: return "LFL";
-        case Semantic::LRH: return "LRH";
-        case Semantic::LS: return "LS";
-        case Semantic::Lava: return "Lava";
-        case Semantic::Lava_fx_globals: return "Lava_fx_globals";
-        case Semantic::LeftFrame: return "LeftFrame";
-        case Semantic::Length: return "Length";
-        case Semantic::LensCenterFalloffCutoff: return "LensCenterFalloffCutoff";
-        case Semantic::LensDirtBloomSunSkyStrAlpha: return "LensDirtBloomSunSkyStrAlpha";
-        case Semantic::LensDirtLayer1SizeStrRanges: return "LensDirtLayer1SizeStrRanges";
-        case Semantic::LensDirtLayer2SizeStrRanges: return "LensDirtLayer2SizeStrRanges";
-        case Semantic::LensDirtLayerDensities: return "LensDirtLayerDensities";
-        case Semantic::LensDirtNoiseScaleStr: return "LensDirtNoiseScaleStr";
-        case Semantic::LensEffects: return "LensEffects";
-        case Semantic::LensEffectsEnabled: return "LensEffectsEnabled";
-        case Semantic::LensEffects_fx_globals: return "LensEffects_fx_globals";
-        case Semantic::LensHazeSunSkyStr: return "LensHazeSunSkyStr";
-        case Semantic::LensHoodFalloffAngle: return "LensHoodFalloffAngle";
-        case Semantic::Lerp: return "Lerp";
-        case Semantic::Lerp2: return "Lerp2";
-        case Semantic::Lerp3: return "Lerp3";
-        case Semantic::Light: return "Light";
-        case Semantic::LightColor: return "LightColor";
-        case Semantic::LightDirectionRSM: return "LightDirectionRSM";
-        case Semantic::LightFalloff: return "LightFalloff";
-        case Semantic::LightPositionRSM: return "LightPositionRSM";
-        case Semantic::LightScattering: return "LightScattering";
-        case Semantic::LightTypeRSM: return "LightTypeRSM";
-        case Semantic::LitMode: return "LitMode";
-        case Semantic::Lm3XQ: return "Lm3XQ";
-        case Semantic::LocalBasis: return "LocalBasis";
-        case Semantic::LodIndex: return "LodIndex";
-        case Semantic::LodNearDistance: return "LodNearDistance";
-        case Semantic::LodScale: return "LodScale";
-        case Semantic::LowEnd: return "LowEnd";
-        case Semantic::Lq: return "Lq";
-        case Semantic::Lt: return "Lt";
-        case Semantic::LvMj2: return "LvMj2";
-        case Semantic::Ly: return "Ly";
-        case Semantic::M: return "M";
-        case Semantic::MA: return "MA";
-        case Semantic::METALIC: return "METALIC";
-        case Semantic::MainSceneCameraPos: return "MainSceneCameraPos";
-        case Semantic::Map: return "Map";
-        case Semantic::Mask: return "Mask";
-        case Semantic::MaskTexture: return "MaskTexture";
-        case Semantic::Max: return "Max";
-        case Semantic::MaxDayColor: return "MaxDayColor";
-        case Semantic::MaxDayFoamC: return "MaxDayFoamC";
-        case Semantic::MaxNightColor: return "MaxNightColor";
-        case Semantic::MaxNightFoamC: return "MaxNightFoamC";
-        case Semantic::MaxValue: return "MaxValue";
-        case Semantic::Metalic: return "Metalic";
-        case Semantic::Metallic: return "Metallic";
-        case Semantic::MetersPerSecond: return "MetersPerSecond";
-        case Semantic::Microsoft: return "Microsoft";
-        case Semantic::Midtone: return "Midtone";
-        case Semantic::Min: return "Min";
-        case Semantic::MinDayColor: return "MinDayColor";
-        case Semantic::MinDayFoamC: return "MinDayFoamC";
-        case Semantic::MinNightColor: return "MinNightColor";
-        case Semantic::MinNightFoamC: return "MinNightFoamC";
-        case Semantic::MinValue: return "MinValue";
-        case Semantic::MiniMapLight: return "MiniMapLight";
-        case Semantic::MiniMapLight_fx_globals: return "MiniMapLight_fx_globals";
-        case Semantic::MiniMapWater: return "MiniMapWater";
-        case Semantic::MiniMapWater_fx_globals: return "MiniMapWater_fx_globals";
-        case Semantic::Model: return "Model";
-        case Semantic::ModelDoubleSided: return "ModelDoubleSided";
-        case Semantic::Model_fx_globals: return "Model_fx_globals";
-        case Semantic::MorphTiling: return "MorphTiling";
-        case Semantic::MotionBlur: return "MotionBlur";
-        case Semantic::MotionBlurPower: return "MotionBlurPower";
-        case Semantic::MotionTiles: return "MotionTiles";
-        case Semantic::Mt9: return "Mt9";
-        case Semantic::MuJD: return "MuJD";
-        case Semantic::Mud: return "Mud";
-        case Semantic::MultiDataMap: return "MultiDataMap";
-        case Semantic::N: return "N";
-        case Semantic::NBFK: return "NBFK";
-        case Semantic::NM: return "NM";
-        case Semantic::NORMAL: return "NORMAL";
-        case Semantic::NightLightsMap: return "NightLightsMap";
-        case Semantic::NightLightsTexture: return "NightLightsTexture";
-        case Semantic::NightVisionIntensity: return "NightVisionIntensity";
-        case Semantic::NightVisionNoise: return "NightVisionNoise";
-        case Semantic::NightVisionScanLines: return "NightVisionScanLines";
-        case Semantic::NightVisionWhitePointAdjustment: return "NightVisionWhitePointAdjustment";
-        case Semantic::NoDepth: return "NoDepth";
-        case Semantic::NoOp: return "NoOp";
-        case Semantic::Noise: return "Noise";
-        case Semantic::Noise2D: return "Noise2D";
-        case Semantic::Noise3D: return "Noise3D";
-        case Semantic::NoiseAlpha: return "NoiseAlpha";
-        case Semantic::NoiseSpeed: return "NoiseSpeed";
-        case Semantic::NoiseTex: return "NoiseTex";
-        case Semantic::NoiseThickness: return "NoiseThickness";
-        case Semantic::NoiseTiling: return "NoiseTiling";
-        case Semantic::Normal: return "Normal";
-        case Semantic::NormalDistortion: return "NormalDistortion";
-        case Semantic::NormalMap: return "NormalMap";
-        case Semantic::Normals: return "Normals";
-        case Semantic::NormalsBuffer: return "NormalsBuffer";
-        case Semantic::Nqxa: return "Nqxa";
-        case Semantic::O: return "O";
-        case Semantic::ONLY: return "ONLY";
-        case Semantic::OPAQUE: return "OPAQUE";
-        case Semantic::OSG58: return "OSG58";
-        case Semantic::OSGN: return "OSGN";
-        case Semantic::OSGND: return "OSGND";
-        case Semantic::OSGNL: return "OSGNL";
-        case Semantic::OSGNP: return "OSGNP";
-        case Semantic::OSGNh: return "OSGNh";
-        case Semantic::OSGNl: return "OSGNl";
-        case Semantic::OSGNt: return "OSGNt";
-        case Semantic::OXYg: return "OXYg";
-        case Semantic::Object: return "Object";
-        case Semantic::ObjectColor: return "ObjectColor";
-        case Semantic::ObjectGrid: return "ObjectGrid";
-        case Semantic::ObjectGrid_fx_globals: return "ObjectGrid_fx_globals";
-        case Semantic::ObjectID: return "ObjectID";
-        case Semantic::ObjectShadow: return "ObjectShadow";
-        case Semantic::Object_fx_globals: return "Object_fx_globals";
-        case Semantic::Ocean: return "Ocean";
-        case Semantic::Offset: return "Offset";
-        case Semantic::Opacity: return "Opacity";
-        case Semantic::Opacity_: return "Opacity_";
-        case Semantic::Opaque: return "Opaque";
-        case Semantic::OpaqueInstanced: return "OpaqueInstanced";
-        case Semantic::Opaque_RigidSkinned_0Overlay: return "Opaque_RigidSkinned_0Overlay";
-        case Semantic::Opaque_RigidSkinned_1Overlay: return "Opaque_RigidSkinned_1Overlay";
-        case Semantic::Opaque_RigidSkinned_2Overlay: return "Opaque_RigidSkinned_2Overlay";
-        case Semantic::Opaque_RigidSkinned_3Overlay: return "Opaque_RigidSkinned_3Overlay";
-        case Semantic::Opaque_RigidSkinned_4Overlay: return "Opaque_RigidSkinned_4Overlay";
-        case Semantic::Opaque_Rigid_0Overlay: return "Opaque_Rigid_0Overlay";
-        case Semantic::Opaque_Rigid_1Overlay: return "Opaque_Rigid_1Overlay";
-        case Semantic::Opaque_Rigid_2Overlay: return "Opaque_Rigid_2Overlay";
-        case Semantic::Opaque_Rigid_3Overlay: return "Opaque_Rigid_3Overlay";
-        case Semantic::Opaque_Rigid_4Overlay: return "Opaque_Rigid_4Overlay";
-        case Semantic::Opaque_Skinned_0Overlay: return "Opaque_Skinned_0Overlay";
-        case Semantic::Opaque_Skinned_1Overlay: return "Opaque_Skinned_1Overlay";
-        case Semantic::Opaque_Skinned_2Overlay: return "Opaque_Skinned_2Overlay";
-        case Semantic::Opaque_Skinned_3Overlay: return "Opaque_Skinned_3Overlay";
-        case Semantic::Opaque_Skinned_4Overlay: return "Opaque_Skinned_4Overlay";
-        case Semantic::Options: return "Options";
-        case Semantic::OrU7: return "OrU7";
-        case Semantic::Ot: return "Ot";
-        case Semantic::Overcast: return "Overcast";
-        case Semantic::Overlay: return "Overlay";
-        case Semantic::Overlay1: return "Overlay1";
-        case Semantic::Overlay1ColorChannel: return "Overlay1ColorChannel";
-        case Semantic::Overlay1Tiling: return "Overlay1Tiling";
-        case Semantic::Overlay1UVSet: return "Overlay1UVSet";
-        case Semantic::Overlay2: return "Overlay2";
-        case Semantic::Overlay2ColorChannel: return "Overlay2ColorChannel";
-        case Semantic::Overlay2Tiling: return "Overlay2Tiling";
-        case Semantic::Overlay2UVSet: return "Overlay2UVSet";
-        case Semantic::Overlay3: return "Overlay3";
-        case Semantic::Overlay3ColorChannel: return "Overlay3ColorChannel";
-        case Semantic::Overlay3Tiling: return "Overlay3Tiling";
-        case Semantic::Overlay3UVSet: return "Overlay3UVSet";
-        case Semantic::Overlay4: return "Overlay4";
-        case Semantic::Overlay4ColorChannel: return "Overlay4ColorChannel";
-        case Semantic::Overlay4Tiling: return "Overlay4Tiling";
-        case Semantic::Overlay4UVSet: return "Overlay4UVSet";
-        case Semantic::OverlayA: return "OverlayA";
-        case Semantic::OverlayB: return "OverlayB";
-        case Semantic::OverlayMask: return "OverlayMask";
-        case Semantic::OverlayNM: return "OverlayNM";
-        case Semantic::OverlayScale: return "OverlayScale";
-        case Semantic::OverlaySmoothing: return "OverlaySmoothing";
-        case Semantic::OverlayTiling: return "OverlayTiling";
-        case Semantic::P: return "P";
-        case Semantic::PCSG: return "PCSG";
-        case Semantic::POSITION: return "POSITION";
-        case Semantic::P_B: return "P_B";
-        case Semantic::P_BK: return "P_BK";
-        case Semantic::ParticleCameraEye: return "ParticleCameraEye";
-        case Semantic::ParticleColor: return "ParticleColor";
-        case Semantic::ParticleColorTexture: return "ParticleColorTexture";
-        case Semantic::ParticleDistort: return "ParticleDistort";
-        case Semantic::ParticleDistort_fx_globals: return "ParticleDistort_fx_globals";
-        case Semantic::ParticleMaskTextureMap: return "ParticleMaskTextureMap";
-        case Semantic::ParticleNormalTexture: return "ParticleNormalTexture";
-        case Semantic::ParticleOptions: return "ParticleOptions";
-        case Semantic::ParticleOptions2: return "ParticleOptions2";
-        case Semantic::ParticlePCFShadows: return "ParticlePCFShadows";
-        case Semantic::ParticlePCFShadows_fx_globals: return "ParticlePCFShadows_fx_globals";
-        case Semantic::ParticleTextureParams: return "ParticleTextureParams";
-        case Semantic::ParticleTintColor: return "ParticleTintColor";
-        case Semantic::ParticleWorld: return "ParticleWorld";
-        case Semantic::ParticleWorldViewInverse: return "ParticleWorldViewInverse";
-        case Semantic::ParticlesShadowMode: return "ParticlesShadowMode";
-        case Semantic::Pass0: return "Pass0";
-        case Semantic::Pass1: return "Pass1";
-        case Semantic::Pass2: return "Pass2";
-        case Semantic::Pass3: return "Pass3";
-        case Semantic::Pass4: return "Pass4";
-        case Semantic::Pass5: return "Pass5";
-        case Semantic::Pass6: return "Pass6";
-        case Semantic::Pass7: return "Pass7";
-        case Semantic::Pass8: return "Pass8";
-        case Semantic::Pass9: return "Pass9";
-        case Semantic::Pattern: return "Pattern";
-        case Semantic::PatternAlpha: return "PatternAlpha";
-        case Semantic::PatternColor: return "PatternColor";
-        case Semantic::PatternGlow: return "PatternGlow";
-        case Semantic::PatternOpacity: return "PatternOpacity";
-        case Semantic::PatternScaler: return "PatternScaler";
-        case Semantic::PatternTiling: return "PatternTiling";
-        case Semantic::PeakAlphaFromTexture: return "PeakAlphaFromTexture";
-        case Semantic::Periodic: return "Periodic";
-        case Semantic::PerlinNoise: return "PerlinNoise";
-        case Semantic::PerlinNoise3D: return "PerlinNoise3D";
-        case Semantic::PickColor: return "PickColor";
-        case Semantic::PickFoliage: return "PickFoliage";
-        case Semantic::PickFoliage_fx_globals: return "PickFoliage_fx_globals";
-        case Semantic::PickRigid: return "PickRigid";
-        case Semantic::PickRigid_fx_globals: return "PickRigid_fx_globals";
-        case Semantic::PickTerrain: return "PickTerrain";
-        case Semantic::PickTerrain_fx_globals: return "PickTerrain_fx_globals";
-        case Semantic::PixelShaderIndex: return "PixelShaderIndex";
-        case Semantic::Planar: return "Planar";
-        case Semantic::PlanarMapA: return "PlanarMapA";
-        case Semantic::PlanarMapBrightness: return "PlanarMapBrightness";
-        case Semantic::Planet: return "Planet";
-        case Semantic::PlanetAtmosphere: return "PlanetAtmosphere";
-        case Semantic::PlanetAtmosphere_fx_globals: return "PlanetAtmosphere_fx_globals";
-        case Semantic::Planet_fx_globals: return "Planet_fx_globals";
-        case Semantic::Pm3XQ: return "Pm3XQ";
-        case Semantic::PointLight: return "PointLight";
-        case Semantic::PointLightColor: return "PointLightColor";
-        case Semantic::PointLightPosition: return "PointLightPosition";
-        case Semantic::PointLightRange: return "PointLightRange";
-        case Semantic::Pointiness: return "Pointiness";
-        case Semantic::Polarize: return "Polarize";
-        case Semantic::PositionScale: return "PositionScale";
-        case Semantic::Post: return "Post";
-        case Semantic::PostBloomCutoff: return "PostBloomCutoff";
-        case Semantic::PostEffect: return "PostEffect";
-        case Semantic::PostFocus: return "PostFocus";
-        case Semantic::PostLowEnd: return "PostLowEnd";
-        case Semantic::PostLowEnd_fx_globals: return "PostLowEnd_fx_globals";
-        case Semantic::PostObscure: return "PostObscure";
-        case Semantic::PostVignette: return "PostVignette";
-        case Semantic::Power: return "Power";
-        case Semantic::PreLit: return "PreLit";
-        case Semantic::PreZ: return "PreZ";
-        case Semantic::Pre_Z: return "Pre_Z";
-        case Semantic::PrimaryInputTexture: return "PrimaryInputTexture";
-        case Semantic::Primitive2D: return "Primitive2D";
-        case Semantic::Primitive2DTexture: return "Primitive2DTexture";
-        case Semantic::Primitive2DTexture2: return "Primitive2DTexture2";
-        case Semantic::Primitive2DTexture2_fx_globals: return "Primitive2DTexture2_fx_globals";
-        case Semantic::Primitive2DTexture3: return "Primitive2DTexture3";
-        case Semantic::Primitive2DTexture3_fx_globals: return "Primitive2DTexture3_fx_globals";
-        case Semantic::Primitive2D_fx_globals: return "Primitive2D_fx_globals";
-        case Semantic::Primitive3D: return "Primitive3D";
-        case Semantic::ProbeEvComp: return "ProbeEvComp";
-        case Semantic::ProjDecal: return "ProjDecal";
-        case Semantic::ProjDecalClear: return "ProjDecalClear";
-        case Semantic::ProjDecalLighting: return "ProjDecalLighting";
-        case Semantic::PuBc: return "PuBc";
-        case Semantic::PuBct: return "PuBct";
-        case Semantic::Q: return "Q";
-        case Semantic::QBE: return "QBE";
-        case Semantic::Qjk: return "Qjk";
-        case Semantic::Qyvo: return "Qyvo";
-        case Semantic::R: return "R";
-        case Semantic::RB: return "RB";
-        case Semantic::RBfY: return "RBfY";
-        case Semantic::RD11: return "RD11";
-        case Semantic::RDEF: return "RDEF";
-        case Semantic::RDEF0: return "RDEF0";
-        case Semantic::RDEF4: return "RDEF4";
-        case Semantic::RDEF8: return "RDEF8";
-        case Semantic::RDEFD: return "RDEFD";
-        case Semantic::RDEFD3: return "RDEFD3";
-        case Semantic::RDEFH: return "RDEFH";
-        case Semantic::RDEFL: return "RDEFL";
-        case Semantic::RDEFP: return "RDEFP";
-        case Semantic::RDEFT: return "RDEFT";
-        case Semantic::RDEFX: return "RDEFX";
-        case Semantic::RDEFd: return "RDEFd";
-        case Semantic::RDEFh: return "RDEFh";
-        case Semantic::RDEFl: return "RDEFl";
-        case Semantic::RDEFp: return "RDEFp";
-        case Semantic::RDEFt: return "RDEFt";
-        case Semantic::RDEFx: return "RDEFx";
-        case Semantic::RDWo1: return "RDWo1";
-        case Semantic::RFL: return "RFL";
-        case Semantic::RGBA: return "RGBA";
-        case Semantic::RIPPLE: return "RIPPLE";
-        case Semantic::ROUGH: return "ROUGH";
-        case Semantic::RRH: return "RRH";
-        case Semantic::RSMShadowOffset: return "RSMShadowOffset";
-        case Semantic::RSMShadowScale: return "RSMShadowScale";
-        case Semantic::RainbowGradient: return "RainbowGradient";
-        case Semantic::RainbowRadial: return "RainbowRadial";
-        case Semantic::RainbowRadialPower: return "RainbowRadialPower";
-        case Semantic::RainbowRadialStrength: return "RainbowRadialStrength";
-        case Semantic::RainbowRadial_fx_globals: return "RainbowRadial_fx_globals";
-        case Semantic::RandomSeed: return "RandomSeed";
-        case Semantic::RcpLodRange: return "RcpLodRange";
-        case Semantic::Red: return "Red";
-        case Semantic::RedChannel: return "RedChannel";
-        case Semantic::RedDot: return "RedDot";
-        case Semantic::RedDotColorOverride: return "RedDotColorOverride";
-        case Semantic::RedDot_fx_globals: return "RedDot_fx_globals";
-        case Semantic::RedSource: return "RedSource";
-        case Semantic::Reduce: return "Reduce";
-        case Semantic::ReduceBloom: return "ReduceBloom";
-        case Semantic::RefCameraMatrix: return "RefCameraMatrix";
-        case Semantic::Reflection: return "Reflection";
-        case Semantic::Refract: return "Refract";
-        case Semantic::Refraction: return "Refraction";
-        case Semantic::Replication: return "Replication";
-        case Semantic::ReplicationMask: return "ReplicationMask";
-        case Semantic::Res: return "Res";
-        case Semantic::ResColor: return "ResColor";
-        case Semantic::ResPattern: return "ResPattern";
-        case Semantic::ResolveTransparency: return "ResolveTransparency";
-        case Semantic::ResourceName: return "ResourceName";
-        case Semantic::ResourceType: return "ResourceType";
-        case Semantic::Rigid: return "Rigid";
-        case Semantic::RigidCloak: return "RigidCloak";
-        case Semantic::RigidCloakColor: return "RigidCloakColor";
-        case Semantic::RigidCloakColorDistortion: return "RigidCloakColorDistortion";
-        case Semantic::RigidCloakDarkLightColor: return "RigidCloakDarkLightColor";
-        case Semantic::RigidCloakDepth: return "RigidCloakDepth";
-        case Semantic::RigidCloakDistortion: return "RigidCloakDistortion";
-        case Semantic::RigidDeRes: return "RigidDeRes";
-        case Semantic::RigidDeResDepth: return "RigidDeResDepth";
-        case Semantic::RigidDeResDepth_fx_globals: return "RigidDeResDepth_fx_globals";
-        case Semantic::RigidDeResGlass: return "RigidDeResGlass";
-        case Semantic::RigidDeResGlow: return "RigidDeResGlow";
-        case Semantic::RigidDepth: return "RigidDepth";
-        case Semantic::RigidGlass: return "RigidGlass";
-        case Semantic::RigidGlowWith1Texture_Tinted: return "RigidGlowWith1Texture_Tinted";
-        case Semantic::RigidGlowWith2Textures_Tinted: return "RigidGlowWith2Textures_Tinted";
-        case Semantic::RigidGlowWith3Textures_Tinted: return "RigidGlowWith3Textures_Tinted";
-        case Semantic::RigidHologram: return "RigidHologram";
-        case Semantic::RigidInstancedDepth_VS3_PS3: return "RigidInstancedDepth_VS3_PS3";
-        case Semantic::RigidLODTech: return "RigidLODTech";
-        case Semantic::RigidLODs: return "RigidLODs";
-        case Semantic::RigidLODs_fx_globals: return "RigidLODs_fx_globals";
-        case Semantic::RigidOpaque: return "RigidOpaque";
-        case Semantic::RigidShieldColor: return "RigidShieldColor";
-        case Semantic::RigidShieldDistortion: return "RigidShieldDistortion";
-        case Semantic::RigidSkinnedLODs: return "RigidSkinnedLODs";
-        case Semantic::RigidSkinnedLODs_fx_globals: return "RigidSkinnedLODs_fx_globals";
-        case Semantic::RippleFreq: return "RippleFreq";
-        case Semantic::RippleSpeed: return "RippleSpeed";
-        case Semantic::RippleX: return "RippleX";
-        case Semantic::RippleY: return "RippleY";
-        case Semantic::RippleZ: return "RippleZ";
-        case Semantic::River: return "River";
-        case Semantic::RollTiling: return "RollTiling";
-        case Semantic::Rotation: return "Rotation";
-        case Semantic::Rough: return "Rough";
-        case Semantic::S: return "S";
-        case Semantic::SCALE: return "SCALE";
-        case Semantic::SCROLL: return "SCROLL";
-        case Semantic::SD: return "SD";
-        case Semantic::SHEX: return "SHEX";
-        case Semantic::SHEX0: return "SHEX0";
-        case Semantic::SHEX4: return "SHEX4";
-        case Semantic::SHEX8: return "SHEX8";
-        case Semantic::SHEXD: return "SHEXD";
-        case Semantic::SHEXH: return "SHEXH";
-        case Semantic::SHEXL: return "SHEXL";
-        case Semantic::SHEXP: return "SHEXP";
-        case Semantic::SHEXP1: return "SHEXP1";
-        case Semantic::SHEXT: return "SHEXT";
-        case Semantic::SHEXX: return "SHEXX";
-        case Semantic::SHEXd: return "SHEXd";
-        case Semantic::SHEXh: return "SHEXh";
-        case Semantic::SHEXl: return "SHEXl";
-        case Semantic::SHEXp: return "SHEXp";
-        case Semantic::SHEXt: return "SHEXt";
-        case Semantic::SHEXx: return "SHEXx";
-        case Semantic::SOE_UIType: return "SOE_UIType";
-        case Semantic::SSAO: return "SSAO";
-        case Semantic::SSAOSourceDepth: return "SSAOSourceDepth";
-        case Semantic::STAT: return "STAT";
-        case Semantic::STEALTH: return "STEALTH";
-        case Semantic::SV_Depth: return "SV_Depth";
-        case Semantic::SV_InsideTessFactor: return "SV_InsideTessFactor";
-        case Semantic::SV_IsFrontFace: return "SV_IsFrontFace";
-        case Semantic::SV_Position: return "SV_Position";
-        case Semantic::SV_Target: return "SV_Target";
-        case Semantic::SV_TessFactor: return "SV_TessFactor";
-        case Semantic::SV_VertexID: return "SV_VertexID";
-        case Semantic::Satellite: return "Satellite";
-        case Semantic::SatelliteBlend: return "SatelliteBlend";
-        case Semantic::SatelliteBrightness: return "SatelliteBrightness";
-        case Semantic::SatelliteColor: return "SatelliteColor";
-        case Semantic::SatelliteDepth: return "SatelliteDepth";
-        case Semantic::SatelliteHdrTexture: return "SatelliteHdrTexture";
-        case Semantic::SatelliteUVOffsetNScale: return "SatelliteUVOffsetNScale";
-        case Semantic::SatelliteWorldMatrix: return "SatelliteWorldMatrix";
-        case Semantic::Satellite_fx_globals: return "Satellite_fx_globals";
-        case Semantic::Scale: return "Scale";
-        case Semantic::Scale1: return "Scale1";
-        case Semantic::Scale1_U: return "Scale1_U";
-        case Semantic::Scale1_V: return "Scale1_V";
-        case Semantic::Scale2: return "Scale2";
-        case Semantic::Scale2_U: return "Scale2_U";
-        case Semantic::Scale2_V: return "Scale2_V";
-        case Semantic::Scale3: return "Scale3";
-        case Semantic::Scale3_U: return "Scale3_U";
-        case Semantic::Scale3_V: return "Scale3_V";
-        case Semantic::ScaleB: return "ScaleB";
-        case Semantic::ScaleBias: return "ScaleBias";
-        case Semantic::ScaleEnd: return "ScaleEnd";
-        case Semantic::ScalePower: return "ScalePower";
-        case Semantic::ScaleStart: return "ScaleStart";
-        case Semantic::ScaleWavefrontSize: return "ScaleWavefrontSize";
-        case Semantic::ScaleX: return "ScaleX";
-        case Semantic::ScaleY: return "ScaleY";
-        case Semantic::Scaler: return "Scaler";
-        case Semantic::Scan: return "Scan";
-        case Semantic::ScatterConstants: return "ScatterConstants";
-        case Semantic::ScatterLight: return "ScatterLight";
-        case Semantic::ScatterWashBias: return "ScatterWashBias";
-        case Semantic::ScatterWavelengths: return "ScatterWavelengths";
-        case Semantic::Scattering: return "Scattering";
-        case Semantic::ScreenDirt: return "ScreenDirt";
-        case Semantic::ScreenDirtLookup: return "ScreenDirtLookup";
-        case Semantic::ScreenDirtLookupTex: return "ScreenDirtLookupTex";
-        case Semantic::ScreenDirtTex: return "ScreenDirtTex";
-        case Semantic::ScreenFrame: return "ScreenFrame";
-        case Semantic::ScreenFrameColor: return "ScreenFrameColor";
-        case Semantic::ScreenFrameUI: return "ScreenFrameUI";
-        case Semantic::ScreenFrameUI_fx_globals: return "ScreenFrameUI_fx_globals";
-        case Semantic::Scroll: return "Scroll";
-        case Semantic::Scroll1: return "Scroll1";
-        case Semantic::Scroll1_U: return "Scroll1_U";
-        case Semantic::Scroll1_V: return "Scroll1_V";
-        case Semantic::Scroll2: return "Scroll2";
-        case Semantic::Scroll2_U: return "Scroll2_U";
-        case Semantic::Scroll2_V: return "Scroll2_V";
-        case Semantic::Scroll3: return "Scroll3";
-        case Semantic::Scroll3_U: return "Scroll3_U";
-        case Semantic::Scroll3_V: return "Scroll3_V";
-        case Semantic::ScrollU: return "ScrollU";
-        case Semantic::ScrollU_: return "ScrollU_";
-        case Semantic::ScrollV: return "ScrollV";
-        case Semantic::ScrollV_: return "ScrollV_";
-        case Semantic::Sediment: return "Sediment";
-        case Semantic::Select: return "Select";
-        case Semantic::Set: return "Set";
-        case Semantic::SevenTapGaussian: return "SevenTapGaussian";
-        case Semantic::SevenTapGaussian_fx_globals: return "SevenTapGaussian_fx_globals";
-        case Semantic::Shader: return "Shader";
-        case Semantic::Shadow: return "Shadow";
-        case Semantic::ShadowDepthBias: return "ShadowDepthBias";
-        case Semantic::ShadowDepthOffsets: return "ShadowDepthOffsets";
-        case Semantic::ShadowDepthScales: return "ShadowDepthScales";
-        case Semantic::ShadowEnable: return "ShadowEnable";
-        case Semantic::ShadowEnableFastZ: return "ShadowEnableFastZ";
-        case Semantic::ShadowFilter: return "ShadowFilter";
-        case Semantic::ShadowFilterSource: return "ShadowFilterSource";
-        case Semantic::ShadowFilter_fx_globals: return "ShadowFilter_fx_globals";
-        case Semantic::ShadowMap: return "ShadowMap";
-        case Semantic::ShadowMapCoeffs: return "ShadowMapCoeffs";
-        case Semantic::ShadowProjector: return "ShadowProjector";
-        case Semantic::ShadowProjector_fx_globals: return "ShadowProjector_fx_globals";
-        case Semantic::ShadowResolve: return "ShadowResolve";
-        case Semantic::ShadowResolveInput: return "ShadowResolveInput";
-        case Semantic::ShadowResolveOrtho: return "ShadowResolveOrtho";
-        case Semantic::ShadowSampleMode: return "ShadowSampleMode";
-        case Semantic::ShadowSlopeScaledDepthBias: return "ShadowSlopeScaledDepthBias";
-        case Semantic::ShadowViewProj: return "ShadowViewProj";
-        case Semantic::ShadowsFilterType: return "ShadowsFilterType";
-        case Semantic::Sharpness: return "Sharpness";
-        case Semantic::Shield: return "Shield";
-        case Semantic::ShieldBGColor: return "ShieldBGColor";
-        case Semantic::ShieldColor: return "ShieldColor";
-        case Semantic::ShieldColor_Rigid: return "ShieldColor_Rigid";
-        case Semantic::ShieldColor_RigidSkinned: return "ShieldColor_RigidSkinned";
-        case Semantic::ShieldColor_Skinned: return "ShieldColor_Skinned";
-        case Semantic::ShieldDistance: return "ShieldDistance";
-        case Semantic::ShieldDistortion: return "ShieldDistortion";
-        case Semantic::ShieldDistortion_Rigid: return "ShieldDistortion_Rigid";
-        case Semantic::ShieldDistortion_RigidSkinned: return "ShieldDistortion_RigidSkinned";
-        case Semantic::ShieldDistortion_Skinned: return "ShieldDistortion_Skinned";
-        case Semantic::ShieldFresnel: return "ShieldFresnel";
-        case Semantic::ShieldHottness: return "ShieldHottness";
-        case Semantic::ShieldPattern: return "ShieldPattern";
-        case Semantic::ShieldReduceBloom: return "ShieldReduceBloom";
-        case Semantic::Shift: return "Shift";
-        case Semantic::Show: return "Show";
-        case Semantic::ShowDecalTint: return "ShowDecalTint";
-        case Semantic::ShowTilingTint: return "ShowTilingTint";
-        case Semantic::Sigma: return "Sigma";
-        case Semantic::SiltColor: return "SiltColor";
-        case Semantic::SiltDepth: return "SiltDepth";
-        case Semantic::SiltNFoam: return "SiltNFoam";
-        case Semantic::SiltNFoamTexture: return "SiltNFoamTexture";
-        case Semantic::SimpleEmissive: return "SimpleEmissive";
-        case Semantic::SimpleEmissive_fx_globals: return "SimpleEmissive_fx_globals";
-        case Semantic::SimpleGlow: return "SimpleGlow";
-        case Semantic::SimpleGlow_fx_globals: return "SimpleGlow_fx_globals";
-        case Semantic::SimpleSpriteParticle: return "SimpleSpriteParticle";
-        case Semantic::SimpleSpriteParticleDistortion: return "SimpleSpriteParticleDistortion";
-        case Semantic::SimpleSpriteParticleEmitter: return "SimpleSpriteParticleEmitter";
-        case Semantic::SimpleSpriteParticleEmitterDistortion: return "SimpleSpriteParticleEmitterDistortion";
-        case Semantic::SimpleSpriteParticleEmitterDistortion_fx_globals: return "SimpleSpriteParticleEmitterDistortion_fx_globals";
-        case Semantic::SimpleSpriteParticleEmitterFillVisualization: return "SimpleSpriteParticleEmitterFillVisualization";
-        case Semantic::SimpleSpriteParticleEmitterFillVisualization_fx_globals: return "SimpleSpriteParticleEmitterFillVisualization_fx_globals";
-        case Semantic::SimpleSpriteParticleEmitter_fx_globals: return "SimpleSpriteParticleEmitter_fx_globals";
-        case Semantic::SimpleSpriteParticleFillVisualization: return "SimpleSpriteParticleFillVisualization";
-        case Semantic::SimpleSpriteParticleInWater: return "SimpleSpriteParticleInWater";
-        case Semantic::Simple_VS1_PS2: return "Simple_VS1_PS2";
-        case Semantic::Simple_VS2_PS2: return "Simple_VS2_PS2";
-        case Semantic::Simple_VS3_PS3: return "Simple_VS3_PS3";
-        case Semantic::SingleSided: return "SingleSided";
-        case Semantic::Size: return "Size";
-        case Semantic::Skinned: return "Skinned";
-        case Semantic::SkinnedDepth: return "SkinnedDepth";
-        case Semantic::SkinnedGlowWith1Texture_Tinted: return "SkinnedGlowWith1Texture_Tinted";
-        case Semantic::SkinnedGlowWith2Textures_Tinted: return "SkinnedGlowWith2Textures_Tinted";
-        case Semantic::SkinnedGlowWith3Textures_Tinted: return "SkinnedGlowWith3Textures_Tinted";
-        case Semantic::SkinnedLODTech: return "SkinnedLODTech";
-        case Semantic::SkinnedLODs: return "SkinnedLODs";
-        case Semantic::SkinnedLODs_fx_globals: return "SkinnedLODs_fx_globals";
-        case Semantic::Sky2_VS11_PS0: return "Sky2_VS11_PS0";
-        case Semantic::SkyBox_VS11_PS2: return "SkyBox_VS11_PS2";
-        case Semantic::SkyBox_VS2_PS2: return "SkyBox_VS2_PS2";
-        case Semantic::SkyColor: return "SkyColor";
-        case Semantic::SkyCube: return "SkyCube";
-        case Semantic::SkyCube_fx_globals: return "SkyCube_fx_globals";
-        case Semantic::SkyDepth: return "SkyDepth";
-        case Semantic::SkyDome: return "SkyDome";
-        case Semantic::SkyDome_fx_globals: return "SkyDome_fx_globals";
-        case Semantic::SkyFogShadowsEnabled: return "SkyFogShadowsEnabled";
-        case Semantic::SkyHorizon: return "SkyHorizon";
-        case Semantic::SkyHorizon_fx_globals: return "SkyHorizon_fx_globals";
-        case Semantic::SkyLightCoeff0: return "SkyLightCoeff0";
-        case Semantic::SkyLightCoeff2: return "SkyLightCoeff2";
-        case Semantic::SkyLightCoeff6: return "SkyLightCoeff6";
-        case Semantic::SkyLightEnvmap: return "SkyLightEnvmap";
-        case Semantic::SkyLightProbeColor0: return "SkyLightProbeColor0";
-        case Semantic::SkyLightProbeColor1: return "SkyLightProbeColor1";
-        case Semantic::SkyLightProbeLerp: return "SkyLightProbeLerp";
-        case Semantic::SkyLightProbeLocation0: return "SkyLightProbeLocation0";
-        case Semantic::SkyLightProbeLocation1: return "SkyLightProbeLocation1";
-        case Semantic::SkyLightProbeNormal0: return "SkyLightProbeNormal0";
-        case Semantic::SkyLightProbeNormal1: return "SkyLightProbeNormal1";
-        case Semantic::SkyMask: return "SkyMask";
-        case Semantic::SkyMaskStencilTech: return "SkyMaskStencilTech";
-        case Semantic::SkyMaskStencilTechClear: return "SkyMaskStencilTechClear";
-        case Semantic::SkyMask_fx_globals: return "SkyMask_fx_globals";
-        case Semantic::SkyMesh: return "SkyMesh";
-        case Semantic::SkyMeshBlend: return "SkyMeshBlend";
-        case Semantic::SkyMeshBlend_fx_globals: return "SkyMeshBlend_fx_globals";
-        case Semantic::SkyMesh_fx_globals: return "SkyMesh_fx_globals";
-        case Semantic::SkyRenderMode: return "SkyRenderMode";
-        case Semantic::SkyRenderModes: return "SkyRenderModes";
-        case Semantic::SkyStencilMaskEnabled: return "SkyStencilMaskEnabled";
-        case Semantic::SkyTexture: return "SkyTexture";
-        case Semantic::Sky_VS11_PS0: return "Sky_VS11_PS0";
-        case Semantic::Sky_VS30_PS0: return "Sky_VS30_PS0";
-        case Semantic::Slope: return "Slope";
-        case Semantic::Smoothing: return "Smoothing";
-        case Semantic::Smoothness: return "Smoothness";
-        case Semantic::Softness: return "Softness";
-        case Semantic::SolidModelPosTech: return "SolidModelPosTech";
-        case Semantic::SolidTech: return "SolidTech";
-        case Semantic::Source: return "Source";
-        case Semantic::Source0: return "Source0";
-        case Semantic::Source1: return "Source1";
-        case Semantic::SourceColor: return "SourceColor";
-        case Semantic::SourceColorTexture: return "SourceColorTexture";
-        case Semantic::SourceCube: return "SourceCube";
-        case Semantic::SourceDepth: return "SourceDepth";
-        case Semantic::SourceMip: return "SourceMip";
-        case Semantic::SourceMipLevel: return "SourceMipLevel";
-        case Semantic::SourceTexture: return "SourceTexture";
-        case Semantic::Spacing: return "Spacing";
-        case Semantic::SparkFlowX: return "SparkFlowX";
-        case Semantic::SparkFlowZ: return "SparkFlowZ";
-        case Semantic::SparkMask: return "SparkMask";
-        case Semantic::SparkOpacity: return "SparkOpacity";
-        case Semantic::Spec: return "Spec";
-        case Semantic::SpecB: return "SpecB";
-        case Semantic::SpecBlendNormalYMap: return "SpecBlendNormalYMap";
-        case Semantic::SpecBlendNormalYMap1: return "SpecBlendNormalYMap1";
-        case Semantic::SpecBlendNormalYMap2: return "SpecBlendNormalYMap2";
-        case Semantic::SpecBlendNormalYMap3: return "SpecBlendNormalYMap3";
-        case Semantic::SpecBlendNormalYMap4: return "SpecBlendNormalYMap4";
-        case Semantic::SpecBlendNormalYMap5: return "SpecBlendNormalYMap5";
-        case Semantic::SpecGlow: return "SpecGlow";
-        case Semantic::SpecMap: return "SpecMap";
-        case Semantic::SpecMax: return "SpecMax";
-        case Semantic::SpecMin: return "SpecMin";
-        case Semantic::SpecMinMax1: return "SpecMinMax1";
-        case Semantic::SpecMinMax2: return "SpecMinMax2";
-        case Semantic::SpecMinMax3: return "SpecMinMax3";
-        case Semantic::SpecMinMax4: return "SpecMinMax4";
-        case Semantic::SpecMinMax5: return "SpecMinMax5";
-        case Semantic::SpecSmoothness: return "SpecSmoothness";
-        case Semantic::SpecSmoothnessMax: return "SpecSmoothnessMax";
-        case Semantic::SpecSmoothnessMin: return "SpecSmoothnessMin";
-        case Semantic::Specular: return "Specular";
-        case Semantic::Specularity: return "Specularity";
-        case Semantic::Speed: return "Speed";
-        case Semantic::SplatShadowDepth: return "SplatShadowDepth";
-        case Semantic::SpriteParticle: return "SpriteParticle";
-        case Semantic::SpriteParticleDistortion: return "SpriteParticleDistortion";
-        case Semantic::SpriteParticleEmitter: return "SpriteParticleEmitter";
-        case Semantic::SpriteParticleEmitterDistortion: return "SpriteParticleEmitterDistortion";
-        case Semantic::SpriteParticleEmitterDistortion_fx_globals: return "SpriteParticleEmitterDistortion_fx_globals";
-        case Semantic::SpriteParticleEmitterFillVisualization: return "SpriteParticleEmitterFillVisualization";
-        case Semantic::SpriteParticleEmitterFillVisualization_fx_globals: return "SpriteParticleEmitterFillVisualization_fx_globals";
-        case Semantic::SpriteParticleEmitter_fx_globals: return "SpriteParticleEmitter_fx_globals";
-        case Semantic::SpriteParticleFullRes: return "SpriteParticleFullRes";
-        case Semantic::SpriteParticleFullResInWater: return "SpriteParticleFullResInWater";
-        case Semantic::SpriteParticle_FullRes: return "SpriteParticle_FullRes";
-        case Semantic::Stage: return "Stage";
-        case Semantic::Standard: return "Standard";
-        case Semantic::StandardNoZ: return "StandardNoZ";
-        case Semantic::StarsColor: return "StarsColor";
-        case Semantic::Start: return "Start";
-        case Semantic::StealthBlend: return "StealthBlend";
-        case Semantic::StealthDistortion: return "StealthDistortion";
-        case Semantic::Step: return "Step";
-        case Semantic::StratusCloudHeight: return "StratusCloudHeight";
-        case Semantic::StratusCloudScrollU: return "StratusCloudScrollU";
-        case Semantic::StratusCloudScrollV: return "StratusCloudScrollV";
-        case Semantic::StratusCloudTiling: return "StratusCloudTiling";
-        case Semantic::StreakElasticity: return "StreakElasticity";
-        case Semantic::StreakParticle: return "StreakParticle";
-        case Semantic::StreakParticleInWater: return "StreakParticleInWater";
-        case Semantic::Stream: return "Stream";
-        case Semantic::StreamWater: return "StreamWater";
-        case Semantic::StreamWater_fx_globals: return "StreamWater_fx_globals";
-        case Semantic::Strength: return "Strength";
-        case Semantic::Structure: return "Structure";
-        case Semantic::StructureBlend: return "StructureBlend";
-        case Semantic::StructureBlend_fx_globals: return "StructureBlend_fx_globals";
-        case Semantic::StructureColorInstancedTech: return "StructureColorInstancedTech";
-        case Semantic::StructureColorTech: return "StructureColorTech";
-        case Semantic::StructureDecal: return "StructureDecal";
-        case Semantic::StructureDecal_fx_globals: return "StructureDecal_fx_globals";
-        case Semantic::StructureInstanced: return "StructureInstanced";
-        case Semantic::StructureInstanced_fx_globals: return "StructureInstanced_fx_globals";
-        case Semantic::StructureNoiseTexture: return "StructureNoiseTexture";
-        case Semantic::StructureSkinned: return "StructureSkinned";
-        case Semantic::StructureSkinned_fx_globals: return "StructureSkinned_fx_globals";
-        case Semantic::StructureSnow: return "StructureSnow";
-        case Semantic::StructureSnow_fx_globals: return "StructureSnow_fx_globals";
-        case Semantic::StructureTint: return "StructureTint";
-        case Semantic::StructureTint_fx_globals: return "StructureTint_fx_globals";
-        case Semantic::StructureWsOverlay: return "StructureWsOverlay";
-        case Semantic::StructureWsOverlay_fx_globals: return "StructureWsOverlay_fx_globals";
-        case Semantic::Structure_fx_globals: return "Structure_fx_globals";
-        case Semantic::Structure_rsm: return "Structure_rsm";
-        case Semantic::Structure_rsm_fx_globals: return "Structure_rsm_fx_globals";
-        case Semantic::SubsurfaceOcean: return "SubsurfaceOcean";
-        case Semantic::SubsurfaceRiver: return "SubsurfaceRiver";
-        case Semantic::SubsurfaceStream: return "SubsurfaceStream";
-        case Semantic::SubsurfaceSwamp: return "SubsurfaceSwamp";
-        case Semantic::SunBiasedHorizonGlowColor: return "SunBiasedHorizonGlowColor";
-        case Semantic::SunBiasedHorizonWidthHeightLatSundis: return "SunBiasedHorizonWidthHeightLatSundis";
-        case Semantic::SunDir: return "SunDir";
-        case Semantic::SunFalloffsStarsBlend: return "SunFalloffsStarsBlend";
-        case Semantic::SunGlowColor: return "SunGlowColor";
-        case Semantic::SunLightDeferredShadow: return "SunLightDeferredShadow";
-        case Semantic::SunPosition: return "SunPosition";
-        case Semantic::Surface: return "Surface";
-        case Semantic::SurfaceMap: return "SurfaceMap";
-        case Semantic::SurfaceScale: return "SurfaceScale";
-        case Semantic::SurfaceTexture: return "SurfaceTexture";
-        case Semantic::Sv5: return "Sv5";
-        case Semantic::Swamp: return "Swamp";
-        case Semantic::Sway: return "Sway";
-        case Semantic::SwayBoilSpeed: return "SwayBoilSpeed";
-        case Semantic::SwayDir: return "SwayDir";
-        case Semantic::SwayPrevBoilSpeed: return "SwayPrevBoilSpeed";
-        case Semantic::SwayPrevSpeed: return "SwayPrevSpeed";
-        case Semantic::SwayScale: return "SwayScale";
-        case Semantic::SwaySmoothing: return "SwaySmoothing";
-        case Semantic::SwaySpeed: return "SwaySpeed";
-        case Semantic::SwayStrength: return "SwayStrength";
-        case Semantic::T: return "T";
-        case Semantic::T6m: return "T6m";
-        case Semantic::TA: return "TA";
-        case Semantic::TANGENT: return "TANGENT";
-        case Semantic::TEXCOORD: return "TEXCOORD";
-        case Semantic::TankTread: return "TankTread";
-        case Semantic::TankTread_fx_globals: return "TankTread_fx_globals";
-        case Semantic::TargetColorTexture: return "TargetColorTexture";
-        case Semantic::TargetDepthTexture: return "TargetDepthTexture";
-        case Semantic::TdDj: return "TdDj";
-        case Semantic::Technique1: return "Technique1";
-        case Semantic::Terrain1LayerLod: return "Terrain1LayerLod";
-        case Semantic::Terrain1LayerLod_fx_globals: return "Terrain1LayerLod_fx_globals";
-        case Semantic::Terrain2LayerLod: return "Terrain2LayerLod";
-        case Semantic::Terrain2LayerLod_fx_globals: return "Terrain2LayerLod_fx_globals";
-        case Semantic::Terrain3LayerLod: return "Terrain3LayerLod";
-        case Semantic::Terrain3LayerLod_fx_globals: return "Terrain3LayerLod_fx_globals";
-        case Semantic::Terrain4LayerLod: return "Terrain4LayerLod";
-        case Semantic::Terrain4LayerLod_fx_globals: return "Terrain4LayerLod_fx_globals";
-        case Semantic::Terrain5LayerLod: return "Terrain5LayerLod";
-        case Semantic::Terrain5LayerLod_fx_globals: return "Terrain5LayerLod_fx_globals";
-        case Semantic::Terrain5Layer_VS3_PS3: return "Terrain5Layer_VS3_PS3";
-        case Semantic::TerrainAuditHeatmask: return "TerrainAuditHeatmask";
-        case Semantic::TerrainAudit_DX6_VS1_PS0: return "TerrainAudit_DX6_VS1_PS0";
-        case Semantic::TerrainLodTile: return "TerrainLodTile";
-        case Semantic::TerrainLodTile_fx_globals: return "TerrainLodTile_fx_globals";
-        case Semantic::TerrainLod_depth: return "TerrainLod_depth";
-        case Semantic::TerrainLod_depth_fx_globals: return "TerrainLod_depth_fx_globals";
-        case Semantic::TerrainRSM_VS3_PS3: return "TerrainRSM_VS3_PS3";
-        case Semantic::TerrainTile: return "TerrainTile";
-        case Semantic::TerrainTile_depth: return "TerrainTile_depth";
-        case Semantic::TerrainTile_depth_fx_globals: return "TerrainTile_depth_fx_globals";
-        case Semantic::TerrainTile_fx_globals: return "TerrainTile_fx_globals";
-        case Semantic::Terrain_VS2_PS2: return "Terrain_VS2_PS2";
-        case Semantic::TessellationEnable: return "TessellationEnable";
-        case Semantic::TexOffset: return "TexOffset";
-        case Semantic::TexOffset2: return "TexOffset2";
-        case Semantic::TexOffset3: return "TexOffset3";
-        case Semantic::TexOffset4: return "TexOffset4";
-        case Semantic::TexScale1: return "TexScale1";
-        case Semantic::TexScale2: return "TexScale2";
-        case Semantic::TexScale3: return "TexScale3";
-        case Semantic::TexScrollU1: return "TexScrollU1";
-        case Semantic::TexScrollU2: return "TexScrollU2";
-        case Semantic::TexScrollU3: return "TexScrollU3";
-        case Semantic::TexScrollV1: return "TexScrollV1";
-        case Semantic::TexScrollV2: return "TexScrollV2";
-        case Semantic::TexScrollV3: return "TexScrollV3";
-        case Semantic::TexScrollX1: return "TexScrollX1";
-        case Semantic::TexScrollX2: return "TexScrollX2";
-        case Semantic::TexScrollX3: return "TexScrollX3";
-        case Semantic::TexScrollZ1: return "TexScrollZ1";
-        case Semantic::TexScrollZ2: return "TexScrollZ2";
-        case Semantic::TexScrollZ3: return "TexScrollZ3";
-        case Semantic::TexStretch: return "TexStretch";
-        case Semantic::TexStretch2: return "TexStretch2";
-        case Semantic::TexStretch3: return "TexStretch3";
-        case Semantic::TexStretch4: return "TexStretch4";
-        case Semantic::Texture: return "Texture";
-        case Semantic::Texture1: return "Texture1";
-        case Semantic::Texture2: return "Texture2";
-        case Semantic::Texture3: return "Texture3";
-        case Semantic::TextureFile: return "TextureFile";
-        case Semantic::TextureMap: return "TextureMap";
-        case Semantic::TextureType: return "TextureType";
-        case Semantic::ThermalAdjustToLighting: return "ThermalAdjustToLighting";
-        case Semantic::ThermalCold: return "ThermalCold";
-        case Semantic::ThermalColor: return "ThermalColor";
-        case Semantic::ThermalHot: return "ThermalHot";
-        case Semantic::ThermalViewFade: return "ThermalViewFade";
-        case Semantic::ThermalViewRange: return "ThermalViewRange";
-        case Semantic::Thickness: return "Thickness";
-        case Semantic::TileQuad: return "TileQuad";
-        case Semantic::TileQuad_fx_globals: return "TileQuad_fx_globals";
-        case Semantic::Tiling: return "Tiling";
-        case Semantic::TilingOverlay: return "TilingOverlay";
-        case Semantic::TilingOverlayB: return "TilingOverlayB";
-        case Semantic::TilingOverlayMask: return "TilingOverlayMask";
-        case Semantic::TilingScaleB: return "TilingScaleB";
-        case Semantic::TilingTint: return "TilingTint";
-        case Semantic::TilingTintHighlight: return "TilingTintHighlight";
-        case Semantic::TilingTintHighlight_StructureTint: return "TilingTintHighlight_StructureTint";
-        case Semantic::TilingTintMidtone: return "TilingTintMidtone";
-        case Semantic::TilingTintMidtone_StructureTint: return "TilingTintMidtone_StructureTint";
-        case Semantic::TilingTintOpacity: return "TilingTintOpacity";
-        case Semantic::TilingTintOpacity_StructureTint: return "TilingTintOpacity_StructureTint";
-        case Semantic::TilingTintRotation: return "TilingTintRotation";
-        case Semantic::TilingTintScale: return "TilingTintScale";
-        case Semantic::TilingTintScale_StructureTint: return "TilingTintScale_StructureTint";
-        case Semantic::TilingTintShadow: return "TilingTintShadow";
-        case Semantic::TilingTintShadow_StructureTint: return "TilingTintShadow_StructureTint";
-        case Semantic::TilingTintTranslation: return "TilingTintTranslation";
-        case Semantic::TilingTint_StructureTint: return "TilingTint_StructureTint";
-        case Semantic::Timer: return "Timer";
-        case Semantic::Tint: return "Tint";
-        case Semantic::Tint1: return "Tint1";
-        case Semantic::Tint2: return "Tint2";
-        case Semantic::Tint3: return "Tint3";
-        case Semantic::TintAlpha: return "TintAlpha";
-        case Semantic::TintMask: return "TintMask";
-        case Semantic::TintSemantic: return "TintSemantic";
-        case Semantic::TintedDeRes: return "TintedDeRes";
-        case Semantic::ToneMapLowEnd: return "ToneMapLowEnd";
-        case Semantic::ToneMapLowEnd_fx_globals: return "ToneMapLowEnd_fx_globals";
-        case Semantic::ToolPrimitive2D: return "ToolPrimitive2D";
-        case Semantic::ToolPrimitive2DTex: return "ToolPrimitive2DTex";
-        case Semantic::ToolPrimitive3D: return "ToolPrimitive3D";
-        case Semantic::ToolPrimitive3DNoZTest: return "ToolPrimitive3DNoZTest";
-        case Semantic::ToolPrimitive3DTex: return "ToolPrimitive3DTex";
-        case Semantic::ToolPrimitive3DTexNoZTest: return "ToolPrimitive3DTexNoZTest";
-        case Semantic::ToolPrimitive3D_fx_globals: return "ToolPrimitive3D_fx_globals";
-        case Semantic::TopFrame: return "TopFrame";
-        case Semantic::TrailParticle: return "TrailParticle";
-        case Semantic::TrailParticleEmitter: return "TrailParticleEmitter";
-        case Semantic::TrailParticleEmitterDistortion: return "TrailParticleEmitterDistortion";
-        case Semantic::TrailParticleEmitterDistortion_fx_globals: return "TrailParticleEmitterDistortion_fx_globals";
-        case Semantic::TrailParticleEmitterFillVisualization: return "TrailParticleEmitterFillVisualization";
-        case Semantic::TrailParticleEmitterFillVisualization_fx_globals: return "TrailParticleEmitterFillVisualization_fx_globals";
-        case Semantic::TrailParticleEmitter_fx_globals: return "TrailParticleEmitter_fx_globals";
-        case Semantic::TrailParticleFillVisualization: return "TrailParticleFillVisualization";
-        case Semantic::TrailParticleFullRes: return "TrailParticleFullRes";
-        case Semantic::TrailParticleFullResInWater: return "TrailParticleFullResInWater";
-        case Semantic::Transition: return "Transition";
-        case Semantic::TransitionDirection: return "TransitionDirection";
-        case Semantic::TransitionOffset: return "TransitionOffset";
-        case Semantic::TransitionSharpness: return "TransitionSharpness";
-        case Semantic::TransitionWidth: return "TransitionWidth";
-        case Semantic::Translation: return "Translation";
-        case Semantic::Transmittance: return "Transmittance";
-        case Semantic::Transparency: return "Transparency";
-        case Semantic::TransparentDepth: return "TransparentDepth";
-        case Semantic::Trunk: return "Trunk";
-        case Semantic::TrunkInstanced: return "TrunkInstanced";
-        case Semantic::TrunkInstanced_fx_globals: return "TrunkInstanced_fx_globals";
-        case Semantic::Trunk_fx_globals: return "Trunk_fx_globals";
-        case Semantic::TurbulenceBoilSpeed: return "TurbulenceBoilSpeed";
-        case Semantic::TurbulenceDensityRange: return "TurbulenceDensityRange";
-        case Semantic::TurbulenceDirection: return "TurbulenceDirection";
-        case Semantic::TurbulenceEnable: return "TurbulenceEnable";
-        case Semantic::TurbulenceScale: return "TurbulenceScale";
-        case Semantic::TurbulenceSpeed: return "TurbulenceSpeed";
-        case Semantic::TwoSided: return "TwoSided";
-        case Semantic::TwoSidedInstanced: return "TwoSidedInstanced";
-        case Semantic::TwoSidedInstanced_fx_globals: return "TwoSidedInstanced_fx_globals";
-        case Semantic::TwoSidedRigidLODs: return "TwoSidedRigidLODs";
-        case Semantic::TwoSidedRigidLODs_fx_globals: return "TwoSidedRigidLODs_fx_globals";
-        case Semantic::TwoSidedSway_depth: return "TwoSidedSway_depth";
-        case Semantic::TwoSidedSway_depth_fx_globals: return "TwoSidedSway_depth_fx_globals";
-        case Semantic::TwoSided_Depth: return "TwoSided_Depth";
-        case Semantic::TwoSided_Depth_fx_globals: return "TwoSided_Depth_fx_globals";
-        case Semantic::TwoSided_fx_globals: return "TwoSided_fx_globals";
-        case Semantic::U: return "U";
-        case Semantic::U3: return "U3";
-        case Semantic::UB1: return "UB1";
-        case Semantic::UB_: return "UB_";
-        case Semantic::UBg: return "UBg";
-        case Semantic::UIGroup: return "UIGroup";
-        case Semantic::UIMax: return "UIMax";
-        case Semantic::UIMin: return "UIMin";
-        case Semantic::UIName: return "UIName";
-        case Semantic::UIWidget: return "UIWidget";
-        case Semantic::UK5E: return "UK5E";
-        case Semantic::UL: return "UL";
-        case Semantic::UP: return "UP";
-        case Semantic::UUU: return "UUU";
-        case Semantic::UV: return "UV";
-        case Semantic::UV0: return "UV0";
-        case Semantic::UV1: return "UV1";
-        case Semantic::UV2: return "UV2";
-        case Semantic::UVOffset: return "UVOffset";
-        case Semantic::UVScale: return "UVScale";
-        case Semantic::UVSet: return "UVSet";
-        case Semantic::UVs: return "UVs";
-        case Semantic::UVsPerMeter0: return "UVsPerMeter0";
-        case Semantic::UVsPerMeter1: return "UVsPerMeter1";
-        case Semantic::UVsPerMeter2: return "UVsPerMeter2";
-        case Semantic::UVsPerMeter3: return "UVsPerMeter3";
-        case Semantic::Use: return "Use";
-        case Semantic::UseDynamicWaterReflection: return "UseDynamicWaterReflection";
-        case Semantic::UseUV0ForDetailBump: return "UseUV0ForDetailBump";
-        case Semantic::UseUV1ForOverlayMask: return "UseUV1ForOverlayMask";
-        case Semantic::V: return "V";
-        case Semantic::V11_P20: return "V11_P20";
-        case Semantic::V8q: return "V8q";
-        case Semantic::VU: return "VU";
-        case Semantic::Vehicle: return "Vehicle";
-        case Semantic::Vehicle_fx_globals: return "Vehicle_fx_globals";
-        case Semantic::VertexAlignment: return "VertexAlignment";
-        case Semantic::Vertical: return "Vertical";
-        case Semantic::VirtualReality: return "VirtualReality";
-        case Semantic::Visibility: return "Visibility";
-        case Semantic::VisibleSkyIntensity: return "VisibleSkyIntensity";
-        case Semantic::VisualizerColor: return "VisualizerColor";
-        case Semantic::VisualizerForeground: return "VisualizerForeground";
-        case Semantic::Volatile: return "Volatile";
-        case Semantic::W: return "W";
-        case Semantic::W1H: return "W1H";
-        case Semantic::WX: return "WX";
-        case Semantic::WarpMode: return "WarpMode";
-        case Semantic::Water2013: return "Water2013";
-        case Semantic::Water2013_fx_globals: return "Water2013_fx_globals";
-        case Semantic::WaterColor: return "WaterColor";
-        case Semantic::WaterColorTech: return "WaterColorTech";
-        case Semantic::WaterColor_fx_globals: return "WaterColor_fx_globals";
-        case Semantic::WaterDepth: return "WaterDepth";
-        case Semantic::WaterDepthBuffer: return "WaterDepthBuffer";
-        case Semantic::WaterDepthOnly: return "WaterDepthOnly";
-        case Semantic::WaterDepthStream: return "WaterDepthStream";
-        case Semantic::WaterHeight: return "WaterHeight";
-        case Semantic::WaterReflection: return "WaterReflection";
-        case Semantic::WaterReflectionHeight: return "WaterReflectionHeight";
-        case Semantic::WaterTiling: return "WaterTiling";
-        case Semantic::Water_V11_P11: return "Water_V11_P11";
-        case Semantic::Waters: return "Waters";
-        case Semantic::Wave: return "Wave";
-        case Semantic::WaveScrollU: return "WaveScrollU";
-        case Semantic::WaveScrollV: return "WaveScrollV";
-        case Semantic::WeatherEnabled: return "WeatherEnabled";
-        case Semantic::White: return "White";
-        case Semantic::Width: return "Width";
-        case Semantic::Wind: return "Wind";
-        case Semantic::WireFrame: return "WireFrame";
-        case Semantic::Wm: return "Wm";
-        case Semantic::World: return "World";
-        case Semantic::WorldMatrix: return "WorldMatrix";
-        case Semantic::WorldNormalMap: return "WorldNormalMap";
-        case Semantic::WorldScale: return "WorldScale";
-        case Semantic::Worldspace: return "Worldspace";
-        case Semantic::WriteAlpha: return "WriteAlpha";
-        case Semantic::X: return "X";
-        case Semantic::XGdi: return "XGdi";
-        case Semantic::XJ: return "XJ";
-        case Semantic::XR: return "XR";
-        case Semantic::XRayGrid: return "XRayGrid";
-        case Semantic::XRayGrid_fx_globals: return "XRayGrid_fx_globals";
-        case Semantic::Y: return "Y";
-        case Semantic::Y96O: return "Y96O";
-        case Semantic::YawPitchRollFace: return "YawPitchRollFace";
-        case Semantic::YeHU: return "YeHU";
-        case Semantic::Yf4: return "Yf4";
-        case Semantic::Yk: return "Yk";
-        case Semantic::Z: return "Z";
-        case Semantic::ZBuffer: return "ZBuffer";
-        case Semantic::ZBufferStructures: return "ZBufferStructures";
-        case Semantic::Zoom: return "Zoom";
-        case Semantic::_AmbientLightColor: return "_AmbientLightColor";
-        case Semantic::_Ax2: return "_Ax2";
-        case Semantic::_Bones: return "_Bones";
-        case Semantic::_C: return "_C";
-        case Semantic::_Camera: return "_Camera";
-        case Semantic::_DirectionalLightColor: return "_DirectionalLightColor";
-        case Semantic::_DirectionalLightViewSpaceDir: return "_DirectionalLightViewSpaceDir";
-        case Semantic::_DynamicResolutionScale: return "_DynamicResolutionScale";
-        case Semantic::_EmissiveCorrectionLimit: return "_EmissiveCorrectionLimit";
-        case Semantic::_EmissiveCorrectionScale: return "_EmissiveCorrectionScale";
-        case Semantic::_EyePosition: return "_EyePosition";
-        case Semantic::_FarClip: return "_FarClip";
-        case Semantic::_InvProjection: return "_InvProjection";
-        case Semantic::_InvTargetSize: return "_InvTargetSize";
-        case Semantic::_JitterOffset: return "_JitterOffset";
-        case Semantic::_NearClip: return "_NearClip";
-        case Semantic::_PrevBones: return "_PrevBones";
-        case Semantic::_PrevProjection: return "_PrevProjection";
-        case Semantic::_PrevView: return "_PrevView";
-        case Semantic::_PrevViewProj: return "_PrevViewProj";
-        case Semantic::_PrevVirtualView: return "_PrevVirtualView";
-        case Semantic::_PrevVirtualViewOffset: return "_PrevVirtualViewOffset";
-        case Semantic::_PrevWorld: return "_PrevWorld";
-        case Semantic::_Projection: return "_Projection";
-        case Semantic::_Random: return "_Random";
-        case Semantic::_RenderLevel: return "_RenderLevel";
-        case Semantic::_StreakTimeStep: return "_StreakTimeStep";
-        case Semantic::_Submerged: return "_Submerged";
-        case Semantic::_TAAEnabled: return "_TAAEnabled";
-        case Semantic::_TargetSize: return "_TargetSize";
-        case Semantic::_Time: return "_Time";
-        case Semantic::_TimeStep: return "_TimeStep";
-        case Semantic::_UnjitteredProjection: return "_UnjitteredProjection";
-        case Semantic::_View: return "_View";
-        case Semantic::_ViewProj: return "_ViewProj";
-        case Semantic::_VirtualCameraOffset: return "_VirtualCameraOffset";
-        case Semantic::_VirtualView: return "_VirtualView";
-        case Semantic::_VirtualViewOffset: return "_VirtualViewOffset";
-        case Semantic::_WhitePoint: return "_WhitePoint";
-        case Semantic::_World: return "_World";
-        case Semantic::aColors: return "aColors";
-        case Semantic::a_fAOSharpness: return "a_fAOSharpness";
-        case Semantic::a_fAOSize: return "a_fAOSize";
-        case Semantic::a_m43World: return "a_m43World";
-        case Semantic::a_m44World: return "a_m44World";
-        case Semantic::a_nAOEnable: return "a_nAOEnable";
-        case Semantic::a_nAlphaBlend: return "a_nAlphaBlend";
-        case Semantic::albedoTexture: return "albedoTexture";
-        case Semantic::alpha: return "alpha";
-        case Semantic::alphaEnabled: return "alphaEnabled";
-        case Semantic::ambient: return "ambient";
-        case Semantic::ambientOcclusion: return "ambientOcclusion";
-        case Semantic::ambientOcclusionUpsample: return "ambientOcclusionUpsample";
-        case Semantic::ambientOcclusionUpsample_fx_globals: return "ambientOcclusionUpsample_fx_globals";
-        case Semantic::ambientOcclusion_fx_globals: return "ambientOcclusion_fx_globals";
-        case Semantic::auBlackShiftStrength: return "auBlackShiftStrength";
-        case Semantic::auBumpClean: return "auBumpClean";
-        case Semantic::auBumpStrength: return "auBumpStrength";
-        case Semantic::auColorShiftStrength: return "auColorShiftStrength";
-        case Semantic::auDielectricMax: return "auDielectricMax";
-        case Semantic::auDielectricMin: return "auDielectricMin";
-        case Semantic::auEmissiveScale: return "auEmissiveScale";
-        case Semantic::auEmissiveSlope: return "auEmissiveSlope";
-        case Semantic::auMetallicMax: return "auMetallicMax";
-        case Semantic::auMetallicMin: return "auMetallicMin";
-        case Semantic::auNoiseBoilSpeed: return "auNoiseBoilSpeed";
-        case Semantic::auNoiseDriftSpeed: return "auNoiseDriftSpeed";
-        case Semantic::auNoiseScale: return "auNoiseScale";
-        case Semantic::auSmoothnessMax: return "auSmoothnessMax";
-        case Semantic::auSmoothnessMin: return "auSmoothnessMin";
-        case Semantic::auditColors: return "auditColors";
-        case Semantic::auditHeatmask: return "auditHeatmask";
-        case Semantic::back: return "back";
-        case Semantic::base: return "base";
-        case Semantic::baseDiffuse: return "baseDiffuse";
-        case Semantic::beamParticle: return "beamParticle";
-        case Semantic::beamParticle_fx_globals: return "beamParticle_fx_globals";
-        case Semantic::beam_mask: return "beam_mask";
-        case Semantic::blackPoint: return "blackPoint";
-        case Semantic::blendStrength: return "blendStrength";
-        case Semantic::bloom: return "bloom";
-        case Semantic::bloom_fx_globals: return "bloom_fx_globals";
-        case Semantic::bloomblur: return "bloomblur";
-        case Semantic::bloomblur_fx_globals: return "bloomblur_fx_globals";
-        case Semantic::blur: return "blur";
-        case Semantic::blurSource: return "blurSource";
-        case Semantic::blur_fx_globals: return "blur_fx_globals";
-        case Semantic::boil: return "boil";
-        case Semantic::both: return "both";
-        case Semantic::brightness: return "brightness";
-        case Semantic::bumpMap: return "bumpMap";
-        case Semantic::bumpTexture: return "bumpTexture";
-        case Semantic::camera: return "camera";
-        case Semantic::caustic: return "caustic";
-        case Semantic::caustics: return "caustics";
-        case Semantic::cloud_fxh: return "cloud_fxh";
-        case Semantic::clover: return "clover";
-        case Semantic::clover_N: return "clover_N";
-        case Semantic::cm: return "cm";
-        case Semantic::color: return "color";
-        case Semantic::colorMap: return "colorMap";
-        case Semantic::colorMapCube: return "colorMapCube";
-        case Semantic::colorTexture: return "colorTexture";
-        case Semantic::color_override: return "color_override";
-        case Semantic::colorkey_identity: return "colorkey_identity";
-        case Semantic::common_fxh: return "common_fxh";
-        case Semantic::contribution: return "contribution";
-        case Semantic::coordinates: return "coordinates";
-        case Semantic::cube: return "cube";
-        case Semantic::dark: return "dark";
-        case Semantic::daylightCompensator: return "daylightCompensator";
-        case Semantic::dds: return "dds";
-        case Semantic::debugColors: return "debugColors";
-        case Semantic::debugLod: return "debugLod";
-        case Semantic::debug_font: return "debug_font";
-        case Semantic::decal: return "decal";
-        case Semantic::densityTexture: return "densityTexture";
-        case Semantic::depthBias: return "depthBias";
-        case Semantic::depthSource: return "depthSource";
-        case Semantic::depthTexture: return "depthTexture";
-        case Semantic::deres_fxh: return "deres_fxh";
-        case Semantic::detail: return "detail";
-        case Semantic::detailBlendTexture: return "detailBlendTexture";
-        case Semantic::detailBlendTexture1: return "detailBlendTexture1";
-        case Semantic::detailBlendTexture2: return "detailBlendTexture2";
-        case Semantic::detailBlendTexture3: return "detailBlendTexture3";
-        case Semantic::detailBlendTexture4: return "detailBlendTexture4";
-        case Semantic::detailBlendTexture5: return "detailBlendTexture5";
-        case Semantic::detailBump: return "detailBump";
-        case Semantic::detailMaskTexture: return "detailMaskTexture";
-        case Semantic::detailMaskUsageOrder: return "detailMaskUsageOrder";
-        case Semantic::detailScale: return "detailScale";
-        case Semantic::detailScale5: return "detailScale5";
-        case Semantic::detailTexture: return "detailTexture";
-        case Semantic::different: return "different";
-        case Semantic::diffuse2Texture: return "diffuse2Texture";
-        case Semantic::diffuseTexture: return "diffuseTexture";
-        case Semantic::dirblur: return "dirblur";
-        case Semantic::direction: return "direction";
-        case Semantic::directional: return "directional";
-        case Semantic::disables: return "disables";
-        case Semantic::distortion: return "distortion";
-        case Semantic::distortionFixup: return "distortionFixup";
-        case Semantic::downsampleDepth: return "downsampleDepth";
-        case Semantic::drift: return "drift";
-        case Semantic::e_Texture: return "e_Texture";
-        case Semantic::elasticity: return "elasticity";
-        case Semantic::emissive: return "emissive";
-        case Semantic::enabled: return "enabled";
-        case Semantic::ev: return "ev";
-        case Semantic::eye: return "eye";
-        case Semantic::f: return "f";
-        case Semantic::fLodNearDistance: return "fLodNearDistance";
-        case Semantic::fPositionScale: return "fPositionScale";
-        case Semantic::fRcpLodRange: return "fRcpLodRange";
-        case Semantic::fReplication: return "fReplication";
-        case Semantic::filldepth: return "filldepth";
-        case Semantic::filldepth_fx_globals: return "filldepth_fx_globals";
-        case Semantic::flare: return "flare";
-        case Semantic::flare_fx_globals: return "flare_fx_globals";
-        case Semantic::float2: return "float2";
-        case Semantic::float3: return "float3";
-        case Semantic::float4: return "float4";
-        case Semantic::float4x3: return "float4x3";
-        case Semantic::float4x4: return "float4x4";
-        case Semantic::flora: return "flora";
-        case Semantic::floraModel: return "floraModel";
-        case Semantic::floraModelInstanced: return "floraModelInstanced";
-        case Semantic::floraModelInstanced_fx_globals: return "floraModelInstanced_fx_globals";
-        case Semantic::floraModel_fx_globals: return "floraModel_fx_globals";
-        case Semantic::floraModel_rsm: return "floraModel_rsm";
-        case Semantic::floraModel_rsm_fx_globals: return "floraModel_rsm_fx_globals";
-        case Semantic::flora_fx_globals: return "flora_fx_globals";
-        case Semantic::flora_fxh: return "flora_fxh";
-        case Semantic::floramodel_fx: return "floramodel_fx";
-        case Semantic::floramodelinstanced_fx: return "floramodelinstanced_fx";
-        case Semantic::foam: return "foam";
-        case Semantic::foam_NRM: return "foam_NRM";
-        case Semantic::fogAngleColorGradientTexture: return "fogAngleColorGradientTexture";
-        case Semantic::fogDepthColorGradientTexture: return "fogDepthColorGradientTexture";
-        case Semantic::fogLowEnd: return "fogLowEnd";
-        case Semantic::fogLowEnd_fx_globals: return "fogLowEnd_fx_globals";
-        case Semantic::fogMap: return "fogMap";
-        case Semantic::fog_fx_globals: return "fog_fx_globals";
-        case Semantic::fog_fxh: return "fog_fxh";
-        case Semantic::fogblur: return "fogblur";
-        case Semantic::fogblur_fx_globals: return "fogblur_fx_globals";
-        case Semantic::foliage_fx: return "foliage_fx";
-        case Semantic::foliageglowscroll_fx: return "foliageglowscroll_fx";
-        case Semantic::foliageglowscrollinstanced_fx: return "foliageglowscrollinstanced_fx";
-        case Semantic::foliageinstanced_fx: return "foliageinstanced_fx";
-        case Semantic::foliagesinglesided_fx: return "foliagesinglesided_fx";
-        case Semantic::fontPrimitive: return "fontPrimitive";
-        case Semantic::fontPrimitiveScreenSpace: return "fontPrimitiveScreenSpace";
-        case Semantic::fontPrimitive_fx_globals: return "fontPrimitive_fx_globals";
-        case Semantic::forcefield_fxh: return "forcefield_fxh";
-        case Semantic::forcefieldcolor_fx: return "forcefieldcolor_fx";
-        case Semantic::forcefieldcolor_planar_fx: return "forcefieldcolor_planar_fx";
-        case Semantic::format: return "format";
-        case Semantic::frameCount: return "frameCount";
-        case Semantic::fresnel_func: return "fresnel_func";
-        case Semantic::front: return "front";
-        case Semantic::g_Accumulate: return "g_Accumulate";
-        case Semantic::g_AlphaContrast: return "g_AlphaContrast";
-        case Semantic::g_Ascroll1_U: return "g_Ascroll1_U";
-        case Semantic::g_Ascroll1_V: return "g_Ascroll1_V";
-        case Semantic::g_Ascroll2_U: return "g_Ascroll2_U";
-        case Semantic::g_Ascroll2_V: return "g_Ascroll2_V";
-        case Semantic::g_Ascroll3_U: return "g_Ascroll3_U";
-        case Semantic::g_Ascroll3_V: return "g_Ascroll3_V";
-        case Semantic::g_BackFaceFadeDis: return "g_BackFaceFadeDis";
-        case Semantic::g_BackGroundOpacity: return "g_BackGroundOpacity";
-        case Semantic::g_Background: return "g_Background";
-        case Semantic::g_BackgroundAlpha: return "g_BackgroundAlpha";
-        case Semantic::g_BackgroundBoost: return "g_BackgroundBoost";
-        case Semantic::g_BackgroundColor: return "g_BackgroundColor";
-        case Semantic::g_BacksideBlur: return "g_BacksideBlur";
-        case Semantic::g_BacksideDesat: return "g_BacksideDesat";
-        case Semantic::g_BacksideSpec: return "g_BacksideSpec";
-        case Semantic::g_BaseDiffuseTexture: return "g_BaseDiffuseTexture";
-        case Semantic::g_BiasNormals: return "g_BiasNormals";
-        case Semantic::g_BlendMaskTexture: return "g_BlendMaskTexture";
-        case Semantic::g_BloomBlurStages: return "g_BloomBlurStages";
-        case Semantic::g_BlurIntensity: return "g_BlurIntensity";
-        case Semantic::g_Boost: return "g_Boost";
-        case Semantic::g_Boost1: return "g_Boost1";
-        case Semantic::g_Boost2: return "g_Boost2";
-        case Semantic::g_Boost3: return "g_Boost3";
-        case Semantic::g_Brightness: return "g_Brightness";
-        case Semantic::g_BumpTexture: return "g_BumpTexture";
-        case Semantic::g_CameraShakeDir: return "g_CameraShakeDir";
-        case Semantic::g_CausticsNMTexture: return "g_CausticsNMTexture";
-        case Semantic::g_CausticsTexture: return "g_CausticsTexture";
-        case Semantic::g_ColdLavaTexture: return "g_ColdLavaTexture";
-        case Semantic::g_ColdLavaTiling: return "g_ColdLavaTiling";
-        case Semantic::g_ColdRoll: return "g_ColdRoll";
-        case Semantic::g_Color: return "g_Color";
-        case Semantic::g_ColorBlend: return "g_ColorBlend";
-        case Semantic::g_ColorScale: return "g_ColorScale";
-        case Semantic::g_ColorScrollU: return "g_ColorScrollU";
-        case Semantic::g_ColorScrollV: return "g_ColorScrollV";
-        case Semantic::g_CornerFrame: return "g_CornerFrame";
-        case Semantic::g_DamageA: return "g_DamageA";
-        case Semantic::g_DamageB: return "g_DamageB";
-        case Semantic::g_DamageCubeTexture: return "g_DamageCubeTexture";
-        case Semantic::g_DecalMainUV: return "g_DecalMainUV";
-        case Semantic::g_DecalTintHighlight: return "g_DecalTintHighlight";
-        case Semantic::g_DecalTintMidtone: return "g_DecalTintMidtone";
-        case Semantic::g_DecalTintRotation: return "g_DecalTintRotation";
-        case Semantic::g_DecalTintScale: return "g_DecalTintScale";
-        case Semantic::g_DecalTintShadow: return "g_DecalTintShadow";
-        case Semantic::g_DecalTintTexture: return "g_DecalTintTexture";
-        case Semantic::g_DecalTintTranslation: return "g_DecalTintTranslation";
-        case Semantic::g_DecalUVSet: return "g_DecalUVSet";
-        case Semantic::g_DepthImpact: return "g_DepthImpact";
-        case Semantic::g_DepthOfFieldTransition: return "g_DepthOfFieldTransition";
-        case Semantic::g_DetailBumpTexture: return "g_DetailBumpTexture";
-        case Semantic::g_DetailBumpiness: return "g_DetailBumpiness";
-        case Semantic::g_DetailBumpinessB: return "g_DetailBumpinessB";
-        case Semantic::g_DetailFreq: return "g_DetailFreq";
-        case Semantic::g_DetailFreqB: return "g_DetailFreqB";
-        case Semantic::g_DetailMaskTexture: return "g_DetailMaskTexture";
-        case Semantic::g_DetailScale: return "g_DetailScale";
-        case Semantic::g_DetailSelectB: return "g_DetailSelectB";
-        case Semantic::g_DiffuseBTexture: return "g_DiffuseBTexture";
-        case Semantic::g_DistortionLameScale: return "g_DistortionLameScale";
-        case Semantic::g_DizzyIntensity: return "g_DizzyIntensity";
-        case Semantic::g_E3Blur: return "g_E3Blur";
-        case Semantic::g_E3Brightness: return "g_E3Brightness";
-        case Semantic::g_E3Desat: return "g_E3Desat";
-        case Semantic::g_EmissiveIsTransB: return "g_EmissiveIsTransB";
-        case Semantic::g_EmissiveTexture: return "g_EmissiveTexture";
-        case Semantic::g_EmpireTintA: return "g_EmpireTintA";
-        case Semantic::g_EmpireTintB: return "g_EmpireTintB";
-        case Semantic::g_EnableExtraTint: return "g_EnableExtraTint";
-        case Semantic::g_EvComps: return "g_EvComps";
-        case Semantic::g_ExtraTintColorA: return "g_ExtraTintColorA";
-        case Semantic::g_ExtraTintColorB: return "g_ExtraTintColorB";
-        case Semantic::g_ExtraTintOpacity: return "g_ExtraTintOpacity";
-        case Semantic::g_ExtraTintScale: return "g_ExtraTintScale";
-        case Semantic::g_ExtraTintTexture: return "g_ExtraTintTexture";
-        case Semantic::g_FFColorAutoTileFreq: return "g_FFColorAutoTileFreq";
-        case Semantic::g_FFColorColorMapScrollX: return "g_FFColorColorMapScrollX";
-        case Semantic::g_FFColorColorMapScrollY: return "g_FFColorColorMapScrollY";
-        case Semantic::g_FFColorColorMapTiling: return "g_FFColorColorMapTiling";
-        case Semantic::g_FFColorColorTexture: return "g_FFColorColorTexture";
-        case Semantic::g_FFColorCoordinateSpace: return "g_FFColorCoordinateSpace";
-        case Semantic::g_FFColorDistortionTexture: return "g_FFColorDistortionTexture";
-        case Semantic::g_FFColorHottness: return "g_FFColorHottness";
-        case Semantic::g_FFColorNoiseAlpha: return "g_FFColorNoiseAlpha";
-        case Semantic::g_FFColorNoiseThickness: return "g_FFColorNoiseThickness";
-        case Semantic::g_FFColorNoiseTiling: return "g_FFColorNoiseTiling";
-        case Semantic::g_FFColorPerlinNoise3DTexture: return "g_FFColorPerlinNoise3DTexture";
-        case Semantic::g_FFColorreduceBloom: return "g_FFColorreduceBloom";
-        case Semantic::g_FFDisPlanarDistortionTexture: return "g_FFDisPlanarDistortionTexture";
-        case Semantic::g_FFDistortionDistortionTexture: return "g_FFDistortionDistortionTexture";
-        case Semantic::g_FFDistortionScaleU: return "g_FFDistortionScaleU";
-        case Semantic::g_FFDistortionScaleV: return "g_FFDistortionScaleV";
-        case Semantic::g_FFDistortionSpeedU: return "g_FFDistortionSpeedU";
-        case Semantic::g_FFDistortionSpeedV: return "g_FFDistortionSpeedV";
-        case Semantic::g_FFPlanarAutoTileFreq: return "g_FFPlanarAutoTileFreq";
-        case Semantic::g_FFPlanarColorMapScrollX: return "g_FFPlanarColorMapScrollX";
-        case Semantic::g_FFPlanarColorMapScrollY: return "g_FFPlanarColorMapScrollY";
-        case Semantic::g_FFPlanarColorMapTiling: return "g_FFPlanarColorMapTiling";
-        case Semantic::g_FFPlanarColorTexture: return "g_FFPlanarColorTexture";
-        case Semantic::g_FFPlanarCoordinateSpace: return "g_FFPlanarCoordinateSpace";
-        case Semantic::g_FFPlanarDistortionTexture: return "g_FFPlanarDistortionTexture";
-        case Semantic::g_FFPlanarHottness: return "g_FFPlanarHottness";
-        case Semantic::g_FFPlanarNoiseAlpha: return "g_FFPlanarNoiseAlpha";
-        case Semantic::g_FFPlanarNoiseThickness: return "g_FFPlanarNoiseThickness";
-        case Semantic::g_FFPlanarNoiseTiling: return "g_FFPlanarNoiseTiling";
-        case Semantic::g_FFPlanarPerlinNoise3DTexture: return "g_FFPlanarPerlinNoise3DTexture";
-        case Semantic::g_FFPlanarreduceBloom: return "g_FFPlanarreduceBloom";
-        case Semantic::g_FadeModelMaterial: return "g_FadeModelMaterial";
-        case Semantic::g_FadeOverride: return "g_FadeOverride";
-        case Semantic::g_FadeTexture: return "g_FadeTexture";
-        case Semantic::g_FlashIntensity: return "g_FlashIntensity";
-        case Semantic::g_FlimmeringAdjustment: return "g_FlimmeringAdjustment";
-        case Semantic::g_FoamBrightness: return "g_FoamBrightness";
-        case Semantic::g_FoamColor: return "g_FoamColor";
-        case Semantic::g_FoamEnd: return "g_FoamEnd";
-        case Semantic::g_FoamNormalTexture: return "g_FoamNormalTexture";
-        case Semantic::g_FoamScale: return "g_FoamScale";
-        case Semantic::g_FoamScrollU: return "g_FoamScrollU";
-        case Semantic::g_FoamScrollV: return "g_FoamScrollV";
-        case Semantic::g_FoamStart: return "g_FoamStart";
-        case Semantic::g_FoamTexture: return "g_FoamTexture";
-        case Semantic::g_FogOfWarParams: return "g_FogOfWarParams";
-        case Semantic::g_ForceFieldBGOpacity: return "g_ForceFieldBGOpacity";
-        case Semantic::g_ForceFieldBlendMode: return "g_ForceFieldBlendMode";
-        case Semantic::g_ForceFieldCullMode: return "g_ForceFieldCullMode";
-        case Semantic::g_ForceFieldNoiseSpeed: return "g_ForceFieldNoiseSpeed";
-        case Semantic::g_ForceFieldOpacity: return "g_ForceFieldOpacity";
-        case Semantic::g_ForceFieldShieldBGColor: return "g_ForceFieldShieldBGColor";
-        case Semantic::g_ForceFieldShieldColor: return "g_ForceFieldShieldColor";
-        case Semantic::g_ForwardVector: return "g_ForwardVector";
-        case Semantic::g_FrameColor: return "g_FrameColor";
-        case Semantic::g_FrameFade: return "g_FrameFade";
-        case Semantic::g_FrameRatio: return "g_FrameRatio";
-        case Semantic::g_FrameWidth: return "g_FrameWidth";
-        case Semantic::g_FullScreenEffectDOF: return "g_FullScreenEffectDOF";
-        case Semantic::g_FullScreenEffectNone: return "g_FullScreenEffectNone";
-        case Semantic::g_FullScreenEffectThermal: return "g_FullScreenEffectThermal";
-        case Semantic::g_FullScreenEffectVR: return "g_FullScreenEffectVR";
-        case Semantic::g_GlowBrightness: return "g_GlowBrightness";
-        case Semantic::g_GlowContrast: return "g_GlowContrast";
-        case Semantic::g_GlowUVScale: return "g_GlowUVScale";
-        case Semantic::g_GridPatternTexture: return "g_GridPatternTexture";
-        case Semantic::g_Horizontal: return "g_Horizontal";
-        case Semantic::g_HotLavaTexture: return "g_HotLavaTexture";
-        case Semantic::g_HotLavaTiling: return "g_HotLavaTiling";
-        case Semantic::g_HotRoll: return "g_HotRoll";
-        case Semantic::g_InnerOuter: return "g_InnerOuter";
-        case Semantic::g_InteriorProbeWeight: return "g_InteriorProbeWeight";
-        case Semantic::g_IrisClampHigh: return "g_IrisClampHigh";
-        case Semantic::g_IrisClampLow: return "g_IrisClampLow";
-        case Semantic::g_IrisVisionOffset: return "g_IrisVisionOffset";
-        case Semantic::g_IsShadowGenPass: return "g_IsShadowGenPass";
-        case Semantic::g_KeyLuminance: return "g_KeyLuminance";
-        case Semantic::g_LODScale: return "g_LODScale";
-        case Semantic::g_LeftFrame: return "g_LeftFrame";
-        case Semantic::g_Length: return "g_Length";
-        case Semantic::g_MetersPerSecond: return "g_MetersPerSecond";
-        case Semantic::g_ModelDoubleSided: return "g_ModelDoubleSided";
-        case Semantic::g_NoiseSpeed: return "g_NoiseSpeed";
-        case Semantic::g_NoiseThickness: return "g_NoiseThickness";
-        case Semantic::g_NoiseTiling: return "g_NoiseTiling";
-        case Semantic::g_NormalDistortion: return "g_NormalDistortion";
-        case Semantic::g_Opacity: return "g_Opacity";
-        case Semantic::g_Overlay1ColorChannel: return "g_Overlay1ColorChannel";
-        case Semantic::g_Overlay1Texture: return "g_Overlay1Texture";
-        case Semantic::g_Overlay1Tiling: return "g_Overlay1Tiling";
-        case Semantic::g_Overlay1UVSet: return "g_Overlay1UVSet";
-        case Semantic::g_Overlay2ColorChannel: return "g_Overlay2ColorChannel";
-        case Semantic::g_Overlay2Texture: return "g_Overlay2Texture";
-        case Semantic::g_Overlay2Tiling: return "g_Overlay2Tiling";
-        case Semantic::g_Overlay2UVSet: return "g_Overlay2UVSet";
-        case Semantic::g_Overlay3ColorChannel: return "g_Overlay3ColorChannel";
-        case Semantic::g_Overlay3Texture: return "g_Overlay3Texture";
-        case Semantic::g_Overlay3Tiling: return "g_Overlay3Tiling";
-        case Semantic::g_Overlay3UVSet: return "g_Overlay3UVSet";
-        case Semantic::g_Overlay4ColorChannel: return "g_Overlay4ColorChannel";
-        case Semantic::g_Overlay4Texture: return "g_Overlay4Texture";
-        case Semantic::g_Overlay4Tiling: return "g_Overlay4Tiling";
-        case Semantic::g_Overlay4UVSet: return "g_Overlay4UVSet";
-        case Semantic::g_OverlayA: return "g_OverlayA";
-        case Semantic::g_OverlayB: return "g_OverlayB";
-        case Semantic::g_OverlayEdge: return "g_OverlayEdge";
-        case Semantic::g_OverlayNMTexture: return "g_OverlayNMTexture";
-        case Semantic::g_OverlayScale: return "g_OverlayScale";
-        case Semantic::g_OverlaySmoothing: return "g_OverlaySmoothing";
-        case Semantic::g_OverlayTexture: return "g_OverlayTexture";
-        case Semantic::g_OverlayTiling: return "g_OverlayTiling";
-        case Semantic::g_PatternAlpha: return "g_PatternAlpha";
-        case Semantic::g_PatternColor: return "g_PatternColor";
-        case Semantic::g_PatternGlow: return "g_PatternGlow";
-        case Semantic::g_PatternOpacity: return "g_PatternOpacity";
-        case Semantic::g_PatternScaler: return "g_PatternScaler";
-        case Semantic::g_PatternTiling: return "g_PatternTiling";
-        case Semantic::g_PeakAlphaFromTexture: return "g_PeakAlphaFromTexture";
-        case Semantic::g_PerlinNoise3DTexture: return "g_PerlinNoise3DTexture";
-        case Semantic::g_PolarizerStrength: return "g_PolarizerStrength";
-        case Semantic::g_Power: return "g_Power";
-        case Semantic::g_PreLitTexture: return "g_PreLitTexture";
-        case Semantic::g_ProbeEvComps: return "g_ProbeEvComps";
-        case Semantic::g_RollTiling: return "g_RollTiling";
-        case Semantic::g_Rotation: return "g_Rotation";
-        case Semantic::g_SaturationIntensity: return "g_SaturationIntensity";
-        case Semantic::g_Scale: return "g_Scale";
-        case Semantic::g_ScaleB: return "g_ScaleB";
-        case Semantic::g_ScaleBias: return "g_ScaleBias";
-        case Semantic::g_ScaleEnd: return "g_ScaleEnd";
-        case Semantic::g_ScaleMax: return "g_ScaleMax";
-        case Semantic::g_ScaleMin: return "g_ScaleMin";
-        case Semantic::g_ScalePower: return "g_ScalePower";
-        case Semantic::g_ScaleStart: return "g_ScaleStart";
-        case Semantic::g_ScaleX: return "g_ScaleX";
-        case Semantic::g_ScaleY: return "g_ScaleY";
-        case Semantic::g_Scaler: return "g_Scaler";
-        case Semantic::g_ScatterConstants: return "g_ScatterConstants";
-        case Semantic::g_ScatterWavelengths: return "g_ScatterWavelengths";
-        case Semantic::g_ScrollU: return "g_ScrollU";
-        case Semantic::g_ScrollV: return "g_ScrollV";
-        case Semantic::g_ShieldColor: return "g_ShieldColor";
-        case Semantic::g_ShieldDistance: return "g_ShieldDistance";
-        case Semantic::g_ShieldDistortion: return "g_ShieldDistortion";
-        case Semantic::g_ShieldHottness: return "g_ShieldHottness";
-        case Semantic::g_ShieldPatternTexture: return "g_ShieldPatternTexture";
-        case Semantic::g_ShowDecalTint: return "g_ShowDecalTint";
-        case Semantic::g_ShowTilingTint: return "g_ShowTilingTint";
-        case Semantic::g_Sigma: return "g_Sigma";
-        case Semantic::g_SiltColor: return "g_SiltColor";
-        case Semantic::g_SiltDepth: return "g_SiltDepth";
-        case Semantic::g_SiltNFoamTexture: return "g_SiltNFoamTexture";
-        case Semantic::g_SingleSided: return "g_SingleSided";
-        case Semantic::g_SkyCubeTexture: return "g_SkyCubeTexture";
-        case Semantic::g_SparkFlowX: return "g_SparkFlowX";
-        case Semantic::g_SparkFlowZ: return "g_SparkFlowZ";
-        case Semantic::g_SparkMask: return "g_SparkMask";
-        case Semantic::g_SparkOpacity: return "g_SparkOpacity";
-        case Semantic::g_SpecBTexture: return "g_SpecBTexture";
-        case Semantic::g_SpecTexture: return "g_SpecTexture";
-        case Semantic::g_Stage: return "g_Stage";
-        case Semantic::g_StarsColor: return "g_StarsColor";
-        case Semantic::g_Strength: return "g_Strength";
-        case Semantic::g_SunDir: return "g_SunDir";
-        case Semantic::g_SurfaceScale: return "g_SurfaceScale";
-        case Semantic::g_TAAEnabled: return "g_TAAEnabled";
-        case Semantic::g_TilingOverlayBTexture: return "g_TilingOverlayBTexture";
-        case Semantic::g_TilingOverlayTexture: return "g_TilingOverlayTexture";
-        case Semantic::g_TilingScaleB: return "g_TilingScaleB";
-        case Semantic::g_TilingTintHighlight: return "g_TilingTintHighlight";
-        case Semantic::g_TilingTintMidtone: return "g_TilingTintMidtone";
-        case Semantic::g_TilingTintOpacity: return "g_TilingTintOpacity";
-        case Semantic::g_TilingTintRotation: return "g_TilingTintRotation";
-        case Semantic::g_TilingTintScale: return "g_TilingTintScale";
-        case Semantic::g_TilingTintShadow: return "g_TilingTintShadow";
-        case Semantic::g_TilingTintTexture: return "g_TilingTintTexture";
-        case Semantic::g_TilingTintTranslation: return "g_TilingTintTranslation";
-        case Semantic::g_Tint: return "g_Tint";
-        case Semantic::g_Tint1: return "g_Tint1";
-        case Semantic::g_Tint2: return "g_Tint2";
-        case Semantic::g_Tint3: return "g_Tint3";
-        case Semantic::g_TopFrame: return "g_TopFrame";
-        case Semantic::g_TransitionDirection: return "g_TransitionDirection";
-        case Semantic::g_TransitionOffset: return "g_TransitionOffset";
-        case Semantic::g_TransitionSharpness: return "g_TransitionSharpness";
-        case Semantic::g_TransitionWidth: return "g_TransitionWidth";
-        case Semantic::g_Transmittance: return "g_Transmittance";
-        case Semantic::g_Transparency: return "g_Transparency";
-        case Semantic::g_UVsPerMeter0: return "g_UVsPerMeter0";
-        case Semantic::g_UVsPerMeter1: return "g_UVsPerMeter1";
-        case Semantic::g_UVsPerMeter2: return "g_UVsPerMeter2";
-        case Semantic::g_UVsPerMeter3: return "g_UVsPerMeter3";
-        case Semantic::g_UseUV0ForDetailBump: return "g_UseUV0ForDetailBump";
-        case Semantic::g_UseUV1ForOverlayMask: return "g_UseUV1ForOverlayMask";
-        case Semantic::g_WaterDepthTexture: return "g_WaterDepthTexture";
-        case Semantic::g_WaterReflectionTexture: return "g_WaterReflectionTexture";
-        case Semantic::g_Wave: return "g_Wave";
-        case Semantic::g_WaveScrollU: return "g_WaveScrollU";
-        case Semantic::g_WaveScrollV: return "g_WaveScrollV";
-        case Semantic::g_Width: return "g_Width";
-        case Semantic::g_WorldScale: return "g_WorldScale";
-        case Semantic::g_YawPitchRollFace: return "g_YawPitchRollFace";
-        case Semantic::g_adjustToLighting: return "g_adjustToLighting";
-        case Semantic::g_allowMotionBlur: return "g_allowMotionBlur";
-        case Semantic::g_alphaClipShadowBias: return "g_alphaClipShadowBias";
-        case Semantic::g_alphaEnabled: return "g_alphaEnabled";
-        case Semantic::g_ambience: return "g_ambience";
-        case Semantic::g_ambientLightColor: return "g_ambientLightColor";
-        case Semantic::g_amplitude: return "g_amplitude";
-        case Semantic::g_angularFrequency: return "g_angularFrequency";
-        case Semantic::g_animTiling: return "g_animTiling";
-        case Semantic::g_animationOffsetU: return "g_animationOffsetU";
-        case Semantic::g_animationOffsetV: return "g_animationOffsetV";
-        case Semantic::g_animationShift: return "g_animationShift";
-        case Semantic::g_antiBloom: return "g_antiBloom";
-        case Semantic::g_aoBlackPoint: return "g_aoBlackPoint";
-        case Semantic::g_aoShadowFactor: return "g_aoShadowFactor";
-        case Semantic::g_appWaterHeight: return "g_appWaterHeight";
-        case Semantic::g_applyToSky: return "g_applyToSky";
-        case Semantic::g_backfaceMaxOpacity: return "g_backfaceMaxOpacity";
-        case Semantic::g_backfaceMinOpacity: return "g_backfaceMinOpacity";
-        case Semantic::g_backfaceRefraction: return "g_backfaceRefraction";
-        case Semantic::g_backfaceRefractionDistanceFactor: return "g_backfaceRefractionDistanceFactor";
-        case Semantic::g_backfaceTingIntensityFactor: return "g_backfaceTingIntensityFactor";
-        case Semantic::g_blackShiftStrength: return "g_blackShiftStrength";
-        case Semantic::g_blend: return "g_blend";
-        case Semantic::g_bloomEnabled: return "g_bloomEnabled";
-        case Semantic::g_bloomIn: return "g_bloomIn";
-        case Semantic::g_bloomStrength: return "g_bloomStrength";
-        case Semantic::g_bloomTexture: return "g_bloomTexture";
-        case Semantic::g_blueNoiseTexture: return "g_blueNoiseTexture";
-        case Semantic::g_blueSource: return "g_blueSource";
-        case Semantic::g_blurTexture: return "g_blurTexture";
-        case Semantic::g_blurTexture2: return "g_blurTexture2";
-        case Semantic::g_boneMatrices: return "g_boneMatrices";
-        case Semantic::g_bonePrevMatrices: return "g_bonePrevMatrices";
-        case Semantic::g_brdfLookupTexture: return "g_brdfLookupTexture";
-        case Semantic::g_brightness: return "g_brightness";
-        case Semantic::g_bumpCleanup: return "g_bumpCleanup";
-        case Semantic::g_bumpMap1: return "g_bumpMap1";
-        case Semantic::g_bumpMap2: return "g_bumpMap2";
-        case Semantic::g_bumpMap3: return "g_bumpMap3";
-        case Semantic::g_bumpStrength: return "g_bumpStrength";
-        case Semantic::g_bumpTexture: return "g_bumpTexture";
-        case Semantic::g_bumpiness1: return "g_bumpiness1";
-        case Semantic::g_bumpiness2: return "g_bumpiness2";
-        case Semantic::g_bumpiness3: return "g_bumpiness3";
-        case Semantic::g_cameraDelta: return "g_cameraDelta";
-        case Semantic::g_cameraEye: return "g_cameraEye";
-        case Semantic::g_cameraMatrix: return "g_cameraMatrix";
-        case Semantic::g_cameraShadow: return "g_cameraShadow";
-        case Semantic::g_causticFadeCoefA: return "g_causticFadeCoefA";
-        case Semantic::g_causticFadeCoefB: return "g_causticFadeCoefB";
-        case Semantic::g_causticHeightFadeInEnd: return "g_causticHeightFadeInEnd";
-        case Semantic::g_causticHeightFadeInStart: return "g_causticHeightFadeInStart";
-        case Semantic::g_causticOverlayTexture: return "g_causticOverlayTexture";
-        case Semantic::g_causticOverlayTexture2: return "g_causticOverlayTexture2";
-        case Semantic::g_cavityThreshold: return "g_cavityThreshold";
-        case Semantic::g_center: return "g_center";
-        case Semantic::g_centerFalloffCutoff: return "g_centerFalloffCutoff";
-        case Semantic::g_clarityOfSky: return "g_clarityOfSky";
-        case Semantic::g_clear: return "g_clear";
-        case Semantic::g_clipSpaceMotion: return "g_clipSpaceMotion";
-        case Semantic::g_cloakColor: return "g_cloakColor";
-        case Semantic::g_cloakDarkLightColor: return "g_cloakDarkLightColor";
-        case Semantic::g_cloudShadowAlphaPower: return "g_cloudShadowAlphaPower";
-        case Semantic::g_cloudWorldMatrix: return "g_cloudWorldMatrix";
-        case Semantic::g_color: return "g_color";
-        case Semantic::g_color1Texture: return "g_color1Texture";
-        case Semantic::g_color2Texture: return "g_color2Texture";
-        case Semantic::g_color3Texture: return "g_color3Texture";
-        case Semantic::g_colorBlindFilter: return "g_colorBlindFilter";
-        case Semantic::g_colorBlindFilterAmount: return "g_colorBlindFilterAmount";
-        case Semantic::g_colorBlindFilterStrength: return "g_colorBlindFilterStrength";
-        case Semantic::g_colorGrading: return "g_colorGrading";
-        case Semantic::g_colorKeyLerp: return "g_colorKeyLerp";
-        case Semantic::g_colorKeyTextureA: return "g_colorKeyTextureA";
-        case Semantic::g_colorKeyTextureB: return "g_colorKeyTextureB";
-        case Semantic::g_colorShiftRate: return "g_colorShiftRate";
-        case Semantic::g_colorShiftStrength: return "g_colorShiftStrength";
-        case Semantic::g_colorTexture: return "g_colorTexture";
-        case Semantic::g_coloredFogEnabled: return "g_coloredFogEnabled";
-        case Semantic::g_contrast: return "g_contrast";
-        case Semantic::g_convertDepthMode: return "g_convertDepthMode";
-        case Semantic::g_cubeFace: return "g_cubeFace";
-        case Semantic::g_cubeFaceDir: return "g_cubeFaceDir";
-        case Semantic::g_cubeFaceDown: return "g_cubeFaceDown";
-        case Semantic::g_cubeFaceRight: return "g_cubeFaceRight";
-        case Semantic::g_cumulusContrast: return "g_cumulusContrast";
-        case Semantic::g_cumulusHeight: return "g_cumulusHeight";
-        case Semantic::g_cumulusScrollU: return "g_cumulusScrollU";
-        case Semantic::g_cumulusScrollV: return "g_cumulusScrollV";
-        case Semantic::g_cumulusTiling: return "g_cumulusTiling";
-        case Semantic::g_deResHottness: return "g_deResHottness";
-        case Semantic::g_deltaTime: return "g_deltaTime";
-        case Semantic::g_density: return "g_density";
-        case Semantic::g_depth: return "g_depth";
-        case Semantic::g_depthOffset: return "g_depthOffset";
-        case Semantic::g_depthOpacityNegativeBias: return "g_depthOpacityNegativeBias";
-        case Semantic::g_depthPrePass: return "g_depthPrePass";
-        case Semantic::g_depthScale: return "g_depthScale";
-        case Semantic::g_dielectricMax: return "g_dielectricMax";
-        case Semantic::g_dielectricMin: return "g_dielectricMin";
-        case Semantic::g_dirBlurMode: return "g_dirBlurMode";
-        case Semantic::g_directionalLightColor: return "g_directionalLightColor";
-        case Semantic::g_directionalLightViewSpaceDir: return "g_directionalLightViewSpaceDir";
-        case Semantic::g_dirtBloomSunSkyStrAlpha: return "g_dirtBloomSunSkyStrAlpha";
-        case Semantic::g_dirtLayer1SizeStrRanges: return "g_dirtLayer1SizeStrRanges";
-        case Semantic::g_dirtLayer2SizeStrRanges: return "g_dirtLayer2SizeStrRanges";
-        case Semantic::g_dirtLayerDensities: return "g_dirtLayerDensities";
-        case Semantic::g_dirtNoiseScaleStr: return "g_dirtNoiseScaleStr";
-        case Semantic::g_distanceThicknessParams: return "g_distanceThicknessParams";
-        case Semantic::g_distortionTexture: return "g_distortionTexture";
-        case Semantic::g_dontCorrectCamera: return "g_dontCorrectCamera";
-        case Semantic::g_eNoise3DTexture: return "g_eNoise3DTexture";
-        case Semantic::g_edge: return "g_edge";
-        case Semantic::g_effectID: return "g_effectID";
-        case Semantic::g_emissiveCorrectionLimit: return "g_emissiveCorrectionLimit";
-        case Semantic::g_emissiveCorrectionScale: return "g_emissiveCorrectionScale";
-        case Semantic::g_emissiveScale: return "g_emissiveScale";
-        case Semantic::g_emissiveSlope: return "g_emissiveSlope";
-        case Semantic::g_emitsHeat: return "g_emitsHeat";
-        case Semantic::g_enable: return "g_enable";
-        case Semantic::g_enableClouds: return "g_enableClouds";
-        case Semantic::g_enableColorGrading: return "g_enableColorGrading";
-        case Semantic::g_enableFogTurbulence: return "g_enableFogTurbulence";
-        case Semantic::g_enablePlanarMapAB: return "g_enablePlanarMapAB";
-        case Semantic::g_enableSnow: return "g_enableSnow";
-        case Semantic::g_enableSway: return "g_enableSway";
-        case Semantic::g_enableTileUV0: return "g_enableTileUV0";
-        case Semantic::g_enableVignette: return "g_enableVignette";
-        case Semantic::g_eyePos: return "g_eyePos";
-        case Semantic::g_fDepthTransparancy: return "g_fDepthTransparancy";
-        case Semantic::g_fadeOutEnd: return "g_fadeOutEnd";
-        case Semantic::g_fadeOutStart: return "g_fadeOutStart";
-        case Semantic::g_farClip: return "g_farClip";
-        case Semantic::g_filterMode: return "g_filterMode";
-        case Semantic::g_flareColor: return "g_flareColor";
-        case Semantic::g_flareFocus: return "g_flareFocus";
-        case Semantic::g_flareSize: return "g_flareSize";
-        case Semantic::g_flareZoom: return "g_flareZoom";
-        case Semantic::g_floraNoiseTexture: return "g_floraNoiseTexture";
-        case Semantic::g_foamDepthBias: return "g_foamDepthBias";
-        case Semantic::g_foamEnabled: return "g_foamEnabled";
-        case Semantic::g_foamFallOff: return "g_foamFallOff";
-        case Semantic::g_foamTexture: return "g_foamTexture";
-        case Semantic::g_foamUVScale: return "g_foamUVScale";
-        case Semantic::g_foamWaterTiling: return "g_foamWaterTiling";
-        case Semantic::g_focus: return "g_focus";
-        case Semantic::g_fogColor: return "g_fogColor";
-        case Semantic::g_fogDensity: return "g_fogDensity";
-        case Semantic::g_fogDepthHorizontalMult: return "g_fogDepthHorizontalMult";
-        case Semantic::g_fogDistributionParams: return "g_fogDistributionParams";
-        case Semantic::g_fogEnable: return "g_fogEnable";
-        case Semantic::g_fogFar: return "g_fogFar";
-        case Semantic::g_fogFloor: return "g_fogFloor";
-        case Semantic::g_fogGradient: return "g_fogGradient";
-        case Semantic::g_fogHorizontalGradientVector: return "g_fogHorizontalGradientVector";
-        case Semantic::g_fogShadowsEnable: return "g_fogShadowsEnable";
-        case Semantic::g_fogSkyFar: return "g_fogSkyFar";
-        case Semantic::g_fogSkyNear: return "g_fogSkyNear";
-        case Semantic::g_fogTurbBoilSpeed: return "g_fogTurbBoilSpeed";
-        case Semantic::g_fogTurbDensityRange: return "g_fogTurbDensityRange";
-        case Semantic::g_fogTurbDirection: return "g_fogTurbDirection";
-        case Semantic::g_fogTurbScale: return "g_fogTurbScale";
-        case Semantic::g_fogTurbSpeed: return "g_fogTurbSpeed";
-        case Semantic::g_fontTexture: return "g_fontTexture";
-        case Semantic::g_foregroundWScale: return "g_foregroundWScale";
-        case Semantic::g_foregroundZBias: return "g_foregroundZBias";
-        case Semantic::g_foregroundZScale: return "g_foregroundZScale";
-        case Semantic::g_frameOn: return "g_frameOn";
-        case Semantic::g_fresnel: return "g_fresnel";
-        case Semantic::g_fresnelFuncTexture: return "g_fresnelFuncTexture";
-        case Semantic::g_gbuffer0Texture: return "g_gbuffer0Texture";
-        case Semantic::g_gbuffer1Texture: return "g_gbuffer1Texture";
-        case Semantic::g_gbuffer2Texture: return "g_gbuffer2Texture";
-        case Semantic::g_gbuffer3Texture: return "g_gbuffer3Texture";
-        case Semantic::g_glaze: return "g_glaze";
-        case Semantic::g_glazeMax: return "g_glazeMax";
-        case Semantic::g_glazeMin: return "g_glazeMin";
-        case Semantic::g_globalResolutionScale: return "g_globalResolutionScale";
-        case Semantic::g_glow: return "g_glow";
-        case Semantic::g_glowBase: return "g_glowBase";
-        case Semantic::g_glowMax: return "g_glowMax";
-        case Semantic::g_glowMin: return "g_glowMin";
-        case Semantic::g_glowThickness: return "g_glowThickness";
-        case Semantic::g_godRayEndFade: return "g_godRayEndFade";
-        case Semantic::g_godRayStartFade: return "g_godRayStartFade";
-        case Semantic::g_greenSource: return "g_greenSource";
-        case Semantic::g_grungeAmount: return "g_grungeAmount";
-        case Semantic::g_hazeSunSkyStr: return "g_hazeSunSkyStr";
-        case Semantic::g_hdrTexture: return "g_hdrTexture";
-        case Semantic::g_highQualityLighting: return "g_highQualityLighting";
-        case Semantic::g_highlightDomain: return "g_highlightDomain";
-        case Semantic::g_highlightSaturation: return "g_highlightSaturation";
-        case Semantic::g_highlightTint: return "g_highlightTint";
-        case Semantic::g_holoColor: return "g_holoColor";
-        case Semantic::g_holoHottness: return "g_holoHottness";
-        case Semantic::g_holoOpacity: return "g_holoOpacity";
-        case Semantic::g_holoReduceBloom: return "g_holoReduceBloom";
-        case Semantic::g_holoTexture: return "g_holoTexture";
-        case Semantic::g_holoTilingRateU: return "g_holoTilingRateU";
-        case Semantic::g_holoTilingRateV: return "g_holoTilingRateV";
-        case Semantic::g_hologramBlend: return "g_hologramBlend";
-        case Semantic::g_hologramUVSet: return "g_hologramUVSet";
-        case Semantic::g_hoodFalloffAngle: return "g_hoodFalloffAngle";
-        case Semantic::g_horizonFadeHeight: return "g_horizonFadeHeight";
-        case Semantic::g_horizonGlowColor: return "g_horizonGlowColor";
-        case Semantic::g_horizonWidthHeightLat: return "g_horizonWidthHeightLat";
-        case Semantic::g_inForeground: return "g_inForeground";
-        case Semantic::g_infraRedColor: return "g_infraRedColor";
-        case Semantic::g_infraRedOutlineAlpha: return "g_infraRedOutlineAlpha";
-        case Semantic::g_infraRedOutlineColor: return "g_infraRedOutlineColor";
-        case Semantic::g_infraRedOutlineWidth: return "g_infraRedOutlineWidth";
-        case Semantic::g_infraRedRange: return "g_infraRedRange";
-        case Semantic::g_infraRedScanLines: return "g_infraRedScanLines";
-        case Semantic::g_infraRedWhitePoint: return "g_infraRedWhitePoint";
-        case Semantic::g_invGamma: return "g_invGamma";
-        case Semantic::g_inverseProjMatrix: return "g_inverseProjMatrix";
-        case Semantic::g_irisTexture: return "g_irisTexture";
-        case Semantic::g_ironSight: return "g_ironSight";
-        case Semantic::g_isDoubleSided: return "g_isDoubleSided";
-        case Semantic::g_jitterOffset: return "g_jitterOffset";
-        case Semantic::g_layerWeightings: return "g_layerWeightings";
-        case Semantic::g_lensEffectsEnabled: return "g_lensEffectsEnabled";
-        case Semantic::g_lensEffectsTexture: return "g_lensEffectsTexture";
-        case Semantic::g_lightScattering: return "g_lightScattering";
-        case Semantic::g_lightingRadius: return "g_lightingRadius";
-        case Semantic::g_lookupTexture: return "g_lookupTexture";
-        case Semantic::g_lowEnd: return "g_lowEnd";
-        case Semantic::g_m43World: return "g_m43World";
-        case Semantic::g_mainSceneCameraPos: return "g_mainSceneCameraPos";
-        case Semantic::g_maskResolution: return "g_maskResolution";
-        case Semantic::g_maskTexture: return "g_maskTexture";
-        case Semantic::g_maskViewProj: return "g_maskViewProj";
-        case Semantic::g_maxDayIntensityOnColor: return "g_maxDayIntensityOnColor";
-        case Semantic::g_maxDayIntensityOnFoam: return "g_maxDayIntensityOnFoam";
-        case Semantic::g_maxNightIntensityOnColor: return "g_maxNightIntensityOnColor";
-        case Semantic::g_maxNightIntensityOnFoam: return "g_maxNightIntensityOnFoam";
-        case Semantic::g_maxPointiness: return "g_maxPointiness";
-        case Semantic::g_metalic: return "g_metalic";
-        case Semantic::g_metallicMax: return "g_metallicMax";
-        case Semantic::g_metallicMin: return "g_metallicMin";
-        case Semantic::g_midtoneSaturation: return "g_midtoneSaturation";
-        case Semantic::g_minDayIntensityOnColor: return "g_minDayIntensityOnColor";
-        case Semantic::g_minDayIntensityOnFoam: return "g_minDayIntensityOnFoam";
-        case Semantic::g_minNightIntensityOnColor: return "g_minNightIntensityOnColor";
-        case Semantic::g_minNightIntensityOnFoam: return "g_minNightIntensityOnFoam";
-        case Semantic::g_mipLevel: return "g_mipLevel";
-        case Semantic::g_mode: return "g_mode";
-        case Semantic::g_motionBlurPower: return "g_motionBlurPower";
-        case Semantic::g_motionTilesTexture: return "g_motionTilesTexture";
-        case Semantic::g_nearClip: return "g_nearClip";
-        case Semantic::g_nightVision: return "g_nightVision";
-        case Semantic::g_nightVisionIntensity: return "g_nightVisionIntensity";
-        case Semantic::g_nightVisionNoise: return "g_nightVisionNoise";
-        case Semantic::g_nightVisionScanLines: return "g_nightVisionScanLines";
-        case Semantic::g_nightVisionWhitePointAdjustment: return "g_nightVisionWhitePointAdjustment";
-        case Semantic::g_noDepth: return "g_noDepth";
-        case Semantic::g_noise: return "g_noise";
-        case Semantic::g_noise3DTexture: return "g_noise3DTexture";
-        case Semantic::g_noiseBoilSpeed: return "g_noiseBoilSpeed";
-        case Semantic::g_noiseDriftSpeed: return "g_noiseDriftSpeed";
-        case Semantic::g_noiseScale: return "g_noiseScale";
-        case Semantic::g_noiseSpeed: return "g_noiseSpeed";
-        case Semantic::g_noiseTex: return "g_noiseTex";
-        case Semantic::g_noiseTexture: return "g_noiseTexture";
-        case Semantic::g_noiseTexture2D: return "g_noiseTexture2D";
-        case Semantic::g_noiseTiling: return "g_noiseTiling";
-        case Semantic::g_normalMapTextureTexture: return "g_normalMapTextureTexture";
-        case Semantic::g_objectID: return "g_objectID";
-        case Semantic::g_objectShadow: return "g_objectShadow";
-        case Semantic::g_obscure: return "g_obscure";
-        case Semantic::g_octaves: return "g_octaves";
-        case Semantic::g_offset: return "g_offset";
-        case Semantic::g_opacity: return "g_opacity";
-        case Semantic::g_options: return "g_options";
-        case Semantic::g_options2: return "g_options2";
-        case Semantic::g_overCast: return "g_overCast";
-        case Semantic::g_particleColor: return "g_particleColor";
-        case Semantic::g_pass: return "g_pass";
-        case Semantic::g_periodicTexture: return "g_periodicTexture";
-        case Semantic::g_phaseShift: return "g_phaseShift";
-        case Semantic::g_photoModeEnabled: return "g_photoModeEnabled";
-        case Semantic::g_pickColor: return "g_pickColor";
-        case Semantic::g_pixelShaderIndex: return "g_pixelShaderIndex";
-        case Semantic::g_pixelSize: return "g_pixelSize";
-        case Semantic::g_planarMapA: return "g_planarMapA";
-        case Semantic::g_planarMapBrightness: return "g_planarMapBrightness";
-        case Semantic::g_planarNoiseTexture: return "g_planarNoiseTexture";
-        case Semantic::g_polarize: return "g_polarize";
-        case Semantic::g_pos: return "g_pos";
-        case Semantic::g_postEffect: return "g_postEffect";
-        case Semantic::g_power: return "g_power";
-        case Semantic::g_prevProjMatrix: return "g_prevProjMatrix";
-        case Semantic::g_prevViewMatrix: return "g_prevViewMatrix";
-        case Semantic::g_prevViewProjMatrix: return "g_prevViewProjMatrix";
-        case Semantic::g_prevVirtualViewMatrix: return "g_prevVirtualViewMatrix";
-        case Semantic::g_prevVirtualViewOffset: return "g_prevVirtualViewOffset";
-        case Semantic::g_prevWorldMatrix: return "g_prevWorldMatrix";
-        case Semantic::g_projMatrix: return "g_projMatrix";
-        case Semantic::g_projectorWorldMatrix: return "g_projectorWorldMatrix";
-        case Semantic::g_random: return "g_random";
-        case Semantic::g_randomSeed: return "g_randomSeed";
-        case Semantic::g_range: return "g_range";
-        case Semantic::g_redSource: return "g_redSource";
-        case Semantic::g_reflection: return "g_reflection";
-        case Semantic::g_refraction: return "g_refraction";
-        case Semantic::g_renderLevel: return "g_renderLevel";
-        case Semantic::g_resPatternTexture: return "g_resPatternTexture";
-        case Semantic::g_rippleFreq: return "g_rippleFreq";
-        case Semantic::g_rippleSpeed: return "g_rippleSpeed";
-        case Semantic::g_rippleX: return "g_rippleX";
-        case Semantic::g_rippleY: return "g_rippleY";
-        case Semantic::g_rippleZ: return "g_rippleZ";
-        case Semantic::g_rough: return "g_rough";
-        case Semantic::g_satelliteWorldMatrix: return "g_satelliteWorldMatrix";
-        case Semantic::g_scale1_U: return "g_scale1_U";
-        case Semantic::g_scale1_V: return "g_scale1_V";
-        case Semantic::g_scale2_U: return "g_scale2_U";
-        case Semantic::g_scale2_V: return "g_scale2_V";
-        case Semantic::g_scale3_U: return "g_scale3_U";
-        case Semantic::g_scale3_V: return "g_scale3_V";
-        case Semantic::g_scanIntensity: return "g_scanIntensity";
-        case Semantic::g_scanSpacing: return "g_scanSpacing";
-        case Semantic::g_scanSpeed: return "g_scanSpeed";
-        case Semantic::g_scatterLight: return "g_scatterLight";
-        case Semantic::g_scatterWashBias: return "g_scatterWashBias";
-        case Semantic::g_scattering: return "g_scattering";
-        case Semantic::g_screenDirtLookupTex: return "g_screenDirtLookupTex";
-        case Semantic::g_screenDirtTex: return "g_screenDirtTex";
-        case Semantic::g_scroll: return "g_scroll";
-        case Semantic::g_scroll1_U: return "g_scroll1_U";
-        case Semantic::g_scroll1_V: return "g_scroll1_V";
-        case Semantic::g_scroll2_U: return "g_scroll2_U";
-        case Semantic::g_scroll2_V: return "g_scroll2_V";
-        case Semantic::g_scroll3_U: return "g_scroll3_U";
-        case Semantic::g_scroll3_V: return "g_scroll3_V";
-        case Semantic::g_scrollU: return "g_scrollU";
-        case Semantic::g_scrollV: return "g_scrollV";
-        case Semantic::g_seconds: return "g_seconds";
-        case Semantic::g_secondsDelta: return "g_secondsDelta";
-        case Semantic::g_shadowCoeffs: return "g_shadowCoeffs";
-        case Semantic::g_shadowDepthBias: return "g_shadowDepthBias";
-        case Semantic::g_shadowDepthOffset: return "g_shadowDepthOffset";
-        case Semantic::g_shadowDepthScale: return "g_shadowDepthScale";
-        case Semantic::g_shadowDomain: return "g_shadowDomain";
-        case Semantic::g_shadowEnableFastZ: return "g_shadowEnableFastZ";
-        case Semantic::g_shadowFilterRadius: return "g_shadowFilterRadius";
-        case Semantic::g_shadowFilterSigma: return "g_shadowFilterSigma";
-        case Semantic::g_shadowFilterType: return "g_shadowFilterType";
-        case Semantic::g_shadowMapCoeffs: return "g_shadowMapCoeffs";
-        case Semantic::g_shadowMode: return "g_shadowMode";
-        case Semantic::g_shadowOpacity: return "g_shadowOpacity";
-        case Semantic::g_shadowResolveOrtho: return "g_shadowResolveOrtho";
-        case Semantic::g_shadowSampleMode: return "g_shadowSampleMode";
-        case Semantic::g_shadowSaturation: return "g_shadowSaturation";
-        case Semantic::g_shadowSlopeScaledDepthBias: return "g_shadowSlopeScaledDepthBias";
-        case Semantic::g_shadowTexture: return "g_shadowTexture";
-        case Semantic::g_shadowTint: return "g_shadowTint";
-        case Semantic::g_shadowViewProj: return "g_shadowViewProj";
-        case Semantic::g_shieldsReduceBloom: return "g_shieldsReduceBloom";
-        case Semantic::g_silverLiningBrightness: return "g_silverLiningBrightness";
-        case Semantic::g_silverLiningThickness: return "g_silverLiningThickness";
-        case Semantic::g_skyColor: return "g_skyColor";
-        case Semantic::g_skyDepth: return "g_skyDepth";
-        case Semantic::g_skyFogShadowsEnable: return "g_skyFogShadowsEnable";
-        case Semantic::g_skyLightCoeff0: return "g_skyLightCoeff0";
-        case Semantic::g_skyLightCoeff1: return "g_skyLightCoeff1";
-        case Semantic::g_skyLightCoeff2: return "g_skyLightCoeff2";
-        case Semantic::g_skyLightCoeff3: return "g_skyLightCoeff3";
-        case Semantic::g_skyLightCoeff4: return "g_skyLightCoeff4";
-        case Semantic::g_skyLightCoeff5: return "g_skyLightCoeff5";
-        case Semantic::g_skyLightCoeff6: return "g_skyLightCoeff6";
-        case Semantic::g_skyLightCoeff7: return "g_skyLightCoeff7";
-        case Semantic::g_skyLightCoeff8: return "g_skyLightCoeff8";
-        case Semantic::g_skyLightProbeColor0Texture: return "g_skyLightProbeColor0Texture";
-        case Semantic::g_skyLightProbeColor1Texture: return "g_skyLightProbeColor1Texture";
-        case Semantic::g_skyLightProbeLerp: return "g_skyLightProbeLerp";
-        case Semantic::g_skyLightProbeLoc0: return "g_skyLightProbeLoc0";
-        case Semantic::g_skyLightProbeLoc1: return "g_skyLightProbeLoc1";
-        case Semantic::g_skyLightProbeNormal0Texture: return "g_skyLightProbeNormal0Texture";
-        case Semantic::g_skyLightProbeNormal1Texture: return "g_skyLightProbeNormal1Texture";
-        case Semantic::g_skyLightTexture: return "g_skyLightTexture";
-        case Semantic::g_skyLightTextureTint: return "g_skyLightTextureTint";
-        case Semantic::g_skyProbeColor: return "g_skyProbeColor";
-        case Semantic::g_skyRenderMode: return "g_skyRenderMode";
-        case Semantic::g_skyStencilMaskEnabled: return "g_skyStencilMaskEnabled";
-        case Semantic::g_smoothnessMax: return "g_smoothnessMax";
-        case Semantic::g_smoothnessMin: return "g_smoothnessMin";
-        case Semantic::g_sourceBlurQuarterUpscaleTexture: return "g_sourceBlurQuarterUpscaleTexture";
-        case Semantic::g_sourceDepthTexture: return "g_sourceDepthTexture";
-        case Semantic::g_sourceMip: return "g_sourceMip";
-        case Semantic::g_sourceTex: return "g_sourceTex";
-        case Semantic::g_sourceTexture: return "g_sourceTexture";
-        case Semantic::g_sourceTexture0: return "g_sourceTexture0";
-        case Semantic::g_sourceTexture1: return "g_sourceTexture1";
-        case Semantic::g_sourceTextureCube: return "g_sourceTextureCube";
-        case Semantic::g_specGlowTexture: return "g_specGlowTexture";
-        case Semantic::g_specMax: return "g_specMax";
-        case Semantic::g_specMin: return "g_specMin";
-        case Semantic::g_specular: return "g_specular";
-        case Semantic::g_splatShadowDepth: return "g_splatShadowDepth";
-        case Semantic::g_ssaoTexture: return "g_ssaoTexture";
-        case Semantic::g_stealthBlendTexture: return "g_stealthBlendTexture";
-        case Semantic::g_step: return "g_step";
-        case Semantic::g_stratusHeight: return "g_stratusHeight";
-        case Semantic::g_stratusScrollU: return "g_stratusScrollU";
-        case Semantic::g_stratusScrollV: return "g_stratusScrollV";
-        case Semantic::g_stratusTiling: return "g_stratusTiling";
-        case Semantic::g_streakElasticity: return "g_streakElasticity";
-        case Semantic::g_strength: return "g_strength";
-        case Semantic::g_submerged: return "g_submerged";
-        case Semantic::g_sunBiasedHorizonGlowColor: return "g_sunBiasedHorizonGlowColor";
-        case Semantic::g_sunBiasedHorizonWidthHeightLatSundis: return "g_sunBiasedHorizonWidthHeightLatSundis";
-        case Semantic::g_sunFalloffsStarsBlend: return "g_sunFalloffsStarsBlend";
-        case Semantic::g_sunGlare: return "g_sunGlare";
-        case Semantic::g_sunGlowColor: return "g_sunGlowColor";
-        case Semantic::g_sunGlowMax: return "g_sunGlowMax";
-        case Semantic::g_sunLightColor: return "g_sunLightColor";
-        case Semantic::g_sunLightDeferredShadowTexture: return "g_sunLightDeferredShadowTexture";
-        case Semantic::g_sunLightDir: return "g_sunLightDir";
-        case Semantic::g_sunLightDirWorldSpace: return "g_sunLightDirWorldSpace";
-        case Semantic::g_sunLightInvWorldViewProj: return "g_sunLightInvWorldViewProj";
-        case Semantic::g_sunLightShadowTexture: return "g_sunLightShadowTexture";
-        case Semantic::g_sunLightWorldViewProj: return "g_sunLightWorldViewProj";
-        case Semantic::g_sunPosition: return "g_sunPosition";
-        case Semantic::g_sunShadowCoeffs: return "g_sunShadowCoeffs";
-        case Semantic::g_swayBoil: return "g_swayBoil";
-        case Semantic::g_swayDir: return "g_swayDir";
-        case Semantic::g_swayPrevBoil: return "g_swayPrevBoil";
-        case Semantic::g_swayPrevSpeed: return "g_swayPrevSpeed";
-        case Semantic::g_swayScale: return "g_swayScale";
-        case Semantic::g_swaySmoothing: return "g_swaySmoothing";
-        case Semantic::g_swaySpeed: return "g_swaySpeed";
-        case Semantic::g_swayStrength: return "g_swayStrength";
-        case Semantic::g_swayWavefrontSize: return "g_swayWavefrontSize";
-        case Semantic::g_targetColorTexture: return "g_targetColorTexture";
-        case Semantic::g_targetRes: return "g_targetRes";
-        case Semantic::g_texScale1: return "g_texScale1";
-        case Semantic::g_texScale2: return "g_texScale2";
-        case Semantic::g_texScale3: return "g_texScale3";
-        case Semantic::g_texScrollU1: return "g_texScrollU1";
-        case Semantic::g_texScrollU2: return "g_texScrollU2";
-        case Semantic::g_texScrollU3: return "g_texScrollU3";
-        case Semantic::g_texScrollV1: return "g_texScrollV1";
-        case Semantic::g_texScrollV2: return "g_texScrollV2";
-        case Semantic::g_texScrollV3: return "g_texScrollV3";
-        case Semantic::g_texScrollX1: return "g_texScrollX1";
-        case Semantic::g_texScrollX2: return "g_texScrollX2";
-        case Semantic::g_texScrollX3: return "g_texScrollX3";
-        case Semantic::g_texScrollZ1: return "g_texScrollZ1";
-        case Semantic::g_texScrollZ2: return "g_texScrollZ2";
-        case Semantic::g_texScrollZ3: return "g_texScrollZ3";
-        case Semantic::g_texture: return "g_texture";
-        case Semantic::g_textureParams: return "g_textureParams";
-        case Semantic::g_thermalColor: return "g_thermalColor";
-        case Semantic::g_thermalFade: return "g_thermalFade";
-        case Semantic::g_thermalRange: return "g_thermalRange";
-        case Semantic::g_thermalWhitePoint: return "g_thermalWhitePoint";
-        case Semantic::g_tiling: return "g_tiling";
-        case Semantic::g_timeStep: return "g_timeStep";
-        case Semantic::g_timer: return "g_timer";
-        case Semantic::g_tint: return "g_tint";
-        case Semantic::g_tintAlpha: return "g_tintAlpha";
-        case Semantic::g_tintColor: return "g_tintColor";
-        case Semantic::g_toxicFogDistantColor: return "g_toxicFogDistantColor";
-        case Semantic::g_toxicFogLocalColor: return "g_toxicFogLocalColor";
-        case Semantic::g_toxicFogTexOffset: return "g_toxicFogTexOffset";
-        case Semantic::g_toxicFogTexScale: return "g_toxicFogTexScale";
-        case Semantic::g_toxicFogVariation: return "g_toxicFogVariation";
-        case Semantic::g_unjitteredProjMatrix: return "g_unjitteredProjMatrix";
-        case Semantic::g_unjitteredViewProjMatrix: return "g_unjitteredViewProjMatrix";
-        case Semantic::g_useDynamicWaterReflection: return "g_useDynamicWaterReflection";
-        case Semantic::g_uvOffsetNScale: return "g_uvOffsetNScale";
-        case Semantic::g_v4Color: return "g_v4Color";
-        case Semantic::g_vertexAlignment: return "g_vertexAlignment";
-        case Semantic::g_viewMatrix: return "g_viewMatrix";
-        case Semantic::g_viewProjMatrix: return "g_viewProjMatrix";
-        case Semantic::g_virtualCameraOffset: return "g_virtualCameraOffset";
-        case Semantic::g_virtualViewMatrix: return "g_virtualViewMatrix";
-        case Semantic::g_virtualViewOffset: return "g_virtualViewOffset";
-        case Semantic::g_visibility: return "g_visibility";
-        case Semantic::g_visibleSkyIntensity: return "g_visibleSkyIntensity";
-        case Semantic::g_visualizeLightCoverage: return "g_visualizeLightCoverage";
-        case Semantic::g_visualizerForeground: return "g_visualizerForeground";
-        case Semantic::g_warpMode: return "g_warpMode";
-        case Semantic::g_waterDisplacementPower: return "g_waterDisplacementPower";
-        case Semantic::g_waterHeight: return "g_waterHeight";
-        case Semantic::g_waterReflectionHeight: return "g_waterReflectionHeight";
-        case Semantic::g_waterTessYBias: return "g_waterTessYBias";
-        case Semantic::g_waterTiling: return "g_waterTiling";
-        case Semantic::g_waterTimeMul: return "g_waterTimeMul";
-        case Semantic::g_waveNormalUvScale: return "g_waveNormalUvScale";
-        case Semantic::g_waveNumber: return "g_waveNumber";
-        case Semantic::g_waveRadius: return "g_waveRadius";
-        case Semantic::g_wearAmount: return "g_wearAmount";
-        case Semantic::g_weatherEnabled: return "g_weatherEnabled";
-        case Semantic::g_weatherQuality: return "g_weatherQuality";
-        case Semantic::g_whitePoint: return "g_whitePoint";
-        case Semantic::g_wind: return "g_wind";
-        case Semantic::g_wireFrameEnabled: return "g_wireFrameEnabled";
-        case Semantic::g_world: return "g_world";
-        case Semantic::g_worldMatrix: return "g_worldMatrix";
-        case Semantic::g_worldViewInverse: return "g_worldViewInverse";
-        case Semantic::g_zBufferStructuresTexture: return "g_zBufferStructuresTexture";
-        case Semantic::g_zBufferTexture: return "g_zBufferTexture";
-        case Semantic::globalConstants_fxh: return "globalConstants_fxh";
-        case Semantic::globalLight: return "globalLight";
-        case Semantic::globalLight_fx_globals: return "globalLight_fx_globals";
-        case Semantic::grass: return "grass";
-        case Semantic::heatMask: return "heatMask";
-        case Semantic::heightMap: return "heightMap";
-        case Semantic::hideFlatness: return "hideFlatness";
-        case Semantic::hologram_fxh: return "hologram_fxh";
-        case Semantic::index: return "index";
-        case Semantic::inverted: return "inverted";
-        case Semantic::knN: return "knN";
-        case Semantic::knNcloud_fxh: return "knNcloud_fxh";
-        case Semantic::knNg_fogNear: return "knNg_fogNear";
-        case Semantic::knNg_fogSkyFar: return "knNg_fogSkyFar";
-        case Semantic::knNg_fogSkyNear: return "knNg_fogSkyNear";
-        case Semantic::knNscreenspace_fxh: return "knNscreenspace_fxh";
-        case Semantic::knNwater_fx: return "knNwater_fx";
-        case Semantic::light: return "light";
-        case Semantic::lightColor: return "lightColor";
-        case Semantic::lightDirection: return "lightDirection";
-        case Semantic::lightFalloff: return "lightFalloff";
-        case Semantic::lightPosition: return "lightPosition";
-        case Semantic::lightTypeRSM: return "lightTypeRSM";
-        case Semantic::lightingRadius: return "lightingRadius";
-        case Semantic::lightsIndexes: return "lightsIndexes";
-        case Semantic::litMode: return "litMode";
-        case Semantic::lookup: return "lookup";
-        case Semantic::m43World: return "m43World";
-        case Semantic::m44RefCameraMatrix: return "m44RefCameraMatrix";
-        case Semantic::m44World: return "m44World";
-        case Semantic::map: return "map";
-        case Semantic::mask: return "mask";
-        case Semantic::maskTexture: return "maskTexture";
-        case Semantic::mixed: return "mixed";
-        case Semantic::modelInstanced: return "modelInstanced";
-        case Semantic::modelInstanced_fx_globals: return "modelInstanced_fx_globals";
-        case Semantic::motionBlur: return "motionBlur";
-        case Semantic::motionBlur_fx_globals: return "motionBlur_fx_globals";
-        case Semantic::motionFixup: return "motionFixup";
-        case Semantic::multiDataTexture: return "multiDataTexture";
-        case Semantic::nLodIndex: return "nLodIndex";
-        case Semantic::negative: return "negative";
-        case Semantic::noise: return "noise";
-        case Semantic::noise32x32x32: return "noise32x32x32";
-        case Semantic::none: return "none";
-        case Semantic::normalTexture: return "normalTexture";
-        case Semantic::normalsTexture: return "normalsTexture";
-        case Semantic::options: return "options";
-        case Semantic::overlay: return "overlay";
-        case Semantic::overlayEdge: return "overlayEdge";
-        case Semantic::overlayScale: return "overlayScale";
-        case Semantic::particle: return "particle";
-        case Semantic::particlescommon_fxh: return "particlescommon_fxh";
-        case Semantic::periodic: return "periodic";
-        case Semantic::perlinNoise3D_Equalized: return "perlinNoise3D_Equalized";
-        case Semantic::perlinNoiseTexture: return "perlinNoiseTexture";
-        case Semantic::pixel: return "pixel";
-        case Semantic::pointLight: return "pointLight";
-        case Semantic::pointLight_fx_globals: return "pointLight_fx_globals";
-        case Semantic::positions: return "positions";
-        case Semantic::post: return "post";
-        case Semantic::post_fx_globals: return "post_fx_globals";
-        case Semantic::postlowend_fx: return "postlowend_fx";
-        case Semantic::primitive3D: return "primitive3D";
-        case Semantic::primitive3D_fx_globals: return "primitive3D_fx_globals";
-        case Semantic::primitiveBillboard: return "primitiveBillboard";
-        case Semantic::primitiveBillboard_fx_globals: return "primitiveBillboard_fx_globals";
-        case Semantic::probe: return "probe";
-        case Semantic::red: return "red";
-        case Semantic::refraction: return "refraction";
-        case Semantic::rga: return "rga";
-        case Semantic::rgba: return "rgba";
-        case Semantic::rigidInstanced_depth: return "rigidInstanced_depth";
-        case Semantic::rigid_depth: return "rigid_depth";
-        case Semantic::rigid_depth_fx_globals: return "rigid_depth_fx_globals";
-        case Semantic::sampleOffsets: return "sampleOffsets";
-        case Semantic::sampleOffsets32: return "sampleOffsets32";
-        case Semantic::samplerMinAnisotropicMagLinearMipNoneClampMaxAnisotropy4: return "samplerMinAnisotropicMagLinearMipNoneClampMaxAnisotropy4";
-        case Semantic::samplerMinAnisotropicMagLinearMipPointClampMaxAnisotropy4: return "samplerMinAnisotropicMagLinearMipPointClampMaxAnisotropy4";
-        case Semantic::samplerMinAnisotropicMagLinearMipPointWrapMaxAnisotropy4: return "samplerMinAnisotropicMagLinearMipPointWrapMaxAnisotropy4";
-        case Semantic::samplerMinAnisotropicMagMipLinearBorderMaxAnisotropy8: return "samplerMinAnisotropicMagMipLinearBorderMaxAnisotropy8";
-        case Semantic::samplerMinAnisotropicMagMipLinearClampMaxAnisotropy4: return "samplerMinAnisotropicMagMipLinearClampMaxAnisotropy4";
-        case Semantic::samplerMinAnisotropicMagMipLinearWrapMaxAnisotropy8: return "samplerMinAnisotropicMagMipLinearWrapMaxAnisotropy8";
-        case Semantic::samplerMinMagLinearMipNoneClamp: return "samplerMinMagLinearMipNoneClamp";
-        case Semantic::samplerMinMagLinearMipNoneClampLess: return "samplerMinMagLinearMipNoneClampLess";
-        case Semantic::samplerMinMagLinearMipNoneMirror: return "samplerMinMagLinearMipNoneMirror";
-        case Semantic::samplerMinMagLinearMipNoneWrap: return "samplerMinMagLinearMipNoneWrap";
-        case Semantic::samplerMinMagLinearMipPointClamp: return "samplerMinMagLinearMipPointClamp";
-        case Semantic::samplerMinMagLinearMipPointClampBiasNeg0_5: return "samplerMinMagLinearMipPointClampBiasNeg0_5";
-        case Semantic::samplerMinMagLinearMipPointMirrorOnceUClampV: return "samplerMinMagLinearMipPointMirrorOnceUClampV";
-        case Semantic::samplerMinMagLinearMipPointWrap: return "samplerMinMagLinearMipPointWrap";
-        case Semantic::samplerMinMagLinearMipPointWrapUClampV: return "samplerMinMagLinearMipPointWrapUClampV";
-        case Semantic::samplerMinMagMipLinearClamp: return "samplerMinMagMipLinearClamp";
-        case Semantic::samplerMinMagMipLinearWrap: return "samplerMinMagMipLinearWrap";
-        case Semantic::samplerMinMagMipLinearWrapBiasNeg0_5: return "samplerMinMagMipLinearWrapBiasNeg0_5";
-        case Semantic::samplerMinMagMipLinearWrapMaxAnisotropy8: return "samplerMinMagMipLinearWrapMaxAnisotropy8";
-        case Semantic::samplerMinMagMipLinearWrapUClampV: return "samplerMinMagMipLinearWrapUClampV";
-        case Semantic::samplerMinMagMipPointClamp: return "samplerMinMagMipPointClamp";
-        case Semantic::samplerMinMagMipPointWrap: return "samplerMinMagMipPointWrap";
-        case Semantic::samplerMinMagMipPointWrapUClampV: return "samplerMinMagMipPointWrapUClampV";
-        case Semantic::samplerMinMagPointMipNoneBorder: return "samplerMinMagPointMipNoneBorder";
-        case Semantic::samplerMinMagPointMipNoneClamp: return "samplerMinMagPointMipNoneClamp";
-        case Semantic::samplerMinMagPointMipNoneMirror: return "samplerMinMagPointMipNoneMirror";
-        case Semantic::samplerMinMagPointMipNoneWrap: return "samplerMinMagPointMipNoneWrap";
-        case Semantic::scale: return "scale";
-        case Semantic::scattering: return "scattering";
-        case Semantic::screenspace_fxh: return "screenspace_fxh";
-        case Semantic::shader: return "shader";
-        case Semantic::shadowing_fxh: return "shadowing_fxh";
-        case Semantic::should: return "should";
-        case Semantic::sided: return "sided";
-        case Semantic::simpleemissive_fx: return "simpleemissive_fx";
-        case Semantic::skyLerp: return "skyLerp";
-        case Semantic::skyLerp2: return "skyLerp2";
-        case Semantic::skyLerp3: return "skyLerp3";
-        case Semantic::skyOffset: return "skyOffset";
-        case Semantic::skyOffset2: return "skyOffset2";
-        case Semantic::skyOffset3: return "skyOffset3";
-        case Semantic::skyOffset4: return "skyOffset4";
-        case Semantic::skyStretch: return "skyStretch";
-        case Semantic::skyStretch2: return "skyStretch2";
-        case Semantic::skyStretch3: return "skyStretch3";
-        case Semantic::skyStretch4: return "skyStretch4";
-        case Semantic::skyTexture: return "skyTexture";
-        case Semantic::skyTexture2: return "skyTexture2";
-        case Semantic::skyTexture3: return "skyTexture3";
-        case Semantic::skyTexture4: return "skyTexture4";
-        case Semantic::skyTextureSkyDomeUniqueName: return "skyTextureSkyDomeUniqueName";
-        case Semantic::sky_fx: return "sky_fx";
-        case Semantic::sky_fx_globals: return "sky_fx_globals";
-        case Semantic::skycube_fx: return "skycube_fx";
-        case Semantic::skydome_fx: return "skydome_fx";
-        case Semantic::skyhorizon_fx: return "skyhorizon_fx";
-        case Semantic::slop: return "slop";
-        case Semantic::smartBlur: return "smartBlur";
-        case Semantic::smartBlur_fx_globals: return "smartBlur_fx_globals";
-        case Semantic::softness: return "softness";
-        case Semantic::space: return "space";
-        case Semantic::spec: return "spec";
-        case Semantic::specMap: return "specMap";
-        case Semantic::specMinMax1: return "specMinMax1";
-        case Semantic::specMinMax2: return "specMinMax2";
-        case Semantic::specMinMax3: return "specMinMax3";
-        case Semantic::specMinMax4: return "specMinMax4";
-        case Semantic::specMinMax5: return "specMinMax5";
-        case Semantic::specTexture: return "specTexture";
-        case Semantic::specTexture1: return "specTexture1";
-        case Semantic::specTexture2: return "specTexture2";
-        case Semantic::specTexture3: return "specTexture3";
-        case Semantic::specTexture4: return "specTexture4";
-        case Semantic::specTexture5: return "specTexture5";
-        case Semantic::speed: return "speed";
-        case Semantic::spriteParticle: return "spriteParticle";
-        case Semantic::spriteParticle_fx_globals: return "spriteParticle_fx_globals";
-        case Semantic::square: return "square";
-        case Semantic::srcBlend: return "srcBlend";
-        case Semantic::ssaoSourceDepthTexture: return "ssaoSourceDepthTexture";
-        case Semantic::stepping: return "stepping";
-        case Semantic::streakParticle: return "streakParticle";
-        case Semantic::streakParticle_fx_globals: return "streakParticle_fx_globals";
-        case Semantic::structureblend_fx: return "structureblend_fx";
-        case Semantic::sunlight_fxh: return "sunlight_fxh";
-        case Semantic::swayInstancedDepth_VS3_PS3: return "swayInstancedDepth_VS3_PS3";
-        case Semantic::swayInstanced_depth: return "swayInstanced_depth";
-        case Semantic::swayInstanced_depth_fx_globals: return "swayInstanced_depth_fx_globals";
-        case Semantic::sway_depth: return "sway_depth";
-        case Semantic::sway_depth_fx_globals: return "sway_depth_fx_globals";
-        case Semantic::targetDepthTexture: return "targetDepthTexture";
-        case Semantic::terrain_audit: return "terrain_audit";
-        case Semantic::terrain_audit_fx_globals: return "terrain_audit_fx_globals";
-        case Semantic::terrain_depth: return "terrain_depth";
-        case Semantic::terrain_fxh: return "terrain_fxh";
-        case Semantic::terrain_rsm: return "terrain_rsm";
-        case Semantic::terrain_rsm_fx_globals: return "terrain_rsm_fx_globals";
-        case Semantic::texA: return "texA";
-        case Semantic::texB: return "texB";
-        case Semantic::texProj: return "texProj";
-        case Semantic::texture: return "texture";
-        case Semantic::textureMap: return "textureMap";
-        case Semantic::threshold: return "threshold";
-        case Semantic::threshold_fx_globals: return "threshold_fx_globals";
-        case Semantic::tiled: return "tiled";
-        case Semantic::tiling: return "tiling";
-        case Semantic::tint: return "tint";
-        case Semantic::tonemap: return "tonemap";
-        case Semantic::tonemap_fx_globals: return "tonemap_fx_globals";
-        case Semantic::transform: return "transform";
-        case Semantic::translation: return "translation";
-        case Semantic::transmittance: return "transmittance";
-        case Semantic::transparency: return "transparency";
-        case Semantic::tread: return "tread";
-        case Semantic::usually: return "usually";
-        case Semantic::uvOffset: return "uvOffset";
-        case Semantic::uvScale: return "uvScale";
-        case Semantic::v2Random: return "v2Random";
-        case Semantic::v3Horizontal: return "v3Horizontal";
-        case Semantic::v3Vertical: return "v3Vertical";
-        case Semantic::v4Color: return "v4Color";
-        case Semantic::v4ReplicationMask: return "v4ReplicationMask";
-        case Semantic::v4Tint: return "v4Tint";
-        case Semantic::vehicle_fx: return "vehicle_fx";
-        case Semantic::view: return "view";
-        case Semantic::water: return "water";
-        case Semantic::water2013_fx: return "water2013_fx";
-        case Semantic::waterMinimap: return "waterMinimap";
-        case Semantic::waterMinimap_fx_globals: return "waterMinimap_fx_globals";
-        case Semantic::water_fx: return "water_fx";
-        case Semantic::water_fx_globals: return "water_fx_globals";
-        case Semantic::wave: return "wave";
-        case Semantic::whatever: return "whatever";
-        case Semantic::when: return "when";
-        case Semantic::with: return "with";
-        case Semantic::world: return "world";
-        case Semantic::worldNormalMap: return "worldNormalMap";
-        case Semantic::writeAlpha: return "writeAlpha";
-        case Semantic::writeAlphaMode: return "writeAlphaMode";
-        case Semantic::UNKNOWN: return "UNKNOWN";
-        default: return "Unknown! Got semantic (" + std::to_string((uint32_t)semantic) + ")";
+static constexpr perfect_hash::Table<std::string_view, 756, 3026> semantic_name_table = {{
+    {
+        20u, 5u, 7u, 10u, 129u, 11u, 45u, 2u,
+        19u, 96u, 161u, 3u, 5u, 33u, 13u, 62u,
+        1u, 29u, 127u, 73u, 48u, 6u, 19u, 11u,
+        19u, 11u, 9u, 63u, 201u, 32u, 12u, 12u,
+        46u, 1u, 393u, 4u, 5u, 24u, 16u, 24u,
+        31u, 8u, 56u, 113u, 224u, 0u, 33u, 2u,
+        4u, 6u, 1u, 1u, 27u, 34u, 23u, 3u,
+        73u, 2u, 2u, 3u, 9u, 3u, 19u, 1u,
+        400u, 26u, 40u, 79u, 2u, 7u, 11u, 0u,
+        78u, 1u, 11u, 8u, 10u, 1u, 88u, 42u,
+        10u, 147u, 8u, 7u, 1u, 33u, 5u, 69u,
+        11u, 1u, 12u, 21u, 61u, 63u, 1u, 190u,
+        45u, 16u, 77u, 14u, 2u, 1u, 97u, 2u,
+        2u, 3u, 5u, 9u, 1u, 49u, 27u, 46u,
+        1u, 7u, 268u, 126u, 94u, 230u, 34u, 32u,
+        1u, 95u, 19u, 20u, 143u, 12u, 23u, 3u,
+        1u, 15u, 6u, 77u, 1u, 1u, 22u, 95u,
+        1u, 11u, 1u, 79u, 99u, 2u, 368u, 2u,
+        1u, 51u, 114u, 17u, 18u, 441u, 94u, 238u,
+        1u, 337u, 2u, 42u, 13u, 1u, 1u, 13u,
+        401u, 22u, 10u, 47u, 1u, 28u, 9u, 38u,
+        68u, 47u, 63u, 271u, 2u, 50u, 1u, 72u,
+        41u, 1u, 20u, 1u, 1u, 1u, 3u, 21u,
+        11u, 37u, 36u, 1u, 39u, 0u, 2u, 0u,
+        26u, 724u, 36u, 105u, 35u, 69u, 9u, 20u,
+        41u, 1u, 224u, 16u, 599u, 134u, 35u, 1u,
+        65u, 88u, 2u, 1u, 1u, 3u, 55u, 394u,
+        34u, 5u, 19u, 26u, 90u, 742u, 1128u, 32u,
+        1u, 5u, 25u, 68u, 8u, 3u, 10u, 3u,
+        16u, 124u, 25u, 11u, 70u, 48u, 19u, 1u,
+        1u, 6u, 16u, 0u, 15u, 281u, 10u, 4u,
+        1u, 5u, 5u, 43u, 94u, 5u, 1u, 1u,
+        20u, 7u, 2u, 229u, 25u, 8u, 10u, 100u,
+        618u, 1u, 23u, 38u, 16u, 6u, 184u, 100u,
+        142u, 69u, 12u, 35u, 11u, 247u, 105u, 129u,
+        48u, 0u, 41u, 11u, 2u, 547u, 16u, 13u,
+        45u, 4u, 4u, 20u, 40u, 30u, 193u, 16u,
+        58u, 45u, 221u, 2u, 6u, 332u, 73u, 24u,
+        5u, 146u, 23u, 437u, 25u, 4u, 24u, 4u,
+        208u, 2u, 65u, 0u, 191u, 21u, 8u, 1u,
+        23u, 19u, 93u, 23u, 75u, 134u, 122u, 4u,
+        48u, 628u, 56u, 0u, 1u, 112u, 42u, 259u,
+        1600u, 9u, 137u, 77u, 133u, 37u, 205u, 868u,
+        1u, 0u, 5u, 38u, 269u, 360u, 2u, 7u,
+        90u, 261u, 35u, 92u, 508u, 94u, 1u, 7u,
+        52u, 31u, 5u, 88u, 21u, 51u, 1u, 365u,
+        20u, 512u, 69u, 48u, 461u, 1u, 63u, 90u,
+        450u, 1u, 102u, 97u, 4u, 232u, 25u, 19u,
+        6u, 2u, 148u, 1u, 48u, 1u, 135u, 3u,
+        193u, 50u, 1u, 35u, 23u, 21u, 181u, 41u,
+        3u, 391u, 75u, 2u, 8u, 173u, 4u, 4u,
+        331u, 5u, 980u, 128u, 82u, 628u, 55u, 13u,
+        7u, 30u, 160u, 21u, 70u, 2u, 5u, 35u,
+        20u, 383u, 90u, 361u, 84u, 434u, 116u, 14u,
+        1u, 4u, 438u, 106u, 778u, 58u, 230u, 123u,
+        58u, 296u, 21u, 362u, 1105u, 68u, 606u, 5u,
+        39u, 44u, 281u, 67u, 95u, 1u, 5u, 1u,
+        43u, 52u, 28u, 109u, 314u, 9u, 71u, 119u,
+        38u, 21u, 53u, 40u, 446u, 81u, 123u, 97u,
+        417u, 213u, 107u, 197u, 7u, 597u, 10u, 2u,
+        123u, 6u, 134u, 105u, 1u, 1687u, 32u, 221u,
+        594u, 371u, 15u, 33u, 154u, 0u, 2u, 127u,
+        106u, 11u, 865u, 23u, 0u, 21u, 49u, 877u,
+        222u, 440u, 85u, 60u, 1103u, 0u, 0u, 22u,
+        63u, 2u, 66u, 763u, 42u, 288u, 3896u, 80u,
+        2u, 175u, 6u, 30u, 79u, 108u, 746u, 133u,
+        18u, 28u, 5u, 16u, 283u, 1u, 20u, 1u,
+        5u, 268u, 147u, 20u, 6u, 1u, 23u, 603u,
+        1u, 818u, 1u, 1367u, 14u, 229u, 235u, 6u,
+        26u, 48u, 5u, 326u, 1624u, 1716u, 573u, 773u,
+        165u, 133u, 182u, 43u, 31u, 419u, 37u, 848u,
+        178u, 37u, 856u, 56u, 6541u, 15u, 1299u, 38u,
+        18u, 66u, 168u, 10u, 1u, 15u, 1277u, 129u,
+        229u, 505u, 40u, 163u, 974u, 364u, 3068u, 112u,
+        41u, 282u, 1143u, 100u, 17u, 25u, 430u, 324u,
+        10u, 2u, 1874u, 1083u, 607u, 22u, 89u, 41u,
+        51u, 341u, 71u, 157u, 1952u, 2u, 324u, 153u,
+        266u, 8u, 192u, 1u, 0u, 182u, 91u, 11u,
+        155u, 11u, 215u, 10u, 21u, 110u, 301u, 1u,
+        6u, 14u, 255u, 472u, 251u, 0u, 535u, 13u,
+        3u, 1u, 679u, 3860u, 2869u, 242u, 41u, 1843u,
+        1020u, 32u, 2u, 4u, 379u, 775u, 11u, 32u,
+        1559u, 2139u, 794u, 69u, 2u, 13u, 3370u, 1019u,
+        2123u, 63u, 0u, 4221u, 2u, 428u, 378u, 3u,
+        340u, 1080u, 159u, 246u, 1487u, 20u, 1338u, 1526u,
+        53u, 12u, 80u, 193u, 67u, 204u, 377u, 1567u,
+        57u, 1u, 670u, 5u, 30u, 9u, 293u, 9u,
+        101u, 1u, 1u, 27u, 4608u, 1804u, 559u, 898u,
+        271u, 206u, 10u, 2u, 44u, 51u, 1112u, 57u,
+        51u, 6u, 685u, 77u, 4u, 35u, 113u, 52u,
+        1068u, 3670u, 5917u, 729u, 1u, 46u, 24u, 4u,
+        14u, 1354u, 38u, 124u, 91u, 3u, 311u, 1620u,
+        274u, 1424u, 4u, 50u, 1974u, 116u, 1068u, 1426u,
+        15u, 26u, 1685u, 1143u, 2u, 262u, 160u, 2596u,
+        660u, 5657u, 10u, 39u,
     }
-}
\ No newline at end of file
+}, {
+    {
+        {3755196965u, "g_alphaClipShadowBias"},
+        {376862353u, "Water2013"},
+        {3657159654u, "GlowOffset"},
+        {909722767u, "sampleOffsets"},
+        {1232798322u, "TintAlpha"},
+        {3986643836u, "MiniMapLight"},
+        {2899543638u, "debug_font"},
+        {557518287u, "g_stratusScrollU"},
+        {722670166u, "OverlayA"},
+        {3080044377u, "UV2"},
+        {1231552575u, "CloudAnimationOffsetV"},
+        {270886836u, "whatever"},
+        {3789717782u, "g_ForceFieldOpacity"},
+        {3307287772u, "StructureInstanced"},
+        {1786215855u, "ExtraTintOpacity"},
+        {3670091651u, "g_shadowMode"},
+        {3907678262u, "g_InteriorProbeWeight"},
+        {1478565610u, "g_FFPlanarPerlinNoise3DTexture"},
+        {3504033937u, "DXBCk"},
+        {3506094927u, "Dielectric"},
+        {4036487993u, "g_PerlinNoise3DTexture"},
+        {621110676u, "HotMorph"},
+        {3687099411u, "OSGNt"},
+        {4217767806u, "Caustics_N"},
+        {743231657u, "SatelliteHdrTexture"},
+        {2102601970u, "ColorTexture4"},
+        {1318873489u, "swayInstancedDepth_VS3_PS3"},
+        {1066239875u, "g_waterHeight"},
+        {2417240272u, "Depth_Rigid"},
+        {3457420642u, "MinNightColor"},
+        {1156287252u, "g_BacksideSpec"},
+        {28783620u, "GlowWith2Textures_Tinted"},
+        {3955864196u, "StreakParticleInWater"},
+        {1109037901u, "g_sunLightDirWorldSpace"},
+        {2338092103u, "lightTypeRSM"},
+        {4205209110u, "g_skyLightProbeColor0Texture"},
+        {2387738094u, "InvGamma"},
+        {748543065u, "RainbowRadial"},
+        {1940406000u, "fogblur"},
+        {4069340172u, "Reduce"},
+        {2381474472u, "Tiling"},
+        {3581011061u, "g_causticOverlayTexture"},
+        {2795425067u, "C"},
+        {1606239226u, "samplerMinAnisotropicMagMipLinearBorderMaxAnisotropy8"},
+        {3030791378u, "WaterTiling"},
+        {665897018u, "g_ExtraTintColorA"},
+        {2758111818u, "specTexture2"},
+        {2255341195u, "MaxValue"},
+        {3171186590u, "DXT5_NM"},
+        {1757275279u, "Distortion"},
+        {3441512824u, "CloakColorDistortion_Skinned"},
+        {3077783009u, "TilingTintMidtone"},
+        {2351964300u, "NoDepth"},
+        {3855881229u, "DepthSource"},
+        {1395094819u, "g_PreLitTexture"},
+        {63805397u, "NoiseThickness"},
+        {1368781199u, "terrain_fxh"},
+        {2324383437u, "Shader"},
+        {2255501035u, "L8"},
+        {210238512u, "AMicrosoft"},
+        {802296468u, "ProjDecal"},
+        {1233921088u, "DXBC8F"},
+        {3362185467u, "UV1"},
+        {2224396214u, "Gux"},
+        {1128172462u, "WaveScrollV"},
+        {2901535418u, "RippleY"},
+        {3972784385u, "ShadowDepthScales"},
+        {1257189798u, "ShadowViewProj"},
+        {2570303290u, "FtAO"},
+        {3420246244u, "MotionTiles"},
+        {3407832892u, "motionBlur_fx_globals"},
+        {1671633513u, "SpriteParticle_FullRes"},
+        {1104680144u, "TrailParticleEmitterFillVisualization_fx_globals"},
+        {3677352273u, "g_zBufferTexture"},
+        {381128087u, "EvComp"},
+        {1381448879u, "AScroll2"},
+        {2316036666u, "ToneMapLowEnd"},
+        {1617206093u, "Foam"},
+        {1821596667u, "g_SparkFlowZ"},
+        {1269952996u, "NightVisionIntensity"},
+        {3303945314u, "FoliageSingleSided"},
+        {1552541664u, "DXBC9"},
+        {1705755303u, "samplerMinMagLinearMipNoneMirror"},
+        {4038036976u, "auNoiseScale"},
+        {3637878481u, "CloudTexture"},
+        {3975259592u, "samplerMinMagLinearMipPointMirrorOnceUClampV"},
+        {3004184771u, "BackfaceMinOpacity"},
+        {1412984240u, "DeRes_RigidSkinned_1Overlay"},
+        {129056312u, "DXBC0"},
+        {1140969567u, "g_TilingTintTexture"},
+        {362657920u, "Standard"},
+        {4248650623u, "Opaque_Rigid_4Overlay"},
+        {2185162724u, "g_shadowDepthScale"},
+        {1712207983u, "g_FullScreenEffectDOF"},
+        {550750033u, "texture"},
+        {441948904u, "g_scroll1_V"},
+        {1284585867u, "CloudAnimationShift"},
+        {119741480u, "g_zBufferStructuresTexture"},
+        {3083002592u, "texA"},
+        {2137583269u, "inverted"},
+        {389670916u, "g_sunBiasedHorizonWidthHeightLatSundis"},
+        {2756863512u, "g_noiseTexture2D"},
+        {1233880807u, "streakParticle"},
+        {2827620222u, "space"},
+        {3706899984u, "lookup"},
+        {4290326068u, "DXBCe"},
+        {2501081678u, "ScaleB"},
+        {1342078353u, "spec"},
+        {4290225456u, "Trunk_fx_globals"},
+        {1512525310u, "SpecBlendNormalYMap1"},
+        {907353467u, "Planet"},
+        {2822903763u, "TwoSided_Depth"},
+        {4229764852u, "g_UseUV1ForOverlayMask"},
+        {3720574789u, "CloakDistortion_RigidSkinned"},
+        {1896569369u, "SimpleSpriteParticleEmitterFillVisualization_fx_globals"},
+        {1703288507u, "ReduceBloom"},
+        {2108458116u, "g_texScrollU2"},
+        {3599952335u, "SkyTexture"},
+        {2040871334u, "g_FFDistortionScaleV"},
+        {3411489880u, "DesignerInstanced"},
+        {3946418532u, "TurbulenceScale"},
+        {1583266140u, "g_NormalDistortion"},
+        {3334105122u, "HideFlatness"},
+        {3256348738u, "g_infraRedScanLines"},
+        {1765717308u, "SatelliteUVOffsetNScale"},
+        {3205907626u, "ConvertDepth"},
+        {4006985193u, "transmittance"},
+        {1590879657u, "HLSL"},
+        {2259416086u, "KtkPN"},
+        {522365605u, "Overlay2ColorChannel"},
+        {4121298165u, "SpecBlendNormalYMap3"},
+        {1895166595u, "Worldspace"},
+        {681478253u, "TilingTintOpacity"},
+        {238832661u, "g_UVsPerMeter0"},
+        {3462546994u, "HotRoll"},
+        {266779338u, "SimpleSpriteParticleEmitterDistortion_fx_globals"},
+        {2016212566u, "floraModelInstanced_fx_globals"},
+        {2285164000u, "FoliageInstanced_fx_globals"},
+        {1092061151u, "BumpMap1"},
+        {2281647770u, "ColorTexture"},
+        {3230200367u, "Power"},
+        {1686513652u, "Cloak_Rigid_4Overlay"},
+        {763529670u, "DXBCH"},
+        {2062820316u, "SunFalloffsStarsBlend"},
+        {3144805510u, "Set"},
+        {3601534683u, "LowEnd"},
+        {2929066903u, "g_particleColor"},
+        {3242022369u, "g_Width"},
+        {4204039870u, "g_RollTiling"},
+        {1813479990u, "Lt"},
+        {1548428129u, "ISGNh"},
+        {3932593778u, "_FarClip"},
+        {3357392650u, "DXBCB"},
+        {52260908u, "RainbowRadialStrength"},
+        {31075145u, "SubsurfaceOcean"},
+        {1973459461u, "DXBCO"},
+        {368845529u, "g_enablePlanarMapAB"},
+        {3635047770u, "g_Overlay4ColorChannel"},
+        {2252790693u, "g_BumpTexture"},
+        {1222435954u, "g_swayScale"},
+        {3540104994u, "WorldNormalMap"},
+        {2464614428u, "CloudAnimationTiling"},
+        {4070181178u, "TexScale3"},
+        {624320542u, "HoloOpacity"},
+        {1402117393u, "Strength"},
+        {2940918596u, "TEXCOORD"},
+        {2880895517u, "CausticTex2"},
+        {4251478325u, "Ag_opacity"},
+        {2914581933u, "NoiseTiling"},
+        {1613358483u, "g_directionalLightColor"},
+        {4030367518u, "DeRes_Skinned_2Overlay"},
+        {561730879u, "AuraxiumDeRes_RigidSkinned_2Overlay"},
+        {2224419787u, "g_FrameRatio"},
+        {3765835698u, "g_bumpiness1"},
+        {715312489u, "AuraxiumOpaque_Rigid_1Overlay"},
+        {1555484666u, "ScaleEnd"},
+        {2530119320u, "AuraxiumDeRes"},
+        {1576736357u, "XRayGrid"},
+        {3113725989u, "ShadowProjector_fx_globals"},
+        {2801971079u, "g_Overlay4Texture"},
+        {3880974199u, "g_effectID"},
+        {1491511224u, "PickColor"},
+        {579456812u, "Blur_DX9_VS1_PS2"},
+        {2340912194u, "Vehicle"},
+        {2636374935u, "SparkFlowZ"},
+        {3635639092u, "knNg_fogNear"},
+        {1274290005u, "Scale2_U"},
+        {1830986160u, "g_ScaleMin"},
+        {3053928273u, "Options"},
+        {1754813088u, "samplerMinAnisotropicMagMipLinearClampMaxAnisotropy4"},
+        {3278845808u, "ColorMap"},
+        {242435356u, "g_TilingTintRotation"},
+        {2286181455u, "fog_fx_globals"},
+        {3788000682u, "g_sourceBlurQuarterUpscaleTexture"},
+        {1614684847u, "g_infraRedRange"},
+        {82261272u, "g_lookupTexture"},
+        {923748254u, "with"},
+        {339833724u, "TilingOverlay"},
+        {1002650230u, "g_ShieldDistance"},
+        {699281060u, "g_farClip"},
+        {327377183u, "g_scatterLight"},
+        {930736036u, "ProjDecalClear"},
+        {1261679643u, "g_foamTexture"},
+        {307170454u, "Fresnel"},
+        {2167614762u, "SimpleEmissive_fx_globals"},
+        {1883858026u, "MorphTiling"},
+        {343047398u, "DXBCRn"},
+        {3939171888u, "Bg_thermalColor"},
+        {1543019100u, "ObjectID"},
+        {80497510u, "AlphaChannel"},
+        {146124756u, "SwaySmoothing"},
+        {2197869836u, "Rough"},
+        {55420896u, "FoamScrollV"},
+        {3576844179u, "g_scroll2_V"},
+        {3577775686u, "g_Length"},
+        {3044613897u, "CloudSilverLiningThickness"},
+        {3021176506u, "SHEXp"},
+        {3821990947u, "g_Tint3"},
+        {2340157747u, "g_FadeModelMaterial"},
+        {988825360u, "Ecd"},
+        {1649577877u, "targetDepthTexture"},
+        {1444361906u, "StructureBlend"},
+        {388704911u, "g_texScrollZ3"},
+        {2354919266u, "g_lowEnd"},
+        {2889699245u, "Map"},
+        {106886367u, "DepthBias"},
+        {3730185253u, "blendStrength"},
+        {1523329224u, "g_smoothnessMax"},
+        {2116299372u, "g_FogOfWarParams"},
+        {2304966209u, "StructureInstanced_fx_globals"},
+        {2798959540u, "VisibleSkyIntensity"},
+        {326493344u, "Brightness"},
+        {992274154u, "g_gbuffer3Texture"},
+        {1310388666u, "FloraModel_VS3_PS3"},
+        {600397471u, "RigidDeResGlass"},
+        {3008429712u, "sky_fx"},
+        {2328515476u, "_Random"},
+        {1778318145u, "samplerMinMagMipPointWrap"},
+        {1376449557u, "DecalTintHighlight"},
+        {3364693172u, "g_sunLightWorldViewProj"},
+        {3963127531u, "Planar"},
+        {2104392949u, "normalTexture"},
+        {2917204801u, "ColorGrading"},
+        {3406971194u, "g_flareZoom"},
+        {3798600493u, "FFA"},
+        {1272333101u, "Lerp3"},
+        {1128722382u, "g_filterMode"},
+        {1284078606u, "SolidModelPosTech"},
+        {1725971963u, "DXT5"},
+        {2496698875u, "g_cameraEye"},
+        {900038855u, "Bumpiness3"},
+        {4001367833u, "Ly"},
+        {1706236478u, "ScreenFrameColor"},
+        {829745790u, "CloakDepth_Skinned"},
+        {3265866644u, "Pass0"},
+        {987145121u, "fogDepthColorGradientTexture"},
+        {1590407023u, "Scroll3_U"},
+        {318143638u, "TilingOverlayMask"},
+        {4002862826u, "g_FFPlanarColorTexture"},
+        {2471833041u, "ShieldColor"},
+        {3070407111u, "LvMj2"},
+        {4167487139u, "MinValue"},
+        {3037098516u, "LensCenterFalloffCutoff"},
+        {2834650554u, "g_ColdLavaTiling"},
+        {2414013317u, "TilingTint"},
+        {2592106164u, "Auraxium"},
+        {817319570u, "g_scroll3_V"},
+        {3143619614u, "ResourceName"},
+        {1730272708u, "MotionBlurPower"},
+        {3626084125u, "g_convertDepthMode"},
+        {3213995849u, "Bg_FFColorreduceBloom"},
+        {3519427795u, "CloakDistortion"},
+        {1040416716u, "Damage"},
+        {3411976292u, "RFL"},
+        {3978882475u, "Thickness"},
+        {3555691152u, "Ag_DetailBumpiness"},
+        {3283694080u, "AuraxiumDeRes_RigidSkinned_3Overlay"},
+        {1668193908u, "g_contrast"},
+        {3304469979u, "g_ambience"},
+        {4234355784u, "Lerp2"},
+        {646060500u, "DXBCoJ"},
+        {453827319u, "g_Brightness"},
+        {1039448677u, "sway_depth"},
+        {252371930u, "g_waterTiling"},
+        {1251153169u, "J"},
+        {1275025454u, "diffuseTexture"},
+        {603349141u, "ApplyToSky"},
+        {763768945u, "g_highlightTint"},
+        {732377366u, "LodScale"},
+        {552363486u, "TexScale2"},
+        {776954247u, "FtAn"},
+        {3645172927u, "Satellite"},
+        {481770271u, "specMinMax4"},
+        {3492899432u, "ParticleDistort"},
+        {3658975956u, "spriteParticle"},
+        {1771352497u, "g_HotRoll"},
+        {1258041917u, "Dg_step"},
+        {1155523988u, "PuBc"},
+        {1881004734u, "Shield"},
+        {3585266371u, "tint"},
+        {1378333147u, "OverlayNM"},
+        {2103910921u, "StratusCloudScrollU"},
+        {1203951042u, "TrailParticleEmitterDistortion"},
+        {2244076051u, "g_silverLiningBrightness"},
+        {1567766400u, "g_IrisVisionOffset"},
+        {4168361133u, "g_scroll"},
+        {822435615u, "GroundFog"},
+        {3631242823u, "g_holoReduceBloom"},
+        {157479438u, "Decal"},
+        {1171151001u, "FullScreenEffectVR"},
+        {59420634u, "TextureMap"},
+        {3802395682u, "DXBCj"},
+        {1923677902u, "DeResDepth_RigidSkinned"},
+        {2789871487u, "SCROLL"},
+        {1878086058u, "alpha"},
+        {3729943427u, "DXBCx"},
+        {1700602649u, "samplerMinMagMipPointClamp"},
+        {2541014829u, "ForceFieldColor"},
+        {939809385u, "g_shadowViewProj"},
+        {687679714u, "DeRes_Skinned_1Overlay"},
+        {3963160175u, "RDEFD3"},
+        {66091826u, "g_refraction"},
+        {40764561u, "HoloColor"},
+        {1488278606u, "SHEXP1"},
+        {3348178397u, "SHEXL"},
+        {1090473834u, "g_midtoneSaturation"},
+        {2944439567u, "terrain_depth"},
+        {1683947617u, "g_Ascroll3_V"},
+        {3949200778u, "DXBCd"},
+        {1402955931u, "fLodNearDistance"},
+        {3486093556u, "g_glowBase"},
+        {3049310819u, "Glass"},
+        {3354864444u, "g_DetailScale"},
+        {599828550u, "DXBCIZ"},
+        {3401714330u, "g_colorShiftStrength"},
+        {3030574248u, "g_FFColorCoordinateSpace"},
+        {363477238u, "samplerMinMagLinearMipNoneClampLess"},
+        {940599280u, "g_blackShiftStrength"},
+        {1806660466u, "XR"},
+        {843758617u, "ScalePower"},
+        {3691006627u, "detailBlendTexture2"},
+        {1190658596u, "_TimeStep"},
+        {3252601536u, "g_CausticsNMTexture"},
+        {2770739567u, "TwoSidedInstanced"},
+        {1647234965u, "Cloak_Rigid_0Overlay"},
+        {739383205u, "g_GlowContrast"},
+        {31059056u, "g_highlightSaturation"},
+        {3271679713u, "g_dielectricMin"},
+        {318233329u, "g_ForceFieldShieldColor"},
+        {2379204051u, "hologram_fxh"},
+        {2305615353u, "colorMapCube"},
+        {2454593915u, "g_fogSkyFar"},
+        {542118665u, "ResPattern"},
+        {1343938377u, "auEmissiveScale"},
+        {620614257u, "FoliageGlowScrollInstanced_fx_globals"},
+        {430178608u, "auMetallicMax"},
+        {1488811542u, "worldNormalMap"},
+        {3667342619u, "D"},
+        {3674672283u, "bumpTexture"},
+        {1767184818u, "g_enableTileUV0"},
+        {4246477830u, "g_fogShadowsEnable"},
+        {523714919u, "g_WaterReflectionTexture"},
+        {2535988522u, "g_SiltNFoamTexture"},
+        {1255781295u, "Wm"},
+        {229698747u, "_Bones"},
+        {3400566946u, "BFaceMaxOpacity"},
+        {1665299792u, "g_visibility"},
+        {1826669704u, "ISGNt"},
+        {28421796u, "KS"},
+        {1971664917u, "light"},
+        {2804763784u, "g_sourceTex"},
+        {367686581u, "DXBCkv"},
+        {2476446038u, "_PrevWorld"},
+        {2101932957u, "g_octaves"},
+        {1415426300u, "LensHazeSunSkyStr"},
+        {1168230763u, "g_OverlaySmoothing"},
+        {3054162916u, "Normal"},
+        {3553237814u, "samplerMinMagMipLinearWrapBiasNeg0_5"},
+        {3938795240u, "g_LeftFrame"},
+        {112149484u, "Empire"},
+        {2521880097u, "specTexture5"},
+        {3747452981u, "DirectionalLightColor"},
+        {427877698u, "Wave"},
+        {1099899882u, "g_prevVirtualViewMatrix"},
+        {4102776087u, "g_colorBlindFilterStrength"},
+        {3548104345u, "TwoSided_Depth_fx_globals"},
+        {417853904u, "V8q"},
+        {902568057u, "DON"},
+        {1751229163u, "Overlay3ColorChannel"},
+        {2518746681u, "DeResGlow"},
+        {3201842551u, "g_BacksideDesat"},
+        {465860269u, "DXBCxTfg"},
+        {4221497322u, "lightFalloff"},
+        {3017596156u, "Width"},
+        {4274278633u, "ColorMapTiling"},
+        {795248974u, "CloudBlend"},
+        {2499603309u, "ColdLava"},
+        {325226714u, "DXBCav"},
+        {2561141971u, "SkyLightProbeNormal0"},
+        {2031462555u, "foam"},
+        {3316400538u, "BloomStrength"},
+        {3058179411u, "Pointiness"},
+        {3581757524u, "g_glowMin"},
+        {2755895226u, "shader"},
+        {3246257174u, "samplerMinMagMipLinearWrapMaxAnisotropy8"},
+        {3078098515u, "g_backfaceTingIntensityFactor"},
+        {2252780680u, "map"},
+        {1512815500u, "LitMode"},
+        {2986635323u, "CumulusCloudScrollV"},
+        {2793155942u, "SkyStencilMaskEnabled"},
+        {443306034u, "Copy"},
+        {1301842640u, "SkyLightCoeff6"},
+        {3470651842u, "auBumpStrength"},
+        {1059673099u, "g_ExtraTintScale"},
+        {1546381499u, "g_TilingTintHighlight"},
+        {3960011804u, "g_rippleFreq"},
+        {844041166u, "Blur1"},
+        {3551661785u, "LocalBasis"},
+        {3774709988u, "DXBCsL"},
+        {3418831981u, "g_BackgroundColor"},
+        {1888282186u, "WaveScrollU"},
+        {2582726749u, "g_minNightIntensityOnColor"},
+        {3977037902u, "RigidDeResGlow"},
+        {4119069914u, "MinDayFoamC"},
+        {4204724811u, "g_ScaleBias"},
+        {3612562329u, "PlanarMapA"},
+        {3188992159u, "Alpha"},
+        {2431595438u, "g_wireFrameEnabled"},
+        {141410217u, "DXBCW"},
+        {924891722u, "STAT"},
+        {4073318942u, "OverlayMask"},
+        {2770324009u, "Q"},
+        {4204727284u, "SHEXP"},
+        {1385370941u, "ColorBlindFilter"},
+        {2249800410u, "DXBCq"},
+        {206985778u, "Visibility"},
+        {1304831716u, "Primitive2DTexture2_fx_globals"},
+        {1677424311u, "DXBCN"},
+        {1364734829u, "ExtraTintColorB"},
+        {2345314493u, "Dvt"},
+        {2194788962u, "TrailParticle"},
+        {2607123589u, "disables"},
+        {3346922437u, "BumpV2"},
+        {1662563457u, "g_enable"},
+        {2226532676u, "skyOffset3"},
+        {3571523431u, "detailTexture"},
+        {3394089454u, "g_holoOpacity"},
+        {2472594561u, "g_sunBiasedHorizonGlowColor"},
+        {1500705837u, "DXBCuO"},
+        {3216834260u, "StructureBlend_fx_globals"},
+        {4075142544u, "g_FullScreenEffectNone"},
+        {1272854800u, "HoloTilingRateV"},
+        {3914385431u, "TwoSided_fx_globals"},
+        {294250408u, "DXBCpl"},
+        {3296883471u, "DXBCa6"},
+        {830454428u, "world"},
+        {985077511u, "CausticTex"},
+        {3891460859u, "PlanarMapBrightness"},
+        {176596187u, "UseUV1ForOverlayMask"},
+        {2489017706u, "ShadowEnable"},
+        {2826057210u, "Overcast"},
+        {2999357148u, "SparkFlowX"},
+        {2181237254u, "DeResGlow_Skinned"},
+        {1383062100u, "g_maxDayIntensityOnFoam"},
+        {569316691u, "ProjDecalLighting"},
+        {1214664660u, "Double"},
+        {2534263327u, "globalLight"},
+        {2555156556u, "g_DecalTintMidtone"},
+        {2534135279u, "skyOffset4"},
+        {13187447u, "PatternColor"},
+        {3756797750u, "GradientRedBlueRed"},
+        {2003967708u, "g_applyToSky"},
+        {1703756102u, "AOEnable"},
+        {3073856840u, "LightPositionRSM"},
+        {2498723941u, "g_rippleSpeed"},
+        {2052294479u, "g_metallicMax"},
+        {3920245061u, "Scroll2_V"},
+        {2894954058u, "g_scroll2_U"},
+        {3394614749u, "ShieldDistortion_Skinned"},
+        {3956558225u, "BackFaceFadeDis"},
+        {1791105760u, "foliageglowscrollinstanced_fx"},
+        {2156208778u, "Size"},
+        {2715489844u, "DeResDepth"},
+        {1282206986u, "contribution"},
+        {3372921344u, "g_sourceTexture0"},
+        {2302638774u, "DaylightCompensator"},
+        {341236567u, "ToneMapLowEnd_fx_globals"},
+        {1560186648u, "g_Accumulate"},
+        {116886160u, "CopyInvert"},
+        {3394833620u, "g_Tint"},
+        {3361035837u, "Source"},
+        {856165401u, "EnvFilter_fx_globals"},
+        {2104856351u, "floramodelinstanced_fx"},
+        {796816798u, "RefCameraMatrix"},
+        {4015205708u, "DistortionSpeedV"},
+        {1900630301u, "multiDataTexture"},
+        {1168141025u, "Cloak_RigidSkinned_3Overlay"},
+        {2644015603u, "primitive3D_fx_globals"},
+        {4017355629u, "RDEFP"},
+        {218759004u, "Overlay1ColorChannel"},
+        {2365831679u, "EnableAlphaBlending"},
+        {2252909017u, "Water2013_fx_globals"},
+        {2197143919u, "SkyLightProbeNormal1"},
+        {98891099u, "g_Overlay2Texture"},
+        {797011908u, "BeamParticle_FullRes_RenderLevel2"},
+        {1751237003u, "g_fogGradient"},
+        {468757226u, "g_colorGrading"},
+        {737541288u, "blurSource"},
+        {2100882444u, "skyLerp"},
+        {1063243891u, "boil"},
+        {2542380346u, "g_scale1_V"},
+        {2718087996u, "SkyMaskStencilTech"},
+        {1996275104u, "TrailParticleEmitterFillVisualization"},
+        {4105267199u, "g_world"},
+        {3097771183u, "floraModel"},
+        {2611319810u, "g_nightVision"},
+        {831088920u, "SwayPrevSpeed"},
+        {2638832453u, "PostBloomCutoff"},
+        {2440318539u, "Backside"},
+        {3178065392u, "Transition"},
+        {3826843216u, "Accumulate"},
+        {471939647u, "samplerMinMagLinearMipPointClamp"},
+        {3980802757u, "Cloud_fx_globals"},
+        {2809859289u, "E3Brightness"},
+        {591426909u, "SourceTexture"},
+        {130082767u, "RigidCloak"},
+        {2945180274u, "SkyHorizon_fx_globals"},
+        {1805555788u, "TrailParticleFullResInWater"},
+        {920329111u, "g_depth"},
+        {1192854871u, "Overlay1Tiling"},
+        {1078760958u, "DirectionalLightDirection"},
+        {664981185u, "TexScrollV2"},
+        {61842925u, "g_Ascroll1_U"},
+        {92584538u, "SkyLightEnvmap"},
+        {1172113237u, "g_TilingTintTranslation"},
+        {1358245446u, "ParticlePCFShadows"},
+        {2901663286u, "SpecMap"},
+        {4273387258u, "swayInstanced_depth_fx_globals"},
+        {2162620457u, "BaseMaskB"},
+        {1109897712u, "Pre_Z"},
+        {3717488815u, "Metallic"},
+        {2356046063u, "UVs"},
+        {2337258698u, "SiltNFoamTexture"},
+        {795277530u, "ambientOcclusionUpsample"},
+        {2563120894u, "g_visibleSkyIntensity"},
+        {2246173806u, "g_streakElasticity"},
+        {1534438646u, "SkyDepth"},
+        {2592140036u, "SiltNFoam"},
+        {1214248164u, "g_amplitude"},
+        {670889642u, "Ot"},
+        {206674128u, "v3Horizontal"},
+        {3484852651u, "Overlay4UVSet"},
+        {3205952719u, "Surface"},
+        {481751439u, "Terrain2LayerLod"},
+        {1775439977u, "v4ReplicationMask"},
+        {630747505u, "Pass2"},
+        {3873395092u, "Base"},
+        {349904998u, "g_DecalUVSet"},
+        {1083676976u, "AScroll3"},
+        {1186038023u, "FtkPN"},
+        {1469417890u, "WaterReflectionHeight"},
+        {1031567248u, "skyTexture3"},
+        {2848430062u, "g_blueNoiseTexture"},
+        {4076791727u, "specMinMax5"},
+        {2318481101u, "SD"},
+        {1558194059u, "StreakElasticity"},
+        {3763434012u, "g_swayPrevBoil"},
+        {3486302127u, "UV"},
+        {2804108745u, "Translation"},
+        {716157339u, "TurbulenceDensityRange"},
+        {1981172492u, "MultiDataMap"},
+        {3631484813u, "BumpU1"},
+        {473165128u, "specMap"},
+        {1351468899u, "Pass6"},
+        {1191279314u, "BumpV3"},
+        {2659705091u, "SourceColor"},
+        {3458544045u, "CloakDistortion_Skinned"},
+        {1598687708u, "g_foamFallOff"},
+        {2196262636u, "ExtraTint"},
+        {3560254360u, "HoloEdge"},
+        {580673989u, "RDEFp"},
+        {2891707506u, "RDEF0"},
+        {2987662455u, "g_periodicTexture"},
+        {1254806126u, "g_targetColorTexture"},
+        {1170050728u, "g_motionTilesTexture"},
+        {4195744937u, "FinalTierShadowMap"},
+        {2068323268u, "Sigma"},
+        {1367648318u, "UVOffset"},
+        {2299629057u, "Opacity"},
+        {1465250111u, "TrailParticleEmitter_fx_globals"},
+        {74924163u, "g_TilingTintOpacity"},
+        {3727817345u, "HB8"},
+        {1610044255u, "DebugCharacterTranslucent_fx_globals"},
+        {2558390819u, "g_FFPlanarHottness"},
+        {2569089721u, "g_warpMode"},
+        {4119218362u, "g_fresnelFuncTexture"},
+        {1427420282u, "SkyHorizon"},
+        {840604889u, "ThermalViewFade"},
+        {3804548579u, "ForceFieldDistortion_planar"},
+        {3255694769u, "BumpTexture"},
+        {2710718368u, "g_DecalTintScale"},
+        {1112877439u, "g_NoiseThickness"},
+        {1529605028u, "SurfaceTexture"},
+        {4226337362u, "g_directionalLightViewSpaceDir"},
+        {1811293028u, "g_cumulusScrollV"},
+        {380055824u, "SubsurfaceStream"},
+        {3392997223u, "g_noise3DTexture"},
+        {1709400343u, "g_FFPlanarNoiseAlpha"},
+        {1467506256u, "g_godRayStartFade"},
+        {4027098147u, "Ag_TransitionOffset"},
+        {2457905760u, "SunLightDeferredShadow"},
+        {4166524758u, "DXBCi"},
+        {1426107729u, "SpriteParticleEmitterFillVisualization_fx_globals"},
+        {2403297649u, "_PrevViewProj"},
+        {4111816292u, "g_fogEnable"},
+        {350809938u, "tiling"},
+        {4008293777u, "Refract"},
+        {2928566123u, "g_KeyLuminance"},
+        {3505268418u, "SubsurfaceSwamp"},
+        {150255658u, "Pass4"},
+        {257019400u, "Overlay2Tiling"},
+        {2250555532u, "CV"},
+        {1789407092u, "g_gbuffer2Texture"},
+        {1480111797u, "g_timer"},
+        {3690407695u, "Edge"},
+        {4012988087u, "ThermalViewRange"},
+        {1598594305u, "g_FoamTexture"},
+        {3095280290u, "DeRes_RigidSkinned_2Overlay"},
+        {2894235719u, "UseDynamicWaterReflection"},
+        {3818774186u, "g_cubeFaceDir"},
+        {1875279216u, "IronSight"},
+        {3949348902u, "g_noiseSpeed"},
+        {3588785811u, "GlowBase"},
+        {1146570003u, "Foliage"},
+        {2032640850u, "FZ"},
+        {3177835126u, "GlazeMin"},
+        {2772010645u, "Overlay3"},
+        {3007871864u, "Length"},
+        {1721169705u, "LS"},
+        {3762204518u, "floramodel_fx"},
+        {3388785344u, "DXBCf"},
+        {3760495331u, "speed"},
+        {1098139140u, "g_eyePos"},
+        {3414268513u, "TintSemantic"},
+        {306298749u, "TransparentDepth"},
+        {3233276202u, "clover"},
+        {3810911693u, "g_highQualityLighting"},
+        {726454178u, "g_waterTimeMul"},
+        {1257833417u, "albedoTexture"},
+        {398479089u, "GroundFogTechnique"},
+        {1325373150u, "g_Power"},
+        {182493771u, "Terrain_VS2_PS2"},
+        {2942021790u, "Object_fx_globals"},
+        {3153779403u, "g_godRayEndFade"},
+        {3711546684u, "g_sourceTexture"},
+        {2162630069u, "CompositeSky_fx_globals"},
+        {1793669186u, "Speed"},
+        {3712371639u, "CloakDarkLightColor_RigidSkinned"},
+        {3983319406u, "g_EmissiveTexture"},
+        {1061685669u, "g_emissiveCorrectionLimit"},
+        {1295070915u, "AdditiveGlow_fx_globals"},
+        {2835512267u, "TwoSidedSway_depth"},
+        {1966231512u, "HalfResStreakParticle"},
+        {4072981338u, "g_worldMatrix"},
+        {997941274u, "DXBCha0"},
+        {3171132457u, "HAg_holoOpacity"},
+        {3487475855u, "g_PatternColor"},
+        {2812797878u, "FoamBrightness"},
+        {2953655865u, "g_EmpireTintB"},
+        {3671559372u, "g_enableVignette"},
+        {1575856898u, "ScatterConstants"},
+        {4130781795u, "g_FFDistortionSpeedU"},
+        {239836275u, "negative"},
+        {1852450427u, "perlinNoise3D_Equalized"},
+        {182308021u, "BLENDINDICES"},
+        {1698761638u, "Glass_Rigid"},
+        {3198286629u, "ambientOcclusion_fx_globals"},
+        {3734673659u, "DetailFrequency"},
+        {3588233394u, "g_ColorScrollU"},
+        {1519157941u, "_JitterOffset"},
+        {443655795u, "FogBlurPass"},
+        {606166644u, "SkyCube_fx_globals"},
+        {520435698u, "g_ShieldHottness"},
+        {1055960246u, "DXBC4"},
+        {2503960786u, "filldepth_fx_globals"},
+        {3366140176u, "NM"},
+        {196133667u, "colorMap"},
+        {1517232810u, "g_ShieldDistortion"},
+        {1022437511u, "DXBCl"},
+        {2846953776u, "DeRes_RigidSkinned_3Overlay"},
+        {201154243u, "knNg_fogSkyFar"},
+        {2372512927u, "g_WaveScrollU"},
+        {1942801057u, "RigidCloakDepth"},
+        {4290921249u, "fogLowEnd_fx_globals"},
+        {242839511u, "Spacing"},
+        {290917443u, "Primitive2DTexture3"},
+        {3738503832u, "Hologram_Skinned"},
+        {1132843931u, "DebugShader"},
+        {226560599u, "SwayStrength"},
+        {2607871760u, "g_dontCorrectCamera"},
+        {146172677u, "g_cameraDelta"},
+        {2397366784u, "PointLightPosition"},
+        {4285919832u, "SpriteParticleEmitter"},
+        {1752346981u, "GridPattern"},
+        {1095278361u, "RDEFH"},
+        {3796178247u, "Bias"},
+        {3937102236u, "g_specMin"},
+        {1178061076u, "positions"},
+        {245772489u, "StructureWsOverlay"},
+        {1139106767u, "g_screenDirtLookupTex"},
+        {2564387817u, "samplerMinMagPointMipNoneWrap"},
+        {3802275154u, "AuraxiumOpaque_RigidSkinned_1Overlay"},
+        {2957797488u, "_VirtualViewOffset"},
+        {2946290688u, "DXBC3w"},
+        {2039578454u, "AuraxiumOpaque_Skinned_3Overlay"},
+        {2359437188u, "g_holoTexture"},
+        {746044960u, "Source1"},
+        {18745625u, "E3Desat"},
+        {541279408u, "SkyFogShadowsEnabled"},
+        {2609783862u, "g_scroll3_U"},
+        {3749168874u, "GreenSource"},
+        {3348876593u, "AuraxiumDeRes_Skinned_0Overlay"},
+        {1011134229u, "StealthBlend"},
+        {2446407766u, "g_Overlay3Tiling"},
+        {1384521263u, "waterMinimap_fx_globals"},
+        {1033008497u, "flora_fxh"},
+        {728468415u, "ColorKeyB"},
+        {214772560u, "g_ShieldPatternTexture"},
+        {3073990664u, "AuraxiumOpaque_Rigid_4Overlay"},
+        {1711657232u, "knNwater_fx"},
+        {1047798576u, "Pass5"},
+        {3940483691u, "g_fogDistributionParams"},
+        {3861206860u, "distortion"},
+        {3527777912u, "FullscreenEffectID"},
+        {2299022688u, "g_Transmittance"},
+        {4125759813u, "InfraRedColor"},
+        {3071698967u, "g_texScrollX1"},
+        {1750308335u, "detailMaskTexture"},
+        {904206991u, "DXBCY"},
+        {919390646u, "Cloak_Skinned_4Overlay"},
+        {3256402651u, "TerrainLodTile"},
+        {469239617u, "ScaleX"},
+        {3494897402u, "g_FFDistortionScaleU"},
+        {2798135003u, "floraModel_fx_globals"},
+        {2172885210u, "_Camera"},
+        {3855831464u, "SkyRenderMode"},
+        {2451564135u, "TargetDepthTexture"},
+        {777519584u, "DecalTintTranslation"},
+        {1881268067u, "Dg_worldMatrix"},
+        {969685573u, "v4Tint"},
+        {2066937914u, "ParticlesShadowMode"},
+        {320520642u, "g_colorTexture"},
+        {2602481047u, "ForegroundWScale"},
+        {38658357u, "SatelliteColor"},
+        {736317207u, "g_foregroundZBias"},
+        {614452664u, "fogLowEnd"},
+        {2965603753u, "FrameCount"},
+        {259760644u, "VisualizerColor"},
+        {1056791691u, "ModelDoubleSided"},
+        {1281485727u, "g_prevProjMatrix"},
+        {3130841423u, "g_blend"},
+        {1643025164u, "GlassPass2"},
+        {4043549689u, "CCP"},
+        {1355011947u, "g_DecalTintTexture"},
+        {1678703666u, "Softness"},
+        {2708146953u, "Depth_Skinned"},
+        {1894353747u, "specTexture4"},
+        {1503492443u, "SkyColor"},
+        {1985312335u, "AutoTileFreq"},
+        {1353656786u, "g_glowThickness"},
+        {304210853u, "TextureType"},
+        {2919822464u, "g_foregroundWScale"},
+        {152244715u, "SourceCube"},
+        {3728674084u, "Bg_scanIntensity"},
+        {2993828927u, "SkyDome"},
+        {3023717255u, "Vehicle_fx_globals"},
+        {3794328304u, "bloomblur_fx_globals"},
+        {2472684644u, "BRDFlookup"},
+        {1510041883u, "Waters"},
+        {2351279691u, "FoliageSingleSided_fx_globals"},
+        {3248705908u, "SunDir"},
+        {2882105598u, "g_maxNightIntensityOnColor"},
+        {3843640385u, "samplerMinMagPointMipNoneMirror"},
+        {2015136269u, "g_ScalePower"},
+        {731449962u, "_PrevProjection"},
+        {1485069361u, "Cloak_Rigid_1Overlay"},
+        {3328123372u, "PostObscure"},
+        {1688627780u, "Wind"},
+        {1865141567u, "ShadowFilterSource"},
+        {2382221174u, "D1"},
+        {2235486168u, "DirectionBlurMode"},
+        {2755888106u, "different"},
+        {611456612u, "g_cumulusHeight"},
+        {2013293032u, "g_texScrollX2"},
+        {3034785256u, "Overlay2"},
+        {3547637423u, "g_Transparency"},
+        {4206866840u, "g_fDepthTransparancy"},
+        {3503602372u, "IrisClampLow"},
+        {4145941810u, "g_FlashIntensity"},
+        {2010680384u, "RDEFh"},
+        {1187250707u, "SolidTech"},
+        {1677822055u, "g_PatternScaler"},
+        {41533669u, "g_irisTexture"},
+        {3884288924u, "g_clarityOfSky"},
+        {3119943176u, "ThermalCold"},
+        {3878402005u, "simpleemissive_fx"},
+        {1219236980u, "g_ScaleB"},
+        {1365819729u, "g_sunPosition"},
+        {2110910314u, "LeftFrame"},
+        {1676795143u, "DeRes_Skinned_3Overlay"},
+        {2987331221u, "LensDirtLayer1SizeStrRanges"},
+        {550354755u, "World"},
+        {4016805117u, "LightFalloff"},
+        {3639437536u, "g_Overlay1Texture"},
+        {1591498173u, "DeRes_Skinned_0Overlay"},
+        {529327439u, "g_cubeFaceRight"},
+        {2645644561u, "SpecBlendNormalYMap5"},
+        {2521203015u, "g_v4Color"},
+        {80138043u, "GBuffer2"},
+        {557027655u, "g_prevWorldMatrix"},
+        {3863444457u, "BeamParticle_RenderLevel1"},
+        {2282005521u, "DebugVehicleTranslucent_fx_globals"},
+        {1522843109u, "g_PatternGlow"},
+        {3401022665u, "particle"},
+        {1948494447u, "Rigid"},
+        {3126824434u, "a_fAOSize"},
+        {2816795848u, "BackGround"},
+        {3364138087u, "ShadowEnableFastZ"},
+        {4044460477u, "g_sunShadowCoeffs"},
+        {2727571609u, "g_FFColorHottness"},
+        {1488702180u, "Backfaces"},
+        {737182746u, "ShieldReduceBloom"},
+        {2899344107u, "SpecSmoothnessMin"},
+        {661239163u, "samplerMinMagLinearMipNoneClamp"},
+        {4180392613u, "UVSet"},
+        {3078969052u, "Primitive2D_fx_globals"},
+        {4159847582u, "wave"},
+        {30345756u, "InfraRedOutlineColor"},
+        {3427495441u, "g_alphaEnabled"},
+        {2904742480u, "g_brightness"},
+        {2707303723u, "LRH"},
+        {572612140u, "Depth"},
+        {3313512287u, "RigidHologram"},
+        {146718795u, "DXBCT"},
+        {3269781796u, "g_ColorScale"},
+        {2016737833u, "Primitive3D"},
+        {834447101u, "g_floraNoiseTexture"},
+        {3431840573u, "OverlayScale"},
+        {1135671542u, "Primitive2DTexture3_fx_globals"},
+        {602229479u, "ScaleStart"},
+        {2191089725u, "TilingTintScale"},
+        {472856676u, "LightDirectionRSM"},
+        {1464021683u, "ScaleWavefrontSize"},
+        {568568944u, "RedChannel"},
+        {41023740u, "uvScale"},
+        {2174254839u, "FogDepthColorGradientTexture"},
+        {1481652420u, "Bg_fogTurbDirection"},
+        {935675491u, "g_bumpiness2"},
+        {3767235680u, "UIGroup"},
+        {1170300070u, "VertexAlignment"},
+        {1398054537u, "StructureSnow_fx_globals"},
+        {1803390363u, "AOSharpness"},
+        {2762528008u, "g_depthOffset"},
+        {4080702839u, "ResolveTransparency"},
+        {1087323678u, "PrimaryInputTexture"},
+        {1658072000u, "DZJ"},
+        {3937228464u, "CameraShadow_fx_globals"},
+        {3364859625u, "DiffuseB"},
+        {3858744848u, "g_ambientLightColor"},
+        {545670461u, "SpecMax"},
+        {3318148019u, "g_causticOverlayTexture2"},
+        {1164725780u, "g_nightVisionWhitePointAdjustment"},
+        {3405286851u, "T6m"},
+        {887161595u, "g_skyDepth"},
+        {1554832013u, "TA"},
+        {3212451039u, "FilterStep"},
+        {3154525971u, "g_shadowOpacity"},
+        {1293965061u, "SimpleGlow_fx_globals"},
+        {2978120240u, "Detail"},
+        {1613650252u, "primitive3D"},
+        {2056125944u, "DeRes_Rigid_1Overlay"},
+        {150009011u, "Ambient"},
+        {4174444791u, "Structure_fx_globals"},
+        {143846010u, "Reflection"},
+        {3196508200u, "BlendStrength4"},
+        {3183136200u, "RBfY"},
+        {1415740256u, "Step"},
+        {576155039u, "PointLight"},
+        {405230680u, "g_lightingRadius"},
+        {3458129047u, "AuraxiumCloak_RigidSkinned_1Overlay"},
+        {4127932971u, "RedDot_fx_globals"},
+        {2821565358u, "AurLookup"},
+        {1956463606u, "TwoSidedRigidLODs_fx_globals"},
+        {3710078924u, "KRi1pC"},
+        {1948295648u, "EmitsHeat"},
+        {3335808714u, "g_Stage"},
+        {2961028190u, "g_noiseTex"},
+        {465982410u, "TilingTintHighlight"},
+        {523425990u, "FoamFallOff"},
+        {2698019335u, "DownsampleDepthMode"},
+        {1673427676u, "Dv"},
+        {3630596375u, "RigidLODTech"},
+        {1609724772u, "Cloud"},
+        {4078497991u, "DXBCQWm"},
+        {1246104804u, "smartBlur"},
+        {3792688085u, "RigidSkinnedLODs_fx_globals"},
+        {153764405u, "Ga"},
+        {4094635191u, "ForceFieldDistortion_planar_fx_globals"},
+        {3586595067u, "CloudAnimationOffsetU"},
+        {586786000u, "g_vertexAlignment"},
+        {1645435298u, "Bumpiness1"},
+        {1947228335u, "ScreenDirtLookup"},
+        {3492922237u, "AuraxiumOpaque_Skinned_2Overlay"},
+        {172089524u, "g_SiltDepth"},
+        {4046103935u, "ParticleWorldViewInverse"},
+        {4188199334u, "ShieldPattern"},
+        {3893147154u, "SurfaceScale"},
+        {2275552224u, "Red"},
+        {3756977791u, "g_BaseDiffuseTexture"},
+        {1404632542u, "BINORMAL"},
+        {288895493u, "g_SparkMask"},
+        {1128077162u, "RippleX"},
+        {2025939350u, "Character_fx_globals"},
+        {3022183536u, "BlueChannel"},
+        {2412733121u, "DetailScale"},
+        {1226147642u, "g_polarize"},
+        {2102996721u, "SkyMask"},
+        {2658993220u, "HorizonFadeHeight"},
+        {1422441133u, "Color1"},
+        {564893108u, "AuraxiumDeRes_Skinned_2Overlay"},
+        {1052296225u, "_AmbientLightColor"},
+        {375721991u, "streakParticle_fx_globals"},
+        {305849878u, "modelInstanced"},
+        {1067869053u, "_World"},
+        {41709518u, "PlanetAtmosphere"},
+        {1688837887u, "SwayBoilSpeed"},
+        {2966499688u, "DetailNormalMap"},
+        {2976119954u, "Scroll1"},
+        {1781600246u, "g_reflection"},
+        {2125917009u, "ColorMapScrollX"},
+        {1771711044u, "g_BackgroundAlpha"},
+        {3927377464u, "FogShadowsEnable"},
+        {1346548157u, "SV_Position"},
+        {4209458952u, "AuraxiumOpaque_Skinned_0Overlay"},
+        {4037736996u, "g_shieldsReduceBloom"},
+        {3322220821u, "DeResDepth_Rigid"},
+        {3732551638u, "MaxNightFoamC"},
+        {4058132370u, "Designer_fx_globals"},
+        {876155375u, "specTexture3"},
+        {2175827280u, "GlowWith2TexturesInWater_Tinted"},
+        {607383897u, "DamageCube"},
+        {1206481207u, "P_BK"},
+        {546170449u, "Planet_fx_globals"},
+        {1101802656u, "Glass_Rigid_Skinned"},
+        {3474608854u, "SkyRenderModes"},
+        {3742273335u, "Overlay3UVSet"},
+        {2971482625u, "Grid"},
+        {1508986966u, "RDEFt"},
+        {3432480472u, "g_bumpStrength"},
+        {2943375275u, "g_cubeFaceDown"},
+        {2473362707u, "Cloak_Skinned_2Overlay"},
+        {1966750504u, "Mt9"},
+        {1084148541u, "UBg"},
+        {950333225u, "ShieldHottness"},
+        {2008783174u, "g_fogTurbSpeed"},
+        {3690698216u, "Scroll2_U"},
+        {3745782842u, "g_swayDir"},
+        {3099813281u, "none"},
+        {3997671096u, "ThermalHot"},
+        {1797136163u, "EmissiveWith3Textures"},
+        {3274769863u, "TexScrollU3"},
+        {1867938104u, "SSAOSourceDepth"},
+        {127961457u, "SparkOpacity"},
+        {3816927001u, "Cloak_Rigid_2Overlay"},
+        {662038157u, "g_Ascroll2_V"},
+        {1220026692u, "scale"},
+        {1369523350u, "HoloTilingRateU"},
+        {799678480u, "terrain_rsm"},
+        {2178963648u, "g_strength"},
+        {3368849798u, "E"},
+        {4098303444u, "flare_fx_globals"},
+        {344563784u, "Max"},
+        {2073379210u, "ShieldDistance"},
+        {1233221811u, "g_textureParams"},
+        {575429414u, "SHEXh"},
+        {1182579798u, "Cloak_Skinned_3Overlay"},
+        {1223229326u, "g_hologramUVSet"},
+        {2942327622u, "CameraDirectionDelta"},
+        {2482752130u, "FrameColor"},
+        {3237876615u, "FoamScale"},
+        {1354966639u, "BlueNoise32"},
+        {4020136403u, "ThermalColor"},
+        {737443605u, "normalsTexture"},
+        {293531506u, "g_enableColorGrading"},
+        {1341428837u, "postlowend_fx"},
+        {2644165868u, "rigidInstanced_depth"},
+        {2922652710u, "TargetColorTexture"},
+        {671292002u, "SatelliteBlend"},
+        {1628083364u, "g_glazeMin"},
+        {1216945870u, "g_noiseTexture"},
+        {3469641578u, "ColorBuffer"},
+        {3228990719u, "GaussianIntensity"},
+        {2348897854u, "ToolPrimitive3DNoZTest"},
+        {2150656108u, "fontPrimitive"},
+        {1543876871u, "OSGND"},
+        {3518266274u, "DXBCzd"},
+        {3582701065u, "g_Scaler"},
+        {2218378007u, "GaussianRadius"},
+        {2688873764u, "FoliageGlowScroll_fx_globals"},
+        {4092792428u, "g_SpecTexture"},
+        {229637700u, "InfraRedViewRange"},
+        {4008082010u, "RDEFl"},
+        {4009301052u, "g_cloakDarkLightColor"},
+        {364555382u, "ForegroundZScale"},
+        {1445284158u, "Sharpness"},
+        {2907105676u, "g_mode"},
+        {1054511689u, "depthTexture"},
+        {3225086680u, "ShieldColor_RigidSkinned"},
+        {3806622867u, "DXBC2"},
+        {548634227u, "PostLowEnd_fx_globals"},
+        {3963343045u, "ShieldBGColor"},
+        {1438444562u, "DecalOpaque"},
+        {1848089871u, "dds"},
+        {527907802u, "g_waterDisplacementPower"},
+        {767389887u, "SimpleEmissive"},
+        {591044414u, "g_infraRedOutlineColor"},
+        {2246450987u, "AdditiveGlow"},
+        {3876788492u, "sampleOffsets32"},
+        {562806884u, "ShieldColor_Rigid"},
+        {243681969u, "g_grungeAmount"},
+        {785806746u, "g_skyRenderMode"},
+        {1001958125u, "g_pass"},
+        {3955463308u, "Smoothing"},
+        {1426327432u, "g_ColdLavaTexture"},
+        {2847996385u, "CloudMap"},
+        {3976516670u, "For"},
+        {180374665u, "g_DizzyIntensity"},
+        {1364744812u, "CloudLayerWeightings"},
+        {4210619183u, "mask"},
+        {3754821649u, "Glass_Skinned"},
+        {434162306u, "FogAngleColorGradientTexture"},
+        {4215735636u, "SkinnedGlowWith1Texture_Tinted"},
+        {1250607345u, "RigidShieldColor"},
+        {3958620885u, "_RenderLevel"},
+        {2744082361u, "g_motionBlurPower"},
+        {2804847043u, "DXBCwn"},
+        {1249030365u, "g_texScale2"},
+        {1223245983u, "DXBC8"},
+        {691471786u, "g_hoodFalloffAngle"},
+        {2999197982u, "BaseDiffuse"},
+        {3296772691u, "CumulusCloudHeight"},
+        {4076514358u, "TexScrollX1"},
+        {1554345994u, "g_resPatternTexture"},
+        {1778980206u, "TwoSidedSway_depth_fx_globals"},
+        {2168882344u, "SiltDepth"},
+        {257985534u, "_InvProjection"},
+        {3154953183u, "Midtone"},
+        {366875573u, "shadowing_fxh"},
+        {1781973320u, "Cloak_RigidSkinned_1Overlay"},
+        {2081266015u, "Texture"},
+        {1208324078u, "f"},
+        {181140349u, "g_DamageB"},
+        {1318221941u, "ColorNormalXMap3"},
+        {664454034u, "TrailParticleFillVisualization"},
+        {254172489u, "SimpleSpriteParticleEmitter"},
+        {2427617520u, "EnableSway"},
+        {1443893235u, "AuraxiumCloak"},
+        {2070841988u, "River"},
+        {2014451236u, "GlowBrightness"},
+        {2660634u, "g_backfaceMinOpacity"},
+        {2810465934u, "g_FFColorColorMapTiling"},
+        {1638594485u, "Cm"},
+        {1346825246u, "g_FoamScale"},
+        {1264642677u, "flare"},
+        {1283187499u, "g_foregroundZScale"},
+        {3110560441u, "g_sunGlowMax"},
+        {3861293810u, "BumpU2"},
+        {4171564072u, "detailBlendTexture4"},
+        {2719554629u, "g_FFPlanarCoordinateSpace"},
+        {324165369u, "detailScale"},
+        {2515819280u, "UK5E"},
+        {2195435718u, "Shadow"},
+        {867540824u, "PreZ"},
+        {1083850845u, "g_specular"},
+        {4074849467u, "DXBCxm"},
+        {3342024348u, "g_texture"},
+        {327299794u, "SpecBlendNormalYMap"},
+        {2710395350u, "SHEX8"},
+        {117370114u, "g_fogFloor"},
+        {1468220110u, "drift"},
+        {1560464382u, "g_stratusHeight"},
+        {1088764547u, "g_deltaTime"},
+        {2361473717u, "ShieldFresnel"},
+        {3465806057u, "g_skyStencilMaskEnabled"},
+        {3413360186u, "CW4"},
+        {1756772140u, "ScatterWavelengths"},
+        {730771937u, "g_colorKeyLerp"},
+        {3475441392u, "g_flareFocus"},
+        {3149370525u, "g_SiltColor"},
+        {835183371u, "TexScrollV3"},
+        {2332249054u, "forcefield_fxh"},
+        {1698590072u, "g_greenSource"},
+        {1058516516u, "g_DetailMaskTexture"},
+        {1335386793u, "ShadowProjector"},
+        {1193155432u, "foliageglowscroll_fx"},
+        {3739108299u, "g_EvComps"},
+        {412461560u, "g_FFPlanarColorMapScrollY"},
+        {3534180716u, "samplerMinMagLinearMipPointWrap"},
+        {4005735602u, "GlassPass1"},
+        {1066420273u, "g_sourceDepthTexture"},
+        {539084405u, "usually"},
+        {4233665799u, "BFaceRefrac"},
+        {1122888004u, "ColorWrite"},
+        {2787846236u, "RSMShadowScale"},
+        {2486536206u, "RigidDeRes"},
+        {2108897622u, "AuraxiumCloak_Skinned_0Overlay"},
+        {1428927120u, "base"},
+        {2380647739u, "EnableColorGrading"},
+        {3003512119u, "FoliageGlowScroll"},
+        {3527445679u, "g_DecalTintRotation"},
+        {637727175u, "g_metalic"},
+        {1964440250u, "g_wearAmount"},
+        {2952593172u, "VU"},
+        {3636131919u, "PickTerrain_fx_globals"},
+        {3700892124u, "RDEF"},
+        {1751343934u, "foliageinstanced_fx"},
+        {1540519840u, "DetailBumpiness"},
+        {66183444u, "writeAlpha"},
+        {3133539934u, "RippleZ"},
+        {4020273094u, "ShadowDepthOffsets"},
+        {3695776772u, "TerrainLod_depth"},
+        {865207188u, "BlueNoiseTexture"},
+        {835905787u, "WaterReflection"},
+        {558197119u, "g_TilingTintMidtone"},
+        {3920460045u, "auNoiseBoilSpeed"},
+        {3602518425u, "Emissive"},
+        {3379115033u, "g_SkyCubeTexture"},
+        {2598581285u, "g_shadowDepthOffset"},
+        {221458855u, "g_coloredFogEnabled"},
+        {2644518207u, "HoloScanSpacing"},
+        {2746430072u, "NoiseAlpha"},
+        {867034004u, "g_texScrollZ1"},
+        {326641372u, "I"},
+        {4288364316u, "POSITION"},
+        {768451860u, "TransitionOffset"},
+        {3732755125u, "AOStrength"},
+        {1042620314u, "HoloScanIntensity"},
+        {2843529463u, "E3Blur"},
+        {798127786u, "CompositeParticles"},
+        {2442469208u, "CumulusCloudTiling"},
+        {3154785138u, "Lerp"},
+        {2376469967u, "DXBCtCK"},
+        {1975879167u, "g_MetersPerSecond"},
+        {4207611992u, "Blend"},
+        {4079453084u, "AuraxiumCloak_RigidSkinned_0Overlay"},
+        {2422964101u, "Dg_highQualityLighting"},
+        {1949429259u, "BumpMap2"},
+        {3028066784u, "ShadowSlopeScaledDepthBias"},
+        {831064098u, "UseUV0ForDetailBump"},
+        {2052551991u, "Frequency"},
+        {3246905630u, "g_TransitionOffset"},
+        {1312040825u, "g_scale2_V"},
+        {1086334096u, "ShieldDistortion"},
+        {2685512201u, "ONLY"},
+        {559737186u, "DetailMaskUsageOrder"},
+        {2452837406u, "DetailSpecMap"},
+        {3488896135u, "ParticleOptions2"},
+        {3541815370u, "g_tint"},
+        {421129700u, "Ag_OverlayScale"},
+        {2338197459u, "should"},
+        {772416473u, "g_pixelSize"},
+        {901231231u, "g_DecalMainUV"},
+        {2288795548u, "DXBCL"},
+        {330666543u, "ISGNP"},
+        {2891624044u, "CloakDarkLightColor_Skinned"},
+        {206101470u, "MetersPerSecond"},
+        {1255217419u, "SkyMask_fx_globals"},
+        {547213892u, "OXYg"},
+        {953119110u, "Y"},
+        {1712632625u, "CloakColorDistortion"},
+        {4089237855u, "g_foamWaterTiling"},
+        {1128527236u, "g_CameraShakeDir"},
+        {3951470911u, "FoamEnabled"},
+        {4294455213u, "GlowMax"},
+        {4055290051u, "DXBCrAn"},
+        {1870078669u, "Start"},
+        {3991981851u, "AScroll3_V"},
+        {298961613u, "DirectionalLightShadowInvViewProj"},
+        {3966660707u, "g_ForceFieldCullMode"},
+        {3646524945u, "ForceFieldColor_planar_fx_globals"},
+        {4191090663u, "STEALTH"},
+        {1562404697u, "LensDirtLayerDensities"},
+        {2145036037u, "g_FullScreenEffectVR"},
+        {4185582007u, "g_sunLightDeferredShadowTexture"},
+        {1807791469u, "a_nAOEnable"},
+        {3471970097u, "SimpleSpriteParticleFillVisualization"},
+        {3056746450u, "Add"},
+        {1045004095u, "IRIS"},
+        {2335796538u, "TransitionDirection"},
+        {3117261961u, "distortionFixup"},
+        {249971258u, "g_infraRedWhitePoint"},
+        {3255162001u, "WaterDepthBuffer"},
+        {3136362712u, "SourceDepth"},
+        {2294365637u, "RainbowRadialPower"},
+        {1118259631u, "g_FoamNormalTexture"},
+        {1447744550u, "DistortionTech"},
+        {3214420359u, "fReplication"},
+        {3442265868u, "g_whitePoint"},
+        {1848695880u, "Z"},
+        {814703687u, "CompositeEnv_fx_globals"},
+        {3665794801u, "DXBCNg"},
+        {876089016u, "Pass8"},
+        {3831575631u, "DecalTintScale"},
+        {949195643u, "g_OverlayScale"},
+        {3987620546u, "METALIC"},
+        {672851298u, "DXBCh58"},
+        {4127824617u, "DXBC3"},
+        {3135248530u, "RB"},
+        {496311818u, "auDielectricMin"},
+        {695099626u, "AuraxiumOpaque_RigidSkinned_3Overlay"},
+        {3904986293u, "ParticleColorTexture"},
+        {3612796059u, "DeRes_Rigid_4Overlay"},
+        {2836739761u, "ForceFieldDistortion"},
+        {2967055537u, "Microsoft"},
+        {941198923u, "EnableTileUV0"},
+        {1040152270u, "DXBCX_E"},
+        {3503792806u, "StructureDecal_fx_globals"},
+        {4134277569u, "g_FadeOverride"},
+        {2766689043u, "Forward"},
+        {295054785u, "g_FrameColor"},
+        {3790472174u, "g_DistortionLameScale"},
+        {2860836812u, "skycube_fx"},
+        {2815361288u, "GlowWith1TextureInWater_Tinted"},
+        {797342021u, "g_bumpMap2"},
+        {647286906u, "g_thermalWhitePoint"},
+        {1148821380u, "ParticleOptions"},
+        {285754197u, "FoamScrollU"},
+        {2373469192u, "SatelliteDepth"},
+        {4230376326u, "AScroll3_U"},
+        {1956190078u, "ColorTexture3"},
+        {4149450257u, "RigidCloakColorDistortion"},
+        {1900975664u, "g_E3Desat"},
+        {904618334u, "g_shadowFilterSigma"},
+        {608981765u, "GlazeMax"},
+        {799363195u, "eye"},
+        {1792746218u, "g_bumpTexture"},
+        {1914817235u, "SV_VertexID"},
+        {3570770169u, "g_FrameWidth"},
+        {2564546982u, "AuraxiumRigidDeRes"},
+        {2875741183u, "FrameOn"},
+        {2016590828u, "Tint1"},
+        {1674679447u, "g_ForwardVector"},
+        {2438140916u, "screenspace_fxh"},
+        {3613805587u, "HBg_infraRedRange"},
+        {341787728u, "FoamScrollV1"},
+        {937267168u, "g_minDayIntensityOnColor"},
+        {1213245561u, "ScatterWashBias"},
+        {2853737595u, "g_Wave"},
+        {222019120u, "g_inverseProjMatrix"},
+        {3771658923u, "F2"},
+        {1094187547u, "Cloak_Rigid_3Overlay"},
+        {1679493774u, "noise32x32x32"},
+        {3490467795u, "RainbowRadial_fx_globals"},
+        {4118341951u, "mixed"},
+        {1911839300u, "BaseMaskA"},
+        {3287608551u, "OPAQUE"},
+        {1082251412u, "RippleFreq"},
+        {3930994022u, "DXBCIU"},
+        {881605612u, "sided"},
+        {3205711709u, "g_blueSource"},
+        {1362107991u, "CompositeEnv"},
+        {2781561277u, "g_scale1_U"},
+        {688361372u, "g_scanIntensity"},
+        {3953337280u, "ShieldDistortion_Rigid"},
+        {1334966228u, "g_DecalTintShadow"},
+        {3390586375u, "v3Vertical"},
+        {3984171369u, "TwoSidedRigidLODs"},
+        {756222607u, "SkyLightProbeColor0"},
+        {150722328u, "g_Overlay4Tiling"},
+        {571138767u, "SourceMip"},
+        {2157436542u, "ShadowMap"},
+        {3955918995u, "g_toxicFogLocalColor"},
+        {20812068u, "RcpLodRange"},
+        {3013341294u, "CloudShadows_fx_globals"},
+        {2220160868u, "auDielectricMax"},
+        {1917404729u, "Direction"},
+        {3701901710u, "g_enableFogTurbulence"},
+        {2236376032u, "g_projectorWorldMatrix"},
+        {966252751u, "Color"},
+        {531868208u, "TrunkInstanced"},
+        {445376453u, "_DirectionalLightViewSpaceDir"},
+        {2314000268u, "g_Overlay1UVSet"},
+        {2427195838u, "g_color"},
+        {2946423627u, "refraction"},
+        {1614170884u, "ShieldDistortion_RigidSkinned"},
+        {2285181561u, "Texture3"},
+        {4086624951u, "noise"},
+        {3042057242u, "FogHorizontalGradientVector"},
+        {1624607390u, "g_DetailBumpinessB"},
+        {3688964463u, "m44RefCameraMatrix"},
+        {3664042188u, "TrailParticleFullRes"},
+        {1796081103u, "TwoSided"},
+        {4024030221u, "DamageA"},
+        {1104385212u, "g_shadowFilterRadius"},
+        {1209473230u, "Primitive2D"},
+        {3107117747u, "g_BlendMaskTexture"},
+        {3519956614u, "FoamEnd"},
+        {392516915u, "Caustics"},
+        {206704017u, "Invisible"},
+        {913674268u, "Audit"},
+        {534335691u, "Color2"},
+        {1964703622u, "Model"},
+        {2305748784u, "g_OverlayTiling"},
+        {191885613u, "SkyDome_fx_globals"},
+        {1624782380u, "EnablePlanarMapAB"},
+        {2303555710u, "ParticlePCFShadows_fx_globals"},
+        {1537748556u, "SwayDir"},
+        {3689480984u, "g_IrisClampLow"},
+        {2715610812u, "TexStretch3"},
+        {3737558611u, "DXBCIE"},
+        {3902993139u, "RigidSkinnedLODs"},
+        {4248356835u, "RedDot"},
+        {95970965u, "g_rippleY"},
+        {710973406u, "PatternOpacity"},
+        {2792017708u, "Simple_VS1_PS2"},
+        {1100359941u, "Terrain4LayerLod"},
+        {224782640u, "AlphaBlendTech"},
+        {991638603u, "GlowThickness"},
+        {3509641460u, "Sv5"},
+        {124435522u, "GlowWith3Textures_Tinted"},
+        {880639552u, "g_ColorBlend"},
+        {776945522u, "g_causticFadeCoefA"},
+        {2013733142u, "lightColor"},
+        {454529080u, "UIWidget"},
+        {3723283684u, "MiniMapLight_fx_globals"},
+        {3572400855u, "g_color1Texture"},
+        {1449224430u, "Overlay1"},
+        {2681957678u, "MuJD"},
+        {3274169826u, "DXBCQG"},
+        {4185059571u, "g_FFColorDistortionTexture"},
+        {3907538442u, "g_texScrollZ2"},
+        {1526083076u, "TurbulenceDirection"},
+        {1366577785u, "g_clear"},
+        {1313893236u, "DesaturationIntensity"},
+        {2134872746u, "g_enableClouds"},
+        {3178323517u, "ssaoSourceDepthTexture"},
+        {578821933u, "g_blurTexture2"},
+        {4207682869u, "g_UVsPerMeter3"},
+        {1114022449u, "g_planarMapA"},
+        {2199896539u, "Terrain2LayerLod_fx_globals"},
+        {824378915u, "TilingOverlayB"},
+        {4023811343u, "bloom"},
+        {1718735100u, "fog_fxh"},
+        {1843820900u, "g_Overlay3UVSet"},
+        {894983913u, "lightsIndexes"},
+        {2179205408u, "g_NoiseTiling"},
+        {2465430226u, "GlowUVScale"},
+        {1569877796u, "DoubleSided"},
+        {1243871960u, "Structure_rsm_fx_globals"},
+        {1748235771u, "Polarize"},
+        {1427378747u, "ColdRoll"},
+        {959216293u, "UVsPerMeter3"},
+        {2308000750u, "Overlay4ColorChannel"},
+        {576270695u, "RigidDeResDepth_fx_globals"},
+        {2614678440u, "g_texScale1"},
+        {170150817u, "TintMask"},
+        {241446822u, "detailBlendTexture3"},
+        {1081191752u, "TilingTintShadow"},
+        {2389682258u, "lightPosition"},
+        {858259220u, "g_angularFrequency"},
+        {1941545847u, "knNscreenspace_fxh"},
+        {885144537u, "BeamParticle_FullResInWater_RenderLevel2"},
+        {934212610u, "samplerMinMagMipLinearWrap"},
+        {3190426463u, "ToolPrimitive3D"},
+        {4072615563u, "g_enableSway"},
+        {4275967737u, "CloakDarkLightColor_Rigid"},
+        {1880305610u, "PeakAlphaFromTexture"},
+        {4234455803u, "SkinnedGlowWith2Textures_Tinted"},
+        {793538513u, "DeRes_Skinned_4Overlay"},
+        {2266494919u, "Primitive2DTexture2"},
+        {2005365334u, "DebugTerrainLod"},
+        {3239471318u, "g_TilingOverlayBTexture"},
+        {763846051u, "color_override"},
+        {2232170232u, "SurfaceMap"},
+        {3266165077u, "DetailScale4"},
+        {4099519088u, "particlescommon_fxh"},
+        {1078226692u, "pixel"},
+        {2289505258u, "Qyvo"},
+        {1603794272u, "CloudTextureLerp"},
+        {4272324027u, "g_skyLightCoeff2"},
+        {1428075138u, "globalLight_fx_globals"},
+        {3050577190u, "StructureSkinned_fx_globals"},
+        {4223081484u, "g_fontTexture"},
+        {123374570u, "Ambience"},
+        {2566592169u, "SparkMask"},
+        {1916753726u, "StandardNoZ"},
+        {3718468465u, "textureMap"},
+        {40473913u, "Lm3XQ"},
+        {701490813u, "detailBlendTexture5"},
+        {4174604964u, "OSGNL"},
+        {3960152167u, "g_shadowSaturation"},
+        {1267514453u, "g_shadowMapCoeffs"},
+        {866047394u, "Opaque_Skinned_3Overlay"},
+        {3285820901u, "TopFrame"},
+        {384745214u, "CloudTextureTo"},
+        {300364087u, "emissive"},
+        {4282264613u, "g_WorldScale"},
+        {3042945622u, "g_PatternAlpha"},
+        {3078550797u, "Cloak_RigidSkinned_2Overlay"},
+        {4221708941u, "DC"},
+        {2108375473u, "g_SparkOpacity"},
+        {1693427706u, "Scroll"},
+        {542470067u, "DebugVehicleTranslucent"},
+        {1885574506u, "g_FoamBrightness"},
+        {195192885u, "CPY6"},
+        {1831630180u, "Yk"},
+        {1151776890u, "rigid_depth"},
+        {3944678043u, "g_DetailSelectB"},
+        {314333321u, "g_FFColorPerlinNoise3DTexture"},
+        {1652036908u, "Scale1"},
+        {1691289014u, "PointLightColor"},
+        {300792701u, "g_Ascroll2_U"},
+        {791049574u, "Y96O"},
+        {1446133117u, "LensEffects"},
+        {3583415694u, "PCSG"},
+        {2161129623u, "g_adjustToLighting"},
+        {2986106863u, "g_shadowCoeffs"},
+        {2625186596u, "Ag_refraction"},
+        {1623949747u, "g_enableSnow"},
+        {3224393471u, "Shift"},
+        {2086125315u, "g_noiseBoilSpeed"},
+        {1850817166u, "Scale"},
+        {1716545104u, "SpecBlendNormalYMap2"},
+        {3609974549u, "LensDirtNoiseScaleStr"},
+        {647569751u, "HeightMap"},
+        {3353900466u, "AlphaContrast"},
+        {4249685819u, "BacksideDesat"},
+        {1930658478u, "RDEFL"},
+        {3385450421u, "DXBCbw_"},
+        {1662965498u, "ExtraTintColorA"},
+        {789998085u, "Bump"},
+        {1113542674u, "LodIndex"},
+        {2032632131u, "Enable"},
+        {3838868907u, "_Ax2"},
+        {3223757268u, "UIMin"},
+        {3701880989u, "sunlight_fxh"},
+        {1855946126u, "RedDotColorOverride"},
+        {1114801661u, "directional"},
+        {1263508167u, "BloomEnabled"},
+        {155693821u, "g_nearClip"},
+        {3413814660u, "SHEXt"},
+        {3859601539u, "Specular"},
+        {1726945002u, "stepping"},
+        {2258927579u, "g_fogDepthHorizontalMult"},
+        {2359148479u, "Opaque_Skinned_0Overlay"},
+        {1891269768u, "COLOR"},
+        {4195981576u, "DXBC"},
+        {3122770113u, "g_waveRadius"},
+        {1563569088u, "DetailFrequencyB"},
+        {3994590407u, "g_overCast"},
+        {1271749719u, "StarsColor"},
+        {2346609792u, "g_BiasNormals"},
+        {2950549497u, "DXT1"},
+        {3033118253u, "Overlay"},
+        {357380927u, "sky_fx_globals"},
+        {733449199u, "FoliageCulling"},
+        {2804377930u, "DERES"},
+        {1474877926u, "g_m43World"},
+        {1690271866u, "BlurIntensity"},
+        {3996165806u, "UIName"},
+        {2437086885u, "DXBCe2"},
+        {957883732u, "FogDensity"},
+        {2731305951u, "Pass7"},
+        {881782918u, "SiltColor"},
+        {2803548676u, "g_cavityThreshold"},
+        {932297144u, "Water_V11_P11"},
+        {633255297u, "color"},
+        {3730202634u, "Replication"},
+        {1390016735u, "ShadowResolveInput"},
+        {3721212275u, "floraModel_rsm"},
+        {1009920340u, "g_skyColor"},
+        {2550689703u, "fontPrimitive_fx_globals"},
+        {4289533612u, "samplerMinAnisotropicMagLinearMipPointClampMaxAnisotropy4"},
+        {0u, "UNKNOWN"},
+        {942654512u, "beamParticle"},
+        {1832233395u, "Scaler"},
+        {178441982u, "_NearClip"},
+        {1197883356u, "FP"},
+        {1986594441u, "g_antiBloom"},
+        {4138840356u, "FullScreenEffects"},
+        {1055737527u, "Bumpiness"},
+        {374327969u, "smartBlur_fx_globals"},
+        {2541089079u, "g_power"},
+        {831022117u, "FrameFade"},
+        {1690647898u, "DeResGlow_RigidSkinned"},
+        {1159151102u, "ExtraTintScale"},
+        {2345713525u, "ToolPrimitive2DTex"},
+        {2558434264u, "CubeFaceDown"},
+        {2318025496u, "DXBCM"},
+        {2273721988u, "TexOffset2"},
+        {3814651236u, "DXBCt"},
+        {3500196936u, "g_stratusTiling"},
+        {999850253u, "g_stealthBlendTexture"},
+        {3973402192u, "Opaque_Rigid_3Overlay"},
+        {363334756u, "ColorBlindFilterStrength"},
+        {1397469159u, "g_FFPlanarAutoTileFreq"},
+        {3110827473u, "g_ScaleY"},
+        {3398399980u, "g_causticFadeCoefB"},
+        {2621819118u, "Use"},
+        {71249948u, "SCALE"},
+        {2131711237u, "g_Strength"},
+        {239213569u, "GFA"},
+        {412778498u, "g_FFColorColorMapScrollX"},
+        {3482288272u, "TexStretch"},
+        {735067920u, "g_redSource"},
+        {45404870u, "g_TilingScaleB"},
+        {2418387767u, "FlashIntensity"},
+        {4283212414u, "FullscreenEffectsPass1"},
+        {1166057229u, "WarpMode"},
+        {433374174u, "ForceFieldOpacity"},
+        {4268555458u, "T"},
+        {4038660216u, "_Projection"},
+        {2231085831u, "modelInstanced_fx_globals"},
+        {309767754u, "DeRes_Rigid_0Overlay"},
+        {3276096865u, "RigidCloakColor"},
+        {1484055814u, "SimpleSpriteParticleInWater"},
+        {1210735960u, "Rotation"},
+        {2229905238u, "FullScreenEffectThermal"},
+        {236576249u, "g_highlightDomain"},
+        {3350454530u, "Cg_swayWavefrontSize"},
+        {1827206754u, "Res"},
+        {653039309u, "float3"},
+        {24411141u, "AuraxiumRigidOpaque"},
+        {8096652u, "fogMap"},
+        {1998740260u, "DeRes_Rigid_3Overlay"},
+        {1552580905u, "DecalTintShadow"},
+        {839250237u, "g_causticHeightFadeInEnd"},
+        {2880866864u, "g_TransitionDirection"},
+        {1252398387u, "X"},
+        {1979812194u, "g_cloakColor"},
+        {578938456u, "g_holoHottness"},
+        {731618615u, "BackGroundOpacity"},
+        {3961175726u, "g_deResHottness"},
+        {4016570178u, "g_shadowDepthBias"},
+        {1341749911u, "g_sunFalloffsStarsBlend"},
+        {3930080118u, "caustics"},
+        {3928795135u, "g_shadowEnableFastZ"},
+        {1132955390u, "DXBCtu"},
+        {3448862708u, "HotLava"},
+        {3990867029u, "g_toxicFogTexScale"},
+        {95963610u, "g_SaturationIntensity"},
+        {2563506627u, "Lava"},
+        {2902198459u, "DXBCS"},
+        {3304593187u, "SpriteParticleEmitter_fx_globals"},
+        {712247220u, "g_maxNightIntensityOnFoam"},
+        {2712455713u, "g_ScatterConstants"},
+        {3989204750u, "g_DiffuseBTexture"},
+        {100534237u, "g_smoothnessMin"},
+        {1611248838u, "SevenTapGaussian_fx_globals"},
+        {1741431556u, "ScreenFrameUI_fx_globals"},
+        {3823751074u, "Blue"},
+        {3182108424u, "ScreenFrame"},
+        {2765165616u, "DXBCmK"},
+        {3352194903u, "g_brdfLookupTexture"},
+        {2445081376u, "g_swayWavefrontSize"},
+        {2372293008u, "ThermalAdjustToLighting"},
+        {1258431921u, "depthSource"},
+        {2036861783u, "TileQuad_fx_globals"},
+        {3003107674u, "g_screenDirtTex"},
+        {2438181367u, "DetailBump"},
+        {2286245566u, "g_foamUVScale"},
+        {2657496170u, "SkyLightCoeff0"},
+        {1810471490u, "g_fresnel"},
+        {2632014573u, "BlendMask"},
+        {3756933518u, "specMinMax2"},
+        {275106984u, "DetailScale5th"},
+        {115659782u, "ColorScrollU"},
+        {3757932529u, "g_metallicMin"},
+        {3444722791u, "RigidDepth"},
+        {2141709671u, "DZH"},
+        {4054585185u, "g_FFDistortionDistortionTexture"},
+        {462962734u, "g_SunDir"},
+        {811736753u, "ScaleBias"},
+        {1912544449u, "g_CausticsTexture"},
+        {2439960064u, "g_GlowUVScale"},
+        {3345859545u, "ShadowsFilterType"},
+        {2536750071u, "DebugObjectTranslucent"},
+        {3226938996u, "g_scanSpacing"},
+        {3698384680u, "samplerMinMagLinearMipPointWrapUClampV"},
+        {2376889927u, "g_emitsHeat"},
+        {4228163174u, "RIPPLE"},
+        {1250427335u, "g_shadowTint"},
+        {3467415582u, "flora_fx_globals"},
+        {3586905865u, "g_BacksideBlur"},
+        {2012135449u, "Scale2"},
+        {3866735361u, "g_thermalFade"},
+        {4290847u, "Qjk"},
+        {2744467705u, "Skinned"},
+        {1651477511u, "g_sunLightInvWorldViewProj"},
+        {1793190996u, "SHEXl"},
+        {1757615833u, "IsShadowGenPass"},
+        {343855878u, "ClarityOfSky"},
+        {1487910380u, "PatternTiling"},
+        {4263843304u, "Terrain5LayerLod_fx_globals"},
+        {1105622185u, "g_virtualViewMatrix"},
+        {579175720u, "g_frameOn"},
+        {299157318u, "_WhitePoint"},
+        {480118392u, "SV_Target"},
+        {1577253401u, "options"},
+        {2860884101u, "Tint2"},
+        {1160621592u, "Opaque_Rigid_2Overlay"},
+        {1348801473u, "IrisClampHigh"},
+        {2952785410u, "g_ShowDecalTint"},
+        {1169025232u, "DXBCJv"},
+        {2132300719u, "TilingTintShadow_StructureTint"},
+        {598717956u, "LFL"},
+        {190299269u, "AuraxiumOpaque_RigidSkinned_2Overlay"},
+        {4217613941u, "OverlaySmoothing"},
+        {3954544717u, "g_cloudWorldMatrix"},
+        {3220667161u, "NormalMap"},
+        {3536160365u, "Show"},
+        {1957883122u, "EmpireTintB"},
+        {640730414u, "g_FFPlanarColorMapScrollX"},
+        {2811377406u, "StructureColorInstancedTech"},
+        {3826143582u, "bloom_fx_globals"},
+        {1312972829u, "PostVignette"},
+        {627936395u, "SkyLightProbeLocation0"},
+        {1194524174u, "AuraxiumCloak_RigidSkinned_3Overlay"},
+        {1680101565u, "g_TilingTintShadow"},
+        {599770983u, "V"},
+        {3259825788u, "SpriteParticleEmitterDistortion_fx_globals"},
+        {272751349u, "square"},
+        {2807588187u, "BackfaceRefractionDistanceFactor"},
+        {2429233482u, "SimpleSpriteParticle"},
+        {1498171729u, "SHEX4"},
+        {3379786277u, "g_SurfaceScale"},
+        {952922500u, "K"},
+        {2042064046u, "InteriorProbeWeight"},
+        {2951348671u, "Ag_PatternOpacity"},
+        {1152785041u, "ToolPrimitive3D_fx_globals"},
+        {2436583742u, "DXBCb"},
+        {3180162333u, "CubeFaceDir"},
+        {1915335423u, "Select"},
+        {336299555u, "AuraxiumOpaque_Rigid_0Overlay"},
+        {830551723u, "g_animationOffsetU"},
+        {2624186403u, "_StreakTimeStep"},
+        {1121143954u, "g_colorShiftRate"},
+        {1703968225u, "ResColor"},
+        {2498113615u, "LensDirtLayer2SizeStrRanges"},
+        {4025507557u, "g_IrisClampHigh"},
+        {631102208u, "SimpleSpriteParticleEmitterFillVisualization"},
+        {1419345006u, "specTexture"},
+        {2207192018u, "g_photoModeEnabled"},
+        {2058228996u, "SkyLightProbeLerp"},
+        {1404200969u, "Object"},
+        {2715201680u, "NightVisionScanLines"},
+        {1164388427u, "SpecMinMax1"},
+        {2009744939u, "ColorMapCube"},
+        {1622813640u, "m43World"},
+        {4035389908u, "decal"},
+        {1659194243u, "DecalTintRotation"},
+        {130189498u, "DXBC7x"},
+        {50146352u, "TerrainTile_fx_globals"},
+        {4167245976u, "Hottness"},
+        {1961859207u, "DXBCr"},
+        {1424975715u, "EnableShadowFastZ"},
+        {87351514u, "g_step"},
+        {4203282623u, "HoloScanSpeed"},
+        {2540424466u, "ParticleTintColor"},
+        {1153281623u, "skyOffset"},
+        {671155511u, "RSMShadowOffset"},
+        {244189053u, "skyStretch3"},
+        {1531731665u, "downsampleDepth"},
+        {1114754383u, "g_GridPatternTexture"},
+        {3403214035u, "LightScattering"},
+        {892080412u, "TankTread_fx_globals"},
+        {744499085u, "g_FFColorColorMapScrollY"},
+        {1652460352u, "TexScrollX3"},
+        {2578877144u, "g_range"},
+        {1506221785u, "floraModelInstanced"},
+        {3597561950u, "DirectionalLightViewSpaceDirection"},
+        {3013241419u, "g_rough"},
+        {921353881u, "BiasNormals"},
+        {686129215u, "H6"},
+        {2066864566u, "NightVisionNoise"},
+        {2666537735u, "lightingRadius"},
+        {2287387656u, "g_globalResolutionScale"},
+        {3418302945u, "foam_NRM"},
+        {3074173710u, "g_fadeOutStart"},
+        {3452395312u, "Diffuse"},
+        {3193636776u, "Foliage_fx_globals"},
+        {820622575u, "AuraxiumDeRes_RigidSkinned_4Overlay"},
+        {2327400845u, "ColorBlend"},
+        {3415156932u, "DXBCUu"},
+        {618760124u, "StreamWater_fx_globals"},
+        {3955012390u, "Boost2"},
+        {999236051u, "Boost"},
+        {1586484967u, "g_sourceTextureCube"},
+        {389163772u, "skyTexture2"},
+        {2407758538u, "Opaque_RigidSkinned_3Overlay"},
+        {3753722660u, "PixelShaderIndex"},
+        {783387656u, "DXBCm"},
+        {1573574689u, "RDEF8"},
+        {2064764699u, "g_hazeSunSkyStr"},
+        {1734104548u, "TurbulenceSpeed"},
+        {2560518452u, "Simple_VS2_PS2"},
+        {3358645132u, "Min"},
+        {4030862813u, "structureblend_fx"},
+        {1396902178u, "AuraxiumCloak_Rigid_1Overlay"},
+        {32212869u, "Basic"},
+        {2878911080u, "Dot"},
+        {2725647695u, "g_skyLightProbeLoc0"},
+        {154111524u, "YawPitchRollFace"},
+        {2691968359u, "DZHn"},
+        {1841703828u, "g_renderLevel"},
+        {3782900054u, "ParticleCameraEye"},
+        {257494990u, "Ag_texScrollU1"},
+        {1170442975u, "Scan"},
+        {1199676664u, "FogFloor"},
+        {285068596u, "Opaque"},
+        {1833687639u, "DXBCEX"},
+        {4141533434u, "CloakColorDistortion_Rigid"},
+        {2154250941u, "g_colorBlindFilter"},
+        {1525662699u, "ev"},
+        {3942320416u, "Cloak_RigidSkinned_0Overlay"},
+        {20774842u, "Mask"},
+        {3364793423u, "g_dielectricMax"},
+        {3801659787u, "DamageB"},
+        {83052944u, "g_cubeFace"},
+        {692758325u, "WaterHeight"},
+        {3245861078u, "g_DamageA"},
+        {1124872476u, "TexStretch4"},
+        {589910747u, "Opaque_Skinned_2Overlay"},
+        {672511588u, "g_scroll1_U"},
+        {1134190145u, "Extra"},
+        {3465962383u, "_EmissiveCorrectionScale"},
+        {1152701921u, "terrain_audit"},
+        {1179561685u, "g_ForceFieldBGOpacity"},
+        {3552386168u, "SimpleSpriteParticleDistortion"},
+        {60282692u, "FoamNormal"},
+        {2345880181u, "bumpMap"},
+        {68856046u, "water"},
+        {3629741812u, "TexScrollX2"},
+        {2326554004u, "Scale3"},
+        {577215368u, "g_ironSight"},
+        {1246664301u, "specMinMax1"},
+        {1735042216u, "baseDiffuse"},
+        {1210793759u, "DXBCE"},
+        {2111559523u, "Overlay1UVSet"},
+        {1724120108u, "DXBCs"},
+        {295869042u, "Opaque_Rigid_1Overlay"},
+        {1371606934u, "NBFK"},
+        {3829626921u, "DistortionScaleV"},
+        {1199349678u, "ForegroundZBias"},
+        {2383388251u, "g_edge"},
+        {411177844u, "g_ScaleMax"},
+        {3655788988u, "TdDj"},
+        {234774581u, "TexScrollZ1"},
+        {449327029u, "DizzyIntensity"},
+        {3545743222u, "NoOp"},
+        {3881102371u, "a_nAlphaBlend"},
+        {2298421641u, "vehicle_fx"},
+        {986603797u, "LensDirtBloomSunSkyStrAlpha"},
+        {3990252026u, "fogblur_fx_globals"},
+        {2509542899u, "ISGNl"},
+        {1306114716u, "BFaceMinOpacity"},
+        {795679599u, "PositionScale"},
+        {2911588865u, "g_inForeground"},
+        {336908927u, "Periodic"},
+        {2853035415u, "Terrain3LayerLod_fx_globals"},
+        {111503435u, "SimpleSpriteParticleEmitterDistortion"},
+        {342821759u, "direction"},
+        {1902485742u, "WaterColor_fx_globals"},
+        {625634041u, "BX0f7"},
+        {4238601221u, "TilingScaleB"},
+        {1230181611u, "CausticsNM"},
+        {225789316u, "TextureFile"},
+        {2303986235u, "SunBiasedHorizonWidthHeightLatSundis"},
+        {2062940364u, "GodRayEndFade"},
+        {2403094208u, "g_thermalColor"},
+        {2143320180u, "ShadowResolveOrtho"},
+        {1604281535u, "FoamScrollU1"},
+        {2132923506u, "samplerMinAnisotropicMagLinearMipNoneClampMaxAnisotropy4"},
+        {690712283u, "RDEFT"},
+        {329705710u, "SkyLightProbeLocation1"},
+        {1739725963u, "g_colorKeyTextureB"},
+        {2486235409u, "SunGlowColor"},
+        {2621414338u, "CloudColor"},
+        {3286140972u, "g_skyLightCoeff3"},
+        {1376267692u, "DXBCBv"},
+        {2785526762u, "g_texScrollV3"},
+        {745904012u, "DXBCVbq3"},
+        {1874474944u, "PostEffect"},
+        {1454676965u, "CullMode"},
+        {228300468u, "motionBlur"},
+        {1760994973u, "FresnelFuncTexture"},
+        {1963199895u, "SpriteParticleDistortion"},
+        {342173952u, "g_holoColor"},
+        {395031452u, "g_skyLightProbeColor1Texture"},
+        {175326140u, "DXBC1"},
+        {3538106857u, "g_holoTilingRateV"},
+        {712554105u, "ambientOcclusion"},
+        {722787958u, "UVsPerMeter2"},
+        {2131840314u, "g_Boost1"},
+        {810268764u, "samplerMinMagMipLinearClamp"},
+        {2130092413u, "g_fogTurbScale"},
+        {1607614247u, "TexScrollV1"},
+        {151371981u, "DXBCJ"},
+        {3448194900u, "TilingTintOpacity_StructureTint"},
+        {1223440260u, "ParticleWorld"},
+        {2144203811u, "g_BackgroundBoost"},
+        {780336530u, "hideFlatness"},
+        {3281981744u, "Texture2"},
+        {527980697u, "SpecBlendNormalYMap4"},
+        {2369584280u, "frameCount"},
+        {3670538597u, "DetailSelectB"},
+        {117005608u, "SkinnedLODTech"},
+        {164514058u, "FullScreenEffectDOF"},
+        {2703101782u, "g_colorKeyTextureA"},
+        {3304382195u, "TerrainTile_depth_fx_globals"},
+        {3098152758u, "WX"},
+        {67211600u, "Spec"},
+        {1512242873u, "waterMinimap"},
+        {2546663173u, "overlay"},
+        {3420215235u, "g_fogColor"},
+        {1123233890u, "sway_depth_fx_globals"},
+        {3243037851u, "g_appWaterHeight"},
+        {1912793917u, "g_pos"},
+        {3950855071u, "SwayPrevBoilSpeed"},
+        {4029182759u, "Opaque_RigidSkinned_2Overlay"},
+        {890550569u, "g_IsShadowGenPass"},
+        {661933973u, "Scale1_V"},
+        {274536595u, "g_texScrollV1"},
+        {2098260848u, "ColorScale"},
+        {3314211080u, "g_FFDistortionSpeedV"},
+        {3045256053u, "g_skyLightCoeff6"},
+        {2423293620u, "g_FFPlanarDistortionTexture"},
+        {2172996162u, "AuraxiumCloak_RigidSkinned_4Overlay"},
+        {1596185091u, "RDEF4"},
+        {1953095606u, "g_noiseDriftSpeed"},
+        {3438998571u, "AuraxiumCloak_Rigid_4Overlay"},
+        {2627061914u, "FoliageNoiseTexture"},
+        {2872329278u, "periodic"},
+        {3360030638u, "AuraxiumDeRes_Skinned_4Overlay"},
+        {3249412575u, "SHEX0"},
+        {1782963615u, "ForceFieldDistortion_fx_globals"},
+        {831456435u, "SunPosition"},
+        {2542459745u, "Structure_rsm"},
+        {247871098u, "g_unjitteredViewProjMatrix"},
+        {373115320u, "ShadowMapCoeffs"},
+        {3555898231u, "g_EmissiveIsTransB"},
+        {1570727322u, "Holo"},
+        {4169328203u, "detailBump"},
+        {818713453u, "MaxDayColor"},
+        {472536245u, "g_cameraShadow"},
+        {3642591020u, "_PrevBones"},
+        {3316064172u, "DXBC6065C7"},
+        {2030951930u, "StructureSnow"},
+        {1481023092u, "TileQuad"},
+        {3064072798u, "g_lightScattering"},
+        {4203279796u, "g_ScaleStart"},
+        {1691939238u, "SimpleSpriteParticleEmitter_fx_globals"},
+        {2354792286u, "DXBCp"},
+        {3282693429u, "Stream"},
+        {2698480937u, "Tint3"},
+        {3290708687u, "W1H"},
+        {3762586818u, "TexScrollZ2"},
+        {1578752352u, "ShadowFilter_fx_globals"},
+        {2987464089u, "nLodIndex"},
+        {122431981u, "InfraRedOutlineWidth"},
+        {1504248801u, "HologramUVSet"},
+        {2332782286u, "g_shadowResolveOrtho"},
+        {1673930680u, "detail"},
+        {1183416146u, "AuraxiumCloak_Rigid_3Overlay"},
+        {2529102700u, "g_FFColorAutoTileFreq"},
+        {2682299036u, "AuditColor"},
+        {1653478059u, "DXBChT"},
+        {2811640427u, "VisualizerForeground"},
+        {1797086351u, "StructureSkinned"},
+        {3524598527u, "g_splatShadowDepth"},
+        {308552005u, "translation"},
+        {3969055959u, "g_scattering"},
+        {4157153143u, "GP"},
+        {566500740u, "Ag_pow"},
+        {1761512292u, "TilingTintScale_StructureTint"},
+        {3187120034u, "g_FFPlanarNoiseThickness"},
+        {1201223482u, "CoordinateSpace"},
+        {2400932201u, "DV"},
+        {1826740654u, "L"},
+        {323728097u, "Hologram"},
+        {940845777u, "fPositionScale"},
+        {1213875236u, "Transparency"},
+        {2545943895u, "g_ExtraTintTexture"},
+        {2740068419u, "WorldMatrix"},
+        {2749052224u, "g_EnableExtraTint"},
+        {1595607090u, "g_ssaoTexture"},
+        {743846577u, "water2013_fx"},
+        {615471708u, "BeamParticle_FullRes_RenderLevel0"},
+        {2641058150u, "skydome_fx"},
+        {4044057981u, "fRcpLodRange"},
+        {3576369451u, "g_SingleSided"},
+        {1339225245u, "g_FFPlanarreduceBloom"},
+        {741942782u, "DXBCho"},
+        {2157680623u, "SHEXH"},
+        {1909222821u, "writeAlphaMode"},
+        {3067716705u, "threshold_fx_globals"},
+        {3850842623u, "_PrevVirtualViewOffset"},
+        {4020910878u, "g_hdrTexture"},
+        {2340141711u, "g_cloudShadowAlphaPower"},
+        {3075807476u, "HighQualityLighting"},
+        {466859215u, "Ag_backfaceMinOpacity"},
+        {358117613u, "ColorScrollV"},
+        {486074766u, "g_UVsPerMeter1"},
+        {668925675u, "HoloTexture"},
+        {3635415665u, "TerrainLod_depth_fx_globals"},
+        {3685662304u, "GlobalLightLowEnd"},
+        {1004375703u, "DXBC9h"},
+        {438594001u, "BG"},
+        {894129411u, "skyStretch"},
+        {993007725u, "g_FullScreenEffectThermal"},
+        {846349524u, "g_skyLightProbeNormal0Texture"},
+        {2087128709u, "Primitive2DTexture"},
+        {1831977282u, "g_postEffect"},
+        {3394706224u, "Depth_RigidSkinned"},
+        {1227378397u, "g_ColdRoll"},
+        {1535683033u, "heightMap"},
+        {4036894745u, "WriteAlpha"},
+        {1512027178u, "M"},
+        {2153321250u, "TerrainLodTile_fx_globals"},
+        {151485240u, "SpecMin"},
+        {137283583u, "g_gbuffer1Texture"},
+        {3815764333u, "SpecSmoothnessMax"},
+        {3453079430u, "AuraxiumDeRes_RigidSkinned_0Overlay"},
+        {348174059u, "DXBCgdRF"},
+        {2639199589u, "Cube"},
+        {747455238u, "g_isDoubleSided"},
+        {2889301272u, "FtA"},
+        {3176960223u, "ColdMorph"},
+        {4278750442u, "g_jitterOffset"},
+        {575135432u, "g_bumpMap1"},
+        {1984169555u, "Scroll3"},
+        {1038193216u, "g_FoamScrollV"},
+        {1333375020u, "Vertical"},
+        {2132715352u, "g_PatternTiling"},
+        {2540985816u, "BackfaceTingIntensityFactor"},
+        {1261751729u, "Instanced"},
+        {856192782u, "BeamParticle_FullRes_RenderLevel1"},
+        {3724043762u, "Lq"},
+        {1444371486u, "G6"},
+        {2099582121u, "DetailColorMap"},
+        {3405229801u, "FogMap"},
+        {1300307414u, "Volatile"},
+        {640705282u, "OSG58"},
+        {96118246u, "_PrevVirtualView"},
+        {1066582613u, "NormalDistortion"},
+        {554789459u, "CubeFace"},
+        {3735147882u, "g_fogTurbDirection"},
+        {4020702740u, "DXBCZ"},
+        {2076017051u, "uvOffset"},
+        {1439281083u, "g_scatterWashBias"},
+        {1771688486u, "CylindricalWarp_fx_globals"},
+        {3999737831u, "DistortionRiver"},
+        {1289402578u, "NoiseSpeed"},
+        {3727590638u, "DeRes"},
+        {356880671u, "CloakDarkLightColor"},
+        {3338255546u, "DXBCa"},
+        {1975138187u, "CloakColor"},
+        {1437374821u, "AuraxiumDeRes_Rigid_4Overlay"},
+        {476129010u, "_TargetSize"},
+        {904558021u, "Texture1"},
+        {1976133837u, "fontPrimitiveScreenSpace"},
+        {604918621u, "g_specMax"},
+        {3129887706u, "SkyMeshBlend_fx_globals"},
+        {1027080204u, "rgba"},
+        {1588983627u, "DeRes_Rigid_2Overlay"},
+        {1742367212u, "g_bumpMap3"},
+        {3955544551u, "g_color2Texture"},
+        {4044811456u, "g_foamEnabled"},
+        {2306147909u, "texB"},
+        {806327100u, "RRH"},
+        {803865352u, "RainbowGradient"},
+        {1481035626u, "FloraModel"},
+        {3377285004u, "RigidShieldDistortion"},
+        {1079146905u, "OSGNl"},
+        {1362649625u, "Cg_maskViewProj"},
+        {1878463877u, "HoloContrast"},
+        {3878523204u, "dirblur"},
+        {1384518448u, "g_FadeTexture"},
+        {2147269156u, "AuraxiumOpaque_Skinned_1Overlay"},
+        {3730572417u, "g_emissiveCorrectionScale"},
+        {1904222804u, "a_fAOSharpness"},
+        {630217741u, "HotLavaTiling"},
+        {1466494142u, "g_maskViewProj"},
+        {894456213u, "InstanceCached"},
+        {2497757564u, "SkinnedLODs"},
+        {2907896508u, "DepthOfFieldTransition"},
+        {3662816722u, "g_Rotation"},
+        {1725805430u, "Sway"},
+        {883896914u, "float4"},
+        {2201566846u, "overlayEdge"},
+        {4152258527u, "ForceFieldColor_planar"},
+        {1057660481u, "UL"},
+        {1017791300u, "UB_"},
+        {2369326800u, "_EmissiveCorrectionLimit"},
+        {4052107733u, "g_UseUV0ForDetailBump"},
+        {3186400263u, "U3"},
+        {3729086985u, "SpecMinMax5"},
+        {631431002u, "_C"},
+        {2324675627u, "InnerOuter"},
+        {733489573u, "auditHeatmask"},
+        {2831708068u, "Terrain5LayerLod"},
+        {652189431u, "WaterDepthOnly"},
+        {3386079545u, "g_waveNormalUvScale"},
+        {3289376609u, "AScroll"},
+        {2896226140u, "DXBCFi"},
+        {30113031u, "g_shadowSlopeScaledDepthBias"},
+        {1576174528u, "DXBCkT"},
+        {1102702271u, "g_planarNoiseTexture"},
+        {508179865u, "blur_fx_globals"},
+        {2934647641u, "CloakColor_RigidSkinned"},
+        {1690704552u, "common_fxh"},
+        {2496370273u, "BumpV1"},
+        {504498101u, "Fade"},
+        {4095256335u, "enabled"},
+        {3259680540u, "g_shadowFilterType"},
+        {1009915124u, "RDEFD"},
+        {1881419931u, "g_Color"},
+        {72576000u, "g_ModelDoubleSided"},
+        {3290272574u, "Technique1"},
+        {2843912540u, "DistortionSwamp"},
+        {1904321714u, "g_horizonGlowColor"},
+        {726109499u, "SkinnedGlowWith3Textures_Tinted"},
+        {2747585536u, "DistortionStream"},
+        {1040364622u, "BacksideBlur"},
+        {3366561241u, "Yf4"},
+        {2114283318u, "primitiveBillboard"},
+        {3402557608u, "g_FFColorNoiseThickness"},
+        {3536035548u, "RigidCloakDarkLightColor"},
+        {915119072u, "DXBCD"},
+        {1178280435u, "_InvTargetSize"},
+        {1628172864u, "g_PeakAlphaFromTexture"},
+        {1142442165u, "fresnel_func"},
+        {3587388281u, "g_options2"},
+        {2863428940u, "knNcloud_fxh"},
+        {3341407066u, "FontTexture"},
+        {3168108157u, "FtAM"},
+        {248459772u, "g_aoShadowFactor"},
+        {51132362u, "g_projMatrix"},
+        {1773671075u, "ObjectColor"},
+        {1247351665u, "UUU"},
+        {4123990860u, "DistortionScaleU"},
+        {791354219u, "SpriteParticleEmitterDistortion"},
+        {2544359195u, "DXBCYoK"},
+        {3422672669u, "g_WaterDepthTexture"},
+        {2953132540u, "perlinNoiseTexture"},
+        {3419173611u, "ColorNormalXMap2"},
+        {819414163u, "g_worldViewInverse"},
+        {4100226455u, "Horizontal"},
+        {3689916969u, "StratusCloudTiling"},
+        {1364828122u, "FadeOutEnd"},
+        {3972969282u, "DXBCbBN"},
+        {321236921u, "Simple_VS3_PS3"},
+        {1584139736u, "g_toxicFogTexOffset"},
+        {2925355565u, "g_lensEffectsTexture"},
+        {1016515658u, "NormalsBuffer"},
+        {3398145280u, "S"},
+        {2862113788u, "AuraxiumCloak_Rigid_2Overlay"},
+        {742461467u, "Terrain4LayerLod_fx_globals"},
+        {1838423032u, "v4Color"},
+        {1828299239u, "g_prevViewMatrix"},
+        {3707366073u, "F0_"},
+        {2458299960u, "g_texScrollU1"},
+        {459740463u, "g_backfaceRefractionDistanceFactor"},
+        {2003092021u, "g_blurTexture"},
+        {1319704254u, "g_ProbeEvComps"},
+        {2780811435u, "g_ScatterWavelengths"},
+        {2149698427u, "RedSource"},
+        {3762814813u, "g_TransitionSharpness"},
+        {79487122u, "auMetallicMin"},
+        {4175970530u, "g_Boost2"},
+        {491667889u, "ShadowSampleMode"},
+        {259355083u, "ResourceType"},
+        {2755373309u, "g_fogTurbBoilSpeed"},
+        {128569504u, "Bg_glowBase"},
+        {3877669015u, "ShadowFilter"},
+        {2457048077u, "_DynamicResolutionScale"},
+        {3997279877u, "VirtualReality"},
+        {1888717754u, "g_infraRedOutlineWidth"},
+        {2768203037u, "tiled"},
+        {100776617u, "DXBCh"},
+        {958297481u, "g_visualizerForeground"},
+        {2911149488u, "DISTORTION"},
+        {1466633529u, "GLOW"},
+        {3961350317u, "blur"},
+        {1508721027u, "SingleSided"},
+        {3819425053u, "StructureTint_fx_globals"},
+        {3396804529u, "g_waterReflectionHeight"},
+        {221482644u, "g_center"},
+        {25230419u, "ColorKeyLerp"},
+        {429089228u, "DXBCn"},
+        {1543157961u, "g_dirtNoiseScaleStr"},
+        {511929308u, "DXBC6"},
+        {3436946141u, "softness"},
+        {3829201u, "Zoom"},
+        {3750606657u, "DXBC2t"},
+        {13347305u, "g_PatternOpacity"},
+        {2573623143u, "overlayScale"},
+        {408499308u, "rga"},
+        {899620147u, "g_FlimmeringAdjustment"},
+        {471991429u, "_Time"},
+        {2328805684u, "Noise3D"},
+        {3065661922u, "BackfaceRefraction"},
+        {134394178u, "_Submerged"},
+        {122578014u, "dark"},
+        {150437140u, "g_unjitteredProjMatrix"},
+        {3782472106u, "DXBCQ"},
+        {1176002240u, "threshold"},
+        {462282364u, "g_emissiveSlope"},
+        {1833440160u, "g_swayPrevSpeed"},
+        {2456794598u, "g_seconds"},
+        {809832287u, "DXBC7"},
+        {2808414309u, "scattering"},
+        {1822623437u, "Sky_VS30_PS0"},
+        {2198611460u, "g_uvOffsetNScale"},
+        {630516242u, "AlphaBlendToggle"},
+        {1153930728u, "g_scrollU"},
+        {2015148156u, "LensEffects_fx_globals"},
+        {1752405958u, "pointLight"},
+        {4262644427u, "DistortionSpeedU"},
+        {3787047413u, "FoamWaterTiling"},
+        {351411793u, "rigid_depth_fx_globals"},
+        {4123744776u, "Noise"},
+        {3578866600u, "SkyMesh_fx_globals"},
+        {97617292u, "g_texScrollX3"},
+        {579641533u, "Boost1"},
+        {126481472u, "SwayScale"},
+        {3841718677u, "g_UVsPerMeter2"},
+        {1652574888u, "BumpMap3"},
+        {523264865u, "auEmissiveSlope"},
+        {2240358354u, "float4x3"},
+        {3983378853u, "DXBCA"},
+        {69317677u, "DetailMaskMap"},
+        {2605736715u, "InputTextures"},
+        {736408938u, "Model_fx_globals"},
+        {3286689820u, "ScatterLight"},
+        {3590003572u, "StructureNoiseTexture"},
+        {1465821108u, "ParticleTextureParams"},
+        {2958002718u, "specTexture1"},
+        {638099834u, "g_fogHorizontalGradientVector"},
+        {1593346084u, "ConvertDepthMode"},
+        {2233086855u, "g_colorBlindFilterAmount"},
+        {1028449530u, "skyStretch4"},
+        {893694006u, "GBuffer0"},
+        {3665094832u, "DistortionOcean"},
+        {3323167989u, "OSGNP"},
+        {3460420678u, "a_m44World"},
+        {3724540413u, "LensEffectsEnabled"},
+        {357257104u, "g_bloomIn"},
+        {2698056965u, "GroundFog_fx_globals"},
+        {947381123u, "RippleSpeed"},
+        {611026075u, "g_DecalTintHighlight"},
+        {3613436294u, "ObjectShadow"},
+        {1937837786u, "skyOffset2"},
+        {3505959039u, "ShadowDepthBias"},
+        {3620790203u, "ReplicationMask"},
+        {2352193395u, "EmissiveIsTransB"},
+        {4218661880u, "SOE_UIType"},
+        {3495890200u, "CloakColor_Rigid"},
+        {1598910222u, "TilingTintTranslation"},
+        {2667923113u, "ColorBlindFilterAmount"},
+        {2444010307u, "N"},
+        {202271550u, "DXBCMt"},
+        {4184289992u, "ColorWrites"},
+        {712319043u, "g_stratusScrollV"},
+        {4072095364u, "g_Overlay1ColorChannel"},
+        {3961708915u, "g_texScrollU3"},
+        {3406160593u, "DXBCo0"},
+        {966819738u, "g_scrollV"},
+        {4063408707u, "ScreenDirtTex"},
+        {972457354u, "g_Overlay4UVSet"},
+        {605890563u, "g_sunGlowColor"},
+        {1079237624u, "ColorNormalXMap4"},
+        {2171894075u, "g_flareSize"},
+        {1074633191u, "Scroll2"},
+        {432642811u, "g_dirtLayer1SizeStrRanges"},
+        {490748777u, "g_Overlay3Texture"},
+        {1766905825u, "IrisVisionOffset"},
+        {1993383193u, "TexOffset3"},
+        {2147713009u, "O"},
+        {1460163641u, "Dg_skyLightCoeff0"},
+        {3722862818u, "g_wind"},
+        {3567568603u, "ToolPrimitive3DTexNoZTest"},
+        {761725607u, "MinNightFoamC"},
+        {489085579u, "WaterDepth"},
+        {2761341700u, "Scroll3_V"},
+        {1709597645u, "AScroll1"},
+        {3874250402u, "beamParticle_fx_globals"},
+        {129731327u, "TrailParticleEmitterDistortion_fx_globals"},
+        {1890053487u, "ShowDecalTint"},
+        {2843436985u, "g_virtualViewOffset"},
+        {3292523110u, "probe"},
+        {301278162u, "W"},
+        {174222869u, "QBE"},
+        {2700362023u, "Opaque_Rigid_0Overlay"},
+        {224047126u, "g_tintColor"},
+        {3958200357u, "v2Random"},
+        {1131905127u, "g_Overlay3ColorChannel"},
+        {2237640966u, "Pass9"},
+        {987187319u, "g_bonePrevMatrices"},
+        {1259507217u, "CumulusCloudContrast"},
+        {902974021u, "g_sunGlare"},
+        {1481531920u, "CloakColorDistortion_RigidSkinned"},
+        {1646879850u, "UP"},
+        {1638874350u, "WaterColorTech"},
+        {524108748u, "g_allowMotionBlur"},
+        {3476896492u, "RDEFX"},
+        {611553231u, "PickFoliage_fx_globals"},
+        {910638047u, "ScaleY"},
+        {2037111042u, "HorizonWidthHeightLat"},
+        {3587225208u, "LodNearDistance"},
+        {4128395065u, "DesignerInstanced_fx_globals"},
+        {1683278741u, "Transmittance"},
+        {1634230596u, "post"},
+        {2633189717u, "g_fogSkyNear"},
+        {3389200921u, "AuraxiumDeRes_Rigid_0Overlay"},
+        {1894139688u, "auSmoothnessMin"},
+        {3076878004u, "P"},
+        {3261208423u, "detailBlendTexture1"},
+        {3649488835u, "Glow"},
+        {1388565287u, "Il"},
+        {3747341398u, "Center"},
+        {2015411581u, "WireFrame"},
+        {341150111u, "tonemap"},
+        {3782350014u, "HoloNoise"},
+        {173506283u, "StructureTint"},
+        {4106175732u, "SimpleGlow"},
+        {708736894u, "transparency"},
+        {843511206u, "Color3"},
+        {2013530260u, "CameraShakeDir"},
+        {1489280341u, "TerrainTile_depth"},
+        {3448670635u, "CloudShadows"},
+        {3371157990u, "g_aoBlackPoint"},
+        {516910600u, "SkyLightProbeColor1"},
+        {1258683780u, "NoiseTex"},
+        {1628813478u, "ISGN"},
+        {159309831u, "g_StarsColor"},
+        {3808451338u, "TessellationEnable"},
+        {625751260u, "BRDFLookup"},
+        {3705123509u, "g_ForceFieldBlendMode"},
+        {490344869u, "RigidGlowWith2Textures_Tinted"},
+        {1683364040u, "_UnjitteredProjection"},
+        {2291308360u, "BRDF"},
+        {3025325391u, "Overlay2UVSet"},
+        {1592526775u, "CylindricalWarp"},
+        {2343119018u, "Hotness"},
+        {3667969915u, "DepthToAlpha_fx_globals"},
+        {2181885248u, "EnableSceneDepthAlphaCutout"},
+        {1856491255u, "colorkey_identity"},
+        {1480201628u, "g_prevViewProjMatrix"},
+        {549999209u, "ShieldColor_Skinned"},
+        {746601592u, "AScroll2_U"},
+        {1090009664u, "SHEX"},
+        {1163141504u, "DXBC9y"},
+        {3804722836u, "FW"},
+        {2604346521u, "Post"},
+        {92425766u, "samplerMinMagPointMipNoneClamp"},
+        {4198915509u, "Scattering"},
+        {1133841079u, "EmpireTintA"},
+        {140281254u, "ZBufferStructures"},
+        {189579506u, "g_viewMatrix"},
+        {3522110412u, "OSGN"},
+        {3770133457u, "skyStretch2"},
+        {1501173307u, "YeHU"},
+        {503483689u, "Ect"},
+        {1251189167u, "SwaySpeed"},
+        {1753087199u, "g_specGlowTexture"},
+        {784679747u, "PointLightRange"},
+        {46064047u, "NightLightsMap"},
+        {3190331952u, "when"},
+        {350145606u, "forcefieldcolor_planar_fx"},
+        {2843915332u, "g_gbuffer0Texture"},
+        {2094653706u, "Terrain5Layer_VS3_PS3"},
+        {311997911u, "BackgroundColor"},
+        {3271824314u, "FadeOutStart"},
+        {2490044996u, "DeResGlow_Rigid"},
+        {3757180001u, "CloudSilverLiningBrightness"},
+        {3756019322u, "g_minNightIntensityOnFoam"},
+        {998623848u, "DefaultTextures"},
+        {1512074313u, "g_density"},
+        {1030203968u, "TexOffset4"},
+        {3558635675u, "g_skyLightProbeLoc1"},
+        {2955350605u, "densityTexture"},
+        {2202799551u, "g_nightVisionNoise"},
+        {1820622916u, "StratusCloudScrollV"},
+        {3837028071u, "SpecMinMax4"},
+        {2747100841u, "Blur2"},
+        {2208710895u, "daylightCompensator"},
+        {1165760196u, "tonemap_fx_globals"},
+        {1389936306u, "AuraxiumOpaque"},
+        {3863846253u, "Stage"},
+        {987242684u, "heatMask"},
+        {2612909563u, "TilingTintRotation"},
+        {624314968u, "H"},
+        {1511925019u, "PickTerrain"},
+        {1462723714u, "MaxDayFoamC"},
+        {2420308256u, "AuraxiumDeRes_Rigid_3Overlay"},
+        {3891897073u, "SourceMipLevel"},
+        {1363672736u, "Highlight"},
+        {3111264226u, "g_BackFaceFadeDis"},
+        {954377901u, "ColorKeyA"},
+        {2661414118u, "g_Ascroll3_U"},
+        {1467877252u, "bloomblur"},
+        {1790190115u, "g_Boost"},
+        {3330852111u, "FadeOverride"},
+        {851428756u, "g_minDayIntensityOnFoam"},
+        {790903577u, "g_Overlay1Tiling"},
+        {1616730090u, "TintedDeRes"},
+        {2054891270u, "g_E3Brightness"},
+        {413059274u, "DirShadowMapCoeffs"},
+        {3128891876u, "g_DetailFreqB"},
+        {1412577084u, "g_virtualCameraOffset"},
+        {2237765959u, "FogSkyNear"},
+        {2194703889u, "g_skyLightCoeff7"},
+        {2631605108u, "transform"},
+        {1039054553u, "SSAO"},
+        {105814258u, "PostFocus"},
+        {2920316148u, "Globals"},
+        {2449465558u, "floraModel_rsm_fx_globals"},
+        {638091105u, "depthBias"},
+        {1538489402u, "g_normalMapTextureTexture"},
+        {1402004625u, "CloudTextureFrom"},
+        {1657369563u, "ColorTexture2"},
+        {3697960859u, "DXBCg"},
+        {1422138880u, "g_scale3_U"},
+        {1608507291u, "PuBct"},
+        {4105902236u, "BeamParticle_RenderLevel2"},
+        {1457144776u, "AuraxiumOpaque_RigidSkinned_0Overlay"},
+        {2541324825u, "AntiBloom"},
+        {1577559291u, "g_Background"},
+        {2117287401u, "SV_Depth"},
+        {3233418366u, "samplerMinMagMipLinearWrapUClampV"},
+        {135535102u, "g_silverLiningThickness"},
+        {1540765459u, "TexScrollU1"},
+        {1522305233u, "AlphaOnSolidModelPosTech"},
+        {2641041397u, "g_maxDayIntensityOnColor"},
+        {2638341898u, "g_FFColorColorTexture"},
+        {1404744822u, "g_maxPointiness"},
+        {2399610534u, "g_cumulusContrast"},
+        {973401990u, "Refraction"},
+        {890110161u, "SHEXD"},
+        {2280661820u, "TilingTint_StructureTint"},
+        {2426020107u, "RigidLODs_fx_globals"},
+        {2398726503u, "GLAZE"},
+        {2826869555u, "AlphaBlendModelPosTech"},
+        {937483406u, "CloudBlend_fx_globals"},
+        {2335149086u, "Sky_VS11_PS0"},
+        {1692412075u, "CompositeSky"},
+        {1683126549u, "Opaque_Skinned_1Overlay"},
+        {1856244627u, "g_tintAlpha"},
+        {4232179496u, "LightTypeRSM"},
+        {1476138084u, "detailMaskUsageOrder"},
+        {1348256761u, "TrunkInstanced_fx_globals"},
+        {2790840748u, "colorTexture"},
+        {420784001u, "Scroll1_U"},
+        {3400293839u, "SevenTapGaussian"},
+        {2520562928u, "primitiveBillboard_fx_globals"},
+        {3364900562u, "g_dirBlurMode"},
+        {3295886728u, "g_hologramBlend"},
+        {1162938689u, "aColors"},
+        {1254266990u, "DecalUVSet"},
+        {2514937756u, "RDWo1"},
+        {4149894730u, "NORMAL"},
+        {1662474751u, "m44World"},
+        {3428325546u, "Contrast"},
+        {531143697u, "g_OverlayNMTexture"},
+        {3175105478u, "_VirtualCameraOffset"},
+        {332118656u, "forcefieldcolor_fx"},
+        {3253219755u, "CloakColor_Skinned"},
+        {1555112473u, "g_infraRedColor"},
+        {1822363766u, "TerrainRSM_VS3_PS3"},
+        {1633561708u, "g_shadowDomain"},
+        {518405101u, "camera"},
+        {4226181025u, "g_weatherQuality"},
+        {2097600412u, "g_cameraMatrix"},
+        {3842441768u, "g_boneMatrices"},
+        {2338360063u, "RigidCloakDistortion"},
+        {2134367159u, "DepthPrePass"},
+        {2800375175u, "g_AlphaContrast"},
+        {494861210u, "g_FFColorNoiseAlpha"},
+        {2442933156u, "IMS"},
+        {934098083u, "TexOffset"},
+        {4231495564u, "J2T"},
+        {1121830432u, "AuraxiumCloak_Skinned_3Overlay"},
+        {2364821651u, "g_glazeMax"},
+        {2885512725u, "Compiler"},
+        {1482375395u, "ToolPrimitive2D"},
+        {2078743614u, "g_secondsDelta"},
+        {1276314345u, "ISGND"},
+        {1736753988u, "g_submerged"},
+        {2696765629u, "Opaque_RigidSkinned_0Overlay"},
+        {523229553u, "Metalic"},
+        {3995356225u, "Terrain3LayerLod"},
+        {3003659667u, "Mud"},
+        {1744706371u, "g_fogFar"},
+        {4279914974u, "g_animationOffsetV"},
+        {1268557289u, "Hw3"},
+        {2052743272u, "DebugObjectTranslucent_fx_globals"},
+        {520058832u, "cube"},
+        {2270832967u, "DebugText"},
+        {1349265232u, "g_TopFrame"},
+        {1429574962u, "tread"},
+        {834727078u, "Trunk"},
+        {3929514881u, "g_Boost3"},
+        {4783647u, "TilingTintMidtone_StructureTint"},
+        {1816631059u, "water_fx_globals"},
+        {4026771280u, "skyhorizon_fx"},
+        {616525971u, "g_skyProbeColor"},
+        {2605949149u, "ColdLavaTiling"},
+        {2059762042u, "FoamStart"},
+        {3696425875u, "g_weatherEnabled"},
+        {672141745u, "SourceColorTexture"},
+        {3605200632u, "g_PolarizerStrength"},
+        {189326302u, "PlanetAtmosphere_fx_globals"},
+        {4175964838u, "TANGENT"},
+        {2105029476u, "PatternGlow"},
+        {937327594u, "g_Overlay2ColorChannel"},
+        {182942211u, "ambient"},
+        {3547218091u, "g_depthOpacityNegativeBias"},
+        {179314118u, "g_options"},
+        {2744817747u, "InfraRedOutlineAlpha"},
+        {807290868u, "g_prevVirtualViewOffset"},
+        {4094133844u, "SpecSmoothness"},
+        {3878324139u, "foliage_fx"},
+        {4044168444u, "ScreenDirt"},
+        {1907861119u, "terrain_audit_fx_globals"},
+        {492651060u, "AScroll1_U"},
+        {2846905212u, "g_centerFalloffCutoff"},
+        {2938008512u, "Sediment"},
+        {816367930u, "PickRigid_fx_globals"},
+        {2541486151u, "TilingTintHighlight_StructureTint"},
+        {2693811316u, "back"},
+        {3365748885u, "BeamParticle_RenderLevel0"},
+        {3220296142u, "g_emissiveScale"},
+        {1420559152u, "FogSkyFar"},
+        {2201291178u, "Character"},
+        {1532717930u, "ColorNormalXMap"},
+        {1943544531u, "Height"},
+        {2185879211u, "XRayGrid_fx_globals"},
+        {3756981340u, "Acommon_fxh"},
+        {1264759665u, "Iyk3"},
+        {1251406869u, "caustic"},
+        {1669482929u, "DXBCZmJ"},
+        {4108391727u, "g_depthScale"},
+        {53747877u, "g_swayStrength"},
+        {322832421u, "SV_InsideTessFactor"},
+        {3163601755u, "Scale3_V"},
+        {2574080545u, "Bloom"},
+        {2916778447u, "SkyMeshBlend"},
+        {2092208449u, "TurbulenceBoilSpeed"},
+        {1043021458u, "Scale3_U"},
+        {931971821u, "AuraxiumOpaque_Rigid_2Overlay"},
+        {1708226214u, "TexStretch2"},
+        {1891093294u, "g_ExtraTintOpacity"},
+        {294164585u, "Scroll1_V"},
+        {1830006335u, "ScreenDirtLookupTex"},
+        {799502443u, "ForceFieldBGOpacity"},
+        {2605276714u, "g_eNoise3DTexture"},
+        {908277539u, "Green"},
+        {3276938074u, "RigidOpaque"},
+        {341420384u, "Scale1_U"},
+        {1082169518u, "OrU7"},
+        {336483594u, "g_random"},
+        {424377348u, "auNoiseDriftSpeed"},
+        {4177877784u, "SpecB"},
+        {135566066u, "Opacity_"},
+        {2453607900u, "g_dirtLayer2SizeStrRanges"},
+        {112722497u, "DXBC33"},
+        {2809876326u, "g_skyLightCoeff5"},
+        {3747835552u, "g_nightVisionScanLines"},
+        {2443964642u, "DXBCha"},
+        {556643803u, "FrameWidth"},
+        {1006334779u, "ForceFieldColor_fx_globals"},
+        {1119157485u, "g_FoamColor"},
+        {1401609382u, "RollTiling"},
+        {4188591915u, "ParticleColor"},
+        {1601788631u, "DXBCZcO"},
+        {2340703708u, "PerlinNoise3D"},
+        {2695006387u, "ScrollV_"},
+        {1598540764u, "GlobalLightLowEnd_fx_globals"},
+        {2891018533u, "RigidGlass"},
+        {583828381u, "Timer"},
+        {581252059u, "g_DamageCubeTexture"},
+        {751147975u, "AuraxiumCloak_Rigid_0Overlay"},
+        {1078746172u, "Boost3"},
+        {2192097657u, "g_horizonWidthHeightLat"},
+        {1716414136u, "DetailMask"},
+        {2040717205u, "g_opacity"},
+        {475658644u, "RigidDeResDepth"},
+        {599959210u, "ENoise3D"},
+        {4256443694u, "samplerMinAnisotropicMagMipLinearWrapMaxAnisotropy8"},
+        {1267172730u, "g_visualizeLightCoverage"},
+        {1322777076u, "Cloak"},
+        {3523150420u, "alphaEnabled"},
+        {1352337006u, "Source0"},
+        {2505155022u, "g_DecalTintTranslation"},
+        {2564809663u, "TwoSidedInstanced_fx_globals"},
+        {1440590231u, "g_animationShift"},
+        {920662136u, "SkyMesh"},
+        {1974590214u, "SkyLightCoeff2"},
+        {248593035u, "AlphaOnSolidTech"},
+        {3989194025u, "DecalTint"},
+        {1005495621u, "AuraxiumDeRes_RigidSkinned_1Overlay"},
+        {1682167792u, "g_BloomBlurStages"},
+        {1340559030u, "g_ShowTilingTint"},
+        {3084466500u, "g_thermalRange"},
+        {3115827389u, "CloudDensityTexture"},
+        {3952409191u, "AuraxiumRigidCloak"},
+        {1799120840u, "g_shadowSampleMode"},
+        {3562514005u, "FoamColor"},
+        {3820618318u, "Slope"},
+        {3807715644u, "ColorNormalXMap5"},
+        {2999878428u, "SpecMinMax3"},
+        {476382342u, "FogDepthHorizontalMult"},
+        {956852740u, "NightVisionWhitePointAdjustment"},
+        {1227349128u, "TerrainTile"},
+        {4245383116u, "Eg_sunGlowMin"},
+        {862373033u, "litMode"},
+        {2960390831u, "fogAngleColorGradientTexture"},
+        {3541322851u, "PostLowEnd"},
+        {2764082559u, "beam_mask"},
+        {2781397032u, "End"},
+        {1639754217u, "SatelliteBrightness"},
+        {1040038212u, "CubeFaceRight"},
+        {1345830208u, "g_FFColorreduceBloom"},
+        {3540542002u, "Overlay4"},
+        {1563616881u, "g_FFDisPlanarDistortionTexture"},
+        {2273557438u, "Noise2D"},
+        {1963378948u, "BackfaceMaxOpacity"},
+        {2557620812u, "red"},
+        {1019267113u, "brightness"},
+        {2581943053u, "Opaque_RigidSkinned_4Overlay"},
+        {1263710430u, "g_lensEffectsEnabled"},
+        {3465979259u, "UVsPerMeter0"},
+        {1722219833u, "GA"},
+        {3275091090u, "CombineMasks"},
+        {2889082803u, "Overlay4Tiling"},
+        {67491352u, "BackgroundBoost"},
+        {1161130322u, "texProj"},
+        {2041713667u, "both"},
+        {1273154053u, "Ey"},
+        {1133556969u, "DeResGlass"},
+        {2985661334u, "auditColors"},
+        {1898217081u, "Pattern"},
+        {409895717u, "Grey"},
+        {3838484911u, "SpriteParticle"},
+        {1841339381u, "knN"},
+        {3372859618u, "DXBCC"},
+        {838563879u, "g_Scale"},
+        {1362780268u, "g_Sigma"},
+        {1572263974u, "float4x4"},
+        {2599425051u, "Flora"},
+        {3874548403u, "a_m43World"},
+        {3483538323u, "g_mainSceneCameraPos"},
+        {3845369017u, "g_skyLightTexture"},
+        {2763400826u, "g_skyFogShadowsEnable"},
+        {303831949u, "g_HotLavaTexture"},
+        {976626284u, "StructureColorTech"},
+        {504318507u, "g_shadowTexture"},
+        {3201225660u, "g_EmpireTintA"},
+        {2419788596u, "ISGNH"},
+        {3695818876u, "R"},
+        {2942279698u, "Terrain1LayerLod"},
+        {1854097830u, "LightColor"},
+        {2555020451u, "Hologram_RigidSkinned"},
+        {646995462u, "TransitionSharpness"},
+        {1764804529u, "MaxNightColor"},
+        {2206022578u, "g_FFPlanarNoiseTiling"},
+        {1611932068u, "PickFoliage"},
+        {1666748136u, "g_HotLavaTiling"},
+        {1040350954u, "Opaque_RigidSkinned_1Overlay"},
+        {1307830056u, "SpriteParticleEmitterFillVisualization"},
+        {753570882u, "SkyMaskStencilTechClear"},
+        {4214477740u, "g_toxicFogDistantColor"},
+        {3374699162u, "BlackPoint"},
+        {4194317814u, "Light"},
+        {2657907411u, "ambientOcclusionUpsample_fx_globals"},
+        {3931499162u, "StructureWsOverlay_fx_globals"},
+        {449654426u, "g_TAAEnabled"},
+        {2392280341u, "GX"},
+        {3369025661u, "DXBCy"},
+        {3689240501u, "g_sourceTexture1"},
+        {2956527784u, "diffuse2Texture"},
+        {903734420u, "g_ExtraTintColorB"},
+        {4228987011u, "deres_fxh"},
+        {1151454843u, "SplatShadowDepth"},
+        {602174681u, "flora"},
+        {1639021455u, "g_noDepth"},
+        {4176860133u, "AuraxiumCloak_Skinned_1Overlay"},
+        {570287632u, "g_TransitionWidth"},
+        {1845493063u, "g_FrameFade"},
+        {2967190797u, "Designer"},
+        {1828823994u, "front"},
+        {3185787176u, "RigidGlowWith3Textures_Tinted"},
+        {2059163900u, "grass"},
+        {2516714778u, "g_invGamma"},
+        {3863930u, "auColorShiftStrength"},
+        {2091090103u, "g_InnerOuter"},
+        {4222724041u, "g_useDynamicWaterReflection"},
+        {3875337804u, "spriteParticle_fx_globals"},
+        {2052177330u, "DirectionalLightShadowMap"},
+        {1389916664u, "EnableAlphaCutout"},
+        {877887688u, "PickRigid"},
+        {1172739366u, "Density"},
+        {2300402437u, "SV_TessFactor"},
+        {1871916574u, "slop"},
+        {887689055u, "g_clipSpaceMotion"},
+        {1196889643u, "ColoredFogEnabled"},
+        {294521833u, "GlowWith1Texture_Tinted"},
+        {2254054884u, "g_ForceFieldShieldBGColor"},
+        {2556547618u, "g_swaySmoothing"},
+        {1890334215u, "g_OverlayB"},
+        {1694664876u, "InfraRedScanLines"},
+        {2277245775u, "InForeground"},
+        {925015773u, "g_DetailBumpiness"},
+        {2573861599u, "Tint"},
+        {3082708823u, "g_texScrollV2"},
+        {3521712495u, "SpecGlow"},
+        {8823747u, "CloudsEnabled"},
+        {2450369122u, "NightLightsTexture"},
+        {1542294626u, "g_GlowBrightness"},
+        {1242786559u, "g_bumpiness3"},
+        {1362671417u, "index"},
+        {68278456u, "XGdi"},
+        {1510443766u, "g_backfaceRefraction"},
+        {1539251669u, "g_toxicFogVariation"},
+        {3234319489u, "CloakDepth"},
+        {3890304517u, "UIMax"},
+        {3705094652u, "UVsPerMeter1"},
+        {3145928884u, "ScrollU"},
+        {1065552407u, "g_scale2_U"},
+        {3540298767u, "g_obscure"},
+        {578697997u, "Cloak_RigidSkinned_4Overlay"},
+        {1762530756u, "ToolPrimitive3DTex"},
+        {344109606u, "samplerMinMagPointMipNoneBorder"},
+        {3380569764u, "Offset"},
+        {61882798u, "FrameRatio"},
+        {1723402422u, "TurbulenceEnable"},
+        {3151602677u, "g_randomSeed"},
+        {659402947u, "srcBlend"},
+        {1686051506u, "g_infraRedOutlineAlpha"},
+        {3731096925u, "Structure"},
+        {3977934510u, "RDEFx"},
+        {4130478898u, "DXBCV"},
+        {1149022913u, "Nqxa"},
+        {138962006u, "CHANGE"},
+        {1192395765u, "g_ScrollV"},
+        {417071689u, "Satellite_fx_globals"},
+        {2757276660u, "g_objectShadow"},
+        {3109138973u, "clover_N"},
+        {592373806u, "g_BlurIntensity"},
+        {2360783676u, "AOSize"},
+        {3996008638u, "e_Texture"},
+        {388063800u, "Normals"},
+        {4043897772u, "auBlackShiftStrength"},
+        {88197781u, "SkyBox_VS2_PS2"},
+        {586565210u, "g_skyLightCoeff0"},
+        {4037441503u, "SHEXd"},
+        {2342953801u, "g_animTiling"},
+        {879723723u, "XJ"},
+        {1895583708u, "ColorMapScrollY"},
+        {2941820163u, "Auraxium_fx_globals"},
+        {1481621783u, "RandomSeed"},
+        {723772316u, "detailBlendTexture"},
+        {2253271152u, "DeRes_RigidSkinned_0Overlay"},
+        {3197904550u, "PreLit"},
+        {1746979041u, "g_Overlay2Tiling"},
+        {3373848684u, "ParticleMaskTextureMap"},
+        {1034128056u, "Specularity"},
+        {2770825830u, "g_swaySpeed"},
+        {383452058u, "DepthToAlpha"},
+        {3250157740u, "post_fx_globals"},
+        {1834247013u, "TerrainAudit_DX6_VS1_PS0"},
+        {743729426u, "Background"},
+        {468278803u, "Pass1"},
+        {1461446520u, "Pm3XQ"},
+        {330444510u, "AScroll1_V"},
+        {2351274034u, "StratusCloudHeight"},
+        {3172378836u, "DXBCu"},
+        {2727776327u, "g_ScaleEnd"},
+        {3284523149u, "KeyLuminance"},
+        {2251825868u, "cloud_fxh"},
+        {593143206u, "g_maskResolution"},
+        {177908343u, "FoamUVScale"},
+        {1019468567u, "RigidInstancedDepth_VS3_PS3"},
+        {1665523131u, "g_sunLightColor"},
+        {3264153973u, "samplerMinMagLinearMipPointClampBiasNeg0_5"},
+        {1997514539u, "_ViewProj"},
+        {3925822127u, "pointLight_fx_globals"},
+        {3439967770u, "TexScale1"},
+        {452158644u, "DXBCU"},
+        {787911917u, "AuraxiumDeRes_Rigid_2Overlay"},
+        {2651690862u, "ColorNormalXMap1"},
+        {3381535606u, "cm"},
+        {2828536730u, "swayInstanced_depth"},
+        {1127768697u, "Cloak_Skinned_0Overlay"},
+        {324284482u, "AlphaBlend"},
+        {181570266u, "motionFixup"},
+        {2490318710u, "SHEXT"},
+        {2687746407u, "AuraxiumDeRes_Rigid_1Overlay"},
+        {1862270803u, "g_causticHeightFadeInStart"},
+        {1868913557u, "g_glaze"},
+        {3936513778u, "ScrollV"},
+        {4265213024u, "F"},
+        {2788279274u, "WaterDepthStream"},
+        {726261996u, "DXBCBL"},
+        {2198555586u, "GBuffer1"},
+        {133031257u, "g_TilingTintScale"},
+        {3588466u, "g_bloomTexture"},
+        {1978780270u, "AuraxiumDeRes_Skinned_3Overlay"},
+        {4145696726u, "samplerMinMagMipPointWrapUClampV"},
+        {91425696u, "g_Horizontal"},
+        {2922486694u, "g_DepthOfFieldTransition"},
+        {2554558841u, "float2"},
+        {713651580u, "Swamp"},
+        {3518059045u, "DXBCP"},
+        {3326040293u, "AuraxiumOpaque_RigidSkinned_4Overlay"},
+        {2386947694u, "PatternAlpha"},
+        {1072163347u, "AuraxiumCloak_RigidSkinned_2Overlay"},
+        {1893402049u, "g_foamDepthBias"},
+        {2211636981u, "UVScale"},
+        {4205916759u, "g_pixelShaderIndex"},
+        {3120321311u, "EcUG"},
+        {1589812716u, "globalConstants_fxh"},
+        {601060976u, "DXBCG"},
+        {4063797282u, "Elasticity"},
+        {2187137085u, "filldepth"},
+        {507668961u, "IM"},
+        {3944687859u, "g_nightVisionIntensity"},
+        {3548030554u, "TexScrollU2"},
+        {1377503594u, "SpriteParticleFullRes"},
+        {243000745u, "StructureDecal"},
+        {968890061u, "White"},
+        {3388865649u, "SunBiasedHorizonGlowColor"},
+        {1781145171u, "PatternScaler"},
+        {2722889459u, "SkinnedDepth"},
+        {3721939166u, "CloakDepth_RigidSkinned"},
+        {4132979297u, "Intensity"},
+        {4265930098u, "DistortionLameScale"},
+        {3640079977u, "debugColors"},
+        {2723199680u, "g_ShieldColor"},
+        {3897643281u, "g_skyLightCoeff1"},
+        {796930681u, "Desat"},
+        {2858678411u, "ObjectGrid"},
+        {3585079290u, "g_E3Blur"},
+        {1318992077u, "detailScale5"},
+        {1660181888u, "g_CornerFrame"},
+        {1506243635u, "JCm"},
+        {3862815298u, "water_fx"},
+        {1705978005u, "g_OverlayEdge"},
+        {2580144699u, "DXBCw"},
+        {2303777705u, "g_noise"},
+        {1664328722u, "AuraxiumCloak_Skinned_4Overlay"},
+        {3748078439u, "g_bumpCleanup"},
+        {3411953958u, "Terrain1LayerLod_fx_globals"},
+        {4289278755u, "MotionBlur"},
+        {710078270u, "RGBA"},
+        {689773670u, "g_mipLevel"},
+        {2137856517u, "BlendValue"},
+        {3597741716u, "specMinMax3"},
+        {2759433534u, "EnableExtraTint"},
+        {1236191597u, "CameraShadow"},
+        {3727247704u, "DebugCharacterTranslucent"},
+        {1138531733u, "Bg_contrast"},
+        {514249047u, "EnvFilter"},
+        {3097098055u, "DecalTintMidtone"},
+        {673868074u, "FogColor"},
+        {2181847035u, "CloudShadowAlphaPower"},
+        {1618405433u, "skyLerp3"},
+        {395335693u, "Sky2_VS11_PS0"},
+        {2076871765u, "skyTextureSkyDomeUniqueName"},
+        {2029677084u, "SatelliteWorldMatrix"},
+        {2421720612u, "g_FFColorNoiseTiling"},
+        {3753358084u, "ParticleNormalTexture"},
+        {1235715807u, "g_sunLightDir"},
+        {254469454u, "BloomBlurStageCount"},
+        {821143615u, "g_DetailBumpTexture"},
+        {2266493490u, "Dm43World"},
+        {4094805005u, "auSmoothnessMax"},
+        {59743657u, "SHEXx"},
+        {1195808802u, "DirectionalLightShadowViewProj"},
+        {1571817543u, "Glaze"},
+        {2348857912u, "knNg_fogSkyNear"},
+        {1235790286u, "g_FoamScrollU"},
+        {245724624u, "BlurSource"},
+        {2481186467u, "StreamWater"},
+        {2341785288u, "_PrevView"},
+        {3692591507u, "ProbeEvComp"},
+        {556289510u, "Opaque_Skinned_4Overlay"},
+        {2554032585u, "SkinnedLODs_fx_globals"},
+        {3029917815u, "CloundBlendingTech"},
+        {224151653u, "g_color3Texture"},
+        {324213819u, "g_timeStep"},
+        {1095877308u, "ROUGH"},
+        {3603229232u, "g_phaseShift"},
+        {2926214267u, "DepthOpacityBias"},
+        {589322910u, "g_holoTilingRateU"},
+        {427589430u, "g_glow"},
+        {4245390253u, "V11_P20"},
+        {3171268558u, "g_cumulusTiling"},
+        {1593837911u, "DXBCnp"},
+        {2006410494u, "g_ScrollU"},
+        {3363876480u, "SpecMinMax2"},
+        {1489898296u, "g_ForceFieldNoiseSpeed"},
+        {1631980135u, "PerlinNoise"},
+        {835536414u, "g_scanSpeed"},
+        {2335311522u, "DXT3"},
+        {2292646548u, "g_maskTexture"},
+        {402529297u, "g_SpecBTexture"},
+        {3936184964u, "GlowMin"},
+        {204902162u, "ShadowResolve"},
+        {3950789818u, "g_Overlay2UVSet"},
+        {1793725763u, "Ag_swayBoil"},
+        {1432302123u, "Scale2_V"},
+        {3191409764u, "OpaqueInstanced"},
+        {3893190900u, "g_waveNumber"},
+        {2045335925u, "TerrainAuditHeatmask"},
+        {4234668096u, "ShowTilingTint"},
+        {740750398u, "g_texScale3"},
+        {831696450u, "BFaceRfraDisFactr"},
+        {3448985948u, "FoamDepthBias"},
+        {3844378250u, "TexScrollZ3"},
+        {1443614995u, "ScreenFrameUI"},
+        {1235910012u, "HorizonGlowColor"},
+        {703771813u, "g_bloomEnabled"},
+        {3271640532u, "g_YawPitchRollFace"},
+        {3033202733u, "SHEXX"},
+        {1607558634u, "Pass3"},
+        {3910047106u, "GreenChannel"},
+        {2871351462u, "g_FFPlanarColorMapTiling"},
+        {2310070737u, "AuraxiumOpaque_Skinned_4Overlay"},
+        {2528022211u, "AuraxiumOpaque_Rigid_3Overlay"},
+        {1252812156u, "UV0"},
+        {1292919212u, "SkyBox_VS11_PS2"},
+        {2372035392u, "ObjectGrid_fx_globals"},
+        {2625129148u, "g_WaveScrollV"},
+        {3277694582u, "BlurQuarterUpscaleSource"},
+        {2525401007u, "g_horizonFadeHeight"},
+        {2003658702u, "OSGNh"},
+        {3120341720u, "DXBCz"},
+        {1753966226u, "Bumpiness2"},
+        {1747511450u, "FallOff"},
+        {1516191759u, "g_backfaceMaxOpacity"},
+        {2752875657u, "BacksideSpec"},
+        {279659508u, "StealthDistortion"},
+        {678189709u, "BumpMap"},
+        {3547169280u, "g_rippleX"},
+        {1382385566u, "g_TilingOverlayTexture"},
+        {928941110u, "GlowContrast"},
+        {2704174839u, "g_Tint2"},
+        {2434736814u, "g_skyLightCoeff8"},
+        {2869595675u, "g_glowMax"},
+        {2785362153u, "DXBC3d"},
+        {1573964470u, "MinDayColor"},
+        {3907567438u, "Ocean"},
+        {150437396u, "_TAAEnabled"},
+        {1946309772u, "g_distanceThicknessParams"},
+        {1370575583u, "_View"},
+        {2256634818u, "Freq"},
+        {602518175u, "ISGNd"},
+        {581738526u, "RD11"},
+        {1070705699u, "FogGradient"},
+        {1551820593u, "g_focus"},
+        {1771008475u, "g_swayBoil"},
+        {1073655006u, "GodRayStartFade"},
+        {1537312199u, "g_skyLightTextureTint"},
+        {3828789530u, "g_OverlayTexture"},
+        {1847538729u, "Smoothness"},
+        {4139660010u, "g_layerWeightings"},
+        {3545436864u, "g_targetRes"},
+        {2062996628u, "BumpU3"},
+        {1679943667u, "_EyePosition"},
+        {1828441186u, "g_bloomStrength"},
+        {4182274309u, "g_fogDensity"},
+        {3733227467u, "g_sunLightShadowTexture"},
+        {3198918665u, "Ag_swayPrevBoil"},
+        {2397031002u, "g_Tint1"},
+        {3301710915u, "g_skyLightProbeLerp"},
+        {3508855631u, "HoloNoiseSpeed"},
+        {1108184160u, "DistortionTexture"},
+        {3168093473u, "g_cumulusScrollU"},
+        {3876359383u, "g_BackGroundOpacity"},
+        {4086916043u, "skyTexture4"},
+        {2561142134u, "OverlayB"},
+        {2004652573u, "BLENDWEIGHT"},
+        {3232476706u, "SpriteParticleFullResInWater"},
+        {2036500148u, "g_DepthImpact"},
+        {4095475761u, "g_objectID"},
+        {3806338341u, "debugLod"},
+        {1120711706u, "g_dirtBloomSunSkyStrAlpha"},
+        {2334988629u, "g_ScaleX"},
+        {4150776748u, "Cloak_Skinned_1Overlay"},
+        {3867813042u, "DXBCQD"},
+        {1564861855u, "K4"},
+        {2180269699u, "FadeModelMaterial"},
+        {2333739691u, "g_scale3_V"},
+        {1444938388u, "MainSceneCameraPos"},
+        {3073666646u, "B"},
+        {797223297u, "UB1"},
+        {656181278u, "BlendMode"},
+        {2237991376u, "MiniMapWater"},
+        {3135067336u, "DamageVectors"},
+        {1419551865u, "ForceFieldAdditive"},
+        {2332133741u, "g_offset"},
+        {2111332152u, "Dg_objectID"},
+        {2327943622u, "elasticity"},
+        {1687192604u, "g_waterTessYBias"},
+        {3445007575u, "samplerMinAnisotropicMagLinearMipPointWrapMaxAnisotropy4"},
+        {3276111693u, "g_viewProjMatrix"},
+        {949590547u, "MA"},
+        {146649968u, "CloakDepth_Rigid"},
+        {1991718926u, "FoliageGlowScrollInstanced"},
+        {1344290505u, "g_Ascroll1_V"},
+        {677181406u, "Glow_fx_globals"},
+        {2025203475u, "TankTread"},
+        {3967310045u, "G"},
+        {2335959642u, "BlueSource"},
+        {2779979592u, "ScrollU_"},
+        {1305998655u, "skyTexture"},
+        {1244986993u, "EnablePlanarTint"},
+        {190007331u, "Black"},
+        {3862059423u, "ColorChannel"},
+        {3963312223u, "U"},
+        {112740062u, "WorldScale"},
+        {742382425u, "g_SparkFlowX"},
+        {79276348u, "DetailBumpinessB"},
+        {545627888u, "HoloNoiseTiling"},
+        {4255540749u, "ISGNL"},
+        {723152057u, "maskTexture"},
+        {1137153491u, "TrailParticleEmitter"},
+        {2262124626u, "FoliageInstanced"},
+        {2953383609u, "DXBCv"},
+        {1073553983u, "g_NoiseSpeed"},
+        {449209422u, "DXBCK"},
+        {829889803u, "view"},
+        {1369262730u, "skyLerp2"},
+        {1990396349u, "RDEFd"},
+        {1756487063u, "CumulusCloudScrollU"},
+        {3359108310u, "blackPoint"},
+        {346290961u, "DXBCPT"},
+        {4072977514u, "BackgroundAlpha"},
+        {2021304301u, "Hologram_Rigid"},
+        {1130196482u, "g_fogTurbDensityRange"},
+        {3921183598u, "Gv"},
+        {2744317421u, "DXBCc"},
+        {2582046029u, "g_depthPrePass"},
+        {1689301453u, "DXBCdd"},
+        {1441896667u, "g_ColorScrollV"},
+        {620735428u, "GlassTech"},
+        {3660100800u, "g_skyLightCoeff4"},
+        {3192104870u, "TransitionWidth"},
+        {2115110280u, "ParticleDistort_fx_globals"},
+        {1620635654u, "DXBC5"},
+        {1844470712u, "HEIGHT"},
+        {1306215186u, "terrain_rsm_fx_globals"},
+        {3599928506u, "foliagesinglesided_fx"},
+        {3682661672u, "ZBuffer"},
+        {4086359119u, "g_sourceMip"},
+        {3412615063u, "RigidLODs"},
+        {1579960800u, "g_DetailFreq"},
+        {445028485u, "AScroll2_V"},
+        {825141030u, "g_FoamStart"},
+        {2482188141u, "g_noiseScale"},
+        {1460340669u, "FullscreenEffectsPass1_fx_globals"},
+        {2968443068u, "BloomIn"},
+        {2323740049u, "g_dirtLayerDensities"},
+        {3750753701u, "MaskTexture"},
+        {3830752803u, "StreakParticle"},
+        {3475344944u, "DeResDepth_Skinned"},
+        {2443456228u, "_DirectionalLightColor"},
+        {4293167206u, "WaterColor"},
+        {2713295638u, "AuraxiumCloak_Skinned_2Overlay"},
+        {2179212403u, "FogEnable"},
+        {245490417u, "GBuffer3"},
+        {925741700u, "CloakDistortion_Rigid"},
+        {777097747u, "Bd"},
+        {3876534503u, "DXBCZi0a"},
+        {2704211257u, "Lava_fx_globals"},
+        {1036415153u, "g_flareColor"},
+        {303092459u, "DXBCF"},
+        {2740976818u, "SV_IsFrontFace"},
+        {2456078121u, "samplerMinMagLinearMipNoneWrap"},
+        {2693686500u, "RigidGlowWith1Texture_Tinted"},
+        {3124959525u, "coordinates"},
+        {3411966862u, "auBumpClean"},
+        {1477502770u, "Overlay3Tiling"},
+        {938175010u, "g_planarMapBrightness"},
+        {3084316451u, "g_fadeOutEnd"},
+        {525064421u, "g_noiseTiling"},
+        {1373295222u, "DXBCI"},
+        {3600173639u, "g_distortionTexture"},
+        {2515006907u, "AuraxiumDeRes_Skinned_1Overlay"},
+        {3349309838u, "g_satelliteWorldMatrix"},
+        {1545334336u, "_VirtualView"},
+        {1591439126u, "lightDirection"},
+        {2027013714u, "g_OverlayA"},
+        {641172676u, "DeRes_RigidSkinned_4Overlay"},
+        {459115423u, "P_B"},
+        {108040855u, "HoloHottness"},
+        {3244871643u, "g_Opacity"},
+        {1320135603u, "LensHoodFalloffAngle"},
+        {2726136865u, "OverlayTiling"},
+        {436744380u, "WeatherEnabled"},
+        {3469664035u, "SubsurfaceRiver"},
+        {1896363052u, "g_skyLightProbeNormal1Texture"},
+        {2855315199u, "g_pickColor"},
+        {475775832u, "g_LODScale"},
+        {3171441235u, "format"},
+        {21321380u, "g_tiling"},
+        {2400248401u, "SkyCube"},
+        {3095844503u, "DXT5nm"},
+        {3068350741u, "DXBCcg"},
+        {189842759u, "DXBCo"},
+        {4160441115u, "g_rippleZ"},
+        {4256317818u, "g_FoamEnd"},
+        {1517197409u, "CornerFrame"},
+        {37413698u, "MiniMapWater_fx_globals"},
+    }
+}};
+
+std::string_view warpgate::semantic_name(Semantic semantic) {
+    const perfect_hash::Entry<std::string_view> *entry = semantic_name_table.find((uint32_t)semantic);
+    return entry != nullptr ? entry->value : "Unknown";
+}
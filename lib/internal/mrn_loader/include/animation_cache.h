@@ -0,0 +1,106 @@
+#pragma once
+#include <cstring>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+#include "mrn.h"
+#include "nsa_file.h"
+#include "skeleton_data.h"
+
+namespace warpgate::mrn {
+    /**
+     * Warpgate animation cache: the skeletons and dequantized animations of an MRN in a flat,
+     * little-endian file meant to be memory mapped. Tracks are stored in native glm layout
+     * so AnimationTracks views point straight into the mapping.
+     *
+     * Layout (all offsets are from the start of the file, arrays are 16 byte aligned):
+     *     Header
+     *     SkeletonRecord[skeleton_count]
+     *     AnimationRecord[animation_count]
+     *     Bone records, child indices, strings and track data
+     */
+    struct AnimationCache {
+        static constexpr uint32_t magic = 0x43414757; // "WGAC"
+        static constexpr uint32_t version = 1;
+
+        struct ArrayRef {
+            uint64_t offset, count;
+        };
+
+        struct Header {
+            uint32_t magic, version;
+            uint32_t skeleton_count, animation_count;
+            uint64_t skeletons_offset, animations_offset;
+        };
+
+        struct SkeletonRecord {
+            ArrayRef name, bones;
+            // SkeletonData::bone_count, which animation bone indices are offset against
+            uint32_t bone_count, padding[3];
+        };
+
+        struct BoneRecord {
+            ArrayRef name, children;
+            uint32_t index, parent;
+            float position[3];
+            float rotation[4]; // x, y, z, w
+            float global_transform[16];
+            uint32_t padding[3];
+        };
+
+        struct AnimationRecord {
+            ArrayRef name;
+            uint32_t valid, sample_count;
+            float sample_rate;
+            uint32_t bone_count, dynamic_sample_count, padding;
+            ArrayRef static_translation_bone_indices, static_rotation_bone_indices;
+            ArrayRef dynamic_translation_bone_indices, dynamic_rotation_bone_indices;
+            ArrayRef static_translation, dynamic_translation, root_translation;
+            ArrayRef static_rotation, dynamic_rotation, root_rotation;
+        };
+
+        AnimationCache(std::span<const uint8_t> data);
+
+        // Dequantizes every animation in the MRN and returns the serialized cache
+        static std::vector<uint8_t> build(const MRN &mrn);
+        static bool is_cache(std::span<const uint8_t> data);
+
+        uint32_t skeleton_count() const;
+        std::string_view skeleton_name(uint32_t index) const;
+        uint32_t skeleton_bone_count(uint32_t index) const;
+        std::shared_ptr<Skeleton> skeleton(uint32_t index) const;
+
+        uint32_t animation_count() const;
+        std::string_view animation_name(uint32_t index) const;
+        // Throws std::runtime_error if the MRN entry at `index` was not an animation
+        AnimationTracks animation(uint32_t index) const;
+
+    private:
+        std::span<const uint8_t> buf_;
+        Header m_header;
+
+        template <typename T>
+        T get(uint64_t offset) const {
+            if (offset + sizeof(T) > buf_.size()) throw std::out_of_range("AnimationCache: Offset out of range");
+            T t;
+            memcpy(&t, buf_.data() + offset, sizeof(t));
+            return t;
+        }
+
+        template <typename T>
+        std::span<const T> array(ArrayRef ref) const {
+            if (ref.count == 0) return {};
+            if (ref.offset % alignof(T) != 0 || ref.offset + ref.count * sizeof(T) > buf_.size()) {
+                throw std::out_of_range("AnimationCache: Array out of range");
+            }
+            return std::span<const T>((const T*)(buf_.data() + ref.offset), ref.count);
+        }
+
+        std::string_view string(ArrayRef ref) const;
+        SkeletonRecord skeleton_record(uint32_t index) const;
+        AnimationRecord animation_record(uint32_t index) const;
+    };
+}
@@ -2,12 +2,19 @@
 #include <cstring>
 #include <stdexcept>
 #include <memory>
+#include <mutex>
 #include <span>
 #include <vector>
 
 #include "packet.h"
 
 namespace warpgate::mrn {
+    struct PacketIndexEntry {
+        uint64_t offset;
+        uint32_t size;
+        PacketType type;
+    };
+
     struct MRN {
         mutable std::span<uint8_t> buf_;
 
@@ -33,9 +40,12 @@ namespace warpgate::mrn {
         }
 
         std::string name() const;
+        size_t packet_count() const;
+        PacketType packet_type(size_t index) const;
+        std::shared_ptr<Packet> packet(size_t index) const;
         std::vector<std::shared_ptr<Packet>> packets() const;
         std::shared_ptr<Packet> operator[](size_t index) const {
-            return m_packets[index];
+            return packet(index);
         }
 
         std::shared_ptr<SkeletonNamesPacket> skeleton_names() const;
@@ -43,7 +53,15 @@ namespace warpgate::mrn {
         std::vector<uint32_t> skeleton_indices() const;
 
     private:
-        std::vector<std::shared_ptr<Packet>> m_packets;
+        // Packets are only parsed the first time they are accessed, each under its own flag
+        // so threads reading different packets never wait on each other
+        struct PacketSlot {
+            std::once_flag parsed;
+            std::shared_ptr<Packet> packet;
+        };
+
+        std::vector<PacketIndexEntry> m_index;
+        std::shared_ptr<PacketSlot[]> m_packets;
         std::string m_name;
         uint32_t m_skeleton_names_index, m_filenames_index;
         std::vector<uint32_t> m_skeleton_indices;
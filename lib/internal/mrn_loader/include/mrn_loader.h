@@ -1,5 +1,6 @@
 #pragma once
 #include "mrn.h"
+#include "animation_cache.h"
 #include "file_data.h"
 #include "nsa_file.h"
 #include "packet_types.h"
@@ -142,6 +142,32 @@ namespace warpgate::mrn {
 
     };
 
+    /**
+     * Non-owning view of an animation's dequantized tracks, either from an NSAFile or from an
+     * AnimationCache. Dynamic tracks are bone-major, `dynamic_sample_count` samples per bone.
+     */
+    struct AnimationTracks {
+        float sample_rate = 0;
+        // Length of the animation in samples, used for the shared sample times
+        uint32_t sample_count = 1;
+        uint32_t bone_count = 0;
+        uint32_t dynamic_sample_count = 0;
+
+        std::span<const uint16_t> static_translation_bone_indices, static_rotation_bone_indices;
+        std::span<const uint16_t> dynamic_translation_bone_indices, dynamic_rotation_bone_indices;
+
+        std::span<const glm::vec3> static_translation, dynamic_translation, root_translation;
+        std::span<const glm::quat> static_rotation, dynamic_rotation, root_rotation;
+
+        std::span<const glm::vec3> dynamic_translation_track(uint32_t bone) const {
+            return dynamic_translation.subspan((size_t)bone * dynamic_sample_count, dynamic_sample_count);
+        }
+
+        std::span<const glm::quat> dynamic_rotation_track(uint32_t bone) const {
+            return dynamic_rotation.subspan((size_t)bone * dynamic_sample_count, dynamic_sample_count);
+        }
+    };
+
     struct NSAFile {
         mutable std::span<uint8_t> buf_;
 
@@ -196,15 +222,22 @@ namespace warpgate::mrn {
         std::shared_ptr<NSARootSegment> root_segment() const;
 
         void dequantize();
-
-        std::vector<glm::vec3> static_translation() const;
-        std::vector<glm::quat> static_rotation() const;
-
-        std::vector<std::vector<glm::vec3>> dynamic_translation() const;
-        std::vector<std::vector<glm::quat>> dynamic_rotation() const;
-
-        std::vector<glm::vec3> root_translation() const;
-        std::vector<glm::quat> root_rotation() const;
+        // Views of the dequantized tracks, only valid after dequantize()
+        AnimationTracks tracks() const;
+
+        std::span<const glm::vec3> static_translation() const;
+        std::span<const glm::quat> static_rotation() const;
+
+        // Dynamic tracks are stored bone-major: all samples of the first dynamic bone,
+        // then all samples of the second, and so on.
+        uint32_t dynamic_sample_count() const;
+        std::span<const glm::vec3> dynamic_translation() const;
+        std::span<const glm::vec3> dynamic_translation(uint32_t bone) const;
+        std::span<const glm::quat> dynamic_rotation() const;
+        std::span<const glm::quat> dynamic_rotation(uint32_t bone) const;
+
+        std::span<const glm::vec3> root_translation() const;
+        std::span<const glm::quat> root_rotation() const;
     
     private:
         std::shared_ptr<NSAStaticSegment> m_static_segment;
@@ -213,8 +246,9 @@ namespace warpgate::mrn {
 
         std::vector<glm::vec3> m_static_translation;
         std::vector<glm::quat> m_static_rotation;
-        std::vector<std::vector<glm::vec3>> m_dynamic_translation;
-        std::vector<std::vector<glm::quat>> m_dynamic_rotation;
+        uint32_t m_dynamic_sample_count = 0;
+        std::vector<glm::vec3> m_dynamic_translation;
+        std::vector<glm::quat> m_dynamic_rotation;
         std::vector<glm::vec3> m_root_translation;
         std::vector<glm::quat> m_root_rotation;
 
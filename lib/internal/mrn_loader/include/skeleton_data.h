@@ -64,6 +64,8 @@ namespace warpgate::mrn {
 
     struct Skeleton {
         Skeleton(std::shared_ptr<StringTable> bone_names, std::span<BoneHierarchyEntry> chains, std::shared_ptr<OrientationData> orientations);
+        // Bones that already have their hierarchy and global transforms filled in
+        Skeleton(std::vector<Bone> bones);
         std::vector<Bone> bones;
 
         void log_recursive();
@@ -21,4 +21,10 @@ namespace warpgate::mrn {
     glm::vec3 unpack_translation(uint32_t bit_packed_value, DequantizationFactors factors);
     glm::quat unpack_rotation(glm::u16vec3 quantized, DequantizationFactors factors);
     glm::quat unpack_initial_rotation(glm::u8vec3 quantized);
+
+    // Batch versions of the above, dequantizing a whole track that shares one set of factors.
+    // `offset` is added to each translation and `initial` is multiplied by each rotation.
+    void unpack_translations(std::span<const glm::u16vec3> quantized, DequantizationFactors factors, std::span<glm::vec3> out);
+    void unpack_translations(std::span<const uint32_t> bit_packed_values, DequantizationFactors factors, glm::vec3 offset, std::span<glm::vec3> out);
+    void unpack_rotations(std::span<const glm::u16vec3> quantized, DequantizationFactors factors, glm::quat initial, std::span<glm::quat> out);
 }
\ No newline at end of file
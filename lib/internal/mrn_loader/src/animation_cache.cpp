@@ -0,0 +1,214 @@
+#include "animation_cache.h"
+#include "packet_types.h"
+
+#include <algorithm>
+#include <glm/gtc/type_ptr.hpp>
+#include <spdlog/spdlog.h>
+
+using namespace warpgate::mrn;
+
+namespace {
+    // Appends 16 byte aligned sections to the cache, patching earlier records in place
+    struct CacheWriter {
+        std::vector<uint8_t> data;
+
+        uint64_t reserve(size_t size) {
+            data.resize((data.size() + 15) & ~(size_t)15);
+            uint64_t offset = data.size();
+            data.resize(offset + size);
+            return offset;
+        }
+
+        template <typename T>
+        AnimationCache::ArrayRef append(std::span<const T> values) {
+            if(values.size() == 0) {
+                return {0, 0};
+            }
+            uint64_t offset = reserve(values.size_bytes());
+            memcpy(data.data() + offset, values.data(), values.size_bytes());
+            return {offset, values.size()};
+        }
+
+        AnimationCache::ArrayRef append(const std::string &value) {
+            return append(std::span<const char>(value.data(), value.size()));
+        }
+
+        template <typename T>
+        void write(uint64_t offset, const T &value) {
+            memcpy(data.data() + offset, &value, sizeof(T));
+        }
+    };
+}
+
+std::vector<uint8_t> AnimationCache::build(const MRN &mrn) {
+    CacheWriter writer;
+    std::vector<std::string> skeleton_names = mrn.skeleton_names()->skeleton_names()->strings();
+    std::vector<uint32_t> skeleton_indices = mrn.skeleton_indices();
+    std::vector<std::string> animation_names = mrn.file_names()->files()->animation_names()->strings();
+
+    Header header = {};
+    header.magic = magic;
+    header.version = version;
+    header.skeleton_count = (uint32_t)std::min(skeleton_names.size(), skeleton_indices.size());
+    header.animation_count = (uint32_t)animation_names.size();
+    uint64_t header_offset = writer.reserve(sizeof(Header));
+    header.skeletons_offset = writer.reserve(sizeof(SkeletonRecord) * header.skeleton_count);
+    header.animations_offset = writer.reserve(sizeof(AnimationRecord) * header.animation_count);
+    writer.write(header_offset, header);
+
+    for(uint32_t i = 0; i < header.skeleton_count; i++) {
+        std::shared_ptr<SkeletonData> skeleton_data = std::static_pointer_cast<SkeletonPacket>(mrn[skeleton_indices[i]])->skeleton_data();
+        std::shared_ptr<Skeleton> skeleton = skeleton_data->skeleton();
+        SkeletonRecord record = {};
+        record.name = writer.append(skeleton_names[i]);
+        record.bone_count = skeleton_data->bone_count();
+        record.bones.count = skeleton->bones.size();
+        record.bones.offset = writer.reserve(sizeof(BoneRecord) * skeleton->bones.size());
+        for(uint32_t j = 0; j < skeleton->bones.size(); j++) {
+            const Bone &bone = skeleton->bones[j];
+            BoneRecord bone_record = {};
+            bone_record.name = writer.append(bone.name);
+            bone_record.children = writer.append(std::span<const uint32_t>(bone.children));
+            bone_record.index = bone.index;
+            bone_record.parent = bone.parent;
+            memcpy(bone_record.position, glm::value_ptr(bone.position), sizeof(bone_record.position));
+            bone_record.rotation[0] = bone.rotation.x;
+            bone_record.rotation[1] = bone.rotation.y;
+            bone_record.rotation[2] = bone.rotation.z;
+            bone_record.rotation[3] = bone.rotation.w;
+            memcpy(bone_record.global_transform, glm::value_ptr(bone.global_transform), sizeof(bone_record.global_transform));
+            writer.write(record.bones.offset + sizeof(BoneRecord) * j, bone_record);
+        }
+        writer.write(header.skeletons_offset + sizeof(SkeletonRecord) * i, record);
+    }
+
+    for(uint32_t i = 0; i < header.animation_count; i++) {
+        AnimationRecord record = {};
+        record.name = writer.append(animation_names[i]);
+        if(i < mrn.packet_count() && mrn.packet_type(i) == PacketType::NSAData) {
+            std::shared_ptr<NSAFile> animation = std::static_pointer_cast<NSAFilePacket>(mrn[i])->animation();
+            animation->dequantize();
+            AnimationTracks tracks = animation->tracks();
+            record.valid = 1;
+            record.sample_count = tracks.sample_count;
+            record.sample_rate = tracks.sample_rate;
+            record.bone_count = tracks.bone_count;
+            record.dynamic_sample_count = tracks.dynamic_sample_count;
+            record.static_translation_bone_indices = writer.append(tracks.static_translation_bone_indices);
+            record.static_rotation_bone_indices = writer.append(tracks.static_rotation_bone_indices);
+            record.dynamic_translation_bone_indices = writer.append(tracks.dynamic_translation_bone_indices);
+            record.dynamic_rotation_bone_indices = writer.append(tracks.dynamic_rotation_bone_indices);
+            record.static_translation = writer.append(tracks.static_translation);
+            record.dynamic_translation = writer.append(tracks.dynamic_translation);
+            record.root_translation = writer.append(tracks.root_translation);
+            record.static_rotation = writer.append(tracks.static_rotation);
+            record.dynamic_rotation = writer.append(tracks.dynamic_rotation);
+            record.root_rotation = writer.append(tracks.root_rotation);
+        } else {
+            spdlog::warn("AnimationCache: '{}' is not an animation, storing its name only", animation_names[i]);
+        }
+        writer.write(header.animations_offset + sizeof(AnimationRecord) * i, record);
+    }
+
+    return writer.data;
+}
+
+bool AnimationCache::is_cache(std::span<const uint8_t> data) {
+    uint32_t file_magic;
+    if(data.size() < sizeof(Header)) {
+        return false;
+    }
+    memcpy(&file_magic, data.data(), sizeof(file_magic));
+    return file_magic == magic;
+}
+
+AnimationCache::AnimationCache(std::span<const uint8_t> data) : buf_(data) {
+    m_header = get<Header>(0);
+    if(m_header.magic != magic) {
+        throw std::runtime_error("AnimationCache: Not an animation cache");
+    }
+    if(m_header.version != version) {
+        throw std::runtime_error("AnimationCache: Unsupported version " + std::to_string(m_header.version));
+    }
+}
+
+std::string_view AnimationCache::string(ArrayRef ref) const {
+    std::span<const char> chars = array<char>(ref);
+    return std::string_view(chars.data(), chars.size());
+}
+
+AnimationCache::SkeletonRecord AnimationCache::skeleton_record(uint32_t index) const {
+    if(index >= m_header.skeleton_count) {
+        throw std::out_of_range("AnimationCache: Skeleton index out of range");
+    }
+    return get<SkeletonRecord>(m_header.skeletons_offset + sizeof(SkeletonRecord) * index);
+}
+
+AnimationCache::AnimationRecord AnimationCache::animation_record(uint32_t index) const {
+    if(index >= m_header.animation_count) {
+        throw std::out_of_range("AnimationCache: Animation index out of range");
+    }
+    return get<AnimationRecord>(m_header.animations_offset + sizeof(AnimationRecord) * index);
+}
+
+uint32_t AnimationCache::skeleton_count() const {
+    return m_header.skeleton_count;
+}
+
+std::string_view AnimationCache::skeleton_name(uint32_t index) const {
+    return string(skeleton_record(index).name);
+}
+
+uint32_t AnimationCache::skeleton_bone_count(uint32_t index) const {
+    return skeleton_record(index).bone_count;
+}
+
+std::shared_ptr<Skeleton> AnimationCache::skeleton(uint32_t index) const {
+    std::span<const BoneRecord> records = array<BoneRecord>(skeleton_record(index).bones);
+    std::vector<Bone> bones;
+    bones.reserve(records.size());
+    for(const BoneRecord &record : records) {
+        std::span<const uint32_t> children = array<uint32_t>(record.children);
+        Bone bone;
+        bone.name = string(record.name);
+        bone.index = record.index;
+        bone.parent = record.parent;
+        bone.position = glm::make_vec3(record.position);
+        bone.rotation = glm::quat(record.rotation[3], record.rotation[0], record.rotation[1], record.rotation[2]);
+        bone.children = {children.begin(), children.end()};
+        bone.global_transform = glm::make_mat4(record.global_transform);
+        bones.push_back(std::move(bone));
+    }
+    return std::make_shared<Skeleton>(std::move(bones));
+}
+
+uint32_t AnimationCache::animation_count() const {
+    return m_header.animation_count;
+}
+
+std::string_view AnimationCache::animation_name(uint32_t index) const {
+    return string(animation_record(index).name);
+}
+
+AnimationTracks AnimationCache::animation(uint32_t index) const {
+    AnimationRecord record = animation_record(index);
+    if(!record.valid) {
+        throw std::runtime_error("AnimationCache: '" + std::string(string(record.name)) + "' is not an animation");
+    }
+    AnimationTracks tracks;
+    tracks.sample_rate = record.sample_rate;
+    tracks.sample_count = record.sample_count;
+    tracks.bone_count = record.bone_count;
+    tracks.dynamic_sample_count = record.dynamic_sample_count;
+    tracks.static_translation_bone_indices = array<uint16_t>(record.static_translation_bone_indices);
+    tracks.static_rotation_bone_indices = array<uint16_t>(record.static_rotation_bone_indices);
+    tracks.dynamic_translation_bone_indices = array<uint16_t>(record.dynamic_translation_bone_indices);
+    tracks.dynamic_rotation_bone_indices = array<uint16_t>(record.dynamic_rotation_bone_indices);
+    tracks.static_translation = array<glm::vec3>(record.static_translation);
+    tracks.dynamic_translation = array<glm::vec3>(record.dynamic_translation);
+    tracks.root_translation = array<glm::vec3>(record.root_translation);
+    tracks.static_rotation = array<glm::quat>(record.static_rotation);
+    tracks.dynamic_rotation = array<glm::quat>(record.dynamic_rotation);
+    tracks.root_rotation = array<glm::quat>(record.root_rotation);
+    return tracks;
+}
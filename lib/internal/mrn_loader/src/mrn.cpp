@@ -11,70 +11,85 @@ MRN::MRN(std::span<uint8_t> subspan, std::string name): buf_(subspan), m_name(na
     size_t offset = 0;
     spdlog::info("Loading MRN {}...", m_name);
     while(offset < buf_.size()) {
-        std::shared_ptr<Packet> packet = std::make_shared<Packet>(buf_.subspan(offset));
-        std::shared_ptr<SkeletonPacket> skeleton;
-        std::shared_ptr<SkeletonNamesPacket> skeleton_names;
-        std::shared_ptr<FilenamesPacket> filenames;
-        std::shared_ptr<NSAFilePacket> nsa_file;
-        std::vector<std::string> strings;
-        switch(packet->header()->type()) {
+        Header header(buf_.subspan(offset));
+        PacketIndexEntry entry = {offset, (uint32_t)(header.size() + header.data_length()), header.type()};
+        switch(entry.type) {
         case PacketType::Skeleton:
-            m_skeleton_indices.push_back(m_packets.size());
-            skeleton = std::make_shared<SkeletonPacket>(packet);
-            spdlog::debug("Found skeleton with name '{}'", skeleton->skeleton_data()->bone_names()->strings()[1]);
-            packet = skeleton;
+            m_skeleton_indices.push_back((uint32_t)m_index.size());
             break;
         case PacketType::FileNames:
-            m_filenames_index = m_packets.size();
-            filenames = std::make_shared<FilenamesPacket>(packet);
-            strings = filenames->files()->filenames()->strings();
-            spdlog::debug("NSA Files in this MRN:");
-            for(auto it = strings.begin(); it != strings.end(); it++) {
-                spdlog::debug("    {}", *it);
-            }
-            packet = filenames;
+            m_filenames_index = (uint32_t)m_index.size();
             break;
         case PacketType::SkeletonNames:
-            m_skeleton_names_index = m_packets.size();
-            skeleton_names = std::make_shared<SkeletonNamesPacket>(packet);
-            spdlog::debug("Skeletons in this MRN:");
-            strings = skeleton_names->skeleton_names()->strings();
-            for(auto it = strings.begin(); it != strings.end(); it++) {
-                spdlog::debug("    {}", *it);
-            }
-            packet = skeleton_names;
-            break;
-        case PacketType::NSAData:
-            nsa_file = std::make_shared<NSAFilePacket>(packet);
-            packet = nsa_file;
+            m_skeleton_names_index = (uint32_t)m_index.size();
             break;
         default:
             // Do nothing
             break;
         }
-        offset += packet->size();
+        m_index.push_back(entry);
+        offset += entry.size;
         if(offset % PACKET_ALIGNMENT != 0) {
             offset += PACKET_ALIGNMENT - offset % PACKET_ALIGNMENT;
         }
-        m_packets.push_back(packet);
     }
-    spdlog::info("Loaded {} packets from MRN {}", m_packets.size(), m_name);
+    m_packets = std::shared_ptr<PacketSlot[]>(new PacketSlot[m_index.size()]);
+    spdlog::info("Indexed {} packets from MRN {}", m_index.size(), m_name);
 }
 
 std::string MRN::name() const {
     return m_name;
 }
 
+size_t MRN::packet_count() const {
+    return m_index.size();
+}
+
+PacketType MRN::packet_type(size_t index) const {
+    return m_index.at(index).type;
+}
+
+std::shared_ptr<Packet> MRN::packet(size_t index) const {
+    PacketIndexEntry entry = m_index.at(index);
+    PacketSlot &slot = m_packets[index];
+    std::call_once(slot.parsed, [&]() {
+        std::span<uint8_t> packet_data = buf_.subspan(entry.offset, entry.size);
+        switch(entry.type) {
+        case PacketType::Skeleton:
+            slot.packet = std::make_shared<SkeletonPacket>(packet_data);
+            break;
+        case PacketType::FileNames:
+            slot.packet = std::make_shared<FilenamesPacket>(packet_data);
+            break;
+        case PacketType::SkeletonNames:
+            slot.packet = std::make_shared<SkeletonNamesPacket>(packet_data);
+            break;
+        case PacketType::NSAData:
+            slot.packet = std::make_shared<NSAFilePacket>(packet_data);
+            break;
+        default:
+            slot.packet = std::make_shared<Packet>(packet_data);
+            break;
+        }
+    });
+    return slot.packet;
+}
+
 std::vector<std::shared_ptr<Packet>> MRN::packets() const {
-    return m_packets;
+    std::vector<std::shared_ptr<Packet>> packets;
+    packets.reserve(m_index.size());
+    for(size_t i = 0; i < m_index.size(); i++) {
+        packets.push_back(packet(i));
+    }
+    return packets;
 }
 
 std::shared_ptr<SkeletonNamesPacket> MRN::skeleton_names() const {
-    return std::static_pointer_cast<SkeletonNamesPacket>(m_packets[m_skeleton_names_index]);
+    return std::static_pointer_cast<SkeletonNamesPacket>(packet(m_skeleton_names_index));
 }
 
 std::shared_ptr<FilenamesPacket> MRN::file_names() const {
-    return std::static_pointer_cast<FilenamesPacket>(m_packets[m_filenames_index]);
+    return std::static_pointer_cast<FilenamesPacket>(packet(m_filenames_index));
 }
 
 std::vector<uint32_t> MRN::skeleton_indices() const {
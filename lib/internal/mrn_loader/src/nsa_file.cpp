@@ -193,123 +193,171 @@ void NSAFile::dequantize() {
     dequantize_root_segment();
 }
 
-std::vector<glm::vec3> NSAFile::static_translation() const {
+AnimationTracks NSAFile::tracks() const {
+    AnimationTracks tracks;
+    tracks.sample_rate = sample_rate();
+    if(m_root_segment != nullptr) {
+        tracks.sample_count = m_root_segment->sample_count();
+    } else if(m_dynamic_segment != nullptr) {
+        tracks.sample_count = m_dynamic_segment->sample_count();
+    } else {
+        // Leave samples at 1 I guess
+        spdlog::warn("Neither dynamic nor root segments found, guessing sample count of 1");
+    }
+    tracks.bone_count = bone_count();
+    tracks.dynamic_sample_count = m_dynamic_sample_count;
+
+    // Bone index tables are only looked up for tracks that exist, their pointers are unset otherwise
+    if(m_static_translation.size() != 0) {
+        tracks.static_translation = m_static_translation;
+        tracks.static_translation_bone_indices = static_translation_bone_indices();
+    }
+    if(m_static_rotation.size() != 0) {
+        tracks.static_rotation = m_static_rotation;
+        tracks.static_rotation_bone_indices = static_rotation_bone_indices();
+    }
+    if(m_dynamic_translation.size() != 0) {
+        tracks.dynamic_translation = m_dynamic_translation;
+        tracks.dynamic_translation_bone_indices = dynamic_translation_bone_indices();
+    }
+    if(m_dynamic_rotation.size() != 0) {
+        tracks.dynamic_rotation = m_dynamic_rotation;
+        tracks.dynamic_rotation_bone_indices = dynamic_rotation_bone_indices();
+    }
+    tracks.root_translation = m_root_translation;
+    tracks.root_rotation = m_root_rotation;
+    return tracks;
+}
+
+std::span<const glm::vec3> NSAFile::static_translation() const {
     return m_static_translation;
 }
 
-std::vector<glm::quat> NSAFile::static_rotation() const {
+std::span<const glm::quat> NSAFile::static_rotation() const {
     return m_static_rotation;
 }
 
-std::vector<std::vector<glm::vec3>> NSAFile::dynamic_translation() const {
+uint32_t NSAFile::dynamic_sample_count() const {
+    return m_dynamic_sample_count;
+}
+
+std::span<const glm::vec3> NSAFile::dynamic_translation() const {
     return m_dynamic_translation;
 }
 
-std::vector<std::vector<glm::quat>> NSAFile::dynamic_rotation() const {
+std::span<const glm::vec3> NSAFile::dynamic_translation(uint32_t bone) const {
+    return std::span<const glm::vec3>(m_dynamic_translation).subspan((size_t)bone * m_dynamic_sample_count, m_dynamic_sample_count);
+}
+
+std::span<const glm::quat> NSAFile::dynamic_rotation() const {
     return m_dynamic_rotation;
 }
 
-std::vector<glm::vec3> NSAFile::root_translation() const {
+std::span<const glm::quat> NSAFile::dynamic_rotation(uint32_t bone) const {
+    return std::span<const glm::quat>(m_dynamic_rotation).subspan((size_t)bone * m_dynamic_sample_count, m_dynamic_sample_count);
+}
+
+std::span<const glm::vec3> NSAFile::root_translation() const {
     return m_root_translation;
 }
 
-std::vector<glm::quat> NSAFile::root_rotation() const {
+std::span<const glm::quat> NSAFile::root_rotation() const {
     return m_root_rotation;
 }
 
 void NSAFile::dequantize_static_segment() {
+    m_static_translation.clear();
+    m_static_rotation.clear();
     if(m_static_segment == nullptr) {
         return;
     }
     std::span<glm::u16vec3> quantized_data = m_static_segment->translation_data();
-    DequantizationFactors factors = m_static_segment->translation_factors();
-    for(uint32_t i = 0; i < m_static_segment->translation_bone_count(); i++) {
-        glm::vec3 dequantized = unpack_translation(quantized_data[i], factors);
-        m_static_translation.push_back(dequantized);
-    }
+    m_static_translation.resize(std::min<size_t>(m_static_segment->translation_bone_count(), quantized_data.size()));
+    unpack_translations(quantized_data, m_static_segment->translation_factors(), m_static_translation);
 
     quantized_data = m_static_segment->rotation_data();
-    factors = m_static_segment->rotation_factors();
-    for(uint32_t i = 0; i < m_static_segment->rotation_bone_count(); i++) {
-        glm::quat dequantized = unpack_rotation(quantized_data[i], factors);
-        m_static_rotation.push_back(dequantized);
-    }
+    m_static_rotation.resize(std::min<size_t>(m_static_segment->rotation_bone_count(), quantized_data.size()));
+    unpack_rotations(quantized_data, m_static_segment->rotation_factors(), glm::quat(1, 0, 0, 0), m_static_rotation);
 }
 
 void NSAFile::dequantize_dynamic_segment() {
+    m_dynamic_sample_count = 0;
+    m_dynamic_translation.clear();
+    m_dynamic_rotation.clear();
     if(m_dynamic_segment == nullptr) {
         return;
     }
+    uint32_t sample_count = m_dynamic_segment->sample_count();
+    uint32_t translation_bone_count = m_dynamic_segment->translation_bone_count();
+    uint32_t rotation_bone_count = m_dynamic_segment->rotation_bone_count();
+    m_dynamic_sample_count = sample_count;
+
     std::vector<std::span<uint32_t>> bitpacked_data = m_dynamic_segment->translation_data();
     std::span<DequantizationInfo> dequantization_info = m_dynamic_segment->translation_dequantization_info();
     std::span<DequantizationFactors> dynamic_factors = this->translation_factors();
     DequantizationFactors init_factors = this->initial_translation_factors(), factors = {};
-    for(uint32_t sample_index = 0; sample_index < m_dynamic_segment->sample_count() && m_dynamic_segment->translation_bone_count() > 0; sample_index++) {
-        std::vector<glm::vec3> sample;
-        for(uint32_t bone = 0; bone < m_dynamic_segment->translation_bone_count(); bone++) {
-            for(uint32_t i = 0; i < 3; i++){
-                factors.a_min[i] = dynamic_factors[dequantization_info[bone].a_factor_index[i]].a_min[i];
-                factors.a_scaled_extent[i] = dynamic_factors[dequantization_info[bone].a_factor_index[i]].a_scaled_extent[i];
-            }
-            glm::vec3 dequantized = unpack_translation(bitpacked_data[sample_index][bone], factors);
-            
-            glm::u16vec3 quantized_init;
-            quantized_init.x = dequantization_info[bone].v_init.x;
-            quantized_init.y = dequantization_info[bone].v_init.y;
-            quantized_init.z = dequantization_info[bone].v_init.z;
-            glm::vec3 initial_pos = unpack_translation(quantized_init, init_factors);
-
-            sample.push_back(dequantized + initial_pos);
+    m_dynamic_translation.resize((size_t)translation_bone_count * sample_count);
+    // Samples are stored sample-major, so each bone's track is gathered into contiguous
+    // scratch space first and then dequantized in one batch
+    std::vector<uint32_t> packed_track(sample_count);
+    for(uint32_t bone = 0; bone < translation_bone_count; bone++) {
+        for(uint32_t i = 0; i < 3; i++){
+            factors.a_min[i] = dynamic_factors[dequantization_info[bone].a_factor_index[i]].a_min[i];
+            factors.a_scaled_extent[i] = dynamic_factors[dequantization_info[bone].a_factor_index[i]].a_scaled_extent[i];
         }
-        if(sample.size() == 0) {
-            continue;
+
+        glm::u16vec3 quantized_init;
+        quantized_init.x = dequantization_info[bone].v_init.x;
+        quantized_init.y = dequantization_info[bone].v_init.y;
+        quantized_init.z = dequantization_info[bone].v_init.z;
+        glm::vec3 initial_pos = unpack_translation(quantized_init, init_factors);
+
+        for(uint32_t sample_index = 0; sample_index < sample_count; sample_index++) {
+            packed_track[sample_index] = bitpacked_data[sample_index][bone];
         }
-        m_dynamic_translation.push_back(sample);
+        unpack_translations(
+            packed_track, factors, initial_pos,
+            std::span<glm::vec3>(m_dynamic_translation).subspan((size_t)bone * sample_count, sample_count)
+        );
     }
 
     std::vector<std::span<glm::u16vec3>> rotation_data = m_dynamic_segment->rotation_data();
     dequantization_info = m_dynamic_segment->rotation_dequantization_info();
     dynamic_factors = this->rotation_factors();
-
-    std::vector<glm::quat> initial_rotations;
-    for(uint32_t bone = 0; bone < m_dynamic_segment->rotation_bone_count(); bone++) {
-        initial_rotations.push_back(unpack_initial_rotation(dequantization_info[bone].v_init));
-    }
-
-    for(uint32_t sample_index = 0; sample_index < m_dynamic_segment->sample_count() && m_dynamic_segment->rotation_bone_count() > 0; sample_index++) {
-        std::vector<glm::quat> sample;
-        for(uint32_t bone = 0; bone < m_dynamic_segment->rotation_bone_count(); bone++) {
-            for(uint32_t i = 0; i < 3; i++){
-                factors.a_min[i] = dynamic_factors[dequantization_info[bone].a_factor_index[i]].a_min[i];
-                factors.a_scaled_extent[i] = dynamic_factors[dequantization_info[bone].a_factor_index[i]].a_scaled_extent[i];
-            }
-            glm::quat dequantized = unpack_rotation(rotation_data[sample_index][bone], factors);
-
-            sample.push_back(initial_rotations[bone] * dequantized);
+    m_dynamic_rotation.resize((size_t)rotation_bone_count * sample_count);
+    std::vector<glm::u16vec3> quantized_track(sample_count);
+    for(uint32_t bone = 0; bone < rotation_bone_count; bone++) {
+        for(uint32_t i = 0; i < 3; i++){
+            factors.a_min[i] = dynamic_factors[dequantization_info[bone].a_factor_index[i]].a_min[i];
+            factors.a_scaled_extent[i] = dynamic_factors[dequantization_info[bone].a_factor_index[i]].a_scaled_extent[i];
         }
-        if(sample.size() == 0) {
-            continue;
+        glm::quat initial_rotation = unpack_initial_rotation(dequantization_info[bone].v_init);
+
+        for(uint32_t sample_index = 0; sample_index < sample_count; sample_index++) {
+            quantized_track[sample_index] = rotation_data[sample_index][bone];
         }
-        m_dynamic_rotation.push_back(sample);
+        unpack_rotations(
+            quantized_track, factors, initial_rotation,
+            std::span<glm::quat>(m_dynamic_rotation).subspan((size_t)bone * sample_count, sample_count)
+        );
     }
 }
 
 void NSAFile::dequantize_root_segment() {
+    m_root_translation.clear();
+    m_root_rotation.clear();
     if(m_root_segment == nullptr) {
         return;
     }
     std::span<uint32_t> bitpacked_data = m_root_segment->translation_data();
     std::span<glm::u16vec3> rotation_data = m_root_segment->rotation_data();
-    DequantizationFactors translation_factors = m_root_segment->translation_factors();
-    std::optional<DequantizationFactors> rotation_factors = m_root_segment->rotation_factors();
-    for(uint32_t sample_index = 0; sample_index < m_root_segment->sample_count(); sample_index++) {
-        if(sample_index < bitpacked_data.size()) {
-            m_root_translation.push_back(unpack_translation(bitpacked_data[sample_index], translation_factors));
-        }
+    uint32_t sample_count = m_root_segment->sample_count();
+    m_root_translation.resize(std::min<size_t>(sample_count, bitpacked_data.size()));
+    unpack_translations(bitpacked_data, m_root_segment->translation_factors(), glm::vec3(0), m_root_translation);
 
-        if(sample_index < rotation_data.size()) {
-            m_root_rotation.push_back(unpack_rotation(rotation_data[sample_index], *rotation_factors));
-        }
+    if(rotation_data.size() > 0) {
+        m_root_rotation.resize(std::min<size_t>(sample_count, rotation_data.size()));
+        unpack_rotations(rotation_data, *m_root_segment->rotation_factors(), glm::quat(1, 0, 0, 0), m_root_rotation);
     }
 }
 
@@ -156,6 +156,8 @@ Skeleton::Skeleton(
     calculate_transforms(0);
 }
 
+Skeleton::Skeleton(std::vector<Bone> bones) : bones(std::move(bones)) {}
+
 void Skeleton::calculate_transforms(uint32_t root_index) {
     for(auto child_index_it = bones[root_index].children.begin(); child_index_it != bones[root_index].children.end(); child_index_it++) {
         glm::mat4 local_translation = glm::translate(glm::identity<glm::mat4>(), bones[*child_index_it].position);
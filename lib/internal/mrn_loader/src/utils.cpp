@@ -1,5 +1,10 @@
 #include "utils.h"
 
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define WARPGATE_MRN_SSE2
+#endif
+
 using namespace warpgate::mrn;
 
 glm::vec3 warpgate::mrn::unpack_translation(glm::u16vec3 quantized, DequantizationFactors factors) {
@@ -34,4 +39,96 @@ glm::quat warpgate::mrn::unpack_initial_rotation(glm::u8vec3 quantized) {
     factors.v_min = {-1, -1, -1};
     factors.v_scaled_extent = {1 / 128.0f, 1 / 128.0f, 1 / 128.0f};
     return unpack_rotation({quantized.x, quantized.y, quantized.z}, factors);
+}
+
+#ifdef WARPGATE_MRN_SSE2
+// Dequantizes 4 values at once, given the quantized components as 32 bit integer lanes
+static inline void dequantize4(__m128i qx, __m128i qy, __m128i qz, const DequantizationFactors &factors, __m128 &x, __m128 &y, __m128 &z) {
+    x = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(factors.v_scaled_extent.x), _mm_cvtepi32_ps(qx)), _mm_set1_ps(factors.v_min.x));
+    y = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(factors.v_scaled_extent.y), _mm_cvtepi32_ps(qy)), _mm_set1_ps(factors.v_min.y));
+    z = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(factors.v_scaled_extent.z), _mm_cvtepi32_ps(qz)), _mm_set1_ps(factors.v_min.z));
+}
+
+static inline __m128i load_u16_lanes(const glm::u16vec3 *values, int component) {
+    return _mm_set_epi32(values[3][component], values[2][component], values[1][component], values[0][component]);
+}
+#endif
+
+void warpgate::mrn::unpack_translations(std::span<const glm::u16vec3> quantized, DequantizationFactors factors, std::span<glm::vec3> out) {
+    size_t i = 0, count = std::min(quantized.size(), out.size());
+#ifdef WARPGATE_MRN_SSE2
+    alignas(16) float xs[4], ys[4], zs[4];
+    for(; i + 4 <= count; i += 4) {
+        __m128 x, y, z;
+        const glm::u16vec3 *values = quantized.data() + i;
+        dequantize4(load_u16_lanes(values, 0), load_u16_lanes(values, 1), load_u16_lanes(values, 2), factors, x, y, z);
+        _mm_store_ps(xs, x);
+        _mm_store_ps(ys, y);
+        _mm_store_ps(zs, z);
+        for(size_t j = 0; j < 4; j++) {
+            out[i + j] = {xs[j], ys[j], zs[j]};
+        }
+    }
+#endif
+    for(; i < count; i++) {
+        out[i] = unpack_translation(quantized[i], factors);
+    }
+}
+
+void warpgate::mrn::unpack_translations(std::span<const uint32_t> bit_packed_values, DequantizationFactors factors, glm::vec3 offset, std::span<glm::vec3> out) {
+    size_t i = 0, count = std::min(bit_packed_values.size(), out.size());
+#ifdef WARPGATE_MRN_SSE2
+    alignas(16) float xs[4], ys[4], zs[4];
+    for(; i + 4 <= count; i += 4) {
+        __m128i packed = _mm_loadu_si128((const __m128i*)(bit_packed_values.data() + i));
+        __m128 x, y, z;
+        dequantize4(
+            _mm_srli_epi32(packed, 21),
+            _mm_and_si128(_mm_srli_epi32(packed, 10), _mm_set1_epi32(0x7FF)),
+            _mm_and_si128(packed, _mm_set1_epi32(0x3FF)),
+            factors, x, y, z
+        );
+        _mm_store_ps(xs, _mm_add_ps(x, _mm_set1_ps(offset.x)));
+        _mm_store_ps(ys, _mm_add_ps(y, _mm_set1_ps(offset.y)));
+        _mm_store_ps(zs, _mm_add_ps(z, _mm_set1_ps(offset.z)));
+        for(size_t j = 0; j < 4; j++) {
+            out[i + j] = {xs[j], ys[j], zs[j]};
+        }
+    }
+#endif
+    for(; i < count; i++) {
+        out[i] = unpack_translation(bit_packed_values[i], factors) + offset;
+    }
+}
+
+void warpgate::mrn::unpack_rotations(std::span<const glm::u16vec3> quantized, DequantizationFactors factors, glm::quat initial, std::span<glm::quat> out) {
+    size_t i = 0, count = std::min(quantized.size(), out.size());
+#ifdef WARPGATE_MRN_SSE2
+    alignas(16) float ws[4], xs[4], ys[4], zs[4];
+    __m128 one = _mm_set1_ps(1.0f), two = _mm_set1_ps(2.0f);
+    __m128 iw = _mm_set1_ps(initial.w), ix = _mm_set1_ps(initial.x), iy = _mm_set1_ps(initial.y), iz = _mm_set1_ps(initial.z);
+    for(; i + 4 <= count; i += 4) {
+        __m128 x, y, z;
+        const glm::u16vec3 *values = quantized.data() + i;
+        dequantize4(load_u16_lanes(values, 0), load_u16_lanes(values, 1), load_u16_lanes(values, 2), factors, x, y, z);
+
+        __m128 sq_magn = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z));
+        __m128 denominator = _mm_add_ps(sq_magn, one);
+        __m128 scalar = _mm_div_ps(two, denominator);
+        __m128 qw = _mm_div_ps(_mm_sub_ps(one, sq_magn), _mm_add_ps(one, sq_magn));
+        __m128 qx = _mm_mul_ps(scalar, x), qy = _mm_mul_ps(scalar, y), qz = _mm_mul_ps(scalar, z);
+
+        // initial * q, matching glm's quaternion product
+        _mm_store_ps(ws, _mm_sub_ps(_mm_sub_ps(_mm_sub_ps(_mm_mul_ps(iw, qw), _mm_mul_ps(ix, qx)), _mm_mul_ps(iy, qy)), _mm_mul_ps(iz, qz)));
+        _mm_store_ps(xs, _mm_sub_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(iw, qx), _mm_mul_ps(ix, qw)), _mm_mul_ps(iy, qz)), _mm_mul_ps(iz, qy)));
+        _mm_store_ps(ys, _mm_sub_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(iw, qy), _mm_mul_ps(iy, qw)), _mm_mul_ps(iz, qx)), _mm_mul_ps(ix, qz)));
+        _mm_store_ps(zs, _mm_sub_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(iw, qz), _mm_mul_ps(iz, qw)), _mm_mul_ps(ix, qy)), _mm_mul_ps(iy, qx)));
+        for(size_t j = 0; j < 4; j++) {
+            out[i + j] = glm::quat(ws[j], xs[j], ys[j], zs[j]);
+        }
+    }
+#endif
+    for(; i < count; i++) {
+        out[i] = initial * unpack_rotation(quantized[i], factors);
+    }
 }
\ No newline at end of file
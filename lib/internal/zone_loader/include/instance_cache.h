@@ -0,0 +1,107 @@
+#pragma once
+#include <cstring>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+#include <glm/mat4x4.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <glm/vec3.hpp>
+
+#include "zone.h"
+
+namespace warpgate::zone {
+    /**
+     * Warpgate zone instance cache: the transforms of every runtime object instance of a zone,
+     * flattened into structure of arrays form in a little-endian file meant to be memory mapped.
+     * Rotations are converted from the zone's euler angles to quaternions, and arrays are stored
+     * in native glm layout so the accessors return views straight into the mapping.
+     *
+     * Layout (all offsets are from the start of the file, arrays are 16 byte aligned):
+     *     Header
+     *     ObjectRecord[object_count]
+     *     Positions, rotations, scales and actor ids, one entry per instance, grouped by object
+     *     Actor file names
+     */
+    struct InstanceCache {
+        static constexpr uint32_t magic = 0x435A4757; // "WGZC"
+        static constexpr uint32_t version = 2;
+
+        struct ArrayRef {
+            uint64_t offset, count;
+        };
+
+        struct Header {
+            uint32_t magic, version;
+            // The zone the cache was built from, to detect stale caches
+            uint32_t zone_version, object_count;
+            uint64_t zone_size, instance_count;
+            uint64_t zone_hash;
+            uint64_t objects_offset;
+            ArrayRef positions, rotations, scales, actor_ids;
+        };
+
+        struct ObjectRecord {
+            ArrayRef actor_file;
+            float render_distance;
+            uint32_t first_instance, instance_count, padding;
+        };
+
+        InstanceCache(std::span<const uint8_t> data);
+
+        // Flattens every instance of the zone, splitting the objects between `thread_count` threads
+        static std::vector<uint8_t> build(const Zone &zone, uint32_t thread_count = 1);
+        static bool is_cache(std::span<const uint8_t> data);
+
+        // Whether the cache was built from this zone, comparing a hash of its bytes
+        bool matches(const Zone &zone) const;
+
+        // 64 bit FNV-1a hash of the zone's bytes, as stored in the header
+        static uint64_t hash(const Zone &zone);
+
+        uint32_t object_count() const;
+        std::string_view actor_file(uint32_t object) const;
+        float render_distance(uint32_t object) const;
+        uint32_t first_instance(uint32_t object) const;
+        uint32_t instance_count(uint32_t object) const;
+
+        // Per instance arrays for the whole zone. An object's instances are the `instance_count`
+        // entries starting at its `first_instance`.
+        uint64_t instance_count() const;
+        std::span<const glm::vec3> positions() const;
+        std::span<const glm::quat> rotations() const;
+        std::span<const glm::vec3> scales() const;
+        // Index of the runtime object each instance belongs to
+        std::span<const uint32_t> actor_ids() const;
+
+        // Same as Instance::transform
+        glm::dmat4 transform(uint64_t instance) const;
+
+    private:
+        std::span<const uint8_t> buf_;
+        Header m_header;
+        std::span<const glm::vec3> m_positions, m_scales;
+        std::span<const glm::quat> m_rotations;
+        std::span<const uint32_t> m_actor_ids;
+
+        template <typename T>
+        T get(uint64_t offset) const {
+            if (offset + sizeof(T) > buf_.size()) throw std::out_of_range("InstanceCache: Offset out of range");
+            T t;
+            memcpy(&t, buf_.data() + offset, sizeof(t));
+            return t;
+        }
+
+        template <typename T>
+        std::span<const T> array(ArrayRef ref) const {
+            if (ref.count == 0) return {};
+            if (ref.offset % alignof(T) != 0 || ref.offset + ref.count * sizeof(T) > buf_.size()) {
+                throw std::out_of_range("InstanceCache: Array out of range");
+            }
+            return std::span<const T>((const T*)(buf_.data() + ref.offset), ref.count);
+        }
+
+        ObjectRecord object_record(uint32_t index) const;
+    };
+}
@@ -3,6 +3,7 @@
 #include "eco.h"
 #include "flora_info.h"
 #include "flora.h"
+#include "instance_cache.h"
 #include "instance.h"
 #include "light.h"
 #include "runtime_object.h"
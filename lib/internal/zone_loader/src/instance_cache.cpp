@@ -0,0 +1,211 @@
+#include "instance_cache.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <thread>
+
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtx/euler_angles.hpp>
+
+using namespace warpgate::zone;
+
+namespace {
+    // Appends 16 byte aligned sections to the cache, patching earlier records in place
+    struct CacheWriter {
+        std::vector<uint8_t> data;
+
+        uint64_t reserve(size_t size) {
+            data.resize((data.size() + 15) & ~(size_t)15);
+            uint64_t offset = data.size();
+            data.resize(offset + size);
+            return offset;
+        }
+
+        template <typename T>
+        InstanceCache::ArrayRef reserve_array(size_t count) {
+            if(count == 0) {
+                return {0, 0};
+            }
+            return {reserve(sizeof(T) * count), count};
+        }
+
+        InstanceCache::ArrayRef append(const std::string &value) {
+            if(value.size() == 0) {
+                return {0, 0};
+            }
+            uint64_t offset = reserve(value.size());
+            memcpy(data.data() + offset, value.data(), value.size());
+            return {offset, value.size()};
+        }
+
+        template <typename T>
+        void write(uint64_t offset, const T &value) {
+            memcpy(data.data() + offset, &value, sizeof(T));
+        }
+    };
+}
+
+std::vector<uint8_t> InstanceCache::build(const Zone &zone, uint32_t thread_count) {
+    CacheWriter writer;
+    Header header = {};
+    header.magic = magic;
+    header.version = version;
+    header.zone_version = zone.version();
+    header.zone_size = zone.size();
+    header.zone_hash = hash(zone);
+    header.object_count = zone.objects_count();
+
+    std::vector<std::shared_ptr<RuntimeObject>> objects;
+    std::vector<uint32_t> first_instances;
+    for(uint32_t i = 0; i < header.object_count; i++) {
+        objects.push_back(zone.object(i));
+        first_instances.push_back((uint32_t)header.instance_count);
+        header.instance_count += objects.back()->instance_count();
+    }
+
+    // Every section is sized up front, so the workers below write into a buffer that never moves
+    uint64_t header_offset = writer.reserve(sizeof(Header));
+    header.objects_offset = writer.reserve(sizeof(ObjectRecord) * header.object_count);
+    header.positions = writer.reserve_array<glm::vec3>(header.instance_count);
+    header.rotations = writer.reserve_array<glm::quat>(header.instance_count);
+    header.scales = writer.reserve_array<glm::vec3>(header.instance_count);
+    header.actor_ids = writer.reserve_array<uint32_t>(header.instance_count);
+    for(uint32_t i = 0; i < header.object_count; i++) {
+        ObjectRecord record = {};
+        record.actor_file = writer.append(objects[i]->actor_file());
+        record.render_distance = objects[i]->render_distance();
+        record.first_instance = first_instances[i];
+        record.instance_count = objects[i]->instance_count();
+        writer.write(header.objects_offset + sizeof(ObjectRecord) * i, record);
+    }
+    writer.write(header_offset, header);
+
+    std::atomic_uint32_t next = 0;
+    auto flatten = [&]() {
+        for(uint32_t i = next++; i < header.object_count; i = next++) {
+            uint32_t instance_count = objects[i]->instance_count();
+            for(uint32_t j = 0; j < instance_count; j++) {
+                Instance instance = objects[i]->instance(j);
+                Float4 translation = instance.translation(), rotation = instance.rotation(), scale = instance.scale();
+                uint64_t index = first_instances[i] + j;
+                glm::quat quaternion = glm::quat(glm::quat_cast(glm::eulerAngleYXZ((double)rotation.x, (double)rotation.y, (double)rotation.z)));
+                writer.write(header.positions.offset + sizeof(glm::vec3) * index, glm::vec3(translation.x, translation.y, translation.z));
+                writer.write(header.rotations.offset + sizeof(glm::quat) * index, quaternion);
+                writer.write(header.scales.offset + sizeof(glm::vec3) * index, glm::vec3(scale.x, scale.y, scale.z));
+                writer.write(header.actor_ids.offset + sizeof(uint32_t) * index, i);
+            }
+        }
+    };
+    std::vector<std::thread> workers;
+    for(uint32_t i = 1; i < std::min(thread_count, header.object_count); i++) {
+        workers.push_back(std::thread(flatten));
+    }
+    flatten();
+    for(std::thread &worker : workers) {
+        worker.join();
+    }
+
+    return writer.data;
+}
+
+bool InstanceCache::is_cache(std::span<const uint8_t> data) {
+    uint32_t file_magic;
+    if(data.size() < sizeof(Header)) {
+        return false;
+    }
+    memcpy(&file_magic, data.data(), sizeof(file_magic));
+    return file_magic == magic;
+}
+
+InstanceCache::InstanceCache(std::span<const uint8_t> data) : buf_(data) {
+    m_header = get<Header>(0);
+    if(m_header.magic != magic) {
+        throw std::runtime_error("InstanceCache: Not an instance cache");
+    }
+    if(m_header.version != version) {
+        throw std::runtime_error("InstanceCache: Unsupported version " + std::to_string(m_header.version));
+    }
+    m_positions = array<glm::vec3>(m_header.positions);
+    m_rotations = array<glm::quat>(m_header.rotations);
+    m_scales = array<glm::vec3>(m_header.scales);
+    m_actor_ids = array<uint32_t>(m_header.actor_ids);
+    if(m_positions.size() != m_header.instance_count || m_rotations.size() != m_header.instance_count
+        || m_scales.size() != m_header.instance_count || m_actor_ids.size() != m_header.instance_count) {
+        throw std::runtime_error("InstanceCache: Instance arrays do not match the instance count");
+    }
+}
+
+bool InstanceCache::matches(const Zone &zone) const {
+    return m_header.zone_version == zone.version()
+        && m_header.zone_size == zone.size()
+        && m_header.object_count == zone.objects_count()
+        && m_header.zone_hash == hash(zone);
+}
+
+uint64_t InstanceCache::hash(const Zone &zone) {
+    uint64_t hash = 0xCBF29CE484222325;
+    for(uint8_t byte : zone.buf_) {
+        hash = (hash ^ byte) * 0x100000001B3;
+    }
+    return hash;
+}
+
+InstanceCache::ObjectRecord InstanceCache::object_record(uint32_t index) const {
+    if(index >= m_header.object_count) {
+        throw std::out_of_range("InstanceCache: Object index out of range");
+    }
+    ObjectRecord record = get<ObjectRecord>(m_header.objects_offset + sizeof(ObjectRecord) * index);
+    if((uint64_t)record.first_instance + record.instance_count > m_header.instance_count) {
+        throw std::out_of_range("InstanceCache: Object instances out of range");
+    }
+    return record;
+}
+
+uint32_t InstanceCache::object_count() const {
+    return m_header.object_count;
+}
+
+std::string_view InstanceCache::actor_file(uint32_t object) const {
+    std::span<const char> chars = array<char>(object_record(object).actor_file);
+    return std::string_view(chars.data(), chars.size());
+}
+
+float InstanceCache::render_distance(uint32_t object) const {
+    return object_record(object).render_distance;
+}
+
+uint32_t InstanceCache::first_instance(uint32_t object) const {
+    return object_record(object).first_instance;
+}
+
+uint32_t InstanceCache::instance_count(uint32_t object) const {
+    return object_record(object).instance_count;
+}
+
+uint64_t InstanceCache::instance_count() const {
+    return m_header.instance_count;
+}
+
+std::span<const glm::vec3> InstanceCache::positions() const {
+    return m_positions;
+}
+
+std::span<const glm::quat> InstanceCache::rotations() const {
+    return m_rotations;
+}
+
+std::span<const glm::vec3> InstanceCache::scales() const {
+    return m_scales;
+}
+
+std::span<const uint32_t> InstanceCache::actor_ids() const {
+    return m_actor_ids;
+}
+
+glm::dmat4 InstanceCache::transform(uint64_t instance) const {
+    glm::dmat4 trs = glm::translate(glm::identity<glm::dmat4>(), glm::dvec3(m_positions[instance]));
+    trs = trs * glm::mat4_cast(glm::dquat(m_rotations[instance]));
+    trs = glm::scale(trs, glm::dvec3(m_scales[instance]));
+    return trs;
+}
@@ -0,0 +1,188 @@
+import json
+from argparse import ArgumentParser
+from pathlib import Path
+from typing import Dict, List, Tuple
+
+import jenkins
+
+
+# Must match warpgate::perfect_hash::mix in dme_loader/include/perfect_hash.h
+def mix(key: int, seed: int) -> int:
+    key ^= seed
+    key ^= key >> 16
+    key = (key * 0x85ebca6b) & 0xFFFFFFFF
+    key ^= key >> 13
+    key = (key * 0xc2b2ae35) & 0xFFFFFFFF
+    key ^= key >> 16
+    return key
+
+
+def build_table(keys: List[int]) -> Tuple[List[int], List[int]]:
+    """
+    Builds a minimal perfect hash over keys using hash-and-displace.
+    Returns the per bucket seeds and the keys in slot order.
+    """
+    assert len(keys) == len(set(keys)), "Duplicate keys in perfect hash table"
+    slot_count = len(keys)
+    bucket_count = max(1, slot_count // 4)
+    buckets: List[List[int]] = [[] for _ in range(bucket_count)]
+    for key in keys:
+        buckets[mix(key, 0) % bucket_count].append(key)
+
+    seeds = [0] * bucket_count
+    slots: List[int] = [None] * slot_count
+    for bucket_index in sorted(range(bucket_count), key=lambda index: -len(buckets[index])):
+        bucket = buckets[bucket_index]
+        if not bucket:
+            continue
+        seed = 1
+        while True:
+            positions = {mix(key, seed) % slot_count for key in bucket}
+            if len(positions) == len(bucket) and all(slots[position] is None for position in positions):
+                break
+            seed += 1
+        seeds[bucket_index] = seed
+        for key in bucket:
+            slots[mix(key, seed) % slot_count] = key
+    return seeds, slots
+
+
+def format_seeds(seeds: List[int]) -> str:
+    lines = []
+    for start in range(0, len(seeds), 8):
+        lines.append("        " + ", ".join("{}u".format(seed) for seed in seeds[start:start + 8]) + ",")
+    return "\n".join(lines)
+
+
+def write_table(name: str, value_type: str, values: Dict[int, str]) -> str:
+    seeds, slots = build_table(list(values.keys()))
+    entries = "\n".join("        {{{}u, {}}},".format(key, values[key]) for key in slots)
+    return (
+        "static constexpr perfect_hash::Table<{value_type}, {buckets}, {count}> {name} = {{{{\n"
+        "    {{\n{seeds}\n    }}\n"
+        "}}, {{\n"
+        "    {{\n{entries}\n    }}\n"
+        "}}}};\n"
+    ).format(
+        value_type=value_type, buckets=len(seeds), count=len(slots), name=name,
+        seeds=format_seeds(seeds), entries=entries
+    )
+
+
+def quote(value: str) -> str:
+    return '"' + value.replace("\\", "\\\\").replace('"', '\\"') + '"'
+
+
+HEADER = "// Generated by script/hashgen.py from script/hash_tables.json. Do not edit by hand.\n"
+
+
+def generate_semantics(data: dict, output: Path):
+    names = data["semantics"]
+    hashes = {jenkins.oaat(name.encode("utf-8")): name for name in names}
+    assert len(hashes) == len(names), "Semantic hash collision"
+
+    enum_values = "\n".join("        {} = 0x{:08X},".format(name, jenkins.oaat(name.encode("utf-8"))) for name in names)
+    (output / "include" / "semantics.h").write_text(
+        "#pragma once\n"
+        "// Autogenerated from Planetside 2 .dx11efb shader files. Definitely not 100% accurate, but it should cover most things\n"
+        + HEADER +
+        "\n"
+        "#include <string_view>\n"
+        "\n"
+        "namespace warpgate {\n"
+        "    enum class Semantic : unsigned {\n"
+        + enum_values + "\n"
+        "        UNKNOWN = 0x00000000\n"
+        "    };\n"
+        "\n"
+        "    // Returns \"Unknown\" for semantics not in the table\n"
+        "    std::string_view semantic_name(Semantic semantic);\n"
+        "}\n",
+        newline="\n"
+    )
+
+    hashes[0] = "UNKNOWN"
+    (output / "src" / "semantics.cpp").write_text(
+        HEADER +
+        "#include \"semantics.h\"\n"
+        "#include \"perfect_hash.h\"\n"
+        "\n"
+        "using namespace warpgate;\n"
+        "\n"
+        + write_table("semantic_name_table", "std::string_view", {key: quote(name) for key, name in hashes.items()}) +
+        "\n"
+        "std::string_view warpgate::semantic_name(Semantic semantic) {\n"
+        "    const perfect_hash::Entry<std::string_view> *entry = semantic_name_table.find((uint32_t)semantic);\n"
+        "    return entry != nullptr ? entry->value : \"Unknown\";\n"
+        "}\n",
+        newline="\n"
+    )
+
+
+def generate_bones(data: dict, output: Path):
+    names = {jenkins.oaat(name.encode("utf-8")): name for name in data["bones"]}
+    assert len(names) == len(data["bones"]), "Bone name hash collision"
+    for key, name in data["bone_aliases"].items():
+        assert int(key) not in names, "Bone alias {} shadows a bone name".format(name)
+        names[int(key)] = name
+
+    hierarchy = {int(child): "{}u".format(parent) for child, parent in data["bone_hierarchy"].items()}
+    rigify = {jenkins.oaat(name.encode("utf-8")): quote(rigify_name) for name, rigify_name in data["rigify_names"].items()}
+
+    (output / "src" / "ps2_bone_map.cpp").write_text(
+        HEADER +
+        "#include \"ps2_bone_map.h\"\n"
+        "#include \"jenkins.h\"\n"
+        "\n"
+        "using namespace warpgate;\n"
+        "\n"
+        + write_table("bone_name_table", "std::string_view", {key: quote(name) for key, name in names.items()}) +
+        "\n"
+        + write_table("bone_parent_table", "uint32_t", hierarchy) +
+        "\n"
+        + write_table("rigify_name_table", "std::string_view", rigify) +
+        "\n"
+        "std::optional<std::string_view> utils::bone_name(uint32_t namehash) {\n"
+        "    const perfect_hash::Entry<std::string_view> *entry = bone_name_table.find(namehash);\n"
+        "    return entry != nullptr ? std::optional<std::string_view>(entry->value) : std::nullopt;\n"
+        "}\n"
+        "\n"
+        "std::optional<uint32_t> utils::bone_namehash(std::string_view name) {\n"
+        "    uint32_t namehash = jenkins::oaat(name);\n"
+        "    const perfect_hash::Entry<std::string_view> *entry = bone_name_table.find(namehash);\n"
+        "    return entry != nullptr && entry->value == name ? std::optional<uint32_t>(namehash) : std::nullopt;\n"
+        "}\n"
+        "\n"
+        "std::optional<uint32_t> utils::bone_parent(uint32_t namehash) {\n"
+        "    const perfect_hash::Entry<uint32_t> *entry = bone_parent_table.find(namehash);\n"
+        "    return entry != nullptr ? std::optional<uint32_t>(entry->value) : std::nullopt;\n"
+        "}\n"
+        "\n"
+        "std::optional<std::string_view> utils::rigify_name(uint32_t namehash) {\n"
+        "    const perfect_hash::Entry<std::string_view> *entry = rigify_name_table.find(namehash);\n"
+        "    return entry != nullptr ? std::optional<std::string_view>(entry->value) : std::nullopt;\n"
+        "}\n"
+        "\n"
+        "std::span<const perfect_hash::Entry<std::string_view>> utils::bone_names() {\n"
+        "    return bone_name_table.entries;\n"
+        "}\n",
+        newline="\n"
+    )
+
+
+def main():
+    parser = ArgumentParser(description="Generates the perfect hash lookup tables for semantic and bone names")
+    parser.add_argument("input", help="Input json file of names (script/hash_tables.json)")
+    parser.add_argument("output", help="Output directory (lib/internal/dme_loader)")
+    args = parser.parse_args()
+
+    with open(args.input) as input:
+        data = json.load(input)
+    output = Path(args.output)
+
+    generate_semantics(data, output)
+    generate_bones(data, output)
+
+
+if __name__ == "__main__":
+    main()
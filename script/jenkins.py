@@ -1,24 +1,22 @@
 from typing import Tuple
-from numpy import int32, uint32, int8
-import warnings
 
 
-# Note: Forgelight uses a signed 32 bit int while performing the Jenkins hash, but represents it as unsigned
+# Note: Forgelight uses a signed 32 bit int while performing the Jenkins hash, but represents it as unsigned.
+# The arithmetic is done on unsigned values here, with the right shifts sign-extending as they would on an int32.
 def oaat(key: bytes):
-    with warnings.catch_warnings():
-        warnings.filterwarnings("ignore", "overflow encountered in int_scalars", RuntimeWarning)
-        warnings.filterwarnings("ignore", "overflow encountered in long_scalars", RuntimeWarning)
-        i = 0
-        hash = int32(0)
-        while i < len(key):
-            hash += int8(key[i])
-            i += 1
-            hash += int32(hash << 10)
-            hash ^= int32(hash >> 6)
-        hash += int32(hash << 3)
-        hash ^= int32(hash >> 11)
-        hash += int32(hash << 15)
-        return int(uint32(hash))
+    def sar(value: int, shift: int) -> int:
+        signed = value - (1 << 32) if value & 0x80000000 else value
+        return (signed >> shift) & 0xFFFFFFFF
+
+    hash = 0
+    for byte in key:
+        hash = (hash + (byte - 256 if byte > 127 else byte)) & 0xFFFFFFFF
+        hash = (hash + (hash << 10)) & 0xFFFFFFFF
+        hash ^= sar(hash, 6)
+    hash = (hash + (hash << 3)) & 0xFFFFFFFF
+    hash ^= sar(hash, 11)
+    hash = (hash + (hash << 15)) & 0xFFFFFFFF
+    return hash
 
 def mix(a: int, b: int, c: int) -> Tuple[int, int, int]:
     a &= 0xFFFFFFFF
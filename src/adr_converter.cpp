@@ -13,10 +13,15 @@
 #include "dme_loader.h"
 #include "utils/actor_sockets.h"
 #include "utils/adr.h"
+#include "utils/bulk.h"
 #include "utils/gltf/dme.h"
+#include "utils/gltf/meshopt.h"
 #include "utils/gltf/dmat.h"
 #include "utils/materials_3.h"
+#include "utils/metrics.h"
 #include "utils/textures.h"
+#include "utils/trace.h"
+#include "utils/trace_options.h"
 #include "utils/tsqueue.h"
 #include "utils.h"
 #include "tiny_gltf.h"
@@ -76,15 +81,50 @@ void build_argument_parser(argparse::ArgumentParser &parser, int &log_level) {
 #else
         .default_value(std::string("/mnt/c/Users/Public/Daybreak Game Company/Installed Games/Planetside 2 Test/Resources/Assets/"));
 #endif   
+    parser.add_argument("--quantized", "-q")
+        .help("Keep compact vertex formats (normalized byte normals, short UVs, byte weights) using KHR_mesh_quantization")
+        .default_value(false)
+        .implicit_value(true)
+        .nargs(0);
+
+    parser.add_argument("--optimize", "-O")
+        .help("Reorder triangles and vertices for the GPU vertex cache, overdraw and vertex fetch. Requires meshoptimizer")
+        .default_value(false)
+        .implicit_value(true)
+        .nargs(0);
+
+    parser.add_argument("--meshopt-compression")
+        .help("Compress vertex and index data with EXT_meshopt_compression (glb only). Requires meshoptimizer")
+        .default_value(false)
+        .implicit_value(true)
+        .nargs(0);
+
     parser.add_argument("--rigify", "-r")
         .help("Export bones named to match bones generated by Rigify (for humanoid rigs)")
         .default_value(false)
         .implicit_value(true)
         .nargs(0);
+
+    parser.add_argument("--bulk-mode", "-b")
+        .help("Switches to bulk mode: <input_file> is a glob pattern of files on disk or a file listing one asset name per line, and <output_file> is the directory where the models will be stored.")
+        .default_value(false)
+        .implicit_value(true)
+        .nargs(0);
+
+    parser.add_argument("--jobs", "-j")
+        .help("The number of models to convert in parallel in bulk mode")
+        .default_value(2u)
+        .scan<'u', uint32_t>();
+
+    utils::trace::add_arguments(parser);
+
+    parser.add_argument("--metrics")
+        .help("Write throughput counters (bytes read and decompressed, textures processed, ...) as JSON to this file when done");
     
 }
 
 void load_asset(synthium::Manager &manager, std::string input_str, std::vector<uint8_t> &data_vector, std::span<uint8_t> &data_span, std::shared_ptr<uint8_t[]> &data) {
+    utils::trace::Scope scope("load_asset");
     std::filesystem::path input_filename(input_str);
     if(manager.contains(input_str)) {
         logger::debug("Loading '{}' from manager...", input_str);
@@ -99,18 +139,18 @@ void load_asset(synthium::Manager &manager, std::string input_str, std::vector<u
             } catch(std::bad_alloc) {
                 logger::warn("Failed to load asset, deallocating some packs");
                 manager.deallocate(asset->uncompressed_size());
-            } catch(std::exception &err) {
-                logger::error("Failed to load '{}' from manager: {}", input_str, err.what());
-                std::exit(1);
             }
             retries--;
         }
+        if(data_vector.size() == 0) {
+            throw std::runtime_error("Failed to load '" + input_str + "' from manager");
+        }
+        utils::metrics::add(utils::metrics::Counter::PackBytesRead, data_vector.size());
     } else {
         logger::debug("Loading '{}' from filesystem...", input_str);
         std::ifstream input(input_filename, std::ios::binary | std::ios::ate);
         if(input.fail()) {
-            logger::error("Failed to open file '{}'", input_filename.string());
-            std::exit(2);
+            throw std::runtime_error("Failed to open file '" + input_filename.string() + "'");
         }
         size_t length = input.tellg();
         input.seekg(0);
@@ -137,6 +177,88 @@ int findCOGIndex(tinygltf::Model &gltf, tinygltf::Node &node) {
     return index;
 }
 
+void convert_adr(
+    synthium::Manager &manager,
+    utils::ActorSockets &actorSockets,
+    std::string input_str,
+    std::filesystem::path output_filename,
+    std::string format,
+    utils::tsqueue<std::pair<std::string, Semantic>> &image_queue,
+    bool export_textures,
+    bool include_skeleton,
+    bool rigify_skeleton,
+    bool quantized,
+    bool optimize_meshes,
+    bool compress_meshes,
+    uint32_t optimize_thread_count
+) {
+    std::shared_ptr<uint8_t[]> data;
+    std::vector<uint8_t> data_vector;
+    std::span<uint8_t> data_span;
+
+    load_asset(manager, input_str, data_vector, data_span, data);
+
+    utils::ADR adr(data_span);
+    std::optional<std::string> dme_file = adr.base_model();
+    if(!dme_file) {
+        throw std::runtime_error("'" + input_str + "' has no base model");
+    }
+
+    std::optional<std::string> dmat_file = adr.base_palette();
+    std::shared_ptr<DMAT> dmat = nullptr;
+    std::shared_ptr<uint8_t[]> dmat_data;
+    std::vector<uint8_t> dmat_data_vector;
+    std::span<uint8_t> dmat_data_span;
+    if(dmat_file) {
+        load_asset(manager, *dmat_file, dmat_data_vector, dmat_data_span, dmat_data);
+        dmat.reset(new DMAT(dmat_data_span));
+    }
+
+    std::shared_ptr<uint8_t[]> dme_data;
+    std::vector<uint8_t> dme_data_vector;
+    std::span<uint8_t> dme_data_span;
+
+    load_asset(manager, *dme_file, dme_data_vector, dme_data_span, dme_data);
+    
+    utils::trace::Scope parse_scope("dme::parse");
+    std::shared_ptr<DME> dme;
+    if(dmat != nullptr) {
+        dme.reset(new DME(dme_data_span, output_filename.stem().string(), dmat));
+    } else {
+        dme.reset(new DME(dme_data_span, output_filename.stem().string()));
+    }
+    parse_scope.end();
+    int parent_index;
+    tinygltf::Model gltf = utils::gltf::dme::build_gltf_from_dme(*dme, image_queue, output_filename.parent_path(), export_textures, include_skeleton, rigify_skeleton, &parent_index, quantized);
+
+    std::string basename = std::filesystem::path(input_str).stem().string();
+    if(actorSockets.model_indices.find(basename) != actorSockets.model_indices.end()) {
+        int cog_index = findCOGIndex(gltf, gltf.nodes[parent_index]);
+        if(cog_index != -1) {
+            parent_index = cog_index;
+        }
+        utils::gltf::dme::add_actorsockets_to_gltf(gltf, actorSockets, basename, parent_index);
+    }
+    
+    if(optimize_meshes) {
+        utils::gltf::meshopt::optimize(gltf, optimize_thread_count);
+    }
+    
+    logger::info("Writing GLTF2 file {}...", output_filename.filename().string());
+    utils::trace::Scope write_scope("gltf::write");
+    tinygltf::TinyGLTF writer;
+    bool written;
+    if(compress_meshes) {
+        utils::gltf::meshopt::compress(gltf);
+        written = utils::gltf::meshopt::write_glb(gltf, output_filename);
+    } else {
+        written = writer.WriteGltfSceneToFile(&gltf, output_filename.string(), false, format == "glb", format == "gltf", format == "glb");
+    }
+    if(!written) {
+        throw std::runtime_error("Failed to write '" + output_filename.string() + "'");
+    }
+}
+
 int main(int argc, const char* argv[]) {
     argparse::ArgumentParser parser("adr_converter", WARPGATE_VERSION);
     int log_level = logger::level::warn;
@@ -152,6 +274,9 @@ int main(int argc, const char* argv[]) {
     }
     logger::set_level(logger::level::level_enum(log_level));
 
+    std::optional<std::string> metrics_path = parser.present<std::string>("--metrics");
+    utils::trace::start(parser);
+
     std::string input_str = parser.get<std::string>("input_file");
     
     logger::info("Converting file {} using adr_converter {}", input_str, WARPGATE_VERSION);
@@ -165,7 +290,9 @@ int main(int argc, const char* argv[]) {
     assets.push_back(server / "data_x64_0.pack2");
     
     logger::info("Loading packs...");
+    utils::trace::Scope packs_scope("load_packs");
     synthium::Manager manager(assets);
+    packs_scope.end();
     logger::info("Manager loaded.");
     
     logger::info("Loading materials.json");
@@ -176,24 +303,26 @@ int main(int argc, const char* argv[]) {
     std::vector<uint8_t> actorsockets_data_vector;
     std::span<uint8_t> actorsockets_data_span;
 
-    load_asset(manager, "ActorSockets.xml", actorsockets_data_vector, actorsockets_data_span, actorsockets_data);
+    try {
+        load_asset(manager, "ActorSockets.xml", actorsockets_data_vector, actorsockets_data_span, actorsockets_data);
+    } catch(std::exception &err) {
+        logger::error("{}", err.what());
+        std::exit(1);
+    }
     utils::ActorSockets actorSockets(actorsockets_data_span);
-
-    std::shared_ptr<uint8_t[]> data;
-    std::vector<uint8_t> data_vector;
-    std::span<uint8_t> data_span;
-
-    load_asset(manager, input_str, data_vector, data_span, data);
     
+    bool bulk_mode = parser.get<bool>("--bulk-mode");
     std::filesystem::path output_filename(parser.get<std::string>("output_file"));
     output_filename = std::filesystem::weakly_canonical(output_filename);
     std::shared_ptr<std::filesystem::path> output_directory = std::make_shared<std::filesystem::path>();
-    if(output_filename.has_parent_path()) {
+    if(bulk_mode) {
+        *output_directory = output_filename;
+    } else if(output_filename.has_parent_path()) {
         *output_directory = output_filename.parent_path();
     }
 
     try {
-        if(!std::filesystem::exists(output_filename.parent_path())) {
+        if(!std::filesystem::exists(*output_directory / "textures")) {
             logger::debug("Creating directories '{}'...", (*output_directory / "textures").string());
             std::filesystem::create_directories(*output_directory / "textures");
             logger::debug("Created directories '{}'.", (*output_directory / "textures").string());
@@ -209,6 +338,17 @@ int main(int argc, const char* argv[]) {
     bool include_skeleton = !parser.get<bool>("--no-skeleton");
     bool export_textures = !parser.get<bool>("--no-textures");
     bool rigify_skeleton = parser.get<bool>("--rigify");
+    bool quantized = parser.get<bool>("--quantized");
+    bool optimize_meshes = parser.get<bool>("--optimize");
+    bool compress_meshes = parser.get<bool>("--meshopt-compression");
+    if((optimize_meshes || compress_meshes) && !utils::gltf::meshopt::available()) {
+        logger::error("--optimize and --meshopt-compression require warpgate to be built with WARPGATE_USE_MESHOPTIMIZER");
+        std::exit(1);
+    }
+    if(compress_meshes && format != "glb") {
+        logger::error("--meshopt-compression requires glb output");
+        std::exit(1);
+    }
 
     std::vector<std::thread> image_processor_pool;
     if(export_textures) {
@@ -225,55 +365,46 @@ int main(int argc, const char* argv[]) {
         logger::info("Not exporting textures by user request.");
     }
 
-    utils::ADR adr(data_span);
-    std::optional<std::string> dme_file = adr.base_model();
-    if(!dme_file) {
-        std::exit(1);
-    }
-
-    std::optional<std::string> dmat_file = adr.base_palette();
-    std::shared_ptr<DMAT> dmat = nullptr;
-    std::shared_ptr<uint8_t[]> dmat_data;
-    std::vector<uint8_t> dmat_data_vector;
-    std::span<uint8_t> dmat_data_span;
-    if(dmat_file) {
-        load_asset(manager, *dmat_file, dmat_data_vector, dmat_data_span, dmat_data);
-        dmat.reset(new DMAT(dmat_data_span));
-    }
-
-    std::shared_ptr<uint8_t[]> dme_data;
-    std::vector<uint8_t> dme_data_vector;
-    std::span<uint8_t> dme_data_span;
-
-    load_asset(manager, *dme_file, dme_data_vector, dme_data_span, dme_data);
-    
-    std::shared_ptr<DME> dme;
-    if(dmat != nullptr) {
-        dme.reset(new DME(dme_data_span, output_filename.stem().string(), dmat));
+    int exit_code = 0;
+    if(!bulk_mode) {
+        try {
+            convert_adr(manager, actorSockets, input_str, output_filename, format, image_queue, export_textures, include_skeleton, rigify_skeleton, quantized, optimize_meshes, compress_meshes, std::thread::hardware_concurrency());
+        } catch(std::exception &err) {
+            logger::error("{}", err.what());
+            std::exit(2);
+        }
     } else {
-        dme.reset(new DME(dme_data_span, output_filename.stem().string()));
-    }
-    int parent_index;
-    tinygltf::Model gltf = utils::gltf::dme::build_gltf_from_dme(*dme, image_queue, *output_directory, export_textures, include_skeleton, rigify_skeleton, &parent_index);
+        std::vector<std::string> inputs;
+        try {
+            inputs = utils::bulk::inputs(input_str);
+        } catch(std::exception &err) {
+            logger::error("{}", err.what());
+            std::exit(4);
+        }
+        uint32_t job_count = std::max(1u, parser.get<uint32_t>("--jobs"));
+        logger::info("Switched to bulk mode. Converting {} models using {} job{}...", inputs.size(), job_count, job_count == 1 ? "" : "s");
+        // Jobs run side by side, so each job's mesh optimizer only gets its share of the cores
+        uint32_t optimize_thread_count = std::max(1u, std::thread::hardware_concurrency() / job_count);
 
-    std::string basename = std::filesystem::path(input_str).stem().string();
-    if(actorSockets.model_indices.find(basename) != actorSockets.model_indices.end()) {
-        int cog_index = findCOGIndex(gltf, gltf.nodes[parent_index]);
-        if(cog_index != -1) {
-            parent_index = cog_index;
+        size_t failures = utils::bulk::convert(inputs, *output_directory, format, job_count, image_queue, [&](const std::string &name, const std::filesystem::path &model_filename, utils::bulk::image_queue_t &model_image_queue) {
+            convert_adr(manager, actorSockets, name, model_filename, format, model_image_queue, export_textures, include_skeleton, rigify_skeleton, quantized, optimize_meshes, compress_meshes, optimize_thread_count);
+        });
+        if(failures > 0) {
+            logger::error("Failed to convert {} of {} models", failures, inputs.size());
+            exit_code = 5;
         }
-        utils::gltf::dme::add_actorsockets_to_gltf(gltf, actorSockets, basename, parent_index);
     }
     
-    logger::info("Writing GLTF2 file {}...", output_filename.filename().string());
-    tinygltf::TinyGLTF writer;
-    writer.WriteGltfSceneToFile(&gltf, output_filename.string(), false, format == "glb", format == "gltf", format == "glb");
-    
     image_queue.close();
     logger::info("Joining image processing thread{}...", image_processor_pool.size() == 1 ? "" : "s");
     for(uint32_t i = 0; i < image_processor_pool.size(); i++) {
         image_processor_pool.at(i).join();
     }
+    utils::metrics::record_max(utils::metrics::Counter::ImageQueueHighWater, image_queue.high_water_mark());
+    if(metrics_path) {
+        utils::metrics::write_json(*metrics_path);
+    }
+    utils::trace::report(parser);
     logger::info("Done.");
-    return 0;
+    return exit_code;
 }
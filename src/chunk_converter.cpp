@@ -6,7 +6,11 @@
 #include "argparse/argparse.hpp"
 #include "cnk_loader.h"
 #include "utils/gltf/chunk.h"
+#include "utils/gltf/meshopt.h"
+#include "utils/metrics.h"
 #include "utils/textures.h"
+#include "utils/trace.h"
+#include "utils/trace_options.h"
 #include "utils/tsqueue.h"
 #include "synthium/synthium.h"
 #include "tiny_gltf.h"
@@ -78,6 +82,23 @@ void build_argument_parser(argparse::ArgumentParser &parser, int &log_level) {
         .implicit_value(true)
         .nargs(0);
 
+    parser.add_argument("--optimize", "-O")
+        .help("Reorder triangles and vertices for the GPU vertex cache, overdraw and vertex fetch. Requires meshoptimizer")
+        .default_value(false)
+        .implicit_value(true)
+        .nargs(0);
+
+    parser.add_argument("--meshopt-compression")
+        .help("Compress vertex and index data with EXT_meshopt_compression (glb only). Requires meshoptimizer")
+        .default_value(false)
+        .implicit_value(true)
+        .nargs(0);
+
+    warpgate::utils::trace::add_arguments(parser);
+
+    parser.add_argument("--metrics")
+        .help("Write throughput counters (bytes read and decompressed, textures processed, ...) as JSON to this file when done");
+
     parser.add_argument("--assets-directory", "-d")
         .help("The directory where the game's assets are stored")
 #ifdef _WIN32
@@ -103,6 +124,9 @@ int main(int argc, char* argv[]) {
 
     logger::set_level(logger::level::level_enum(log_level));
 
+    std::optional<std::string> metrics_path = parser.present<std::string>("--metrics");
+    warpgate::utils::trace::start(parser);
+
     std::string input_str = parser.get<std::string>("input_file");
     
     logger::info("Converting file {} using dme_converter {}", input_str, WARPGATE_VERSION);
@@ -116,7 +140,9 @@ int main(int argc, char* argv[]) {
     });
 
     logger::info("Loading packs...");
+    warpgate::utils::trace::Scope packs_scope("load_packs");
     synthium::Manager manager(packs);
+    packs_scope.end();
     logger::info("Manager loaded.");
 
     std::filesystem::path input_filename(input_str);
@@ -125,6 +151,7 @@ int main(int argc, char* argv[]) {
     std::span<uint8_t> data_span, chunk1_data_span;
     if(manager.contains(input_str)) {
         data_vector = manager.get(input_str)->get_data();
+        warpgate::utils::metrics::add(warpgate::utils::metrics::Counter::PackBytesRead, data_vector.size());
         data_span = std::span<uint8_t>(data_vector.data(), data_vector.size());
     } else {
         std::ifstream input(input_filename, std::ios::binary | std::ios::ate);
@@ -142,6 +169,7 @@ int main(int argc, char* argv[]) {
 
     if(input_filename.extension().string() == ".cnk0" && manager.contains(input_filename.filename().replace_extension("cnk1").string())) {
         chunk1_data_vector = manager.get(input_filename.filename().replace_extension("cnk1").string())->get_data();
+        warpgate::utils::metrics::add(warpgate::utils::metrics::Counter::PackBytesRead, chunk1_data_vector.size());
         chunk1_data_span = std::span<uint8_t>(chunk1_data_vector.data(), chunk1_data_vector.size());
     }
 
@@ -163,6 +191,16 @@ int main(int argc, char* argv[]) {
 
     std::string format = parser.get<std::string>("--format");
     bool export_textures = !parser.get<bool>("--no-textures");
+    bool optimize_meshes = parser.get<bool>("--optimize");
+    bool compress_meshes = parser.get<bool>("--meshopt-compression");
+    if((optimize_meshes || compress_meshes) && !warpgate::utils::gltf::meshopt::available()) {
+        logger::error("--optimize and --meshopt-compression require warpgate to be built with WARPGATE_USE_MESHOPTIMIZER");
+        std::exit(1);
+    }
+    if(compress_meshes && format != "glb") {
+        logger::error("--meshopt-compression requires glb output");
+        std::exit(1);
+    }
     uint32_t image_processor_thread_count = parser.get<uint32_t>("--threads");
     // hmm
     warpgate::utils::tsqueue<
@@ -187,13 +225,17 @@ int main(int argc, char* argv[]) {
         logger::info("Not exporting textures by user request.");
     }
 
+    warpgate::utils::trace::Scope load_scope("chunk::load");
     warpgate::chunk::Chunk compressed_chunk0(data_span);
     std::unique_ptr<uint8_t[]> decompressed_chunk0 = compressed_chunk0.decompress();
+    warpgate::utils::metrics::add(warpgate::utils::metrics::Counter::ChunkBytesDecompressed, compressed_chunk0.decompressed_size());
 
     warpgate::chunk::CNK0 chunk0({decompressed_chunk0.get(), compressed_chunk0.decompressed_size()});
 
     warpgate::chunk::Chunk compressed_chunk1(chunk1_data_span);
     std::unique_ptr<uint8_t[]> decompressed_chunk1 = compressed_chunk1.decompress();
+    warpgate::utils::metrics::add(warpgate::utils::metrics::Counter::ChunkBytesDecompressed, compressed_chunk1.decompressed_size());
+    load_scope.end();
 
     warpgate::chunk::CNK1 chunk1({decompressed_chunk1.get(), compressed_chunk1.decompressed_size()});
 
@@ -201,9 +243,20 @@ int main(int argc, char* argv[]) {
     tinygltf::Model gltf = warpgate::utils::gltf::chunk::build_gltf_from_chunks(chunk0, chunk1, output_directory, export_textures, image_queue, input_filename.stem().string());
     logger::info("Added chunk to gltf");
 
+    if(optimize_meshes) {
+        warpgate::utils::gltf::meshopt::optimize(gltf, std::thread::hardware_concurrency());
+    }
+
     logger::info("Writing gltf file...");
+    warpgate::utils::trace::Scope write_scope("gltf::write");
     tinygltf::TinyGLTF writer;
-    writer.WriteGltfSceneToFile(&gltf, output_filename.string(), false, format == "glb", format == "gltf", format == "glb");
+    if(compress_meshes) {
+        warpgate::utils::gltf::meshopt::compress(gltf);
+        warpgate::utils::gltf::meshopt::write_glb(gltf, output_filename);
+    } else {
+        writer.WriteGltfSceneToFile(&gltf, output_filename.string(), false, format == "glb", format == "gltf", format == "glb");
+    }
+    write_scope.end();
     logger::info("Successfully wrote gltf file!");
 
     image_queue.close();
@@ -211,6 +264,11 @@ int main(int argc, char* argv[]) {
     for(uint32_t i = 0; i < image_processor_pool.size(); i++) {
         image_processor_pool.at(i).join();
     }
+    warpgate::utils::metrics::record_max(warpgate::utils::metrics::Counter::ImageQueueHighWater, image_queue.high_water_mark());
+    if(metrics_path) {
+        warpgate::utils::metrics::write_json(*metrics_path);
+    }
+    warpgate::utils::trace::report(parser);
     logger::info("Done.");
     return 0;
 }
\ No newline at end of file
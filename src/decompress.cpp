@@ -1,12 +1,22 @@
+#include <algorithm>
+#include <atomic>
 #include <filesystem>
 #include <fstream>
+#include <iostream>
 #include <span>
 #include <sstream>
+#include <thread>
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#endif
 
 #include "version.h"
 
 #include <argparse/argparse.hpp>
 #include <spdlog/spdlog.h>
+#include <spdlog/sinks/stdout_color_sinks.h>
 #include <zlib.h>
 
 namespace logger = spdlog;
@@ -21,10 +31,133 @@ uint32_t ntohl(uint32_t const net) {
          | ((uint32_t) data[0] << 24);
 }
 
+constexpr size_t BUF_SIZE = 1 << 20;
+
 void build_argument_parser(argparse::ArgumentParser &parser, int &log_level) {
     parser.add_description("Forgelight Asset Decompressor");
-    parser.add_argument("compressed_file");
-    parser.add_argument("output_file");
+    parser.add_argument("files")
+        .help("<compressed_file> <output_file>, or any number of compressed files when using --output-directory. Use '-' for stdin/stdout.")
+        .nargs(argparse::nargs_pattern::at_least_one);
+
+    parser.add_argument("--output-directory", "-o")
+        .help("Decompress every input file into this directory, keeping its file name");
+
+    parser.add_argument("--threads", "-t")
+        .help("The number of files to decompress in parallel when using --output-directory")
+        .default_value(std::max(1u, std::thread::hardware_concurrency()))
+        .scan<'u', uint32_t>();
+}
+
+// Streams a compressed forgelight asset through inflate using fixed size buffers,
+// so memory use does not depend on the size of the asset. Returns 0 on success.
+int decompress(std::string input_filename, std::string output_filename_str) {
+    std::ifstream input_file;
+    std::istream *input = &std::cin;
+    if(input_filename != "-") {
+        input_file.open(input_filename, std::ios::binary);
+        if(input_file.fail()) {
+            logger::error("Failed to open '{}': {}", input_filename, strerror(errno));
+            return 1;
+        }
+        input = &input_file;
+    }
+
+    uint32_t header[2] = {};
+    input->read((char*)header, sizeof(header));
+    if(input->gcount() != sizeof(header) || ntohl(header[0]) != 0xA1B2C3D4) {
+        logger::error("Invalid header, not a compressed forgelight asset. Got magic {:#010x}", ntohl(header[0]));
+        return 2;
+    }
+
+    uint64_t decompressed_size = ntohl(header[1]);
+    logger::info("Decompressing asset '{}' of length {}", input_filename, decompressed_size);
+
+    std::ofstream output_file;
+    std::ostream *output = &std::cout;
+    std::filesystem::path output_filename;
+    if(output_filename_str != "-") {
+        output_filename = std::filesystem::weakly_canonical(output_filename_str);
+        try {
+            if(output_filename.has_parent_path() && !std::filesystem::exists(output_filename.parent_path())) {
+                std::filesystem::create_directories(output_filename.parent_path());
+            }
+        } catch (std::filesystem::filesystem_error& err) {
+            logger::error("Failed to create directory {}: {}", err.path1().string(), err.what());
+            return 3;
+        }
+        output_file.open(output_filename, std::ios::binary);
+        if(output_file.fail()) {
+            logger::error("Failed to open '{}': {}", output_filename.string(), strerror(errno));
+            return 3;
+        }
+        output = &output_file;
+        logger::info("Writing file {}", output_filename.string());
+    }
+
+    std::unique_ptr<uint8_t[]> input_buffer = std::make_unique<uint8_t[]>(BUF_SIZE);
+    std::unique_ptr<uint8_t[]> output_buffer = std::make_unique<uint8_t[]>(BUF_SIZE);
+    z_stream stream{};
+    int errcode = inflateInit(&stream);
+    if(errcode != Z_OK) {
+        logger::error("inflateInit: {} ({})", zError(errcode), errcode);
+        return 4;
+    }
+
+    uint64_t written = 0;
+    bool input_done = false, output_full = false;
+    do {
+        if(stream.avail_in == 0 && !input_done) {
+            input->read((char*)input_buffer.get(), BUF_SIZE);
+            stream.avail_in = (uInt)input->gcount();
+            stream.next_in = input_buffer.get();
+            input_done = stream.avail_in == 0;
+        }
+        if(stream.avail_in == 0 && input_done && !output_full) {
+            errcode = Z_DATA_ERROR;
+            break;
+        }
+
+        stream.avail_out = BUF_SIZE;
+        stream.next_out = output_buffer.get();
+        errcode = inflate(&stream, Z_NO_FLUSH);
+        if(errcode == Z_NEED_DICT) {
+            errcode = Z_DATA_ERROR;
+        }
+        if(errcode != Z_OK && errcode != Z_STREAM_END && errcode != Z_BUF_ERROR) {
+            break;
+        }
+
+        size_t count = BUF_SIZE - stream.avail_out;
+        output_full = stream.avail_out == 0;
+        output->write((char*)output_buffer.get(), count);
+        written += count;
+    } while(errcode != Z_STREAM_END);
+    inflateEnd(&stream);
+    output->flush();
+
+    if(errcode != Z_STREAM_END) {
+        switch(errcode) {
+        case Z_MEM_ERROR:
+            logger::error("inflate: Not enough memory! ({})", errcode);
+            break;
+        case Z_DATA_ERROR:
+            logger::error("inflate: Input data was corrupted or incomplete! ({})", errcode);
+            break;
+        }
+        logger::error("Error message: {}", zError(errcode));
+        return 4;
+    }
+
+    if(!*output) {
+        logger::error("Failed to write output for '{}'", input_filename);
+        return 5;
+    }
+
+    if(written != decompressed_size) {
+        logger::warn("'{}': expected {} bytes but decompressed {}", input_filename, decompressed_size, written);
+    }
+    logger::info("Wrote {} bytes to {}", written, output_filename_str == "-" ? "stdout" : output_filename.string());
+    return 0;
 }
 
 int main(int argc, char* argv[]) {
@@ -39,70 +172,59 @@ int main(int argc, char* argv[]) {
         std::cerr << parser;
         std::exit(1);
     }
-    logger::set_level(logger::level::level_enum(log_level));
-
-    std::string input_filename = parser.get<std::string>("compressed_file");
-    logger::info("Decompressing '{}' (using decompress {})", input_filename, WARPGATE_VERSION);
 
-    std::ifstream input(input_filename, std::ios::binary | std::ios::ate);
-    if(input.fail()) {
-        logger::error("Failed to open '{}': {}", input_filename, strerror(errno));
+    std::vector<std::string> files = parser.get<std::vector<std::string>>("files");
+    std::optional<std::string> output_directory = parser.present<std::string>("--output-directory");
+    if(!output_directory && files.size() != 2) {
+        std::cerr << "Expected <compressed_file> <output_file>, or --output-directory with any number of inputs" << std::endl;
+        std::cerr << parser;
         std::exit(1);
     }
-    size_t length = input.tellg();
-    std::unique_ptr<uint8_t[]> data = std::make_unique<uint8_t[]>(length);
-    input.seekg(0);
-    input.read((char*)data.get(), length);
 
-    std::span<uint32_t> header(reinterpret_cast<uint32_t*>(data.get()), 2);
-    if(ntohl(header[0]) != 0xA1B2C3D4) {
-        logger::error("Invalid header, not a compressed forgelight asset. Got magic {:#010x}", ntohl(header[0]));
-        std::exit(2);
+    bool uses_stdio = std::find(files.begin(), files.end(), "-") != files.end();
+    if(output_directory && uses_stdio) {
+        // Output names are taken from the input file names, which stdin does not have
+        std::cerr << "'-' cannot be used with --output-directory, use <compressed_file> <output_file> to decompress stdin" << std::endl;
+        std::exit(1);
     }
 
-    unsigned long compressed_size = (unsigned long)(length - 8);
-    unsigned long decompressed_size = ntohl(header[1]);
-    logger::info("Decompressing asset '{}' of length {} (compressed length {})", input_filename, decompressed_size, compressed_size);
+    if(uses_stdio) {
+        // Keep stdout clean for the decompressed data
+        logger::set_default_logger(logger::stderr_color_mt("decompress"));
+        std::ios::sync_with_stdio(false);
+#ifdef _WIN32
+        _setmode(_fileno(stdin), _O_BINARY);
+        _setmode(_fileno(stdout), _O_BINARY);
+#endif
+    }
+    logger::set_level(logger::level::level_enum(log_level));
+    logger::info("Using decompress {}", WARPGATE_VERSION);
 
-    std::unique_ptr<uint8_t[]> decompressed = std::make_unique<uint8_t[]>(decompressed_size);
-    int errcode = uncompress2(decompressed.get(), &decompressed_size, data.get() + 8, &compressed_size);
+    if(!output_directory) {
+        return decompress(files[0], files[1]);
+    }
 
-    if(errcode != Z_OK) {
-        switch(errcode) {
-        case Z_MEM_ERROR:
-            logger::error("uncompress: Not enough memory! ({})", errcode);
-            break;
-        case Z_BUF_ERROR:
-            // Theoretically this shouldn't happen
-            logger::error("uncompress: Not enough room in the output buffer! ({})", errcode);
-            break;
-        case Z_DATA_ERROR:
-            logger::error("uncompress: Input data was corrupted or incomplete! ({})", errcode);
-            break;
-        }
-        logger::error("Error message: {}", zError(errcode));
-        std::exit(4);
+    uint32_t thread_count = std::max(1u, std::min(parser.get<uint32_t>("--threads"), (uint32_t)files.size()));
+    std::atomic_size_t next_file = 0, failures = 0;
+    std::vector<std::thread> workers;
+    for(uint32_t i = 0; i < thread_count; i++) {
+        workers.push_back(std::thread([&]() {
+            size_t index;
+            while((index = next_file++) < files.size()) {
+                std::filesystem::path output_filename = std::filesystem::path(*output_directory) / std::filesystem::path(files[index]).filename();
+                if(decompress(files[index], output_filename.string()) != 0) {
+                    failures++;
+                }
+            }
+        }));
     }
-    
-    std::filesystem::path output_filename(parser.get<std::string>("output_file"));
-    output_filename = std::filesystem::weakly_canonical(output_filename);
-    std::filesystem::path output_directory;
-    if(output_filename.has_parent_path()) {
-        output_directory = output_filename.parent_path();
+    for(uint32_t i = 0; i < workers.size(); i++) {
+        workers.at(i).join();
     }
 
-    try {
-        if(!std::filesystem::exists(output_filename.parent_path())) {
-            std::filesystem::create_directories(output_directory);
-        }
-    } catch (std::filesystem::filesystem_error& err) {
-        logger::error("Failed to create directory {}: {}", err.path1().string(), err.what());
-        std::exit(3);
+    if(failures > 0) {
+        logger::error("Failed to decompress {} of {} files", (size_t)failures, files.size());
+        return 4;
     }
-
-    logger::info("Writing file {}", output_filename.string());
-    std::ofstream output(output_filename, std::ios::binary);
-    output.write((char*)decompressed.get(), decompressed_size);
-    logger::info("Wrote {} bytes to {}", decompressed_size, output_filename.string());
     return 0;
-}
\ No newline at end of file
+}
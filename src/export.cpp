@@ -1,5 +1,9 @@
+#include <atomic>
+#include <condition_variable>
 #include <fstream>
+#include <mutex>
 #include <sstream>
+#include <thread>
 
 #include "version.h"
 
@@ -7,7 +11,10 @@
 #include <cnk_loader.h>
 #include <glob/glob.h>
 #include <synthium/synthium.h>
+#include <utils/metrics.h>
 #include <utils/textures.h>
+#include <utils/trace.h>
+#include <utils/trace_options.h>
 
 namespace logger = spdlog;
 
@@ -63,6 +70,123 @@ void build_argument_parser(argparse::ArgumentParser &parser, int &log_level) {
     parser.add_argument("--extra-packs", "-e")
         .help("Extra glob patterns to use when loading packs.")
         .nargs(argparse::nargs_pattern::at_least_one);
+
+    parser.add_argument("--threads", "-t")
+        .help("The number of threads to use for exporting in bulk mode")
+        .default_value(std::max(1u, std::thread::hardware_concurrency()))
+        .scan<'u', uint32_t>();
+
+    parser.add_argument("--max-memory", "-M")
+        .help("The maximum size in MB of asset data held in memory at once in bulk mode")
+        .default_value(1024u)
+        .scan<'u', uint32_t>();
+
+    warpgate::utils::trace::add_arguments(parser);
+
+    parser.add_argument("--metrics")
+        .help("Write throughput counters (bytes read and decompressed, PNG bytes written, ...) as JSON to this file when done");
+}
+
+// Limits the total size of the assets being exported at once, including chunk decompression
+// buffers. A single asset larger than the limit is still allowed through once nothing else is
+// in flight.
+class MemoryBudget {
+public:
+    MemoryBudget(uint64_t limit): limit(limit), used(0) {}
+
+    void acquire(uint64_t size) {
+        std::unique_lock<std::mutex> lock(m);
+        c.wait(lock, [&]{ return used == 0 || used + size <= limit; });
+        used += size;
+    }
+
+    // Grows a reservation of `held` bytes by `size` if that fits now. Never waits, since a
+    // worker waiting while holding memory could deadlock with another doing the same.
+    bool try_grow(uint64_t held, uint64_t size) {
+        std::lock_guard<std::mutex> lock(m);
+        if(used != held && used + size > limit) {
+            return false;
+        }
+        used += size;
+        return true;
+    }
+
+    void release(uint64_t size) {
+        std::lock_guard<std::mutex> lock(m);
+        used -= size;
+        c.notify_all();
+    }
+
+private:
+    uint64_t limit, used;
+    std::mutex m;
+    std::condition_variable c;
+};
+
+// The memory reserved for one export, which may grow once its size is known
+struct Reservation {
+    MemoryBudget &budget;
+    uint64_t size;
+};
+
+std::string export_file(
+    std::shared_ptr<synthium::Asset2> asset,
+    std::string filename,
+    std::filesystem::path output_name,
+    std::filesystem::path output_directory,
+    bool raw,
+    bool chunk_file,
+    bool dds_to_png,
+    Reservation *reservation = nullptr
+) {
+    warpgate::utils::trace::Scope load_scope("load_asset");
+    std::vector<uint8_t> data = asset->get_data(raw);
+    warpgate::utils::metrics::add(warpgate::utils::metrics::Counter::PackBytesRead, data.size());
+    load_scope.end();
+    std::unique_ptr<uint8_t[]> decompressed;
+    std::span<uint8_t> data_span = std::span<uint8_t>(data.begin(), data.end());
+    if(chunk_file) {
+        uint64_t buffer_size = sizeof(warpgate::chunk::ChunkHeader) + warpgate::chunk::Chunk(data).decompressed_size();
+        if(reservation != nullptr && !reservation->budget.try_grow(reservation->size, buffer_size)) {
+            // Give the compressed data back while waiting for room for both, then read it again
+            std::vector<uint8_t>().swap(data);
+            reservation->budget.release(reservation->size);
+            reservation->size += buffer_size;
+            reservation->budget.acquire(reservation->size);
+            data = asset->get_data(raw);
+            warpgate::utils::metrics::add(warpgate::utils::metrics::Counter::PackBytesRead, data.size());
+        } else if(reservation != nullptr) {
+            reservation->size += buffer_size;
+        }
+        warpgate::utils::trace::Scope decompress_scope("chunk::decompress");
+        warpgate::chunk::Chunk chunk(data);
+        logger::info("Decompressing chunk '{}' of size {} (Compressed size: {})", filename, synthium::utils::human_bytes(chunk.decompressed_size()), synthium::utils::human_bytes(chunk.compressed_size()));
+        decompressed = chunk.decompress();
+        warpgate::utils::metrics::add(warpgate::utils::metrics::Counter::ChunkBytesDecompressed, chunk.decompressed_size());
+        data_span = std::span<uint8_t>(decompressed.get(), chunk.decompressed_size());
+    }
+    if(dds_to_png && output_name.extension() == std::filesystem::path(".dds")) {
+        warpgate::utils::trace::Scope texture_scope("texture::convert");
+        std::optional<gli::texture2d> texture = warpgate::utils::textures::load_texture(filename, data);
+        if(!texture.has_value()) {
+            return fmt::format("Failed to load texture {}", filename);
+        }
+        output_name.replace_extension(".png");
+        auto extent = texture->extent();
+        if(warpgate::utils::textures::write_texture(
+            std::span<uint32_t>(texture->data<uint32_t>(), texture->size<uint32_t>()),
+            output_name,
+            extent)
+        ){
+            logger::debug("Saved texture to {}", output_name.lexically_relative(output_directory).string());
+        }
+    } else {
+        warpgate::utils::trace::Scope write_scope("write_file");
+        std::ofstream output(output_name, std::ios::binary);
+        output.write((char*)data_span.data(), data_span.size());
+        output.close();
+    }
+    return fmt::format("Wrote {} to {}", synthium::utils::human_bytes(data_span.size()), output_name.string());
 }
 
 int main(int argc, char* argv[]) {
@@ -78,6 +202,8 @@ int main(int argc, char* argv[]) {
         std::exit(1);
     }
     logger::set_level(logger::level::level_enum(log_level));
+    warpgate::utils::trace::start(parser);
+    std::optional<std::string> metrics_path = parser.present<std::string>("--metrics");
 
     logger::info("export: loading assets (using synthium {})", synthium::version());
     std::string server = parser.get<std::string>("--assets-directory");
@@ -111,7 +237,9 @@ int main(int argc, char* argv[]) {
         paths.insert(paths.end(), additional.begin(), additional.end());
     }
 
+    warpgate::utils::trace::Scope packs_scope("load_packs");
     synthium::Manager manager(paths);
+    packs_scope.end();
     bool bulk_mode = parser.get<bool>("--bulk-mode");
     
     if(!manager.contains(input_filename) && !bulk_mode) {
@@ -167,6 +295,10 @@ int main(int argc, char* argv[]) {
         logger::info("Exporting by magic: {}", input_filename);
         std::span<uint8_t> magic_span((uint8_t*)magic.data(), magic.size());
         manager.export_by_magic(magic_span, output_filename);
+        if(metrics_path) {
+            warpgate::utils::metrics::write_json(*metrics_path);
+        }
+        warpgate::utils::trace::report(parser);
         logger::info("Done.");
         return 0;
     }
@@ -195,46 +327,64 @@ int main(int argc, char* argv[]) {
         }
         logger::info("Switched to bulk mode. Exporting {} files...", filenames.size());
     } else {
-        filenames.push_back(input_filename);
+        logger::info("{}", export_file(manager.get(input_filename), input_filename, output_filename, output_directory, raw, chunk_file, dds_to_png));
+        if(metrics_path) {
+            warpgate::utils::metrics::write_json(*metrics_path);
+        }
+        warpgate::utils::trace::report(parser);
+        return 0;
     }
 
-    std::vector<uint8_t> data;
-    std::unique_ptr<uint8_t[]> decompressed;
-    std::span<uint8_t> data_span;
-    std::filesystem::path output_name = output_filename;
-
-    for(std::string& filename : filenames) {
-        data = manager.get(filename)->get_data(raw);
-        data_span = std::span<uint8_t>(data.begin(), data.end());
-        if(chunk_file) {
-            warpgate::chunk::Chunk chunk(data);
-            logger::info("Decompressing chunk '{}' of size {} (Compressed size: {})", input_filename, synthium::utils::human_bytes(chunk.decompressed_size()), synthium::utils::human_bytes(chunk.compressed_size()));
-            decompressed = chunk.decompress();
-            data_span = std::span<uint8_t>(decompressed.get(), chunk.decompressed_size());
-        }
-        if(bulk_mode) {
-            output_name = output_directory / filename;
-        }
-        if(dds_to_png && output_name.extension() == std::filesystem::path(".dds")) {
-            std::optional<gli::texture2d> texture = warpgate::utils::textures::load_texture(filename, data);
-            if(!texture.has_value()) {
-                continue;
-            }
-            output_name.replace_extension(".png");
-            auto extent = texture->extent();
-            if(warpgate::utils::textures::write_texture(
-                std::span<uint32_t>(texture->data<uint32_t>(), texture->size<uint32_t>()),
-                output_name,
-                extent)
-            ){
-                logger::debug("Saved texture to {}", output_name.lexically_relative(output_directory).string());
+    uint32_t thread_count = std::max(1u, std::min(parser.get<uint32_t>("--threads"), (uint32_t)filenames.size()));
+    MemoryBudget budget((uint64_t)parser.get<uint32_t>("--max-memory") * 1024 * 1024);
+    logger::info("Using {} export thread{}", thread_count, thread_count == 1 ? "" : "s");
+
+    // Results are reported in list order as they become available, regardless of
+    // which worker finishes first.
+    std::vector<std::optional<std::string>> results(filenames.size());
+    std::mutex results_mutex;
+    size_t next_report = 0;
+    std::atomic_size_t next_file = 0;
+
+    std::vector<std::thread> workers;
+    for(uint32_t i = 0; i < thread_count; i++) {
+        workers.push_back(std::thread([&]() {
+            size_t index;
+            while((index = next_file++) < filenames.size()) {
+                std::string &filename = filenames[index];
+                std::string result;
+                if(!manager.contains(filename)) {
+                    result = fmt::format("{} not found in loaded assets", filename);
+                } else {
+                    std::shared_ptr<synthium::Asset2> asset = manager.get(filename);
+                    bool is_chunk = filename.find(".cnk") != std::string::npos;
+                    Reservation reservation{budget, asset->uncompressed_size()};
+                    budget.acquire(reservation.size);
+                    try {
+                        result = export_file(asset, filename, output_directory / filename, output_directory, raw, is_chunk, dds_to_png, &reservation);
+                    } catch(std::exception &err) {
+                        result = fmt::format("Failed to export {}: {}", filename, err.what());
+                    }
+                    budget.release(reservation.size);
+                }
+
+                std::lock_guard<std::mutex> lock(results_mutex);
+                results[index] = result;
+                while(next_report < results.size() && results[next_report]) {
+                    logger::info("[{}/{}] {}", next_report + 1, results.size(), *results[next_report]);
+                    results[next_report].reset();
+                    next_report++;
+                }
             }
-        } else {
-            std::ofstream output(output_name, std::ios::binary);
-            output.write((char*)data_span.data(), data_span.size());
-            output.close();
-        }
-        logger::info("Wrote {} to {}", synthium::utils::human_bytes(data_span.size()), output_name.string());
+        }));
+    }
+    for(uint32_t i = 0; i < workers.size(); i++) {
+        workers.at(i).join();
+    }
+    if(metrics_path) {
+        warpgate::utils::metrics::write_json(*metrics_path);
     }
+    warpgate::utils::trace::report(parser);
+    logger::info("Done.");
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,267 @@
+#include <atomic>
+#include <filesystem>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "argparse/argparse.hpp"
+#include "utils/fixtures.h"
+#include "utils/pack2.h"
+#include "version.h"
+
+#include <spdlog/spdlog.h>
+
+namespace logger = spdlog;
+using namespace warpgate;
+
+void build_argument_parser(argparse::ArgumentParser &parser, int &log_level) {
+    parser.add_description("Synthetic Forgelight asset generator for reproducible benchmarks");
+    parser.add_argument("output_directory");
+
+    parser.add_argument("--name", "-n")
+        .help("The continent name, used as the stem of the zone and chunk files")
+        .default_value(std::string("Synthetic"));
+
+    parser.add_argument("--chunks", "-c")
+        .help("The number of chunks along each side of the continent")
+        .default_value(4u)
+        .scan<'u', uint32_t>();
+
+    parser.add_argument("--quads")
+        .help("The number of terrain quads along each side of a chunk render batch (1-255)")
+        .default_value(64u)
+        .scan<'u', uint32_t>();
+
+    parser.add_argument("--texture-size")
+        .help("The width and height of every generated texture")
+        .default_value(64u)
+        .scan<'u', uint32_t>();
+
+    parser.add_argument("--objects", "-o")
+        .help("The number of distinct runtime objects in the zone, each with its own ADR and DME")
+        .default_value(100u)
+        .scan<'u', uint32_t>();
+
+    parser.add_argument("--instances", "-i")
+        .help("The number of instances of each runtime object")
+        .default_value(10u)
+        .scan<'u', uint32_t>();
+
+    parser.add_argument("--vertices")
+        .help("The number of vertices in each model")
+        .default_value(4096u)
+        .scan<'u', uint32_t>();
+
+    parser.add_argument("--bones")
+        .help("The number of bones in each model and animation")
+        .default_value(8u)
+        .scan<'u', uint32_t>();
+
+    parser.add_argument("--skinned")
+        .help("Generate skinned models instead of rigid ones")
+        .default_value(false)
+        .implicit_value(true)
+        .nargs(0);
+
+    parser.add_argument("--animations")
+        .help("The number of animations in the MRN file. 0 skips the MRN")
+        .default_value(8u)
+        .scan<'u', uint32_t>();
+
+    parser.add_argument("--samples")
+        .help("The number of samples in each animation")
+        .default_value(60u)
+        .scan<'u', uint32_t>();
+
+    parser.add_argument("--seed", "-s")
+        .help("The seed for the generated data. The same arguments and seed always produce the same files")
+        .default_value(0u)
+        .scan<'u', uint32_t>();
+
+    parser.add_argument("--threads", "-t")
+        .help("The number of files to generate in parallel")
+        .default_value(std::max(1u, std::thread::hardware_concurrency()))
+        .scan<'u', uint32_t>();
+
+    parser.add_argument("--verbose", "-v")
+        .help("Increase log level. May be specified multiple times")
+        .action([&](const auto &){
+            if(log_level > 0) {
+                log_level--;
+            }
+        })
+        .append()
+        .nargs(0)
+        .default_value(false)
+        .implicit_value(true);
+}
+
+int main(int argc, char* argv[]) {
+    argparse::ArgumentParser parser("generate_assets", WARPGATE_VERSION);
+    int log_level = logger::level::info;
+    build_argument_parser(parser, log_level);
+
+    try {
+        parser.parse_args(argc, argv);
+    } catch (const std::runtime_error& err) {
+        std::cerr << err.what() << std::endl;
+        std::cerr << parser;
+        std::exit(1);
+    }
+
+    logger::set_level(logger::level::level_enum(log_level));
+    logger::info("Using generate_assets {}", WARPGATE_VERSION);
+
+    std::filesystem::path output_directory(parser.get<std::string>("output_directory"));
+    try {
+        std::filesystem::create_directories(output_directory);
+    } catch (std::filesystem::filesystem_error& err) {
+        logger::error("Failed to create directory {}: {}", err.path1().string(), err.what());
+        std::exit(3);
+    }
+
+    std::string name = parser.get<std::string>("--name");
+    uint32_t chunks_per_side = std::max(1u, parser.get<uint32_t>("--chunks"));
+    uint32_t quads = parser.get<uint32_t>("--quads");
+    uint32_t texture_size = std::max(1u, parser.get<uint32_t>("--texture-size"));
+    uint32_t object_count = parser.get<uint32_t>("--objects");
+    uint32_t instance_count = parser.get<uint32_t>("--instances");
+    uint32_t vertex_count = parser.get<uint32_t>("--vertices");
+    uint32_t bone_count = parser.get<uint32_t>("--bones");
+    bool skinned = parser.get<bool>("--skinned");
+    uint32_t animation_count = parser.get<uint32_t>("--animations");
+    uint32_t sample_count = parser.get<uint32_t>("--samples");
+    uint32_t seed = parser.get<uint32_t>("--seed");
+
+    // Packs are named the way the converters find them in an assets directory:
+    // the zone and its chunks in the continent pack, models, textures and animations in the assets pack
+    utils::Pack2Writer continent_pack(output_directory / (name + "_x64_0.pack2"));
+    utils::Pack2Writer assets_pack(output_directory / "assets_x64_0.pack2");
+
+    // Jobs only generate their assets. They are added to the packs in job order whatever order
+    // the jobs finish in, so the packs are the same bytes for any thread count.
+    struct Asset {
+        utils::Pack2Writer *pack;
+        std::string name;
+        std::vector<uint8_t> data;
+    };
+    std::vector<std::function<std::vector<Asset>()>> jobs;
+    jobs.push_back([&]() {
+        // Version 3, since zone_converter does not export newer zones yet
+        std::vector<Asset> assets;
+        assets.push_back({&continent_pack, name + ".zone", utils::fixtures::zone(object_count, instance_count, chunks_per_side, seed, 3)});
+        return assets;
+    });
+
+    // Chunks are named by their first tile, matching the names zone_converter looks up
+    int32_t start = -(int32_t)(chunks_per_side * 2);
+    for(uint32_t x = 0; x < chunks_per_side; x++) {
+        for(uint32_t z = 0; z < chunks_per_side; z++) {
+            jobs.push_back([&, x, z]() {
+                uint32_t chunk_seed = seed + x * chunks_per_side + z;
+                std::string stem = name + "_" + std::to_string(start + (int32_t)x * 4) + "_" + std::to_string(start + (int32_t)z * 4);
+                std::vector<Asset> assets;
+                assets.push_back({&continent_pack, stem + ".cnk0", utils::fixtures::compress_chunk(utils::fixtures::cnk0(quads, chunk_seed))});
+                assets.push_back({&continent_pack, stem + ".cnk1", utils::fixtures::compress_chunk(utils::fixtures::cnk1(texture_size, chunk_seed))});
+                return assets;
+            });
+        }
+    }
+
+    std::string network = animation_count > 0 ? name + ".mrn" : "";
+    auto add_actor = [&](std::string actor, uint32_t actor_seed) {
+        jobs.push_back([&, actor, actor_seed]() {
+            std::string model = actor + "_LOD0.dme";
+            std::vector<Asset> assets;
+            assets.push_back({&assets_pack, actor + ".adr", utils::fixtures::adr(model, network)});
+            assets.push_back({&assets_pack, model, utils::fixtures::dme(vertex_count, skinned, bone_count, actor_seed)});
+            return assets;
+        });
+    };
+    for(uint32_t object = 0; object < object_count; object++) {
+        add_actor("fixture_object_" + std::to_string(object), seed + object);
+    }
+    for(uint32_t flora = 0; flora < utils::fixtures::zone_flora_count; flora++) {
+        add_actor("fixture_flora_" + std::to_string(flora), seed + object_count + flora);
+    }
+
+    // Every generated model shares one material and its textures
+    jobs.push_back([&]() {
+        constexpr const char *textures[] = {"fixture_C.dds", "fixture_N.dds", "fixture_S.dds"};
+        std::vector<Asset> assets;
+        for(uint32_t i = 0; i < std::size(textures); i++) {
+            assets.push_back({&assets_pack, textures[i], utils::fixtures::dds(texture_size, texture_size, seed + i)});
+        }
+        return assets;
+    });
+
+    if(animation_count > 0) {
+        jobs.push_back([&]() {
+            std::vector<Asset> assets;
+            assets.push_back({&assets_pack, network, utils::fixtures::mrn(animation_count, bone_count, sample_count, seed)});
+            return assets;
+        });
+    }
+
+    uint32_t thread_count = std::max(1u, std::min(parser.get<uint32_t>("--threads"), (uint32_t)jobs.size()));
+    logger::info("Generating {} chunks and {} models using {} thread{}",
+        chunks_per_side * chunks_per_side, object_count + utils::fixtures::zone_flora_count,
+        thread_count, thread_count == 1 ? "" : "s"
+    );
+    // Finished jobs wait here until every earlier job has been added to the packs
+    std::vector<std::optional<std::vector<Asset>>> results(jobs.size());
+    std::mutex results_mutex;
+    size_t next_add = 0, failures = 0;
+    std::atomic_size_t next_job = 0;
+    std::vector<std::thread> workers;
+    for(uint32_t i = 0; i < thread_count; i++) {
+        workers.push_back(std::thread([&]() {
+            size_t index;
+            while((index = next_job++) < jobs.size()) {
+                std::vector<Asset> assets;
+                bool generated = true;
+                try {
+                    assets = jobs[index]();
+                } catch(std::exception &err) {
+                    logger::error("Failed to generate job {}: {}", index, err.what());
+                    generated = false;
+                }
+
+                std::lock_guard<std::mutex> lock(results_mutex);
+                if(!generated) {
+                    failures++;
+                }
+                results[index] = std::move(assets);
+                while(next_add < results.size() && results[next_add]) {
+                    bool added = true;
+                    for(const Asset &asset : *results[next_add]) {
+                        added = asset.pack->add(asset.name, asset.data) && added;
+                    }
+                    if(!added) {
+                        failures++;
+                    }
+                    results[next_add].reset();
+                    next_add++;
+                }
+            }
+        }));
+    }
+    for(uint32_t i = 0; i < workers.size(); i++) {
+        workers.at(i).join();
+    }
+
+    if(failures > 0) {
+        logger::error("Failed to generate {} of {} jobs", failures, jobs.size());
+        return 4;
+    }
+    size_t asset_count = continent_pack.asset_count() + assets_pack.asset_count();
+    if(!continent_pack.close() || !assets_pack.close()) {
+        return 4;
+    }
+    logger::info("Generated {} ({} assets) into {}", name, asset_count, output_directory.string());
+    return 0;
+}
@@ -1,12 +1,16 @@
+#include <atomic>
 #include <fstream>
 #include <filesystem>
 #include <functional>
 #include <cmath>
 #include <memory>
+#include <optional>
 #include <regex>
+#include <span>
 #include <string>
 #include <thread>
-#include <unordered_set>
+#include <type_traits>
+#include <unordered_map>
 
 #define GLM_FORCE_XYZW_ONLY
 #include <glm/gtc/type_ptr.hpp>
@@ -15,6 +19,10 @@
 
 #include "argparse/argparse.hpp"
 #include "mrn_loader.h"
+#include "utils/keyframes.h"
+#include "utils/mapped_file.h"
+#include "utils/trace.h"
+#include "utils/trace_options.h"
 #include "tiny_gltf.h"
 #include "json.hpp"
 #include "version.h"
@@ -24,7 +32,8 @@ using namespace warpgate;
 
 void build_argument_parser(argparse::ArgumentParser &parser, int &log_level) {
     parser.add_description("C++ MRN to GLTF2 animation conversion tool");
-    parser.add_argument("input_file");
+    parser.add_argument("input_file")
+        .help("MRN name or path, or the path of an animation cache");
     parser.add_argument("--output-file", "-o");
     parser.add_argument("--skeleton", "-s")
         .help("Choose the skeleton to export")
@@ -48,6 +57,31 @@ void build_argument_parser(argparse::ArgumentParser &parser, int &log_level) {
         .default_value(false)
         .implicit_value(true)
         .nargs(0);
+    parser.add_argument("--reduce", "-r")
+        .help("Drop keyframes that can be interpolated within the given tolerances, and collapse constant tracks")
+        .default_value(false)
+        .implicit_value(true)
+        .nargs(0);
+    parser.add_argument("--translation-tolerance")
+        .help("Maximum translation error allowed by --reduce")
+        .default_value(0.0005f)
+        .scan<'g', float>();
+    parser.add_argument("--rotation-tolerance")
+        .help("Maximum rotation error in degrees allowed by --reduce")
+        .default_value(0.1f)
+        .scan<'g', float>();
+    parser.add_argument("--cubic-spline", "-c")
+        .help("Write reduced tracks as CUBICSPLINE samplers, keeping the keys the spline needs to stay within the tolerances. Implies --reduce")
+        .default_value(false)
+        .implicit_value(true)
+        .nargs(0);
+    parser.add_argument("--write-cache")
+        .help("Write an animation cache of the whole MRN to the given path. Caches can be passed as the input file in place of an MRN, and are copied to the given path as is");
+    parser.add_argument("--threads", "-t")
+        .help("The number of threads to use for building animations")
+        .default_value(std::max(1u, std::thread::hardware_concurrency()))
+        .scan<'u', uint32_t>();
+    utils::trace::add_arguments(parser);
     parser.add_argument("--verbose", "-v")
         .help("Increase log level. May be specified multiple times")
         .action([&](const auto &){ 
@@ -67,7 +101,7 @@ void build_argument_parser(argparse::ArgumentParser &parser, int &log_level) {
 #else
         .default_value(std::string("/mnt/c/Users/Public/Daybreak Game Company/Installed Games/Planetside 2 Test/Resources/Assets/"));
 #endif   
-    // parser.add_argument("--rigify", "-r")
+    // parser.add_argument("--rigify")
     //     .help("Export bones named to match bones generated by Rigify (for humanoid rigs)")
     //     .default_value(false)
     //     .implicit_value(true)
@@ -154,165 +188,165 @@ void add_skeleton_to_gltf(tinygltf::Model &gltf, std::shared_ptr<mrn::Skeleton>
     gltf.buffers.push_back(matrices);
 }
 
-void add_animation_to_gltf(tinygltf::Model &gltf, std::shared_ptr<mrn::SkeletonData> skeleton, std::shared_ptr<mrn::NSAFile> animation, std::string name) {
-    tinygltf::Animation gltf_animation;
-    gltf_animation.name = name;
-    
-    size_t offset = 0;
-    uint32_t bone_offset = skeleton->bone_count() - animation->bone_count();
-    std::vector<float> sample_times;
-    uint32_t sample_count = 1;
-    if(animation->root_segment() == nullptr && animation->dynamic_segment() != nullptr) {
-        sample_count = animation->dynamic_segment()->sample_count();
-    } else if(animation->root_segment() != nullptr) {
-        sample_count = animation->root_segment()->sample_count();
-    } else {
-        // Leave samples at 1 I guess
-        logger::warn("Neither dynamic nor root segments found, guessing sample count of 1");
-    }
-    for(uint32_t i = 0; i < sample_count; i++) {
-        sample_times.push_back(((float)i) / animation->sample_rate());
-    }
+struct ReductionOptions {
+    bool enabled = false;
+    float translation_tolerance = 0.0005f;
+    // Radians
+    float rotation_tolerance = glm::radians(0.1f);
+    bool cubic_spline = false;
+};
+
+/**
+ * The buffers an animation is built into. Sample times are kept apart from the rest of the
+ * data so that identical time accessors can be shared between animations when merging.
+ */
+struct AnimationBuffers {
+    tinygltf::Buffer data, times;
+    int data_index, times_index;
+};
+
+// Appends `size` bytes to the buffer behind a new buffer view
+int add_animation_buffer_view(tinygltf::Model &gltf, tinygltf::Buffer &buffer, int buffer_index, const void *data, size_t size) {
+    tinygltf::BufferView bufferView;
+    bufferView.buffer = buffer_index;
+    bufferView.byteOffset = buffer.data.size();
+    bufferView.byteLength = size;
 
-    animation->dequantize();
+    gltf.bufferViews.push_back(bufferView);
 
-    tinygltf::Buffer animation_buffer;
-    animation_buffer.uri = name + ".bin";
-    animation_buffer.data.insert(
-        animation_buffer.data.end(),
-        (uint8_t*)sample_times.data(),
-        (uint8_t*)sample_times.data() + sizeof(float) * sample_times.size()
+    buffer.data.insert(
+        buffer.data.end(),
+        (const uint8_t*)data,
+        (const uint8_t*)data + size
     );
+    return gltf.bufferViews.size() - 1;
+}
 
-    int time_accessor = gltf.accessors.size();
+// Appends `count` elements to the buffer behind a new buffer view and float accessor
+int add_animation_accessor(tinygltf::Model &gltf, tinygltf::Buffer &buffer, int buffer_index, const void *data, size_t count, size_t element_size, int type) {
     tinygltf::Accessor accessor;
-    accessor.bufferView = gltf.bufferViews.size();
+    accessor.bufferView = add_animation_buffer_view(gltf, buffer, buffer_index, data, element_size * count);
     accessor.componentType = TINYGLTF_COMPONENT_TYPE_FLOAT;
-    accessor.count = sample_times.size();
-    accessor.type = TINYGLTF_TYPE_SCALAR;
-    accessor.minValues = {sample_times[0]};
-    accessor.maxValues = {sample_times[sample_times.size() - 1]};
+    accessor.count = count;
+    accessor.type = type;
 
     gltf.accessors.push_back(accessor);
+    return gltf.accessors.size() - 1;
+}
 
-    tinygltf::BufferView bufferView;
-    bufferView.buffer = gltf.buffers.size();
-    bufferView.byteOffset = offset;
-    bufferView.byteLength = sizeof(float) * sample_times.size();
-
-    gltf.bufferViews.push_back(bufferView);
+int add_time_accessor(tinygltf::Model &gltf, AnimationBuffers &buffers, std::span<const float> times) {
+    int accessor = add_animation_accessor(gltf, buffers.times, buffers.times_index, times.data(), times.size(), sizeof(float), TINYGLTF_TYPE_SCALAR);
+    gltf.accessors[accessor].minValues = {times.front()};
+    gltf.accessors[accessor].maxValues = {times.back()};
+    return accessor;
+}
 
-    offset += sizeof(float) * sample_times.size();
+// Adds a sampler for one sampled track, reducing its keyframes first if requested. Returns the sampler index.
+template <typename T>
+int add_track_sampler(
+    tinygltf::Model &gltf, 
+    tinygltf::Animation &gltf_animation, 
+    AnimationBuffers &buffers, 
+    std::span<const T> samples, 
+    float sample_rate, 
+    int time_accessor, 
+    int static_time_accessor, 
+    const ReductionOptions &reduction
+) {
+    constexpr int type = std::is_same_v<T, glm::quat> ? TINYGLTF_TYPE_VEC4 : TINYGLTF_TYPE_VEC3;
+    float tolerance = std::is_same_v<T, glm::quat> ? reduction.rotation_tolerance : reduction.translation_tolerance;
+
+    tinygltf::AnimationSampler sampler;
+    if(!reduction.enabled) {
+        sampler.input = time_accessor;
+        sampler.output = add_animation_accessor(gltf, buffers.data, buffers.data_index, samples.data(), samples.size(), sizeof(T), type);
+    } else if(utils::keyframes::is_constant(samples, tolerance)) {
+        sampler.input = static_time_accessor;
+        sampler.output = add_animation_accessor(gltf, buffers.data, buffers.data_index, samples.data(), 1, sizeof(T), type);
+    } else {
+        std::vector<uint32_t> keys = reduction.cubic_spline
+            ? utils::keyframes::reduce_cubic_spline(samples, tolerance, sample_rate)
+            : utils::keyframes::reduce(samples, tolerance);
+        if(keys.size() == samples.size()) {
+            sampler.input = time_accessor;
+        } else {
+            std::vector<float> key_times;
+            key_times.reserve(keys.size());
+            for(uint32_t key : keys) {
+                key_times.push_back(((float)key) / sample_rate);
+            }
+            sampler.input = add_time_accessor(gltf, buffers, key_times);
+        }
 
-    std::vector<float> static_sample_time = {0.0f};
-    animation_buffer.data.insert(
-        animation_buffer.data.end(),
-        (uint8_t*)static_sample_time.data(),
-        (uint8_t*)static_sample_time.data() + sizeof(float) * static_sample_time.size()
-    );
+        std::vector<T> values;
+        if(reduction.cubic_spline) {
+            values = utils::keyframes::cubic_spline(samples, keys, sample_rate);
+            sampler.interpolation = "CUBICSPLINE";
+        } else {
+            values.reserve(keys.size());
+            for(uint32_t key : keys) {
+                values.push_back(samples[key]);
+            }
+            if constexpr(std::is_same_v<T, glm::quat>) {
+                utils::keyframes::align_hemispheres(values);
+            }
+        }
+        sampler.output = add_animation_accessor(gltf, buffers.data, buffers.data_index, values.data(), values.size(), sizeof(T), type);
+    }
 
-    int static_time_accessor = gltf.accessors.size();
-    accessor.bufferView = gltf.bufferViews.size();
-    accessor.componentType = TINYGLTF_COMPONENT_TYPE_FLOAT;
-    accessor.count = static_sample_time.size();
-    accessor.type = TINYGLTF_TYPE_SCALAR;
-    accessor.minValues = {static_sample_time[0]};
-    accessor.maxValues = {static_sample_time[static_sample_time.size() - 1]};
+    gltf_animation.samplers.push_back(sampler);
+    return gltf_animation.samplers.size() - 1;
+}
 
-    gltf.accessors.push_back(accessor);
+void add_animation_to_gltf(tinygltf::Model &gltf, uint32_t skeleton_bone_count, const mrn::AnimationTracks &animation, std::string name, const ReductionOptions &reduction = {}) {
+    tinygltf::Animation gltf_animation;
+    gltf_animation.name = name;
+    
+    uint32_t bone_offset = skeleton_bone_count - animation.bone_count;
+    std::vector<float> sample_times;
+    for(uint32_t i = 0; i < animation.sample_count; i++) {
+        sample_times.push_back(((float)i) / animation.sample_rate);
+    }
 
-    bufferView.buffer = gltf.buffers.size();
-    bufferView.byteOffset = offset;
-    bufferView.byteLength = sizeof(float) * static_sample_time.size();
+    AnimationBuffers buffers;
+    buffers.data.uri = name + ".bin";
+    buffers.data_index = gltf.buffers.size();
+    buffers.times_index = buffers.data_index + 1;
 
-    gltf.bufferViews.push_back(bufferView);
+    int time_accessor = add_time_accessor(gltf, buffers, sample_times);
 
-    offset += sizeof(float) * static_sample_time.size();
+    std::vector<float> static_sample_time = {0.0f};
+    int static_time_accessor = add_time_accessor(gltf, buffers, static_sample_time);
 
-    std::vector<glm::vec3> root_translation = animation->root_translation();
+    float sample_rate = animation.sample_rate;
+    std::span<const glm::vec3> root_translation = animation.root_translation;
     if(root_translation.size() != 0) {
         tinygltf::AnimationChannel channel;
         channel.extras_json_string = "{'name': '" + name + " root_translation'}";
-        channel.sampler = gltf_animation.samplers.size();
+        channel.sampler = add_track_sampler(gltf, gltf_animation, buffers, root_translation, sample_rate, time_accessor, static_time_accessor, reduction);
         channel.target_node = 0;
         channel.target_path = "translation";
 
         gltf_animation.channels.push_back(channel);
-
-        int data_accessor = gltf.accessors.size();
-        
-        accessor.bufferView = gltf.bufferViews.size();
-        accessor.type = TINYGLTF_TYPE_VEC3;
-        accessor.count = root_translation.size();
-        accessor.minValues = {};
-        accessor.maxValues = {};
-
-        gltf.accessors.push_back(accessor);
-
-        bufferView.byteOffset = offset;
-        bufferView.byteLength = sizeof(glm::vec3) * root_translation.size();
-
-        gltf.bufferViews.push_back(bufferView);
-
-        animation_buffer.data.insert(
-            animation_buffer.data.end(), 
-            (uint8_t*)root_translation.data(), 
-            (uint8_t*)root_translation.data() + sizeof(glm::vec3) * root_translation.size()
-        );
-
-        offset += sizeof(glm::vec3) * root_translation.size();
-
-        tinygltf::AnimationSampler sampler;
-        sampler.input = time_accessor;
-        sampler.output = data_accessor;
-
-        gltf_animation.samplers.push_back(sampler);
     }
 
-    std::vector<glm::quat> root_rotation = animation->root_rotation();
+    std::span<const glm::quat> root_rotation = animation.root_rotation;
     if(root_rotation.size() != 0) {
         tinygltf::AnimationChannel channel;
         channel.extras_json_string = "{'name': '" + name + " root_rotation'}";
-        channel.sampler = gltf_animation.samplers.size();
+        channel.sampler = add_track_sampler(gltf, gltf_animation, buffers, root_rotation, sample_rate, time_accessor, static_time_accessor, reduction);
         channel.target_node = 0;
         channel.target_path = "rotation";
 
         gltf_animation.channels.push_back(channel);
-
-        int data_accessor = gltf.accessors.size();
-        
-        accessor.bufferView = gltf.bufferViews.size();
-        accessor.type = TINYGLTF_TYPE_VEC4;
-        accessor.count = root_rotation.size();
-        accessor.minValues = {};
-        accessor.maxValues = {};
-
-        gltf.accessors.push_back(accessor);
-
-        bufferView.byteOffset = offset;
-        bufferView.byteLength = sizeof(glm::quat) * root_rotation.size();
-
-        gltf.bufferViews.push_back(bufferView);
-
-        animation_buffer.data.insert(
-            animation_buffer.data.end(), 
-            (uint8_t*)root_rotation.data(), 
-            (uint8_t*)root_rotation.data() + sizeof(glm::quat) * root_rotation.size()
-        );
-
-        offset += sizeof(glm::quat) * root_rotation.size();
-
-        tinygltf::AnimationSampler sampler;
-        sampler.input = time_accessor;
-        sampler.output = data_accessor;
-
-        gltf_animation.samplers.push_back(sampler);
     }
 
-    std::vector<glm::vec3> static_translation = animation->static_translation();
+    std::span<const glm::vec3> static_translation = animation.static_translation;
     if(static_translation.size() != 0) {
-        for(uint32_t i = 0; i < animation->static_translation_bone_indices().size(); i++) {
-            uint32_t bone = animation->static_translation_bone_indices()[i];
+        // All static translations share one buffer view, with an accessor per bone
+        int static_translation_view = add_animation_buffer_view(gltf, buffers.data, buffers.data_index, static_translation.data(), sizeof(glm::vec3) * static_translation.size());
+        for(uint32_t i = 0; i < animation.static_translation_bone_indices.size(); i++) {
+            uint32_t bone = animation.static_translation_bone_indices[i];
             tinygltf::AnimationChannel channel;
             channel.extras_json_string = "{'name': '" + name + " static_translation'}";
             channel.sampler = gltf_animation.samplers.size();
@@ -320,42 +354,30 @@ void add_animation_to_gltf(tinygltf::Model &gltf, std::shared_ptr<mrn::SkeletonD
             channel.target_path = "translation";
 
             gltf_animation.channels.push_back(channel);
-           
-            int data_accessor = gltf.accessors.size();
-            
-            accessor.bufferView = gltf.bufferViews.size();
-            accessor.type = TINYGLTF_TYPE_VEC3;
+
+            tinygltf::Accessor accessor;
+            accessor.bufferView = static_translation_view;
+            accessor.byteOffset = sizeof(glm::vec3) * i;
+            accessor.componentType = TINYGLTF_COMPONENT_TYPE_FLOAT;
             accessor.count = 1;
-            accessor.minValues = {};
-            accessor.maxValues = {};
+            accessor.type = TINYGLTF_TYPE_VEC3;
 
             gltf.accessors.push_back(accessor);
 
-            bufferView.byteOffset = offset;
-            bufferView.byteLength = sizeof(glm::vec3);
-
-            gltf.bufferViews.push_back(bufferView);
-
-            animation_buffer.data.insert(
-                animation_buffer.data.end(), 
-                (uint8_t*)glm::value_ptr(static_translation[i]), 
-                (uint8_t*)glm::value_ptr(static_translation[i]) + sizeof(glm::vec3)
-            );
-
-            offset += sizeof(glm::vec3);
-
             tinygltf::AnimationSampler sampler;
             sampler.input = static_time_accessor;
-            sampler.output = data_accessor;
+            sampler.output = gltf.accessors.size() - 1;
 
             gltf_animation.samplers.push_back(sampler);
         }
     }
 
-    std::vector<glm::quat> static_rotation = animation->static_rotation();
+    std::span<const glm::quat> static_rotation = animation.static_rotation;
     if(static_rotation.size() != 0) {
-        for(uint32_t i = 0; i < animation->static_rotation_bone_indices().size(); i++) {
-            uint32_t bone = animation->static_rotation_bone_indices()[i];
+        // All static rotations share one buffer view, with an accessor per bone
+        int static_rotation_view = add_animation_buffer_view(gltf, buffers.data, buffers.data_index, static_rotation.data(), sizeof(glm::quat) * static_rotation.size());
+        for(uint32_t i = 0; i < animation.static_rotation_bone_indices.size(); i++) {
+            uint32_t bone = animation.static_rotation_bone_indices[i];
             tinygltf::AnimationChannel channel;
             channel.extras_json_string = "{'name': '" + name + " static_rotation'}";
             channel.sampler = gltf_animation.samplers.size();
@@ -363,136 +385,156 @@ void add_animation_to_gltf(tinygltf::Model &gltf, std::shared_ptr<mrn::SkeletonD
             channel.target_path = "rotation";
 
             gltf_animation.channels.push_back(channel);
-           
-            int data_accessor = gltf.accessors.size();
-            
-            accessor.bufferView = gltf.bufferViews.size();
-            accessor.type = TINYGLTF_TYPE_VEC4;
+
+            tinygltf::Accessor accessor;
+            accessor.bufferView = static_rotation_view;
+            accessor.byteOffset = sizeof(glm::quat) * i;
+            accessor.componentType = TINYGLTF_COMPONENT_TYPE_FLOAT;
             accessor.count = 1;
-            accessor.minValues = {};
-            accessor.maxValues = {};
+            accessor.type = TINYGLTF_TYPE_VEC4;
 
             gltf.accessors.push_back(accessor);
 
-            bufferView.byteOffset = offset;
-            bufferView.byteLength = sizeof(glm::quat);
-
-            gltf.bufferViews.push_back(bufferView);
-
-            animation_buffer.data.insert(
-                animation_buffer.data.end(), 
-                (uint8_t*)glm::value_ptr(static_rotation[i]), 
-                (uint8_t*)glm::value_ptr(static_rotation[i]) + sizeof(glm::quat)
-            );
-
-            offset += sizeof(glm::quat);
-
             tinygltf::AnimationSampler sampler;
             sampler.input = static_time_accessor;
-            sampler.output = data_accessor;
+            sampler.output = gltf.accessors.size() - 1;
 
             gltf_animation.samplers.push_back(sampler);
         }
     }
 
-    std::vector<std::vector<glm::vec3>> dynamic_translation_samples = animation->dynamic_translation();
-    if(dynamic_translation_samples.size() != 0) {
-        for(uint32_t i = 0; i < animation->dynamic_translation_bone_indices().size(); i++) {
-            uint32_t bone = animation->dynamic_translation_bone_indices()[i];
+    if(animation.dynamic_translation.size() != 0) {
+        for(uint32_t i = 0; i < animation.dynamic_translation_bone_indices.size(); i++) {
+            uint32_t bone = animation.dynamic_translation_bone_indices[i];
             tinygltf::AnimationChannel channel;
             channel.extras_json_string = "{'name': '" + name + " dynamic_translation'}";
-            channel.sampler = gltf_animation.samplers.size();
+            channel.sampler = add_track_sampler(gltf, gltf_animation, buffers, animation.dynamic_translation_track(i), sample_rate, time_accessor, static_time_accessor, reduction);
             channel.target_node = bone + bone_offset;
             channel.target_path = "translation";
 
             gltf_animation.channels.push_back(channel);
-
-            std::vector<glm::vec3> dynamic_translation;
-            for(uint32_t sample = 0; sample < dynamic_translation_samples.size(); sample++) {
-                dynamic_translation.push_back(dynamic_translation_samples[sample][i]);
-            }
-
-            int data_accessor = gltf.accessors.size();
-            
-            accessor.bufferView = gltf.bufferViews.size();
-            accessor.type = TINYGLTF_TYPE_VEC3;
-            accessor.count = dynamic_translation.size();
-            accessor.minValues = {};
-            accessor.maxValues = {};
-
-            gltf.accessors.push_back(accessor);
-
-            bufferView.byteOffset = offset;
-            bufferView.byteLength = sizeof(glm::vec3) * dynamic_translation.size();
-
-            gltf.bufferViews.push_back(bufferView);
-
-            animation_buffer.data.insert(
-                animation_buffer.data.end(), 
-                (uint8_t*)dynamic_translation.data(), 
-                (uint8_t*)dynamic_translation.data() + sizeof(glm::vec3) * dynamic_translation.size()
-            );
-
-            offset += sizeof(glm::vec3) * dynamic_translation.size();
-
-            tinygltf::AnimationSampler sampler;
-            sampler.input = time_accessor;
-            sampler.output = data_accessor;
-
-            gltf_animation.samplers.push_back(sampler);
         }
     }
 
-    std::vector<std::vector<glm::quat>> dynamic_rotation_samples = animation->dynamic_rotation();
-    if(dynamic_rotation_samples.size() != 0) {
-        for(uint32_t i = 0; i < animation->dynamic_rotation_bone_indices().size(); i++) {
-            uint32_t bone = animation->dynamic_rotation_bone_indices()[i];
+    if(animation.dynamic_rotation.size() != 0) {
+        for(uint32_t i = 0; i < animation.dynamic_rotation_bone_indices.size(); i++) {
+            uint32_t bone = animation.dynamic_rotation_bone_indices[i];
             tinygltf::AnimationChannel channel;
             channel.extras_json_string = "{'name': '" + name + " dynamic_rotation'}";
-            channel.sampler = gltf_animation.samplers.size();
+            channel.sampler = add_track_sampler(gltf, gltf_animation, buffers, animation.dynamic_rotation_track(i), sample_rate, time_accessor, static_time_accessor, reduction);
             channel.target_node = bone + bone_offset;
             channel.target_path = "rotation";
 
             gltf_animation.channels.push_back(channel);
+        }
+    }
 
-            std::vector<glm::quat> dynamic_rotation;
-            for(uint32_t sample = 0; sample < dynamic_rotation_samples.size(); sample++) {
-                dynamic_rotation.push_back(dynamic_rotation_samples[sample][i]);
-            }
+    gltf.animations.push_back(gltf_animation);
+    gltf.buffers.push_back(buffers.data);
+    gltf.buffers.push_back(buffers.times);
+}
 
-            int data_accessor = gltf.accessors.size();
-            
-            accessor.bufferView = gltf.bufferViews.size();
-            accessor.type = TINYGLTF_TYPE_VEC4;
-            accessor.count = dynamic_rotation.size();
-            accessor.minValues = {};
-            accessor.maxValues = {};
+// Shares identical sampler input (time) accessors between all the animations merged into a model
+class TimeAccessorPool {
+public:
+    TimeAccessorPool(std::string uri) : m_uri(uri) {}
+
+    // Returns the pooled accessor holding `times`, adding it described by `source` if it is new
+    int intern(tinygltf::Model &gltf, std::span<const uint8_t> times, const tinygltf::Accessor &source) {
+        std::string key((const char*)times.data(), times.size());
+        auto it = m_accessors.find(key);
+        if(it != m_accessors.end()) {
+            return it->second;
+        }
 
-            gltf.accessors.push_back(accessor);
+        if(m_buffer_index == -1) {
+            m_buffer_index = gltf.buffers.size();
+            tinygltf::Buffer buffer;
+            buffer.uri = m_uri;
+            gltf.buffers.push_back(buffer);
+        }
 
-            bufferView.byteOffset = offset;
-            bufferView.byteLength = sizeof(glm::quat) * dynamic_rotation.size();
+        tinygltf::Accessor accessor = source;
+        accessor.bufferView = add_animation_buffer_view(gltf, gltf.buffers[m_buffer_index], m_buffer_index, times.data(), times.size());
+        accessor.byteOffset = 0;
+        gltf.accessors.push_back(accessor);
 
-            gltf.bufferViews.push_back(bufferView);
+        int accessor_index = gltf.accessors.size() - 1;
+        m_accessors[key] = accessor_index;
+        return accessor_index;
+    }
 
-            animation_buffer.data.insert(
-                animation_buffer.data.end(), 
-                (uint8_t*)dynamic_rotation.data(), 
-                (uint8_t*)dynamic_rotation.data() + sizeof(glm::quat) * dynamic_rotation.size()
+private:
+    std::string m_uri;
+    int m_buffer_index = -1;
+    std::unordered_map<std::string, int> m_accessors;
+};
+
+/**
+ * Appends an animation built into its own model by add_animation_to_gltf, offsetting its accessor,
+ * buffer view and buffer indices. Its sample times are interned in `times` rather than copied.
+ */
+void merge_animation(tinygltf::Model &gltf, tinygltf::Model &&part, TimeAccessorPool &times) {
+    // add_animation_to_gltf writes the sample times to the part's last buffer
+    int times_buffer = (int)part.buffers.size() - 1;
+    std::vector<int> accessor_map(part.accessors.size(), -1), buffer_view_map(part.bufferViews.size(), -1);
+
+    for(size_t i = 0; i < part.accessors.size(); i++) {
+        const tinygltf::Accessor &accessor = part.accessors[i];
+        const tinygltf::BufferView &bufferView = part.bufferViews[accessor.bufferView];
+        if(bufferView.buffer == times_buffer) {
+            std::span<const uint8_t> data(
+                part.buffers[times_buffer].data.data() + bufferView.byteOffset + accessor.byteOffset, 
+                sizeof(float) * accessor.count
             );
+            accessor_map[i] = times.intern(gltf, data, accessor);
+        }
+    }
 
-            offset += sizeof(glm::quat) * dynamic_rotation.size();
+    // The pool may have added its buffer above, so the offset is taken afterwards
+    int buffer_offset = (int)gltf.buffers.size();
+    for(size_t i = 0; i < part.bufferViews.size(); i++) {
+        tinygltf::BufferView &bufferView = part.bufferViews[i];
+        if(bufferView.buffer == times_buffer) {
+            continue;
+        }
+        bufferView.buffer += buffer_offset;
+        buffer_view_map[i] = gltf.bufferViews.size();
+        gltf.bufferViews.push_back(std::move(bufferView));
+    }
 
-            tinygltf::AnimationSampler sampler;
-            sampler.input = time_accessor;
-            sampler.output = data_accessor;
+    for(size_t i = 0; i < part.accessors.size(); i++) {
+        if(accessor_map[i] != -1) {
+            continue;
+        }
+        tinygltf::Accessor &accessor = part.accessors[i];
+        accessor.bufferView = buffer_view_map[accessor.bufferView];
+        accessor_map[i] = gltf.accessors.size();
+        gltf.accessors.push_back(std::move(accessor));
+    }
 
-            gltf_animation.samplers.push_back(sampler);
+    for(tinygltf::Animation &animation : part.animations) {
+        for(tinygltf::AnimationSampler &sampler : animation.samplers) {
+            sampler.input = accessor_map[sampler.input];
+            sampler.output = accessor_map[sampler.output];
         }
+        gltf.animations.push_back(std::move(animation));
     }
 
-    gltf.animations.push_back(gltf_animation);
-    gltf.buffers.push_back(animation_buffer);
+    for(int i = 0; i < times_buffer; i++) {
+        gltf.buffers.push_back(std::move(part.buffers[i]));
+    }
+}
+
+void write_animation_cache(std::filesystem::path cache_filename, std::span<const uint8_t> cache_data) {
+    std::ofstream cache_output(cache_filename, std::ios::binary);
+    if(cache_output.fail()) {
+        logger::error("Failed to open file '{}'", cache_filename.string());
+        std::exit(2);
+    }
+    cache_output.write((const char*)cache_data.data(), cache_data.size());
+    cache_output.close();
+    logger::info("Wrote animation cache.");
 }
 
 int main(int argc, const char* argv[]) {
@@ -509,61 +551,87 @@ int main(int argc, const char* argv[]) {
         std::exit(1);
     }
     logger::set_level(logger::level::level_enum(log_level));
+    utils::trace::start(parser);
 
     std::string input_str = parser.get<std::string>("input_file");
     
     logger::info("Converting file {} using mrn_converter {}", input_str, WARPGATE_VERSION);
-    std::string path = parser.get<std::string>("--assets-directory");
-    std::filesystem::path server(path);
-    std::vector<std::filesystem::path> assets;
-    for(int i = 0; i < 24; i++) {
-        assets.push_back(server / ("assets_x64_" + std::to_string(i) + ".pack2"));
+    std::filesystem::path input_filename(input_str);
+    std::unique_ptr<utils::MappedFile> cache_file;
+    std::unique_ptr<mrn::AnimationCache> cache;
+    if(std::filesystem::is_regular_file(input_filename)) {
+        utils::trace::Scope cache_scope("cache::load");
+        try {
+            cache_file = std::make_unique<utils::MappedFile>(input_filename);
+            if(mrn::AnimationCache::is_cache(cache_file->data())) {
+                logger::debug("Loading animation cache '{}'...", input_str);
+                cache = std::make_unique<mrn::AnimationCache>(cache_file->data());
+                logger::debug("Loaded animation cache '{}'.", input_str);
+            } else {
+                cache_file.reset();
+            }
+        } catch(std::exception &err) {
+            logger::error("Failed to load '{}': {}", input_str, err.what());
+            std::exit(2);
+        }
     }
-    
-    logger::info("Loading packs...");
-    synthium::Manager manager(assets);
-    logger::info("Manager loaded.");
 
-    std::filesystem::path input_filename(input_str);
+    // Caches are self contained, so the packs are only needed for MRNs
     std::unique_ptr<uint8_t[]> data;
     std::vector<uint8_t> data_vector;
     std::span<uint8_t> data_span;
-    if(manager.contains(input_str)) {
-        logger::debug("Loading '{}' from manager...", input_str);
-        int retries = 3;
-        std::shared_ptr<synthium::Asset2> asset = manager.get(input_str);
-        //manager.deallocate(asset->uncompressed_size());
-        while(data_vector.size() == 0 && retries > 0) {
-            try {
-                data_vector = asset->get_data();
-                data_span = std::span<uint8_t>(data_vector.data(), data_vector.size());
-                logger::debug("Loaded '{}' from manager.", input_str);
-            } catch(std::bad_alloc) {
-                logger::warn("Failed to load asset, deallocating some packs");
-                manager.deallocate(asset->uncompressed_size());
-            } catch(std::exception &err) {
-                logger::error("Failed to load '{}' from manager: {}", input_str, err.what());
-                std::exit(1);
-            }
-            retries--;
+    if(cache == nullptr) {
+        std::string path = parser.get<std::string>("--assets-directory");
+        std::filesystem::path server(path);
+        std::vector<std::filesystem::path> assets;
+        for(int i = 0; i < 24; i++) {
+            assets.push_back(server / ("assets_x64_" + std::to_string(i) + ".pack2"));
         }
-    } else {
-        logger::debug("Loading '{}' from filesystem...", input_str);
-        std::ifstream input(input_filename, std::ios::binary | std::ios::ate);
-        if(input.fail()) {
-            logger::error("Failed to open file '{}'", input_filename.string());
-            std::exit(2);
+
+        logger::info("Loading packs...");
+        utils::trace::Scope packs_scope("load_packs");
+        synthium::Manager manager(assets);
+        packs_scope.end();
+        logger::info("Manager loaded.");
+
+        utils::trace::Scope load_scope("load_asset");
+
+        if(manager.contains(input_str)) {
+            logger::debug("Loading '{}' from manager...", input_str);
+            int retries = 3;
+            std::shared_ptr<synthium::Asset2> asset = manager.get(input_str);
+            //manager.deallocate(asset->uncompressed_size());
+            while(data_vector.size() == 0 && retries > 0) {
+                try {
+                    data_vector = asset->get_data();
+                    data_span = std::span<uint8_t>(data_vector.data(), data_vector.size());
+                    logger::debug("Loaded '{}' from manager.", input_str);
+                } catch(std::bad_alloc) {
+                    logger::warn("Failed to load asset, deallocating some packs");
+                    manager.deallocate(asset->uncompressed_size());
+                } catch(std::exception &err) {
+                    logger::error("Failed to load '{}' from manager: {}", input_str, err.what());
+                    std::exit(1);
+                }
+                retries--;
+            }
+        } else {
+            logger::debug("Loading '{}' from filesystem...", input_str);
+            std::ifstream input(input_filename, std::ios::binary | std::ios::ate);
+            if(input.fail()) {
+                logger::error("Failed to open file '{}'", input_filename.string());
+                std::exit(2);
+            }
+            size_t length = input.tellg();
+            input.seekg(0);
+            data = std::make_unique<uint8_t[]>(length);
+            input.read((char*)data.get(), length);
+            input.close();
+            data_span = std::span<uint8_t>(data.get(), length);
+            logger::debug("Loaded '{}' from filesystem.", input_str);
         }
-        size_t length = input.tellg();
-        input.seekg(0);
-        data = std::make_unique<uint8_t[]>(length);
-        input.read((char*)data.get(), length);
-        input.close();
-        data_span = std::span<uint8_t>(data.get(), length);
-        logger::debug("Loaded '{}' from filesystem.", input_str);
     }
 
-
     std::filesystem::path output_filename, output_directory;
     std::string format = "";
     if(parser.is_used("--output-file")) {
@@ -586,15 +654,52 @@ int main(int argc, const char* argv[]) {
         format = parser.get<std::string>("--format");
     }
 
-    bool rigify_skeleton = parser.get<bool>("--rigify");
     bool uppercase_name = !parser.get<bool>("--lowercase-bones");
     std::string skeleton_name = parser.get<std::string>("--skeleton");
 
-    logger::info("Parsing MRN...");
-    mrn::MRN mrn(data_span, input_filename.filename().string());
-    logger::info("Parsed MRN.");
+    ReductionOptions reduction;
+    reduction.cubic_spline = parser.get<bool>("--cubic-spline");
+    reduction.enabled = parser.get<bool>("--reduce") || reduction.cubic_spline;
+    reduction.translation_tolerance = parser.get<float>("--translation-tolerance");
+    reduction.rotation_tolerance = glm::radians(parser.get<float>("--rotation-tolerance"));
+
+    mrn::MRN mrn;
+    std::vector<std::string> skeleton_names, animation_names;
+    if(cache != nullptr) {
+        if(parser.is_used("--write-cache")) {
+            // The input is already a cache, so it is copied as is
+            std::filesystem::path cache_filename = parser.get<std::string>("--write-cache");
+            std::error_code err;
+            if(std::filesystem::equivalent(cache_filename, input_filename, err)) {
+                logger::info("'{}' is already the animation cache", cache_filename.string());
+            } else {
+                logger::info("Writing animation cache {}...", cache_filename.string());
+                write_animation_cache(cache_filename, cache_file->data());
+            }
+        }
+        for(uint32_t i = 0; i < cache->skeleton_count(); i++) {
+            skeleton_names.push_back(std::string(cache->skeleton_name(i)));
+        }
+        for(uint32_t i = 0; i < cache->animation_count(); i++) {
+            animation_names.push_back(std::string(cache->animation_name(i)));
+        }
+    } else {
+        logger::info("Parsing MRN...");
+        utils::trace::Scope parse_scope("mrn::parse");
+        mrn = mrn::MRN(data_span, input_filename.filename().string());
+        parse_scope.end();
+        logger::info("Parsed MRN.");
+        skeleton_names = mrn.skeleton_names()->skeleton_names()->strings();
+        animation_names = mrn.file_names()->files()->animation_names()->strings();
+
+        if(parser.is_used("--write-cache")) {
+            std::filesystem::path cache_filename = parser.get<std::string>("--write-cache");
+            logger::info("Writing animation cache {}...", cache_filename.string());
+            utils::trace::Scope cache_scope("cache::build");
+            write_animation_cache(cache_filename, mrn::AnimationCache::build(mrn));
+        }
+    }
 
-    std::vector<std::string> skeleton_names = mrn.skeleton_names()->skeleton_names()->strings();
     if(!parser.is_used("--output-file")) {
         logger::level::level_enum old = logger::get_level();
         logger::set_level(logger::level::level_enum::info);
@@ -605,7 +710,6 @@ int main(int argc, const char* argv[]) {
         }
 
         logger::info("Available animations:");
-        std::vector<std::string> animation_names = mrn.file_names()->files()->animation_names()->strings();
         for(uint32_t i = 0; i < animation_names.size(); i++) {
             logger::info("{:>{}}", animation_names[i], animation_names[i].size() + 4);
         }
@@ -616,7 +720,7 @@ int main(int argc, const char* argv[]) {
 
     auto skeleton_it = std::find(skeleton_names.begin(), skeleton_names.end(), skeleton_name);
     if(skeleton_it == skeleton_names.end()) {
-        logger::error("Skeleton '{}' not found.");
+        logger::error("Skeleton '{}' not found.", skeleton_name);
         return 1;
     }
 
@@ -633,36 +737,98 @@ int main(int argc, const char* argv[]) {
         remap = nlohmann::json::parse(remap_file);
     }
 
-    std::shared_ptr<mrn::SkeletonData> skeleton_data = static_pointer_cast<mrn::SkeletonPacket>(mrn[mrn.skeleton_indices()[skeleton_index]])->skeleton_data();
+    std::shared_ptr<mrn::Skeleton> skeleton;
+    uint32_t skeleton_bone_count;
+    if(cache != nullptr) {
+        skeleton = cache->skeleton(skeleton_index);
+        skeleton_bone_count = cache->skeleton_bone_count(skeleton_index);
+    } else {
+        std::shared_ptr<mrn::SkeletonData> skeleton_data = static_pointer_cast<mrn::SkeletonPacket>(mrn[mrn.skeleton_indices()[skeleton_index]])->skeleton_data();
+        skeleton = skeleton_data->skeleton();
+        skeleton_bone_count = skeleton_data->bone_count();
+    }
 
     add_skeleton_to_gltf(
         gltf, 
-        skeleton_data->skeleton(),
+        skeleton,
         skeleton_name,
         remap,
         uppercase_name
     );
 
-    std::unordered_set<std::string> exported_animations;
+    // Match every animation name against the patterns in a single pass, keeping the order the
+    // patterns were given in and then the order of the names within the MRN
+    std::vector<std::regex> anim_regexes;
     for(std::string animation : parser.get<std::vector<std::string>>("--animations")) {
-        std::regex anim_regex(animation, std::regex_constants::ECMAScript);
-        std::vector<std::string> animation_names = mrn.file_names()->files()->animation_names()->strings();
-        for(uint32_t i = 0; i < animation_names.size(); i++) {
-            if(
-                !exported_animations.contains(animation_names[i]) 
-                && std::regex_match(animation_names[i], anim_regex)
-            ) {
-                logger::info("{}: Exporting animation {}...", i, animation_names[i]);
-                std::shared_ptr<mrn::NSAFile> nsa_file = static_pointer_cast<mrn::NSAFilePacket>(mrn[i])->animation();
-                add_animation_to_gltf(gltf, skeleton_data, nsa_file, animation_names[i]);
-                exported_animations.insert(animation_names[i]);
+        anim_regexes.emplace_back(animation, std::regex_constants::ECMAScript);
+    }
+
+    std::vector<std::pair<size_t, uint32_t>> matches;
+    for(uint32_t i = 0; i < animation_names.size(); i++) {
+        for(size_t pattern = 0; pattern < anim_regexes.size(); pattern++) {
+            if(std::regex_match(animation_names[i], anim_regexes[pattern])) {
+                matches.push_back({pattern, i});
+                break;
             }
         }
     }
+    std::stable_sort(matches.begin(), matches.end(), [](const auto &lhs, const auto &rhs) {
+        return lhs.first < rhs.first;
+    });
+
+    // Each animation is dequantized (or sliced from the cache) and built into its own model in parallel, then merged in order
+    std::vector<std::optional<tinygltf::Model>> parts(matches.size());
+    std::atomic_size_t next = 0;
+    std::vector<std::thread> workers;
+    uint32_t thread_count = std::max(1u, std::min<uint32_t>(parser.get<uint32_t>("--threads"), (uint32_t)matches.size()));
+    for(uint32_t i = 0; i < thread_count; i++) {
+        workers.push_back(std::thread([&]() {
+            for(size_t index = next++; index < matches.size(); index = next++) {
+                uint32_t name_index = matches[index].second;
+                logger::info("{}: Exporting animation {}...", name_index, animation_names[name_index]);
+                try {
+                    utils::trace::Scope tracks_scope("mrn::load_tracks");
+                    mrn::AnimationTracks tracks;
+                    std::shared_ptr<mrn::NSAFile> nsa_file;
+                    if(cache != nullptr) {
+                        tracks = cache->animation(name_index);
+                    } else {
+                        nsa_file = static_pointer_cast<mrn::NSAFilePacket>(mrn[name_index])->animation();
+                        nsa_file->dequantize();
+                        tracks = nsa_file->tracks();
+                    }
+                    tracks_scope.end();
+                    utils::trace::Scope add_scope("gltf::add_animation");
+                    tinygltf::Model part;
+                    add_animation_to_gltf(part, skeleton_bone_count, tracks, animation_names[name_index], reduction);
+                    parts[index] = std::move(part);
+                } catch(std::exception &err) {
+                    logger::error("Failed to export animation {}: {}", animation_names[name_index], err.what());
+                }
+            }
+        }));
+    }
+
+    for(std::thread &worker : workers) {
+        worker.join();
+    }
+
+    utils::trace::Scope merge_scope("gltf::merge_animations");
+    TimeAccessorPool times("sample_times.bin");
+    for(std::optional<tinygltf::Model> &part : parts) {
+        if(part) {
+            merge_animation(gltf, std::move(*part), times);
+        }
+    }
+
+    merge_scope.end();
 
     logger::info("Writing GLTF2 file {}...", output_filename.filename().string());
+    utils::trace::Scope write_scope("gltf::write");
     tinygltf::TinyGLTF writer;
     writer.WriteGltfSceneToFile(&gltf, output_filename.string(), false, format == "glb", format == "gltf", format == "glb");
+    write_scope.end();
+    utils::trace::report(parser);
     logger::info("Done.");
     return 0;
 }
\ No newline at end of file
@@ -5,7 +5,7 @@
 #include <algorithm>
 #include <filesystem>
 #include "dme_loader.h"
-#include "bone_map.h"
+#include "ps2_bone_map.h"
 #include "utils.h"
 #include "version.h"
 
@@ -19,9 +19,15 @@ int main() {
     logger::info("test_dme using dme_loader version {}", WARPGATE_VERSION);
     //assert(jenkins::oaat("somefilename") == 0xe9eb0404 && "OAAT returned incorrect value.");
     int i = 0;
-    for(auto iter = BONE_HASHMAP.begin(); iter != BONE_HASHMAP.end(); iter++) {
-        if(jenkins::oaat(iter->first) != iter->second) {
-            logger::error("{} jenkins::oaat('{}') != 0x{:08x}", i, iter->first, iter->second);
+    for(const auto &entry : utils::bone_names()) {
+        std::optional<uint32_t> namehash = utils::bone_namehash(entry.value);
+        // Aliased names hash elsewhere and are only reachable by their table key
+        if(namehash && *namehash != jenkins::oaat(entry.value)) {
+            logger::error("{} jenkins::oaat('{}') != 0x{:08x}", i, entry.value, *namehash);
+            std::abort();
+        }
+        if(utils::bone_name(entry.key) != entry.value) {
+            logger::error("{} bone_name(0x{:08x}) != '{}'", i, entry.key, entry.value);
             std::abort();
         }
         i++;
@@ -47,11 +53,9 @@ int main() {
     logger::info("Textures:");
     std::unordered_map<uint32_t, std::string> hashes_to_names;
     
-    for(std::string texture : mosquito.dmat()->textures()) {
-        std::string temp = utils::uppercase(texture);
-        
-        uint32_t namehash = jenkins::oaat(temp.c_str());
-        hashes_to_names[namehash] = texture;
+    for(std::string_view texture : mosquito.dmat()->textures()) {
+        uint32_t namehash = jenkins::oaat_upper(texture);
+        hashes_to_names[namehash] = std::string(texture);
         logger::info("    {}: 0x{:08x}", texture, namehash);
     }
 
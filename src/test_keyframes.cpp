@@ -0,0 +1,169 @@
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+#include "utils/keyframes.h"
+#include "version.h"
+
+#include <glm/geometric.hpp>
+#include <spdlog/spdlog.h>
+
+namespace logger = spdlog;
+using namespace warpgate;
+
+// Reduced tracks are rebuilt here the way a glTF importer would, from the written keys alone,
+// and every original sample must stay within the tolerance of the rebuilt curve.
+constexpr float sample_rate = 30.0f;
+constexpr uint32_t sample_count = 150;
+constexpr float translation_tolerance = 0.001f;
+constexpr float rotation_tolerance = 0.0175f; // About 1 degree
+// Allowance for float rounding in the error measurement itself
+constexpr double translation_slack = 1e-6, rotation_slack = 2e-4;
+
+double error(glm::vec3 expected, glm::vec3 actual) {
+    glm::dvec3 difference = glm::dvec3(expected) - glm::dvec3(actual);
+    return std::sqrt(glm::dot(difference, difference));
+}
+
+double error(glm::quat expected, glm::quat actual) {
+    double dot = (double)expected.w * actual.w + (double)expected.x * actual.x + (double)expected.y * actual.y + (double)expected.z * actual.z;
+    return 2.0 * std::acos(std::min(1.0, std::abs(dot)));
+}
+
+glm::vec3 lerp(glm::vec3 start, glm::vec3 end, float t) {
+    return start + (end - start) * t;
+}
+
+glm::quat lerp(glm::quat start, glm::quat end, float t) {
+    return glm::slerp(start, end, t);
+}
+
+glm::vec3 normalized(glm::vec3 value) {
+    return value;
+}
+
+glm::quat normalized(glm::quat value) {
+    return glm::normalize(value);
+}
+
+// The key segment holding sample i, as the index of its first key
+size_t segment(const std::vector<uint32_t> &keys, uint32_t i) {
+    size_t k = std::upper_bound(keys.begin(), keys.end(), i) - keys.begin();
+    return std::min(k == 0 ? 0 : k - 1, keys.size() - 2);
+}
+
+template <typename T>
+double linear_error(const std::vector<T> &samples, const std::vector<uint32_t> &keys, std::vector<T> values) {
+    if constexpr(std::is_same_v<T, glm::quat>) {
+        utils::keyframes::align_hemispheres(values);
+    }
+    double max_error = 0.0;
+    for(uint32_t i = 0; i < samples.size(); i++) {
+        size_t k = segment(keys, i);
+        float start = (float)keys[k] / sample_rate, end = (float)keys[k + 1] / sample_rate;
+        float t = ((float)i / sample_rate - start) / (end - start);
+        max_error = std::max(max_error, error(samples[i], lerp(values[k], values[k + 1], t)));
+    }
+    return max_error;
+}
+
+template <typename T>
+double cubic_spline_error(const std::vector<T> &samples, const std::vector<uint32_t> &keys) {
+    std::vector<T> output = utils::keyframes::cubic_spline(samples, keys, sample_rate);
+    double max_error = 0.0;
+    for(uint32_t i = 0; i < samples.size(); i++) {
+        size_t k = segment(keys, i);
+        float start = (float)keys[k] / sample_rate, end = (float)keys[k + 1] / sample_rate;
+        float duration = end - start;
+        float t = ((float)i / sample_rate - start) / duration, t2 = t * t, t3 = t2 * t;
+        // Each key is written as in-tangent, value, out-tangent
+        T value = normalized(
+            output[3 * k + 1] * (2.0f * t3 - 3.0f * t2 + 1.0f)
+            + output[3 * k + 2] * duration * (t3 - 2.0f * t2 + t)
+            + output[3 * (k + 1) + 1] * (-2.0f * t3 + 3.0f * t2)
+            + output[3 * (k + 1)] * duration * (t3 - t2)
+        );
+        max_error = std::max(max_error, error(samples[i], value));
+    }
+    return max_error;
+}
+
+bool valid_keys(const std::vector<uint32_t> &keys) {
+    return keys.size() >= 2 && keys.front() == 0 && keys.back() == sample_count - 1 && std::is_sorted(keys.begin(), keys.end())
+        && std::adjacent_find(keys.begin(), keys.end()) == keys.end();
+}
+
+template <typename T>
+uint32_t check_track(std::string name, const std::vector<T> &samples, float tolerance, double slack) {
+    uint32_t failures = 0;
+    std::vector<uint32_t> linear_keys = utils::keyframes::reduce(samples, tolerance);
+    std::vector<uint32_t> spline_keys = utils::keyframes::reduce_cubic_spline(samples, tolerance, sample_rate);
+    if(!valid_keys(linear_keys) || !valid_keys(spline_keys)) {
+        logger::error("{}: Kept keys must be increasing and include the first and last samples", name);
+        return 1;
+    }
+
+    std::vector<T> values;
+    for(uint32_t key : linear_keys) {
+        values.push_back(samples[key]);
+    }
+    double max_linear_error = linear_error(samples, linear_keys, values);
+    double max_spline_error = cubic_spline_error(samples, spline_keys);
+    logger::info("{}: linear kept {}/{} keys (max error {:.6f}), cubic spline kept {}/{} keys (max error {:.6f}), tolerance {:.6f}",
+        name, linear_keys.size(), samples.size(), max_linear_error, spline_keys.size(), samples.size(), max_spline_error, tolerance);
+    if(max_linear_error > tolerance + slack) {
+        logger::error("{}: Linear reconstruction error {} exceeds the tolerance {}", name, max_linear_error, tolerance);
+        failures++;
+    }
+    if(max_spline_error > tolerance + slack) {
+        logger::error("{}: Cubic spline reconstruction error {} exceeds the tolerance {}", name, max_spline_error, tolerance);
+        failures++;
+    }
+    return failures;
+}
+
+glm::quat axis_angle(glm::vec3 axis, float angle) {
+    glm::vec3 unit = axis * (1.0f / glm::length(axis));
+    float s = std::sin(angle / 2.0f);
+    return glm::quat(std::cos(angle / 2.0f), unit.x * s, unit.y * s, unit.z * s);
+}
+
+int main() {
+    logger::info("test_keyframes using warpgate {}", WARPGATE_VERSION);
+    std::mt19937 rng(42);
+    std::normal_distribution<float> jitter(0.0f, 0.002f);
+    uint32_t failures = 0;
+
+    std::vector<glm::vec3> smooth, noisy, steps;
+    for(uint32_t i = 0; i < sample_count; i++) {
+        float time = (float)i / sample_rate;
+        glm::vec3 value(2.0f * std::sin(1.3f * time), std::cos(0.7f * time), 0.5f * time);
+        smooth.push_back(value);
+        noisy.push_back(value + glm::vec3(jitter(rng), jitter(rng), jitter(rng)));
+        steps.push_back(glm::vec3((float)(i / 20), 0.0f, i % 40 < 20 ? 1.0f : -1.0f));
+    }
+    failures += check_track("smooth translation", smooth, translation_tolerance, translation_slack);
+    failures += check_track("noisy translation", noisy, translation_tolerance, translation_slack);
+    failures += check_track("stepped translation", steps, translation_tolerance, translation_slack);
+
+    std::vector<glm::quat> swing, tumble, flipped;
+    for(uint32_t i = 0; i < sample_count; i++) {
+        float time = (float)i / sample_rate;
+        swing.push_back(axis_angle(glm::vec3(0.0f, 1.0f, 0.0f), 1.2f * std::sin(2.0f * time)));
+        glm::quat q = axis_angle(glm::vec3(std::sin(time), 1.0f, std::cos(0.5f * time)), 3.0f * time);
+        tumble.push_back(q);
+        // q and -q are the same rotation, and tracks may switch between them
+        flipped.push_back(rng() % 2 ? -q : q);
+    }
+    failures += check_track("swinging rotation", swing, rotation_tolerance, rotation_slack);
+    failures += check_track("tumbling rotation", tumble, rotation_tolerance, rotation_slack);
+    failures += check_track("tumbling rotation with flipped signs", flipped, rotation_tolerance, rotation_slack);
+
+    if(failures > 0) {
+        logger::error("{} keyframe reduction checks failed", failures);
+        return 1;
+    }
+    logger::info("Reduced tracks stay within tolerance");
+    return 0;
+}
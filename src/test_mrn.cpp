@@ -35,8 +35,8 @@ int main() {
 
 
     std::shared_ptr<mrn::FilenamesPacket> animation_names = aircraftX64.file_names();
-    for(uint32_t i = 0; i < aircraftX64.packets().size(); i++) {
-        std::shared_ptr<mrn::Packet> packet = aircraftX64.packets()[i];
+    for(uint32_t i = 0; i < aircraftX64.packet_count(); i++) {
+        std::shared_ptr<mrn::Packet> packet = aircraftX64[i];
         std::shared_ptr<mrn::NSAFilePacket> nsa_packet;
         std::shared_ptr<mrn::SkeletonPacket> skeleton_packet;
         switch(packet->header()->type()) {
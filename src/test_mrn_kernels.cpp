@@ -0,0 +1,76 @@
+#include <cstring>
+#include <random>
+#include <vector>
+#include "mrn_loader.h"
+#include "version.h"
+
+#include <spdlog/spdlog.h>
+
+namespace logger = spdlog;
+using namespace warpgate;
+
+// The batch kernels must give exactly the results of the scalar helpers, for every track length,
+// so lengths that are not a multiple of the SIMD width check the scalar tail too.
+constexpr size_t max_track_length = 37;
+
+template <typename T>
+bool same_bits(const T &a, const T &b) {
+    return std::memcmp(&a, &b, sizeof(T)) == 0;
+}
+
+mrn::DequantizationFactors random_factors(std::mt19937 &rng) {
+    std::uniform_real_distribution<float> distribution(-2.0f, 2.0f);
+    mrn::DequantizationFactors factors;
+    factors.v_min = {distribution(rng), distribution(rng), distribution(rng)};
+    factors.v_scaled_extent = {distribution(rng) / 1024.0f, distribution(rng) / 1024.0f, distribution(rng) / 1024.0f};
+    return factors;
+}
+
+glm::u16vec3 random_u16vec3(std::mt19937 &rng) {
+    return {(uint16_t)rng(), (uint16_t)rng(), (uint16_t)rng()};
+}
+
+int main() {
+    logger::info("test_mrn_kernels using mrn_loader version {}", WARPGATE_VERSION);
+    std::mt19937 rng(1234);
+    uint32_t failures = 0;
+    for(size_t length = 0; length <= max_track_length; length++) {
+        mrn::DequantizationFactors factors = random_factors(rng);
+        std::vector<glm::u16vec3> quantized(length);
+        std::vector<uint32_t> bit_packed(length);
+        for(size_t i = 0; i < length; i++) {
+            quantized[i] = random_u16vec3(rng);
+            bit_packed[i] = (uint32_t)rng();
+        }
+        glm::vec3 offset = {1.5f, -0.25f, 3.0f};
+        glm::quat initial = mrn::unpack_initial_rotation({(uint8_t)rng(), (uint8_t)rng(), (uint8_t)rng()});
+
+        std::vector<glm::vec3> translations(length), packed_translations(length);
+        std::vector<glm::quat> rotations(length);
+        mrn::unpack_translations(quantized, factors, translations);
+        mrn::unpack_translations(bit_packed, factors, offset, packed_translations);
+        mrn::unpack_rotations(quantized, factors, initial, rotations);
+
+        for(size_t i = 0; i < length; i++) {
+            if(!same_bits(translations[i], mrn::unpack_translation(quantized[i], factors))) {
+                logger::error("unpack_translations differs from unpack_translation at {} of {}", i, length);
+                failures++;
+            }
+            if(!same_bits(packed_translations[i], mrn::unpack_translation(bit_packed[i], factors) + offset)) {
+                logger::error("Bit packed unpack_translations differs from unpack_translation at {} of {}", i, length);
+                failures++;
+            }
+            if(!same_bits(rotations[i], initial * mrn::unpack_rotation(quantized[i], factors))) {
+                logger::error("unpack_rotations differs from unpack_rotation at {} of {}", i, length);
+                failures++;
+            }
+        }
+    }
+
+    if(failures > 0) {
+        logger::error("{} values differ between the batch and scalar kernels", failures);
+        return 1;
+    }
+    logger::info("Batch kernels match the scalar kernels for tracks of up to {} samples", max_track_length);
+    return 0;
+}
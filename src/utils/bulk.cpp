@@ -0,0 +1,109 @@
+#include "utils/bulk.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+
+#include <spdlog/spdlog.h>
+#include "glob/glob.h"
+
+namespace logger = spdlog;
+using namespace warpgate;
+
+std::vector<std::string> utils::bulk::inputs(std::string input_str) {
+    std::vector<std::string> inputs;
+    if(input_str.find_first_of("*?[") != std::string::npos) {
+        for(std::filesystem::path path : glob::glob(input_str)) {
+            inputs.push_back(path.string());
+        }
+        return inputs;
+    }
+
+    std::ifstream input(input_str);
+    if(!input) {
+        throw std::runtime_error("Failed to read bulk input list " + input_str + "!");
+    }
+    std::string line;
+    while(std::getline(input, line)) {
+        if(!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        if(!line.empty()) {
+            inputs.push_back(line);
+        }
+    }
+    return inputs;
+}
+
+size_t utils::bulk::convert(
+    const std::vector<std::string> &inputs,
+    const std::filesystem::path &output_directory,
+    std::string format,
+    uint32_t job_count,
+    image_queue_t &image_queue,
+    convert_fn convert
+) {
+    // Outputs are named by their input's stem alone, so inputs from different directories can
+    // share a name. Only the first of them is converted rather than overwriting each other.
+    std::vector<std::filesystem::path> output_filenames;
+    std::map<std::string, std::string> claimed_names;
+    size_t collisions = 0;
+    for(const std::string &name : inputs) {
+        std::filesystem::path model_filename = output_directory / std::filesystem::path(name).filename();
+        model_filename.replace_extension("." + format);
+        std::string key = model_filename.filename().string();
+        std::transform(key.begin(), key.end(), key.begin(), [](unsigned char c) { return (char)std::tolower(c); });
+        auto [claimed, inserted] = claimed_names.emplace(key, name);
+        if(!inserted) {
+            logger::error("Skipping '{}': its output {} would overwrite the output of '{}'", name, model_filename.filename().string(), claimed->second);
+            model_filename.clear();
+            collisions++;
+        }
+        output_filenames.push_back(model_filename);
+    }
+
+    std::set<std::pair<std::string, Semantic>> queued_images;
+    std::mutex queued_images_mutex;
+    std::atomic_size_t next_input = 0, failures = collisions;
+    std::vector<std::thread> job_pool;
+    for(uint32_t i = 0; i < std::max(1u, job_count); i++) {
+        job_pool.push_back(std::thread([&]() {
+            size_t index;
+            while((index = next_input++) < inputs.size()) {
+                std::string name = inputs[index];
+                const std::filesystem::path &model_filename = output_filenames[index];
+                if(model_filename.empty()) {
+                    continue;
+                }
+                image_queue_t model_image_queue;
+                try {
+                    convert(name, model_filename, model_image_queue);
+                } catch(std::exception &err) {
+                    logger::error("Failed to convert '{}': {}", name, err.what());
+                    failures++;
+                    continue;
+                }
+
+                model_image_queue.close();
+                std::pair<std::string, Semantic> image;
+                while((image = model_image_queue.try_dequeue({"", Semantic::UNKNOWN})).second != Semantic::UNKNOWN) {
+                    std::lock_guard<std::mutex> lock(queued_images_mutex);
+                    if(queued_images.insert(image).second) {
+                        image_queue.enqueue(image);
+                    }
+                }
+                logger::info("Converted {} ({}/{})", name, index + 1, inputs.size());
+            }
+        }));
+    }
+    for(uint32_t i = 0; i < job_pool.size(); i++) {
+        job_pool.at(i).join();
+    }
+    return failures;
+}
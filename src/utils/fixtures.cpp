@@ -0,0 +1,716 @@
+#include "utils/fixtures.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include <gli/gli.hpp>
+
+#include "cnk0.h"
+#include "dme.h"
+#include "jenkins.h"
+#include "parameter.h"
+#include "ps2_bone_map.h"
+#include "semantics.h"
+
+#include "lzham.h"
+
+using namespace warpgate;
+
+namespace {
+    // splitmix32, so fixtures do not depend on the standard library's distributions
+    struct Random {
+        uint32_t state;
+
+        Random(uint32_t seed) : state(seed * 0x9E3779B9u + 0x7F4A7C15u) {}
+
+        uint32_t next() {
+            uint32_t value = (state += 0x9E3779B9u);
+            value = (value ^ (value >> 16)) * 0x85EBCA6Bu;
+            value = (value ^ (value >> 13)) * 0xC2B2AE35u;
+            return value ^ (value >> 16);
+        }
+
+        float uniform(float minimum, float maximum) {
+            return minimum + (maximum - minimum) * (float)(next() >> 8) * (1.0f / 16777216.0f);
+        }
+    };
+
+    struct Writer {
+        std::vector<uint8_t> data;
+
+        size_t size() const {
+            return data.size();
+        }
+
+        template <typename T>
+        void write(const T &value) {
+            const uint8_t *bytes = reinterpret_cast<const uint8_t*>(&value);
+            data.insert(data.end(), bytes, bytes + sizeof(T));
+        }
+
+        template <typename T>
+        void patch(size_t offset, const T &value) {
+            std::memcpy(data.data() + offset, &value, sizeof(T));
+        }
+
+        void write_magic(std::string_view magic) {
+            data.insert(data.end(), magic.begin(), magic.end());
+        }
+
+        void write_string(std::string_view value) {
+            data.insert(data.end(), value.begin(), value.end());
+            data.push_back(0);
+        }
+
+        void write_bytes(std::span<const uint8_t> bytes) {
+            data.insert(data.end(), bytes.begin(), bytes.end());
+        }
+
+        void zeros(size_t count) {
+            data.insert(data.end(), count, 0);
+        }
+
+        void align(size_t alignment) {
+            if(data.size() % alignment != 0) {
+                zeros(alignment - data.size() % alignment);
+            }
+        }
+    };
+
+    // Only handles the normal range, which is all the texture coordinates need
+    uint16_t to_half(float value) {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        uint16_t sign = (uint16_t)((bits >> 16) & 0x8000);
+        int32_t exponent = (int32_t)((bits >> 23) & 0xFF) - 127 + 15;
+        if(exponent <= 0) {
+            return sign;
+        }
+        if(exponent >= 31) {
+            return sign | 0x7C00;
+        }
+        return sign | (uint16_t)(exponent << 10) | (uint16_t)((bits & 0x7FFFFF) >> 13);
+    }
+
+    void write_texcoord(Writer &writer, float u, float v) {
+        writer.write(to_half(u));
+        writer.write(to_half(v));
+    }
+
+    void write_ubyte4(Writer &writer, uint8_t x, uint8_t y, uint8_t z, uint8_t w) {
+        uint8_t value[4] = {x, y, z, w};
+        writer.write(value);
+    }
+
+    void write_u16vec3(Writer &writer, Random &random) {
+        for(uint32_t i = 0; i < 3; i++) {
+            writer.write((uint16_t)(random.next() & 0xFFFF));
+        }
+    }
+
+    // DequantizationFactors: a min and a scaled extent for each axis
+    void write_factors(Writer &writer, float minimum, float extent) {
+        for(uint32_t i = 0; i < 3; i++) {
+            writer.write(minimum);
+        }
+        for(uint32_t i = 0; i < 3; i++) {
+            writer.write(extent);
+        }
+    }
+
+    // A u16 length followed by that many u16 bone indices
+    void write_bone_indices(Writer &writer, uint32_t first, uint32_t count) {
+        writer.write((uint16_t)count);
+        for(uint32_t i = 0; i < count; i++) {
+            writer.write((uint16_t)(first + i));
+        }
+        writer.align(4);
+    }
+
+    uint32_t next_multiple_of_4(uint32_t value) {
+        return (value + 3) / 4 * 4;
+    }
+
+    constexpr std::string_view texture_names[] = {"fixture_C.dds", "fixture_N.dds", "fixture_S.dds"};
+    constexpr Semantic texture_semantics[] = {Semantic::BaseDiffuse, Semantic::Bump, Semantic::Spec};
+
+    std::vector<uint8_t> dmat(uint32_t material_definition) {
+        Writer writer;
+        writer.write_magic("DMAT");
+        writer.write((uint32_t)1);
+
+        size_t filenames_length_offset = writer.size();
+        writer.write((uint32_t)0);
+        size_t filenames_offset = writer.size();
+        for(std::string_view name : texture_names) {
+            writer.write_string(name);
+        }
+        writer.patch(filenames_length_offset, (uint32_t)(writer.size() - filenames_offset));
+
+        writer.write((uint32_t)1);
+        writer.write(jenkins::oaat("fixture"));
+        size_t material_length_offset = writer.size();
+        writer.write((uint32_t)0);
+        writer.write(material_definition);
+        writer.write((uint32_t)std::size(texture_names));
+        for(uint32_t i = 0; i < std::size(texture_names); i++) {
+            writer.write((uint32_t)texture_semantics[i]);
+            writer.write((uint32_t)Parameter::D3DXParamClass::OBJECT);
+            writer.write((uint32_t)Parameter::D3DXParamType::TEXTURE);
+            writer.write((uint32_t)sizeof(uint32_t));
+            writer.write(jenkins::oaat_upper(texture_names[i]));
+        }
+        // The material length excludes its namehash and length fields
+        writer.patch(material_length_offset, (uint32_t)(writer.size() - material_length_offset - sizeof(uint32_t)));
+        return std::move(writer.data);
+    }
+}
+
+std::vector<uint8_t> utils::fixtures::dme(uint32_t vertex_count, bool skinned, uint32_t bone_count, uint32_t seed) {
+    Random random(seed);
+    uint32_t side = std::max<uint32_t>(2, (uint32_t)std::sqrt((double)vertex_count));
+    vertex_count = side * side;
+    uint32_t index_count = (side - 1) * (side - 1) * 6;
+    uint32_t index_size = vertex_count > 0xFFFF ? 4 : 2;
+    bone_count = std::clamp<uint32_t>(bone_count, 1, 255);
+    float extent = 0.05f * (float)side;
+
+    Writer writer;
+    writer.write_magic("DMOD");
+    writer.write((uint32_t)4);
+    std::vector<uint8_t> material_data = dmat(skinned ? skinned_material_definition : rigid_material_definition);
+    writer.write((uint32_t)material_data.size());
+    writer.write_bytes(material_data);
+
+    AABB aabb = {{-extent / 2, 0, -extent / 2}, {extent / 2, 1, extent / 2}};
+    writer.write(aabb);
+
+    writer.write((uint32_t)1);
+    writer.write((uint32_t)0);              // draw offset
+    writer.write((uint32_t)1);              // draw count
+    writer.write(bone_count);
+    writer.write((uint32_t)0xFFFFFFFF);     // unknown
+    writer.write((uint32_t)2);              // vertex stream count
+    writer.write(index_size);
+    writer.write(index_count);
+    writer.write(vertex_count);
+
+    // Bones own strips of the grid along x, so neighbouring vertices mostly share joints
+    auto bone_of = [&](uint32_t column) {
+        return (uint8_t)(column * bone_count / side);
+    };
+
+    writer.write((uint32_t)(skinned ? 20 : 12));
+    for(uint32_t row = 0; row < side; row++) {
+        for(uint32_t column = 0; column < side; column++) {
+            writer.write(aabb.min.x + extent * (float)column / (float)(side - 1));
+            writer.write(random.uniform(0.0f, 1.0f));
+            writer.write(aabb.min.z + extent * (float)row / (float)(side - 1));
+            if(skinned) {
+                uint8_t weight = (uint8_t)(128 + (random.next() & 0x7F));
+                uint8_t bone = bone_of(column);
+                write_ubyte4(writer, weight, 255 - weight, 0, 0);
+                write_ubyte4(writer, bone, (uint8_t)std::min<uint32_t>(bone + 1u, bone_count - 1), 0, 0);
+            }
+        }
+    }
+
+    writer.write((uint32_t)(skinned ? 20 : 24));
+    for(uint32_t row = 0; row < side; row++) {
+        for(uint32_t column = 0; column < side; column++) {
+            float u = (float)column / (float)(side - 1), v = (float)row / (float)(side - 1);
+            write_ubyte4(writer, 255, 128, 128, 255);
+            // Rigid layouts pack the joint index into the binormal's w component
+            write_ubyte4(writer, 128, 128, 255, skinned ? 255 : bone_of(column));
+            write_texcoord(writer, u, v);
+            write_texcoord(writer, u, v);
+            if(!skinned) {
+                write_ubyte4(writer, 255, 255, 255, 255);
+            }
+            write_texcoord(writer, u, v);
+        }
+    }
+
+    for(uint32_t row = 0; row + 1 < side; row++) {
+        for(uint32_t column = 0; column + 1 < side; column++) {
+            uint32_t corner = row * side + column;
+            uint32_t quad[6] = {corner, corner + side, corner + 1, corner + 1, corner + side, corner + side + 1};
+            for(uint32_t index : quad) {
+                if(index_size == 2) {
+                    writer.write((uint16_t)index);
+                } else {
+                    writer.write(index);
+                }
+            }
+        }
+    }
+
+    writer.write((uint32_t)1);
+    writer.write(DrawCall{0, 0, bone_count, 0, 0, 0, vertex_count, 0, index_count});
+
+    writer.write(bone_count);
+    for(uint32_t i = 0; i < bone_count; i++) {
+        writer.write(BoneMapEntry{(uint16_t)i, (uint16_t)i});
+    }
+
+    std::span<const perfect_hash::Entry<std::string_view>> bones = utils::bone_names();
+    writer.write(bone_count);
+    for(uint32_t i = 0; i < bone_count; i++) {
+        float x = aabb.min.x + extent * ((float)i + 0.5f) / (float)bone_count;
+        writer.write(PackedMat4{{{1, 0, 0}, {0, 1, 0}, {0, 0, 1}, {-x, 0, 0}}});
+    }
+    for(uint32_t i = 0; i < bone_count; i++) {
+        writer.write(aabb);
+    }
+    for(uint32_t i = 0; i < bone_count; i++) {
+        writer.write(bones[i % bones.size()].key);
+    }
+    return std::move(writer.data);
+}
+
+std::vector<uint8_t> utils::fixtures::cnk0(uint32_t quads_per_side, uint32_t seed) {
+    Random random(seed);
+    // Batch indices are 16 bit and relative to the batch's first vertex
+    quads_per_side = std::clamp<uint32_t>(quads_per_side, 1, 255);
+    uint32_t side = quads_per_side + 1;
+    constexpr uint32_t batch_count = 4, tile_count = 16;
+
+    Writer writer;
+    writer.write_magic("CNK0");
+    writer.write((uint32_t)2);
+
+    writer.write(tile_count);
+    for(uint32_t tile = 0; tile < tile_count; tile++) {
+        writer.write((int32_t)(tile % 4) * 32 - 64);
+        writer.write((int32_t)(tile / 4) * 32 - 64);
+        writer.write((int32_t)0);
+        writer.write((int32_t)0);
+        writer.write((uint32_t)1);              // eco count
+        writer.write(tile % 4);                 // eco id
+        writer.write((uint32_t)1);              // flora count
+        writer.write((uint32_t)1);              // layer count
+        writer.write((uint32_t)random.next());
+        writer.write((uint32_t)random.next());
+        writer.write(tile);                     // index
+        writer.write((uint32_t)0);              // image id, no image data follows
+        writer.write((uint32_t)4);              // layer length
+        writer.write(random.next());
+    }
+
+    writer.write((uint32_t)0);                  // unk1
+    writer.write((uint32_t)0);                  // unk_array1
+
+    writer.write(batch_count * quads_per_side * quads_per_side * 6);
+    for(uint32_t batch = 0; batch < batch_count; batch++) {
+        for(uint32_t row = 0; row < quads_per_side; row++) {
+            for(uint32_t column = 0; column < quads_per_side; column++) {
+                uint16_t corner = (uint16_t)(row * side + column);
+                uint16_t quad[6] = {
+                    corner, (uint16_t)(corner + side), (uint16_t)(corner + 1),
+                    (uint16_t)(corner + 1), (uint16_t)(corner + side), (uint16_t)(corner + side + 1)
+                };
+                writer.write(quad);
+            }
+        }
+    }
+
+    writer.write(batch_count * side * side);
+    for(uint32_t batch = 0; batch < batch_count; batch++) {
+        for(uint32_t row = 0; row < side; row++) {
+            for(uint32_t column = 0; column < side; column++) {
+                int16_t height = (int16_t)(random.next() & 0x3FF);
+                writer.write(chunk::Vertex{
+                    (int16_t)((batch % 2) * quads_per_side + column),
+                    (int16_t)((batch / 2) * quads_per_side + row),
+                    height, height,
+                    random.next(), random.next()
+                });
+            }
+        }
+    }
+
+    writer.write(batch_count);
+    for(uint32_t batch = 0; batch < batch_count; batch++) {
+        uint32_t index_count = quads_per_side * quads_per_side * 6;
+        writer.write(chunk::RenderBatch{batch * index_count, index_count, batch * side * side, side * side});
+    }
+
+    writer.write((uint32_t)0);                  // optimized draws
+    writer.write((uint32_t)0);                  // unk shorts
+    writer.write((uint32_t)0);                  // unk vectors
+    writer.write((uint32_t)0);                  // tile occluder infos
+    return std::move(writer.data);
+}
+
+std::vector<uint8_t> utils::fixtures::cnk1(uint32_t texture_size, uint32_t seed) {
+    // One texture per render batch written by cnk0
+    constexpr uint32_t texture_count = 4, extra_count = 4;
+    Writer writer;
+    writer.write_magic("CNK1");
+    writer.write((uint32_t)2);
+
+    writer.write(texture_count);
+    for(uint32_t texture = 0; texture < texture_count; texture++) {
+        for(uint32_t map = 0; map < 2; map++) {
+            std::vector<uint8_t> image = dds(texture_size, texture_size, seed * texture_count * 2 + texture * 2 + map);
+            writer.write((uint32_t)image.size());
+            writer.write_bytes(image);
+        }
+        for(uint32_t extra = 0; extra < extra_count; extra++) {
+            writer.write((uint32_t)0);
+        }
+    }
+    return std::move(writer.data);
+}
+
+std::vector<uint8_t> utils::fixtures::compress_chunk(std::span<const uint8_t> decompressed) {
+    constexpr size_t header_size = 8;
+    // Chunk::decompress inflates with a 2^20 byte dictionary
+    constexpr int window_bits = 20;
+    if(decompressed.size() < header_size) {
+        throw std::invalid_argument("fixtures::compress_chunk: missing chunk header");
+    }
+    std::span<const uint8_t> payload = decompressed.subspan(header_size);
+
+    lzham_z_stream stream{};
+    if(lzham_z_deflateInit2(&stream, LZHAM_Z_DEFAULT_COMPRESSION, LZHAM_Z_LZHAM, window_bits, 9, LZHAM_Z_DEFAULT_STRATEGY) != LZHAM_Z_OK) {
+        throw std::runtime_error("fixtures::compress_chunk: deflateInit2 failed");
+    }
+    std::vector<uint8_t> compressed(lzham_z_deflateBound(&stream, (lzham_z_ulong)payload.size()));
+    stream.next_in = payload.data();
+    stream.avail_in = (uint32_t)payload.size();
+    stream.next_out = compressed.data();
+    stream.avail_out = (uint32_t)compressed.size();
+    int status = lzham_z_deflate(&stream, LZHAM_Z_FINISH);
+    compressed.resize(stream.total_out);
+    lzham_z_deflateEnd(&stream);
+    if(status != LZHAM_Z_STREAM_END) {
+        throw std::runtime_error("fixtures::compress_chunk: deflate failed");
+    }
+
+    Writer writer;
+    writer.write_bytes(decompressed.first(header_size));
+    writer.write((uint32_t)payload.size());
+    // The stored compressed size counts four bytes more than the stream itself
+    writer.write((uint32_t)(compressed.size() + 4));
+    writer.write_bytes(compressed);
+    return std::move(writer.data);
+}
+
+std::vector<uint8_t> utils::fixtures::zone(uint32_t object_count, uint32_t instances_per_object, uint32_t chunks_per_side, uint32_t seed, uint32_t version) {
+    if(version != 3 && version != 5) {
+        throw std::invalid_argument("fixtures::zone: Only versions 3 and 5 are supported");
+    }
+    Random random(seed);
+    constexpr uint32_t eco_count = 2, flora_count = zone_flora_count;
+    // Chunk coordinates are in 64 unit tiles, and every chunk spans 4x4 of them
+    chunks_per_side = std::max<uint32_t>(chunks_per_side, 1);
+    int32_t start = -(int32_t)(chunks_per_side * 2);
+    uint32_t tile_count = chunks_per_side * 4;
+    float half_extent = (float)chunks_per_side * 128.0f;
+
+    Writer writer;
+    writer.write_magic("ZONE");
+    writer.write(version);
+    if(version > 3) {
+        writer.write((uint32_t)0);
+    }
+    // Version 3 has no decals offset
+    size_t offsets_offset = writer.size();
+    writer.zeros((version > 3 ? 7 : 6) * sizeof(uint32_t));
+    writer.write((uint32_t)4);                  // per tile: quad count
+    writer.write(32.0f);                        //           width
+    writer.write(32.0f);                        //           height
+    writer.write((uint32_t)4);                  //           vertex count
+    writer.write((uint32_t)16);                 // chunks: tile count
+    writer.write(start);                        //         start x
+    writer.write(start);                        //         start y
+    writer.write(tile_count);                   //         count x
+    writer.write(tile_count);                   //         count y
+
+    std::vector<uint32_t> offsets;
+    offsets.push_back((uint32_t)writer.size());
+    writer.write(eco_count);
+    for(uint32_t eco = 0; eco < eco_count; eco++) {
+        std::string name = "fixture_eco_" + std::to_string(eco);
+        writer.write(eco);
+        writer.write_string(name);
+        writer.write_string(name + "_CNX.dds");
+        writer.write_string(name + "_SBNY.dds");
+        writer.write((uint32_t)8);              // detail repeat
+        writer.write(1.0f);                     // blend strength
+        writer.write(0.0f);                     // spec min/max
+        writer.write(1.0f);
+        writer.write(0.0f);                     // smoothness min/max
+        writer.write(1.0f);
+        writer.write_string("dirt");
+
+        writer.write((uint32_t)1);              // layer count
+        writer.write(0.5f);                     // density
+        writer.write(0.8f);                     // min/max scale
+        writer.write(1.2f);
+        writer.write(0.0f);                     // slope peak/extent
+        writer.write(45.0f);
+        writer.write(-1000.0f);                 // min/max elevation
+        writer.write(1000.0f);
+        writer.write((uint8_t)0);               // min alpha
+        writer.write_string("fixture_flora_" + std::to_string(eco));
+        writer.write((uint32_t)1);              // tint count
+        write_ubyte4(writer, 255, 255, 255, 255);
+        writer.write((uint32_t)50);
+    }
+
+    offsets.push_back((uint32_t)writer.size());
+    writer.write(flora_count);
+    for(uint32_t flora = 0; flora < flora_count; flora++) {
+        std::string name = "fixture_flora_" + std::to_string(flora);
+        writer.write_string(name);
+        writer.write_string(name + ".dds");
+        writer.write_string(name + ".adr");
+        writer.write(true);
+        writer.write(1.0f);
+        writer.write(64.0f);
+        if(version > 3) {
+            writer.zeros(12);
+        }
+    }
+
+    offsets.push_back((uint32_t)writer.size());
+    writer.write((uint32_t)0);                  // invis walls
+
+    offsets.push_back((uint32_t)writer.size());
+    writer.write(object_count);
+    for(uint32_t object = 0; object < object_count; object++) {
+        writer.write_string("fixture_object_" + std::to_string(object) + ".adr");
+        writer.write(random.uniform(100.0f, 1000.0f));
+        writer.write(instances_per_object);
+        for(uint32_t instance = 0; instance < instances_per_object; instance++) {
+            float scale = random.uniform(0.5f, 2.0f);
+            float translation[4] = {random.uniform(-half_extent, half_extent), random.uniform(0.0f, 512.0f), random.uniform(-half_extent, half_extent), 1.0f};
+            float rotation[4] = {random.uniform(-3.14159f, 3.14159f), 0.0f, 0.0f, 0.0f};
+            float scales[4] = {scale, scale, scale, 1.0f};
+            writer.write(translation);
+            writer.write(rotation);
+            writer.write(scales);
+            if(version == 3) {
+                writer.zeros(9);
+                continue;
+            }
+            // Version 5 instance tail with every map empty
+            writer.zeros(5);
+            writer.write(0.0f);
+            writer.write((uint32_t)0);          // uint map
+            writer.write((uint32_t)0);          // float map
+            writer.write((uint32_t)0);
+            writer.write((uint32_t)0);          // vector4 map
+            writer.zeros(5);
+        }
+    }
+
+    offsets.push_back((uint32_t)writer.size());
+    writer.write((uint32_t)1);
+    writer.write_string("fixture_light");
+    writer.write_string("white");
+    writer.write((uint32_t)1);                  // point light
+    writer.write(false);
+    float light_translation[4] = {0.0f, 128.0f, 0.0f, 1.0f};
+    float light_rotation[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+    writer.write(light_translation);
+    writer.write(light_rotation);
+    writer.write(1.0f);
+    writer.write(64.0f);
+    write_ubyte4(writer, 255, 255, 255, 255);
+    writer.zeros(26);
+
+    offsets.push_back((uint32_t)writer.size());
+    writer.write((uint32_t)0);                  // unknowns
+    if(version > 3) {
+        offsets.push_back((uint32_t)writer.size());
+        writer.write((uint32_t)0);              // decals
+    }
+
+    for(uint32_t i = 0; i < offsets.size(); i++) {
+        writer.patch(offsets_offset + i * sizeof(uint32_t), offsets[i]);
+    }
+    return std::move(writer.data);
+}
+
+std::vector<uint8_t> utils::fixtures::adr(std::string_view model, std::string_view network) {
+    std::string document = "<ActorRuntime>\n";
+    document += "  <Base fileName=\"" + std::string(model) + "\" paletteName=\"" + std::string(model) + "\"/>\n";
+    if(!network.empty()) {
+        document += "  <AnimationNetwork fileName=\"" + std::string(network) + "\" animSetName=\"fixture\"/>\n";
+    }
+    document += "</ActorRuntime>\n";
+    return std::vector<uint8_t>(document.begin(), document.end());
+}
+
+std::vector<uint8_t> utils::fixtures::nsa(uint32_t bone_count, uint32_t sample_count, uint32_t seed) {
+    Random random(seed);
+    constexpr float sample_rate = 30.0f;
+    constexpr uint32_t factor_count = 2;
+    bone_count = std::max<uint32_t>(bone_count, 2);
+    sample_count = std::max<uint32_t>(sample_count, 1);
+    uint32_t animated_count = bone_count / 2, static_count = bone_count - animated_count;
+
+    // Pointers are offsets from the start of the file and are patched once their targets are written
+    Writer writer;
+    writer.write((uint32_t)random.next());      // crc32
+    writer.write((uint32_t)3);                  // version
+    writer.zeros(8);
+    writer.write((uint32_t)0);                  // static length
+    writer.write((uint32_t)16);                 // alignment
+    writer.write((float)(sample_count - 1) / sample_rate);
+    writer.write(sample_rate);
+    writer.write(bone_count);
+    writer.write(animated_count);
+    writer.zeros(6 * sizeof(uint64_t));         // bone index lists, @40
+    write_factors(writer, -1.0f, 2.0f / 65535.0f);
+    writer.zeros(8);
+    writer.write(factor_count);                 // dynamic translation factors, @120
+    writer.write(factor_count);                 // dynamic rotation factors
+    writer.write((uint32_t)0);                  // dynamic scale factors
+    writer.zeros(4);
+    writer.zeros(3 * sizeof(uint64_t));         // factors, @136
+    writer.zeros(3 * sizeof(uint64_t));         // segments, @160
+    writer.align(16);
+
+    uint32_t index_lists[6][2] = {
+        {animated_count, static_count}, {animated_count, static_count}, {0, 0},
+        {0, animated_count}, {0, animated_count}, {0, 0},
+    };
+    for(uint32_t i = 0; i < 6; i++) {
+        writer.patch(40 + i * sizeof(uint64_t), (uint64_t)writer.size());
+        write_bone_indices(writer, index_lists[i][0], index_lists[i][1]);
+    }
+
+    for(uint32_t i = 0; i < 2; i++) {
+        writer.patch(136 + i * sizeof(uint64_t), (uint64_t)writer.size());
+        for(uint32_t factor = 0; factor < factor_count; factor++) {
+            write_factors(writer, -0.5f * (float)(factor + 1), (float)(factor + 1) / 1024.0f);
+        }
+    }
+    writer.patch(152, (uint64_t)writer.size());
+    writer.align(16);
+
+    size_t segment = writer.size();
+    writer.patch(160, (uint64_t)segment);
+    writer.write(static_count);
+    writer.write(static_count);
+    writer.write((uint32_t)0);
+    write_factors(writer, -1.0f, 2.0f / 65535.0f);
+    write_factors(writer, -1.0f, 2.0f / 65535.0f);
+    writer.zeros(12);
+    writer.write((uint64_t)96);
+    writer.write((uint64_t)(96 + static_count * 6));
+    writer.write((uint64_t)0);
+    for(uint32_t i = 0; i < 2 * static_count; i++) {
+        write_u16vec3(writer, random);
+    }
+    writer.align(16);
+
+    // Dynamic samples are stored sample-major, with the rotations unpadded
+    segment = writer.size();
+    writer.patch(168, (uint64_t)segment);
+    uint64_t translation_data = 64;
+    uint64_t translation_info = translation_data + (uint64_t)sample_count * animated_count * sizeof(uint32_t);
+    uint64_t rotation_data = translation_info + next_multiple_of_4(animated_count) * 6;
+    uint64_t rotation_info = rotation_data + (uint64_t)sample_count * animated_count * 6;
+    writer.write(sample_count);
+    writer.write(animated_count);
+    writer.write(animated_count);
+    writer.write((uint32_t)0);
+    writer.write(translation_data);
+    writer.write(translation_info);
+    writer.write(rotation_data);
+    writer.write(rotation_info);
+    writer.write((uint64_t)0);
+    writer.write((uint64_t)0);
+    for(uint32_t i = 0; i < sample_count * animated_count; i++) {
+        writer.write(random.next());
+    }
+    for(uint32_t track = 0; track < 2; track++) {
+        if(track == 1) {
+            for(uint32_t i = 0; i < sample_count * animated_count; i++) {
+                write_u16vec3(writer, random);
+            }
+        }
+        for(uint32_t bone = 0; bone < next_multiple_of_4(animated_count); bone++) {
+            uint8_t init = (uint8_t)(random.next() & 0xFF);
+            uint8_t info[6] = {init, init, init, (uint8_t)(bone % factor_count), (uint8_t)((bone + 1) % factor_count), 0};
+            writer.write(info);
+        }
+    }
+    writer.align(16);
+
+    segment = writer.size();
+    writer.patch(176, (uint64_t)segment);
+    writer.write((uint32_t)1);
+    writer.zeros(12);
+    writer.write((uint32_t)(96 + sample_count * 10));
+    writer.write((uint32_t)16);
+    writer.write(sample_rate);
+    writer.write(sample_count);
+    write_factors(writer, -8.0f, 16.0f / 2047.0f);
+    write_factors(writer, -1.0f, 2.0f / 65535.0f);
+    writer.write((uint64_t)96);
+    writer.write((uint64_t)(96 + sample_count * sizeof(uint32_t)));
+    for(uint32_t i = 0; i < sample_count; i++) {
+        writer.write(random.next());
+    }
+    for(uint32_t i = 0; i < sample_count; i++) {
+        write_u16vec3(writer, random);
+    }
+    writer.align(16);
+    return std::move(writer.data);
+}
+
+std::vector<uint8_t> utils::fixtures::mrn(uint32_t animation_count, uint32_t bone_count, uint32_t sample_count, uint32_t seed) {
+    constexpr uint32_t nsa_data_packet = 0x10, alignment = 16;
+    Writer writer;
+    for(uint32_t i = 0; i < animation_count; i++) {
+        std::vector<uint8_t> animation = nsa(bone_count, sample_count, seed + i);
+        writer.write((uint64_t)0x1A2B3C4D);     // magic
+        writer.write(nsa_data_packet);
+        writer.write(i);
+        writer.zeros(4 * sizeof(uint32_t));
+        writer.write((uint32_t)animation.size());
+        writer.write(alignment);
+        writer.align(alignment);
+        writer.write_bytes(animation);
+        writer.align(alignment);
+    }
+    return std::move(writer.data);
+}
+
+std::vector<uint8_t> utils::fixtures::dds(uint32_t width, uint32_t height, uint32_t seed) {
+    Random random(seed);
+    gli::texture2d texture(gli::format::FORMAT_RGBA8_UNORM_PACK8, gli::texture2d::extent_type(width, height), 1);
+    std::span<uint32_t> pixels(texture.data<uint32_t>(), texture.size<uint32_t>());
+    for(uint32_t &pixel : pixels) {
+        pixel = random.next();
+    }
+    std::vector<char> memory;
+    if(!gli::save_dds(texture, memory)) {
+        throw std::runtime_error("fixtures::dds: save_dds failed");
+    }
+    return std::vector<uint8_t>(memory.begin(), memory.end());
+}
+
+std::vector<uint8_t> utils::fixtures::dds_cube(uint32_t size, uint32_t seed) {
+    Random random(seed);
+    gli::texture_cube texture(gli::format::FORMAT_RGBA8_UNORM_PACK8, gli::texture_cube::extent_type(size, size), 1);
+    std::span<uint32_t> pixels(texture.data<uint32_t>(), texture.size<uint32_t>());
+    for(uint32_t &pixel : pixels) {
+        pixel = random.next();
+    }
+    std::vector<char> memory;
+    if(!gli::save_dds(texture, memory)) {
+        throw std::runtime_error("fixtures::dds_cube: save_dds failed");
+    }
+    return std::vector<uint8_t>(memory.begin(), memory.end());
+}
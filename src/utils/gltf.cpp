@@ -14,8 +14,10 @@
 #include "jenkins.h"
 #include "ps2_bone_map.h"
 #include "utils/materials_3.h"
+#include "utils/metrics.h"
 
 #include "utils/textures.h"
+#include "utils/trace.h"
 #include "utils.h"
 
 namespace logger = spdlog;
@@ -23,6 +25,49 @@ using half_float::half;
 
 using namespace warpgate;
 
+// FNV-1a, continued from `hash` so several values can be folded into one key
+static uint64_t fnv1a(std::span<const uint8_t> data, uint64_t hash = 0xcbf29ce484222325) {
+    for(uint8_t byte : data) {
+        hash ^= byte;
+        hash *= 0x100000001b3;
+    }
+    return hash;
+}
+
+template <typename T>
+static uint64_t fnv1a(const T &value, uint64_t hash) {
+    return fnv1a(std::span<const uint8_t>((const uint8_t*)&value, sizeof(T)), hash);
+}
+
+uint64_t utils::gltf::dmat::material_key(const DMAT &dmat, uint32_t material_index, bool export_textures) {
+    const Material *dmat_material = dmat.material(material_index);
+    uint64_t key = fnv1a((uint32_t)dmat_material->definition(), 0xcbf29ce484222325);
+    if(!export_textures) {
+        // Untextured materials only differ by definition
+        return key;
+    }
+    // build_material only reads the texture parameters and the texture bound to each semantic
+    for(const Parameter &parameter : dmat_material->parameters()) {
+        if(!(parameter.type() == Parameter::D3DXParamType::TEXTURE
+            || parameter.type() == Parameter::D3DXParamType::TEXTURE1D
+            || parameter.type() == Parameter::D3DXParamType::TEXTURE2D
+            || parameter.type() == Parameter::D3DXParamType::TEXTURE3D
+            || parameter.type() == Parameter::D3DXParamType::TEXTURECUBE
+        )) {
+            continue;
+        }
+        uint32_t semantic = (uint32_t)(Semantic)parameter.semantic_hash();
+        key = fnv1a(semantic, key);
+        std::optional<std::string> texture_name = dmat_material->texture((int32_t)semantic);
+        if(texture_name) {
+            key = fnv1a(std::span<const uint8_t>((const uint8_t*)texture_name->data(), texture_name->size()), key);
+        }
+        // Separates names so that adjacent textures cannot run together into the same bytes
+        key = fnv1a((uint8_t)0, key);
+    }
+    return key;
+}
+
 int utils::gltf::dmat::add_material_to_gltf(
     tinygltf::Model &gltf, 
     const DMAT &dmat, 
@@ -30,11 +75,20 @@ int utils::gltf::dmat::add_material_to_gltf(
     int sampler_index,
     bool export_textures,
     std::unordered_map<uint32_t, uint32_t> &texture_indices,
-    std::unordered_map<uint32_t, std::vector<uint32_t>> &material_indices,
+    std::unordered_map<uint64_t, uint32_t> &material_indices,
     utils::tsqueue<std::pair<std::string, Semantic>> &image_queue,
     std::filesystem::path output_directory,
     std::string dme_name
 ) {
+    utils::trace::Scope scope("gltf::add_material");
+    uint64_t key = material_key(dmat, material_index, export_textures);
+    std::unordered_map<uint64_t, uint32_t>::iterator value;
+    if((value = material_indices.find(key)) != material_indices.end()) {
+        utils::metrics::add(utils::metrics::Counter::MaterialCacheHits);
+        return value->second;
+    }
+    utils::metrics::add(utils::metrics::Counter::MaterialCacheMisses);
+
     tinygltf::Material material;
     if(export_textures) {
         build_material(gltf, material, dmat, material_index, texture_indices, image_queue, output_directory, sampler_index);
@@ -44,26 +98,16 @@ int utils::gltf::dmat::add_material_to_gltf(
     } else {
         material.pbrMetallicRoughness.baseColorFactor = { 0.133, 0.545, 0.133, 1.0 }; // Forest Green
     }
-    std::unordered_map<uint32_t, std::vector<uint32_t>>::iterator value;
-    uint32_t material_definition = dmat.material(material_index)->definition();
-    if((value = material_indices.find(material_definition)) != material_indices.end()) {
-        for(uint32_t index : value->second) {
-            if(gltf.materials.at(index) == material) {
-                return index;
-            }
-        }
-    } else {
-        material_indices[material_definition] = {};
-    }
-    material_indices[material_definition].push_back((uint32_t)gltf.materials.size());
     material.doubleSided = true;
 
+    uint32_t material_definition = dmat.material(material_index)->definition();
     if(utils::materials3::materials.at("materialDefinitions").contains(std::to_string(material_definition))){
         material.name = dme_name + "::" + utils::materials3::materials.at("materialDefinitions").at(std::to_string(material_definition)).at("name").get<std::string>();
     } else {
         material.name = dme_name + "::" + std::to_string(material_definition);
     }
     int to_return = (int)gltf.materials.size();
+    material_indices[key] = (uint32_t)to_return;
     gltf.materials.push_back(material);
     return to_return;
 }
@@ -73,17 +117,19 @@ int utils::gltf::dme::add_dme_to_gltf(
     tsqueue<std::pair<std::string, Semantic>> &image_queue,
     std::filesystem::path output_directory,
     std::unordered_map<uint32_t, uint32_t> &texture_indices, 
-    std::unordered_map<uint32_t, std::vector<uint32_t>> &material_indices,
+    std::unordered_map<uint64_t, uint32_t> &material_indices,
     int sampler_index,
     bool export_textures,
     bool include_skeleton,
-    bool rigify
+    bool rigify,
+    bool quantized
 ) {
+    utils::trace::Scope scope("gltf::add_dme");
     std::vector<int> mesh_nodes;
     int parent_index;
     for(uint32_t i = 0; i < dme.mesh_count(); i++) {
         int material_index = dmat::add_material_to_gltf(gltf, *dme.dmat(), i, sampler_index, export_textures, texture_indices, material_indices, image_queue, output_directory, dme.get_name());
-        int node_index = add_mesh_to_gltf(gltf, dme, i, material_index, include_skeleton);
+        int node_index = add_mesh_to_gltf(gltf, dme, i, material_index, include_skeleton, quantized);
         mesh_nodes.push_back(node_index);
         
         logger::debug("Added mesh {} to gltf", i);
@@ -104,12 +150,14 @@ int utils::gltf::dme::add_dme_to_gltf(
     return parent_index;
 }
 
-int utils::gltf::dme::add_mesh_to_gltf(tinygltf::Model &gltf, const DME &dme, uint32_t index, uint32_t material_index, bool include_skeleton) {
+int utils::gltf::dme::add_mesh_to_gltf(tinygltf::Model &gltf, const DME &dme, uint32_t index, uint32_t material_index, bool include_skeleton, bool quantized) {
+    utils::trace::Scope scope("gltf::add_mesh");
     int texcoord = 0;
     int color = 0;
     tinygltf::Mesh gltf_mesh;
     tinygltf::Primitive primitive;
-    std::shared_ptr<const Mesh> mesh = dme.mesh(index);
+    const Mesh *mesh = dme.mesh(index);
+    utils::metrics::add(utils::metrics::Counter::VerticesExpanded, mesh->vertex_count());
     std::vector<uint32_t> offsets((std::size_t)mesh->vertex_stream_count(), 0);
     std::optional<nlohmann::json> input_layout = utils::materials3::get_input_layout(dme.dmat()->material(index)->definition());
     if(!input_layout) {
@@ -125,10 +173,17 @@ int utils::gltf::dme::add_mesh_to_gltf(tinygltf::Model &gltf, const DME &dme, ui
         std::span<uint8_t> vertex_stream = mesh->vertex_stream(j);
         tinygltf::Buffer buffer;
         logger::debug("Expanding vertex stream {}", j);
-        buffer.data = expand_vertex_stream(*input_layout, vertex_stream, j, rigid, dme, mesh);
+        buffer.data = expand_vertex_stream(*input_layout, vertex_stream, j, rigid, dme, mesh, quantized);
         buffers.push_back(buffer);
     }
     logger::debug("Expanded vertex streams");
+    if(quantized) {
+        for(std::vector<std::string> *extensions : {&gltf.extensionsUsed, &gltf.extensionsRequired}) {
+            if(std::find(extensions->begin(), extensions->end(), "KHR_mesh_quantization") == extensions->end()) {
+                extensions->push_back("KHR_mesh_quantization");
+            }
+        }
+    }
     // using namespace std::chrono_literals;
     // std::this_thread::sleep_for(20ms);
 
@@ -146,6 +201,7 @@ int utils::gltf::dme::add_mesh_to_gltf(tinygltf::Model &gltf, const DME &dme, ui
         accessor.byteOffset = 0;
         accessor.componentType = utils::materials3::component_types.at(type);
         accessor.type = utils::materials3::types.at(type);
+        accessor.normalized = type == "ubyte4n" || type == "byte4n" || type == "short2n";
         accessor.count = mesh->vertex_count();
 
         tinygltf::BufferView bufferview;
@@ -171,6 +227,9 @@ int utils::gltf::dme::add_mesh_to_gltf(tinygltf::Model &gltf, const DME &dme, ui
             AABB aabb = dme.aabb();
             accessor.minValues = {aabb.min.x, aabb.min.y, aabb.min.z};
             accessor.maxValues = {aabb.max.x, aabb.max.y, aabb.max.z};
+        } else if(usage == "Normal" && type == "byte4n") {
+            // Quantized normals are padded to 4 bytes, but the attribute is a VEC3
+            accessor.type = TINYGLTF_TYPE_VEC3;
         } else if(usage == "Tangent") {
             accessor.normalized = true;
             offsets.at(stream) += utils::materials3::sizes.at(type);
@@ -235,6 +294,7 @@ int utils::gltf::dme::add_mesh_to_gltf(tinygltf::Model &gltf, const DME &dme, ui
 }
 
 int utils::gltf::dme::add_skeleton_to_gltf(tinygltf::Model &gltf, const DME &dme, std::vector<int> mesh_nodes, bool rigify) {
+    utils::trace::Scope scope("gltf::add_skeleton");
     for(int node_index : mesh_nodes) {
         gltf.nodes.at(node_index).skin = (int)gltf.skins.size();
     }
@@ -271,13 +331,12 @@ int utils::gltf::dme::add_skeleton_to_gltf(tinygltf::Model &gltf, const DME &dme
         bind_matrix[2] /= glm::length(bind_matrix[2]);
         glm::quat quat(bind_matrix);
         bone_node.rotation = {quat.x, quat.y, quat.z, quat.w};
-        std::unordered_map<uint32_t, std::string>::iterator name_iter;
-        if((name_iter = utils::bone_hashmap.find(namehash)) != utils::bone_hashmap.end()) {
-            std::unordered_map<std::string, std::string>::iterator rigify_iter;
-            if(rigify && (rigify_iter = utils::rigify_names.find(name_iter->second)) != utils::rigify_names.end()) {
-                bone_node.name = rigify_iter->second;
+        std::optional<std::string_view> bone_name = utils::bone_name(namehash), rigify_name;
+        if(bone_name) {
+            if(rigify && (rigify_name = utils::rigify_name(namehash))) {
+                bone_node.name = *rigify_name;
             } else {
-                bone_node.name = name_iter->second;
+                bone_node.name = *bone_name;
             }
         } else {
             logger::debug("Could not find a bone name for namehash {:#010x}", namehash);
@@ -298,14 +357,10 @@ int utils::gltf::dme::add_skeleton_to_gltf(tinygltf::Model &gltf, const DME &dme
     for(auto iter = skeleton_map.begin(); iter != skeleton_map.end(); iter++) {
         uint32_t curr_hash = iter->first;
         size_t curr_index = iter->second;
-        uint32_t parent = 0;
-        std::unordered_map<uint32_t, uint32_t>::iterator parent_iter;
-        if((parent_iter = utils::bone_hierarchy.find(curr_hash)) != utils::bone_hierarchy.end()) {
-            parent = parent_iter->second;
-        }
+        uint32_t parent = utils::bone_parent(curr_hash).value_or(0);
         std::unordered_map<uint32_t, size_t>::iterator parent_index;
         while(parent != 0 && (parent_index = skeleton_map.find(parent)) == skeleton_map.end()) {
-            parent = utils::bone_hierarchy.at(parent);
+            parent = utils::bone_parent(parent).value_or(0);
         }
         if(parent != 0) {
             // Bone has parent in the skeleton, add it to its parent's children
@@ -399,7 +454,8 @@ tinygltf::Model utils::gltf::dme::build_gltf_from_dme(
     bool export_textures, 
     bool include_skeleton,
     bool rigify,
-    int* parentIndexOut
+    int* parentIndexOut,
+    bool quantized
 ) {
     tinygltf::Model gltf;
     tinygltf::Sampler sampler;
@@ -414,9 +470,9 @@ tinygltf::Model utils::gltf::dme::build_gltf_from_dme(
     gltf.scenes.push_back({});
 
     std::unordered_map<uint32_t, uint32_t> texture_indices;
-    std::unordered_map<uint32_t, std::vector<uint32_t>> material_indices;
+    std::unordered_map<uint64_t, uint32_t> material_indices;
     
-    int parent_index = add_dme_to_gltf(gltf, dme, image_queue, output_directory, texture_indices, material_indices, sampler_index, export_textures, include_skeleton, rigify);
+    int parent_index = add_dme_to_gltf(gltf, dme, image_queue, output_directory, texture_indices, material_indices, sampler_index, export_textures, include_skeleton, rigify, quantized);
     
     if(parentIndexOut != nullptr) {
         *parentIndexOut = parent_index;
@@ -427,6 +483,74 @@ tinygltf::Model utils::gltf::dme::build_gltf_from_dme(
     return gltf;
 }
 
+// Reads an asset, counting its size towards the pack bytes read
+static std::vector<uint8_t> read_asset(std::shared_ptr<synthium::Asset2> asset) {
+    std::vector<uint8_t> data = asset->get_data();
+    utils::metrics::add(utils::metrics::Counter::PackBytesRead, data.size());
+    return data;
+}
+
+void utils::gltf::dmat::process_image(
+    synthium::Manager& manager, 
+    std::string texture_name, 
+    Semantic semantic, 
+    const std::filesystem::path &output_directory
+) {
+    std::string albedo_name;
+    size_t index;
+    switch (semantic)
+    {
+    case Semantic::Diffuse:
+    case Semantic::BaseDiffuse:
+    case Semantic::baseDiffuse:
+    case Semantic::diffuseTexture:
+    case Semantic::DiffuseB:
+    case Semantic::HoloTexture:
+    case Semantic::DecalTint:
+    case Semantic::TilingTint:
+    case Semantic::DetailMask:
+    case Semantic::detailMaskTexture:
+    case Semantic::DetailMaskMap:
+    case Semantic::TintMask:
+    case Semantic::Overlay:
+    case Semantic::Overlay1:
+    case Semantic::Overlay2:
+    case Semantic::Overlay3:
+    case Semantic::Overlay4:
+    case Semantic::TilingOverlay:
+        utils::textures::save_texture(texture_name, read_asset(manager.get(texture_name)), output_directory);
+        break;
+    case Semantic::Bump:
+    case Semantic::BumpMap:
+    case Semantic::BumpMap1:
+    case Semantic::BumpMap2:
+    case Semantic::BumpMap3:
+    case Semantic::bumpMap:
+        utils::textures::process_normalmap(texture_name, read_asset(manager.get(texture_name)), output_directory);
+        break;
+    case Semantic::Spec:
+    case Semantic::SpecMap:
+    case Semantic::SpecGlow:
+    case Semantic::SpecB:
+        albedo_name = texture_name;
+        index = albedo_name.find_last_of('_');
+        albedo_name[index + 1] = 'C';
+        if(manager.contains(albedo_name)) {
+            utils::textures::process_specular(texture_name, read_asset(manager.get(texture_name)), read_asset(manager.get(albedo_name)), output_directory);
+        } else {
+            utils::textures::save_texture(texture_name, read_asset(manager.get(texture_name)), output_directory);
+        }
+        break;
+    case Semantic::detailBump:
+    case Semantic::DetailBump:
+        utils::textures::process_detailcube(texture_name, read_asset(manager.get(texture_name)), output_directory);
+        break;
+    default:
+        logger::warn("Skipping unimplemented semantic: {} ({} {:#010x})", texture_name, semantic_name(semantic), (uint32_t)semantic);
+        break;
+    }
+}
+
 void utils::gltf::dmat::process_images(
     synthium::Manager& manager, 
     utils::tsqueue<std::pair<std::string, Semantic>>& queue, 
@@ -435,65 +559,11 @@ void utils::gltf::dmat::process_images(
     logger::debug("Got output directory {}", output_directory->string());
     while(!queue.is_closed()) {
         auto texture_info = queue.try_dequeue({"", Semantic::UNKNOWN});
-        std::string texture_name = texture_info.first, albedo_name;
-        size_t index;
-        Semantic semantic = texture_info.second;
-        if(semantic == Semantic::UNKNOWN) {
+        if(texture_info.second == Semantic::UNKNOWN) {
             logger::info("Got default value from try_dequeue, stopping thread.");
             break;
         }
-
-        switch (semantic)
-        {
-        case Semantic::Diffuse:
-        case Semantic::BaseDiffuse:
-        case Semantic::baseDiffuse:
-        case Semantic::diffuseTexture:
-        case Semantic::DiffuseB:
-        case Semantic::HoloTexture:
-        case Semantic::DecalTint:
-        case Semantic::TilingTint:
-        case Semantic::DetailMask:
-        case Semantic::detailMaskTexture:
-        case Semantic::DetailMaskMap:
-        case Semantic::TintMask:
-        case Semantic::Overlay:
-        case Semantic::Overlay1:
-        case Semantic::Overlay2:
-        case Semantic::Overlay3:
-        case Semantic::Overlay4:
-        case Semantic::TilingOverlay:
-            utils::textures::save_texture(texture_name, manager.get(texture_name)->get_data(), *output_directory);
-            break;
-        case Semantic::Bump:
-        case Semantic::BumpMap:
-        case Semantic::BumpMap1:
-        case Semantic::BumpMap2:
-        case Semantic::BumpMap3:
-        case Semantic::bumpMap:
-            utils::textures::process_normalmap(texture_name, manager.get(texture_name)->get_data(), *output_directory);
-            break;
-        case Semantic::Spec:
-        case Semantic::SpecMap:
-        case Semantic::SpecGlow:
-        case Semantic::SpecB:
-            albedo_name = texture_name;
-            index = albedo_name.find_last_of('_');
-            albedo_name[index + 1] = 'C';
-            if(manager.contains(albedo_name)) {
-                utils::textures::process_specular(texture_name, manager.get(texture_name)->get_data(), manager.get(albedo_name)->get_data(), *output_directory);
-            } else {
-                utils::textures::save_texture(texture_name, manager.get(texture_name)->get_data(), *output_directory);
-            }
-            break;
-        case Semantic::detailBump:
-        case Semantic::DetailBump:
-            utils::textures::process_detailcube(texture_name, manager.get(texture_name)->get_data(), *output_directory);
-            break;
-        default:
-            logger::warn("Skipping unimplemented semantic: {} ({})", texture_name, semantic_name(semantic));
-            break;
-        }
+        process_image(manager, texture_info.first, texture_info.second, *output_directory);
     }
 }
 
@@ -568,7 +638,7 @@ void utils::gltf::dmat::build_material(
             break;
         default:
             // Just export the texture
-            label = semantic_name(semantic);
+            label = std::string(semantic_name(semantic));
             texture_name = dmat.material(i)->texture(semantic);
             if(texture_name) {
                 uint32_t hash = jenkins::oaat(*texture_name);
@@ -676,14 +746,39 @@ std::optional<std::pair<tinygltf::TextureInfo, tinygltf::TextureInfo>> utils::gl
     return std::make_pair(metallic_roughness_info, emissive_info);
 }
 
+// How expand_vertex_stream rewrites a vertex entry
+enum class EntryConversion {
+    None,
+    HalfToFloat,
+    HalfToShortNormalized,
+};
+
+// True if every half float pair at `offset` in each vertex lies in [-1, 1], so it fits a normalized short
+static bool half_pairs_normalized(VertexStream &vertices, uint32_t offset, uint32_t stride) {
+    for(uint32_t vertex_offset = 0; vertex_offset + offset + 4 <= vertices.size(); vertex_offset += stride) {
+        for(uint32_t component = 0; component < 2; component++) {
+            if(std::fabs((float)(half)vertices.get<half>(vertex_offset + offset + component * 2)) > 1.0f) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static int16_t normalized_short(float value) {
+    return (int16_t)std::round(std::clamp(value, -1.0f, 1.0f) * 32767.0f);
+}
+
 std::vector<uint8_t> utils::gltf::dme::expand_vertex_stream(
     nlohmann::json &layout, 
     std::span<uint8_t> data, 
     uint32_t stream, 
     bool is_rigid, 
     const DME &dme,
-    std::shared_ptr<const Mesh> mesh
+    const Mesh *mesh,
+    bool quantized
 ) {
+    utils::trace::Scope scope("dme::expand_vertex_stream");
     VertexStream vertices(data);
     logger::trace("{}['{}']", layout.at("sizes").dump(), std::to_string(stream));
     uint32_t stride = layout.at("sizes")
@@ -695,7 +790,7 @@ std::vector<uint8_t> utils::gltf::dme::expand_vertex_stream(
         logger::error("VertexStream stride {} != InputLayout stride {}", mesh->bytes_per_vertex(stream), stride);
         std::exit(32);
     }
-    std::vector<std::pair<uint32_t, bool>> offsets;
+    std::vector<std::pair<uint32_t, EntryConversion>> offsets;
     bool conversion_required = false;
     int tangent_index = -1;
     int binormal_index = -1;
@@ -703,7 +798,7 @@ std::vector<uint8_t> utils::gltf::dme::expand_vertex_stream(
     int blend_indices_index = -1;
     int blend_weights_index = -1;
     int vert_index_offset = 0;
-    bool has_normals = false, bone_remapping = false, weight_conversion = false, expand_normals = false;
+    bool has_normals = false, bone_remapping = false, weight_conversion = false, expand_normals = false, quantize_normals = false;
 
     uint32_t byte_stride = 0;
 
@@ -722,21 +817,33 @@ std::vector<uint8_t> utils::gltf::dme::expand_vertex_stream(
         logger::debug("{}", entry.dump());
         std::string type = entry.at("type").get<std::string>();
         std::string usage = entry.at("usage").get<std::string>();
-        byte_stride += utils::materials3::sizes.at(type);
         bool needs_conversion = type == "Float16_2" || type == "float16_2";
-        offsets.push_back({
-            utils::materials3::sizes.at(type), 
-            needs_conversion
-        });
+        EntryConversion conversion = EntryConversion::None;
         if(needs_conversion) {
             conversion_required = true;
-            entry.at("type") = "Float2";
-            layout.at("sizes").at(std::to_string(stream)) = layout.at("sizes").at(std::to_string(stream)).get<uint32_t>() + 4;
+            if(quantized && usage == "Texcoord" && half_pairs_normalized(vertices, byte_stride, stride)) {
+                // Same size, so the stride is unchanged
+                conversion = EntryConversion::HalfToShortNormalized;
+                entry.at("type") = "short2n";
+            } else {
+                conversion = EntryConversion::HalfToFloat;
+                entry.at("type") = "Float2";
+                layout.at("sizes").at(std::to_string(stream)) = layout.at("sizes").at(std::to_string(stream)).get<uint32_t>() + 4;
+            }
         }
+        offsets.push_back({
+            utils::materials3::sizes.at(type), 
+            conversion
+        });
+        byte_stride += utils::materials3::sizes.at(type);
         
         if(usage == "Normal") {
             has_normals = true;
-            if(type == "ubyte4n") {
+            if(type == "ubyte4n" && quantized) {
+                // Rebiased in place to signed bytes, keeping the 4 byte element alignment
+                entry.at("type") = "byte4n";
+                quantize_normals = true;
+            } else if(type == "ubyte4n") {
                 entry.at("type") = "Float3";
                 layout.at("sizes").at(std::to_string(stream)) = layout.at("sizes").at(std::to_string(stream)).get<uint32_t>() + 8;
                 expand_normals = true;
@@ -749,7 +856,8 @@ std::vector<uint8_t> utils::gltf::dme::expand_vertex_stream(
         } else if (usage == "BlendIndices") {
             bone_remapping = true;
             blend_indices_index = i;
-        } else if (usage == "BlendWeight" && type == "ubyte4n") {
+        } else if (usage == "BlendWeight" && type == "ubyte4n" && !quantized) {
+            // Normalized unsigned byte weights are valid glTF, so quantized output keeps them
             weight_conversion = true;
             blend_weights_index = i;
             entry.at("type") = "Float4";
@@ -767,24 +875,26 @@ std::vector<uint8_t> utils::gltf::dme::expand_vertex_stream(
     bool calculate_normals = !has_normals && binormal_index != -1 && tangent_index != -1;
     bool add_rigid_bones = is_rigid && binormal_type == "ubyte4n";
 
-    if(!conversion_required && !calculate_normals && !add_rigid_bones && !bone_remapping && !weight_conversion && !expand_normals) {
+    if(!conversion_required && !calculate_normals && !add_rigid_bones && !bone_remapping && !weight_conversion && !expand_normals && !quantize_normals) {
         logger::debug("No conversion required!");
         return std::vector<uint8_t>(vertices.buf_.begin(), vertices.buf_.end());
     }
     
+    std::string normal_type = quantized ? "byte4n" : "Float3";
     if(calculate_normals) {
         logger::debug("Calculating normals from tangents and binormals");
-        layout.at("sizes").at(std::to_string(stream)) = layout.at("sizes").at(std::to_string(stream)).get<uint32_t>() + 12;
-        layout.at("entries") += nlohmann::json::parse("{\"stream\":"+std::to_string(stream)+",\"type\":\"Float3\",\"usage\":\"Normal\",\"usageIndex\":0}");
+        layout.at("sizes").at(std::to_string(stream)) = layout.at("sizes").at(std::to_string(stream)).get<uint32_t>() + utils::materials3::sizes.at(normal_type);
+        layout.at("entries") += nlohmann::json::parse("{\"stream\":"+std::to_string(stream)+",\"type\":\""+normal_type+"\",\"usage\":\"Normal\",\"usageIndex\":0}");
     }
 
+    std::string weight_type = quantized ? "ubyte4n" : "Float4";
     if(add_rigid_bones) {
         logger::debug("Adding rigid bone weights");
-        layout.at("sizes").at(std::to_string(stream)) = layout.at("sizes").at(std::to_string(stream)).get<uint32_t>() + 20;
+        layout.at("sizes").at(std::to_string(stream)) = layout.at("sizes").at(std::to_string(stream)).get<uint32_t>() + 4 + utils::materials3::sizes.at(weight_type);
         layout.at("entries") += nlohmann::json::parse("{\"stream\":"+std::to_string(stream)+",\"type\":\"D3dcolor\",\"usage\":\"BlendIndices\",\"usageIndex\":0}");
-        layout.at("entries") += nlohmann::json::parse("{\"stream\":"+std::to_string(stream)+",\"type\":\"Float4\",\"usage\":\"BlendWeight\",\"usageIndex\":0}");
+        layout.at("entries") += nlohmann::json::parse("{\"stream\":"+std::to_string(stream)+",\"type\":\""+weight_type+"\",\"usage\":\"BlendWeight\",\"usageIndex\":0}");
     }
-    int entries_count = std::count_if(offsets.begin(), offsets.end(), [](auto pair) { return pair.second; });
+    int entries_count = std::count_if(offsets.begin(), offsets.end(), [](auto pair) { return pair.second != EntryConversion::None; });
     logger::debug("Converting {} entries", entries_count);
     std::vector<uint8_t> output;
     for(uint32_t vertex_offset = 0; vertex_offset < vertices.size(); vertex_offset += stride) {
@@ -796,12 +906,24 @@ std::vector<uint8_t> utils::gltf::dme::expand_vertex_stream(
         uint16_t rigid_joint_index = 0;
 
         float converter[2] = {0, 0};
+        int16_t short_converter[2] = {0, 0};
+        int8_t normal_converter[4] = {0, 0, 0, 0};
         for(auto iter = offsets.begin(); iter != offsets.end(); iter++) {
             int index = (int)(iter - offsets.begin());
-            if(iter->second) {
+            if(iter->second == EntryConversion::HalfToFloat) {
                 converter[0] = (float)(half)vertices.get<half>(vertex_offset + entry_offset);
                 converter[1] = (float)(half)vertices.get<half>(vertex_offset + entry_offset + 2);
                 output.insert(output.end(), reinterpret_cast<uint8_t*>(converter), reinterpret_cast<uint8_t*>(converter) + 8);
+            } else if(iter->second == EntryConversion::HalfToShortNormalized) {
+                short_converter[0] = normalized_short((float)(half)vertices.get<half>(vertex_offset + entry_offset));
+                short_converter[1] = normalized_short((float)(half)vertices.get<half>(vertex_offset + entry_offset + 2));
+                output.insert(output.end(), reinterpret_cast<uint8_t*>(short_converter), reinterpret_cast<uint8_t*>(short_converter) + 4);
+            } else if(quantize_normals && index == normal_index - vert_index_offset) {
+                // Stored biased by 128, so subtracting it gives the signed normalized value
+                normal_converter[0] = (int8_t)((int)vertices.get<uint8_t>(vertex_offset + entry_offset) - 128);
+                normal_converter[1] = (int8_t)((int)vertices.get<uint8_t>(vertex_offset + entry_offset + 1) - 128);
+                normal_converter[2] = (int8_t)((int)vertices.get<uint8_t>(vertex_offset + entry_offset + 2) - 128);
+                output.insert(output.end(), reinterpret_cast<uint8_t*>(normal_converter), reinterpret_cast<uint8_t*>(normal_converter) + 4);
             } else if(expand_normals && index == normal_index - vert_index_offset) {
                 normal[0] = (float)vertices.get<uint8_t>(vertex_offset + entry_offset) / 128.0f - 1;
                 normal[1] = (float)vertices.get<uint8_t>(vertex_offset + entry_offset + 1) / 128.0f - 1;
@@ -862,14 +984,26 @@ std::vector<uint8_t> utils::gltf::dme::expand_vertex_stream(
             normal[2] *= sign;
             logger::trace("Normal:     ({: 0.2f} {: 0.2f} {: 0.2f})", normal[0], normal[1], normal[2], sign);
             logger::trace("Entry offset/stride: {} / {}", entry_offset, stride);
-            output.insert(output.end(), reinterpret_cast<uint8_t*>(normal), reinterpret_cast<uint8_t*>(normal) + 12);
+            if(quantized) {
+                normal_converter[0] = (int8_t)std::round(normal[0] * 127.0f);
+                normal_converter[1] = (int8_t)std::round(normal[1] * 127.0f);
+                normal_converter[2] = (int8_t)std::round(normal[2] * 127.0f);
+                output.insert(output.end(), reinterpret_cast<uint8_t*>(normal_converter), reinterpret_cast<uint8_t*>(normal_converter) + 4);
+            } else {
+                output.insert(output.end(), reinterpret_cast<uint8_t*>(normal), reinterpret_cast<uint8_t*>(normal) + 12);
+            }
         }
 
         if(add_rigid_bones) {
             uint8_t blend_indices[4] = {(uint8_t)rigid_joint_index, 0, 0, 0};
-            float blend_weights[4] = {1, 0, 0, 0};
             output.insert(output.end(), blend_indices, blend_indices + 4);
-            output.insert(output.end(), reinterpret_cast<uint8_t*>(blend_weights), reinterpret_cast<uint8_t*>(blend_weights) + 16);
+            if(quantized) {
+                uint8_t blend_weights[4] = {255, 0, 0, 0};
+                output.insert(output.end(), blend_weights, blend_weights + 4);
+            } else {
+                float blend_weights[4] = {1, 0, 0, 0};
+                output.insert(output.end(), reinterpret_cast<uint8_t*>(blend_weights), reinterpret_cast<uint8_t*>(blend_weights) + 16);
+            }
         }
     }
     logger::debug("Converted {} entries", entries_count);
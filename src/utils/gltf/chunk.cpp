@@ -5,6 +5,7 @@
 #include <glm/gtx/quaternion.hpp>
 
 #include "utils/textures.h"
+#include "utils/trace.h"
 #include "utils/gltf/common.h"
 #include "utils/tsqueue.h"
 
@@ -54,6 +55,7 @@ int utils::gltf::chunk::add_mesh_to_gltf(
     std::string name,
     bool include_colors
 ) {
+    utils::trace::Scope scope("gltf::add_chunk_mesh");
     uint32_t render_batch_count = chunk.render_batch_count();
     std::span<warpgate::chunk::RenderBatch> render_batches = chunk.render_batches();
     tinygltf::Node parent;
@@ -259,6 +261,7 @@ int utils::gltf::chunk::add_materials_to_gltf(
     std::string name,
     int sampler_index
 ) {
+    utils::trace::Scope scope("gltf::add_chunk_materials");
     int material_start_index = (int)gltf.materials.size();
     for(uint32_t texture = 0; texture < chunk.textures_count(); texture++) {
         tinygltf::Material material;
@@ -0,0 +1,261 @@
+#include "utils/gltf/flora.h"
+
+#define _USE_MATH_DEFINES
+#include <math.h>
+#include <algorithm>
+#include <random>
+
+#include "utils/metrics.h"
+#include "utils/trace.h"
+
+using namespace warpgate;
+
+namespace {
+    // Terrain heights of a chunk on a regular grid, sampled from its render batch vertices
+    class HeightGrid {
+    public:
+        static constexpr float cell_size = 2.0f;
+        static constexpr uint32_t cells = (uint32_t)(256.0f / cell_size) + 1;
+
+        HeightGrid(const chunk::CNK0 &chunk): heights(cells * cells, 0.0f) {
+            std::vector<uint32_t> counts(cells * cells, 0);
+            std::span<chunk::RenderBatch> render_batches = chunk.render_batches();
+            std::span<chunk::Vertex> vertices = chunk.vertices();
+            // Batches are laid out 4 to a row, 64 units apart, as in gltf::chunk::add_mesh_to_gltf
+            for(uint32_t batch = 0; batch < render_batches.size(); batch++) {
+                float offset_x = (batch % 4) * 64.0f, offset_z = (batch >> 2) * 64.0f;
+                uint32_t end = std::min(render_batches[batch].vertex_offset + render_batches[batch].vertex_count, (uint32_t)vertices.size());
+                for(uint32_t i = render_batches[batch].vertex_offset; i < end; i++) {
+                    uint32_t x = cell(offset_x + vertices[i].x), z = cell(offset_z + vertices[i].y);
+                    heights[z * cells + x] += (float)vertices[i].height_near / 32.0f;
+                    counts[z * cells + x]++;
+                }
+            }
+            for(uint32_t i = 0; i < heights.size(); i++) {
+                if(counts[i] > 0) {
+                    heights[i] /= counts[i];
+                }
+            }
+            fill_empty_cells(counts);
+        }
+
+        // Bilinear height at a position local to the chunk
+        float sample(float x, float z) const {
+            float grid_x = std::clamp(x / cell_size, 0.0f, (float)(cells - 1));
+            float grid_z = std::clamp(z / cell_size, 0.0f, (float)(cells - 1));
+            uint32_t x0 = std::min((uint32_t)grid_x, cells - 2), z0 = std::min((uint32_t)grid_z, cells - 2);
+            float tx = grid_x - x0, tz = grid_z - z0;
+            float top = heights[z0 * cells + x0] * (1 - tx) + heights[z0 * cells + x0 + 1] * tx;
+            float bottom = heights[(z0 + 1) * cells + x0] * (1 - tx) + heights[(z0 + 1) * cells + x0 + 1] * tx;
+            return top * (1 - tz) + bottom * tz;
+        }
+
+    private:
+        std::vector<float> heights;
+
+        static uint32_t cell(float position) {
+            return (uint32_t)std::clamp((int)std::lround(position / cell_size), 0, (int)cells - 1);
+        }
+
+        // Grows the sampled cells into the ones no vertex landed in, a ring at a time
+        void fill_empty_cells(std::vector<uint32_t> &counts) {
+            bool any_sampled = std::any_of(counts.begin(), counts.end(), [](uint32_t count) { return count > 0; });
+            bool changed = any_sampled;
+            while(changed) {
+                changed = false;
+                std::vector<uint32_t> filled = counts;
+                for(uint32_t z = 0; z < cells; z++) {
+                    for(uint32_t x = 0; x < cells; x++) {
+                        if(counts[z * cells + x] > 0) {
+                            continue;
+                        }
+                        float sum = 0.0f;
+                        uint32_t neighbours = 0;
+                        if(x > 0 && counts[z * cells + x - 1] > 0) { sum += heights[z * cells + x - 1]; neighbours++; }
+                        if(x + 1 < cells && counts[z * cells + x + 1] > 0) { sum += heights[z * cells + x + 1]; neighbours++; }
+                        if(z > 0 && counts[(z - 1) * cells + x] > 0) { sum += heights[(z - 1) * cells + x]; neighbours++; }
+                        if(z + 1 < cells && counts[(z + 1) * cells + x] > 0) { sum += heights[(z + 1) * cells + x]; neighbours++; }
+                        if(neighbours > 0) {
+                            heights[z * cells + x] = sum / neighbours;
+                            filled[z * cells + x] = 1;
+                            changed = true;
+                        }
+                    }
+                }
+                counts = std::move(filled);
+            }
+        }
+    };
+}
+
+void utils::gltf::flora::Instances::append(const Instances &other) {
+    translations.insert(translations.end(), other.translations.begin(), other.translations.end());
+    rotations.insert(rotations.end(), other.rotations.begin(), other.rotations.end());
+    scales.insert(scales.end(), other.scales.begin(), other.scales.end());
+}
+
+utils::gltf::flora::Ecosystems::Ecosystems(const zone::Zone &zone) {
+    std::unordered_map<std::string, uint32_t> flora_indices;
+    uint32_t flora_count = zone.flora_count();
+    for(uint32_t i = 0; i < flora_count; i++) {
+        std::shared_ptr<zone::Flora> flora = zone.flora(i);
+        flora_indices[flora->name()] = i;
+        flora_names.push_back(flora->name());
+        flora_models.push_back(flora->model());
+    }
+
+    uint32_t eco_count = zone.eco_count();
+    for(uint32_t i = 0; i < eco_count; i++) {
+        std::shared_ptr<zone::Eco> eco = zone.eco(i);
+        std::vector<std::optional<Layer>> &layers = ecos[eco->index()];
+        for(const zone::EcoLayer &eco_layer : eco->flora_info()->layers()) {
+            std::unordered_map<std::string, uint32_t>::iterator flora = flora_indices.find(eco_layer.flora_name());
+            if(flora == flora_indices.end()) {
+                layers.push_back({});
+                continue;
+            }
+            layers.push_back(Layer{
+                flora->second,
+                eco_layer.density(),
+                eco_layer.min_scale(),
+                eco_layer.max_scale(),
+                eco_layer.min_elevation(),
+                eco_layer.max_elevation()
+            });
+        }
+    }
+}
+
+const utils::gltf::flora::Layer *utils::gltf::flora::Ecosystems::layer(uint32_t eco_id, uint32_t flora_index) const {
+    std::unordered_map<uint32_t, std::vector<std::optional<Layer>>>::const_iterator eco = ecos.find(eco_id);
+    if(eco == ecos.end() || flora_index >= eco->second.size() || !eco->second[flora_index]) {
+        return nullptr;
+    }
+    return &*eco->second[flora_index];
+}
+
+std::unordered_map<uint32_t, utils::gltf::flora::Instances> utils::gltf::flora::scatter(
+    const chunk::CNK0 &chunk,
+    const Ecosystems &ecosystems,
+    glm::dvec3 origin,
+    float density_scale,
+    std::optional<utils::AABB> aabb
+) {
+    utils::trace::Scope scope("flora::scatter");
+    std::unordered_map<uint32_t, Instances> instances;
+    std::vector<chunk::Tile> tiles = chunk.tiles();
+    if(tiles.size() == 0) {
+        return instances;
+    }
+
+    // Tiles evenly divide the chunk, so the number of distinct tile coordinates gives their size
+    std::vector<int32_t> columns, rows;
+    for(const chunk::Tile &tile : tiles) {
+        columns.push_back(tile.x());
+        rows.push_back(tile.y());
+    }
+    std::sort(columns.begin(), columns.end());
+    columns.erase(std::unique(columns.begin(), columns.end()), columns.end());
+    std::sort(rows.begin(), rows.end());
+    rows.erase(std::unique(rows.begin(), rows.end()), rows.end());
+    float tile_size = 256.0f / std::max(columns.size(), rows.size());
+    HeightGrid terrain(chunk);
+
+    size_t scattered = 0;
+    for(uint32_t tile_index = 0; tile_index < tiles.size(); tile_index++) {
+        float tile_x = (std::lower_bound(columns.begin(), columns.end(), (int32_t)tiles[tile_index].x()) - columns.begin()) * tile_size;
+        float tile_z = (std::lower_bound(rows.begin(), rows.end(), (int32_t)tiles[tile_index].y()) - rows.begin()) * tile_size;
+        for(const chunk::Eco &eco : tiles[tile_index].ecos()) {
+            std::vector<chunk::Flora> floras = eco.floras();
+            for(uint32_t flora_index = 0; flora_index < floras.size(); flora_index++) {
+                const Layer *layer = ecosystems.layer(eco.id(), flora_index);
+                if(layer == nullptr || floras[flora_index].layer_count() == 0) {
+                    continue;
+                }
+
+                std::seed_seq seed{(uint32_t)(int32_t)origin.x, (uint32_t)(int32_t)origin.z, tile_index, (uint32_t)eco.id(), flora_index};
+                std::mt19937 random(seed);
+                auto uniform = [&random]() { return (float)(random() >> 8) / 16777216.0f; };
+
+                float expected = layer->density * tile_size * tile_size * density_scale;
+                uint32_t count = (uint32_t)expected + (uniform() < expected - std::floor(expected) ? 1 : 0);
+                bool limit_elevation = layer->max_elevation > layer->min_elevation;
+                Instances &flora_instances = instances[layer->flora];
+                for(uint32_t i = 0; i < count; i++) {
+                    float x = tile_x + uniform() * tile_size, z = tile_z + uniform() * tile_size;
+                    float yaw = uniform() * 2.0f * (float)M_PI;
+                    float scale = layer->min_scale + uniform() * (layer->max_scale - layer->min_scale);
+                    float height = terrain.sample(x, z);
+                    if(limit_elevation && (height < layer->min_elevation || height > layer->max_elevation)) {
+                        continue;
+                    }
+                    glm::dvec3 position = origin + glm::dvec3(x, height, z);
+                    if(aabb && !aabb->contains(position)) {
+                        continue;
+                    }
+                    flora_instances.translations.insert(flora_instances.translations.end(), {(float)position.x, (float)position.y, (float)position.z});
+                    flora_instances.rotations.insert(flora_instances.rotations.end(), {0.0f, std::sin(yaw / 2), 0.0f, std::cos(yaw / 2)});
+                    flora_instances.scales.insert(flora_instances.scales.end(), {scale, scale, scale});
+                    scattered++;
+                }
+            }
+        }
+    }
+    utils::metrics::add(utils::metrics::Counter::FloraInstancesScattered, scattered);
+    return instances;
+}
+
+void utils::gltf::flora::add_instances_to_gltf(tinygltf::Model &gltf, int model_node, const Instances &instances) {
+    std::vector<int> mesh_nodes;
+    if(gltf.nodes.at(model_node).mesh != -1) {
+        mesh_nodes.push_back(model_node);
+    }
+    for(int child : gltf.nodes.at(model_node).children) {
+        if(gltf.nodes.at(child).mesh != -1) {
+            mesh_nodes.push_back(child);
+        }
+    }
+    if(mesh_nodes.size() == 0 || instances.size() == 0) {
+        return;
+    }
+
+    int buffer_index = (int)gltf.buffers.size();
+    tinygltf::Buffer buffer;
+    tinygltf::Value::Object attributes;
+    const std::pair<const char*, const std::vector<float>*> streams[] = {
+        {"TRANSLATION", &instances.translations},
+        {"ROTATION", &instances.rotations},
+        {"SCALE", &instances.scales},
+    };
+    for(auto[attribute, values] : streams) {
+        tinygltf::BufferView bufferview;
+        bufferview.buffer = buffer_index;
+        bufferview.byteOffset = buffer.data.size();
+        bufferview.byteLength = values->size() * sizeof(float);
+        buffer.data.insert(
+            buffer.data.end(),
+            reinterpret_cast<const uint8_t*>(values->data()),
+            reinterpret_cast<const uint8_t*>(values->data()) + bufferview.byteLength
+        );
+
+        tinygltf::Accessor accessor;
+        accessor.bufferView = (int)gltf.bufferViews.size();
+        accessor.byteOffset = 0;
+        accessor.componentType = TINYGLTF_COMPONENT_TYPE_FLOAT;
+        accessor.type = values == &instances.rotations ? TINYGLTF_TYPE_VEC4 : TINYGLTF_TYPE_VEC3;
+        accessor.count = instances.size();
+
+        attributes[attribute] = tinygltf::Value((int)gltf.accessors.size());
+        gltf.bufferViews.push_back(bufferview);
+        gltf.accessors.push_back(accessor);
+    }
+    gltf.buffers.push_back(buffer);
+
+    for(int node : mesh_nodes) {
+        gltf.nodes.at(node).extensions["EXT_mesh_gpu_instancing"] = tinygltf::Value(tinygltf::Value::Object());
+        gltf.nodes.at(node).extensions["EXT_mesh_gpu_instancing"].Get<tinygltf::Value::Object>()["attributes"] = tinygltf::Value(attributes);
+    }
+    if(std::find(gltf.extensionsUsed.begin(), gltf.extensionsUsed.end(), "EXT_mesh_gpu_instancing") == gltf.extensionsUsed.end()) {
+        gltf.extensionsUsed.push_back("EXT_mesh_gpu_instancing");
+    }
+}
@@ -0,0 +1,415 @@
+#include "utils/gltf/meshopt.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <optional>
+#include <span>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <spdlog/spdlog.h>
+
+#ifdef WARPGATE_USE_MESHOPTIMIZER
+#include <meshoptimizer.h>
+#endif
+
+#include "json.hpp"
+#include "utils/trace.h"
+
+namespace logger = spdlog;
+using namespace warpgate;
+
+bool utils::gltf::meshopt::available() {
+#ifdef WARPGATE_USE_MESHOPTIMIZER
+    return true;
+#else
+    return false;
+#endif
+}
+
+#ifdef WARPGATE_USE_MESHOPTIMIZER
+namespace {
+    // The interleaved vertex records of one buffer that a primitive's attributes read from
+    struct Stream {
+        int buffer;
+        size_t base, stride, count;
+        std::vector<int> accessors;
+    };
+
+    size_t element_size(const tinygltf::Accessor &accessor) {
+        return (size_t)tinygltf::GetComponentSizeInBytes(accessor.componentType)
+            * (size_t)tinygltf::GetNumComponentsInType(accessor.type);
+    }
+
+    size_t accessor_start(const tinygltf::Model &gltf, const tinygltf::Accessor &accessor) {
+        return gltf.bufferViews.at(accessor.bufferView).byteOffset + accessor.byteOffset;
+    }
+
+    std::optional<std::vector<Stream>> vertex_streams(const tinygltf::Model &gltf, const tinygltf::Primitive &primitive) {
+        std::vector<Stream> streams;
+        for(auto &[attribute, index] : primitive.attributes) {
+            const tinygltf::Accessor &accessor = gltf.accessors.at(index);
+            if(accessor.bufferView < 0 || accessor.sparse.isSparse) {
+                return {};
+            }
+            const tinygltf::BufferView &view = gltf.bufferViews.at(accessor.bufferView);
+            size_t stride = view.byteStride != 0 ? view.byteStride : element_size(accessor);
+            size_t start = accessor_start(gltf, accessor);
+            size_t base = start - start % stride;
+            if(start - base + element_size(accessor) > stride || (!streams.empty() && accessor.count != streams.front().count)) {
+                return {};
+            }
+            auto stream = std::find_if(streams.begin(), streams.end(), [&](const Stream &other) {
+                return other.buffer == view.buffer && other.base == base && other.stride == stride;
+            });
+            if(stream == streams.end()) {
+                streams.push_back({view.buffer, base, stride, accessor.count, {index}});
+            } else {
+                stream->accessors.push_back(index);
+            }
+        }
+        for(const Stream &stream : streams) {
+            if(stream.base + stream.count * stream.stride > gltf.buffers.at(stream.buffer).data.size()) {
+                return {};
+            }
+        }
+        if(streams.empty()) {
+            return {};
+        }
+        return streams;
+    }
+
+    std::optional<std::vector<uint32_t>> read_indices(const tinygltf::Model &gltf, const tinygltf::Accessor &accessor) {
+        if(accessor.bufferView < 0 || accessor.sparse.isSparse) {
+            return {};
+        }
+        const tinygltf::BufferView &view = gltf.bufferViews.at(accessor.bufferView);
+        const std::vector<uint8_t> &data = gltf.buffers.at(view.buffer).data;
+        size_t start = accessor_start(gltf, accessor), size = element_size(accessor);
+        if((size != 2 && size != 4) || start + accessor.count * size > data.size()) {
+            return {};
+        }
+        std::vector<uint32_t> indices(accessor.count);
+        for(size_t i = 0; i < accessor.count; i++) {
+            if(size == 2) {
+                uint16_t index;
+                std::memcpy(&index, data.data() + start + i * size, size);
+                indices[i] = index;
+            } else {
+                std::memcpy(&indices[i], data.data() + start + i * size, size);
+            }
+        }
+        return indices;
+    }
+
+    void write_indices(tinygltf::Model &gltf, const tinygltf::Accessor &accessor, std::span<const uint32_t> indices) {
+        const tinygltf::BufferView &view = gltf.bufferViews.at(accessor.bufferView);
+        std::vector<uint8_t> &data = gltf.buffers.at(view.buffer).data;
+        size_t start = accessor_start(gltf, accessor), size = element_size(accessor);
+        for(size_t i = 0; i < indices.size(); i++) {
+            if(size == 2) {
+                uint16_t index = (uint16_t)indices[i];
+                std::memcpy(data.data() + start + i * size, &index, size);
+            } else {
+                std::memcpy(data.data() + start + i * size, &indices[i], size);
+            }
+        }
+    }
+
+    void optimize_primitive(tinygltf::Model &gltf, const tinygltf::Primitive &primitive, bool reorder_vertices) {
+        const tinygltf::Accessor &index_accessor = gltf.accessors.at(primitive.indices);
+        std::optional<std::vector<uint32_t>> indices = read_indices(gltf, index_accessor);
+        std::optional<std::vector<Stream>> streams = vertex_streams(gltf, primitive);
+        if(!indices || !streams || indices->size() % 3 != 0) {
+            return;
+        }
+        size_t vertex_count = streams->front().count;
+        if(std::any_of(indices->begin(), indices->end(), [vertex_count](uint32_t index) { return index >= vertex_count; })) {
+            logger::warn("Skipping optimization of a primitive with out of range indices");
+            return;
+        }
+
+        std::vector<uint32_t> optimized(indices->size());
+        meshopt_optimizeVertexCache(optimized.data(), indices->data(), indices->size(), vertex_count);
+
+        auto position = primitive.attributes.find("POSITION");
+        if(position != primitive.attributes.end()) {
+            const tinygltf::Accessor &position_accessor = gltf.accessors.at(position->second);
+            auto stream = std::find_if(streams->begin(), streams->end(), [&](const Stream &stream) {
+                return std::find(stream.accessors.begin(), stream.accessors.end(), position->second) != stream.accessors.end();
+            });
+            if(position_accessor.componentType == TINYGLTF_COMPONENT_TYPE_FLOAT && position_accessor.type == TINYGLTF_TYPE_VEC3 && stream->stride % sizeof(float) == 0) {
+                const float *positions = reinterpret_cast<const float*>(gltf.buffers.at(stream->buffer).data.data() + accessor_start(gltf, position_accessor));
+                // Allows the vertex cache hit ratio to get 5% worse in exchange for less overdraw
+                meshopt_optimizeOverdraw(indices->data(), optimized.data(), optimized.size(), positions, vertex_count, stream->stride, 1.05f);
+                optimized.swap(*indices);
+            }
+        }
+
+        if(reorder_vertices) {
+            std::vector<uint32_t> remap(vertex_count);
+            size_t referenced = meshopt_optimizeVertexFetchRemap(remap.data(), optimized.data(), optimized.size(), vertex_count);
+            // Unreferenced vertices are kept after the others, so accessor counts and bounds stay exact
+            uint32_t next = (uint32_t)referenced;
+            for(uint32_t &target : remap) {
+                if(target == ~0u) {
+                    target = next++;
+                }
+            }
+            meshopt_remapIndexBuffer(optimized.data(), optimized.data(), optimized.size(), remap.data());
+            for(const Stream &stream : *streams) {
+                uint8_t *records = gltf.buffers.at(stream.buffer).data.data() + stream.base;
+                std::vector<uint8_t> remapped(stream.count * stream.stride);
+                for(size_t vertex = 0; vertex < stream.count; vertex++) {
+                    std::memcpy(remapped.data() + remap[vertex] * stream.stride, records + vertex * stream.stride, stream.stride);
+                }
+                std::memcpy(records, remapped.data(), remapped.size());
+            }
+        }
+        write_indices(gltf, index_accessor, optimized);
+    }
+
+    void align(std::vector<uint8_t> &data) {
+        data.resize((data.size() + 3) & ~(size_t)3);
+    }
+
+    tinygltf::Value compression_extension(size_t offset, size_t length, size_t stride, size_t count, std::string mode) {
+        tinygltf::Value::Object extension;
+        extension["buffer"] = tinygltf::Value(0);
+        extension["byteOffset"] = tinygltf::Value((int)offset);
+        extension["byteLength"] = tinygltf::Value((int)length);
+        extension["byteStride"] = tinygltf::Value((int)stride);
+        extension["count"] = tinygltf::Value((int)count);
+        extension["mode"] = tinygltf::Value(mode);
+        return tinygltf::Value(extension);
+    }
+}
+#endif
+
+void utils::gltf::meshopt::optimize(tinygltf::Model &gltf, uint32_t thread_count) {
+#ifdef WARPGATE_USE_MESHOPTIMIZER
+    utils::trace::Scope scope("meshopt::optimize");
+    // Meshes can share accessors (e.g. zone objects using the same model), so each index accessor is optimized once
+    std::vector<const tinygltf::Primitive*> primitives;
+    std::unordered_map<int, const tinygltf::Primitive*> seen;
+    // Vertex records are only reordered if no other primitive reads them
+    std::map<std::pair<int, size_t>, uint32_t> stream_users;
+    for(const tinygltf::Mesh &mesh : gltf.meshes) {
+        for(const tinygltf::Primitive &primitive : mesh.primitives) {
+            if(primitive.indices < 0 || primitive.mode != TINYGLTF_MODE_TRIANGLES || !primitive.targets.empty()
+                || !seen.emplace(primitive.indices, &primitive).second) {
+                continue;
+            }
+            primitives.push_back(&primitive);
+            if(std::optional<std::vector<Stream>> streams = vertex_streams(gltf, primitive)) {
+                for(const Stream &stream : *streams) {
+                    stream_users[{stream.buffer, stream.base}]++;
+                }
+            }
+        }
+    }
+
+    std::atomic_size_t next = 0;
+    auto worker = [&]() {
+        size_t index;
+        while((index = next++) < primitives.size()) {
+            const tinygltf::Primitive &primitive = *primitives[index];
+            std::optional<std::vector<Stream>> streams = vertex_streams(gltf, primitive);
+            bool exclusive = streams && std::all_of(streams->begin(), streams->end(), [&](const Stream &stream) {
+                return stream_users.at({stream.buffer, stream.base}) == 1;
+            });
+            optimize_primitive(gltf, primitive, exclusive);
+        }
+    };
+    std::vector<std::thread> pool;
+    for(uint32_t i = 0; i < std::max(1u, thread_count); i++) {
+        pool.push_back(std::thread(worker));
+    }
+    for(std::thread &thread : pool) {
+        thread.join();
+    }
+    logger::info("Optimized {} primitive{}", primitives.size(), primitives.size() == 1 ? "" : "s");
+#else
+    logger::warn("warpgate was built without meshoptimizer, skipping mesh optimization");
+#endif
+}
+
+void utils::gltf::meshopt::compress(tinygltf::Model &gltf) {
+#ifdef WARPGATE_USE_MESHOPTIMIZER
+    utils::trace::Scope scope("meshopt::compress");
+    // EXT_meshopt_compression only defines version 0 of the vertex codec
+    meshopt_encodeVertexVersion(0);
+    meshopt_encodeIndexVersion(1);
+
+    tinygltf::Buffer packed, fallback;
+    size_t fallback_length = 0;
+    std::vector<tinygltf::BufferView> views;
+    std::vector<bool> moved(gltf.accessors.size(), false);
+    // Views left uncompressed are copied once, and every accessor reading them is redirected
+    std::unordered_map<int, int> copied_views;
+
+    auto add_compressed_view = [&](std::span<const uint8_t> encoded, size_t length, size_t stride, size_t count, std::string mode, int target) {
+        align(packed.data);
+        size_t offset = packed.data.size();
+        packed.data.insert(packed.data.end(), encoded.begin(), encoded.end());
+
+        tinygltf::BufferView view;
+        view.buffer = 1;
+        view.byteOffset = fallback_length;
+        view.byteLength = length;
+        view.byteStride = mode == "ATTRIBUTES" ? stride : 0;
+        view.target = target;
+        view.extensions["EXT_meshopt_compression"] = compression_extension(offset, encoded.size(), stride, count, mode);
+        fallback_length += (length + 3) & ~(size_t)3;
+        views.push_back(view);
+        return (int)views.size() - 1;
+    };
+
+    // Streams are found before any accessor is moved, since moving them changes which views they refer to
+    std::vector<std::pair<const tinygltf::Primitive*, std::vector<Stream>>> primitives;
+    for(const tinygltf::Mesh &mesh : gltf.meshes) {
+        for(const tinygltf::Primitive &primitive : mesh.primitives) {
+            if(std::optional<std::vector<Stream>> streams = vertex_streams(gltf, primitive)) {
+                primitives.push_back({&primitive, *streams});
+            }
+        }
+    }
+
+    size_t compressed_streams = 0;
+    for(auto &[primitive_pointer, streams] : primitives) {
+        const tinygltf::Primitive &primitive = *primitive_pointer;
+        for(const Stream &stream : streams) {
+            // The codec needs 4 byte aligned records, and glTF limits vertex strides to 252 bytes
+            bool already_moved = std::any_of(stream.accessors.begin(), stream.accessors.end(), [&](int index) { return moved[index]; });
+            if(already_moved || stream.stride % 4 != 0 || stream.stride > 252) {
+                continue;
+            }
+            const uint8_t *records = gltf.buffers.at(stream.buffer).data.data() + stream.base;
+            std::vector<uint8_t> encoded(meshopt_encodeVertexBufferBound(stream.count, stream.stride));
+            encoded.resize(meshopt_encodeVertexBuffer(encoded.data(), encoded.size(), records, stream.count, stream.stride));
+            int view = add_compressed_view(encoded, stream.count * stream.stride, stream.stride, stream.count, "ATTRIBUTES", TINYGLTF_TARGET_ARRAY_BUFFER);
+            for(int index : stream.accessors) {
+                gltf.accessors.at(index).byteOffset = accessor_start(gltf, gltf.accessors.at(index)) - stream.base;
+                gltf.accessors.at(index).bufferView = view;
+                moved[index] = true;
+            }
+            compressed_streams++;
+        }
+
+        if(primitive.indices < 0 || moved[primitive.indices]) {
+            continue;
+        }
+        tinygltf::Accessor &index_accessor = gltf.accessors.at(primitive.indices);
+        // Index accessors are only read while they still refer to the original views
+        std::optional<std::vector<uint32_t>> indices = read_indices(gltf, index_accessor);
+        if(!indices) {
+            continue;
+        }
+        size_t index_size = element_size(index_accessor);
+        std::vector<uint8_t> encoded;
+        std::string mode;
+        if(primitive.mode == TINYGLTF_MODE_TRIANGLES && indices->size() % 3 == 0) {
+            mode = "TRIANGLES";
+            encoded.resize(meshopt_encodeIndexBufferBound(indices->size(), streams.front().count));
+            encoded.resize(meshopt_encodeIndexBuffer(encoded.data(), encoded.size(), indices->data(), indices->size()));
+        } else {
+            mode = "INDICES";
+            encoded.resize(meshopt_encodeIndexSequenceBound(indices->size(), streams.front().count));
+            encoded.resize(meshopt_encodeIndexSequence(encoded.data(), encoded.size(), indices->data(), indices->size()));
+        }
+        index_accessor.bufferView = add_compressed_view(encoded, indices->size() * index_size, index_size, indices->size(), mode, TINYGLTF_TARGET_ELEMENT_ARRAY_BUFFER);
+        index_accessor.byteOffset = 0;
+        moved[primitive.indices] = true;
+        compressed_streams++;
+    }
+
+    // Everything else (inverse bind matrices, streams the codec cannot encode) is stored as is
+    for(size_t index = 0; index < gltf.accessors.size(); index++) {
+        tinygltf::Accessor &accessor = gltf.accessors[index];
+        if(moved[index] || accessor.bufferView < 0) {
+            continue;
+        }
+        auto copied = copied_views.find(accessor.bufferView);
+        if(copied == copied_views.end()) {
+            tinygltf::BufferView view = gltf.bufferViews.at(accessor.bufferView);
+            const std::vector<uint8_t> &data = gltf.buffers.at(view.buffer).data;
+            align(packed.data);
+            size_t offset = packed.data.size();
+            packed.data.insert(packed.data.end(), data.begin() + view.byteOffset, data.begin() + view.byteOffset + view.byteLength);
+            view.buffer = 0;
+            view.byteOffset = offset;
+            views.push_back(view);
+            copied = copied_views.emplace(accessor.bufferView, (int)views.size() - 1).first;
+        }
+        accessor.bufferView = copied->second;
+    }
+
+    align(packed.data);
+    fallback.extensions["EXT_meshopt_compression"] = tinygltf::Value(tinygltf::Value::Object{{"fallback", tinygltf::Value(true)}});
+    gltf.buffers = {packed, fallback};
+    gltf.bufferViews = views;
+    for(std::vector<std::string> *extensions : {&gltf.extensionsUsed, &gltf.extensionsRequired}) {
+        if(std::find(extensions->begin(), extensions->end(), "EXT_meshopt_compression") == extensions->end()) {
+            extensions->push_back("EXT_meshopt_compression");
+        }
+    }
+    logger::info("Compressed {} vertex and index streams from {} to {} bytes", compressed_streams, fallback_length, packed.data.size());
+#else
+    logger::warn("warpgate was built without meshoptimizer, skipping meshopt compression");
+#endif
+}
+
+bool utils::gltf::meshopt::write_glb(tinygltf::Model &gltf, const std::filesystem::path &path) {
+    std::stringstream stream;
+    tinygltf::TinyGLTF writer;
+    if(!writer.WriteGltfSceneToStream(&gltf, stream, false, true)) {
+        logger::error("Failed to serialize {}", path.string());
+        return false;
+    }
+    std::string glb = stream.str();
+    uint32_t json_length;
+    std::memcpy(&json_length, glb.data() + 12, sizeof(json_length));
+    nlohmann::json json = nlohmann::json::parse(glb.substr(20, json_length));
+    std::string binary_chunk = glb.substr(20 + json_length);
+
+    // A fallback buffer has no data, but its length must cover the views that refer to it
+    for(size_t buffer = 0; buffer < gltf.buffers.size(); buffer++) {
+        if(gltf.buffers[buffer].extensions.find("EXT_meshopt_compression") == gltf.buffers[buffer].extensions.end()) {
+            continue;
+        }
+        size_t length = 0;
+        for(const tinygltf::BufferView &view : gltf.bufferViews) {
+            if(view.buffer == (int)buffer) {
+                length = std::max(length, view.byteOffset + view.byteLength);
+            }
+        }
+        nlohmann::json &buffer_json = json.at("buffers").at(buffer);
+        buffer_json.erase("uri");
+        buffer_json["byteLength"] = length;
+        buffer_json["extensions"]["EXT_meshopt_compression"]["fallback"] = true;
+    }
+
+    std::string json_chunk = json.dump();
+    json_chunk.resize((json_chunk.size() + 3) & ~(size_t)3, ' ');
+    uint32_t header[5] = {
+        0x46546C67, // glTF
+        2,
+        (uint32_t)(20 + json_chunk.size() + binary_chunk.size()),
+        (uint32_t)json_chunk.size(),
+        0x4E4F534A, // JSON
+    };
+    std::ofstream output(path, std::ios::binary);
+    output.write(reinterpret_cast<const char*>(header), sizeof(header));
+    output.write(json_chunk.data(), json_chunk.size());
+    output.write(binary_chunk.data(), binary_chunk.size());
+    if(output.fail()) {
+        logger::error("Failed to write {}", path.string());
+        return false;
+    }
+    return true;
+}
@@ -48,8 +48,8 @@ GLboolean get_normalized(std::string type, std::string usage) {
 }
 
 Mesh::Mesh(
-    std::shared_ptr<const warpgate::Mesh> mesh,
-    std::shared_ptr<const warpgate::Material> material,
+    const warpgate::Mesh *mesh,
+    const warpgate::Material *material,
     nlohmann::json layout,
     std::unordered_map<uint32_t, std::shared_ptr<Texture>> &textures,
     std::shared_ptr<synthium::Manager> manager
@@ -28,10 +28,10 @@ Skeleton::Skeleton(std::shared_ptr<DME> dme) {
     for(uint32_t bone_index = 0; bone_index < dme->bone_count(); bone_index++) {
         warpgate::Bone dme_bone = dme->bone(bone_index);
         uint32_t namehash = dme_bone.namehash;
-        auto bone_it = utils::bone_hashmap.find(namehash);
+        std::optional<std::string_view> bone_name = utils::bone_name(namehash);
         std::shared_ptr<gtk::Bone> bone;
-        if(bone_it != utils::bone_hashmap.end()) {
-            bone = std::make_shared<gtk::Bone>(bone_it->second, get_inverse_bind_matrix(dme_bone));
+        if(bone_name) {
+            bone = std::make_shared<gtk::Bone>(std::string(*bone_name), get_inverse_bind_matrix(dme_bone));
         } else {
             bone = std::make_shared<gtk::Bone>(std::to_string(namehash), get_inverse_bind_matrix(dme_bone));
         }
@@ -39,14 +39,10 @@ Skeleton::Skeleton(std::shared_ptr<DME> dme) {
         m_skeleton.push_back(bone); // preserve bone index
     }
     for(auto it = bones.begin(); it != bones.end(); it++) {
-        std::unordered_map<uint32_t, uint32_t>::iterator parent_iter;
-        uint32_t parent = 0;
-        if((parent_iter = utils::bone_hierarchy.find(it->first)) != utils::bone_hierarchy.end()) {
-            parent = parent_iter->second;
-        }
+        uint32_t parent = utils::bone_parent(it->first).value_or(0);
         std::unordered_map<uint32_t, std::shared_ptr<gtk::Bone>>::iterator parent_index;
         while(parent != 0 && (parent_index = bones.find(parent)) == bones.end()) {
-            parent = utils::bone_hierarchy.at(parent);
+            parent = utils::bone_parent(parent).value_or(0);
         }
         if(parent != 0) {
             // Bone has parent in the skeleton, add it to its parent's children
@@ -27,7 +27,8 @@ struct ParameterData {
     warpgate::Parameter::D3DXParamClass paramclass;
     warpgate::Parameter::D3DXParamType paramtype;
     std::vector<uint8_t> data;
-    std::shared_ptr<const warpgate::Material> material;
+    // Texture bound to the parameter's semantic, resolved while the DMAT is alive
+    std::optional<std::string> texture;
 };
 
 class Asset2ListItem : public Glib::Object {
@@ -618,7 +619,7 @@ void handle_parameter(ParameterData* parameter, std::shared_ptr<Gio::ListStore<A
         case warpgate::Parameter::D3DXParamType::TEXTURE2D:
         case warpgate::Parameter::D3DXParamType::TEXTURE3D:
         case warpgate::Parameter::D3DXParamType::TEXTURECUBE:{
-            std::optional<std::string> texture_name = parameter->material->texture(parameter->semantic);
+            std::optional<std::string> texture_name = parameter->texture;
             if(!texture_name.has_value()) {
                 std::stringstream stream;
                 stream << std::setw(8) << std::setfill('0') << std::uppercase << std::hex << *(uint32_t*)parameter->data.data();
@@ -731,7 +732,7 @@ std::shared_ptr<Gio::ListStore<Asset2ListItem>> Window::create_namelist_model(co
         std::vector<uint8_t> data = m_manager->get(*col->virtual_parent)->get_data();
         warpgate::DMAT dmat(data);
         uint32_t material_definition = std::stoul(*col->virtual_type);
-        std::shared_ptr<const warpgate::Material> material = nullptr;
+        const warpgate::Material *material = nullptr;
         for(uint32_t i = 0; i < dmat.material_count(); i++) {
             if(dmat.material(i)->definition() == material_definition) {
                 material = dmat.material(i);
@@ -746,7 +747,7 @@ std::shared_ptr<Gio::ListStore<Asset2ListItem>> Window::create_namelist_model(co
         for(uint32_t i = 0; i < material->param_count(); i++) {
             auto parameter = material->parameter(i);
             auto parameter_li = Asset2ListItem::create(
-                warpgate::semantic_name(parameter.semantic_hash()),
+                std::string(warpgate::semantic_name(parameter.semantic_hash())),
                 AssetType::PARAMETER
             );
 
@@ -759,7 +760,7 @@ std::shared_ptr<Gio::ListStore<Asset2ListItem>> Window::create_namelist_model(co
             data->paramtype = parameter.type();
             std::span<uint8_t> span = parameter.data();
             data->data = std::vector<uint8_t>(span.begin(), span.end());
-            data->material = material;
+            data->texture = material->texture(parameter.semantic_hash());
 
             // listitem takes ownership of data
             parameter_li->user_data = (void*)data;
@@ -847,9 +848,9 @@ std::shared_ptr<Gio::ListStore<Asset2ListItem>> Window::create_namelist_model(co
             warpgate::DMAT dmat(data);
 
             if(vtype == "textures") {
-                std::vector<std::string> texture_names = dmat.textures();
+                std::span<const std::string_view> texture_names = dmat.textures();
                 for(auto it = texture_names.begin(); it != texture_names.end(); it++) {
-                    std::string value = *it;
+                    std::string value(*it);
                     result->append(
                         Asset2ListItem::create(
                             value,
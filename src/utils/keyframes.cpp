@@ -0,0 +1,203 @@
+#include "utils/keyframes.h"
+
+#include <algorithm>
+#include <cmath>
+#include <glm/geometric.hpp>
+
+using namespace warpgate;
+
+static float error(glm::vec3 expected, glm::vec3 actual) {
+    return glm::length(expected - actual);
+}
+
+static float error(glm::quat expected, glm::quat actual) {
+    return 2.0f * std::acos(std::min(1.0f, std::abs(glm::dot(expected, actual))));
+}
+
+static glm::vec3 interpolate(glm::vec3 start, glm::vec3 end, float t) {
+    return start + (end - start) * t;
+}
+
+static glm::quat interpolate(glm::quat start, glm::quat end, float t) {
+    return glm::slerp(start, end, t);
+}
+
+// The tangent cubic_spline writes for a key, per second. Rotation neighbours are brought into
+// the hemisphere of the key's written value so the difference is the short way round.
+static glm::vec3 tangent(std::span<const glm::vec3> samples, uint32_t key, float sample_rate, glm::vec3 value) {
+    uint32_t previous = key > 0 ? key - 1 : key;
+    uint32_t next = std::min<uint32_t>(key + 1, (uint32_t)samples.size() - 1);
+    if(next == previous) {
+        return glm::vec3(0.0f);
+    }
+    return (samples[next] - samples[previous]) * (sample_rate / (float)(next - previous));
+}
+
+static glm::quat tangent(std::span<const glm::quat> samples, uint32_t key, float sample_rate, glm::quat value) {
+    uint32_t previous = key > 0 ? key - 1 : key;
+    uint32_t next = std::min<uint32_t>(key + 1, (uint32_t)samples.size() - 1);
+    if(next == previous) {
+        return glm::quat(0.0f, 0.0f, 0.0f, 0.0f);
+    }
+    glm::quat before = samples[previous], after = samples[next];
+    if(glm::dot(value, before) < 0.0f) {
+        before = -before;
+    }
+    if(glm::dot(value, after) < 0.0f) {
+        after = -after;
+    }
+    return (after - before) * (sample_rate / (float)(next - previous));
+}
+
+static glm::vec3 align(glm::vec3 previous, glm::vec3 value) {
+    return value;
+}
+
+static glm::quat align(glm::quat previous, glm::quat value) {
+    return glm::dot(previous, value) < 0.0f ? -value : value;
+}
+
+// glTF importers normalize rotations interpolated by a CUBICSPLINE sampler
+static glm::vec3 renormalize(glm::vec3 value) {
+    return value;
+}
+
+static glm::quat renormalize(glm::quat value) {
+    return glm::normalize(value);
+}
+
+// Evaluates the CUBICSPLINE segment between keys `start` and `end` at sample `i`, the way
+// glTF importers do from the key times, values and tangents cubic_spline writes
+template <typename T>
+static T evaluate_cubic_spline(std::span<const T> samples, uint32_t start, uint32_t end, uint32_t i, float sample_rate) {
+    float start_time = (float)start / sample_rate, end_time = (float)end / sample_rate;
+    float duration = end_time - start_time;
+    float t = ((float)i / sample_rate - start_time) / duration;
+    float t2 = t * t, t3 = t2 * t;
+
+    T start_value = samples[start], end_value = align(start_value, samples[end]);
+    T start_tangent = tangent(samples, start, sample_rate, start_value) * duration;
+    T end_tangent = tangent(samples, end, sample_rate, end_value) * duration;
+    return renormalize(
+        start_value * (2.0f * t3 - 3.0f * t2 + 1.0f)
+        + start_tangent * (t3 - 2.0f * t2 + t)
+        + end_value * (-2.0f * t3 + 3.0f * t2)
+        + end_tangent * (t3 - t2)
+    );
+}
+
+// `interpolate(start, end, i)` reconstructs sample i from the keys start and end
+template <typename T, typename Interpolate>
+static std::vector<uint32_t> reduce_track(std::span<const T> samples, float tolerance, Interpolate interpolate) {
+    std::vector<uint32_t> keys;
+    if(samples.size() == 0) {
+        return keys;
+    }
+
+    // Greedily extend each segment from the last kept key until some sample in between
+    // would be interpolated outside the tolerance, then keep the sample before that
+    uint32_t anchor = 0;
+    keys.push_back(anchor);
+    for(uint32_t end = anchor + 2; end < samples.size(); end++) {
+        for(uint32_t i = anchor + 1; i < end; i++) {
+            if(error(samples[i], interpolate(anchor, end, i)) > tolerance) {
+                anchor = end - 1;
+                keys.push_back(anchor);
+                break;
+            }
+        }
+    }
+
+    if(samples.size() > 1) {
+        keys.push_back((uint32_t)samples.size() - 1);
+    }
+    return keys;
+}
+
+template <typename T>
+static std::vector<uint32_t> reduce_linear(std::span<const T> samples, float tolerance) {
+    return reduce_track(samples, tolerance, [&](uint32_t start, uint32_t end, uint32_t i) {
+        float t = (float)(i - start) / (float)(end - start);
+        return interpolate(samples[start], samples[end], t);
+    });
+}
+
+template <typename T>
+static std::vector<uint32_t> reduce_spline(std::span<const T> samples, float tolerance, float sample_rate) {
+    return reduce_track(samples, tolerance, [&](uint32_t start, uint32_t end, uint32_t i) {
+        return evaluate_cubic_spline(samples, start, end, i, sample_rate);
+    });
+}
+
+template <typename T>
+static bool is_constant_track(std::span<const T> samples, float tolerance) {
+    for(uint32_t i = 1; i < samples.size(); i++) {
+        if(error(samples[0], samples[i]) > tolerance) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::vector<uint32_t> utils::keyframes::reduce(std::span<const glm::vec3> samples, float tolerance) {
+    return reduce_linear(samples, tolerance);
+}
+
+std::vector<uint32_t> utils::keyframes::reduce(std::span<const glm::quat> samples, float tolerance) {
+    return reduce_linear(samples, tolerance);
+}
+
+std::vector<uint32_t> utils::keyframes::reduce_cubic_spline(std::span<const glm::vec3> samples, float tolerance, float sample_rate) {
+    return reduce_spline(samples, tolerance, sample_rate);
+}
+
+std::vector<uint32_t> utils::keyframes::reduce_cubic_spline(std::span<const glm::quat> samples, float tolerance, float sample_rate) {
+    return reduce_spline(samples, tolerance, sample_rate);
+}
+
+bool utils::keyframes::is_constant(std::span<const glm::vec3> samples, float tolerance) {
+    return is_constant_track(samples, tolerance);
+}
+
+bool utils::keyframes::is_constant(std::span<const glm::quat> samples, float tolerance) {
+    return is_constant_track(samples, tolerance);
+}
+
+void utils::keyframes::align_hemispheres(std::span<glm::quat> rotations) {
+    for(size_t i = 1; i < rotations.size(); i++) {
+        if(glm::dot(rotations[i - 1], rotations[i]) < 0.0f) {
+            rotations[i] = -rotations[i];
+        }
+    }
+}
+
+std::vector<glm::vec3> utils::keyframes::cubic_spline(std::span<const glm::vec3> samples, std::span<const uint32_t> keys, float sample_rate) {
+    std::vector<glm::vec3> output;
+    output.reserve(keys.size() * 3);
+    for(uint32_t key : keys) {
+        glm::vec3 key_tangent = tangent(samples, key, sample_rate, samples[key]);
+        output.push_back(key_tangent);
+        output.push_back(samples[key]);
+        output.push_back(key_tangent);
+    }
+    return output;
+}
+
+std::vector<glm::quat> utils::keyframes::cubic_spline(std::span<const glm::quat> samples, std::span<const uint32_t> keys, float sample_rate) {
+    std::vector<glm::quat> output;
+    output.reserve(keys.size() * 3);
+    glm::quat last_value(1.0f, 0.0f, 0.0f, 0.0f);
+    for(size_t i = 0; i < keys.size(); i++) {
+        glm::quat value = samples[keys[i]];
+        if(i > 0) {
+            value = align(last_value, value);
+        }
+        last_value = value;
+
+        glm::quat key_tangent = tangent(samples, keys[i], sample_rate, value);
+        output.push_back(key_tangent);
+        output.push_back(value);
+        output.push_back(key_tangent);
+    }
+    return output;
+}
@@ -0,0 +1,65 @@
+#include "utils/mapped_file.h"
+
+#include <stdexcept>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace warpgate;
+
+utils::MappedFile::MappedFile(std::filesystem::path path) {
+    m_size = std::filesystem::file_size(path);
+    if(m_size == 0) {
+        return;
+    }
+#ifdef _WIN32
+    m_file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if(m_file == INVALID_HANDLE_VALUE) {
+        m_file = nullptr;
+        throw std::runtime_error("MappedFile: Failed to open " + path.string());
+    }
+    m_mapping = CreateFileMappingW(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if(m_mapping == nullptr) {
+        CloseHandle(m_file);
+        throw std::runtime_error("MappedFile: Failed to map " + path.string());
+    }
+    m_data = (const uint8_t*)MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0);
+    if(m_data == nullptr) {
+        CloseHandle(m_mapping);
+        CloseHandle(m_file);
+        throw std::runtime_error("MappedFile: Failed to map " + path.string());
+    }
+#else
+    m_fd = open(path.c_str(), O_RDONLY);
+    if(m_fd == -1) {
+        throw std::runtime_error("MappedFile: Failed to open " + path.string());
+    }
+    void *mapped = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, m_fd, 0);
+    if(mapped == MAP_FAILED) {
+        close(m_fd);
+        throw std::runtime_error("MappedFile: Failed to map " + path.string());
+    }
+    m_data = (const uint8_t*)mapped;
+#endif
+}
+
+utils::MappedFile::~MappedFile() {
+    if(m_data == nullptr) {
+        return;
+    }
+#ifdef _WIN32
+    UnmapViewOfFile(m_data);
+    CloseHandle(m_mapping);
+    CloseHandle(m_file);
+#else
+    munmap((void*)m_data, m_size);
+    close(m_fd);
+#endif
+}
@@ -1,5 +1,6 @@
 #include "utils/materials_3.h"
 #include "utils/common.h"
+#include "utils/trace.h"
 
 namespace logger = spdlog;
 
@@ -28,7 +29,9 @@ std::unordered_map<std::string, int> utils::materials3::sizes = {
     {"Float16_2", 4},
     {"float16_2", 4},
     {"Short2", 4},
-    {"Short4", 8}
+    {"Short4", 8},
+    {"byte4n", 4},
+    {"short2n", 4}
 };
 
 std::unordered_map<std::string, int> utils::materials3::component_types = {
@@ -41,7 +44,9 @@ std::unordered_map<std::string, int> utils::materials3::component_types = {
     {"float16_2", TINYGLTF_COMPONENT_TYPE_FLOAT},
     {"Short2", TINYGLTF_COMPONENT_TYPE_SHORT},
     {"Float1", TINYGLTF_COMPONENT_TYPE_FLOAT},
-    {"Short4", TINYGLTF_COMPONENT_TYPE_SHORT}
+    {"Short4", TINYGLTF_COMPONENT_TYPE_SHORT},
+    {"byte4n", TINYGLTF_COMPONENT_TYPE_BYTE},
+    {"short2n", TINYGLTF_COMPONENT_TYPE_SHORT}
 };
 
 std::unordered_map<std::string, int> utils::materials3::types = {
@@ -54,10 +59,13 @@ std::unordered_map<std::string, int> utils::materials3::types = {
     {"float16_2", TINYGLTF_TYPE_VEC2},
     {"Short2", TINYGLTF_TYPE_VEC2},
     {"Float1", TINYGLTF_TYPE_SCALAR},
-    {"Short4", TINYGLTF_TYPE_VEC4}
+    {"Short4", TINYGLTF_TYPE_VEC4},
+    {"byte4n", TINYGLTF_TYPE_VEC4},
+    {"short2n", TINYGLTF_TYPE_VEC2}
 };
 
 void utils::materials3::init_materials() {
+    utils::trace::Scope scope("materials3::init_materials");
     std::filesystem::path material_location = (*executable_location()).parent_path() / MATERIALS_JSON_LOCATION;
     spdlog::debug("Loading materials.json from {}", material_location.string());
     std::ifstream materials_file(material_location);
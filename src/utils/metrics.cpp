@@ -0,0 +1,126 @@
+#include "utils/metrics.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <vector>
+
+#include <spdlog/spdlog.h>
+
+namespace logger = spdlog;
+using namespace warpgate;
+
+namespace {
+    constexpr size_t counter_count = (size_t)utils::metrics::Counter::COUNT;
+
+    constexpr const char *counter_names[] = {
+        "pack_bytes_read",
+        "chunk_bytes_decompressed",
+        "vertices_expanded",
+        "albedo_textures_processed",
+        "normal_textures_processed",
+        "specular_textures_processed",
+        "detailcube_textures_processed",
+        "chunk_textures_processed",
+        "png_bytes_written",
+        "material_cache_hits",
+        "material_cache_misses",
+        "model_cache_hits",
+        "model_cache_misses",
+        "flora_instances_scattered",
+        "image_queue_high_water",
+        "job_queue_high_water",
+    };
+    static_assert(std::size(counter_names) == counter_count, "every counter needs a name");
+
+    bool is_gauge(utils::metrics::Counter counter) {
+        return counter == utils::metrics::Counter::ImageQueueHighWater
+            || counter == utils::metrics::Counter::JobQueueHighWater;
+    }
+
+    // Only the owning thread writes a shard, so a relaxed load and store is enough to update
+    // it, and readers on other threads never see a torn value.
+    struct alignas(64) Shard {
+        std::array<std::atomic_uint64_t, counter_count> values{};
+    };
+
+    // Live shards, plus the totals of threads that have exited. Retiring folds a shard into
+    // the totals and drops it, so long running processes that start many threads stay bounded.
+    std::mutex shards_mutex;
+    std::vector<Shard*> shards;
+    std::array<uint64_t, counter_count> retired{};
+
+    uint64_t combine(utils::metrics::Counter counter, uint64_t total, uint64_t value) {
+        return is_gauge(counter) ? std::max(total, value) : total + value;
+    }
+
+    class ShardOwner {
+    public:
+        ShardOwner() {
+            std::lock_guard<std::mutex> lock(shards_mutex);
+            shards.push_back(&shard);
+        }
+
+        ~ShardOwner() {
+            std::lock_guard<std::mutex> lock(shards_mutex);
+            for(size_t i = 0; i < counter_count; i++) {
+                retired[i] = combine((utils::metrics::Counter)i, retired[i], shard.values[i].load(std::memory_order_relaxed));
+            }
+            shards.erase(std::find(shards.begin(), shards.end(), &shard));
+        }
+
+        Shard shard;
+    };
+
+    Shard &thread_shard() {
+        thread_local ShardOwner owner;
+        return owner.shard;
+    }
+}
+
+const char *utils::metrics::name(Counter counter) {
+    return counter_names[(size_t)counter];
+}
+
+void utils::metrics::add(Counter counter, uint64_t value) {
+    std::atomic_uint64_t &slot = thread_shard().values[(size_t)counter];
+    slot.store(slot.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+void utils::metrics::record_max(Counter counter, uint64_t value) {
+    std::atomic_uint64_t &slot = thread_shard().values[(size_t)counter];
+    if(value > slot.load(std::memory_order_relaxed)) {
+        slot.store(value, std::memory_order_relaxed);
+    }
+}
+
+uint64_t utils::metrics::value(Counter counter) {
+    std::lock_guard<std::mutex> lock(shards_mutex);
+    uint64_t result = retired[(size_t)counter];
+    for(const Shard *shard : shards) {
+        result = combine(counter, result, shard->values[(size_t)counter].load(std::memory_order_relaxed));
+    }
+    return result;
+}
+
+std::string utils::metrics::to_json() {
+    std::string json = "{";
+    for(size_t i = 0; i < counter_count; i++) {
+        json += (i == 0 ? "\"" : ", \"") + std::string(counter_names[i]) + "\": " + std::to_string(value((Counter)i));
+    }
+    return json + "}";
+}
+
+bool utils::metrics::write_json(const std::filesystem::path &path) {
+    std::ofstream output(path);
+    output << to_json() << std::endl;
+    if(output.fail()) {
+        logger::error("Failed to write metrics to '{}'", path.string());
+        return false;
+    }
+    logger::info("Wrote metrics to {}", path.string());
+    return true;
+}
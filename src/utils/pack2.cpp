@@ -0,0 +1,138 @@
+#include "utils/pack2.h"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+
+#include <spdlog/spdlog.h>
+
+namespace logger = spdlog;
+using namespace warpgate;
+
+namespace {
+    // Asset data starts after a fixed size header, matching the archives shipped with the game
+    constexpr uint64_t header_size = 0x200;
+    constexpr char magic[4] = {'P', 'A', 'K', 1};
+    constexpr uint64_t header_unknown = 0x100;
+
+    template <typename T>
+    constexpr std::array<T, 256> crc_table(T polynomial) {
+        std::array<T, 256> table{};
+        for(uint32_t i = 0; i < 256; i++) {
+            T crc = i;
+            for(uint32_t bit = 0; bit < 8; bit++) {
+                crc = crc & 1 ? (crc >> 1) ^ polynomial : crc >> 1;
+            }
+            table[i] = crc;
+        }
+        return table;
+    }
+
+    constexpr std::array<uint64_t, 256> crc64_table = crc_table<uint64_t>(0xC96C5795D7870F42ull);
+    constexpr std::array<uint32_t, 256> crc32_table = crc_table<uint32_t>(0xEDB88320u);
+
+    uint32_t crc32(std::span<const uint8_t> data) {
+        uint32_t crc = ~0u;
+        for(uint8_t byte : data) {
+            crc = crc32_table[(crc ^ byte) & 0xFF] ^ (crc >> 8);
+        }
+        return ~crc;
+    }
+
+    template <typename T>
+    void write(std::ofstream &output, T value) {
+        output.write((const char*)&value, sizeof(T));
+    }
+}
+
+uint64_t utils::pack2_name_hash(std::string_view name) {
+    uint64_t crc = ~0ull;
+    for(char c : name) {
+        uint8_t byte = (uint8_t)std::toupper((unsigned char)c);
+        crc = crc64_table[(crc ^ byte) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+utils::Pack2Writer::Pack2Writer(std::filesystem::path path)
+    : m_path(path)
+    , m_output(path, std::ios::binary)
+    , m_offset(header_size)
+    , m_failed(false)
+    , m_closed(false)
+{
+    // The header is written on close, once the asset count and map offset are known
+    std::vector<char> header(header_size, 0);
+    m_output.write(header.data(), header.size());
+    if(m_output.fail()) {
+        logger::error("Failed to open pack '{}'", m_path.string());
+        m_failed = true;
+    }
+}
+
+utils::Pack2Writer::~Pack2Writer() {
+    close();
+}
+
+bool utils::Pack2Writer::add(std::string_view name, std::span<const uint8_t> data) {
+    Entry entry = {pack2_name_hash(name), 0, data.size(), 0, crc32(data)};
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if(m_failed || m_closed) {
+        return false;
+    }
+    entry.offset = m_offset;
+    m_output.write((const char*)data.data(), data.size());
+    if(m_output.fail()) {
+        logger::error("Failed to write '{}' to pack '{}'", name, m_path.string());
+        m_failed = true;
+        return false;
+    }
+    m_offset += data.size();
+    m_entries.push_back(entry);
+    logger::debug("Added {} bytes to {} as {}", data.size(), m_path.string(), name);
+    return true;
+}
+
+bool utils::Pack2Writer::close() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if(m_closed) {
+        return !m_failed;
+    }
+    m_closed = true;
+    if(m_failed) {
+        return false;
+    }
+
+    // Sorted by hash so the map does not depend on the order assets were added in
+    std::sort(m_entries.begin(), m_entries.end(), [](const Entry &a, const Entry &b) {
+        return a.name_hash < b.name_hash;
+    });
+    uint64_t map_offset = m_offset;
+    for(const Entry &entry : m_entries) {
+        write(m_output, entry.name_hash);
+        write(m_output, entry.offset);
+        write(m_output, entry.data_length);
+        write(m_output, entry.zipped);
+        write(m_output, entry.data_hash);
+    }
+    uint64_t length = (uint64_t)m_output.tellp();
+
+    m_output.seekp(0);
+    m_output.write(magic, sizeof(magic));
+    write(m_output, (uint32_t)m_entries.size());
+    write(m_output, length);
+    write(m_output, map_offset);
+    write(m_output, header_unknown);
+    m_output.close();
+    if(m_output.fail()) {
+        logger::error("Failed to write the asset map of pack '{}'", m_path.string());
+        m_failed = true;
+        return false;
+    }
+    return true;
+}
+
+size_t utils::Pack2Writer::asset_count() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_entries.size();
+}
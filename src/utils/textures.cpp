@@ -3,6 +3,8 @@
 #include <spdlog/spdlog.h>
 
 #include "utils/materials_3.h"
+#include "utils/metrics.h"
+#include "utils/trace.h"
 #include "stb_image_write.h"
 
 namespace logger = spdlog;
@@ -17,6 +19,7 @@ std::string utils::textures::relabel_texture(std::string texture_name, std::stri
 }
 
 bool utils::textures::write_texture(std::span<uint32_t> data, std::filesystem::path texture_path, gli::texture2d::extent_type extent) {
+    utils::trace::Scope scope("textures::write_png");
     if(!stbi_write_png(
             texture_path.string().c_str(), 
             extent.x, extent.y, 
@@ -27,10 +30,17 @@ bool utils::textures::write_texture(std::span<uint32_t> data, std::filesystem::p
         logger::error("Failed to write to {}", texture_path.string());
         return false;
     }
+    std::error_code error;
+    uintmax_t size = std::filesystem::file_size(texture_path, error);
+    if(!error) {
+        utils::metrics::add(utils::metrics::Counter::PngBytesWritten, size);
+    }
     return true;
 }
 
 void utils::textures::process_normalmap(std::string texture_name, std::vector<uint8_t> texture_data, std::filesystem::path output_directory) {
+    utils::trace::Scope scope("textures::process_normalmap");
+    utils::metrics::add(utils::metrics::Counter::NormalTexturesProcessed);
     logger::debug("Processing normal map...");
     gli::texture2d texture(gli::load_dds((char*)texture_data.data(), texture_data.size()));
     if(texture.format() == gli::format::FORMAT_UNDEFINED) {
@@ -74,6 +84,8 @@ void utils::textures::process_normalmap(std::string texture_name, std::vector<ui
 }
 
 void utils::textures::process_specular(std::string texture_name, std::vector<uint8_t> specular_data, std::vector<uint8_t> albedo_data, std::filesystem::path output_directory) {
+    utils::trace::Scope scope("textures::process_specular");
+    utils::metrics::add(utils::metrics::Counter::SpecularTexturesProcessed);
     logger::debug("Processing specular...");
     gli::texture2d specular(gli::load_dds((char*)specular_data.data(), specular_data.size()));
     if(specular.format() == gli::format::FORMAT_UNDEFINED) {
@@ -157,6 +169,8 @@ void utils::textures::process_specular(std::string texture_name, std::vector<uin
 }
 
 void utils::textures::process_detailcube(std::string texture_name, std::vector<uint8_t> texture_data, std::filesystem::path output_directory) {
+    utils::trace::Scope scope("textures::process_detailcube");
+    utils::metrics::add(utils::metrics::Counter::DetailcubeTexturesProcessed);
     logger::debug("Saving detail cube {} as png...", texture_name);
     gli::texture_cube texture(gli::load_dds((char*)texture_data.data(), texture_data.size()));
     if(texture.format() == gli::format::FORMAT_UNDEFINED) {
@@ -207,6 +221,8 @@ std::optional<gli::texture2d> utils::textures::load_texture(std::string texture_
 }
 
 void utils::textures::save_texture(std::string texture_name, std::vector<uint8_t> texture_data, std::filesystem::path output_directory) {
+    utils::trace::Scope scope("textures::save_texture");
+    utils::metrics::add(utils::metrics::Counter::AlbedoTexturesProcessed);
     logger::debug("Saving {} as png...", texture_name);
     std::optional<gli::texture2d> texture = load_texture(texture_name, texture_data);
     if(!texture.has_value()) {
@@ -223,6 +239,8 @@ void utils::textures::save_texture(std::string texture_name, std::vector<uint8_t
 }
 
 void utils::textures::process_cnx_sny(std::string texture_name, std::span<uint8_t> cnx_data, std::span<uint8_t> sny_data, std::filesystem::path output_directory) {
+    utils::trace::Scope scope("textures::process_cnx_sny");
+    utils::metrics::add(utils::metrics::Counter::ChunkTexturesProcessed);
     logger::debug("Processing color_nx/specular_ny maps for {}...", texture_name);
     gli::texture2d color_nx(gli::load_dds((char*)cnx_data.data(), cnx_data.size()));
     if(color_nx.format() == gli::format::FORMAT_UNDEFINED) {
@@ -0,0 +1,148 @@
+#include "utils/trace.h"
+
+#include <algorithm>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <spdlog/spdlog.h>
+
+namespace logger = spdlog;
+using namespace warpgate;
+
+namespace {
+    struct Event {
+        const char *name;
+        int64_t start, end;
+    };
+
+    // Only the owning thread appends, so the lock is uncontended until the trace is written
+    struct Buffer {
+        uint32_t thread_id;
+        std::mutex mutex;
+        std::vector<Event> events;
+    };
+
+    const std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+
+    // Buffers outlive their threads so pool threads that have exited are still written
+    std::mutex buffers_mutex;
+    std::vector<std::shared_ptr<Buffer>> buffers;
+
+    Buffer &thread_buffer() {
+        thread_local std::shared_ptr<Buffer> buffer = []() {
+            std::shared_ptr<Buffer> created = std::make_shared<Buffer>();
+            std::lock_guard<std::mutex> lock(buffers_mutex);
+            created->thread_id = (uint32_t)buffers.size();
+            buffers.push_back(created);
+            return created;
+        }();
+        return *buffer;
+    }
+
+    // Phase names are literals, so escaping quotes and backslashes is enough
+    std::string quoted(std::string_view name) {
+        std::string result = "\"";
+        for(char c : name) {
+            if(c == '"' || c == '\\') {
+                result += '\\';
+            }
+            result += c;
+        }
+        return result + "\"";
+    }
+
+    std::vector<std::pair<uint32_t, Event>> collect_events() {
+        std::vector<std::pair<uint32_t, Event>> events;
+        std::lock_guard<std::mutex> lock(buffers_mutex);
+        for(const std::shared_ptr<Buffer> &buffer : buffers) {
+            std::lock_guard<std::mutex> buffer_lock(buffer->mutex);
+            for(const Event &event : buffer->events) {
+                events.push_back({buffer->thread_id, event});
+            }
+        }
+        return events;
+    }
+}
+
+std::atomic_bool utils::trace::detail::enabled = false;
+
+int64_t utils::trace::detail::now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - epoch).count();
+}
+
+void utils::trace::detail::record(const char *name, int64_t start, int64_t end) {
+    Buffer &buffer = thread_buffer();
+    std::lock_guard<std::mutex> lock(buffer.mutex);
+    buffer.events.push_back({name, start, end});
+}
+
+void utils::trace::enable() {
+    detail::enabled.store(true, std::memory_order_relaxed);
+}
+
+bool utils::trace::write_chrome_trace(const std::filesystem::path &path) {
+    std::ofstream output(path);
+    if(output.fail()) {
+        logger::error("Failed to open trace file '{}'", path.string());
+        return false;
+    }
+
+    std::vector<std::pair<uint32_t, Event>> events = collect_events();
+    // Timestamps and durations are in microseconds
+    output << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    for(size_t i = 0; i < events.size(); i++) {
+        auto &[thread_id, event] = events[i];
+        output << fmt::format(
+            "{}{{\"name\":{},\"ph\":\"X\",\"pid\":1,\"tid\":{},\"ts\":{:.3f},\"dur\":{:.3f}}}",
+            i == 0 ? "\n" : ",\n", quoted(event.name), thread_id,
+            event.start / 1e3, (event.end - event.start) / 1e3
+        );
+    }
+    output << "\n]}\n";
+
+    if(output.fail()) {
+        logger::error("Failed to write trace file '{}'", path.string());
+        return false;
+    }
+    logger::info("Wrote {} trace events to {}", events.size(), path.string());
+    return true;
+}
+
+void utils::trace::print_stats(std::ostream &output) {
+    struct Phase {
+        std::string_view name;
+        uint64_t count = 0;
+        int64_t total = 0, maximum = 0;
+    };
+    std::unordered_map<std::string_view, Phase> phases;
+    for(auto &[thread_id, event] : collect_events()) {
+        Phase &phase = phases[event.name];
+        phase.name = event.name;
+        phase.count++;
+        phase.total += event.end - event.start;
+        phase.maximum = std::max(phase.maximum, event.end - event.start);
+    }
+
+    std::vector<Phase> sorted;
+    for(auto &[name, phase] : phases) {
+        sorted.push_back(phase);
+    }
+    std::sort(sorted.begin(), sorted.end(), [](const Phase &lhs, const Phase &rhs) {
+        return lhs.total > rhs.total;
+    });
+
+    // Phases run concurrently on several threads, so totals can exceed the wall time
+    output << fmt::format("{:<32} {:>10} {:>12} {:>12} {:>12}\n", "phase", "count", "total (ms)", "mean (ms)", "max (ms)");
+    for(const Phase &phase : sorted) {
+        output << fmt::format(
+            "{:<32} {:>10} {:>12.3f} {:>12.3f} {:>12.3f}\n",
+            phase.name, phase.count,
+            phase.total / 1e6, phase.total / 1e6 / phase.count, phase.maximum / 1e6
+        );
+    }
+}
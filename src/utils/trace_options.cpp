@@ -0,0 +1,33 @@
+#include "utils/trace_options.h"
+#include "utils/trace.h"
+
+#include <optional>
+#include <string>
+
+using namespace warpgate;
+
+void utils::trace::add_arguments(argparse::ArgumentParser &parser) {
+    parser.add_argument("--trace")
+        .help("Write a Chrome trace (also readable by Perfetto) of the conversion phases to this file");
+
+    parser.add_argument("--stats")
+        .help("Print the time spent in each conversion phase when done")
+        .default_value(false)
+        .implicit_value(true)
+        .nargs(0);
+}
+
+void utils::trace::start(argparse::ArgumentParser &parser) {
+    if(parser.is_used("--trace") || parser.get<bool>("--stats")) {
+        enable();
+    }
+}
+
+void utils::trace::report(argparse::ArgumentParser &parser, std::ostream &output) {
+    if(std::optional<std::string> trace_path = parser.present<std::string>("--trace")) {
+        write_chrome_trace(*trace_path);
+    }
+    if(parser.get<bool>("--stats")) {
+        print_stats(output);
+    }
+}
@@ -1,11 +1,17 @@
 #include "utils/tsqueue.h"
 #include "parameter.h"
+#include <algorithm>
 #include <filesystem>
+#include <functional>
+#include <memory>
+#include <tuple>
+
+#include <glm/vec3.hpp>
 
 using namespace warpgate;
 
 template <class T>
-utils::tsqueue<T>::tsqueue(void): q(), m(), c(), closed(false) {}
+utils::tsqueue<T>::tsqueue(void): q(), m(), c(), closed(false), high_water(0) {}
 
 template <class T>
 utils::tsqueue<T>::~tsqueue(void) {}
@@ -17,6 +23,7 @@ void utils::tsqueue<T>::enqueue(T t) {
     }
     std::lock_guard<std::mutex> lock(m);
     q.push(t);
+    high_water = std::max(high_water, q.size());
     c.notify_one();
 }
 
@@ -75,5 +82,13 @@ void utils::tsqueue<T>::close(void) {
     c.notify_all();
 }
 
+template <class T>
+size_t utils::tsqueue<T>::high_water_mark(void) {
+    std::lock_guard<std::mutex> lock(m);
+    return high_water;
+}
+
 template class utils::tsqueue<std::pair<std::string, Semantic>>;
-template class utils::tsqueue<std::tuple<std::string, std::shared_ptr<uint8_t[]>, uint32_t, std::shared_ptr<uint8_t[]>, uint32_t>>;
\ No newline at end of file
+template class utils::tsqueue<std::tuple<std::string, std::shared_ptr<uint8_t[]>, uint32_t, std::shared_ptr<uint8_t[]>, uint32_t>>;
+template class utils::tsqueue<std::pair<std::string, std::function<void(std::string)>>>;
+template class utils::tsqueue<std::tuple<size_t, glm::dvec3, std::shared_ptr<uint8_t[]>, size_t>>;
\ No newline at end of file
@@ -168,7 +168,7 @@ void ModelRenderer::loadModel(std::shared_ptr<warpgate::DME> model, std::unorder
 
         uint32_t materialDefinition = dmat->material(material_index)->definition();
         std::string inputLayoutName = m_materials["materialDefinitions"][std::to_string(materialDefinition)]["drawStyles"][0]["inputLayout"];
-        std::shared_ptr<const warpgate::Mesh> mesh = wgModel->data->mesh(material_index);
+        const warpgate::Mesh *mesh = wgModel->data->mesh(material_index);
         std::unordered_map<uint32_t, uint32_t> vertex_strides;
         for(uint32_t stream_index = 0; stream_index < mesh->vertex_stream_count(); stream_index++){
             vertex_strides[stream_index] = mesh->bytes_per_vertex(stream_index);
@@ -187,7 +187,7 @@ void ModelRenderer::loadModel(std::shared_ptr<warpgate::DME> model, std::unorder
 void ModelRenderer::createVertexBuffers(std::shared_ptr<warpgate::vulkan::Model> model)
 {
     for(uint32_t index = 0; index < model->data->mesh_count(); index++) {
-        std::shared_ptr<const warpgate::Mesh> mesh = model->data->mesh(index);
+        const warpgate::Mesh *mesh = model->data->mesh(index);
 
         warpgate::vulkan::Mesh curr_mesh;
 
@@ -812,7 +812,7 @@ void ModelRenderer::buildForNewSwapchain(std::vector<VkImageView> const& imageVi
         for(uint32_t mesh_index = 0; mesh_index < model->meshes.size(); mesh_index++){
             uint32_t materialDefinition = model->data->dmat()->material(mesh_index)->definition();
             std::string inputLayoutName = m_materials["materialDefinitions"][std::to_string(materialDefinition)]["drawStyles"][0]["inputLayout"];
-            std::shared_ptr<const warpgate::Mesh> mesh = model->data->mesh(mesh_index);
+            const warpgate::Mesh *mesh = model->data->mesh(mesh_index);
             std::unordered_map<uint32_t, uint32_t> vertex_strides;
             for(uint32_t stream_index = 0; stream_index < mesh->vertex_stream_count(); stream_index++){
                 vertex_strides[stream_index] = mesh->bytes_per_vertex(stream_index);
@@ -0,0 +1,236 @@
+#include <filesystem>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <spdlog/spdlog.h>
+
+#include "cnk_loader.h"
+#include "dme_loader.h"
+#include "mrn_loader.h"
+#include "zone_loader.h"
+#include "utils/fixtures.h"
+#include "utils/gltf/dme.h"
+#include "utils/materials_3.h"
+#include "utils/textures.h"
+#include "utils/tsqueue.h"
+#include "tiny_gltf.h"
+
+namespace logger = spdlog;
+using namespace warpgate;
+
+// Texture kernels write their PNGs to <output_directory>/textures
+static std::filesystem::path output_directory = std::filesystem::temp_directory_path() / "warpgate_bench";
+
+static void BM_ChunkDecompress(benchmark::State &state) {
+    std::vector<uint8_t> decompressed = utils::fixtures::cnk0((uint32_t)state.range(0));
+    std::vector<uint8_t> compressed = utils::fixtures::compress_chunk(decompressed);
+    chunk::Chunk chunk(compressed);
+    for(auto _ : state) {
+        std::unique_ptr<uint8_t[]> data = chunk.decompress();
+        benchmark::DoNotOptimize(data.get());
+    }
+    state.SetBytesProcessed(state.iterations() * decompressed.size());
+}
+BENCHMARK(BM_ChunkDecompress)->Arg(32)->Arg(64)->Arg(128);
+
+static void BM_CNK0Parse(benchmark::State &state) {
+    std::vector<uint8_t> data = utils::fixtures::cnk0((uint32_t)state.range(0));
+    for(auto _ : state) {
+        chunk::CNK0 cnk0(data);
+        benchmark::DoNotOptimize(cnk0);
+    }
+    state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(BM_CNK0Parse)->Arg(32)->Arg(64)->Arg(128);
+
+static void BM_DMEParse(benchmark::State &state) {
+    std::vector<uint8_t> data = utils::fixtures::dme((uint32_t)state.range(0), state.range(1) != 0);
+    for(auto _ : state) {
+        DME dme(data, "fixture.dme");
+        benchmark::DoNotOptimize(dme);
+    }
+    state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(BM_DMEParse)->ArgsProduct({{1 << 10, 1 << 16}, {0, 1}});
+
+static void BM_ZoneParse(benchmark::State &state) {
+    std::vector<uint8_t> data = utils::fixtures::zone((uint32_t)state.range(0), (uint32_t)state.range(1));
+    for(auto _ : state) {
+        zone::Zone zone(data);
+        benchmark::DoNotOptimize(zone);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(1));
+}
+BENCHMARK(BM_ZoneParse)->Args({100, 10})->Args({1000, 100});
+
+static void BM_ZoneFlatten(benchmark::State &state) {
+    std::vector<uint8_t> data = utils::fixtures::zone((uint32_t)state.range(0), 100);
+    zone::Zone zone(data);
+    for(auto _ : state) {
+        std::vector<uint8_t> cache = zone::InstanceCache::build(zone, (uint32_t)state.range(1));
+        benchmark::DoNotOptimize(cache.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * 100);
+}
+BENCHMARK(BM_ZoneFlatten)->Args({1000, 1})->Args({1000, 8})->UseRealTime();
+
+static void BM_MRNParse(benchmark::State &state) {
+    std::vector<uint8_t> data = utils::fixtures::mrn((uint32_t)state.range(0), 64, 60);
+    for(auto _ : state) {
+        mrn::MRN mrn(data, "fixture.mrn");
+        std::vector<std::shared_ptr<mrn::Packet>> packets = mrn.packets();
+        benchmark::DoNotOptimize(packets.data());
+    }
+    state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(BM_MRNParse)->Arg(16)->Arg(256);
+
+static void BM_NSADequantize(benchmark::State &state) {
+    uint32_t bone_count = (uint32_t)state.range(0), sample_count = (uint32_t)state.range(1);
+    std::vector<uint8_t> data = utils::fixtures::nsa(bone_count, sample_count);
+    mrn::NSAFile animation(data);
+    for(auto _ : state) {
+        animation.dequantize();
+        benchmark::DoNotOptimize(animation.dynamic_rotation().data());
+    }
+    state.SetItemsProcessed(state.iterations() * bone_count * sample_count);
+}
+BENCHMARK(BM_NSADequantize)->Args({64, 30})->Args({256, 600});
+
+static void BM_ExpandVertexStream(benchmark::State &state) {
+    bool skinned = state.range(1) != 0;
+    std::vector<uint8_t> data = utils::fixtures::dme((uint32_t)state.range(0), skinned);
+    DME dme(data, "fixture.dme");
+    const Mesh *mesh = dme.mesh(0);
+    uint32_t definition = skinned ? utils::fixtures::skinned_material_definition : utils::fixtures::rigid_material_definition;
+    nlohmann::json input_layout = *utils::materials3::get_input_layout(definition);
+    for(auto _ : state) {
+        // expand_vertex_stream extends the layout it is given, so each iteration starts from a fresh copy
+        nlohmann::json layout = input_layout;
+        for(uint32_t stream = 0; stream < mesh->vertex_stream_count(); stream++) {
+            std::vector<uint8_t> expanded = utils::gltf::dme::expand_vertex_stream(layout, mesh->vertex_stream(stream), stream, !skinned, dme, mesh);
+            benchmark::DoNotOptimize(expanded.data());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * mesh->vertex_count());
+}
+BENCHMARK(BM_ExpandVertexStream)->ArgsProduct({{1 << 10, 1 << 16}, {0, 1}});
+
+static void BM_JenkinsOaatUpper(benchmark::State &state) {
+    std::vector<std::string> names;
+    for(int64_t i = 0; i < state.range(0); i++) {
+        names.push_back("Fixture_Texture_" + std::to_string(i) + "_C.dds");
+    }
+    std::vector<uint32_t> hashes(names.size());
+    for(auto _ : state) {
+        jenkins::oaat_upper(names, hashes);
+        benchmark::DoNotOptimize(hashes.data());
+    }
+    state.SetItemsProcessed(state.iterations() * names.size());
+}
+BENCHMARK(BM_JenkinsOaatUpper)->Arg(64)->Arg(4096);
+
+static void BM_JenkinsLookup2(benchmark::State &state) {
+    std::span<const perfect_hash::Entry<std::string_view>> bones = utils::bone_names();
+    for(auto _ : state) {
+        for(const auto &bone : bones) {
+            benchmark::DoNotOptimize(jenkins::lookup2(bone.value));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * bones.size());
+}
+BENCHMARK(BM_JenkinsLookup2);
+
+static void BM_GltfBuild(benchmark::State &state) {
+    std::vector<uint8_t> data = utils::fixtures::dme((uint32_t)state.range(0), state.range(1) != 0);
+    DME dme(data, "fixture.dme");
+    utils::tsqueue<std::pair<std::string, Semantic>> image_queue;
+    for(auto _ : state) {
+        tinygltf::Model gltf = utils::gltf::dme::build_gltf_from_dme(dme, image_queue, output_directory, false, true, false);
+        benchmark::DoNotOptimize(gltf.buffers.data());
+    }
+    state.SetItemsProcessed(state.iterations() * dme.mesh(0)->vertex_count());
+}
+BENCHMARK(BM_GltfBuild)->ArgsProduct({{1 << 10, 1 << 16}, {0, 1}});
+
+static void BM_GltfSerialize(benchmark::State &state) {
+    std::vector<uint8_t> data = utils::fixtures::dme((uint32_t)state.range(0), true);
+    DME dme(data, "fixture.dme");
+    utils::tsqueue<std::pair<std::string, Semantic>> image_queue;
+    tinygltf::Model gltf = utils::gltf::dme::build_gltf_from_dme(dme, image_queue, output_directory, false, true, false);
+    tinygltf::TinyGLTF writer;
+    bool binary = state.range(1) != 0;
+    size_t bytes = 0;
+    for(auto _ : state) {
+        std::ostringstream stream;
+        writer.WriteGltfSceneToStream(&gltf, stream, false, binary);
+        bytes += (size_t)stream.tellp();
+    }
+    state.SetBytesProcessed(bytes);
+}
+BENCHMARK(BM_GltfSerialize)->ArgsProduct({{1 << 10, 1 << 16}, {0, 1}});
+
+static void BM_ProcessNormalmap(benchmark::State &state) {
+    std::vector<uint8_t> normal = utils::fixtures::dds((uint32_t)state.range(0), (uint32_t)state.range(0));
+    for(auto _ : state) {
+        utils::textures::process_normalmap("fixture_N.dds", normal, output_directory);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(0));
+}
+BENCHMARK(BM_ProcessNormalmap)->Arg(256)->Arg(1024)->Unit(benchmark::kMillisecond);
+
+static void BM_ProcessSpecular(benchmark::State &state) {
+    std::vector<uint8_t> specular = utils::fixtures::dds((uint32_t)state.range(0), (uint32_t)state.range(0), 1);
+    std::vector<uint8_t> albedo = utils::fixtures::dds((uint32_t)state.range(0), (uint32_t)state.range(0), 2);
+    for(auto _ : state) {
+        utils::textures::process_specular("fixture_S.dds", specular, albedo, output_directory);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(0));
+}
+BENCHMARK(BM_ProcessSpecular)->Arg(256)->Arg(1024)->Unit(benchmark::kMillisecond);
+
+static void BM_ProcessDetailcube(benchmark::State &state) {
+    std::vector<uint8_t> cube = utils::fixtures::dds_cube((uint32_t)state.range(0));
+    for(auto _ : state) {
+        utils::textures::process_detailcube("fixture_detailcube.dds", cube, output_directory);
+    }
+    state.SetItemsProcessed(state.iterations() * 6 * state.range(0) * state.range(0));
+}
+BENCHMARK(BM_ProcessDetailcube)->Arg(128)->Arg(512)->Unit(benchmark::kMillisecond);
+
+static void BM_SaveTexture(benchmark::State &state) {
+    std::vector<uint8_t> albedo = utils::fixtures::dds((uint32_t)state.range(0), (uint32_t)state.range(0));
+    for(auto _ : state) {
+        utils::textures::save_texture("fixture_C.dds", albedo, output_directory);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(0));
+}
+BENCHMARK(BM_SaveTexture)->Arg(256)->Arg(1024)->Unit(benchmark::kMillisecond);
+
+static void BM_ProcessCnxSny(benchmark::State &state) {
+    std::vector<uint8_t> cnx = utils::fixtures::dds((uint32_t)state.range(0), (uint32_t)state.range(0), 1);
+    std::vector<uint8_t> sny = utils::fixtures::dds((uint32_t)state.range(0), (uint32_t)state.range(0), 2);
+    for(auto _ : state) {
+        utils::textures::process_cnx_sny("fixture_eco_0_CNX.dds", cnx, sny, output_directory);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(0));
+}
+BENCHMARK(BM_ProcessCnxSny)->Arg(256)->Arg(1024)->Unit(benchmark::kMillisecond);
+
+int main(int argc, char **argv) {
+    // The loaders log every file they open, which would swamp the benchmark output
+    logger::set_level(logger::level::warn);
+    utils::materials3::init_materials();
+    std::filesystem::create_directories(output_directory / "textures");
+
+    benchmark::Initialize(&argc, argv);
+    if(benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
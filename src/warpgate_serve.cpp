@@ -0,0 +1,596 @@
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <filesystem>
+#include <functional>
+#include <future>
+#include <iostream>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+#ifndef _WIN32
+#include <cerrno>
+#include <csignal>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+#include <spdlog/spdlog.h>
+#include <spdlog/sinks/stdout_color_sinks.h>
+#include <synthium/synthium.h>
+
+#include "argparse/argparse.hpp"
+#include "dme_loader.h"
+#include "json.hpp"
+#include "utils/actor_sockets.h"
+#include "utils/adr.h"
+#include "utils/gltf/common.h"
+#include "utils/gltf/dme.h"
+#include "utils/gltf/dmat.h"
+#include "utils/gltf/meshopt.h"
+#include "utils/materials_3.h"
+#include "utils/metrics.h"
+#include "utils/trace.h"
+#include "utils/trace_options.h"
+#include "utils/tsqueue.h"
+#include "utils.h"
+#include "tiny_gltf.h"
+#include "version.h"
+
+namespace logger = spdlog;
+using namespace warpgate;
+
+typedef std::function<void(std::string)> reply_fn;
+typedef std::pair<std::string, reply_fn> job_t;
+
+// Textures being written by any job, keyed by output path, so concurrent jobs sharing an
+// output directory write each texture once and wait for each other instead of racing
+struct TextureWrites {
+    std::mutex mutex;
+    std::unordered_map<std::string, std::shared_future<void>> in_flight;
+};
+
+struct ServeContext {
+    synthium::Manager &manager;
+    std::shared_ptr<utils::ActorSockets> actor_sockets;
+    uint32_t image_threads;
+    TextureWrites texture_writes;
+};
+
+void build_argument_parser(argparse::ArgumentParser &parser, int &log_level) {
+    parser.add_description(
+        "Long running conversion service. Reads one JSON job per line from stdin (or a unix socket) "
+        "and writes one JSON result per line, keeping packs and materials loaded between jobs.\n"
+        "Job format: {\"id\": any, \"type\": \"dme\"|\"adr\"|\"metrics\"|\"shutdown\", \"input\": str, \"output\": str, "
+        "\"format\": \"glb\"|\"gltf\", \"skeleton\": bool, \"textures\": bool, \"rigify\": bool, \"quantized\": bool, "
+        "\"optimize\": bool, \"meshopt_compression\": bool}"
+    );
+
+    parser.add_argument("--verbose", "-v")
+        .help("Increase log level. May be specified multiple times")
+        .action([&](const auto &){
+            if(log_level > 0) {
+                log_level--;
+            }
+        })
+        .append()
+        .nargs(0)
+        .default_value(false)
+        .implicit_value(true);
+
+    parser.add_argument("--jobs", "-j")
+        .help("The number of conversion jobs to run concurrently")
+        .default_value(2u)
+        .scan<'u', uint32_t>();
+
+    parser.add_argument("--threads", "-t")
+        .help("The number of threads to use for image processing per job")
+        .default_value(4u)
+        .scan<'u', uint32_t>();
+
+    parser.add_argument("--metrics")
+        .help("Write throughput counters as JSON to this file on shutdown. A \"metrics\" job returns them at any time");
+
+    utils::trace::add_arguments(parser);
+
+#ifndef _WIN32
+    parser.add_argument("--socket", "-S")
+        .help("Listen for jobs on this unix socket path instead of stdin");
+#endif
+
+    parser.add_argument("--assets-directory", "-d")
+        .help("The directory where the game's assets are stored")
+#ifdef _WIN32
+        .default_value(std::string("C:/Users/Public/Daybreak Game Company/Installed Games/Planetside 2 Test/Resources/Assets/"));
+#else
+        .default_value(std::string("/mnt/c/Users/Public/Daybreak Game Company/Installed Games/Planetside 2 Test/Resources/Assets/"));
+#endif
+}
+
+std::span<uint8_t> load_asset(synthium::Manager &manager, std::string input_str, std::vector<uint8_t> &data_vector, std::shared_ptr<uint8_t[]> &data) {
+    utils::trace::Scope scope("load_asset");
+    if(manager.contains(input_str)) {
+        logger::debug("Loading '{}' from manager...", input_str);
+        int retries = 3;
+        std::shared_ptr<synthium::Asset2> asset = manager.get(input_str);
+        while(data_vector.size() == 0 && retries > 0) {
+            try {
+                data_vector = asset->get_data();
+            } catch(std::bad_alloc) {
+                logger::warn("Failed to load asset, deallocating some packs");
+                manager.deallocate(asset->uncompressed_size());
+            }
+            retries--;
+        }
+        if(data_vector.size() == 0) {
+            throw std::runtime_error("Failed to load '" + input_str + "' from manager");
+        }
+        utils::metrics::add(utils::metrics::Counter::PackBytesRead, data_vector.size());
+        logger::debug("Loaded '{}' from manager.", input_str);
+        return std::span<uint8_t>(data_vector.data(), data_vector.size());
+    }
+
+    logger::debug("Loading '{}' from filesystem...", input_str);
+    std::ifstream input(input_str, std::ios::binary | std::ios::ate);
+    if(input.fail()) {
+        throw std::runtime_error("Failed to open file '" + input_str + "'");
+    }
+    size_t length = input.tellg();
+    input.seekg(0);
+    data = std::make_shared<uint8_t[]>(length);
+    input.read((char*)data.get(), length);
+    input.close();
+    logger::debug("Loaded '{}' from filesystem.", input_str);
+    return std::span<uint8_t>(data.get(), length);
+}
+
+void process_job_images(
+    ServeContext &context,
+    utils::tsqueue<std::pair<std::string, Semantic>> &queue,
+    std::shared_ptr<std::filesystem::path> output_directory
+) {
+    while(!queue.is_closed()) {
+        std::pair<std::string, Semantic> texture = queue.try_dequeue({"", Semantic::UNKNOWN});
+        if(texture.second == Semantic::UNKNOWN) {
+            break;
+        }
+
+        std::string key = (*output_directory / "textures" / texture.first).string();
+        std::promise<void> written;
+        std::shared_future<void> pending;
+        {
+            std::lock_guard<std::mutex> lock(context.texture_writes.mutex);
+            auto existing = context.texture_writes.in_flight.find(key);
+            if(existing != context.texture_writes.in_flight.end()) {
+                pending = existing->second;
+            } else {
+                context.texture_writes.in_flight[key] = written.get_future().share();
+            }
+        }
+        if(pending.valid()) {
+            // Another job is writing the same file, so this job is done with it once that finishes
+            pending.wait();
+            continue;
+        }
+
+        try {
+            utils::trace::Scope texture_scope("texture::process");
+            utils::gltf::dmat::process_image(context.manager, texture.first, texture.second, *output_directory);
+        } catch(std::exception &err) {
+            logger::error("Failed to process texture '{}': {}", texture.first, err.what());
+        }
+        {
+            std::lock_guard<std::mutex> lock(context.texture_writes.mutex);
+            context.texture_writes.in_flight.erase(key);
+        }
+        written.set_value();
+    }
+}
+
+// Closes a job's image queue and joins its workers however the job ends, since destroying a
+// joinable thread would terminate the whole service
+struct ImageWorkers {
+    utils::tsqueue<std::pair<std::string, Semantic>> &queue;
+    std::vector<std::thread> threads;
+
+    ~ImageWorkers() {
+        join();
+    }
+
+    void join() {
+        queue.close();
+        for(std::thread &thread : threads) {
+            if(thread.joinable()) {
+                thread.join();
+            }
+        }
+    }
+};
+
+nlohmann::json run_job(ServeContext &context, const nlohmann::json &job) {
+    utils::trace::Scope job_scope("serve::job");
+    std::string type = job.value("type", "dme");
+    std::string input_str = job.at("input").get<std::string>();
+    std::filesystem::path output_filename = std::filesystem::weakly_canonical(job.at("output").get<std::string>());
+    std::string format = job.value("format", output_filename.extension() == ".gltf" ? "gltf" : "glb");
+    bool include_skeleton = job.value("skeleton", true);
+    bool export_textures = job.value("textures", true);
+    bool rigify_skeleton = job.value("rigify", false);
+    bool quantized = job.value("quantized", false);
+    bool optimize_meshes = job.value("optimize", false);
+    bool compress_meshes = job.value("meshopt_compression", false);
+
+    if(type != "dme" && type != "adr") {
+        throw std::invalid_argument("Unknown job type '" + type + "'");
+    }
+    if(format != "glb" && format != "gltf") {
+        throw std::invalid_argument("Unknown output format '" + format + "'");
+    }
+    if((optimize_meshes || compress_meshes) && !utils::gltf::meshopt::available()) {
+        throw std::invalid_argument("optimize and meshopt_compression require warpgate_serve to be built with WARPGATE_USE_MESHOPTIMIZER");
+    }
+    if(compress_meshes && format != "glb") {
+        throw std::invalid_argument("meshopt_compression requires glb output");
+    }
+
+    std::shared_ptr<std::filesystem::path> output_directory = std::make_shared<std::filesystem::path>();
+    if(output_filename.has_parent_path()) {
+        *output_directory = output_filename.parent_path();
+    }
+    std::filesystem::create_directories(*output_directory / "textures");
+
+    std::shared_ptr<uint8_t[]> data, dmat_data;
+    std::vector<uint8_t> data_vector, dmat_data_vector;
+    std::span<uint8_t> data_span = load_asset(context.manager, input_str, data_vector, data);
+
+    utils::trace::Scope parse_scope("dme::parse");
+    std::shared_ptr<DME> dme;
+    if(type == "adr") {
+        utils::ADR adr(data_span);
+        std::optional<std::string> dme_file = adr.base_model();
+        if(!dme_file) {
+            throw std::runtime_error("ADR '" + input_str + "' has no base model");
+        }
+
+        std::shared_ptr<DMAT> dmat;
+        std::optional<std::string> dmat_file = adr.base_palette();
+        if(dmat_file) {
+            dmat = std::make_shared<DMAT>(load_asset(context.manager, *dmat_file, dmat_data_vector, dmat_data));
+        }
+
+        data_vector.clear();
+        data_span = load_asset(context.manager, *dme_file, data_vector, data);
+        if(dmat != nullptr) {
+            dme = std::make_shared<DME>(data_span, output_filename.stem().string(), dmat);
+        } else {
+            dme = std::make_shared<DME>(data_span, output_filename.stem().string());
+        }
+    } else {
+        dme = std::make_shared<DME>(data_span, output_filename.stem().string());
+    }
+    parse_scope.end();
+
+    utils::tsqueue<std::pair<std::string, Semantic>> image_queue;
+    ImageWorkers image_workers{image_queue};
+    if(export_textures) {
+        for(uint32_t i = 0; i < context.image_threads; i++) {
+            image_workers.threads.push_back(std::thread{
+                process_job_images,
+                std::ref(context),
+                std::ref(image_queue),
+                output_directory
+            });
+        }
+    }
+
+    int parent_index;
+    tinygltf::Model gltf = utils::gltf::dme::build_gltf_from_dme(*dme, image_queue, *output_directory, export_textures, include_skeleton, rigify_skeleton, &parent_index, quantized);
+
+    std::string basename = std::filesystem::path(input_str).stem().string();
+    if(type == "adr" && context.actor_sockets->model_indices.find(basename) != context.actor_sockets->model_indices.end()) {
+        int cog_index = utils::gltf::findCOGIndex(gltf, gltf.nodes[parent_index]);
+        if(cog_index != -1) {
+            parent_index = cog_index;
+        }
+        utils::gltf::dme::add_actorsockets_to_gltf(gltf, *context.actor_sockets, basename, parent_index);
+    }
+
+    if(optimize_meshes) {
+        utils::trace::Scope optimize_scope("meshopt::optimize");
+        utils::gltf::meshopt::optimize(gltf, context.image_threads);
+    }
+
+    logger::info("Writing GLTF2 file {}...", output_filename.string());
+    utils::trace::Scope write_scope("gltf::write");
+    bool written;
+    if(compress_meshes) {
+        utils::gltf::meshopt::compress(gltf);
+        written = utils::gltf::meshopt::write_glb(gltf, output_filename);
+    } else {
+        tinygltf::TinyGLTF writer;
+        written = writer.WriteGltfSceneToFile(&gltf, output_filename.string(), false, format == "glb", format == "gltf", format == "glb");
+    }
+    write_scope.end();
+
+    image_workers.join();
+    utils::metrics::record_max(utils::metrics::Counter::ImageQueueHighWater, image_queue.high_water_mark());
+
+    if(!written) {
+        throw std::runtime_error("Failed to write '" + output_filename.string() + "'");
+    }
+    return {{"output", output_filename.string()}};
+}
+
+void process_jobs(ServeContext &context, utils::tsqueue<job_t> &queue) {
+    while(!queue.is_closed()) {
+        job_t job = queue.try_dequeue({"", nullptr});
+        if(job.second == nullptr) {
+            break;
+        }
+
+        nlohmann::json result = {{"id", nullptr}};
+        auto start = std::chrono::steady_clock::now();
+        try {
+            nlohmann::json request = nlohmann::json::parse(job.first);
+            if(request.contains("id")) {
+                result["id"] = request["id"];
+            }
+            result.update(run_job(context, request));
+            result["status"] = "ok";
+        } catch(std::exception &err) {
+            logger::error("Job failed: {}", err.what());
+            result["status"] = "error";
+            result["error"] = err.what();
+        }
+        result["elapsed_ms"] = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+        job.second(result.dump());
+    }
+}
+
+// Returns true if the line requested a shutdown of the service
+bool submit_line(std::string line, utils::tsqueue<job_t> &queue, reply_fn reply) {
+    if(line.empty() || line.find_first_not_of(" \t\r") == std::string::npos) {
+        return false;
+    }
+    nlohmann::json request = nlohmann::json::parse(line, nullptr, false);
+    if(!request.is_discarded() && request.is_object() && request.value("type", "") == "shutdown") {
+        reply(nlohmann::json{{"id", request.value("id", nlohmann::json())}, {"status", "ok"}}.dump());
+        return true;
+    }
+    // Answered immediately rather than queued, so counters can be polled while jobs run
+    if(!request.is_discarded() && request.is_object() && request.value("type", "") == "metrics") {
+        reply(nlohmann::json{
+            {"id", request.value("id", nlohmann::json())},
+            {"status", "ok"},
+            {"metrics", nlohmann::json::parse(utils::metrics::to_json())}
+        }.dump());
+        return false;
+    }
+    queue.enqueue({line, reply});
+    return false;
+}
+
+#ifndef _WIN32
+void serve_socket(std::string socket_path, utils::tsqueue<job_t> &queue) {
+    int listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if(listen_fd < 0) {
+        logger::error("Failed to create socket");
+        std::exit(2);
+    }
+
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if(socket_path.size() >= sizeof(address.sun_path)) {
+        logger::error("Socket path '{}' is too long", socket_path);
+        std::exit(2);
+    }
+    std::strncpy(address.sun_path, socket_path.c_str(), sizeof(address.sun_path) - 1);
+    unlink(socket_path.c_str());
+    if(bind(listen_fd, (sockaddr*)&address, sizeof(address)) < 0 || listen(listen_fd, 16) < 0) {
+        logger::error("Failed to listen on '{}'", socket_path);
+        std::exit(2);
+    }
+    logger::info("Listening on {}", socket_path);
+
+    // Client threads are joined before returning, since they submit to `queue`. Finished ones
+    // are reaped as new clients connect.
+    struct Client {
+        std::thread thread;
+        int fd;
+        bool done = false;
+    };
+    std::mutex clients_mutex;
+    std::list<Client> clients;
+
+    while(true) {
+        int client_fd = accept(listen_fd, nullptr, nullptr);
+        if(client_fd < 0) {
+            break;
+        }
+
+        std::lock_guard<std::mutex> lock(clients_mutex);
+        for(auto it = clients.begin(); it != clients.end();) {
+            if(it->done) {
+                it->thread.join();
+                it = clients.erase(it);
+            } else {
+                it++;
+            }
+        }
+
+        std::list<Client>::iterator client = clients.emplace(clients.end());
+        client->fd = client_fd;
+        client->thread = std::thread([client, listen_fd, &queue, &clients_mutex]() {
+            std::shared_ptr<std::mutex> write_mutex = std::make_shared<std::mutex>();
+            // Replies to queued jobs keep the connection open after this thread exits
+            std::shared_ptr<int> fd(new int(client->fd), [](int *fd) { close(*fd); delete fd; });
+            // Set once the client has disconnected, so later replies are dropped instead of sent
+            std::shared_ptr<bool> gone = std::make_shared<bool>(false);
+            reply_fn reply = [fd, write_mutex, gone](std::string response) {
+                std::lock_guard<std::mutex> lock(*write_mutex);
+                if(*gone) {
+                    return;
+                }
+                response += "\n";
+                size_t written = 0;
+                while(written < response.size()) {
+                    ssize_t count = send(*fd, response.data() + written, response.size() - written, MSG_NOSIGNAL);
+                    if(count < 0 && errno == EINTR) {
+                        continue;
+                    }
+                    if(count <= 0) {
+                        logger::debug("Client disconnected, dropping its replies");
+                        *gone = true;
+                        return;
+                    }
+                    written += count;
+                }
+            };
+
+            std::string pending;
+            char buffer[4096];
+            ssize_t count;
+            bool stop = false;
+            while(!stop && (count = read(*fd, buffer, sizeof(buffer))) > 0) {
+                pending.append(buffer, count);
+                size_t newline;
+                while((newline = pending.find('\n')) != std::string::npos) {
+                    std::string line = pending.substr(0, newline);
+                    pending.erase(0, newline + 1);
+                    if(submit_line(line, queue, reply)) {
+                        shutdown(listen_fd, SHUT_RDWR);
+                        stop = true;
+                        break;
+                    }
+                }
+            }
+
+            std::lock_guard<std::mutex> lock(clients_mutex);
+            client->done = true;
+        });
+    }
+
+    // Stop reading from the remaining clients. Their connections stay writable for the results
+    // of jobs they already submitted.
+    {
+        std::lock_guard<std::mutex> lock(clients_mutex);
+        for(Client &client : clients) {
+            if(!client.done) {
+                shutdown(client.fd, SHUT_RD);
+            }
+        }
+    }
+    for(Client &client : clients) {
+        client.thread.join();
+    }
+    close(listen_fd);
+    unlink(socket_path.c_str());
+}
+#endif
+
+void serve_stdin(utils::tsqueue<job_t> &queue) {
+    std::shared_ptr<std::mutex> write_mutex = std::make_shared<std::mutex>();
+    reply_fn reply = [write_mutex](std::string response) {
+        std::lock_guard<std::mutex> lock(*write_mutex);
+        std::cout << response << std::endl;
+    };
+
+    std::string line;
+    while(std::getline(std::cin, line)) {
+        if(submit_line(line, queue, reply)) {
+            break;
+        }
+    }
+}
+
+int main(int argc, const char* argv[]) {
+    argparse::ArgumentParser parser("warpgate_serve", WARPGATE_VERSION);
+    int log_level = logger::level::warn;
+
+    build_argument_parser(parser, log_level);
+
+    try {
+        parser.parse_args(argc, argv);
+    } catch (const std::runtime_error& err) {
+        std::cerr << err.what() << std::endl;
+        std::cerr << parser;
+        std::exit(1);
+    }
+#ifndef _WIN32
+    // A client or stdout reader that goes away must only lose its own replies, not stop the service
+    std::signal(SIGPIPE, SIG_IGN);
+#endif
+
+    // Results are written to stdout, so keep the logs out of the way
+    logger::set_default_logger(logger::stderr_color_mt("warpgate_serve"));
+    logger::set_level(logger::level::level_enum(log_level));
+    utils::trace::start(parser);
+
+    logger::info("Starting warpgate_serve {}", WARPGATE_VERSION);
+    uint32_t job_thread_count = std::max(1u, parser.get<uint32_t>("--jobs"));
+    std::string path = parser.get<std::string>("--assets-directory");
+    std::filesystem::path server(path);
+    std::vector<std::filesystem::path> assets;
+    for(int i = 0; i < 24; i++) {
+        assets.push_back(server / ("assets_x64_" + std::to_string(i) + ".pack2"));
+    }
+    assets.push_back(server / "data_x64_0.pack2");
+
+    logger::info("Loading packs...");
+    utils::trace::Scope packs_scope("load_packs");
+    synthium::Manager manager(assets);
+    packs_scope.end();
+    logger::info("Manager loaded.");
+
+    logger::info("Loading materials.json");
+    utils::materials3::init_materials();
+    logger::info("Loaded materials.json");
+
+    std::shared_ptr<uint8_t[]> actorsockets_data;
+    std::vector<uint8_t> actorsockets_data_vector;
+    std::span<uint8_t> actorsockets_data_span;
+    try {
+        actorsockets_data_span = load_asset(manager, "ActorSockets.xml", actorsockets_data_vector, actorsockets_data);
+    } catch(std::exception &err) {
+        logger::error("{}", err.what());
+        std::exit(1);
+    }
+
+    ServeContext context{manager, std::make_shared<utils::ActorSockets>(actorsockets_data_span), parser.get<uint32_t>("--threads")};
+    utils::tsqueue<job_t> job_queue;
+
+    logger::info("Using {} job thread{}", job_thread_count, job_thread_count == 1 ? "" : "s");
+    std::vector<std::thread> job_pool;
+    for(uint32_t i = 0; i < job_thread_count; i++) {
+        job_pool.push_back(std::thread{process_jobs, std::ref(context), std::ref(job_queue)});
+    }
+
+#ifndef _WIN32
+    if(parser.present<std::string>("--socket")) {
+        serve_socket(*parser.present<std::string>("--socket"), job_queue);
+    } else {
+        serve_stdin(job_queue);
+    }
+#else
+    serve_stdin(job_queue);
+#endif
+
+    job_queue.close();
+    logger::info("Joining job thread{}...", job_pool.size() == 1 ? "" : "s");
+    for(uint32_t i = 0; i < job_pool.size(); i++) {
+        job_pool.at(i).join();
+    }
+    utils::metrics::record_max(utils::metrics::Counter::JobQueueHighWater, job_queue.high_water_mark());
+    if(std::optional<std::string> metrics_path = parser.present<std::string>("--metrics")) {
+        utils::metrics::write_json(*metrics_path);
+    }
+    // Stats go to stderr with the logs, since stdout carries the job results
+    utils::trace::report(parser, std::cerr);
+    logger::info("Done.");
+    return 0;
+}
@@ -13,9 +13,15 @@
 #include "zone_loader.h"
 #include "utils/gltf/chunk.h"
 #include "utils/gltf/dme.h"
+#include "utils/gltf/flora.h"
+#include "utils/gltf/meshopt.h"
 #include "utils/adr.h"
+#include "utils/mapped_file.h"
 #include "utils/materials_3.h"
+#include "utils/metrics.h"
 #include "utils/textures.h"
+#include "utils/trace.h"
+#include "utils/trace_options.h"
 #include "utils/tsqueue.h"
 #include "synthium/synthium.h"
 #include "tiny_gltf.h"
@@ -29,6 +35,38 @@ using namespace std::chrono_literals;
 
 namespace logger = spdlog;
 
+// Reads an asset, counting its size towards the pack bytes read
+static std::vector<uint8_t> read_asset(std::shared_ptr<synthium::Asset2> asset) {
+    std::vector<uint8_t> data = asset->get_data();
+    warpgate::utils::metrics::add(warpgate::utils::metrics::Counter::PackBytesRead, data.size());
+    return data;
+}
+
+// Whether the --instance-cache file may be written: it is missing, empty, or an earlier cache.
+// Anything else is refused, so a mistyped path cannot replace an unrelated file.
+static bool is_replaceable_cache(const std::filesystem::path &path) {
+    std::error_code err;
+    if(!std::filesystem::exists(path, err)) {
+        return true;
+    }
+    if(!std::filesystem::is_regular_file(path, err)) {
+        return false;
+    }
+    if(std::filesystem::is_empty(path, err)) {
+        return true;
+    }
+    std::ifstream input(path, std::ios::binary);
+    uint32_t magic = 0;
+    input.read((char*)&magic, sizeof(magic));
+    return input && magic == warpgate::zone::InstanceCache::magic;
+}
+
+// A model already parsed for this zone, shared by every object using the same DME and palette
+struct ZoneModel {
+    warpgate::utils::AABB aabb;
+    // The node holding the model's meshes, or -1 until an instance of it has been added
+    int node_index;
+};
 
 void process_images(
     synthium::Manager& manager,
@@ -78,7 +116,7 @@ void process_images(
             case warpgate::Semantic::Overlay4:
                 asset = manager.get(texture_name);
                 if(asset) {
-                    warpgate::utils::textures::save_texture(texture_name, asset->get_data(), output_directory);
+                    warpgate::utils::textures::save_texture(texture_name, read_asset(asset), output_directory);
                 }
                 break;
             case warpgate::Semantic::Bump:
@@ -89,7 +127,7 @@ void process_images(
             case warpgate::Semantic::bumpMap:
                 asset = manager.get(texture_name);
                 if(asset) {
-                    warpgate::utils::textures::process_normalmap(texture_name, asset->get_data(), output_directory);
+                    warpgate::utils::textures::process_normalmap(texture_name, read_asset(asset), output_directory);
                 }
                 break;
             case warpgate::Semantic::Spec:
@@ -102,14 +140,14 @@ void process_images(
                 asset = manager.get(texture_name);
                 asset2 = manager.get(albedo_name);
                 if(asset && asset2) {
-                    warpgate::utils::textures::process_specular(texture_name, asset->get_data(), asset2->get_data(), output_directory);
+                    warpgate::utils::textures::process_specular(texture_name, read_asset(asset), read_asset(asset2), output_directory);
                 }
                 break;
             case warpgate::Semantic::detailBump:
             case warpgate::Semantic::DetailBump:
                 asset = manager.get(texture_name);
                 if(asset) {
-                    warpgate::utils::textures::process_detailcube(texture_name, asset->get_data(), output_directory);
+                    warpgate::utils::textures::process_detailcube(texture_name, read_asset(asset), output_directory);
                 }
                 break;
             default:
@@ -121,6 +159,26 @@ void process_images(
     logger::info("Both queues closed, stopping thread");
 }
 
+// Scatters the flora of each chunk handed over by the terrain stage. Results are stored by chunk
+// so they can be merged in the same order on every run.
+void scatter_flora(
+    warpgate::utils::tsqueue<std::tuple<size_t, glm::dvec3, std::shared_ptr<uint8_t[]>, size_t>> &chunk_queue,
+    const warpgate::utils::gltf::flora::Ecosystems &ecosystems,
+    float density_scale,
+    std::optional<warpgate::utils::AABB> aabb,
+    std::vector<std::unordered_map<uint32_t, warpgate::utils::gltf::flora::Instances>> &chunk_instances
+) {
+    while(!chunk_queue.is_closed()) {
+        auto chunk_value = chunk_queue.try_dequeue_for(1ms);
+        if(!chunk_value) {
+            continue;
+        }
+        auto[chunk_index, origin, cnk0_data, cnk0_length] = *chunk_value;
+        warpgate::chunk::CNK0 cnk0({cnk0_data.get(), cnk0_length});
+        chunk_instances.at(chunk_index) = warpgate::utils::gltf::flora::scatter(cnk0, ecosystems, origin, density_scale, aabb);
+    }
+}
+
 void build_argument_parser(argparse::ArgumentParser &parser, int &log_level) {
     parser.add_description("C++ Forgelight Chunk to GLTF2 model conversion tool");
     parser.add_argument("input_file");
@@ -154,6 +212,35 @@ void build_argument_parser(argparse::ArgumentParser &parser, int &log_level) {
         .implicit_value(true)
         .nargs(0);
 
+    parser.add_argument("--quantized", "-q")
+        .help("Keep compact object vertex formats (normalized byte normals, short UVs, byte weights) using KHR_mesh_quantization")
+        .default_value(false)
+        .implicit_value(true)
+        .nargs(0);
+
+    parser.add_argument("--optimize", "-O")
+        .help("Reorder triangles and vertices for the GPU vertex cache, overdraw and vertex fetch. Requires meshoptimizer")
+        .default_value(false)
+        .implicit_value(true)
+        .nargs(0);
+
+    parser.add_argument("--meshopt-compression")
+        .help("Compress vertex and index data with EXT_meshopt_compression (glb only). Requires meshoptimizer")
+        .default_value(false)
+        .implicit_value(true)
+        .nargs(0);
+
+    parser.add_argument("--flora")
+        .help("Scatter the zone's vegetation over the exported chunks, drawn with EXT_mesh_gpu_instancing")
+        .default_value(false)
+        .implicit_value(true)
+        .nargs(0);
+
+    parser.add_argument("--flora-density")
+        .help("Scale the number of flora instances scattered by --flora")
+        .default_value(1.0f)
+        .scan<'g', float>();
+
     parser.add_argument("--assets-directory", "-d")
         .help("The directory where the game's assets are stored")
 #ifdef _WIN32
@@ -167,6 +254,14 @@ void build_argument_parser(argparse::ArgumentParser &parser, int &log_level) {
         .default_value(4u)
         .scan<'u', uint32_t>();
 
+    warpgate::utils::trace::add_arguments(parser);
+
+    parser.add_argument("--metrics")
+        .help("Write throughput counters (bytes read and decompressed, textures processed, ...) as JSON to this file when done");
+
+    parser.add_argument("--instance-cache")
+        .help("Read the zone's flattened instance transforms from this cache, writing it first if it is missing or stale");
+
     parser.add_argument("--aabb")
         .help("An axis aligned bounding box to constrain which assets are exported. (xmin zmin xmax zmax)")
         .nargs(4)
@@ -196,6 +291,9 @@ int main(int argc, char* argv[]) {
 
         logger::set_level(logger::level::level_enum(log_level));
 
+        std::optional<std::string> metrics_path = parser.present<std::string>("--metrics");
+        warpgate::utils::trace::start(parser);
+
         std::string input_str = parser.get<std::string>("input_file");
         
         logger::info("Converting file {} using zone_converter {}", input_str, WARPGATE_VERSION);
@@ -210,7 +308,9 @@ int main(int argc, char* argv[]) {
         });
 
         logger::info("Loading {} packs...", packs.size());
+        warpgate::utils::trace::Scope packs_scope("load_packs");
         synthium::Manager manager(packs);
+        packs_scope.end();
         logger::info("Manager loaded.");
 
         logger::info("Loading materials.json");
@@ -222,7 +322,7 @@ int main(int argc, char* argv[]) {
         std::vector<uint8_t> data_vector, chunk1_data_vector;
         std::span<uint8_t> data_span, chunk1_data_span;
         if(manager.contains(input_str)) {
-            data_vector = manager.get(input_str)->get_data();
+            data_vector = read_asset(manager.get(input_str));
             data_span = std::span<uint8_t>(data_vector.data(), data_vector.size());
         } else {
             std::ifstream input(input_filename, std::ios::binary | std::ios::ate);
@@ -256,6 +356,24 @@ int main(int argc, char* argv[]) {
 
         std::string format = parser.get<std::string>("--format");
         bool export_textures = !parser.get<bool>("--no-textures");
+        bool quantized = parser.get<bool>("--quantized");
+        bool optimize_meshes = parser.get<bool>("--optimize");
+        bool compress_meshes = parser.get<bool>("--meshopt-compression");
+        if((optimize_meshes || compress_meshes) && !warpgate::utils::gltf::meshopt::available()) {
+            logger::error("--optimize and --meshopt-compression require warpgate to be built with WARPGATE_USE_MESHOPTIMIZER");
+            std::exit(1);
+        }
+        if(compress_meshes && format != "glb") {
+            logger::error("--meshopt-compression requires glb output");
+            std::exit(1);
+        }
+        std::optional<std::string> instance_cache_path = parser.present("--instance-cache");
+        if(instance_cache_path && !is_replaceable_cache(*instance_cache_path)) {
+            logger::error("'{}' exists and is not an instance cache, refusing to overwrite it", *instance_cache_path);
+            std::exit(1);
+        }
+        bool export_flora = parser.get<bool>("--flora");
+        float flora_density = parser.get<float>("--flora-density");
         uint32_t image_processor_thread_count = parser.get<uint32_t>("--threads");
         // hmm
         warpgate::utils::tsqueue<
@@ -285,7 +403,9 @@ int main(int argc, char* argv[]) {
         }
 
         logger::info("Parsing zone...");
+        warpgate::utils::trace::Scope zone_scope("zone::parse");
         warpgate::zone::Zone continent(data_span);
+        zone_scope.end();
         logger::info("Parsed zone.");
 
         if(continent.version() > 3) {
@@ -293,6 +413,46 @@ int main(int argc, char* argv[]) {
             return 1;
         }
 
+        // Instance transforms are flattened once, or mapped from the cache written by an earlier run
+        std::unique_ptr<warpgate::utils::MappedFile> instance_cache_file;
+        std::vector<uint8_t> instance_cache_data;
+        std::optional<warpgate::zone::InstanceCache> zone_instances;
+        if(instance_cache_path && std::filesystem::is_regular_file(*instance_cache_path)) {
+            try {
+                instance_cache_file = std::make_unique<warpgate::utils::MappedFile>(*instance_cache_path);
+                if(warpgate::zone::InstanceCache::is_cache(instance_cache_file->data())) {
+                    zone_instances.emplace(instance_cache_file->data());
+                    if(!zone_instances->matches(continent)) {
+                        logger::warn("Instance cache '{}' was built from a different zone, rebuilding it", *instance_cache_path);
+                        zone_instances.reset();
+                    }
+                } else {
+                    logger::warn("Instance cache '{}' is truncated, rebuilding it", *instance_cache_path);
+                }
+            } catch(std::exception &err) {
+                logger::warn("Failed to load instance cache '{}': {}", *instance_cache_path, err.what());
+                zone_instances.reset();
+            }
+        }
+        if(zone_instances) {
+            logger::info("Loaded instance cache {}", *instance_cache_path);
+        } else {
+            warpgate::utils::trace::Scope flatten_scope("zone::flatten");
+            instance_cache_data = warpgate::zone::InstanceCache::build(continent, std::thread::hardware_concurrency());
+            flatten_scope.end();
+            instance_cache_file.reset();
+            if(instance_cache_path) {
+                std::ofstream cache_output(*instance_cache_path, std::ios::binary);
+                cache_output.write((char*)instance_cache_data.data(), instance_cache_data.size());
+                if(cache_output.fail()) {
+                    logger::warn("Failed to write instance cache '{}'", *instance_cache_path);
+                } else {
+                    logger::info("Wrote instance cache {}", *instance_cache_path);
+                }
+            }
+            zone_instances.emplace(instance_cache_data);
+        }
+
         tinygltf::Model gltf;
         tinygltf::Sampler dme_sampler, chunk_sampler;
         int dme_sampler_index = (int)gltf.samplers.size();
@@ -313,7 +473,7 @@ int main(int argc, char* argv[]) {
         gltf.scenes.push_back({});
 
         std::unordered_map<uint32_t, uint32_t> texture_indices;
-        std::unordered_map<uint32_t, std::vector<uint32_t>> material_indices;
+        std::unordered_map<uint64_t, uint32_t> material_indices;
 
         warpgate::zone::ZoneHeader header = continent.header();
 
@@ -346,26 +506,51 @@ int main(int argc, char* argv[]) {
                 chunk_indices.push_back({(int)(header.chunk_info.start_x + x), (int)(header.chunk_info.start_y + y)});
             }
         }
+        // Flora is scattered on worker threads as each chunk's terrain is added
+        std::optional<warpgate::utils::gltf::flora::Ecosystems> ecosystems;
+        warpgate::utils::tsqueue<std::tuple<size_t, glm::dvec3, std::shared_ptr<uint8_t[]>, size_t>> flora_queue;
+        std::vector<std::unordered_map<uint32_t, warpgate::utils::gltf::flora::Instances>> chunk_flora(chunk_indices.size());
+        std::vector<std::thread> flora_pool;
+        if(export_flora) {
+            ecosystems.emplace(continent);
+            uint32_t flora_thread_count = std::max(1u, std::thread::hardware_concurrency());
+            for(uint32_t i = 0; i < flora_thread_count; i++) {
+                flora_pool.push_back(std::thread{
+                    scatter_flora,
+                    std::ref(flora_queue),
+                    std::cref(*ecosystems),
+                    flora_density,
+                    aabb,
+                    std::ref(chunk_flora)
+                });
+            }
+        }
+
         logger::info("Adding {} chunks...", chunk_indices.size());
-        for(auto[x, z] : chunk_indices) {
+        for(size_t chunk_number = 0; chunk_number < chunk_indices.size(); chunk_number++) {
+            auto[x, z] = chunk_indices[chunk_number];
             std::string chunk_stem = continent_name + "_" + std::to_string(x) + "_" + std::to_string(z);
             std::unique_ptr<uint8_t[]> decompressed_cnk0_data, decompressed_cnk1_data;
             size_t cnk0_length, cnk1_length;
+            warpgate::utils::trace::Scope load_scope("chunk::load");
             {
-                std::vector<uint8_t> chunk0_data = manager.get(std::filesystem::path(chunk_stem).replace_extension(".cnk0").string())->get_data();
+                std::vector<uint8_t> chunk0_data = read_asset(manager.get(std::filesystem::path(chunk_stem).replace_extension(".cnk0").string()));
                 warpgate::chunk::Chunk compressed_chunk0(chunk0_data);
                 decompressed_cnk0_data = std::move(compressed_chunk0.decompress());
+                warpgate::utils::metrics::add(warpgate::utils::metrics::Counter::ChunkBytesDecompressed, compressed_chunk0.decompressed_size());
                 cnk0_length = compressed_chunk0.decompressed_size();
             }
             {
-                std::vector<uint8_t> chunk1_data = manager.get(std::filesystem::path(chunk_stem).replace_extension(".cnk1").string())->get_data();
+                std::vector<uint8_t> chunk1_data = read_asset(manager.get(std::filesystem::path(chunk_stem).replace_extension(".cnk1").string()));
                 warpgate::chunk::Chunk compressed_chunk1(chunk1_data);
                 decompressed_cnk1_data = std::move(compressed_chunk1.decompress());
+                warpgate::utils::metrics::add(warpgate::utils::metrics::Counter::ChunkBytesDecompressed, compressed_chunk1.decompressed_size());
                 cnk1_length = compressed_chunk1.decompressed_size();
             }
 
             warpgate::chunk::CNK0 cnk0({decompressed_cnk0_data.get(), cnk0_length});
             warpgate::chunk::CNK1 cnk1({decompressed_cnk1_data.get(), cnk1_length});
+            load_scope.end();
             int chunk_index = warpgate::utils::gltf::chunk::add_chunks_to_gltf(
                 gltf, cnk0, cnk1, chunk_image_queue, output_directory,
                 chunk_stem, chunk_sampler_index, export_textures);
@@ -376,7 +561,12 @@ int main(int argc, char* argv[]) {
             // }
             gltf.nodes.at(chunk_index).translation = translation;
             gltf.nodes.at(terrain_parent_index).children.push_back(chunk_index);
+            if(export_flora) {
+                glm::dvec3 origin(translation[0], translation[1], translation[2]);
+                flora_queue.enqueue({chunk_number, origin, std::shared_ptr<uint8_t[]>(std::move(decompressed_cnk0_data)), cnk0_length});
+            }
         }
+        flora_queue.close();
 
         int object_parent_index = (int)gltf.nodes.size();
         tinygltf::Node object_parent;
@@ -389,26 +579,42 @@ int main(int argc, char* argv[]) {
             glm::dvec4{0.0, 0.0, 0.0, 1.0},
         });
 
-        uint32_t objects_count = continent.objects_count();
+        std::unordered_map<std::string, ZoneModel> model_cache;
+        uint32_t objects_count = zone_instances->object_count();
         for(uint32_t i = 0; i < objects_count; i++) {
-            std::shared_ptr<warpgate::zone::RuntimeObject> object = continent.object(i);
-            logger::info("Loading {}", object->actor_file());
-            std::vector<uint8_t> adr_data = manager.get(object->actor_file())->get_data();
+            std::string actor_file(zone_instances->actor_file(i));
+            logger::info("Loading {}", actor_file);
+            warpgate::utils::trace::Scope load_scope("object::load");
+            std::vector<uint8_t> adr_data = read_asset(manager.get(actor_file));
             warpgate::utils::ADR adr(adr_data);
             std::optional<std::string> dme_name = adr.base_model();
             if(!dme_name) {
-                logger::warn("ADR {} did not have a model file?", object->actor_file());
+                logger::warn("ADR {} did not have a model file?", actor_file);
                 continue;
             }
-            std::vector<uint8_t> dme_data = manager.get(*dme_name)->get_data();
-            warpgate::DME dme(dme_data, std::filesystem::path(object->actor_file()).stem().string());
+            std::string object_name = std::filesystem::path(actor_file).stem().string();
+            std::string model_key = *dme_name + "|" + adr.base_palette().value_or("");
+            std::unordered_map<std::string, ZoneModel>::iterator model = model_cache.find(model_key);
+            // The DME only views dme_data, so both live until the meshes are added
+            std::vector<uint8_t> dme_data;
+            std::unique_ptr<warpgate::DME> dme;
+            if(model == model_cache.end()) {
+                warpgate::utils::metrics::add(warpgate::utils::metrics::Counter::ModelCacheMisses);
+                dme_data = read_asset(manager.get(*dme_name));
+                dme = std::make_unique<warpgate::DME>(dme_data, object_name);
+                warpgate::AABB aabb_data = dme->aabb();
+                warpgate::utils::AABB dme_aabb(aabb_data.min.x, aabb_data.min.y, aabb_data.min.z, aabb_data.max.x, aabb_data.max.y, aabb_data.max.z);
+                model = model_cache.emplace(model_key, ZoneModel{dme_aabb, -1}).first;
+            } else {
+                warpgate::utils::metrics::add(warpgate::utils::metrics::Counter::ModelCacheHits);
+            }
+            load_scope.end();
             
-            warpgate::AABB aabb_data = dme.aabb();
-            warpgate::utils::AABB dme_aabb(aabb_data.min.x, aabb_data.min.y, aabb_data.min.z, aabb_data.max.x, aabb_data.max.y, aabb_data.max.z);
             std::vector<uint32_t> instances_to_add;
-            uint32_t instance_count = object->instance_count();
+            uint32_t first_instance = zone_instances->first_instance(i);
+            uint32_t instance_count = zone_instances->instance_count(i);
             for(uint32_t j = 0; j < instance_count; j++) {
-                if(aabb && !aabb->overlaps(dme_aabb * object->instance(j).transform() /*(translation * rotation * scale)*/)) {
+                if(aabb && !aabb->overlaps(model->second.aabb * zone_instances->transform(first_instance + j) /*(translation * rotation * scale)*/)) {
                     continue;
                 }
                 instances_to_add.push_back(j);
@@ -416,22 +622,32 @@ int main(int argc, char* argv[]) {
             if(instances_to_add.size() == 0) {
                 continue;
             }
-            logger::info("Adding {} instances of {}", instances_to_add.size(), object->actor_file());
-            int object_index = warpgate::utils::gltf::dme::add_dme_to_gltf(gltf, dme, dme_image_queue, output_directory, texture_indices, material_indices, dme_sampler_index, export_textures, false, false);
-            gltf.nodes.at(object_parent_index).children.push_back(object_index);
+            logger::info("Adding {} instances of {}", instances_to_add.size(), actor_file);
+            // The first object using a model adds its meshes, later ones only add nodes referencing them
+            bool reuse_model = model->second.node_index != -1;
+            if(!reuse_model) {
+                if(!dme) {
+                    // Parsed before, but every instance was culled, so its meshes were never added
+                    dme_data = read_asset(manager.get(*dme_name));
+                    dme = std::make_unique<warpgate::DME>(dme_data, object_name);
+                }
+                model->second.node_index = warpgate::utils::gltf::dme::add_dme_to_gltf(gltf, *dme, dme_image_queue, output_directory, texture_indices, material_indices, dme_sampler_index, export_textures, false, false, quantized);
+                gltf.nodes.at(object_parent_index).children.push_back(model->second.node_index);
+            }
+            int object_index = model->second.node_index;
             for(auto it = instances_to_add.begin(); it != instances_to_add.end(); it++) {
-                glm::dvec4 translation = ((warpgate::zone::Float4)object->instance(*it).translation()).vector() * gltf_conversion;
-                glm::dvec4 rot = ((warpgate::zone::Float4)object->instance(*it).rotation()).vector();
-                glm::dquat rotation = glm::dquat(glm::eulerAngleYXZ(rot[0], rot[1], rot[2]));
-                glm::dvec4 scale = ((warpgate::zone::Float4)object->instance(*it).scale()).vector() * gltf_conversion;
+                uint32_t instance = first_instance + *it;
+                glm::dvec4 translation = glm::dvec4(glm::dvec3(zone_instances->positions()[instance]), 1.0) * gltf_conversion;
+                glm::dquat rotation = glm::dquat(zone_instances->rotations()[instance]);
+                glm::dvec4 scale = glm::dvec4(glm::dvec3(zone_instances->scales()[instance]), 1.0) * gltf_conversion;
                 tinygltf::Node parent;
                 int parent_index = (int)gltf.nodes.size();
-                parent.name = dme.get_name() + "_" + std::to_string(*it);
+                parent.name = object_name + "_" + std::to_string(*it);
                 parent.translation = {translation.x, translation.y, translation.z};
                 parent.rotation = {rotation.x, rotation.y, rotation.z, rotation.w};
                 parent.scale = {scale.x, scale.y, scale.z};
 
-                if(it == instances_to_add.begin()) {
+                if(it == instances_to_add.begin() && !reuse_model) {
                     gltf.nodes.at(object_index).name = parent.name;
                     gltf.nodes.at(object_index).translation = parent.translation;
                     gltf.nodes.at(object_index).rotation = parent.rotation;
@@ -453,6 +669,64 @@ int main(int argc, char* argv[]) {
                 gltf.nodes.at(object_parent_index).children.push_back(parent_index);
             }
         }
+        logger::info("Added {} unique models for {} objects", model_cache.size(), objects_count);
+
+        for(uint32_t i = 0; i < flora_pool.size(); i++) {
+            flora_pool.at(i).join();
+        }
+        if(export_flora) {
+            std::unordered_map<uint32_t, warpgate::utils::gltf::flora::Instances> flora_instances;
+            for(std::unordered_map<uint32_t, warpgate::utils::gltf::flora::Instances> &instances : chunk_flora) {
+                for(auto &[flora, chunk_instances] : instances) {
+                    flora_instances[flora].append(chunk_instances);
+                }
+                instances.clear();
+            }
+
+            int flora_parent_index = (int)gltf.nodes.size();
+            tinygltf::Node flora_parent;
+            flora_parent.name = "Flora";
+            gltf.nodes.push_back(flora_parent);
+            size_t flora_instance_count = 0;
+            // Each flora model is added once and drawn at all of its instances
+            for(uint32_t flora = 0; flora < ecosystems->flora_count(); flora++) {
+                std::unordered_map<uint32_t, warpgate::utils::gltf::flora::Instances>::iterator instances = flora_instances.find(flora);
+                if(instances == flora_instances.end() || instances->second.size() == 0) {
+                    continue;
+                }
+                warpgate::utils::trace::Scope load_scope("flora::load");
+                std::string model_name = ecosystems->flora_model(flora);
+                if(std::filesystem::path(model_name).extension() == ".adr") {
+                    std::shared_ptr<synthium::Asset2> adr_asset = manager.get(model_name);
+                    if(!adr_asset) {
+                        logger::warn("Flora {} uses missing actor {}", ecosystems->flora_name(flora), model_name);
+                        continue;
+                    }
+                    std::vector<uint8_t> adr_data = read_asset(adr_asset);
+                    std::optional<std::string> dme_name = warpgate::utils::ADR(adr_data).base_model();
+                    if(!dme_name) {
+                        logger::warn("ADR {} did not have a model file?", model_name);
+                        continue;
+                    }
+                    model_name = *dme_name;
+                }
+                std::shared_ptr<synthium::Asset2> dme_asset = manager.get(model_name);
+                if(!dme_asset) {
+                    logger::warn("Flora {} uses missing model {}", ecosystems->flora_name(flora), model_name);
+                    continue;
+                }
+                std::vector<uint8_t> dme_data = read_asset(dme_asset);
+                warpgate::DME dme(dme_data, ecosystems->flora_name(flora));
+                load_scope.end();
+
+                logger::info("Adding {} instances of {}", instances->second.size(), ecosystems->flora_name(flora));
+                int model_index = warpgate::utils::gltf::dme::add_dme_to_gltf(gltf, dme, dme_image_queue, output_directory, texture_indices, material_indices, dme_sampler_index, export_textures, false, false, quantized);
+                warpgate::utils::gltf::flora::add_instances_to_gltf(gltf, model_index, instances->second);
+                gltf.nodes.at(flora_parent_index).children.push_back(model_index);
+                flora_instance_count += instances->second.size();
+            }
+            logger::info("Added {} flora instances of {} models", flora_instance_count, gltf.nodes.at(flora_parent_index).children.size());
+        }
 
         uint32_t lights_count = continent.lights_count();
         std::unordered_map<uint64_t, uint32_t> light_index_map;
@@ -498,9 +772,20 @@ int main(int argc, char* argv[]) {
         gltf.asset.version = "2.0";
         gltf.asset.generator = "warpgate " + std::string(WARPGATE_VERSION) + " via tinygltf";
 
+        if(optimize_meshes) {
+            warpgate::utils::gltf::meshopt::optimize(gltf, std::thread::hardware_concurrency());
+        }
+
         logger::info("Writing GLTF2 file {}...", output_filename.filename().string());
+        warpgate::utils::trace::Scope write_scope("gltf::write");
         tinygltf::TinyGLTF writer;
-        writer.WriteGltfSceneToFile(&gltf, output_filename.string(), false, format == "glb", format == "gltf", format == "glb");
+        if(compress_meshes) {
+            warpgate::utils::gltf::meshopt::compress(gltf);
+            warpgate::utils::gltf::meshopt::write_glb(gltf, output_filename);
+        } else {
+            writer.WriteGltfSceneToFile(&gltf, output_filename.string(), false, format == "glb", format == "gltf", format == "glb");
+        }
+        write_scope.end();
         
         chunk_image_queue.close();
         dme_image_queue.close();
@@ -508,6 +793,12 @@ int main(int argc, char* argv[]) {
         for(uint32_t i = 0; i < image_processor_pool.size(); i++) {
             image_processor_pool.at(i).join();
         }
+        warpgate::utils::metrics::record_max(warpgate::utils::metrics::Counter::ImageQueueHighWater, chunk_image_queue.high_water_mark());
+        warpgate::utils::metrics::record_max(warpgate::utils::metrics::Counter::ImageQueueHighWater, dme_image_queue.high_water_mark());
+        if(metrics_path) {
+            warpgate::utils::metrics::write_json(*metrics_path);
+        }
+        warpgate::utils::trace::report(parser);
         logger::info("Done.");
     } catch(std::exception &err) {
         logger::error("Caught {}", err.what());